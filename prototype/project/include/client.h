@@ -25,13 +25,34 @@ namespace ECProject
     }
     std::string sayHelloToCoordinatorByGrpc(std::string hello);
     bool set(std::string key, std::string value);
-    bool SetParameterByGrpc(ECSchema input_ecschema);
+    // reset drops the stored objects, the parameters of a coordinator holding objects change only with it
+    bool SetParameterByGrpc(ECSchema input_ecschema, bool reset = false);
     bool get(std::string key, std::string &value);
+    bool get_range(std::string key, int offset, int length, std::string &value);
     bool delete_key(std::string key);
+    // batched set/get/delete, one round trip to the coordinator and one connection per proxy
+    bool set_batch(std::vector<std::string> keys, std::vector<std::string> values);
+    bool get_batch(std::vector<std::string> keys, std::vector<std::string> &values);
+    bool delete_batch(std::vector<std::string> keys);
     bool delete_stripe(int stripe_id);
     bool delete_all_stripes();
     // lrcwidestripe, merge
-    double merge(int num_of_stripes);
+    double merge(int num_of_stripes, int max_concurrency = 0);
+    // merge in the background, one stage for each element of stages
+    int start_merge(std::vector<int> stages, int max_concurrency = 0);
+    bool get_merge_status(int job_id, MergeJobInfo &info);
+    bool cancel_merge(int job_id);
+    // let the coordinator merge in the background, see MergePolicy
+    // split a merged stripe back into stripes of k data blocks
+    double split_stripe(int stripe_id);
+    // fold a stripe into a wider one, -1 to let the coordinator choose the wider one
+    double append_merge(int stripe_id, int wide_stripe_id = -1);
+    // find the stages merging every merge_factor stripes with the least cross-cluster traffic,
+    // return the job id if executed, 0 if only planned, -1 if failed
+    int plan_merge(int merge_factor, int max_stages, bool execute, std::vector<int> &stages, int max_concurrency = 0);
+    bool set_merge_policy(bool enable, std::vector<int> stages, int min_stripes_per_group = 0,
+                          int max_ops_per_sec = 0, long long bandwidth = 0, int max_concurrency = 0,
+                          int split_min_accesses = 0);
 
   private:
     std::unique_ptr<coordinator_proto::coordinatorService::Stub> m_coordinator_ptr;
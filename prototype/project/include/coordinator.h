@@ -10,12 +10,320 @@
 #include <mutex>
 #include <thread>
 #include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <deque>
+#include <chrono>
+#include <random>
+#include <pthread.h>
 // #define IF_DEBUG true
 #define IF_DEBUG false
+// the workers running merge jobs, the stages themselves run one at a time
+#define MERGE_WORKER_NUM 2
+#define BLOCK_SLAB_SIZE 4096
+// the shards of the object and stripe metadata
+#define METADATA_SHARD_NUM 16
+// the metadata log records between two snapshots, and how often the checkpointer looks
+#define METADATA_SNAPSHOT_RECORDS 1000000
+#define METADATA_CHECK_INTERVAL_MS 1000
+// objects up to the pack block size of the parameters are packed into stripes of blocks of that size,
+// a pack is sealed once its data blocks are full or it has been open for PACK_SEAL_TIMEOUT_MS
+#define PACK_SEAL_TIMEOUT_MS 200
+// the status of a node older than this is ignored by the placement, a node with less free space is full
+#define NODE_STATUS_TTL_MS 10000
+#define NODE_MIN_FREE_BYTES (64LL << 20)
 namespace ECProject
 {
+  // a reader-writer lock, locked exclusively through std::unique_lock and shared through SharedLock
+  class RWMutex
+  {
+  public:
+    RWMutex() { pthread_rwlock_init(&m_rwlock, nullptr); }
+    ~RWMutex() { pthread_rwlock_destroy(&m_rwlock); }
+    RWMutex(const RWMutex &) = delete;
+    RWMutex &operator=(const RWMutex &) = delete;
+    void lock() { pthread_rwlock_wrlock(&m_rwlock); }
+    void unlock() { pthread_rwlock_unlock(&m_rwlock); }
+    void lock_shared() { pthread_rwlock_rdlock(&m_rwlock); }
+    void unlock_shared() { pthread_rwlock_unlock(&m_rwlock); }
+
+  private:
+    pthread_rwlock_t m_rwlock;
+  };
+
+  class SharedLock
+  {
+  public:
+    explicit SharedLock(RWMutex &rwmutex) : m_rwmutex(rwmutex) { m_rwmutex.lock_shared(); }
+    ~SharedLock() { m_rwmutex.unlock_shared(); }
+    SharedLock(const SharedLock &) = delete;
+    SharedLock &operator=(const SharedLock &) = delete;
+
+  private:
+    RWMutex &m_rwmutex;
+  };
+
+  // the objects whose keys hash to the shard
+  // a checkCommitAbort parked until its object commits or its stripe is deleted, holding no thread,
+  // done answers it, or counts it towards the answer of its batch
+  typedef struct PendingCheck
+  {
+    std::string key;
+    int stripe_id;
+    ECProject::OpperateType opp;
+    std::function<void()> done;
+  } PendingCheck;
+
+  typedef struct ObjectShard
+  {
+    RWMutex rwlock;
+    std::unordered_map<std::string, std::vector<PendingCheck>> waiters; // the parked checks of each key
+    std::unordered_map<std::string, ObjectInfo> commit_table;
+    std::unordered_map<std::string, ObjectInfo> updating_table;
+  } ObjectShard;
+
+  // the stripes whose ids hash to the shard, the lock guards their blocks while the stripe table is locked shared
+  typedef struct StripeShard
+  {
+    RWMutex rwlock;
+    std::unordered_map<int, std::vector<PendingCheck>> waiters; // the parked checks of each stripe being deleted
+    std::unordered_set<int> deleting;
+    std::mutex access_mutex;
+    std::unordered_map<int, int> access; // GET requests of each stripe, for splitting
+  } StripeShard;
+
+  // the metadata of blocks, allocated from slabs and reused once freed,
+  // with the object keys interned once for all their blocks
+  class BlockArena
+  {
+  public:
+    Block *alloc(const Block &value);
+    void free(Block *block);
+    const std::string *intern_key(const std::string &key);
+    void clear();
+
+  private:
+    void release_key(const std::string *key);
+
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<Block[]>> m_slabs;
+    int m_used_in_last_slab = BLOCK_SLAB_SIZE;
+    std::vector<Block *> m_free_blocks;
+    std::unordered_map<std::string, int> m_keys; // the blocks referring to each key
+  };
+
+  // the candidates of a selection, drawn without replacement by a partial Fisher-Yates shuffle,
+  // a draw swaps a random free candidate past the free part, a new round frees them all again
+  class CandidatePool
+  {
+  public:
+    void reset(const std::vector<int> &candidates);
+    void begin_round(int round);
+    // a free candidate accepted by the filter, -1 if no candidate is accepted
+    // with weights, a candidate is drawn with the probability of its weight, in O(free candidates)
+    int draw(std::mt19937 &gen, const std::function<bool(int)> &accept,
+             const std::function<double(int)> &weight = nullptr);
+    int size() const { return int(m_candidates.size()); }
+
+  private:
+    std::vector<int> m_candidates;
+    int m_free = 0;
+    int m_round = -1;
+  };
+
+  // the status of a node as last reported through the proxy of its cluster
+  typedef struct NodeLoad
+  {
+    long long free_bytes = -1; // unknown
+    int block_num = 0;
+    long long io_bytes_per_sec = 0;
+    std::chrono::steady_clock::time_point reported;
+  } NodeLoad;
+
+  // the stripe small objects are appended to, buffered by the proxy of cluster_id until sealed,
+  // its objects commit with it
+  typedef struct OpenPack
+  {
+    int stripe_id = -1;
+    int cluster_id = -1;
+    int block_size = 0;
+    int used = 0; // bytes appended
+    std::vector<std::string> keys;
+    std::chrono::steady_clock::time_point opened;
+    proxy_proto::ObjectAndPlacement placement; // of the blocks of the pack, sent with the seal
+  } OpenPack;
+
+  // a proxy call issued asynchronously, kept alive until its callback
+  template <typename Request, typename Reply>
+  struct ProxyCall
+  {
+    grpc::ClientContext context;
+    Request request;
+    Reply reply;
+  };
+
+  // the proxy calls of a fan-out are issued asynchronously and waited for together,
+  // the requests, replies and contexts live as long as the fan-out
+  class ProxyFanout
+  {
+  public:
+    ~ProxyFanout() { wait(); }
+    grpc::ClientContext *context();
+    template <typename T>
+    T *hold()
+    {
+      std::shared_ptr<T> value = std::make_shared<T>();
+      std::unique_lock<std::mutex> lck(m_mutex);
+      m_held.push_back(value);
+      return value.get();
+    }
+    std::function<void(grpc::Status)> done(const std::string &proxy);
+    void wait();
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<grpc::ClientContext> m_contexts;
+    std::vector<std::shared_ptr<void>> m_held;
+    int m_pending = 0;
+  };
+
+  // the records of the metadata log, each holds the state after the change so replaying one twice is harmless
+  enum MetaRecordType
+  {
+    META_PARAMETER = 1, // resets the metadata
+    META_PUT_STRIPE,
+    META_DEL_STRIPE,
+    META_PUT_OBJECT,
+    META_DEL_OBJECT,
+    META_GROUP_APPEND, // a new stripe joins the last merge group or starts a new one
+    META_MERGE_GROUPS,
+    META_COUNTERS
+  };
+
+  // append-only log of metadata records, each framed by its length and checksum,
+  // concurrent syncs are served by a single write and fdatasync of all the records appended so far
+  class MetadataLog
+  {
+  public:
+    ~MetadataLog();
+    bool open(const std::string &dir, long long valid_bytes);
+    bool is_open();
+    long long append(const std::string &record);
+    void sync(long long lsn = -1);
+    bool rotate();
+    long long records_since_rotate();
+    static void frame(std::string &buf, const std::string &record);
+    static long long replay(const std::string &path, const std::function<void(const char *, int)> &apply);
+
+  private:
+    void flush_locked(std::unique_lock<std::mutex> &lck);
+    static bool append_log(const std::string &from, const std::string &to);
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::string m_dir;
+    int m_fd = -1;
+    std::string m_buffer;
+    long long m_next_lsn = 0;
+    long long m_synced_lsn = 0;
+    long long m_rotated_lsn = 0;
+    bool m_flushing = false;
+  };
+
+  // the number of blocks sent across clusters and within a cluster by each step of a merge
+  typedef struct MergeTraffic
+  {
+    int g_cross = 0, g_intra = 0;
+    int l_cross = 0, l_intra = 0;
+    int d_cross = 0, d_intra = 0;
+  } MergeTraffic;
+
+  // the plan of merging a batch of stripes into a larger stripe
+  typedef struct MergeBatch
+  {
+    std::vector<int> old_stripe_ids;
+    Stripe larger_stripe;
+    int block_size = 0;
+    int g_cluster_id = -1;
+    std::vector<int> l_cluster_id;
+    std::map<int, proxy_proto::locationInfo> block_location;
+    std::vector<std::map<int, proxy_proto::locationInfo>> parity_location;
+    proxy_proto::mainRecalPlan g_main_plan;
+    std::vector<proxy_proto::mainRecalPlan> l_main_plan;
+    std::vector<proxy_proto::NodeAndBlock> old_parities; // by group, the global ones at l
+    std::vector<Block *> old_parity_blocks;              // freed once the batch is merged
+    std::vector<std::unordered_set<int>> old_parities_cluster_set;
+    std::vector<std::string> block_to_move_key;
+    std::vector<int> block_src_node;
+    std::vector<int> block_des_node;
+    std::vector<int> block_to_move_group; // group of a new local parity, -1 for others
+    int num2mov_v = 0, num2mov_k = 0;
+    std::unordered_set<int> clusters; // the clusters touched by the merge
+    double t_lc = 0.0, t_gc = 0.0, t_dc = 0.0;
+    MergeTraffic traffic;
+    long long g_bytes = 0, l_bytes = 0, d_bytes = 0; // cross-cluster traffic of each step
+  } MergeBatch;
+
+  // a step of merging a batch, dispatched once the steps it depends on are done
+  typedef struct MergeTask
+  {
+    std::vector<int> deps;
+    std::vector<int> clusters; // the clusters whose proxy is used exclusively, i.e. as the main proxy
+    std::function<void()> run;
+  } MergeTask;
+
+  typedef struct MergeJob
+  {
+    MergeJobInfo info;
+    std::vector<int> stages; // the number of stripes merged into one in each stage
+    int max_concurrency = 0;
+    bool cancelling = false;
+  } MergeJob;
+
+  // policy of the background merging
+  typedef struct MergePolicy
+  {
+    bool enable = false;
+    std::vector<int> stages;       // the number of stripes merged into one in each stage
+    int min_stripes_per_group = 0; // launch a stage only when each merge group has as many stripes
+    int max_ops_per_sec = 0;       // and the SET and GET requests are fewer, 0 for no limit
+    long long bandwidth = 0;       // cross-cluster bytes per second, 0 for no limit
+    int check_interval_ms = 1000;
+    int max_concurrency = 0;
+    int split_min_accesses = 0; // split a merged stripe read as often within a check, decayed by half, 0 for never
+  } MergePolicy;
+
+  // the merge metadata, to undo the stages simulated by a dry run
+  typedef struct MergeSnapshot
+  {
+    std::map<int, Cluster> cluster_table;
+    std::map<int, Node> node_table;
+    std::map<int, Stripe> stripe_table; // only the stripes a stage may touch
+    std::vector<std::vector<int>> merge_groups;
+    int merge_degree = 0;
+    int first_stripe_id = 0;
+    int next_stripe_id = 0; // the simulated stages take their stripe ids from here, not from the real counter
+    std::unordered_map<Block *, Block> blocks;
+    std::vector<Block *> new_blocks; // allocated by the simulated stages
+  } MergeSnapshot;
+
+  // the client requests that wait on proxies are served by callbacks, parking as reactors instead of holding threads,
+  // the rest, merging included, stay on the threads of the sync server
+  typedef coordinator_proto::coordinatorService::WithCallbackMethod_uploadOriginKeyValue<
+      coordinator_proto::coordinatorService::WithCallbackMethod_checkCommitAbort<
+          coordinator_proto::coordinatorService::WithCallbackMethod_getValue<
+              coordinator_proto::coordinatorService::WithCallbackMethod_delByKey<
+                  coordinator_proto::coordinatorService::WithCallbackMethod_delByStripe<
+                      coordinator_proto::coordinatorService::WithCallbackMethod_uploadOriginKeyValues<
+                          coordinator_proto::coordinatorService::WithCallbackMethod_checkCommitAborts<
+                              coordinator_proto::coordinatorService::WithCallbackMethod_getValues<
+                                  coordinator_proto::coordinatorService::WithCallbackMethod_delByKeys<
+                                      coordinator_proto::coordinatorService::Service>>>>>>>>>
+      CoordinatorService;
+
   class CoordinatorImpl final
-      : public coordinator_proto::coordinatorService::Service
+      : public CoordinatorService
   {
   public:
     CoordinatorImpl()
@@ -23,8 +331,26 @@ namespace ECProject
       m_cur_cluster_id = 0;
       m_cur_stripe_id = 0;
       m_merge_degree = 0;
+      for (int i = 0; i < MERGE_WORKER_NUM; i++)
+      {
+        m_merge_workers.push_back(std::thread(&CoordinatorImpl::merge_worker, this));
+      }
+      m_merge_workers.push_back(std::thread(&CoordinatorImpl::merge_daemon, this));
+      m_merge_workers.push_back(std::thread(&CoordinatorImpl::metadata_checkpointer, this));
+      m_merge_workers.push_back(std::thread(&CoordinatorImpl::pack_sealer, this));
     }
-    ~CoordinatorImpl(){};
+    ~CoordinatorImpl()
+    {
+      {
+        std::unique_lock<std::mutex> lck(m_job_mutex);
+        m_stop_merge_workers = true;
+        m_job_cv.notify_all();
+      }
+      for (int i = 0; i < int(m_merge_workers.size()); i++)
+      {
+        m_merge_workers[i].join();
+      }
+    };
     grpc::Status setParameter(
         grpc::ServerContext *context,
         const coordinator_proto::Parameter *parameter,
@@ -38,65 +364,200 @@ namespace ECProject
         const coordinator_proto::RequestToCoordinator *helloRequestToCoordinator,
         coordinator_proto::ReplyFromCoordinator *helloReplyFromCoordinator) override;
     // set
-    grpc::Status uploadOriginKeyValue(
-        grpc::ServerContext *context,
+    grpc::ServerUnaryReactor *uploadOriginKeyValue(
+        grpc::CallbackServerContext *context,
         const coordinator_proto::RequestProxyIPPort *keyValueSize,
         coordinator_proto::ReplyProxyIPPort *proxyIPPort) override;
     grpc::Status reportCommitAbort(
         grpc::ServerContext *context,
         const coordinator_proto::CommitAbortKey *commit_abortkey,
         coordinator_proto::ReplyFromCoordinator *helloReplyFromCoordinator) override;
-    grpc::Status checkCommitAbort(
-        grpc::ServerContext *context,
+    grpc::ServerUnaryReactor *checkCommitAbort(
+        grpc::CallbackServerContext *context,
         const coordinator_proto::AskIfSuccess *key_opp,
         coordinator_proto::RepIfSuccess *reply) override;
     // get
-    grpc::Status getValue(
-        grpc::ServerContext *context,
+    grpc::ServerUnaryReactor *getValue(
+        grpc::CallbackServerContext *context,
         const coordinator_proto::KeyAndClientIP *keyClient,
         coordinator_proto::RepIfGetSuccess *getReplyClient) override;
     // delete
-    grpc::Status delByKey(
-        grpc::ServerContext *context,
+    grpc::ServerUnaryReactor *delByKey(
+        grpc::CallbackServerContext *context,
         const coordinator_proto::KeyFromClient *del_key,
         coordinator_proto::RepIfDeling *delReplyClient) override;
-    grpc::Status delByStripe(
-        grpc::ServerContext *context,
+    grpc::ServerUnaryReactor *delByStripe(
+        grpc::CallbackServerContext *context,
         const coordinator_proto::StripeIdFromClient *stripeid,
         coordinator_proto::RepIfDeling *delReplyClient) override;
+    // batch, the objects placed on or read through the same proxy go to it in one call
+    grpc::ServerUnaryReactor *uploadOriginKeyValues(
+        grpc::CallbackServerContext *context,
+        const coordinator_proto::RequestProxyIPPorts *keyValueSizes,
+        coordinator_proto::ReplyProxyIPPorts *proxyIPPorts) override;
+    grpc::Status reportCommitAborts(
+        grpc::ServerContext *context,
+        const coordinator_proto::CommitAbortKeys *commit_abortkeys,
+        coordinator_proto::ReplyFromCoordinator *helloReplyFromCoordinator) override;
+    grpc::ServerUnaryReactor *checkCommitAborts(
+        grpc::CallbackServerContext *context,
+        const coordinator_proto::AskIfSuccessBatch *key_opps,
+        coordinator_proto::RepIfSuccess *reply) override;
+    grpc::ServerUnaryReactor *getValues(
+        grpc::CallbackServerContext *context,
+        const coordinator_proto::KeysAndClientIP *keysClient,
+        coordinator_proto::RepIfGetSuccesses *getReplyClient) override;
+    grpc::ServerUnaryReactor *delByKeys(
+        grpc::CallbackServerContext *context,
+        const coordinator_proto::KeysFromClient *del_keys,
+        coordinator_proto::RepIfDeling *delReplyClient) override;
     // merge
     grpc::Status requestMerge(
         grpc::ServerContext *context,
         const coordinator_proto::NumberOfStripesToMerge *numofstripe,
         coordinator_proto::RepIfMerged *mergeReplyClient) override;
+    // merge jobs, run in the background by the merge workers
+    grpc::Status startMerge(
+        grpc::ServerContext *context,
+        const coordinator_proto::MergeJobRequest *job_request,
+        coordinator_proto::MergeJobStatus *job_status) override;
+    grpc::Status getMergeStatus(
+        grpc::ServerContext *context,
+        const coordinator_proto::MergeJobId *job_id,
+        coordinator_proto::MergeJobStatus *job_status) override;
+    grpc::Status cancelMerge(
+        grpc::ServerContext *context,
+        const coordinator_proto::MergeJobId *job_id,
+        coordinator_proto::MergeJobStatus *job_status) override;
+    grpc::Status setMergePolicy(
+        grpc::ServerContext *context,
+        const coordinator_proto::MergePolicy *policy,
+        coordinator_proto::RepIfSuccess *reply) override;
+    grpc::Status planMerge(
+        grpc::ServerContext *context,
+        const coordinator_proto::MergePlanRequest *plan_request,
+        coordinator_proto::MergeSchedule *schedule) override;
+    grpc::Status appendMerge(
+        grpc::ServerContext *context,
+        const coordinator_proto::AppendMergeRequest *append_request,
+        coordinator_proto::RepIfMerged *mergeReplyClient) override;
+    grpc::Status splitStripe(
+        grpc::ServerContext *context,
+        const coordinator_proto::StripeIdFromClient *stripe_id,
+        coordinator_proto::RepIfMerged *mergeReplyClient) override;
     // other
     grpc::Status listStripes(
         grpc::ServerContext *context,
         const coordinator_proto::RequestToCoordinator *req,
         coordinator_proto::RepStripeIds *listReplyClient) override;
+    grpc::Status reportNodeStatus(
+        grpc::ServerContext *context,
+        const coordinator_proto::NodeStatuses *statuses,
+        coordinator_proto::ReplyFromCoordinator *reply) override;
 
     bool init_clusterinfo(std::string m_clusterinfo_path);
     bool init_proxyinfo();
     void update_stripe_info_in_node(bool add_or_sub, int t_node_id, int stripe_id);
+    bool recover_metadata(const std::string &dir);
+    void checkpoint_metadata();
+    void metadata_checkpointer();
+    void pack_sealer();
+    void reset_metadata();
+    void rebuild_cluster_index();
+    void apply_metadata_record(const char *data, int len);
+    std::string parameter_record();
+    std::string counters_record();
+    std::string merge_groups_record();
+    std::string group_append_record(int stripe_id);
+    std::string stripe_record(const Stripe &stripe);
+    std::string del_stripe_record(int stripe_id);
+    std::string object_record(const std::string &key, const ObjectInfo &object_info);
+    std::string del_object_record(const std::string &key);
     int randomly_select_a_cluster(int stripe_id);
+    int randomly_select_a_cluster(int stripe_id, const std::function<bool(int)> &accept);
     int randomly_select_a_node(int cluster_id, int stripe_id);
+    int take_a_free_cluster();
+    void node_weights(int cluster_id, std::unordered_map<int, double> &weights);
     int generate_placement(int stripe_id, int block_size);
     void blocks_in_cluster(std::map<char, std::vector<ECProject::Block *>> &block_info, int cluster_id, int stripe_id);
     void find_max_group(int &max_group_id, int &max_group_num, int cluster_id, int stripe_id);
     int count_block_num(char type, int cluster_id, int stripe_id, int group_id);
+    void add_block_to_cluster(Block *block);
+    void remove_block_from_cluster(int cluster_id, Block *block);
+    void update_block_stripe(Block *block, int stripe_id);
     bool find_block(char type, int cluster_id, int stripe_id);
+    bool check_merge_stage(int num_of_stripes);
+    bool merge_stage(int num_of_stripes, int max_concurrency, MergeJobInfo &info);
+    void regroup_merge_stripes(int num_of_stripes);
+    void plan_merge_stage(int num_of_stripes, std::vector<MergeBatch> &batches, std::vector<std::vector<int>> &new_merge_groups,
+                          int *next_stripe_id = nullptr);
+    void simulate_merge_stage(int num_of_stripes, MergeTraffic &traffic, MergeSnapshot &snapshot);
+    bool split_stripe(int stripe_id, MergeJobInfo &info);
+    bool plan_split_stripe(int stripe_id, std::vector<MergeBatch> &batches, std::vector<Block *> &old_parity_blocks);
+    std::vector<int> hot_stripes_to_split(int min_accesses);
+    void update_object_stripe(Stripe &stripe);
+    bool append_merge(int stripe_id, int wide_stripe_id, MergeJobInfo &info);
+    int select_wide_stripe(int stripe_id);
+    bool plan_merge_schedule(int merge_factor, int max_stages, std::vector<int> &stages, MergeTraffic &traffic);
+    void take_merge_snapshot(MergeSnapshot &snapshot);
+    void restore_merge_snapshot(MergeSnapshot &snapshot);
+    void plan_merge_batch(std::vector<int> &stripe_ids, MergeBatch &batch, int l_stripe_id);
+    void estimate_merge_traffic(MergeBatch &batch);
+    void execute_merge_batch(MergeBatch &batch);
+    void run_merge_tasks(std::vector<MergeTask> &tasks);
+    int add_merge_job(std::vector<int> &stages, int max_concurrency);
+    void merge_worker();
+    void merge_daemon();
+    void fill_merge_status(MergeJobInfo &info, coordinator_proto::MergeJobStatus *job_status);
 
   private:
-    std::mutex m_mutex;
-    std::condition_variable cv;
+    ObjectShard &object_shard(const std::string &key);
+    StripeShard &stripe_shard(int stripe_id);
+    int place_object(const std::string &key, int valuesizebytes,
+                     proxy_proto::ObjectAndPlacement &object_placement, ObjectInfo &new_object);
+    int place_stripe(int stripe_id, const std::string &key, int valuesizebytes, int block_size,
+                     proxy_proto::ObjectAndPlacement &object_placement);
+    // small objects, with m_pack_mutex locked for open_pack and seal_pack
+    int pack_object(const std::string &key, int valuesizebytes,
+                    proxy_proto::ObjectAndPlacement &object_placement, ObjectInfo &new_object);
+    void open_pack();
+    void seal_pack();
+    bool delete_packed_object(const std::string &key, std::string &empty_pack, std::vector<PendingCheck> &checks);
+    void drop_pack_members(const std::string &key, std::vector<PendingCheck> &checks);
+    std::string plan_get(const std::string &key, const std::string &client_ip, int client_port,
+                         proxy_proto::ObjectAndPlacement &object_placement, int offset = 0, int length = 0);
+    std::string plan_delete_key(const std::string &key, proxy_proto::NodeAndBlock &node_block);
+    void commit_abort(const coordinator_proto::CommitAbortKey &commit_abortkey, std::vector<PendingCheck> &checks);
+    void park_check(const coordinator_proto::AskIfSuccess &key_opp, std::function<void()> done,
+                    std::vector<PendingCheck> &checks);
+    // with the shard locked, move out the checks parked on the key or stripe that are now satisfied
+    void wake_object_checks(ObjectShard &o_shard, const std::string &key, std::vector<PendingCheck> &checks);
+    void wake_stripe_checks(StripeShard &s_shard, int stripe_id, std::vector<PendingCheck> &checks);
+    void finish_checks(std::vector<PendingCheck> &checks);
+    // with the stripe table locked exclusively to mark or unmark, at least shared to look
+    void set_stripes_merging(const std::vector<int> &stripe_ids, bool merging);
+    bool stripe_merging(int stripe_id);
+    bool stripe_deleting(int stripe_id);
+    // with no lock held, returns at once for -1
+    void wait_stripe_merged(int stripe_id);
+
+    // locked shared to look up stripes, exclusively to add or drop them and by merges rewriting the layout,
+    // taken before the shard of a stripe, then the shard of an object key
+    RWMutex m_stripe_table_rwlock;
+    // the cluster and node tables, when blocks are dropped with the stripe table locked shared
+    std::mutex m_placement_mutex;
+    ObjectShard m_object_shards[METADATA_SHARD_NUM];
+    StripeShard m_stripe_shards[METADATA_SHARD_NUM];
     int m_cur_cluster_id = 0;
-    int m_cur_stripe_id = 0;
+    std::atomic<int> m_cur_stripe_id{0};
+    // the stripes whose blocks a merge, split or append has planned to move, from the plan until the new
+    // stripe is installed, their GETs and DELs wait for it instead of using the rewritten blocks
+    std::mutex m_merging_mutex;
+    std::condition_variable m_merging_cv;
+    std::unordered_set<int> m_merging_stripes;
     std::map<std::string, std::unique_ptr<proxy_proto::proxyService::Stub>>
         m_proxy_ptrs;
     ECSchema m_encode_parameters;
-    std::unordered_map<std::string, ObjectInfo> m_object_commit_table;
-    std::unordered_map<std::string, ObjectInfo> m_object_updating_table;
-    std::vector<int> m_stripe_deleting_table;
     std::map<int, Cluster> m_cluster_table;
     std::map<int, Node> m_node_table;
     std::map<int, Stripe> m_stripe_table;
@@ -104,8 +565,37 @@ namespace ECProject
     // merge groups, for DIS and OPT, the stripes from the same group object to the selected placement scheme
     std::vector<std::vector<int>> m_merge_groups;
     std::vector<int> m_free_clusters;
+    // the clusters and the nodes of each cluster to place the blocks of a stripe, one round per stripe
+    CandidatePool m_cluster_pool;
+    std::map<int, CandidatePool> m_node_pools;
+    // node_ip:node_port -> node_id
+    std::unordered_map<std::string, int> m_node_ids;
+    std::mutex m_node_load_mutex;
+    std::unordered_map<int, NodeLoad> m_node_loads;
     int m_merge_degree = 0;
     int m_agg_start_cid = 0;
+    std::atomic<int> m_cur_task_id{0};
+    // merge jobs, the merge metadata is changed by one job, stage, split or append at a time,
+    // a job holds it for all its stages
+    std::recursive_mutex m_merge_mutex;
+    std::mutex m_job_mutex;
+    std::condition_variable m_job_cv;
+    std::map<int, MergeJob> m_merge_jobs;
+    std::deque<int> m_merge_job_queue;
+    std::vector<std::thread> m_merge_workers;
+    bool m_stop_merge_workers = false;
+    int m_cur_job_id = 0;
+    MergePolicy m_merge_policy;
+    std::atomic<long long> m_num_of_ops{0};
+    BlockArena m_block_arena;
+    std::string m_metadata_dir;
+    MetadataLog m_meta_log;
+    std::mutex m_checkpoint_mutex;
+    bool m_parameters_set = false; // by a client or by the recovered metadata
+    // taken before the stripe table and the object shards
+    std::mutex m_pack_mutex;
+    OpenPack m_open_pack;
+    std::unordered_map<int, std::unordered_set<std::string>> m_pack_members; // the committed objects of each pack
   };
 
   class Coordinator
@@ -113,12 +603,15 @@ namespace ECProject
   public:
     Coordinator(
         std::string m_coordinator_ip_port,
-        std::string m_clusterinfo_path)
+        std::string m_clusterinfo_path,
+        std::string m_metadata_dir)
         : m_coordinator_ip_port{m_coordinator_ip_port},
-          m_clusterinfo_path{m_clusterinfo_path}
+          m_clusterinfo_path{m_clusterinfo_path},
+          m_metadata_dir{m_metadata_dir}
     {
       m_coordinatorImpl.init_clusterinfo(m_clusterinfo_path);
       m_coordinatorImpl.init_proxyinfo();
+      m_coordinatorImpl.recover_metadata(m_metadata_dir);
     };
     // Coordinator
     void Run()
@@ -137,6 +630,7 @@ namespace ECProject
   private:
     std::string m_coordinator_ip_port;
     std::string m_clusterinfo_path;
+    std::string m_metadata_dir;
     ECProject::CoordinatorImpl m_coordinatorImpl;
   };
 } // namespace ECProject
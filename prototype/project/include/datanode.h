@@ -7,8 +7,12 @@
 #include <grpcpp/grpcpp.h>
 #include <asio.hpp>
 #include <string>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #define IF_DEBUG true
 // #define IF_DEBUG false
+#define READ_CHUNK_SIZE 262144
 namespace ECProject
 {
     class DatanodeImpl final
@@ -20,6 +24,8 @@ namespace ECProject
             m_ip = datanode_ip_port.substr(0, datanode_ip_port.find(':'));
             m_port = std::stoi(datanode_ip_port.substr(datanode_ip_port.find(':') + 1, datanode_ip_port.size()));
             m_download_port = m_port + 20;
+            m_block_num = count_blocks();
+            m_last_heartbeat = std::chrono::steady_clock::now();
         }
         ~DatanodeImpl(){};
         grpc::Status checkalive(
@@ -41,8 +47,15 @@ namespace ECProject
             grpc::ServerContext *context,
             const datanode_proto::DelInfo *del_info,
             datanode_proto::RequestResult *response) override;
+        // the load reported to the coordinator through the proxy
+        grpc::Status heartbeat(
+            grpc::ServerContext *context,
+            const datanode_proto::CheckaliveCMD *request,
+            datanode_proto::NodeStatus *status) override;
 
     private:
+        int count_blocks();
+        std::string storage_dir() { return "./storage/" + std::to_string(m_port) + "/"; }
         std::string datanode_ip_port;
         std::string m_ip;
         int m_port;
@@ -50,6 +63,10 @@ namespace ECProject
         int m_download_port;
         asio::io_context io_context;
         asio::ip::tcp::acceptor acceptor;
+        std::atomic<int> m_block_num{0};
+        std::atomic<long long> m_io_bytes{0}; // read and written since the last heartbeat
+        std::mutex m_heartbeat_mutex;
+        std::chrono::steady_clock::time_point m_last_heartbeat;
     };
 
     class DataNode
@@ -17,5 +17,8 @@ namespace ECProject
     int check_decodable_azure_lrc(int k, int g, int l, std::vector<int> failed_block, std::vector<int> new_matrix);
     bool encode_partial_blocks_for_gr(int k, int m, char **data_ptrs, char **coding_ptrs, int blocksize, std::shared_ptr<std::vector<int>> data_idx_ptrs, int block_num, EncodeType encode_type);
     bool perform_addition(char **data_ptrs, char **coding_ptrs, int blocksize, int block_num, int parity_num);
+    bool make_decoding_coefficients(int k, int g_m, int real_l, std::vector<int> &survive_idxs, std::vector<int> &failed_idxs, std::vector<int> &coefficients, EncodeType encode_type);
+    bool make_recal_coefficients(int k, int g_m, int real_l, std::vector<int> &data_idxs, std::vector<int> &group_idxs, std::vector<int> &parity_idxs, std::vector<int> &coefficients, EncodeType encode_type);
+    bool plan_partial_decoding(int k, int g_m, int real_l, std::vector<int> &received_idxs, std::vector<int> &candidate_idxs, std::vector<int> &failed_idxs, std::vector<int> &survive_idxs, std::vector<int> &coefficients, EncodeType encode_type);
 }
 #endif
\ No newline at end of file
@@ -29,19 +29,41 @@ namespace ECProject
     AGG,
     OPT
   };
+  enum MergeJobState
+  {
+    MERGE_QUEUED,
+    MERGE_RUNNING,
+    MERGE_DONE,
+    MERGE_FAILED,
+    MERGE_CANCELLED
+  };
 
   typedef struct Block
   {
-    int block_id;          // to denote the order of data blocks in a stripe
-    std::string block_key; // to distinct block, globally unique
+    int block_id;   // to denote the order of data blocks in a stripe
+    int key_stripe; // the stripe the block was created in, and its index among the blocks of its type there,
+    int key_index;  // from which the block key is derived
     char block_type;
     int block_size;
     int map2group, map2stripe, map2cluster, map2node;
-    std::string map2key;
-    Block(int block_id, const std::string block_key, char block_type, int block_size, int map2group,
-          int map2stripe, int map2cluster, int map2node, const std::string map2key)
-        : block_id(block_id), block_key(block_key), block_type(block_type), block_size(block_size), map2group(map2group), map2stripe(map2stripe), map2cluster(map2cluster), map2node(map2node), map2key(map2key) {}
+    const std::string *map2key = nullptr; // the interned key of the object of the block, nullptr for the parity blocks of several objects
+    Block(int block_id, int key_stripe, int key_index, char block_type, int block_size, int map2group,
+          int map2stripe, int map2cluster, int map2node, const std::string *map2key)
+        : block_id(block_id), key_stripe(key_stripe), key_index(key_index), block_type(block_type), block_size(block_size), map2group(map2group), map2stripe(map2stripe), map2cluster(map2cluster), map2node(map2node), map2key(map2key) {}
     Block() = default;
+    // to distinct block, globally unique
+    std::string block_key() const
+    {
+      if (block_type == 'D')
+      {
+        return *map2key + (key_index < 10 ? "_D0" : "_D") + std::to_string(key_index);
+      }
+      return "Stripe" + std::to_string(key_stripe) + "_" + block_type + std::to_string(key_index);
+    }
+    bool of_object(const std::string &key) const
+    {
+      return map2key != nullptr && *map2key == key;
+    }
   } Block;
 
   typedef struct Cluster
@@ -52,6 +74,8 @@ namespace ECProject
     std::vector<int> nodes;
     std::vector<Block *> blocks;
     std::unordered_set<int> stripes;
+    std::unordered_map<Block *, int> block_pos;                  // the position in blocks
+    std::unordered_map<int, std::vector<Block *>> stripe_blocks; // the blocks of each stripe in the cluster
     Cluster(int cluster_id, const std::string &proxy_ip, int proxy_port) : cluster_id(cluster_id), proxy_ip(proxy_ip), proxy_port(proxy_port) {}
     Cluster() = default;
   } Cluster;
@@ -81,6 +105,10 @@ namespace ECProject
   {
     int object_size;
     int map2stripe;
+    // a small object packed with others into the data blocks of a pack, -1 for an object with blocks of its own,
+    // the stripe is then the one of the pack
+    int map2pack = -1;
+    int offset = 0; // in the data blocks of the pack
   } ObjectInfo;
 
   typedef struct ECSchema
@@ -101,7 +129,20 @@ namespace ECProject
     int g_m_globalparityblock;
     int b_datapergroup;
     int x_stripepermergegroup; // the product of xi
+    int pack_block_size = 0;   // objects up to it are packed into stripes of blocks of this size, 0 for no packing
   } ECSchema;
+
+  // progress of a merge job, the stripes are counted in the current stage,
+  // the bytes are the cross-cluster traffic of each step
+  typedef struct MergeJobInfo
+  {
+    int job_id = -1;
+    MergeJobState state = MERGE_QUEUED;
+    int stages_done = 0, stages_total = 0;
+    int stripes_merged = 0, stripes_total = 0;
+    long long g_bytes = 0, l_bytes = 0, d_bytes = 0;
+    double lc = 0.0, gc = 0.0, dc = 0.0;
+  } MergeJobInfo;
 } // namespace ECProject
 
 #endif // META_DEFINITION
\ No newline at end of file
@@ -11,11 +11,45 @@
 #include <grpcpp/ext/proto_server_reflection_plugin.h>
 #include <grpcpp/grpcpp.h>
 #include <thread>
+#include <functional>
+#include <chrono>
 #include <semaphore.h>
 #define IF_DEBUG true
 // #define IF_DEBUG false
+// blocks are streamed by chunks between proxies in parity block recalculation
+#define RECAL_CHUNK_SIZE 262144
+// block relocation, the number of blocks moved at the same time
+#define RELOC_MAX_PARALLEL 16
+// a datanode serves GETs through a single data port, so a source node sends one block at a time
+#define RELOC_MAX_PER_SRC_NODE 1
+#define RELOC_MAX_PER_DES_NODE 2
+// bytes per second, 0 for unlimited
+#define RELOC_BANDWIDTH 0
+// how long a sealed pack waits for the objects appended to it
+#define PACK_ARRIVAL_TIMEOUT_MS 10000
+// how long the main proxy of a partial decoding waits for the helper proxies
+#define HELP_DECODE_TIMEOUT_MS 10000
+// how long the main proxy of a parity block recalculation waits for the helper proxies to connect
+#define HELP_RECAL_TIMEOUT_MS 60000
+// how often the status of the datanodes in the cluster is reported to the coordinator
+#define HEARTBEAT_INTERVAL_MS 1000
 namespace ECProject
 {
+  // the data blocks of a pack being filled with small objects
+  typedef struct PackBuffer
+  {
+    std::vector<char> buf;
+    std::vector<std::string> keys; // the objects arrived
+  } PackBuffer;
+
+  // the acceptor of the helper proxies of a recalculation, apart from the one of the client data
+  typedef struct RecalAcceptor
+  {
+    asio::io_context io_context;
+    asio::ip::tcp::acceptor acceptor;
+    RecalAcceptor(const std::string &ip) : acceptor(io_context, asio::ip::tcp::endpoint(asio::ip::address::from_string(ip), 0)) {}
+  } RecalAcceptor;
+
   class ProxyImpl final
       : public proxy_proto::proxyService::Service,
         public std::enable_shared_from_this<ECProject::ProxyImpl>
@@ -32,6 +66,7 @@ namespace ECProject
       m_ip = proxy_ip_port.substr(0, proxy_ip_port.find(':'));
       m_port = std::stoi(proxy_ip_port.substr(proxy_ip_port.find(':') + 1, proxy_ip_port.size()));
       std::cout << "Cluster id:" << m_self_cluster_id << std::endl;
+      std::thread(&ProxyImpl::heartbeat_loop, this).detach();
     }
     ~ProxyImpl(){};
     grpc::Status checkalive(
@@ -48,6 +83,25 @@ namespace ECProject
         grpc::ServerContext *context,
         const proxy_proto::ObjectAndPlacement *object_and_placement,
         proxy_proto::GetReply *response) override;
+    // batch, the objects of a batch placed on or read through this proxy
+    grpc::Status encodeAndSetObjects(
+        grpc::ServerContext *context,
+        const proxy_proto::ObjectBatch *object_batch,
+        proxy_proto::SetReply *response) override;
+    grpc::Status decodeAndGetObjects(
+        grpc::ServerContext *context,
+        const proxy_proto::ObjectBatch *object_batch,
+        proxy_proto::GetReply *response) override;
+    // small objects, appended to a pack by encodeAndSetObject(s) and encoded together
+    grpc::Status sealPack(
+        grpc::ServerContext *context,
+        const proxy_proto::ObjectAndPlacement *pack_and_placement,
+        proxy_proto::SetReply *response) override;
+    // partial decoding for degraded read
+    grpc::Status helpDecode(
+        grpc::ServerContext *context,
+        const proxy_proto::helpDecodePlan *help_decode_plan,
+        proxy_proto::RepIfSuccess *response) override;
     // delete
     grpc::Status deleteBlock(
         grpc::ServerContext *context,
@@ -55,6 +109,10 @@ namespace ECProject
         proxy_proto::DelReply *response) override;
     // lrcwidestripe, merge
     // parity block recalculation
+    grpc::Status openRecal(
+        grpc::ServerContext *context,
+        const proxy_proto::RecalPort *task,
+        proxy_proto::RecalPort *response) override;
     grpc::Status mainRecal(
         grpc::ServerContext *context,
         const proxy_proto::mainRecalPlan *main_recal_plan,
@@ -74,18 +132,43 @@ namespace ECProject
         const proxy_proto::AskIfSuccess *step,
         proxy_proto::RepIfSuccess *response) override;
     bool SetToDatanode(const char *key, size_t key_length, const char *value, size_t value_length, const char *ip, int port, int offset);
-    bool GetFromDatanode(const char *key, size_t key_length, char *value, size_t value_length, const char *ip, int port, int offset);
+    bool GetFromDatanode(const char *key, size_t key_length, char *value, size_t value_length, const char *ip, int port, int offset, int block_offset = 0);
+    bool GetFromDatanodeByChunk(const char *key, size_t key_length, char *value, size_t value_length, const char *ip, int port, int offset, std::function<void(int)> report);
     bool DelInDatanode(std::string key, std::string node_ip_port);
     bool BlockRelocation(const char *key, size_t value_length, const char *src_ip, int src_port, const char *des_ip, int des_port);
+    bool PartialDecoding(int k, int g_m, int l, int block_size, ECProject::EncodeType encode_type,
+                         std::vector<std::pair<std::string, std::pair<std::string, int>>> &keys_nodes, std::vector<int> &block_idxs, std::vector<int> &block_clusterids,
+                         std::vector<int> &received_idxs, std::vector<std::vector<char>> &received_blocks,
+                         std::vector<int> &failed_idxs, std::vector<std::vector<char>> &decoded_blocks);
 
   private:
     std::mutex m_mutex;
     std::condition_variable cv;
     bool m_merge_step_processing[3];
+    // merge tasks in progress, by task id
+    std::unordered_set<int> m_merge_tasks;
+    std::unordered_set<int> m_failed_merge_tasks; // finished without writing their blocks, until checked
+    void begin_merge_task(int task_id);
+    void end_merge_task(int task_id, bool success = true);
+    // the acceptors opened for the recalculations, by task id, until their main plans arrive
+    std::map<int, std::shared_ptr<RecalAcceptor>> m_recal_acceptors;
+    bool accept_before(asio::io_context &t_io_context, asio::ip::tcp::acceptor &t_acceptor, asio::ip::tcp::socket &socket,
+                       int timeout_ms, const std::function<bool()> &give_up);
+    void encode_and_distribute(int k, int g_m, int l, int block_size, ECProject::EncodeType encode_type,
+                               std::vector<std::pair<std::string, std::pair<std::string, int>>> &keys_nodes, char *buf);
+    void store_in_pack(const proxy_proto::ObjectAndPlacement &object, const char *value);
+    // packs being filled, by stripe id
+    std::mutex m_pack_mutex;
+    std::condition_variable m_pack_cv;
+    std::map<int, PackBuffer> m_packs;
     bool init_coordinator();
     bool init_datanodes(std::string datanodeinfo_path);
+    void heartbeat_loop();
     std::unique_ptr<coordinator_proto::coordinatorService::Stub> m_coordinator_ptr;
     std::map<std::string, std::unique_ptr<datanode_proto::datanodeService::Stub>> m_datanode_ptrs;
+    std::vector<std::string> m_self_datanodes; // the datanodes in the cluster of the proxy
+    // other proxies, cluster_id -> stub
+    std::map<int, std::unique_ptr<proxy_proto::proxyService::Stub>> m_proxy_ptrs;
     std::string config_path;
     std::string proxy_ip_port;
     std::string m_ip;
@@ -11,6 +11,7 @@ int main(int argc, char **argv)
   {
     std::cout << "./run_client partial_decoding encode_type singlestripe_placement_type multistripes_placement_type k l g_m stripe_num stage_x1 stage_x2 stage_x3 value_length" << std::endl;
     std::cout << "./run_client false Azure_LRC Optimal OPT 8 2 2 32 2 2 0 1024" << std::endl;
+    std::cout << "stage_x1 = auto: let the coordinator pick the stages merging every stage_x2 stripes, in at most stage_x3 stages" << std::endl;
     exit(-1);
   }
 
@@ -21,6 +22,8 @@ int main(int argc, char **argv)
   int k, l, g_m, b;
   int stripe_num, value_length;
   int s_x1, s_x2, s_x3;
+  bool auto_stages = false;
+  int auto_x = 0, auto_max_stages = 0;
 
   char buff[256];
   getcwd(buff, 256);
@@ -75,9 +78,21 @@ int main(int argc, char **argv)
   b = std::ceil((double)k / (double)l);
   g_m = std::stoi(std::string(argv[7]));
   stripe_num = std::stoi(std::string(argv[8]));
-  s_x1 = std::stoi(std::string(argv[9]));
-  s_x2 = std::stoi(std::string(argv[10]));
-  s_x3 = std::stoi(std::string(argv[11]));
+  if (std::string(argv[9]) == "auto")
+  {
+    auto_stages = true;
+    auto_x = std::stoi(std::string(argv[10]));
+    auto_max_stages = std::stoi(std::string(argv[11]));
+    s_x1 = auto_x;
+    s_x2 = 0;
+    s_x3 = 0;
+  }
+  else
+  {
+    s_x1 = std::stoi(std::string(argv[9]));
+    s_x2 = std::stoi(std::string(argv[10]));
+    s_x3 = std::stoi(std::string(argv[11]));
+  }
   value_length = std::stoi(std::string(argv[12]));
 
   std::string client_ip = "0.0.0.0", coordinator_ip;
@@ -205,6 +220,18 @@ int main(int argc, char **argv)
   // std::cout << "[DEL END]" << std::endl;
 
   // merge
+  if (auto_stages)
+  {
+    std::vector<int> stages;
+    if (client.plan_merge(auto_x, auto_max_stages, false, stages) < 0 || stages.empty() || stages.size() > 3)
+    {
+      std::cout << "No merge plan of at most 3 stages for x = " << auto_x << std::endl;
+      exit(-1);
+    }
+    s_x1 = stages[0];
+    s_x2 = stages.size() > 1 ? stages[1] : 0;
+    s_x3 = stages.size() > 2 ? stages[2] : 0;
+  }
   std::cout << "Number of stripes(objects): " << stripe_num << std::endl;
   std::cout << "Object size: " << value_length << "KiB" << std::endl;
   std::cout << "Block size: " << float(value_length) / float(k) << "KiB" << std::endl;
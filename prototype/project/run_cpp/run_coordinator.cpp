@@ -3,7 +3,7 @@
 int main(int argc, char **argv)
 {
   std::string coordinator_ip = "0.0.0.0";
-  if (argc == 2)
+  if (argc >= 2)
   {
     coordinator_ip = std::string(argv[1]);
   }
@@ -13,7 +13,13 @@ int main(int argc, char **argv)
   std::string cwf = std::string(argv[0]);
   std::string config_path = std::string(buff) + cwf.substr(1, cwf.rfind('/') - 1) + "/../../config/clusterInformation.xml";
   std::cout << "Current working directory: " << config_path << std::endl;
-  ECProject::Coordinator coordinator(coordinator_ip + ":55555", config_path);
+  // the metadata log and snapshots, the metadata is recovered from them on start
+  std::string metadata_dir = std::string(buff) + cwf.substr(1, cwf.rfind('/') - 1) + "/../../metadata";
+  if (argc >= 3)
+  {
+    metadata_dir = std::string(argv[2]);
+  }
+  ECProject::Coordinator coordinator(coordinator_ip + ":55555", config_path, metadata_dir);
   coordinator.Run();
   return 0;
 }
\ No newline at end of file
@@ -23,7 +23,7 @@ namespace ECProject
     }
   }
   // grpc, set the parameters stored in the variable of m_encode_parameters in coordinator
-  bool Client::SetParameterByGrpc(ECSchema input_ecschema)
+  bool Client::SetParameterByGrpc(ECSchema input_ecschema, bool reset)
   {
     int k = input_ecschema.k_datablock;
     int l = input_ecschema.l_localparityblock;
@@ -46,6 +46,8 @@ namespace ECProject
     parameter.set_g_m_globalparityblock(g_m);
     parameter.set_b_datapergroup(b);
     parameter.set_x_stripepermergegroup(input_ecschema.x_stripepermergegroup);
+    parameter.set_pack_block_size(input_ecschema.pack_block_size);
+    parameter.set_reset(reset);
     grpc::ClientContext context;
     coordinator_proto::RepIfSetParaSuccess reply;
     grpc::Status status = m_coordinator_ptr->setParameter(&context, parameter, &reply);
@@ -133,12 +135,24 @@ namespace ECProject
     2. accept the value transferred from the proxy
   */
   bool Client::get(std::string key, std::string &value)
+  {
+    return get_range(key, 0, 0, value);
+  }
+
+  /*
+    Function: get_range
+    get the bytes [offset, offset + length) of the value, length 0 to the end of it,
+    only the blocks covering the range are read
+  */
+  bool Client::get_range(std::string key, int offset, int length, std::string &value)
   {
     grpc::ClientContext context;
     coordinator_proto::KeyAndClientIP request;
     request.set_key(key);
     request.set_clientip(m_clientIPForGet);
     request.set_clientport(m_clientPortForGet);
+    request.set_offset(offset);
+    request.set_length(length);
     // request
     coordinator_proto::RepIfGetSuccess reply;
     grpc::Status status = m_coordinator_ptr->getValue(&context, request, &reply);
@@ -227,6 +241,213 @@ namespace ECProject
     return false;
   }
 
+  /*
+    Function: set_batch
+    1. send the keys and valuesizes of all objects to the coordinator in one request
+    2. send the values placed on the same proxy through one connection, in the order of the objects
+    3. check if the metadata of all objects is saved in one request
+  */
+  bool Client::set_batch(std::vector<std::string> keys, std::vector<std::string> values)
+  {
+    grpc::ClientContext get_proxy_ip_port;
+    coordinator_proto::RequestProxyIPPorts request;
+    coordinator_proto::ReplyProxyIPPorts reply;
+    for (int i = 0; i < int(keys.size()); i++)
+    {
+      coordinator_proto::RequestProxyIPPort *object = request.add_objects();
+      object->set_key(keys[i]);
+      object->set_valuesizebytes(values[i].size());
+    }
+    grpc::Status status = m_coordinator_ptr->uploadOriginKeyValues(&get_proxy_ip_port, request, &reply);
+    if (!status.ok() || reply.proxies_size() != int(keys.size()))
+    {
+      std::cout << "[SET] upload data failed!" << std::endl;
+      return false;
+    }
+    // proxy address -> the objects sent to it, in order
+    std::map<std::pair<std::string, int>, std::vector<int>> objects_of_proxy;
+    for (int i = 0; i < int(keys.size()); i++)
+    {
+      objects_of_proxy[std::make_pair(reply.proxies(i).proxyip(), reply.proxies(i).proxyport())].push_back(i);
+    }
+    for (auto &kv : objects_of_proxy)
+    {
+      std::string proxy_ip = kv.first.first;
+      int proxy_port = kv.first.second;
+      std::cout << "[SET] Send " << kv.second.size() << " objects to proxy_address:" << proxy_ip << ":" << proxy_port << std::endl;
+      asio::io_context io_context;
+      asio::error_code error;
+      asio::ip::tcp::resolver resolver(io_context);
+      asio::ip::tcp::resolver::results_type endpoints =
+          resolver.resolve(proxy_ip, std::to_string(proxy_port));
+      asio::ip::tcp::socket sock_data(io_context);
+      asio::connect(sock_data, endpoints);
+      for (int i : kv.second)
+      {
+        asio::write(sock_data, asio::buffer(keys[i], keys[i].size()), error);
+        asio::write(sock_data, asio::buffer(values[i], values[i].size()), error);
+      }
+      asio::error_code ignore_ec;
+      sock_data.shutdown(asio::ip::tcp::socket::shutdown_send, ignore_ec);
+      sock_data.close(ignore_ec);
+    }
+
+    // check if metadata is saved successfully
+    grpc::ClientContext check_commit;
+    coordinator_proto::AskIfSuccessBatch req;
+    for (int i = 0; i < int(keys.size()); i++)
+    {
+      coordinator_proto::AskIfSuccess *ask = req.add_asks();
+      ask->set_key(keys[i]);
+      ask->set_opp(SET);
+    }
+    coordinator_proto::RepIfSuccess rep;
+    status = m_coordinator_ptr->checkCommitAborts(&check_commit, req, &rep);
+    if (status.ok())
+    {
+      if (rep.ifcommit())
+      {
+        return true;
+      }
+      else
+      {
+        std::cout << "[SET] " << keys.size() << " objects not all commit!!!!!" << std::endl;
+      }
+    }
+    else
+    {
+      std::cout << "[SET] " << keys.size() << " objects Fail to check!!!!!" << std::endl;
+    }
+    return false;
+  }
+  /*
+    Function: get_batch
+    1. send the keys and clientipport to the coordinator in one request
+    2. accept the values transferred from the proxies, each preceded by its key, in any order
+  */
+  bool Client::get_batch(std::vector<std::string> keys, std::vector<std::string> &values)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::KeysAndClientIP request;
+    for (auto &key : keys)
+    {
+      request.add_keys(key);
+    }
+    request.set_clientip(m_clientIPForGet);
+    request.set_clientport(m_clientPortForGet);
+    coordinator_proto::RepIfGetSuccesses reply;
+    grpc::Status status = m_coordinator_ptr->getValues(&context, request, &reply);
+    if (!status.ok() || reply.valuesizebytes_size() != int(keys.size()))
+    {
+      std::cout << "[GET] get data failed!" << std::endl;
+      return false;
+    }
+    values.assign(keys.size(), "");
+    std::unordered_map<std::string, int> index_of_key;
+    int num_of_values = 0;
+    for (int i = 0; i < int(keys.size()); i++)
+    {
+      if (reply.valuesizebytes(i) >= 0)
+      {
+        index_of_key[keys[i]] = i;
+        num_of_values++;
+      }
+      else
+      {
+        std::cout << "[GET] " << keys[i] << " not found!" << std::endl;
+      }
+    }
+    bool flag = num_of_values == int(keys.size());
+    for (int j = 0; j < num_of_values; j++)
+    {
+      asio::ip::tcp::socket socket_data(io_context);
+      acceptor.accept(socket_data);
+      asio::error_code error;
+      int key_size = 0;
+      asio::read(socket_data, asio::buffer(&key_size, sizeof(int)), error);
+      std::vector<char> buf_key(key_size);
+      asio::read(socket_data, asio::buffer(buf_key, key_size), error);
+      std::string key(buf_key.data(), key_size);
+      auto it = index_of_key.find(key);
+      if (it != index_of_key.end())
+      {
+        int value_size = reply.valuesizebytes(it->second);
+        std::vector<char> buf(value_size);
+        size_t len = asio::read(socket_data, asio::buffer(buf, value_size), error);
+        values[it->second] = std::string(buf.data(), len);
+        if (int(len) != value_size)
+        {
+          flag = false;
+        }
+      }
+      else
+      {
+        std::cout << "[GET] key not matches!" << std::endl;
+        flag = false;
+      }
+      asio::error_code ignore_ec;
+      socket_data.shutdown(asio::ip::tcp::socket::shutdown_receive, ignore_ec);
+      socket_data.close(ignore_ec);
+    }
+    std::cout << "[GET] get " << num_of_values << " of " << keys.size() << " keys" << std::endl;
+    return flag;
+  }
+  /*
+    Function: delete_batch
+    1. send the keys to the coordinator in one request
+    2. check if all keys are deleted in one request
+  */
+  bool Client::delete_batch(std::vector<std::string> keys)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::KeysFromClient request;
+    for (auto &key : keys)
+    {
+      request.add_keys(key);
+    }
+    coordinator_proto::RepIfDeling reply;
+    grpc::Status status = m_coordinator_ptr->delByKeys(&context, request, &reply);
+    if (status.ok())
+    {
+      if (reply.ifdeling())
+      {
+        std::cout << "[DEL] deleting " << keys.size() << " keys" << std::endl;
+      }
+      else
+      {
+        std::cout << "[DEL] delete failed!" << std::endl;
+      }
+    }
+    // check if metadata is saved successfully
+    grpc::ClientContext check_commit;
+    coordinator_proto::AskIfSuccessBatch req;
+    for (auto &key : keys)
+    {
+      coordinator_proto::AskIfSuccess *ask = req.add_asks();
+      ask->set_key(key);
+      ask->set_opp(DEL);
+      ask->set_stripe_id(-1);
+    }
+    coordinator_proto::RepIfSuccess rep;
+    grpc::Status stat = m_coordinator_ptr->checkCommitAborts(&check_commit, req, &rep);
+    if (stat.ok())
+    {
+      if (rep.ifcommit())
+      {
+        return true;
+      }
+      else
+      {
+        std::cout << "[DEL] " << keys.size() << " keys not all delete!!!!!";
+      }
+    }
+    else
+    {
+      std::cout << "[DEL] " << keys.size() << " keys Fail to check!!!!!";
+    }
+    return false;
+  }
+
   bool Client::delete_stripe(int stripe_id)
   {
     grpc::ClientContext context;
@@ -294,12 +515,14 @@ namespace ECProject
   /*
     Function: merge
     1. send the merge request including the information of num_of_stripes_tomerge to the coordinator
+    2. max_concurrency limits the number of batches merged in parallel, 0 for no limit
   */
-  double Client::merge(int num_of_stripes)
+  double Client::merge(int num_of_stripes, int max_concurrency)
   {
     grpc::ClientContext context;
     coordinator_proto::NumberOfStripesToMerge request;
     request.set_num_of_stripes(num_of_stripes);
+    request.set_max_concurrency(max_concurrency);
     coordinator_proto::RepIfMerged reply;
     grpc::Status status = m_coordinator_ptr->requestMerge(&context, request, &reply);
     double cost = 0;
@@ -320,4 +543,165 @@ namespace ECProject
     }
     return cost;
   }
+
+  /*
+    Function: start_merge
+    1. send the merge stages to the coordinator, which runs them in the background
+    2. return the job id, or -1 if failed
+  */
+  int Client::start_merge(std::vector<int> stages, int max_concurrency)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::MergeJobRequest request;
+    for (int i = 0; i < int(stages.size()); i++)
+    {
+      request.add_num_of_stripes(stages[i]);
+    }
+    request.set_max_concurrency(max_concurrency);
+    coordinator_proto::MergeJobStatus reply;
+    grpc::Status status = m_coordinator_ptr->startMerge(&context, request, &reply);
+    if (!status.ok())
+    {
+      std::cout << "[MERGE] start merge failed!" << std::endl;
+      return -1;
+    }
+    return reply.job_id();
+  }
+
+  static void status_to_info(const coordinator_proto::MergeJobStatus &reply, MergeJobInfo &info)
+  {
+    info.job_id = reply.job_id();
+    info.state = (MergeJobState)reply.state();
+    info.stages_done = reply.stages_done();
+    info.stages_total = reply.stages_total();
+    info.stripes_merged = reply.stripes_merged();
+    info.stripes_total = reply.stripes_total();
+    info.g_bytes = reply.g_bytes();
+    info.l_bytes = reply.l_bytes();
+    info.d_bytes = reply.d_bytes();
+    info.lc = reply.lc();
+    info.gc = reply.gc();
+    info.dc = reply.dc();
+  }
+
+  bool Client::get_merge_status(int job_id, MergeJobInfo &info)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::MergeJobId request;
+    request.set_job_id(job_id);
+    coordinator_proto::MergeJobStatus reply;
+    grpc::Status status = m_coordinator_ptr->getMergeStatus(&context, request, &reply);
+    if (!status.ok() || reply.job_id() == -1)
+    {
+      return false;
+    }
+    status_to_info(reply, info);
+    return true;
+  }
+
+  bool Client::cancel_merge(int job_id)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::MergeJobId request;
+    request.set_job_id(job_id);
+    coordinator_proto::MergeJobStatus reply;
+    grpc::Status status = m_coordinator_ptr->cancelMerge(&context, request, &reply);
+    return status.ok() && reply.job_id() != -1;
+  }
+
+  bool Client::set_merge_policy(bool enable, std::vector<int> stages, int min_stripes_per_group,
+                                int max_ops_per_sec, long long bandwidth, int max_concurrency,
+                                int split_min_accesses)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::MergePolicy request;
+    request.set_enable(enable);
+    for (int i = 0; i < int(stages.size()); i++)
+    {
+      request.add_num_of_stripes(stages[i]);
+    }
+    request.set_min_stripes_per_group(min_stripes_per_group);
+    request.set_max_ops_per_sec(max_ops_per_sec);
+    request.set_bandwidth(bandwidth);
+    request.set_max_concurrency(max_concurrency);
+    request.set_split_min_accesses(split_min_accesses);
+    coordinator_proto::RepIfSuccess reply;
+    grpc::Status status = m_coordinator_ptr->setMergePolicy(&context, request, &reply);
+    return status.ok() && reply.ifcommit();
+  }
+
+  /*
+    Function: split_stripe
+    1. ask the coordinator to split a merged stripe, so that its degraded reads touch fewer blocks
+  */
+  double Client::split_stripe(int stripe_id)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::StripeIdFromClient request;
+    request.set_stripe_id(stripe_id);
+    coordinator_proto::RepIfMerged reply;
+    grpc::Status status = m_coordinator_ptr->splitStripe(&context, request, &reply);
+    double cost = 0;
+    if (status.ok() && reply.ifmerged())
+    {
+      cost = reply.lc() + reply.gc() + reply.dc();
+    }
+    else
+    {
+      std::cout << "[SPLIT] split failed!" << std::endl;
+    }
+    return cost;
+  }
+
+  /*
+    Function: append_merge
+    1. ask the coordinator to merge the stripe into a wider one, without waiting for a full stage
+  */
+  double Client::append_merge(int stripe_id, int wide_stripe_id)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::AppendMergeRequest request;
+    request.set_stripe_id(stripe_id);
+    request.set_wide_stripe_id(wide_stripe_id);
+    coordinator_proto::RepIfMerged reply;
+    grpc::Status status = m_coordinator_ptr->appendMerge(&context, request, &reply);
+    double cost = 0;
+    if (status.ok() && reply.ifmerged())
+    {
+      cost = reply.lc() + reply.gc() + reply.dc();
+    }
+    else
+    {
+      std::cout << "[MERGE] append merge failed!" << std::endl;
+    }
+    return cost;
+  }
+
+  /*
+    Function: plan_merge
+    1. ask the coordinator for the cheapest stages of merging every merge_factor stripes
+    2. start a merge job with them if execute
+  */
+  int Client::plan_merge(int merge_factor, int max_stages, bool execute, std::vector<int> &stages, int max_concurrency)
+  {
+    grpc::ClientContext context;
+    coordinator_proto::MergePlanRequest request;
+    request.set_merge_factor(merge_factor);
+    request.set_max_stages(max_stages);
+    request.set_execute(execute);
+    request.set_max_concurrency(max_concurrency);
+    coordinator_proto::MergeSchedule reply;
+    grpc::Status status = m_coordinator_ptr->planMerge(&context, request, &reply);
+    if (!status.ok() || !reply.ifplanned())
+    {
+      std::cout << "[MERGE] no feasible merge schedule!" << std::endl;
+      return -1;
+    }
+    stages.clear();
+    for (int i = 0; i < reply.num_of_stripes_size(); i++)
+    {
+      stages.push_back(reply.num_of_stripes(i));
+    }
+    return execute ? reply.job_id() : 0;
+  }
 } // namespace ECProject
\ No newline at end of file
@@ -4,6 +4,10 @@
 #include <unistd.h>
 #include "lrc.h"
 #include <sys/time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <cstdio>
 
 template <typename T>
 inline T ceil(T const &A, T const &B)
@@ -21,17 +25,481 @@ inline std::vector<size_t> argsort(const std::vector<T> &v)
   return idx;
 };
 
+// the generator of each thread, seeded once
+inline std::mt19937 &thread_rng()
+{
+  static thread_local std::mt19937 gen(std::random_device{}());
+  return gen;
+};
+
 inline int rand_num(int range)
 {
-  std::random_device rd;
-  std::mt19937 gen(rd());
   std::uniform_int_distribution<int> dis(0, range - 1);
-  int num = dis(gen);
+  int num = dis(thread_rng());
   return num;
 };
 
+// the object holding the data blocks of a pack of small objects, the keys with the prefix are reserved
+#define PACK_KEY_PREFIX "__pack"
+inline std::string pack_key(int pack_id)
+{
+  return PACK_KEY_PREFIX + std::to_string(pack_id);
+};
+
+// -1 if the key is not of a pack
+inline int pack_id_of(const std::string &key)
+{
+  int prefix_len = int(sizeof(PACK_KEY_PREFIX)) - 1;
+  if (key.compare(0, prefix_len, PACK_KEY_PREFIX) != 0)
+  {
+    return -1;
+  }
+  return std::atoi(key.c_str() + prefix_len);
+};
+
+inline bool same_schema(const ECProject::ECSchema &a, const ECProject::ECSchema &b)
+{
+  return a.partial_decoding == b.partial_decoding && a.encodetype == b.encodetype &&
+         a.s_stripe_placementtype == b.s_stripe_placementtype && a.m_stripe_placementtype == b.m_stripe_placementtype &&
+         a.k_datablock == b.k_datablock && a.l_localparityblock == b.l_localparityblock &&
+         a.g_m_globalparityblock == b.g_m_globalparityblock && a.b_datapergroup == b.b_datapergroup &&
+         a.x_stripepermergegroup == b.x_stripepermergegroup && a.pack_block_size == b.pack_block_size;
+};
+
+// FNV-1a, to tell a torn or corrupted metadata record
+inline unsigned int meta_checksum(const char *data, int len)
+{
+  unsigned int hash = 2166136261u;
+  for (int i = 0; i < len; i++)
+  {
+    hash ^= (unsigned char)data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+};
+
+inline void put_int(std::string &buf, int value)
+{
+  buf.append((const char *)&value, sizeof(int));
+};
+
+inline void put_str(std::string &buf, const std::string &value)
+{
+  put_int(buf, int(value.size()));
+  buf.append(value);
+};
+
+// the fields of a metadata record, past its end they read as zeros
+typedef struct MetaReader
+{
+  const char *cur;
+  const char *end;
+  MetaReader(const char *data, int len) : cur(data), end(data + len) {}
+  int get_int()
+  {
+    int value = 0;
+    if (end - cur >= int(sizeof(int)))
+    {
+      memcpy(&value, cur, sizeof(int));
+      cur += sizeof(int);
+    }
+    return value;
+  }
+  std::string get_str()
+  {
+    int len = get_int();
+    if (len < 0 || end - cur < len)
+    {
+      cur = end;
+      return "";
+    }
+    std::string value(cur, len);
+    cur += len;
+    return value;
+  }
+} MetaReader;
+
 namespace ECProject
 {
+  Block *BlockArena::alloc(const Block &value)
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    Block *block = nullptr;
+    if (!m_free_blocks.empty())
+    {
+      block = m_free_blocks.back();
+      m_free_blocks.pop_back();
+    }
+    else
+    {
+      if (m_used_in_last_slab == BLOCK_SLAB_SIZE)
+      {
+        m_slabs.push_back(std::unique_ptr<Block[]>(new Block[BLOCK_SLAB_SIZE]));
+        m_used_in_last_slab = 0;
+      }
+      block = &m_slabs.back()[m_used_in_last_slab++];
+    }
+    *block = value;
+    return block;
+  }
+
+  void BlockArena::free(Block *block)
+  {
+    if (block == nullptr)
+    {
+      return;
+    }
+    std::unique_lock<std::mutex> lck(m_mutex);
+    if (block->map2key != nullptr)
+    {
+      release_key(block->map2key);
+      block->map2key = nullptr;
+    }
+    m_free_blocks.push_back(block);
+  }
+
+  // object keys are stored once, blocks only keep a pointer to them,
+  // each call takes a reference released when the block is freed
+  const std::string *BlockArena::intern_key(const std::string &key)
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    auto it = m_keys.insert(std::make_pair(key, 0)).first;
+    it->second++;
+    return &it->first;
+  }
+
+  void BlockArena::release_key(const std::string *key)
+  {
+    auto it = m_keys.find(*key);
+    if (it != m_keys.end() && --it->second == 0)
+    {
+      m_keys.erase(it);
+    }
+  }
+
+  void BlockArena::clear()
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    m_slabs.clear();
+    m_free_blocks.clear();
+    m_keys.clear();
+    m_used_in_last_slab = BLOCK_SLAB_SIZE;
+  }
+
+  void CandidatePool::reset(const std::vector<int> &candidates)
+  {
+    m_candidates = candidates;
+    m_free = int(m_candidates.size());
+    m_round = -1;
+  }
+
+  void CandidatePool::begin_round(int round)
+  {
+    if (round != m_round)
+    {
+      m_round = round;
+      m_free = int(m_candidates.size());
+    }
+  }
+
+  int CandidatePool::draw(std::mt19937 &gen, const std::function<bool(int)> &accept,
+                           const std::function<double(int)> &weight)
+  {
+    // the candidates drawn earlier in the round may be accepted again, look at all of them once more
+    for (int pass = 0; pass < 2; pass++)
+    {
+      while (m_free > 0)
+      {
+        std::uniform_int_distribution<int> dis(0, m_free - 1);
+        int i = -1;
+        if (weight)
+        {
+          std::vector<double> t_weights(m_free);
+          double total = 0;
+          for (int j = 0; j < m_free; j++)
+          {
+            t_weights[j] = weight(m_candidates[j]);
+            total += t_weights[j];
+          }
+          // none of them weighs anything, uniformly then
+          if (total > 0)
+          {
+            std::uniform_real_distribution<double> dis_weight(0, total);
+            double r = dis_weight(gen);
+            for (i = 0; i < m_free - 1 && r >= t_weights[i]; i++)
+            {
+              r -= t_weights[i];
+            }
+          }
+        }
+        if (i == -1)
+        {
+          i = dis(gen);
+        }
+        int candidate = m_candidates[i];
+        std::swap(m_candidates[i], m_candidates[--m_free]);
+        if (accept(candidate))
+        {
+          return candidate;
+        }
+      }
+      m_free = int(m_candidates.size());
+    }
+    return -1;
+  }
+
+  MetadataLog::~MetadataLog()
+  {
+    if (m_fd >= 0)
+    {
+      sync();
+      ::close(m_fd);
+    }
+  }
+
+  // continue the log of dir after its last valid record
+  bool MetadataLog::open(const std::string &dir, long long valid_bytes)
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    m_dir = dir;
+    m_fd = ::open((dir + "/meta.log").c_str(), O_WRONLY | O_CREAT, 0644);
+    if (m_fd < 0 || ftruncate(m_fd, valid_bytes) != 0 || lseek(m_fd, valid_bytes, SEEK_SET) < 0)
+    {
+      std::cerr << "[META] failed to open the metadata log in " << dir << std::endl;
+      if (m_fd >= 0)
+      {
+        ::close(m_fd);
+        m_fd = -1;
+      }
+      return false;
+    }
+    return true;
+  }
+
+  bool MetadataLog::is_open()
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    return m_fd >= 0;
+  }
+
+  // returns the sequence number of the record, nothing is kept before the log is opened
+  long long MetadataLog::append(const std::string &record)
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    if (m_fd < 0)
+    {
+      return 0;
+    }
+    frame(m_buffer, record);
+    return ++m_next_lsn;
+  }
+
+  // wait until the record lsn, by default every record appended so far, is durable
+  void MetadataLog::sync(long long lsn)
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    if (lsn < 0)
+    {
+      lsn = m_next_lsn;
+    }
+    while (m_synced_lsn < lsn)
+    {
+      if (m_flushing)
+      {
+        m_cv.wait(lck);
+      }
+      else
+      {
+        flush_locked(lck);
+      }
+    }
+  }
+
+  // the caller writes out the records appended by everyone, the lock is released while writing
+  void MetadataLog::flush_locked(std::unique_lock<std::mutex> &lck)
+  {
+    m_flushing = true;
+    std::string buf;
+    buf.swap(m_buffer);
+    long long target = m_next_lsn;
+    int fd = m_fd;
+    lck.unlock();
+    size_t offset = 0;
+    while (offset < buf.size())
+    {
+      ssize_t n = ::write(fd, buf.data() + offset, buf.size() - offset);
+      if (n < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        std::cerr << "[META] failed to write the metadata log" << std::endl;
+        break;
+      }
+      offset += n;
+    }
+    fdatasync(fd);
+    lck.lock();
+    m_synced_lsn = target;
+    m_flushing = false;
+    m_cv.notify_all();
+  }
+
+  // the current log becomes the previous one and the records from now on go to a new log,
+  // called with the metadata locked, right when a snapshot of it is taken.
+  // a previous log left by a checkpoint that did not land is in no snapshot yet, so the current log
+  // is appended to it instead of replacing it, it goes away only once a snapshot is durable
+  bool MetadataLog::rotate()
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    if (m_fd < 0)
+    {
+      return true;
+    }
+    while (m_flushing || m_synced_lsn < m_next_lsn)
+    {
+      if (m_flushing)
+      {
+        m_cv.wait(lck);
+      }
+      else
+      {
+        flush_locked(lck);
+      }
+    }
+    ::close(m_fd);
+    std::string path = m_dir + "/meta.log";
+    std::string prev_path = path + ".prev";
+    bool moved = false;
+    if (access(prev_path.c_str(), F_OK) == 0)
+    {
+      moved = append_log(path, prev_path) && unlink(path.c_str()) == 0;
+    }
+    else
+    {
+      moved = std::rename(path.c_str(), prev_path.c_str()) == 0;
+    }
+    if (!moved)
+    {
+      // keep logging to the current log, the next checkpoint tries again
+      std::cerr << "[META] failed to rotate the metadata log in " << m_dir << std::endl;
+      m_fd = ::open(path.c_str(), O_WRONLY | O_APPEND);
+      return false;
+    }
+    m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (m_fd < 0)
+    {
+      std::cerr << "[META] failed to start a new metadata log" << std::endl;
+    }
+    m_rotated_lsn = m_next_lsn;
+    return true;
+  }
+
+  // append the records of a log to another one, cutting a torn record at the end of the other one first
+  bool MetadataLog::append_log(const std::string &from, const std::string &to)
+  {
+    long long valid_bytes = replay(to, [](const char *, int) {});
+    int in_fd = ::open(from.c_str(), O_RDONLY);
+    if (in_fd < 0)
+    {
+      return false;
+    }
+    int out_fd = ::open(to.c_str(), O_WRONLY);
+    if (out_fd < 0 || valid_bytes < 0 || ftruncate(out_fd, valid_bytes) != 0 || lseek(out_fd, valid_bytes, SEEK_SET) < 0)
+    {
+      ::close(in_fd);
+      if (out_fd >= 0)
+      {
+        ::close(out_fd);
+      }
+      return false;
+    }
+    bool ok = true;
+    std::vector<char> buf(1 << 20);
+    while (ok)
+    {
+      ssize_t n = ::read(in_fd, buf.data(), buf.size());
+      if (n <= 0)
+      {
+        ok = n == 0;
+        break;
+      }
+      ssize_t offset = 0;
+      while (offset < n)
+      {
+        ssize_t m = ::write(out_fd, buf.data() + offset, n - offset);
+        if (m < 0)
+        {
+          ok = false;
+          break;
+        }
+        offset += m;
+      }
+    }
+    ok = ok && fdatasync(out_fd) == 0;
+    ::close(in_fd);
+    ::close(out_fd);
+    return ok;
+  }
+
+  long long MetadataLog::records_since_rotate()
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    return m_next_lsn - m_rotated_lsn;
+  }
+
+  void MetadataLog::frame(std::string &buf, const std::string &record)
+  {
+    put_int(buf, int(record.size()));
+    put_int(buf, int(meta_checksum(record.data(), int(record.size()))));
+    buf.append(record);
+  }
+
+  // apply the records of a log or snapshot file, read through mmap, up to the first torn or corrupted one,
+  // returns the bytes of the valid records, -1 if there is no such file
+  long long MetadataLog::replay(const std::string &path, const std::function<void(const char *, int)> &apply)
+  {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+      ::close(fd);
+      return 0;
+    }
+    long long size = st.st_size;
+    void *addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED)
+    {
+      std::cerr << "[META] failed to map " << path << std::endl;
+      return 0;
+    }
+    madvise(addr, size, MADV_SEQUENTIAL);
+    const char *data = (const char *)addr;
+    long long offset = 0;
+    while (offset + 2 * (long long)sizeof(int) <= size)
+    {
+      int len = 0;
+      unsigned int checksum = 0;
+      memcpy(&len, data + offset, sizeof(int));
+      memcpy(&checksum, data + offset + sizeof(int), sizeof(int));
+      const char *record = data + offset + 2 * sizeof(int);
+      if (len < 0 || offset + 2 * (long long)sizeof(int) + len > size || meta_checksum(record, len) != checksum)
+      {
+        break;
+      }
+      apply(record, len);
+      offset += 2 * sizeof(int) + len;
+    }
+    munmap(addr, size);
+    return offset;
+  }
+
   grpc::Status CoordinatorImpl::setParameter(
       grpc::ServerContext *context,
       const coordinator_proto::Parameter *parameter,
@@ -46,17 +514,59 @@ namespace ECProject
                              parameter->g_m_globalparityblock(),
                              parameter->b_datapergroup(),
                              parameter->x_stripepermergegroup());
-    m_encode_parameters = system_metadata;
+    system_metadata.pack_block_size = std::max(parameter->pack_block_size(), 0);
+    {
+      std::unique_lock<std::mutex> k_lck(m_pack_mutex);
+      std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+      std::unique_lock<std::mutex> p_lck(m_placement_mutex);
+      // the stored objects are kept unless the client asks to drop them
+      if (m_parameters_set && !parameter->reset())
+      {
+        bool same = same_schema(m_encode_parameters, system_metadata);
+        setParameterReply->set_ifsetparameter(same);
+        std::cout << (same ? "setParameter unchanged, the metadata is kept"
+                           : "setParameter failed, the parameters differ from the stored ones, reset to drop them")
+                  << std::endl;
+        return grpc::Status::OK;
+      }
+      m_encode_parameters = system_metadata;
+      m_parameters_set = true;
+      reset_metadata();
+      m_meta_log.append(parameter_record());
+    }
+    // the old log is dropped with the snapshot of the empty metadata
+    checkpoint_metadata();
     setParameterReply->set_ifsetparameter(true);
+    std::cout << "setParameter success" << std::endl;
+    return grpc::Status::OK;
+  }
+
+  // with the packs and the stripe table locked exclusively, drop every stripe and object
+  void CoordinatorImpl::reset_metadata()
+  {
     m_cur_cluster_id = 0;
     m_cur_stripe_id = 0;
-    m_object_commit_table.clear();
-    m_object_updating_table.clear();
-    m_stripe_deleting_table.clear();
+    m_open_pack = OpenPack();
+    m_pack_members.clear();
+    for (int i = 0; i < METADATA_SHARD_NUM; i++)
+    {
+      std::unique_lock<RWMutex> o_lck(m_object_shards[i].rwlock);
+      m_object_shards[i].commit_table.clear();
+      m_object_shards[i].updating_table.clear();
+    }
+    for (int i = 0; i < METADATA_SHARD_NUM; i++)
+    {
+      std::unique_lock<RWMutex> s_lck(m_stripe_shards[i].rwlock);
+      m_stripe_shards[i].deleting.clear();
+      std::unique_lock<std::mutex> a_lck(m_stripe_shards[i].access_mutex);
+      m_stripe_shards[i].access.clear();
+    }
     for (auto it = m_cluster_table.begin(); it != m_cluster_table.end(); it++)
     {
       Cluster &t_cluster = it->second;
       t_cluster.blocks.clear();
+      t_cluster.block_pos.clear();
+      t_cluster.stripe_blocks.clear();
       t_cluster.stripes.clear();
     }
     for (auto it = m_node_table.begin(); it != m_node_table.end(); it++)
@@ -65,12 +575,13 @@ namespace ECProject
       t_node.stripes.clear();
     }
     m_stripe_table.clear();
+    m_block_arena.clear();
     m_merge_groups.clear();
     m_free_clusters.clear();
+    m_cluster_pool = CandidatePool();
+    m_node_pools.clear();
     m_merge_degree = 0;
     m_agg_start_cid = 0;
-    std::cout << "setParameter success" << std::endl;
-    return grpc::Status::OK;
   }
 
   grpc::Status CoordinatorImpl::sayHelloToCoordinator(
@@ -84,19 +595,60 @@ namespace ECProject
     return grpc::Status::OK;
   }
 
-  grpc::Status CoordinatorImpl::uploadOriginKeyValue(
-      grpc::ServerContext *context,
+  grpc::ServerUnaryReactor *CoordinatorImpl::uploadOriginKeyValue(
+      grpc::CallbackServerContext *context,
       const coordinator_proto::RequestProxyIPPort *keyValueSize,
       coordinator_proto::ReplyProxyIPPort *proxyIPPort)
   {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
+    m_num_of_ops++;
 
     std::string key = keyValueSize->key();
-    m_mutex.lock();
-    m_object_commit_table.erase(key);
-    m_mutex.unlock();
-    int valuesizebytes = keyValueSize->valuesizebytes();
-
+    std::shared_ptr<ProxyCall<proxy_proto::ObjectAndPlacement, proxy_proto::SetReply>> call =
+        std::make_shared<ProxyCall<proxy_proto::ObjectAndPlacement, proxy_proto::SetReply>>();
     ObjectInfo new_object;
+    int s_cluster_id = place_object(key, keyValueSize->valuesizebytes(), call->request, new_object);
+
+    std::string selected_proxy_ip = m_cluster_table[s_cluster_id].proxy_ip;
+    int selected_proxy_port = m_cluster_table[s_cluster_id].proxy_port;
+    std::string chosen_proxy = selected_proxy_ip + ":" + std::to_string(selected_proxy_port);
+    proxyIPPort->set_proxyip(selected_proxy_ip);
+    proxyIPPort->set_proxyport(selected_proxy_port + 1); // use another port to accept data
+    // the client is answered once the proxy has the placement
+    ObjectShard *p_shard = &object_shard(key);
+    m_proxy_ptrs[chosen_proxy]->async()->encodeAndSetObject(
+        &call->context, &call->request, &call->reply,
+        [call, reactor, p_shard, key, new_object](grpc::Status status)
+        {
+          if (status.ok())
+          {
+            std::unique_lock<RWMutex> o_lck(p_shard->rwlock);
+            p_shard->updating_table[key] = new_object;
+          }
+          else
+          {
+            std::cout << "[SET] Send object placement failed!" << std::endl;
+          }
+          reactor->Finish(grpc::Status::OK);
+        });
+
+    return reactor;
+  }
+
+  // place a new object in a stripe of its own, or in the open pack if it is small and packing is on,
+  // and fill in the placement sent to the proxy, returns the cluster whose proxy encodes the object
+  int CoordinatorImpl::place_object(const std::string &key, int valuesizebytes,
+                                    proxy_proto::ObjectAndPlacement &object_placement, ObjectInfo &new_object)
+  {
+    ObjectShard &o_shard = object_shard(key);
+    {
+      std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+      o_shard.commit_table.erase(key);
+    }
+    if (m_encode_parameters.pack_block_size > 0 && valuesizebytes <= m_encode_parameters.pack_block_size)
+    {
+      return pack_object(key, valuesizebytes, object_placement, new_object);
+    }
 
     int k = m_encode_parameters.k_datablock;
     int g_m = m_encode_parameters.g_m_globalparityblock;
@@ -105,7 +657,6 @@ namespace ECProject
     new_object.object_size = valuesizebytes;
     int block_size = ceil(valuesizebytes, k);
 
-    proxy_proto::ObjectAndPlacement object_placement;
     object_placement.set_key(key);
     object_placement.set_valuesizebyte(valuesizebytes);
     object_placement.set_k(k);
@@ -114,75 +665,395 @@ namespace ECProject
     object_placement.set_encode_type((int)m_encode_parameters.encodetype);
     object_placement.set_block_size(block_size);
 
+    int stripe_id = m_cur_stripe_id++;
+    new_object.map2stripe = stripe_id;
+    return place_stripe(stripe_id, key, valuesizebytes, block_size, object_placement);
+  }
+
+  // a new stripe holding the object, with the blocks added to the placement,
+  // returns the cluster whose proxy encodes it
+  int CoordinatorImpl::place_stripe(int stripe_id, const std::string &key, int valuesizebytes, int block_size,
+                                    proxy_proto::ObjectAndPlacement &object_placement)
+  {
     Stripe t_stripe;
-    t_stripe.stripe_id = m_cur_stripe_id++;
-    t_stripe.k = k;
-    t_stripe.l = l;
-    t_stripe.g_m = g_m;
+    t_stripe.stripe_id = stripe_id;
+    t_stripe.k = m_encode_parameters.k_datablock;
+    t_stripe.l = m_encode_parameters.l_localparityblock;
+    t_stripe.g_m = m_encode_parameters.g_m_globalparityblock;
     t_stripe.object_keys.push_back(key);
     t_stripe.object_sizes.push_back(valuesizebytes);
-    m_stripe_table[t_stripe.stripe_id] = t_stripe;
-    new_object.map2stripe = t_stripe.stripe_id;
-
-    int s_cluster_id = generate_placement(t_stripe.stripe_id, block_size);
 
-    Stripe &stripe = m_stripe_table[t_stripe.stripe_id];
-    object_placement.set_stripe_id(stripe.stripe_id);
-    for (int i = 0; i < int(stripe.blocks.size()); i++)
+    int s_cluster_id = -1;
     {
-      object_placement.add_datanodeip(m_node_table[stripe.blocks[i]->map2node].node_ip);
-      object_placement.add_datanodeport(m_node_table[stripe.blocks[i]->map2node].node_port);
-      object_placement.add_blockkeys(stripe.blocks[i]->block_key);
+      // the placement reads the layout of every cluster and may extend the merge groups
+      std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+      m_stripe_table[t_stripe.stripe_id] = t_stripe;
+      s_cluster_id = generate_placement(t_stripe.stripe_id, block_size);
+
+      Stripe &stripe = m_stripe_table[t_stripe.stripe_id];
+      m_meta_log.append(stripe_record(stripe));
+      m_meta_log.append(group_append_record(stripe.stripe_id));
+      m_meta_log.append(counters_record());
+      object_placement.set_stripe_id(stripe.stripe_id);
+      for (int i = 0; i < int(stripe.blocks.size()); i++)
+      {
+        object_placement.add_datanodeip(m_node_table[stripe.blocks[i]->map2node].node_ip);
+        object_placement.add_datanodeport(m_node_table[stripe.blocks[i]->map2node].node_port);
+        object_placement.add_blockkeys(stripe.blocks[i]->block_key());
+      }
     }
+    return s_cluster_id;
+  }
 
-    grpc::ClientContext cont;
-    proxy_proto::SetReply set_reply;
-    std::string selected_proxy_ip = m_cluster_table[s_cluster_id].proxy_ip;
-    int selected_proxy_port = m_cluster_table[s_cluster_id].proxy_port;
-    std::string chosen_proxy = selected_proxy_ip + ":" + std::to_string(selected_proxy_port);
-    grpc::Status status = m_proxy_ptrs[chosen_proxy]->encodeAndSetObject(&cont, object_placement, &set_reply);
-    proxyIPPort->set_proxyip(selected_proxy_ip);
-    proxyIPPort->set_proxyport(selected_proxy_port + 1); // use another port to accept data
-    if (status.ok())
+  // append a small object to the open pack, opening a new one if it does not fit,
+  // returns the cluster whose proxy buffers the pack
+  int CoordinatorImpl::pack_object(const std::string &key, int valuesizebytes,
+                                   proxy_proto::ObjectAndPlacement &object_placement, ObjectInfo &new_object)
+  {
+    int k = m_encode_parameters.k_datablock;
+    std::unique_lock<std::mutex> k_lck(m_pack_mutex);
+    if (m_open_pack.stripe_id >= 0 && m_open_pack.used + valuesizebytes > k * m_open_pack.block_size)
     {
-      m_mutex.lock();
-      m_object_updating_table[key] = new_object;
-      m_mutex.unlock();
+      seal_pack();
     }
-    else
+    if (m_open_pack.stripe_id < 0)
     {
-      std::cout << "[SET] Send object placement failed!" << std::endl;
+      open_pack();
     }
+    new_object.object_size = valuesizebytes;
+    new_object.map2stripe = m_open_pack.stripe_id;
+    new_object.map2pack = m_open_pack.stripe_id;
+    new_object.offset = m_open_pack.used;
 
-    return grpc::Status::OK;
+    object_placement.set_key(key);
+    object_placement.set_valuesizebyte(valuesizebytes);
+    object_placement.set_k(k);
+    object_placement.set_g_m(m_encode_parameters.g_m_globalparityblock);
+    object_placement.set_l(m_encode_parameters.l_localparityblock);
+    object_placement.set_encode_type((int)m_encode_parameters.encodetype);
+    object_placement.set_block_size(m_open_pack.block_size);
+    object_placement.set_stripe_id(m_open_pack.stripe_id);
+    object_placement.set_offset(m_open_pack.used);
+    object_placement.set_packed(true);
+
+    m_open_pack.used += valuesizebytes;
+    m_open_pack.keys.push_back(key);
+    int s_cluster_id = m_open_pack.cluster_id;
+    if (m_open_pack.used == k * m_open_pack.block_size)
+    {
+      seal_pack();
+    }
+    return s_cluster_id;
   }
 
-  grpc::Status CoordinatorImpl::getValue(
-      grpc::ServerContext *context,
+  void CoordinatorImpl::open_pack()
+  {
+    int k = m_encode_parameters.k_datablock;
+    m_open_pack = OpenPack();
+    m_open_pack.stripe_id = m_cur_stripe_id++;
+    m_open_pack.block_size = m_encode_parameters.pack_block_size;
+    m_open_pack.opened = std::chrono::steady_clock::now();
+    proxy_proto::ObjectAndPlacement &placement = m_open_pack.placement;
+    placement.set_key(pack_key(m_open_pack.stripe_id));
+    placement.set_valuesizebyte(k * m_open_pack.block_size);
+    placement.set_k(k);
+    placement.set_g_m(m_encode_parameters.g_m_globalparityblock);
+    placement.set_l(m_encode_parameters.l_localparityblock);
+    placement.set_encode_type((int)m_encode_parameters.encodetype);
+    placement.set_block_size(m_open_pack.block_size);
+    m_open_pack.cluster_id = place_stripe(m_open_pack.stripe_id, placement.key(), k * m_open_pack.block_size, m_open_pack.block_size, placement);
+    if (IF_DEBUG)
+    {
+      std::cout << "[SET] open pack " << m_open_pack.stripe_id << " in cluster " << m_open_pack.cluster_id << std::endl;
+    }
+  }
+
+  // the proxy encodes the pack once the objects appended have arrived, and commits it with them
+  void CoordinatorImpl::seal_pack()
+  {
+    std::string t_pack_key = m_open_pack.placement.key();
+    ObjectInfo pack_info;
+    pack_info.object_size = m_open_pack.placement.valuesizebyte();
+    pack_info.map2stripe = m_open_pack.stripe_id;
+    {
+      ObjectShard &o_shard = object_shard(t_pack_key);
+      std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+      o_shard.updating_table[t_pack_key] = pack_info;
+    }
+    std::shared_ptr<ProxyCall<proxy_proto::ObjectAndPlacement, proxy_proto::SetReply>> call =
+        std::make_shared<ProxyCall<proxy_proto::ObjectAndPlacement, proxy_proto::SetReply>>();
+    call->request.Swap(&m_open_pack.placement);
+    for (auto it = m_open_pack.keys.begin(); it != m_open_pack.keys.end(); it++)
+    {
+      call->request.add_packed_keys(*it);
+    }
+    Cluster &t_cluster = m_cluster_table[m_open_pack.cluster_id];
+    std::string chosen_proxy = t_cluster.proxy_ip + ":" + std::to_string(t_cluster.proxy_port);
+    if (IF_DEBUG)
+    {
+      std::cout << "[SET] seal pack " << m_open_pack.stripe_id << " of " << m_open_pack.keys.size()
+                << " objects, " << m_open_pack.used << " bytes" << std::endl;
+    }
+    m_proxy_ptrs[chosen_proxy]->async()->sealPack(
+        &call->context, &call->request, &call->reply,
+        [call](grpc::Status status)
+        {
+          if (!status.ok())
+          {
+            std::cout << "[SET] Send pack " << call->request.key() << " failed!" << std::endl;
+          }
+        });
+    m_open_pack = OpenPack();
+  }
+
+  // seal the open pack once it has been open for PACK_SEAL_TIMEOUT_MS
+  void CoordinatorImpl::pack_sealer()
+  {
+    std::unique_lock<std::mutex> lck(m_job_mutex);
+    while (!m_stop_merge_workers)
+    {
+      m_job_cv.wait_for(lck, std::chrono::milliseconds(PACK_SEAL_TIMEOUT_MS / 2));
+      if (m_stop_merge_workers)
+      {
+        return;
+      }
+      lck.unlock();
+      {
+        std::unique_lock<std::mutex> k_lck(m_pack_mutex);
+        if (m_open_pack.stripe_id >= 0 &&
+            std::chrono::steady_clock::now() - m_open_pack.opened >= std::chrono::milliseconds(PACK_SEAL_TIMEOUT_MS))
+        {
+          seal_pack();
+        }
+      }
+      lck.lock();
+    }
+  }
+
+  // a packed object leaves the metadata at once, its bytes stay in the pack until every object of the pack is deleted,
+  // returns false if the object is not packed, throws if there is no such object
+  bool CoordinatorImpl::delete_packed_object(const std::string &key, std::string &empty_pack, std::vector<PendingCheck> &checks)
+  {
+    int pack_id = -1;
+    {
+      ObjectShard &o_shard = object_shard(key);
+      std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+      auto it_o = o_shard.commit_table.find(key);
+      if (it_o == o_shard.commit_table.end())
+      {
+        throw std::out_of_range("no object " + key);
+      }
+      if (it_o->second.map2pack < 0)
+      {
+        return false;
+      }
+      pack_id = it_o->second.map2pack;
+      o_shard.commit_table.erase(it_o);
+      m_meta_log.append(del_object_record(key));
+      wake_object_checks(o_shard, key, checks);
+    }
+    std::unique_lock<std::mutex> k_lck(m_pack_mutex);
+    auto it_p = m_pack_members.find(pack_id);
+    if (it_p != m_pack_members.end())
+    {
+      it_p->second.erase(key);
+      if (it_p->second.empty())
+      {
+        m_pack_members.erase(it_p);
+        empty_pack = pack_key(pack_id);
+      }
+    }
+    return true;
+  }
+
+  // the objects of a deleted pack go with it
+  void CoordinatorImpl::drop_pack_members(const std::string &key, std::vector<PendingCheck> &checks)
+  {
+    int pack_id = pack_id_of(key);
+    if (pack_id < 0)
+    {
+      return;
+    }
+    std::unordered_set<std::string> members;
+    {
+      std::unique_lock<std::mutex> k_lck(m_pack_mutex);
+      auto it_p = m_pack_members.find(pack_id);
+      if (it_p == m_pack_members.end())
+      {
+        return;
+      }
+      members.swap(it_p->second);
+      m_pack_members.erase(it_p);
+    }
+    for (auto it = members.begin(); it != members.end(); it++)
+    {
+      ObjectShard &o_shard = object_shard(*it);
+      std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+      auto it_o = o_shard.commit_table.find(*it);
+      // set again since, into another pack or a stripe of its own
+      if (it_o != o_shard.commit_table.end() && it_o->second.map2pack == pack_id)
+      {
+        o_shard.commit_table.erase(it_o);
+        m_meta_log.append(del_object_record(*it));
+        wake_object_checks(o_shard, *it, checks);
+      }
+    }
+  }
+
+  // the objects placed on the same proxy go to it in one call, the client is answered once every proxy has its objects
+  grpc::ServerUnaryReactor *CoordinatorImpl::uploadOriginKeyValues(
+      grpc::CallbackServerContext *context,
+      const coordinator_proto::RequestProxyIPPorts *keyValueSizes,
+      coordinator_proto::ReplyProxyIPPorts *proxyIPPorts)
+  {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
+    std::map<std::string, std::shared_ptr<ProxyCall<proxy_proto::ObjectBatch, proxy_proto::SetReply>>> calls;
+    std::map<std::string, std::vector<std::pair<std::string, ObjectInfo>>> new_objects;
+    for (int i = 0; i < keyValueSizes->objects_size(); i++)
+    {
+      m_num_of_ops++;
+      const coordinator_proto::RequestProxyIPPort &t_object = keyValueSizes->objects(i);
+      ObjectInfo new_object;
+      proxy_proto::ObjectAndPlacement object_placement;
+      int s_cluster_id = place_object(t_object.key(), t_object.valuesizebytes(), object_placement, new_object);
+      std::string selected_proxy_ip = m_cluster_table[s_cluster_id].proxy_ip;
+      int selected_proxy_port = m_cluster_table[s_cluster_id].proxy_port;
+      std::string chosen_proxy = selected_proxy_ip + ":" + std::to_string(selected_proxy_port);
+      coordinator_proto::ReplyProxyIPPort *t_proxy = proxyIPPorts->add_proxies();
+      t_proxy->set_proxyip(selected_proxy_ip);
+      t_proxy->set_proxyport(selected_proxy_port + 1);
+      std::shared_ptr<ProxyCall<proxy_proto::ObjectBatch, proxy_proto::SetReply>> &call = calls[chosen_proxy];
+      if (call == nullptr)
+      {
+        call = std::make_shared<ProxyCall<proxy_proto::ObjectBatch, proxy_proto::SetReply>>();
+      }
+      call->request.add_objects()->Swap(&object_placement);
+      new_objects[chosen_proxy].push_back(std::make_pair(t_object.key(), new_object));
+    }
+    if (calls.empty())
+    {
+      reactor->Finish(grpc::Status::OK);
+      return reactor;
+    }
+    std::shared_ptr<std::atomic<int>> pending = std::make_shared<std::atomic<int>>(int(calls.size()));
+    for (auto it = calls.begin(); it != calls.end(); it++)
+    {
+      std::shared_ptr<ProxyCall<proxy_proto::ObjectBatch, proxy_proto::SetReply>> call = it->second;
+      std::vector<std::pair<std::string, ObjectInfo>> t_objects = new_objects[it->first];
+      m_proxy_ptrs[it->first]->async()->encodeAndSetObjects(
+          &call->context, &call->request, &call->reply,
+          [this, call, reactor, pending, t_objects](grpc::Status status)
+          {
+            if (status.ok())
+            {
+              for (auto ito = t_objects.begin(); ito != t_objects.end(); ito++)
+              {
+                ObjectShard &o_shard = object_shard(ito->first);
+                std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+                o_shard.updating_table[ito->first] = ito->second;
+              }
+            }
+            else
+            {
+              std::cout << "[SET] Send object placements failed!" << std::endl;
+            }
+            if (--(*pending) == 0)
+            {
+              reactor->Finish(grpc::Status::OK);
+            }
+          });
+    }
+    return reactor;
+  }
+
+  grpc::ServerUnaryReactor *CoordinatorImpl::getValue(
+      grpc::CallbackServerContext *context,
       const coordinator_proto::KeyAndClientIP *keyClient,
       coordinator_proto::RepIfGetSuccess *getReplyClient)
   {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
+    m_num_of_ops++;
     try
     {
       std::string key = keyClient->key();
-      std::string client_ip = keyClient->clientip();
-      int client_port = keyClient->clientport();
-      ObjectInfo object_info;
-      m_mutex.lock();
-      object_info = m_object_commit_table.at(key);
-      m_mutex.unlock();
-      int k = m_encode_parameters.k_datablock;
-      int g_m = m_encode_parameters.g_m_globalparityblock;
-      int l = m_encode_parameters.l_localparityblock;
-      // int b = m_encode_parameters.b_datapergroup;
-
-      grpc::ClientContext decode_and_get;
-      proxy_proto::ObjectAndPlacement object_placement;
-      grpc::Status status;
-      proxy_proto::GetReply get_reply;
-      getReplyClient->set_valuesizebytes(object_info.object_size);
+      std::shared_ptr<ProxyCall<proxy_proto::ObjectAndPlacement, proxy_proto::GetReply>> call =
+          std::make_shared<ProxyCall<proxy_proto::ObjectAndPlacement, proxy_proto::GetReply>>();
+      std::string chosen_proxy = plan_get(key, keyClient->clientip(), keyClient->clientport(), call->request,
+                                          keyClient->offset(), keyClient->length());
+      getReplyClient->set_valuesizebytes(call->request.valuesizebyte());
+      m_proxy_ptrs[chosen_proxy]->async()->decodeAndGetObject(
+          &call->context, &call->request, &call->reply,
+          [call, reactor, key](grpc::Status status)
+          {
+            if (status.ok())
+            {
+              std::cout << "[GET] getting value of " << key << std::endl;
+            }
+            reactor->Finish(grpc::Status::OK);
+          });
+      return reactor;
+    }
+    catch (std::exception &e)
+    {
+      std::cout << "getValue exception" << std::endl;
+      std::cout << e.what() << std::endl;
+    }
+    reactor->Finish(grpc::Status::OK);
+    return reactor;
+  }
+
+  // the blocks of the object to read and the proxy reading them, throws if there is no such object,
+  // only the range [offset, offset + length) of the object is read, length 0 to the end of it
+  std::string CoordinatorImpl::plan_get(const std::string &key, const std::string &client_ip, int client_port,
+                                        proxy_proto::ObjectAndPlacement &object_placement, int offset, int length)
+  {
+    ObjectInfo object_info;
+    int k = m_encode_parameters.k_datablock;
+    int g_m = m_encode_parameters.g_m_globalparityblock;
+    int l = m_encode_parameters.l_localparityblock;
+    // int b = m_encode_parameters.b_datapergroup;
+
+    std::string chosen_proxy;
+    int merging_stripe = -1;
+    do
+    {
+      wait_stripe_merged(merging_stripe);
+      merging_stripe = -1;
+      // only the lookup holds the locks, not the transfer
+      SharedLock t_lck(m_stripe_table_rwlock);
+      {
+        ObjectShard &o_shard = object_shard(key);
+        SharedLock o_lck(o_shard.rwlock);
+        object_info = o_shard.commit_table.at(key);
+      }
+      offset = std::max(0, std::min(offset, object_info.object_size));
+      if (length <= 0 || length > object_info.object_size - offset)
+      {
+        length = object_info.object_size - offset;
+      }
+      // a packed object is read from the data blocks of its pack
+      std::string block_owner = key;
+      if (object_info.map2pack >= 0)
+      {
+        block_owner = pack_key(object_info.map2pack);
+        ObjectShard &p_shard = object_shard(block_owner);
+        SharedLock p_lck(p_shard.rwlock);
+        object_info.map2stripe = p_shard.commit_table.at(block_owner).map2stripe;
+      }
+      // the blocks of a stripe being merged may point to where they are not copied yet
+      if (stripe_merging(object_info.map2stripe))
+      {
+        merging_stripe = object_info.map2stripe;
+        continue;
+      }
+      StripeShard &s_shard = stripe_shard(object_info.map2stripe);
+      {
+        std::unique_lock<std::mutex> a_lck(s_shard.access_mutex);
+        s_shard.access[object_info.map2stripe]++;
+      }
+      SharedLock s_lck(s_shard.rwlock);
       object_placement.set_key(key);
-      object_placement.set_valuesizebyte(object_info.object_size);
+      object_placement.set_valuesizebyte(length);
       object_placement.set_k(k);
       object_placement.set_l(l);
       object_placement.set_g_m(g_m);
@@ -190,64 +1061,205 @@ namespace ECProject
       object_placement.set_encode_type(m_encode_parameters.encodetype);
       object_placement.set_clientip(client_ip);
       object_placement.set_clientport(client_port);
-      Stripe &t_stripe = m_stripe_table[object_info.map2stripe];
-      std::unordered_set<int> t_cluster_set;
+      object_placement.set_offset(object_info.offset + offset);
+      Stripe &t_stripe = m_stripe_table.at(object_info.map2stripe);
+      std::vector<Block *> t_blocks;
+      // cluster_id -> (number of data blocks, number of blocks), of the blocks covering the range
+      std::map<int, std::pair<int, int>> t_cluster_blocks;
       for (int i = 0; i < int(t_stripe.blocks.size()); i++)
       {
-        if (t_stripe.blocks[i]->map2key == key)
+        if (t_stripe.blocks[i]->of_object(block_owner))
         {
-          object_placement.add_datanodeip(m_node_table[t_stripe.blocks[i]->map2node].node_ip);
-          object_placement.add_datanodeport(m_node_table[t_stripe.blocks[i]->map2node].node_port);
-          object_placement.add_blockkeys(t_stripe.blocks[i]->block_key);
-          object_placement.add_blockids(t_stripe.blocks[i]->block_id);
-          t_cluster_set.insert(t_stripe.blocks[i]->map2cluster);
+          t_blocks.push_back(t_stripe.blocks[i]);
+          int t_block_size = t_stripe.blocks[i]->block_size;
+          int begin = t_stripe.blocks[i]->key_index * t_block_size;
+          if (t_stripe.blocks[i]->block_type == 'D' &&
+              (begin >= object_info.offset + offset + length || begin + t_block_size <= object_info.offset + offset))
+          {
+            continue;
+          }
+          std::pair<int, int> &cnt = t_cluster_blocks[t_stripe.blocks[i]->map2cluster];
+          if (t_stripe.blocks[i]->block_type == 'D')
+          {
+            cnt.first++;
+          }
+          cnt.second++;
         }
       }
-      // randomly select a cluster
-      int idx = rand_num(int(t_cluster_set.size()));
-      int r_cluster_id = *(std::next(t_cluster_set.begin(), idx));
-      std::string chosen_proxy = m_cluster_table[r_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[r_cluster_id].proxy_port);
-      status = m_proxy_ptrs[chosen_proxy]->decodeAndGetObject(&decode_and_get, object_placement, &get_reply);
-      if (status.ok())
+      // select the cluster holding the most data blocks, to minimize the cross-cluster transfer
+      int r_cluster_id = -1;
+      std::pair<int, int> max_cnt(-1, -1);
+      for (auto &kv : t_cluster_blocks)
+      {
+        if (kv.second > max_cnt)
+        {
+          max_cnt = kv.second;
+          r_cluster_id = kv.first;
+        }
+      }
+      for (auto &t_block : t_blocks)
+      {
+        object_placement.set_block_size(t_block->block_size);
+        object_placement.add_datanodeip(m_node_table[t_block->map2node].node_ip);
+        object_placement.add_datanodeport(m_node_table[t_block->map2node].node_port);
+        object_placement.add_blockkeys(t_block->block_key());
+        // the index of a data block in its object, as merging renumbers the blocks of a stripe
+        object_placement.add_blockids(t_block->block_type == 'D' ? t_block->key_index : t_block->block_id);
+        object_placement.add_islocal(t_block->map2cluster == r_cluster_id);
+        object_placement.add_clusterids(t_block->map2cluster);
+      }
+      object_placement.set_if_partial_decoding(m_encode_parameters.partial_decoding);
+      if (IF_DEBUG)
+      {
+        std::cout << "[GET] select proxy in cluster " << r_cluster_id << " with " << max_cnt.first
+                  << " local data blocks" << std::endl;
+      }
+      chosen_proxy = m_cluster_table[r_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[r_cluster_id].proxy_port);
+    } while (merging_stripe >= 0);
+    return chosen_proxy;
+  }
+
+  // the reads through the same proxy go to it in one call, the values are sent to the client in any order
+  grpc::ServerUnaryReactor *CoordinatorImpl::getValues(
+      grpc::CallbackServerContext *context,
+      const coordinator_proto::KeysAndClientIP *keysClient,
+      coordinator_proto::RepIfGetSuccesses *getReplyClient)
+  {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
+    std::map<std::string, std::shared_ptr<ProxyCall<proxy_proto::ObjectBatch, proxy_proto::GetReply>>> calls;
+    bool all_found = true;
+    for (int i = 0; i < keysClient->keys_size(); i++)
+    {
+      m_num_of_ops++;
+      try
+      {
+        proxy_proto::ObjectAndPlacement object_placement;
+        std::string chosen_proxy = plan_get(keysClient->keys(i), keysClient->clientip(), keysClient->clientport(), object_placement);
+        object_placement.set_with_key_size(true);
+        getReplyClient->add_valuesizebytes(object_placement.valuesizebyte());
+        std::shared_ptr<ProxyCall<proxy_proto::ObjectBatch, proxy_proto::GetReply>> &call = calls[chosen_proxy];
+        if (call == nullptr)
+        {
+          call = std::make_shared<ProxyCall<proxy_proto::ObjectBatch, proxy_proto::GetReply>>();
+        }
+        call->request.add_objects()->Swap(&object_placement);
+      }
+      catch (std::exception &e)
       {
-        std::cout << "[GET] getting value of " << key << std::endl;
+        std::cout << "getValues exception" << std::endl;
+        std::cout << e.what() << std::endl;
+        getReplyClient->add_valuesizebytes(-1); // not sent
+        all_found = false;
       }
     }
-    catch (std::exception &e)
+    getReplyClient->set_ifgetsuccess(all_found);
+    if (calls.empty())
     {
-      std::cout << "getValue exception" << std::endl;
-      std::cout << e.what() << std::endl;
+      reactor->Finish(grpc::Status::OK);
+      return reactor;
     }
-    return grpc::Status::OK;
+    std::shared_ptr<std::atomic<int>> pending = std::make_shared<std::atomic<int>>(int(calls.size()));
+    for (auto it = calls.begin(); it != calls.end(); it++)
+    {
+      std::shared_ptr<ProxyCall<proxy_proto::ObjectBatch, proxy_proto::GetReply>> call = it->second;
+      m_proxy_ptrs[it->first]->async()->decodeAndGetObjects(
+          &call->context, &call->request, &call->reply,
+          [call, reactor, pending](grpc::Status status)
+          {
+            if (status.ok())
+            {
+              std::cout << "[GET] getting values of " << call->request.objects_size() << " objects" << std::endl;
+            }
+            if (--(*pending) == 0)
+            {
+              reactor->Finish(grpc::Status::OK);
+            }
+          });
+    }
+    return reactor;
   }
 
-  grpc::Status CoordinatorImpl::delByKey(
-      grpc::ServerContext *context,
+  grpc::ServerUnaryReactor *CoordinatorImpl::delByKey(
+      grpc::CallbackServerContext *context,
       const coordinator_proto::KeyFromClient *del_key,
       coordinator_proto::RepIfDeling *delReplyClient)
   {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
     try
     {
       std::string key = del_key->key();
-      ObjectInfo object_info;
-      m_mutex.lock();
-      object_info = m_object_commit_table.at(key);
-      m_object_updating_table[key] = m_object_commit_table[key];
-      m_mutex.unlock();
+      // a packed object is deleted at once, the blocks of its pack once the pack is empty
+      std::string empty_pack;
+      std::vector<PendingCheck> checks;
+      bool packed = delete_packed_object(key, empty_pack, checks);
+      finish_checks(checks);
+      if (packed && empty_pack.empty())
+      {
+        delReplyClient->set_ifdeling(true);
+        reactor->Finish(grpc::Status::OK);
+        return reactor;
+      }
+      if (packed)
+      {
+        key = empty_pack;
+      }
+      std::shared_ptr<ProxyCall<proxy_proto::NodeAndBlock, proxy_proto::DelReply>> call =
+          std::make_shared<ProxyCall<proxy_proto::NodeAndBlock, proxy_proto::DelReply>>();
+      std::string chosen_proxy = plan_delete_key(key, call->request);
+      delReplyClient->set_ifdeling(true);
+      m_proxy_ptrs[chosen_proxy]->async()->deleteBlock(
+          &call->context, &call->request, &call->reply,
+          [call, reactor, key](grpc::Status status)
+          {
+            if (status.ok())
+            {
+              std::cout << "[DEL] deleting value of " << key << std::endl;
+            }
+            reactor->Finish(grpc::Status::OK);
+          });
+      return reactor;
+    }
+    catch (const std::exception &e)
+    {
+      std::cout << "deleteByKey exception" << std::endl;
+      std::cout << e.what() << std::endl;
+    }
+    reactor->Finish(grpc::Status::OK);
+    return reactor;
+  }
 
-      grpc::ClientContext context;
-      proxy_proto::NodeAndBlock node_block;
-      grpc::Status status;
-      proxy_proto::DelReply del_reply;
-      Stripe &t_stripe = m_stripe_table[object_info.map2stripe];
+  // the blocks of the object to delete and the proxy deleting them, throws if there is no such object
+  std::string CoordinatorImpl::plan_delete_key(const std::string &key, proxy_proto::NodeAndBlock &node_block)
+  {
+    ObjectInfo object_info;
+    std::string chosen_proxy;
+    int merging_stripe = -1;
+    do
+    {
+      wait_stripe_merged(merging_stripe);
+      merging_stripe = -1;
+      SharedLock t_lck(m_stripe_table_rwlock);
+      {
+        ObjectShard &o_shard = object_shard(key);
+        std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+        object_info = o_shard.commit_table.at(key);
+        if (stripe_merging(object_info.map2stripe))
+        {
+          merging_stripe = object_info.map2stripe;
+          continue;
+        }
+        o_shard.updating_table[key] = object_info;
+      }
+      SharedLock s_lck(stripe_shard(object_info.map2stripe).rwlock);
+      Stripe &t_stripe = m_stripe_table.at(object_info.map2stripe);
       std::unordered_set<int> t_cluster_set;
       for (int i = 0; i < int(t_stripe.blocks.size()); i++)
       {
-        if (t_stripe.blocks[i]->map2key == key)
+        if (t_stripe.blocks[i]->of_object(key))
         {
           node_block.add_datanodeip(m_node_table[t_stripe.blocks[i]->map2node].node_ip);
           node_block.add_datanodeport(m_node_table[t_stripe.blocks[i]->map2node].node_port);
-          node_block.add_blockkeys(t_stripe.blocks[i]->block_key);
+          node_block.add_blockkeys(t_stripe.blocks[i]->block_key());
           t_cluster_set.insert(t_stripe.blocks[i]->map2cluster);
         }
       }
@@ -256,69 +1268,143 @@ namespace ECProject
       // randomly select a cluster
       int idx = rand_num(int(t_cluster_set.size()));
       int r_cluster_id = *(std::next(t_cluster_set.begin(), idx));
-      std::string chosen_proxy = m_cluster_table[r_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[r_cluster_id].proxy_port);
-      status = m_proxy_ptrs[chosen_proxy]->deleteBlock(&context, node_block, &del_reply);
-      delReplyClient->set_ifdeling(true);
-      if (status.ok())
+      chosen_proxy = m_cluster_table[r_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[r_cluster_id].proxy_port);
+    } while (merging_stripe >= 0);
+    return chosen_proxy;
+  }
+
+  // the deletes are sent to the proxies asynchronously, the client is answered once every proxy has its deletes
+  grpc::ServerUnaryReactor *CoordinatorImpl::delByKeys(
+      grpc::CallbackServerContext *context,
+      const coordinator_proto::KeysFromClient *del_keys,
+      coordinator_proto::RepIfDeling *delReplyClient)
+  {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
+    std::vector<std::pair<std::string, std::shared_ptr<ProxyCall<proxy_proto::NodeAndBlock, proxy_proto::DelReply>>>> calls;
+    std::vector<PendingCheck> checks;
+    bool all_found = true;
+    for (int i = 0; i < del_keys->keys_size(); i++)
+    {
+      try
+      {
+        std::string key = del_keys->keys(i);
+        std::string empty_pack;
+        bool packed = delete_packed_object(key, empty_pack, checks);
+        if (packed && empty_pack.empty())
+        {
+          continue;
+        }
+        if (packed)
+        {
+          key = empty_pack;
+        }
+        std::shared_ptr<ProxyCall<proxy_proto::NodeAndBlock, proxy_proto::DelReply>> call =
+            std::make_shared<ProxyCall<proxy_proto::NodeAndBlock, proxy_proto::DelReply>>();
+        std::string chosen_proxy = plan_delete_key(key, call->request);
+        calls.push_back(std::make_pair(chosen_proxy, call));
+      }
+      catch (const std::exception &e)
       {
-        std::cout << "[DEL] deleting value of " << key << std::endl;
+        std::cout << "deleteByKeys exception" << std::endl;
+        std::cout << e.what() << std::endl;
+        all_found = false;
       }
     }
-    catch (const std::exception &e)
+    finish_checks(checks);
+    delReplyClient->set_ifdeling(all_found);
+    if (calls.empty())
     {
-      std::cout << "deleteByKey exception" << std::endl;
-      std::cout << e.what() << std::endl;
+      reactor->Finish(grpc::Status::OK);
+      return reactor;
     }
-    return grpc::Status::OK;
+    std::shared_ptr<std::atomic<int>> pending = std::make_shared<std::atomic<int>>(int(calls.size()));
+    for (auto it = calls.begin(); it != calls.end(); it++)
+    {
+      std::shared_ptr<ProxyCall<proxy_proto::NodeAndBlock, proxy_proto::DelReply>> call = it->second;
+      m_proxy_ptrs[it->first]->async()->deleteBlock(
+          &call->context, &call->request, &call->reply,
+          [call, reactor, pending](grpc::Status status)
+          {
+            if (status.ok())
+            {
+              std::cout << "[DEL] deleting value of " << call->request.key() << std::endl;
+            }
+            if (--(*pending) == 0)
+            {
+              reactor->Finish(grpc::Status::OK);
+            }
+          });
+    }
+    return reactor;
   }
 
-  grpc::Status CoordinatorImpl::delByStripe(
-      grpc::ServerContext *context,
+  grpc::ServerUnaryReactor *CoordinatorImpl::delByStripe(
+      grpc::CallbackServerContext *context,
       const coordinator_proto::StripeIdFromClient *stripeid,
       coordinator_proto::RepIfDeling *delReplyClient)
   {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
     try
     {
       int t_stripe_id = stripeid->stripe_id();
-      m_mutex.lock();
-      m_stripe_deleting_table.push_back(t_stripe_id);
-      m_mutex.unlock();
 
-      grpc::ClientContext context;
-      proxy_proto::NodeAndBlock node_block;
-      grpc::Status status;
-      proxy_proto::DelReply del_reply;
-      Stripe &t_stripe = m_stripe_table[t_stripe_id];
-      std::unordered_set<int> t_cluster_set;
-      for (int i = 0; i < int(t_stripe.blocks.size()); i++)
+      std::shared_ptr<ProxyCall<proxy_proto::NodeAndBlock, proxy_proto::DelReply>> call =
+          std::make_shared<ProxyCall<proxy_proto::NodeAndBlock, proxy_proto::DelReply>>();
+      proxy_proto::NodeAndBlock &node_block = call->request;
+      std::string chosen_proxy;
+      int merging_stripe = -1;
+      do
       {
-        if (t_stripe.blocks[i]->map2stripe == t_stripe_id)
+        wait_stripe_merged(merging_stripe);
+        merging_stripe = -1;
+        SharedLock t_lck(m_stripe_table_rwlock);
+        StripeShard &s_shard = stripe_shard(t_stripe_id);
+        std::unique_lock<RWMutex> s_lck(s_shard.rwlock);
+        Stripe &t_stripe = m_stripe_table.at(t_stripe_id);
+        if (stripe_merging(t_stripe_id))
         {
-          node_block.add_datanodeip(m_node_table[t_stripe.blocks[i]->map2node].node_ip);
-          node_block.add_datanodeport(m_node_table[t_stripe.blocks[i]->map2node].node_port);
-          node_block.add_blockkeys(t_stripe.blocks[i]->block_key);
-          t_cluster_set.insert(t_stripe.blocks[i]->map2cluster);
+          merging_stripe = t_stripe_id;
+          continue;
         }
-      }
-      node_block.set_stripe_id(t_stripe_id);
-      node_block.set_key("");
-      // randomly select a cluster
-      int idx = rand_num(int(t_cluster_set.size()));
-      int r_cluster_id = *(std::next(t_cluster_set.begin(), idx));
-      std::string chosen_proxy = m_cluster_table[r_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[r_cluster_id].proxy_port);
-      status = m_proxy_ptrs[chosen_proxy]->deleteBlock(&context, node_block, &del_reply);
+        s_shard.deleting.insert(t_stripe_id);
+        std::unordered_set<int> t_cluster_set;
+        for (int i = 0; i < int(t_stripe.blocks.size()); i++)
+        {
+          if (t_stripe.blocks[i]->map2stripe == t_stripe_id)
+          {
+            node_block.add_datanodeip(m_node_table[t_stripe.blocks[i]->map2node].node_ip);
+            node_block.add_datanodeport(m_node_table[t_stripe.blocks[i]->map2node].node_port);
+            node_block.add_blockkeys(t_stripe.blocks[i]->block_key());
+            t_cluster_set.insert(t_stripe.blocks[i]->map2cluster);
+          }
+        }
+        node_block.set_stripe_id(t_stripe_id);
+        node_block.set_key("");
+        // randomly select a cluster
+        int idx = rand_num(int(t_cluster_set.size()));
+        int r_cluster_id = *(std::next(t_cluster_set.begin(), idx));
+        chosen_proxy = m_cluster_table[r_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[r_cluster_id].proxy_port);
+      } while (merging_stripe >= 0);
       delReplyClient->set_ifdeling(true);
-      if (status.ok())
-      {
-        std::cout << "[DEL] deleting value of Stripe " << t_stripe_id << std::endl;
-      }
+      m_proxy_ptrs[chosen_proxy]->async()->deleteBlock(
+          &call->context, &call->request, &call->reply,
+          [call, reactor, t_stripe_id](grpc::Status status)
+          {
+            if (status.ok())
+            {
+              std::cout << "[DEL] deleting value of Stripe " << t_stripe_id << std::endl;
+            }
+            reactor->Finish(grpc::Status::OK);
+          });
+      return reactor;
     }
     catch (const std::exception &e)
     {
       std::cout << "deleteByStripe exception" << std::endl;
       std::cout << e.what() << std::endl;
     }
-    return grpc::Status::OK;
+    reactor->Finish(grpc::Status::OK);
+    return reactor;
   }
 
   grpc::Status CoordinatorImpl::listStripes(
@@ -328,6 +1414,7 @@ namespace ECProject
   {
     try
     {
+      SharedLock t_lck(m_stripe_table_rwlock);
       for (auto it = m_stripe_table.begin(); it != m_stripe_table.end(); it++)
       {
         listReplyClient->add_stripe_ids(it->first);
@@ -341,6 +1428,30 @@ namespace ECProject
     return grpc::Status::OK;
   }
 
+  grpc::Status CoordinatorImpl::reportNodeStatus(
+      grpc::ServerContext *context,
+      const coordinator_proto::NodeStatuses *statuses,
+      coordinator_proto::ReplyFromCoordinator *reply)
+  {
+    auto now = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lck(m_node_load_mutex);
+    for (int i = 0; i < statuses->nodes_size(); i++)
+    {
+      const coordinator_proto::NodeStatus &t_status = statuses->nodes(i);
+      auto it = m_node_ids.find(t_status.node_ip() + ":" + std::to_string(t_status.node_port()));
+      if (it == m_node_ids.end())
+      {
+        continue;
+      }
+      NodeLoad &load = m_node_loads[it->second];
+      load.free_bytes = t_status.free_bytes();
+      load.block_num = t_status.block_num();
+      load.io_bytes_per_sec = t_status.io_bytes_per_sec();
+      load.reported = now;
+    }
+    return grpc::Status::OK;
+  }
+
   grpc::Status CoordinatorImpl::checkalive(
       grpc::ServerContext *context,
       const coordinator_proto::RequestToCoordinator *helloRequestToCoordinator,
@@ -355,19 +1466,54 @@ namespace ECProject
       const coordinator_proto::CommitAbortKey *commit_abortkey,
       coordinator_proto::ReplyFromCoordinator *helloReplyFromCoordinator)
   {
-    std::string key = commit_abortkey->key();
-    ECProject::OpperateType opp = (ECProject::OpperateType)commit_abortkey->opp();
-    int stripe_id = commit_abortkey->stripe_id();
-    std::unique_lock<std::mutex> lck(m_mutex);
+    std::vector<PendingCheck> checks;
+    commit_abort(*commit_abortkey, checks);
+    finish_checks(checks);
+    return grpc::Status::OK;
+  }
+
+  // the reports of a batch share one sync of the metadata log
+  grpc::Status CoordinatorImpl::reportCommitAborts(
+      grpc::ServerContext *context,
+      const coordinator_proto::CommitAbortKeys *commit_abortkeys,
+      coordinator_proto::ReplyFromCoordinator *helloReplyFromCoordinator)
+  {
+    std::vector<PendingCheck> checks;
+    for (int i = 0; i < commit_abortkeys->keys_size(); i++)
+    {
+      commit_abort(commit_abortkeys->keys(i), checks);
+    }
+    finish_checks(checks);
+    return grpc::Status::OK;
+  }
+
+  // update the metadata as reported by a proxy, and move out the checks it satisfies
+  void CoordinatorImpl::commit_abort(const coordinator_proto::CommitAbortKey &commit_abortkey, std::vector<PendingCheck> &checks)
+  {
+    std::string key = commit_abortkey.key();
+    ECProject::OpperateType opp = (ECProject::OpperateType)commit_abortkey.opp();
+    int stripe_id = commit_abortkey.stripe_id();
     try
     {
-      if (commit_abortkey->ifcommitmetadata())
+      if (commit_abortkey.ifcommitmetadata())
       {
         if (opp == SET)
         {
-          m_object_commit_table[key] = m_object_updating_table[key];
-          cv.notify_all();
-          m_object_updating_table.erase(key);
+          int pack_id = -1;
+          {
+            ObjectShard &o_shard = object_shard(key);
+            std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+            o_shard.commit_table[key] = o_shard.updating_table[key];
+            m_meta_log.append(object_record(key, o_shard.commit_table[key]));
+            wake_object_checks(o_shard, key, checks);
+            pack_id = o_shard.commit_table[key].map2pack;
+            o_shard.updating_table.erase(key);
+          }
+          if (pack_id >= 0)
+          {
+            std::unique_lock<std::mutex> k_lck(m_pack_mutex);
+            m_pack_members[pack_id].insert(key);
+          }
         }
         else if (opp == DEL) // delete the metadata
         {
@@ -377,45 +1523,62 @@ namespace ECProject
             {
               std::cout << "[DEL] Proxy report delete key finish!" << std::endl;
             }
-            ObjectInfo object_info = m_object_commit_table.at(key);
-            stripe_id = object_info.map2stripe;
-            m_object_commit_table.erase(key); // update commit table
-            cv.notify_all();
-            m_object_updating_table.erase(key);
-            Stripe &t_stripe = m_stripe_table[stripe_id];
-            std::vector<Block *>::iterator it1;
-            for (it1 = t_stripe.blocks.begin(); it1 != t_stripe.blocks.end();)
+            bool empty_stripe = false;
+            // the blocks of a stripe being merged are still in the merge plan, freed once it is installed
+            int merging_stripe = -1;
+            do
             {
-              if ((*it1)->map2key == key)
+              wait_stripe_merged(merging_stripe);
+              merging_stripe = -1;
+              SharedLock t_lck(m_stripe_table_rwlock);
               {
-                it1 = t_stripe.blocks.erase(it1);
+                ObjectShard &o_shard = object_shard(key);
+                std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+                ObjectInfo object_info = o_shard.commit_table.at(key);
+                stripe_id = object_info.map2stripe;
+                if (stripe_merging(stripe_id))
+                {
+                  merging_stripe = stripe_id;
+                  continue;
+                }
+                o_shard.commit_table.erase(key); // update commit table
+                m_meta_log.append(del_object_record(key));
+                wake_object_checks(o_shard, key, checks);
+                o_shard.updating_table.erase(key);
               }
-              else
-              {
-                it1++;
-              }
-            }
-            if (t_stripe.blocks.empty()) // update stripe table
-            {
-              m_stripe_table.erase(stripe_id);
-            }
-            std::map<int, Cluster>::iterator it2; // update cluster table
-            for (it2 = m_cluster_table.begin(); it2 != m_cluster_table.end(); it2++)
-            {
-              Cluster &t_cluster = it2->second;
-              for (it1 = t_cluster.blocks.begin(); it1 != t_cluster.blocks.end();)
+              std::unique_lock<RWMutex> s_lck(stripe_shard(stripe_id).rwlock);
+              std::unique_lock<std::mutex> p_lck(m_placement_mutex);
+              Stripe &t_stripe = m_stripe_table.at(stripe_id);
+              std::vector<Block *>::iterator it1;
+              for (it1 = t_stripe.blocks.begin(); it1 != t_stripe.blocks.end();)
               {
-                if ((*it1)->map2key == key)
+                if ((*it1)->of_object(key))
                 {
-                  update_stripe_info_in_node(false, (*it1)->map2node, (*it1)->map2stripe); // update node table
-                  it1 = t_cluster.blocks.erase(it1);
+                  // update cluster table and node table
+                  update_stripe_info_in_node(false, (*it1)->map2node, (*it1)->map2stripe);
+                  remove_block_from_cluster((*it1)->map2cluster, *it1);
+                  m_block_arena.free(*it1);
+                  it1 = t_stripe.blocks.erase(it1);
                 }
                 else
                 {
                   it1++;
                 }
               }
+              empty_stripe = t_stripe.blocks.empty();
+              m_meta_log.append(stripe_record(t_stripe));
+            } while (merging_stripe >= 0);
+            if (empty_stripe) // update stripe table
+            {
+              std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+              auto its = m_stripe_table.find(stripe_id);
+              if (its != m_stripe_table.end() && its->second.blocks.empty())
+              {
+                m_stripe_table.erase(its);
+                m_meta_log.append(del_stripe_record(stripe_id));
+              }
             }
+            drop_pack_members(key, checks);
           } // delete stripe
           else
           {
@@ -423,52 +1586,60 @@ namespace ECProject
             {
               std::cout << "[DEL] Proxy report delete stripe finish!" << std::endl;
             }
-            auto its = std::find(m_stripe_deleting_table.begin(), m_stripe_deleting_table.end(), stripe_id);
-            if (its != m_stripe_deleting_table.end())
-            {
-              m_stripe_deleting_table.erase(its);
-            }
-            cv.notify_all();
-            // update stripe table
-            m_stripe_table.erase(stripe_id);
             std::unordered_set<std::string> object_keys_set;
-            // update cluster table
-            std::map<int, Cluster>::iterator it2;
-            for (it2 = m_cluster_table.begin(); it2 != m_cluster_table.end(); it2++)
+            int merging_stripe = -1;
+            do
             {
-              Cluster &t_cluster = it2->second;
-              for (auto it1 = t_cluster.blocks.begin(); it1 != t_cluster.blocks.end();)
+              wait_stripe_merged(merging_stripe);
+              merging_stripe = -1;
+              std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+              if (stripe_merging(stripe_id))
               {
-                if ((*it1)->map2stripe == stripe_id)
-                {
-                  object_keys_set.insert((*it1)->map2key);
-                  it1 = t_cluster.blocks.erase(it1);
-                }
-                else
+                merging_stripe = stripe_id;
+                continue;
+              }
+              std::unique_lock<std::mutex> p_lck(m_placement_mutex);
+              // update cluster table and node table, through the blocks of the stripe
+              Stripe &t_stripe = m_stripe_table[stripe_id];
+              for (auto it1 = t_stripe.blocks.begin(); it1 != t_stripe.blocks.end(); it1++)
+              {
+                if ((*it1)->map2key != nullptr)
                 {
-                  it1++;
+                  object_keys_set.insert(*(*it1)->map2key);
                 }
+                remove_block_from_cluster((*it1)->map2cluster, *it1);
+                m_node_table[(*it1)->map2node].stripes.erase(stripe_id);
+                m_block_arena.free(*it1);
               }
-            }
-            // update node table
-            for (auto it3 = m_node_table.begin(); it3 != m_node_table.end(); it3++)
-            {
-              Node &t_node = it3->second;
-              auto it4 = t_node.stripes.find(stripe_id);
-              if (it4 != t_node.stripes.end())
+              for (auto it2 = t_stripe.place2clusters.begin(); it2 != t_stripe.place2clusters.end(); it2++)
               {
-                t_node.stripes.erase(stripe_id);
+                m_cluster_table[*it2].stripes.erase(stripe_id);
               }
-            }
+              // update stripe table
+              m_stripe_table.erase(stripe_id);
+              m_meta_log.append(del_stripe_record(stripe_id));
+            } while (merging_stripe >= 0);
             // update commit table
             for (auto it5 = object_keys_set.begin(); it5 != object_keys_set.end(); it5++)
             {
-              auto it6 = m_object_commit_table.find(*it5);
-              if (it6 != m_object_commit_table.end())
-              {
-                m_object_commit_table.erase(it6);
-              }
+              ObjectShard &o_shard = object_shard(*it5);
+              std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+              o_shard.commit_table.erase(*it5);
+              m_meta_log.append(del_object_record(*it5));
+              wake_object_checks(o_shard, *it5, checks);
+            }
+            for (auto it5 = object_keys_set.begin(); it5 != object_keys_set.end(); it5++)
+            {
+              drop_pack_members(*it5, checks);
             }
+            StripeShard &s_shard = stripe_shard(stripe_id);
+            {
+              std::unique_lock<std::mutex> a_lck(s_shard.access_mutex);
+              s_shard.access.erase(stripe_id);
+            }
+            std::unique_lock<RWMutex> s_lck(s_shard.rwlock);
+            s_shard.deleting.erase(stripe_id);
+            wake_stripe_checks(s_shard, stripe_id, checks);
             // merge group
           }
           // if (IF_DEBUG)
@@ -482,7 +1653,7 @@ namespace ECProject
           //       std::cout << "Cluster " << i << ": ";
           //       for (auto it = t_cluster.blocks.begin(); it != t_cluster.blocks.end(); it++)
           //       {
-          //         std::cout << "[" << (*it)->block_key << ":S" << (*it)->map2stripe << "G" << (*it)->map2group << "N" << (*it)->map2node << "] ";
+          //         std::cout << "[" << (*it)->block_key() << ":S" << (*it)->map2stripe << "G" << (*it)->map2group << "N" << (*it)->map2node << "] ";
           //       }
           //       std::cout << std::endl;
           //     }
@@ -493,7 +1664,9 @@ namespace ECProject
       }
       else
       {
-        m_object_updating_table.erase(key);
+        ObjectShard &o_shard = object_shard(key);
+        std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+        o_shard.updating_table.erase(key);
       }
     }
     catch (std::exception &e)
@@ -501,224 +1674,987 @@ namespace ECProject
       std::cout << "reportCommitAbort exception" << std::endl;
       std::cout << e.what() << std::endl;
     }
-    return grpc::Status::OK;
   }
 
-  grpc::Status
-  CoordinatorImpl::checkCommitAbort(grpc::ServerContext *context,
+  // answered at once if the operation is over, otherwise parked until reportCommitAbort finishes it
+  grpc::ServerUnaryReactor *
+  CoordinatorImpl::checkCommitAbort(grpc::CallbackServerContext *context,
                                     const coordinator_proto::AskIfSuccess *key_opp,
                                     coordinator_proto::RepIfSuccess *reply)
   {
-    std::unique_lock<std::mutex> lck(m_mutex);
-    std::string key = key_opp->key();
-    ECProject::OpperateType opp = (ECProject::OpperateType)key_opp->opp();
-    int stripe_id = key_opp->stripe_id();
-    if (opp == SET)
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
+    std::vector<PendingCheck> checks;
+    park_check(*key_opp, [reactor, reply]()
+               {
+                 reply->set_ifcommit(true);
+                 reactor->Finish(grpc::Status::OK); },
+               checks);
+    finish_checks(checks);
+    return reactor;
+  }
+
+  // answered once every operation of the batch is over
+  grpc::ServerUnaryReactor *
+  CoordinatorImpl::checkCommitAborts(grpc::CallbackServerContext *context,
+                                     const coordinator_proto::AskIfSuccessBatch *key_opps,
+                                     coordinator_proto::RepIfSuccess *reply)
+  {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
+    // one more for parking them all, so that the reply is not sent while parking
+    std::shared_ptr<std::atomic<int>> pending = std::make_shared<std::atomic<int>>(key_opps->asks_size() + 1);
+    std::function<void()> done = [reactor, reply, pending]()
     {
-      while (m_object_commit_table.find(key) == m_object_commit_table.end())
+      if (--(*pending) == 0)
       {
-        cv.wait(lck);
+        reply->set_ifcommit(true);
+        reactor->Finish(grpc::Status::OK);
       }
+    };
+    std::vector<PendingCheck> checks;
+    for (int i = 0; i < key_opps->asks_size(); i++)
+    {
+      park_check(key_opps->asks(i), done, checks);
+    }
+    finish_checks(checks);
+    done();
+    return reactor;
+  }
+
+  // the check goes to checks if the operation is over, otherwise it is parked on its key or stripe
+  void CoordinatorImpl::park_check(const coordinator_proto::AskIfSuccess &key_opp, std::function<void()> done,
+                                   std::vector<PendingCheck> &checks)
+  {
+    PendingCheck check;
+    check.key = key_opp.key();
+    check.opp = (ECProject::OpperateType)key_opp.opp();
+    check.stripe_id = key_opp.stripe_id();
+    check.done = done;
+    if (check.opp == DEL && check.stripe_id >= 0)
+    {
+      StripeShard &s_shard = stripe_shard(check.stripe_id);
+      std::unique_lock<RWMutex> s_lck(s_shard.rwlock);
+      s_shard.waiters[check.stripe_id].push_back(check);
+      wake_stripe_checks(s_shard, check.stripe_id, checks);
+    }
+    else if (check.opp == SET || check.opp == DEL)
+    {
+      ObjectShard &o_shard = object_shard(check.key);
+      std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+      o_shard.waiters[check.key].push_back(check);
+      wake_object_checks(o_shard, check.key, checks);
+    }
+    else
+    {
+      checks.push_back(check);
+    }
+  }
+
+  ObjectShard &CoordinatorImpl::object_shard(const std::string &key)
+  {
+    return m_object_shards[std::hash<std::string>()(key) % METADATA_SHARD_NUM];
+  }
+
+  StripeShard &CoordinatorImpl::stripe_shard(int stripe_id)
+  {
+    return m_stripe_shards[stripe_id % METADATA_SHARD_NUM];
+  }
+
+  // only the checks parked on the key are looked at
+  void CoordinatorImpl::wake_object_checks(ObjectShard &o_shard, const std::string &key, std::vector<PendingCheck> &checks)
+  {
+    auto it_w = o_shard.waiters.find(key);
+    if (it_w == o_shard.waiters.end())
+    {
+      return;
     }
-    else if (opp == DEL)
+    bool committed = o_shard.commit_table.find(key) != o_shard.commit_table.end();
+    std::vector<PendingCheck> &t_waiters = it_w->second;
+    for (auto it = t_waiters.begin(); it != t_waiters.end();)
     {
-      if (stripe_id < 0)
+      if ((it->opp == SET && committed) || (it->opp == DEL && !committed))
       {
-        while (m_object_commit_table.find(key) != m_object_commit_table.end())
-        {
-          cv.wait(lck);
-        }
+        checks.push_back(*it);
+        it = t_waiters.erase(it);
       }
       else
       {
-        auto it = std::find(m_stripe_deleting_table.begin(), m_stripe_deleting_table.end(), stripe_id);
-        while (it != m_stripe_deleting_table.end())
-        {
-          cv.wait(lck);
-          it = std::find(m_stripe_deleting_table.begin(), m_stripe_deleting_table.end(), stripe_id);
-        }
+        it++;
       }
     }
-    reply->set_ifcommit(true);
-    return grpc::Status::OK;
+    if (t_waiters.empty())
+    {
+      o_shard.waiters.erase(it_w);
+    }
   }
 
-  bool CoordinatorImpl::init_proxyinfo()
+  void CoordinatorImpl::wake_stripe_checks(StripeShard &s_shard, int stripe_id, std::vector<PendingCheck> &checks)
   {
-    for (auto cur = m_cluster_table.begin(); cur != m_cluster_table.end(); cur++)
+    auto it_w = s_shard.waiters.find(stripe_id);
+    if (it_w == s_shard.waiters.end() || s_shard.deleting.count(stripe_id))
     {
-      std::string proxy_ip_and_port = cur->second.proxy_ip + ":" + std::to_string(cur->second.proxy_port);
-      auto _stub = proxy_proto::proxyService::NewStub(grpc::CreateChannel(proxy_ip_and_port, grpc::InsecureChannelCredentials()));
-      proxy_proto::CheckaliveCMD Cmd;
-      proxy_proto::RequestResult result;
-      grpc::ClientContext clientContext;
-      Cmd.set_name("coordinator");
-      grpc::Status status;
-      status = _stub->checkalive(&clientContext, Cmd, &result);
-      if (status.ok())
+      return;
+    }
+    checks.insert(checks.end(), it_w->second.begin(), it_w->second.end());
+    s_shard.waiters.erase(it_w);
+  }
+
+  void CoordinatorImpl::set_stripes_merging(const std::vector<int> &stripe_ids, bool merging)
+  {
+    std::unique_lock<std::mutex> lck(m_merging_mutex);
+    for (auto it = stripe_ids.begin(); it != stripe_ids.end(); it++)
+    {
+      if (merging)
       {
-        std::cout << "[Proxy Check] ok from " << proxy_ip_and_port << std::endl;
+        m_merging_stripes.insert(*it);
       }
       else
       {
-        std::cout << "[Proxy Check] failed to connect " << proxy_ip_and_port << std::endl;
+        m_merging_stripes.erase(*it);
       }
-      m_proxy_ptrs.insert(std::make_pair(proxy_ip_and_port, std::move(_stub)));
     }
-    return true;
+    if (!merging)
+    {
+      m_merging_cv.notify_all();
+    }
   }
-  bool CoordinatorImpl::init_clusterinfo(std::string m_clusterinfo_path)
+
+  bool CoordinatorImpl::stripe_deleting(int stripe_id)
   {
-    std::cout << "Cluster_information_path:" << m_clusterinfo_path << std::endl;
-    tinyxml2::XMLDocument xml;
-    xml.LoadFile(m_clusterinfo_path.c_str());
-    tinyxml2::XMLElement *root = xml.RootElement();
-    int node_id = 0;
-    m_num_of_Clusters = 0;
-    for (tinyxml2::XMLElement *cluster = root->FirstChildElement(); cluster != nullptr; cluster = cluster->NextSiblingElement())
+    StripeShard &s_shard = stripe_shard(stripe_id);
+    SharedLock s_lck(s_shard.rwlock);
+    return s_shard.deleting.count(stripe_id) > 0;
+  }
+
+  bool CoordinatorImpl::stripe_merging(int stripe_id)
+  {
+    std::unique_lock<std::mutex> lck(m_merging_mutex);
+    return m_merging_stripes.count(stripe_id) > 0;
+  }
+
+  // the caller looks the stripe up again afterwards, its objects may have moved to the merged stripe
+  void CoordinatorImpl::wait_stripe_merged(int stripe_id)
+  {
+    if (stripe_id < 0)
     {
-      std::string cluster_id(cluster->Attribute("id"));
-      std::string proxy(cluster->Attribute("proxy"));
-      std::cout << "cluster_id: " << cluster_id << " , proxy: " << proxy << std::endl;
-      Cluster t_cluster;
-      m_cluster_table[std::stoi(cluster_id)] = t_cluster;
-      m_cluster_table[std::stoi(cluster_id)].cluster_id = std::stoi(cluster_id);
-      auto pos = proxy.find(':');
-      m_cluster_table[std::stoi(cluster_id)].proxy_ip = proxy.substr(0, pos);
-      m_cluster_table[std::stoi(cluster_id)].proxy_port = std::stoi(proxy.substr(pos + 1, proxy.size()));
-      for (tinyxml2::XMLElement *node = cluster->FirstChildElement()->FirstChildElement(); node != nullptr; node = node->NextSiblingElement())
+      return;
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << "[MERGE] waiting for Stripe" << stripe_id << " to be merged" << std::endl;
+    }
+    std::unique_lock<std::mutex> lck(m_merging_mutex);
+    m_merging_cv.wait(lck, [this, stripe_id]()
+                      { return m_merging_stripes.count(stripe_id) == 0; });
+  }
+
+  // the changes are acknowledged once their records are durable
+  void CoordinatorImpl::finish_checks(std::vector<PendingCheck> &checks)
+  {
+    if (checks.empty())
+    {
+      return;
+    }
+    m_meta_log.sync();
+    for (auto it = checks.begin(); it != checks.end(); it++)
+    {
+      it->done();
+    }
+  }
+
+  grpc::ClientContext *ProxyFanout::context()
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    m_contexts.emplace_back();
+    return &m_contexts.back();
+  }
+
+  // the callback of a call issued asynchronously, counted until it runs
+  std::function<void(grpc::Status)> ProxyFanout::done(const std::string &proxy)
+  {
+    std::unique_lock<std::mutex> lck(m_mutex);
+    m_pending++;
+    return [this, proxy](grpc::Status status)
+    {
+      if (!status.ok())
       {
-        std::string node_uri(node->Attribute("uri"));
-        std::cout << "____node: " << node_uri << std::endl;
-        m_cluster_table[std::stoi(cluster_id)].nodes.push_back(node_id);
-        m_node_table[node_id].node_id = node_id;
-        auto pos = node_uri.find(':');
-        m_node_table[node_id].node_ip = node_uri.substr(0, pos);
-        m_node_table[node_id].node_port = std::stoi(node_uri.substr(pos + 1, node_uri.size()));
-        m_node_table[node_id].cluster_id = std::stoi(cluster_id);
-        node_id++;
+        std::cout << "[PROXY] call to " << proxy << " failed: " << status.error_message() << std::endl;
       }
-      m_num_of_Clusters++;
-    }
-    return true;
+      std::unique_lock<std::mutex> lck(m_mutex);
+      m_pending--;
+      m_cv.notify_all();
+    };
   }
 
-  int CoordinatorImpl::randomly_select_a_cluster(int stripe_id)
+  void ProxyFanout::wait()
   {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> dis_cluster(0, m_num_of_Clusters - 1);
-    int r_cluster_id = dis_cluster(gen);
-    while (m_cluster_table[r_cluster_id].stripes.find(stripe_id) != m_cluster_table[r_cluster_id].stripes.end())
+    std::unique_lock<std::mutex> lck(m_mutex);
+    while (m_pending > 0)
     {
-      r_cluster_id = dis_cluster(gen);
+      m_cv.wait(lck);
     }
-    return r_cluster_id;
   }
 
-  int CoordinatorImpl::randomly_select_a_node(int cluster_id, int stripe_id)
+  std::string CoordinatorImpl::parameter_record()
   {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> dis_node(0, m_cluster_table[cluster_id].nodes.size() - 1);
-    int r_node_id = m_cluster_table[cluster_id].nodes[dis_node(gen)];
-    while (m_node_table[r_node_id].stripes.find(stripe_id) != m_node_table[r_node_id].stripes.end())
+    std::string record;
+    put_int(record, META_PARAMETER);
+    put_int(record, int(m_encode_parameters.partial_decoding));
+    put_int(record, int(m_encode_parameters.encodetype));
+    put_int(record, int(m_encode_parameters.s_stripe_placementtype));
+    put_int(record, int(m_encode_parameters.m_stripe_placementtype));
+    put_int(record, m_encode_parameters.k_datablock);
+    put_int(record, m_encode_parameters.l_localparityblock);
+    put_int(record, m_encode_parameters.g_m_globalparityblock);
+    put_int(record, m_encode_parameters.b_datapergroup);
+    put_int(record, m_encode_parameters.x_stripepermergegroup);
+    put_int(record, m_encode_parameters.pack_block_size);
+    return record;
+  }
+
+  // the cursors of the placement schemes
+  std::string CoordinatorImpl::counters_record()
+  {
+    std::string record;
+    put_int(record, META_COUNTERS);
+    put_int(record, m_cur_stripe_id);
+    put_int(record, m_cur_cluster_id);
+    put_int(record, m_agg_start_cid);
+    put_int(record, int(m_free_clusters.size()));
+    for (auto it = m_free_clusters.begin(); it != m_free_clusters.end(); it++)
     {
-      r_node_id = m_cluster_table[cluster_id].nodes[dis_node(gen)];
+      put_int(record, *it);
     }
-    return r_node_id;
+    return record;
   }
 
-  void CoordinatorImpl::update_stripe_info_in_node(bool add_or_sub, int t_node_id, int stripe_id)
+  std::string CoordinatorImpl::merge_groups_record()
   {
-    int stripe_block_num = 1;
-    if (m_node_table[t_node_id].stripes.find(stripe_id) != m_node_table[t_node_id].stripes.end())
+    std::string record;
+    put_int(record, META_MERGE_GROUPS);
+    put_int(record, m_merge_degree);
+    put_int(record, int(m_merge_groups.size()));
+    for (auto it_g = m_merge_groups.begin(); it_g != m_merge_groups.end(); it_g++)
     {
-      stripe_block_num = m_node_table[t_node_id].stripes[stripe_id];
+      put_int(record, int(it_g->size()));
+      for (auto it_s = it_g->begin(); it_s != it_g->end(); it_s++)
+      {
+        put_int(record, *it_s);
+      }
     }
-    if (add_or_sub)
+    return record;
+  }
+
+  // the merge group a newly placed stripe joined, -1 for none
+  std::string CoordinatorImpl::group_append_record(int stripe_id)
+  {
+    int group_idx = -1;
+    if (!m_merge_groups.empty() && !m_merge_groups.back().empty() && m_merge_groups.back().back() == stripe_id)
     {
-      m_node_table[t_node_id].stripes[stripe_id] = stripe_block_num + 1;
+      group_idx = int(m_merge_groups.size()) - 1;
     }
-    else
+    std::string record;
+    put_int(record, META_GROUP_APPEND);
+    put_int(record, stripe_id);
+    put_int(record, group_idx);
+    return record;
+  }
+
+  // the blocks refer to the keys of the stripe by index, the blocks of no object by -1
+  std::string CoordinatorImpl::stripe_record(const Stripe &stripe)
+  {
+    std::vector<std::string> keys(stripe.object_keys);
+    std::unordered_map<const std::string *, int> key_idx;
+    std::vector<int> block_key_idx;
+    for (auto it = stripe.blocks.begin(); it != stripe.blocks.end(); it++)
     {
-      if (stripe_block_num == 1)
+      const std::string *t_key = (*it)->map2key;
+      if (t_key == nullptr)
       {
-        m_node_table[t_node_id].stripes.erase(stripe_id);
+        block_key_idx.push_back(-1);
+        continue;
       }
-      else
+      auto it_k = key_idx.find(t_key);
+      if (it_k == key_idx.end())
       {
-        m_node_table[t_node_id].stripes[stripe_id] = stripe_block_num - 1;
+        int idx = int(std::find(keys.begin(), keys.end(), *t_key) - keys.begin());
+        if (idx == int(keys.size()))
+        {
+          keys.push_back(*t_key);
+        }
+        it_k = key_idx.insert(std::make_pair(t_key, idx)).first;
       }
+      block_key_idx.push_back(it_k->second);
+    }
+    std::string record;
+    put_int(record, META_PUT_STRIPE);
+    put_int(record, stripe.stripe_id);
+    put_int(record, stripe.k);
+    put_int(record, stripe.l);
+    put_int(record, stripe.g_m);
+    put_int(record, int(stripe.object_keys.size()));
+    put_int(record, int(keys.size()));
+    for (auto it = keys.begin(); it != keys.end(); it++)
+    {
+      put_str(record, *it);
+    }
+    for (auto it = stripe.object_sizes.begin(); it != stripe.object_sizes.end(); it++)
+    {
+      put_int(record, *it);
+    }
+    put_int(record, int(stripe.place2clusters.size()));
+    for (auto it = stripe.place2clusters.begin(); it != stripe.place2clusters.end(); it++)
+    {
+      put_int(record, *it);
+    }
+    put_int(record, int(stripe.blocks.size()));
+    for (int i = 0; i < int(stripe.blocks.size()); i++)
+    {
+      Block *t_block = stripe.blocks[i];
+      put_int(record, t_block->block_id);
+      put_int(record, t_block->key_stripe);
+      put_int(record, t_block->key_index);
+      put_int(record, int(t_block->block_type));
+      put_int(record, t_block->block_size);
+      put_int(record, t_block->map2group);
+      put_int(record, t_block->map2cluster);
+      put_int(record, t_block->map2node);
+      put_int(record, block_key_idx[i]);
     }
+    return record;
   }
 
-  int CoordinatorImpl::generate_placement(int stripe_id, int block_size)
+  std::string CoordinatorImpl::del_stripe_record(int stripe_id)
   {
-    Stripe &stripe_info = m_stripe_table[stripe_id];
-    int k = stripe_info.k;
-    int l = stripe_info.l;
-    int g_m = stripe_info.g_m;
-    int b = m_encode_parameters.b_datapergroup;
-    ECProject::EncodeType encode_type = m_encode_parameters.encodetype;
-    ECProject::SingleStripePlacementType s_placement_type = m_encode_parameters.s_stripe_placementtype;
-    ECProject::MultiStripesPlacementType m_placement_type = m_encode_parameters.m_stripe_placementtype;
+    std::string record;
+    put_int(record, META_DEL_STRIPE);
+    put_int(record, stripe_id);
+    return record;
+  }
 
-    // generate stripe information
-    int index = stripe_info.object_keys.size() - 1;
-    std::string object_key = stripe_info.object_keys[index];
-    Block *blocks_info = new Block[k + g_m + l];
-    for (int i = 0; i < k + g_m + l; i++)
+  std::string CoordinatorImpl::object_record(const std::string &key, const ObjectInfo &object_info)
+  {
+    std::string record;
+    put_int(record, META_PUT_OBJECT);
+    put_str(record, key);
+    put_int(record, object_info.object_size);
+    put_int(record, object_info.map2stripe);
+    put_int(record, object_info.map2pack + 1); // 0 for none, as read past the end of an older record
+    put_int(record, object_info.offset);
+    return record;
+  }
+
+  std::string CoordinatorImpl::del_object_record(const std::string &key)
+  {
+    std::string record;
+    put_int(record, META_DEL_OBJECT);
+    put_str(record, key);
+    return record;
+  }
+
+  // with the stripe table locked exclusively, the cluster and node tables are rebuilt once the replay is over
+  void CoordinatorImpl::apply_metadata_record(const char *data, int len)
+  {
+    MetaReader in(data, len);
+    int type = in.get_int();
+    if (type == META_PARAMETER)
     {
-      blocks_info[i].block_size = block_size;
-      blocks_info[i].map2stripe = stripe_id;
-      blocks_info[i].map2key = object_key;
-      if (i < k)
+      ECSchema system_metadata;
+      system_metadata.partial_decoding = in.get_int() != 0;
+      system_metadata.encodetype = (ECProject::EncodeType)in.get_int();
+      system_metadata.s_stripe_placementtype = (ECProject::SingleStripePlacementType)in.get_int();
+      system_metadata.m_stripe_placementtype = (ECProject::MultiStripesPlacementType)in.get_int();
+      system_metadata.k_datablock = in.get_int();
+      system_metadata.l_localparityblock = in.get_int();
+      system_metadata.g_m_globalparityblock = in.get_int();
+      system_metadata.b_datapergroup = in.get_int();
+      system_metadata.x_stripepermergegroup = in.get_int();
+      system_metadata.pack_block_size = in.get_int();
+      m_encode_parameters = system_metadata;
+      m_parameters_set = true;
+      reset_metadata();
+    }
+    else if (type == META_PUT_STRIPE || type == META_DEL_STRIPE)
+    {
+      int stripe_id = in.get_int();
+      auto its = m_stripe_table.find(stripe_id);
+      if (its != m_stripe_table.end())
+      {
+        for (auto itb = its->second.blocks.begin(); itb != its->second.blocks.end(); itb++)
+        {
+          m_block_arena.free(*itb);
+        }
+        m_stripe_table.erase(its);
+      }
+      if (type == META_DEL_STRIPE)
       {
-        std::string tmp = "_D";
-        if (i < 10)
-          tmp = "_D0";
-        blocks_info[i].block_key = object_key + tmp + std::to_string(i);
-        blocks_info[i].block_id = i;
-        blocks_info[i].block_type = 'D';
-        blocks_info[i].map2group = int(i / b);
-        stripe_info.blocks.push_back(&blocks_info[i]);
+        return;
       }
-      else if (i >= k && i < k + g_m)
+      Stripe &t_stripe = m_stripe_table[stripe_id];
+      t_stripe.stripe_id = stripe_id;
+      t_stripe.k = in.get_int();
+      t_stripe.l = in.get_int();
+      t_stripe.g_m = in.get_int();
+      int num_of_objects = in.get_int();
+      int num_of_keys = in.get_int();
+      std::vector<std::string> keys;
+      for (int i = 0; i < num_of_keys; i++)
       {
-        blocks_info[i].block_key = "Stripe" + std::to_string(stripe_id) + "_G" + std::to_string(i - k);
-        blocks_info[i].block_id = i;
-        blocks_info[i].block_type = 'G';
-        blocks_info[i].map2group = l;
-        stripe_info.blocks.push_back(&blocks_info[i]);
+        keys.push_back(in.get_str());
       }
-      else
+      for (int i = 0; i < num_of_objects && i < num_of_keys; i++)
+      {
+        t_stripe.object_keys.push_back(keys[i]);
+        t_stripe.object_sizes.push_back(in.get_int());
+      }
+      int num_of_clusters = in.get_int();
+      for (int i = 0; i < num_of_clusters; i++)
+      {
+        t_stripe.place2clusters.insert(in.get_int());
+      }
+      int num_of_blocks = in.get_int();
+      for (int i = 0; i < num_of_blocks; i++)
       {
-        blocks_info[i].block_key = "Stripe" + std::to_string(stripe_id) + "_L" + std::to_string(i - k - g_m);
-        blocks_info[i].block_id = i;
-        blocks_info[i].block_type = 'L';
-        blocks_info[i].map2group = i - k - g_m;
-        stripe_info.blocks.push_back(&blocks_info[i]);
+        int block_id = in.get_int();
+        int key_stripe = in.get_int();
+        int key_index = in.get_int();
+        char block_type = char(in.get_int());
+        int block_size = in.get_int();
+        int map2group = in.get_int();
+        int map2cluster = in.get_int();
+        int map2node = in.get_int();
+        int key_idx = in.get_int();
+        const std::string *map2key = nullptr;
+        if (key_idx >= 0 && key_idx < num_of_keys)
+        {
+          map2key = m_block_arena.intern_key(keys[key_idx]);
+        }
+        t_stripe.blocks.push_back(m_block_arena.alloc(Block(block_id, key_stripe, key_index, block_type, block_size, map2group,
+                                                            stripe_id, map2cluster, map2node, map2key)));
+      }
+      if (m_cur_stripe_id <= stripe_id)
+      {
+        m_cur_stripe_id = stripe_id + 1;
       }
     }
-
-    if (encode_type == Azure_LRC || encode_type == Optimal_Cauchy_LRC)
+    else if (type == META_PUT_OBJECT)
     {
-      if (s_placement_type == Optimal)
+      std::string key = in.get_str();
+      ObjectInfo object_info;
+      object_info.object_size = in.get_int();
+      object_info.map2stripe = in.get_int();
+      object_info.map2pack = in.get_int() - 1;
+      object_info.offset = in.get_int();
+      object_shard(key).commit_table[key] = object_info;
+    }
+    else if (type == META_DEL_OBJECT)
+    {
+      std::string key = in.get_str();
+      object_shard(key).commit_table.erase(key);
+    }
+    else if (type == META_GROUP_APPEND)
+    {
+      int stripe_id = in.get_int();
+      int group_idx = in.get_int();
+      // replayed over a snapshot taken after it, the stripe is already in its group
+      if (group_idx == int(m_merge_groups.size()))
       {
-        if (m_placement_type == Ran)
+        m_merge_groups.push_back(std::vector<int>(1, stripe_id));
+      }
+      else if (group_idx >= 0 && group_idx < int(m_merge_groups.size()) &&
+               std::find(m_merge_groups[group_idx].begin(), m_merge_groups[group_idx].end(), stripe_id) == m_merge_groups[group_idx].end())
+      {
+        m_merge_groups[group_idx].push_back(stripe_id);
+      }
+    }
+    else if (type == META_MERGE_GROUPS)
+    {
+      m_merge_degree = in.get_int();
+      m_merge_groups.assign(in.get_int(), std::vector<int>());
+      for (auto it_g = m_merge_groups.begin(); it_g != m_merge_groups.end(); it_g++)
+      {
+        int num_of_stripes = in.get_int();
+        for (int i = 0; i < num_of_stripes; i++)
         {
-          int idx = m_merge_groups.size() - 1;
-          if (idx < 0 || int(m_merge_groups[idx].size()) == m_encode_parameters.x_stripepermergegroup)
-          {
-            std::vector<int> temp;
-            temp.push_back(stripe_id);
-            m_merge_groups.push_back(temp);
-          }
-          else
-          {
-            m_merge_groups[idx].push_back(stripe_id);
-          }
+          it_g->push_back(in.get_int());
+        }
+      }
+    }
+    else if (type == META_COUNTERS)
+    {
+      int cur_stripe_id = in.get_int();
+      if (m_cur_stripe_id < cur_stripe_id)
+      {
+        m_cur_stripe_id = cur_stripe_id;
+      }
+      m_cur_cluster_id = in.get_int();
+      m_agg_start_cid = in.get_int();
+      m_free_clusters.assign(in.get_int(), 0);
+      for (auto it = m_free_clusters.begin(); it != m_free_clusters.end(); it++)
+      {
+        *it = in.get_int();
+      }
+    }
+  }
+
+  // the blocks and stripes of each cluster and node, from the blocks of the stripes
+  void CoordinatorImpl::rebuild_cluster_index()
+  {
+    for (auto it = m_cluster_table.begin(); it != m_cluster_table.end(); it++)
+    {
+      Cluster &t_cluster = it->second;
+      t_cluster.blocks.clear();
+      t_cluster.block_pos.clear();
+      t_cluster.stripe_blocks.clear();
+      t_cluster.stripes.clear();
+    }
+    for (auto it = m_node_table.begin(); it != m_node_table.end(); it++)
+    {
+      it->second.stripes.clear();
+    }
+    for (auto its = m_stripe_table.begin(); its != m_stripe_table.end(); its++)
+    {
+      for (auto itb = its->second.blocks.begin(); itb != its->second.blocks.end(); itb++)
+      {
+        add_block_to_cluster(*itb);
+        update_stripe_info_in_node(true, (*itb)->map2node, its->first);
+      }
+      for (auto itc = its->second.place2clusters.begin(); itc != its->second.place2clusters.end(); itc++)
+      {
+        m_cluster_table[*itc].stripes.insert(its->first);
+      }
+    }
+  }
+
+  // load the latest snapshot and replay the logs after it, then keep logging to dir
+  bool CoordinatorImpl::recover_metadata(const std::string &dir)
+  {
+    struct timeval start_time, end_time;
+    gettimeofday(&start_time, NULL);
+    m_metadata_dir = dir;
+    if (mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST)
+    {
+      std::cerr << "[META] failed to create " << dir << std::endl;
+      return false;
+    }
+    long long valid_bytes = 0;
+    bool has_previous = false;
+    int num_of_stripes = 0;
+    {
+      std::unique_lock<std::mutex> k_lck(m_pack_mutex);
+      std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+      std::unique_lock<std::mutex> p_lck(m_placement_mutex);
+      auto apply = [this](const char *data, int len)
+      {
+        apply_metadata_record(data, len);
+      };
+      MetadataLog::replay(dir + "/meta.snapshot", apply);
+      // a checkpoint was cut short, the snapshot may be older than the previous log
+      has_previous = MetadataLog::replay(dir + "/meta.log.prev", apply) >= 0;
+      valid_bytes = std::max(MetadataLog::replay(dir + "/meta.log", apply), 0LL);
+      rebuild_cluster_index();
+      // the committed objects of each pack
+      for (int i = 0; i < METADATA_SHARD_NUM; i++)
+      {
+        for (auto ito = m_object_shards[i].commit_table.begin(); ito != m_object_shards[i].commit_table.end(); ito++)
+        {
+          if (ito->second.map2pack >= 0)
+          {
+            m_pack_members[ito->second.map2pack].insert(ito->first);
+          }
+        }
+      }
+      num_of_stripes = int(m_stripe_table.size());
+    }
+    if (has_previous)
+    {
+      checkpoint_metadata();
+    }
+    if (!m_meta_log.open(dir, valid_bytes))
+    {
+      return false;
+    }
+    gettimeofday(&end_time, NULL);
+    double time = end_time.tv_sec - start_time.tv_sec + (end_time.tv_usec - start_time.tv_usec) * 1.0 / 1000000;
+    std::cout << "[META] recovered " << num_of_stripes << " stripes from " << dir << " in " << time << "s" << std::endl;
+    return true;
+  }
+
+  // snapshot the metadata and start a new log, the metadata is locked only while it is copied out,
+  // the previous log is dropped once the snapshot is durable
+  void CoordinatorImpl::checkpoint_metadata()
+  {
+    std::unique_lock<std::mutex> c_lck(m_checkpoint_mutex);
+    if (m_metadata_dir.empty())
+    {
+      return;
+    }
+    std::string path = m_metadata_dir + "/meta.snapshot";
+    int fd = ::open((path + ".tmp").c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+      std::cerr << "[META] failed to create the snapshot in " << m_metadata_dir << std::endl;
+      return;
+    }
+    bool ok = true;
+    std::string buf;
+    auto write_out = [&fd, &buf, &ok]()
+    {
+      size_t offset = 0;
+      while (ok && offset < buf.size())
+      {
+        ssize_t n = ::write(fd, buf.data() + offset, buf.size() - offset);
+        if (n < 0 && errno != EINTR)
+        {
+          ok = false;
+        }
+        else if (n > 0)
+        {
+          offset += n;
+        }
+      }
+      buf.clear();
+    };
+    auto emit = [&buf, &write_out](const std::string &record)
+    {
+      MetadataLog::frame(buf, record);
+      if (buf.size() >= (1 << 20))
+      {
+        write_out();
+      }
+    };
+    {
+      std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+      std::vector<std::unique_lock<RWMutex>> o_lcks;
+      for (int i = 0; i < METADATA_SHARD_NUM; i++)
+      {
+        o_lcks.push_back(std::unique_lock<RWMutex>(m_object_shards[i].rwlock));
+      }
+      emit(parameter_record());
+      emit(counters_record());
+      emit(merge_groups_record());
+      for (auto its = m_stripe_table.begin(); its != m_stripe_table.end(); its++)
+      {
+        emit(stripe_record(its->second));
+      }
+      for (int i = 0; i < METADATA_SHARD_NUM; i++)
+      {
+        for (auto ito = m_object_shards[i].commit_table.begin(); ito != m_object_shards[i].commit_table.end(); ito++)
+        {
+          emit(object_record(ito->first, ito->second));
+        }
+      }
+      write_out();
+      ok = m_meta_log.rotate() && ok;
+    }
+    ok = ok && fsync(fd) == 0;
+    ::close(fd);
+    if (!ok || std::rename((path + ".tmp").c_str(), path.c_str()) != 0)
+    {
+      std::cerr << "[META] failed to write the snapshot in " << m_metadata_dir << std::endl;
+      return;
+    }
+    int dir_fd = ::open(m_metadata_dir.c_str(), O_RDONLY);
+    if (dir_fd >= 0)
+    {
+      fsync(dir_fd);
+      ::close(dir_fd);
+    }
+    unlink((m_metadata_dir + "/meta.log.prev").c_str());
+  }
+
+  // snapshot the metadata once enough records are logged, so that a restart replays a short log
+  void CoordinatorImpl::metadata_checkpointer()
+  {
+    std::unique_lock<std::mutex> lck(m_job_mutex);
+    while (!m_stop_merge_workers)
+    {
+      m_job_cv.wait_for(lck, std::chrono::milliseconds(METADATA_CHECK_INTERVAL_MS));
+      if (m_stop_merge_workers)
+      {
+        return;
+      }
+      if (!m_meta_log.is_open() || m_meta_log.records_since_rotate() < METADATA_SNAPSHOT_RECORDS)
+      {
+        continue;
+      }
+      lck.unlock();
+      checkpoint_metadata();
+      lck.lock();
+    }
+  }
+
+  bool CoordinatorImpl::init_proxyinfo()
+  {
+    for (auto cur = m_cluster_table.begin(); cur != m_cluster_table.end(); cur++)
+    {
+      std::string proxy_ip_and_port = cur->second.proxy_ip + ":" + std::to_string(cur->second.proxy_port);
+      auto _stub = proxy_proto::proxyService::NewStub(grpc::CreateChannel(proxy_ip_and_port, grpc::InsecureChannelCredentials()));
+      proxy_proto::CheckaliveCMD Cmd;
+      proxy_proto::RequestResult result;
+      grpc::ClientContext clientContext;
+      Cmd.set_name("coordinator");
+      grpc::Status status;
+      status = _stub->checkalive(&clientContext, Cmd, &result);
+      if (status.ok())
+      {
+        std::cout << "[Proxy Check] ok from " << proxy_ip_and_port << std::endl;
+      }
+      else
+      {
+        std::cout << "[Proxy Check] failed to connect " << proxy_ip_and_port << std::endl;
+      }
+      m_proxy_ptrs.insert(std::make_pair(proxy_ip_and_port, std::move(_stub)));
+    }
+    return true;
+  }
+  bool CoordinatorImpl::init_clusterinfo(std::string m_clusterinfo_path)
+  {
+    std::cout << "Cluster_information_path:" << m_clusterinfo_path << std::endl;
+    tinyxml2::XMLDocument xml;
+    xml.LoadFile(m_clusterinfo_path.c_str());
+    tinyxml2::XMLElement *root = xml.RootElement();
+    int node_id = 0;
+    m_num_of_Clusters = 0;
+    for (tinyxml2::XMLElement *cluster = root->FirstChildElement(); cluster != nullptr; cluster = cluster->NextSiblingElement())
+    {
+      std::string cluster_id(cluster->Attribute("id"));
+      std::string proxy(cluster->Attribute("proxy"));
+      std::cout << "cluster_id: " << cluster_id << " , proxy: " << proxy << std::endl;
+      Cluster t_cluster;
+      m_cluster_table[std::stoi(cluster_id)] = t_cluster;
+      m_cluster_table[std::stoi(cluster_id)].cluster_id = std::stoi(cluster_id);
+      auto pos = proxy.find(':');
+      m_cluster_table[std::stoi(cluster_id)].proxy_ip = proxy.substr(0, pos);
+      m_cluster_table[std::stoi(cluster_id)].proxy_port = std::stoi(proxy.substr(pos + 1, proxy.size()));
+      for (tinyxml2::XMLElement *node = cluster->FirstChildElement()->FirstChildElement(); node != nullptr; node = node->NextSiblingElement())
+      {
+        std::string node_uri(node->Attribute("uri"));
+        std::cout << "____node: " << node_uri << std::endl;
+        m_cluster_table[std::stoi(cluster_id)].nodes.push_back(node_id);
+        m_node_table[node_id].node_id = node_id;
+        auto pos = node_uri.find(':');
+        m_node_table[node_id].node_ip = node_uri.substr(0, pos);
+        m_node_table[node_id].node_port = std::stoi(node_uri.substr(pos + 1, node_uri.size()));
+        m_node_table[node_id].cluster_id = std::stoi(cluster_id);
+        m_node_ids[node_uri] = node_id;
+        node_id++;
+      }
+      m_num_of_Clusters++;
+    }
+    return true;
+  }
+
+  // the clusters not holding the stripe yet, drawn without replacement for the stripe
+  int CoordinatorImpl::randomly_select_a_cluster(int stripe_id)
+  {
+    return randomly_select_a_cluster(stripe_id, [this, stripe_id](int cluster_id)
+                                     { return m_cluster_table[cluster_id].stripes.count(stripe_id) == 0; });
+  }
+
+  // the clusters accepted by the filter, drawn without replacement for the stripe, -1 if none is accepted
+  int CoordinatorImpl::randomly_select_a_cluster(int stripe_id, const std::function<bool(int)> &accept)
+  {
+    if (m_cluster_pool.size() != m_num_of_Clusters)
+    {
+      std::vector<int> cluster_ids(m_num_of_Clusters);
+      std::iota(cluster_ids.begin(), cluster_ids.end(), 0);
+      m_cluster_pool.reset(cluster_ids);
+    }
+    m_cluster_pool.begin_round(stripe_id);
+    int r_cluster_id = m_cluster_pool.draw(thread_rng(), accept);
+    if (r_cluster_id == -1)
+    {
+      std::cout << "[Placement] no cluster left for stripe " << stripe_id << std::endl;
+    }
+    return r_cluster_id;
+  }
+
+  // the nodes of the cluster not holding the stripe yet, drawn without replacement for the stripe,
+  // the less full and less busy ones more likely
+  int CoordinatorImpl::randomly_select_a_node(int cluster_id, int stripe_id)
+  {
+    CandidatePool &pool = m_node_pools[cluster_id];
+    std::vector<int> &nodes = m_cluster_table[cluster_id].nodes;
+    if (pool.size() != int(nodes.size()))
+    {
+      pool.reset(nodes);
+    }
+    pool.begin_round(stripe_id);
+    std::unordered_map<int, double> weights;
+    node_weights(cluster_id, weights);
+    std::function<double(int)> weight = nullptr;
+    if (!weights.empty())
+    {
+      weight = [&weights](int node_id)
+      { return weights[node_id]; };
+    }
+    int r_node_id = pool.draw(
+        thread_rng(), [this, stripe_id](int node_id)
+        { return m_node_table[node_id].stripes.count(stripe_id) == 0; },
+        weight);
+    if (r_node_id == -1)
+    {
+      std::cout << "[Placement] no node left in cluster " << cluster_id << " for stripe " << stripe_id << std::endl;
+    }
+    return r_node_id;
+  }
+
+  // the weights of the nodes in the cluster, by their free space, blocks and io load relative to the cluster average,
+  // a node without a recent status counts as an average one and a full one is left for last,
+  // no weights if no node has reported
+  void CoordinatorImpl::node_weights(int cluster_id, std::unordered_map<int, double> &weights)
+  {
+    std::vector<int> &nodes = m_cluster_table[cluster_id].nodes;
+    auto now = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lck(m_node_load_mutex);
+    std::vector<NodeLoad *> loads(nodes.size(), nullptr);
+    double sum_free = 0, sum_blocks = 0, sum_io = 0;
+    int reported = 0, free_reported = 0;
+    for (int i = 0; i < int(nodes.size()); i++)
+    {
+      auto it = m_node_loads.find(nodes[i]);
+      if (it == m_node_loads.end() ||
+          std::chrono::duration_cast<std::chrono::milliseconds>(now - it->second.reported).count() > NODE_STATUS_TTL_MS)
+      {
+        continue;
+      }
+      loads[i] = &it->second;
+      reported++;
+      sum_blocks += loads[i]->block_num;
+      sum_io += loads[i]->io_bytes_per_sec;
+      if (loads[i]->free_bytes >= 0)
+      {
+        free_reported++;
+        sum_free += loads[i]->free_bytes;
+      }
+    }
+    if (reported == 0)
+    {
+      return;
+    }
+    double avg_free = free_reported > 0 ? sum_free / free_reported : 0;
+    double avg_blocks = sum_blocks / reported;
+    double avg_io = sum_io / reported;
+    for (int i = 0; i < int(nodes.size()); i++)
+    {
+      if (loads[i] == nullptr)
+      {
+        weights[nodes[i]] = 1;
+        continue;
+      }
+      if (loads[i]->free_bytes >= 0 && loads[i]->free_bytes < NODE_MIN_FREE_BYTES)
+      {
+        weights[nodes[i]] = 0;
+        continue;
+      }
+      // 1 for an average node, up to 2 for an empty or idle one
+      double w_free = (loads[i]->free_bytes >= 0 && avg_free > 0) ? loads[i]->free_bytes / avg_free : 1;
+      double w_blocks = avg_blocks > 0 ? 2 / (1 + loads[i]->block_num / avg_blocks) : 1;
+      double w_io = avg_io > 0 ? 2 / (1 + loads[i]->io_bytes_per_sec / avg_io) : 1;
+      weights[nodes[i]] = w_free * w_blocks * w_io;
+    }
+  }
+
+  // a random cluster of the free list, removed from it by swapping the last one in
+  int CoordinatorImpl::take_a_free_cluster()
+  {
+    int idx = rand_num(int(m_free_clusters.size()));
+    int r_cluster_id = m_free_clusters[idx];
+    m_free_clusters[idx] = m_free_clusters.back();
+    m_free_clusters.pop_back();
+    return r_cluster_id;
+  }
+
+  void CoordinatorImpl::update_stripe_info_in_node(bool add_or_sub, int t_node_id, int stripe_id)
+  {
+    int stripe_block_num = 1;
+    if (m_node_table[t_node_id].stripes.find(stripe_id) != m_node_table[t_node_id].stripes.end())
+    {
+      stripe_block_num = m_node_table[t_node_id].stripes[stripe_id];
+    }
+    if (add_or_sub)
+    {
+      m_node_table[t_node_id].stripes[stripe_id] = stripe_block_num + 1;
+    }
+    else
+    {
+      if (stripe_block_num == 1)
+      {
+        m_node_table[t_node_id].stripes.erase(stripe_id);
+      }
+      else
+      {
+        m_node_table[t_node_id].stripes[stripe_id] = stripe_block_num - 1;
+      }
+    }
+  }
+
+  int CoordinatorImpl::generate_placement(int stripe_id, int block_size)
+  {
+    Stripe &stripe_info = m_stripe_table[stripe_id];
+    int k = stripe_info.k;
+    int l = stripe_info.l;
+    int g_m = stripe_info.g_m;
+    int b = m_encode_parameters.b_datapergroup;
+    ECProject::EncodeType encode_type = m_encode_parameters.encodetype;
+    ECProject::SingleStripePlacementType s_placement_type = m_encode_parameters.s_stripe_placementtype;
+    ECProject::MultiStripesPlacementType m_placement_type = m_encode_parameters.m_stripe_placementtype;
+
+    // generate stripe information
+    int index = stripe_info.object_keys.size() - 1;
+    std::string object_key = stripe_info.object_keys[index];
+    std::vector<Block *> blocks_info(k + g_m + l);
+    for (int i = 0; i < k + g_m + l; i++)
+    {
+      blocks_info[i] = m_block_arena.alloc(Block());
+      blocks_info[i]->block_size = block_size;
+      blocks_info[i]->map2stripe = stripe_id;
+      blocks_info[i]->key_stripe = stripe_id;
+      // the parity blocks too belong to the object until the stripe is merged
+      blocks_info[i]->map2key = m_block_arena.intern_key(object_key);
+      if (i < k)
+      {
+        blocks_info[i]->key_index = i;
+        blocks_info[i]->block_id = i;
+        blocks_info[i]->block_type = 'D';
+        blocks_info[i]->map2group = int(i / b);
+        stripe_info.blocks.push_back(blocks_info[i]);
+      }
+      else if (i >= k && i < k + g_m)
+      {
+        blocks_info[i]->key_index = i - k;
+        blocks_info[i]->block_id = i;
+        blocks_info[i]->block_type = 'G';
+        blocks_info[i]->map2group = l;
+        stripe_info.blocks.push_back(blocks_info[i]);
+      }
+      else
+      {
+        blocks_info[i]->key_index = i - k - g_m;
+        blocks_info[i]->block_id = i;
+        blocks_info[i]->block_type = 'L';
+        blocks_info[i]->map2group = i - k - g_m;
+        stripe_info.blocks.push_back(blocks_info[i]);
+      }
+    }
+
+    if (encode_type == Azure_LRC || encode_type == Optimal_Cauchy_LRC)
+    {
+      if (s_placement_type == Optimal)
+      {
+        if (m_placement_type == Ran)
+        {
+          int idx = m_merge_groups.size() - 1;
+          if (idx < 0 || int(m_merge_groups[idx].size()) == m_encode_parameters.x_stripepermergegroup)
+          {
+            std::vector<int> temp;
+            temp.push_back(stripe_id);
+            m_merge_groups.push_back(temp);
+          }
+          else
+          {
+            m_merge_groups[idx].push_back(stripe_id);
+          }
 
           int g_cluster_id = -1;
           for (int i = 0; i < l; i++)
@@ -736,10 +2672,10 @@ namespace ECProject
               {
                 // randomly select a node in the selected cluster
                 int t_node_id = randomly_select_a_node(t_cluster_id, stripe_id);
-                blocks_info[o].map2cluster = t_cluster_id;
-                blocks_info[o].map2node = t_node_id;
+                blocks_info[o]->map2cluster = t_cluster_id;
+                blocks_info[o]->map2node = t_node_id;
                 update_stripe_info_in_node(true, t_node_id, stripe_id);
-                t_cluster.blocks.push_back(&blocks_info[o]);
+                add_block_to_cluster(blocks_info[o]);
                 t_cluster.stripes.insert(stripe_id);
                 stripe_info.place2clusters.insert(t_cluster_id);
               }
@@ -750,10 +2686,10 @@ namespace ECProject
                 {
                   // randomly select a node in the selected cluster
                   int t_node_id = randomly_select_a_node(t_cluster_id, stripe_id);
-                  blocks_info[k + g_m + i].map2cluster = t_cluster_id;
-                  blocks_info[k + g_m + i].map2node = t_node_id;
+                  blocks_info[k + g_m + i]->map2cluster = t_cluster_id;
+                  blocks_info[k + g_m + i]->map2node = t_node_id;
                   update_stripe_info_in_node(true, t_node_id, stripe_id);
-                  t_cluster.blocks.push_back(&blocks_info[k + g_m + i]);
+                  add_block_to_cluster(blocks_info[k + g_m + i]);
                   t_cluster.stripes.insert(stripe_id);
                   stripe_info.place2clusters.insert(t_cluster_id);
                 }
@@ -765,10 +2701,10 @@ namespace ECProject
                   }
                   Cluster &g_cluster = m_cluster_table[g_cluster_id];
                   int t_node_id = randomly_select_a_node(g_cluster_id, stripe_id);
-                  blocks_info[k + g_m + i].map2cluster = g_cluster_id;
-                  blocks_info[k + g_m + i].map2node = t_node_id;
+                  blocks_info[k + g_m + i]->map2cluster = g_cluster_id;
+                  blocks_info[k + g_m + i]->map2node = t_node_id;
                   update_stripe_info_in_node(true, t_node_id, stripe_id);
-                  g_cluster.blocks.push_back(&blocks_info[k + g_m + i]);
+                  add_block_to_cluster(blocks_info[k + g_m + i]);
                   g_cluster.stripes.insert(stripe_id);
                   stripe_info.place2clusters.insert(g_cluster_id);
                 }
@@ -784,10 +2720,10 @@ namespace ECProject
           for (int i = 0; i < g_m; i++)
           {
             int t_node_id = randomly_select_a_node(g_cluster_id, stripe_id);
-            blocks_info[k + i].map2cluster = g_cluster_id;
-            blocks_info[k + i].map2node = t_node_id;
+            blocks_info[k + i]->map2cluster = g_cluster_id;
+            blocks_info[k + i]->map2node = t_node_id;
             update_stripe_info_in_node(true, t_node_id, stripe_id);
-            g_cluster.blocks.push_back(&blocks_info[k + i]);
+            add_block_to_cluster(blocks_info[k + i]);
             g_cluster.stripes.insert(stripe_id);
             stripe_info.place2clusters.insert(g_cluster_id);
           }
@@ -825,22 +2761,17 @@ namespace ECProject
               if (j + g_m + 1 >= (i + 1) * b)
                 flag = true;
               // randomly select a cluster
-              int t_cluster_id = m_free_clusters[rand_num(int(m_free_clusters.size()))];
-              auto iter = std::find(m_free_clusters.begin(), m_free_clusters.end(), t_cluster_id);
-              if (iter != m_free_clusters.end())
-              {
-                m_free_clusters.erase(iter);
-              } // remove the selected cluster from the free list
+              int t_cluster_id = take_a_free_cluster();
               Cluster &t_cluster = m_cluster_table[t_cluster_id];
               // place every g+1 data blocks from each group to a single cluster
               for (int o = j; o < j + g_m + 1 && o < (i + 1) * b; o++)
               {
                 // randomly select a node in the selected cluster
                 int t_node_id = randomly_select_a_node(t_cluster_id, stripe_id);
-                blocks_info[o].map2cluster = t_cluster_id;
-                blocks_info[o].map2node = t_node_id;
+                blocks_info[o]->map2cluster = t_cluster_id;
+                blocks_info[o]->map2node = t_node_id;
                 update_stripe_info_in_node(true, t_node_id, stripe_id);
-                t_cluster.blocks.push_back(&blocks_info[o]);
+                add_block_to_cluster(blocks_info[o]);
                 t_cluster.stripes.insert(stripe_id);
                 stripe_info.place2clusters.insert(t_cluster_id);
               }
@@ -851,10 +2782,10 @@ namespace ECProject
                 {
                   // randomly select a node in the selected cluster
                   int t_node_id = randomly_select_a_node(t_cluster_id, stripe_id);
-                  blocks_info[k + g_m + i].map2cluster = t_cluster_id;
-                  blocks_info[k + g_m + i].map2node = t_node_id;
+                  blocks_info[k + g_m + i]->map2cluster = t_cluster_id;
+                  blocks_info[k + g_m + i]->map2node = t_node_id;
                   update_stripe_info_in_node(true, t_node_id, stripe_id);
-                  t_cluster.blocks.push_back(&blocks_info[k + g_m + i]);
+                  add_block_to_cluster(blocks_info[k + g_m + i]);
                   t_cluster.stripes.insert(stripe_id);
                   stripe_info.place2clusters.insert(t_cluster_id);
                 }
@@ -862,19 +2793,14 @@ namespace ECProject
                 {
                   if (g_cluster_id == -1) // randomly select a new cluster
                   {
-                    g_cluster_id = m_free_clusters[rand_num(int(m_free_clusters.size()))];
-                    auto iter = std::find(m_free_clusters.begin(), m_free_clusters.end(), g_cluster_id);
-                    if (iter != m_free_clusters.end())
-                    {
-                      m_free_clusters.erase(iter);
-                    }
+                    g_cluster_id = take_a_free_cluster();
                   }
                   Cluster &g_cluster = m_cluster_table[g_cluster_id];
                   int t_node_id = randomly_select_a_node(g_cluster_id, stripe_id);
-                  blocks_info[k + g_m + i].map2cluster = g_cluster_id;
-                  blocks_info[k + g_m + i].map2node = t_node_id;
+                  blocks_info[k + g_m + i]->map2cluster = g_cluster_id;
+                  blocks_info[k + g_m + i]->map2node = t_node_id;
                   update_stripe_info_in_node(true, t_node_id, stripe_id);
-                  g_cluster.blocks.push_back(&blocks_info[k + g_m + i]);
+                  add_block_to_cluster(blocks_info[k + g_m + i]);
                   g_cluster.stripes.insert(stripe_id);
                   stripe_info.place2clusters.insert(g_cluster_id);
                 }
@@ -883,22 +2809,17 @@ namespace ECProject
           }
           if (g_cluster_id == -1) // randomly select a new cluster
           {
-            g_cluster_id = m_free_clusters[rand_num(int(m_free_clusters.size()))];
-            auto iter = std::find(m_free_clusters.begin(), m_free_clusters.end(), g_cluster_id);
-            if (iter != m_free_clusters.end())
-            {
-              m_free_clusters.erase(iter);
-            }
+            g_cluster_id = take_a_free_cluster();
           }
           Cluster &g_cluster = m_cluster_table[g_cluster_id];
           // place the global parity blocks to the selected cluster
           for (int i = 0; i < g_m; i++)
           {
             int t_node_id = randomly_select_a_node(g_cluster_id, stripe_id);
-            blocks_info[k + i].map2cluster = g_cluster_id;
-            blocks_info[k + i].map2node = t_node_id;
+            blocks_info[k + i]->map2cluster = g_cluster_id;
+            blocks_info[k + i]->map2node = t_node_id;
             update_stripe_info_in_node(true, t_node_id, stripe_id);
-            g_cluster.blocks.push_back(&blocks_info[k + i]);
+            add_block_to_cluster(blocks_info[k + i]);
             g_cluster.stripes.insert(stripe_id);
             stripe_info.place2clusters.insert(g_cluster_id);
           }
@@ -938,10 +2859,10 @@ namespace ECProject
               {
                 // randomly select a node in the selected cluster
                 int t_node_id = randomly_select_a_node(t_cluster_id, stripe_id);
-                blocks_info[o].map2cluster = t_cluster_id;
-                blocks_info[o].map2node = t_node_id;
+                blocks_info[o]->map2cluster = t_cluster_id;
+                blocks_info[o]->map2node = t_node_id;
                 update_stripe_info_in_node(true, t_node_id, stripe_id);
-                t_cluster.blocks.push_back(&blocks_info[o]);
+                add_block_to_cluster(blocks_info[o]);
                 t_cluster.stripes.insert(stripe_id);
                 stripe_info.place2clusters.insert(t_cluster_id);
               }
@@ -952,10 +2873,10 @@ namespace ECProject
                 {
                   // randomly select a node in the selected cluster
                   int t_node_id = randomly_select_a_node(t_cluster_id, stripe_id);
-                  blocks_info[k + g_m + i].map2cluster = t_cluster_id;
-                  blocks_info[k + g_m + i].map2node = t_node_id;
+                  blocks_info[k + g_m + i]->map2cluster = t_cluster_id;
+                  blocks_info[k + g_m + i]->map2node = t_node_id;
                   update_stripe_info_in_node(true, t_node_id, stripe_id);
-                  t_cluster.blocks.push_back(&blocks_info[k + g_m + i]);
+                  add_block_to_cluster(blocks_info[k + g_m + i]);
                   t_cluster.stripes.insert(stripe_id);
                   stripe_info.place2clusters.insert(t_cluster_id);
                 }
@@ -968,10 +2889,10 @@ namespace ECProject
                   }
                   Cluster &g_cluster = m_cluster_table[g_cluster_id];
                   int t_node_id = randomly_select_a_node(g_cluster_id, stripe_id);
-                  blocks_info[k + g_m + i].map2cluster = g_cluster_id;
-                  blocks_info[k + g_m + i].map2node = t_node_id;
+                  blocks_info[k + g_m + i]->map2cluster = g_cluster_id;
+                  blocks_info[k + g_m + i]->map2node = t_node_id;
                   update_stripe_info_in_node(true, t_node_id, stripe_id);
-                  g_cluster.blocks.push_back(&blocks_info[k + g_m + i]);
+                  add_block_to_cluster(blocks_info[k + g_m + i]);
                   g_cluster.stripes.insert(stripe_id);
                   stripe_info.place2clusters.insert(g_cluster_id);
                 }
@@ -987,10 +2908,10 @@ namespace ECProject
           for (int i = 0; i < g_m; i++)
           {
             int t_node_id = randomly_select_a_node(g_cluster_id, stripe_id);
-            blocks_info[k + i].map2cluster = g_cluster_id;
-            blocks_info[k + i].map2node = t_node_id;
+            blocks_info[k + i]->map2cluster = g_cluster_id;
+            blocks_info[k + i]->map2node = t_node_id;
             update_stripe_info_in_node(true, t_node_id, stripe_id);
-            g_cluster.blocks.push_back(&blocks_info[k + i]);
+            add_block_to_cluster(blocks_info[k + i]);
             g_cluster.stripes.insert(stripe_id);
             stripe_info.place2clusters.insert(g_cluster_id);
           }
@@ -1044,12 +2965,7 @@ namespace ECProject
               }
               else
               {
-                t_cluster_id = m_free_clusters[rand_num(int(m_free_clusters.size()))];
-                auto iter = std::find(m_free_clusters.begin(), m_free_clusters.end(), t_cluster_id);
-                if (iter != m_free_clusters.end())
-                {
-                  m_free_clusters.erase(iter);
-                }
+                t_cluster_id = take_a_free_cluster();
               }
               Cluster &t_cluster = m_cluster_table[t_cluster_id];
               // place every g+1 data blocks from each group to a single cluster
@@ -1057,10 +2973,10 @@ namespace ECProject
               {
                 // randomly select a node in the selected cluster
                 int t_node_id = randomly_select_a_node(t_cluster_id, stripe_id);
-                blocks_info[o].map2cluster = t_cluster_id;
-                blocks_info[o].map2node = t_node_id;
+                blocks_info[o]->map2cluster = t_cluster_id;
+                blocks_info[o]->map2node = t_node_id;
                 update_stripe_info_in_node(true, t_node_id, stripe_id);
-                t_cluster.blocks.push_back(&blocks_info[o]);
+                add_block_to_cluster(blocks_info[o]);
                 t_cluster.stripes.insert(stripe_id);
                 stripe_info.place2clusters.insert(t_cluster_id);
               }
@@ -1071,10 +2987,10 @@ namespace ECProject
                 {
                   // randomly select a node in the selected cluster
                   int t_node_id = randomly_select_a_node(t_cluster_id, stripe_id);
-                  blocks_info[k + g_m + i].map2cluster = t_cluster_id;
-                  blocks_info[k + g_m + i].map2node = t_node_id;
+                  blocks_info[k + g_m + i]->map2cluster = t_cluster_id;
+                  blocks_info[k + g_m + i]->map2node = t_node_id;
                   update_stripe_info_in_node(true, t_node_id, stripe_id);
-                  t_cluster.blocks.push_back(&blocks_info[k + g_m + i]);
+                  add_block_to_cluster(blocks_info[k + g_m + i]);
                   t_cluster.stripes.insert(stripe_id);
                   stripe_info.place2clusters.insert(t_cluster_id);
                 }
@@ -1082,10 +2998,10 @@ namespace ECProject
                 {
                   Cluster &g_cluster = m_cluster_table[g_cluster_id];
                   int t_node_id = randomly_select_a_node(g_cluster_id, stripe_id);
-                  blocks_info[k + g_m + i].map2cluster = g_cluster_id;
-                  blocks_info[k + g_m + i].map2node = t_node_id;
+                  blocks_info[k + g_m + i]->map2cluster = g_cluster_id;
+                  blocks_info[k + g_m + i]->map2node = t_node_id;
                   update_stripe_info_in_node(true, t_node_id, stripe_id);
-                  g_cluster.blocks.push_back(&blocks_info[k + g_m + i]);
+                  add_block_to_cluster(blocks_info[k + g_m + i]);
                   g_cluster.stripes.insert(stripe_id);
                   stripe_info.place2clusters.insert(g_cluster_id);
                 }
@@ -1097,10 +3013,10 @@ namespace ECProject
           for (int i = 0; i < g_m; i++)
           {
             int t_node_id = randomly_select_a_node(g_cluster_id, stripe_id);
-            blocks_info[k + i].map2cluster = g_cluster_id;
-            blocks_info[k + i].map2node = t_node_id;
+            blocks_info[k + i]->map2cluster = g_cluster_id;
+            blocks_info[k + i]->map2node = t_node_id;
             update_stripe_info_in_node(true, t_node_id, stripe_id);
-            g_cluster.blocks.push_back(&blocks_info[k + i]);
+            add_block_to_cluster(blocks_info[k + i]);
             g_cluster.stripes.insert(stripe_id);
             stripe_info.place2clusters.insert(g_cluster_id);
           }
@@ -1120,7 +3036,7 @@ namespace ECProject
           std::cout << "Cluster " << i << ": ";
           for (auto it = t_cluster.blocks.begin(); it != t_cluster.blocks.end(); it++)
           {
-            std::cout << "[" << (*it)->block_key << ":S" << (*it)->map2stripe << "G" << (*it)->map2group << "N" << (*it)->map2node << "] ";
+            std::cout << "[" << (*it)->block_key() << ":S" << (*it)->map2stripe << "G" << (*it)->map2group << "N" << (*it)->map2node << "] ";
           }
           std::cout << std::endl;
         }
@@ -1155,1046 +3071,2817 @@ namespace ECProject
       const coordinator_proto::NumberOfStripesToMerge *numofstripe,
       coordinator_proto::RepIfMerged *mergeReplyClient)
   {
-    int k = m_encode_parameters.k_datablock;
+    if (numofstripe->dry_run())
+    {
+      // predict the traffic of the stage against the current metadata, nothing is sent
+      std::unique_lock<std::recursive_mutex> merge_lck(m_merge_mutex);
+      std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+      int num_of_stripes = numofstripe->num_of_stripes();
+      if (!check_merge_stage(num_of_stripes))
+      {
+        mergeReplyClient->set_ifmerged(false);
+        return grpc::Status::OK;
+      }
+      MergeSnapshot snapshot;
+      MergeTraffic traffic;
+      take_merge_snapshot(snapshot);
+      simulate_merge_stage(num_of_stripes, traffic, snapshot);
+      restore_merge_snapshot(snapshot);
+      mergeReplyClient->set_ifmerged(true);
+      mergeReplyClient->set_g_cross(traffic.g_cross);
+      mergeReplyClient->set_g_intra(traffic.g_intra);
+      mergeReplyClient->set_l_cross(traffic.l_cross);
+      mergeReplyClient->set_l_intra(traffic.l_intra);
+      mergeReplyClient->set_d_cross(traffic.d_cross);
+      mergeReplyClient->set_d_intra(traffic.d_intra);
+      return grpc::Status::OK;
+    }
+    MergeJobInfo info;
+    if (!merge_stage(numofstripe->num_of_stripes(), numofstripe->max_concurrency(), info))
+    {
+      mergeReplyClient->set_ifmerged(false);
+      return grpc::Status::OK;
+    }
+    mergeReplyClient->set_ifmerged(true);
+    mergeReplyClient->set_lc(info.lc);
+    mergeReplyClient->set_gc(info.gc);
+    mergeReplyClient->set_dc(info.dc);
+    return grpc::Status::OK;
+  }
+
+  grpc::Status CoordinatorImpl::startMerge(
+      grpc::ServerContext *context,
+      const coordinator_proto::MergeJobRequest *job_request,
+      coordinator_proto::MergeJobStatus *job_status)
+  {
+    std::vector<int> stages;
+    for (int i = 0; i < job_request->num_of_stripes_size(); i++)
+    {
+      stages.push_back(job_request->num_of_stripes(i));
+    }
+    int job_id = add_merge_job(stages, job_request->max_concurrency());
+    std::unique_lock<std::mutex> lck(m_job_mutex);
+    fill_merge_status(m_merge_jobs[job_id].info, job_status);
+    return grpc::Status::OK;
+  }
+
+  int CoordinatorImpl::add_merge_job(std::vector<int> &stages, int max_concurrency)
+  {
+    std::unique_lock<std::mutex> lck(m_job_mutex);
+    int job_id = ++m_cur_job_id;
+    MergeJob &job = m_merge_jobs[job_id];
+    job.info.job_id = job_id;
+    job.stages = stages;
+    job.info.stages_total = int(job.stages.size());
+    job.max_concurrency = max_concurrency;
+    m_merge_job_queue.push_back(job_id);
+    m_job_cv.notify_all();
+    return job_id;
+  }
+
+  grpc::Status CoordinatorImpl::setMergePolicy(
+      grpc::ServerContext *context,
+      const coordinator_proto::MergePolicy *policy,
+      coordinator_proto::RepIfSuccess *reply)
+  {
+    std::unique_lock<std::mutex> lck(m_job_mutex);
+    m_merge_policy.enable = policy->enable();
+    m_merge_policy.stages.clear();
+    for (int i = 0; i < policy->num_of_stripes_size(); i++)
+    {
+      m_merge_policy.stages.push_back(policy->num_of_stripes(i));
+    }
+    m_merge_policy.min_stripes_per_group = policy->min_stripes_per_group();
+    m_merge_policy.max_ops_per_sec = policy->max_ops_per_sec();
+    m_merge_policy.bandwidth = policy->bandwidth();
+    if (policy->check_interval_ms() > 0)
+    {
+      m_merge_policy.check_interval_ms = policy->check_interval_ms();
+    }
+    m_merge_policy.max_concurrency = policy->max_concurrency();
+    m_merge_policy.split_min_accesses = policy->split_min_accesses();
+    m_job_cv.notify_all();
+    reply->set_ifcommit(true);
+    return grpc::Status::OK;
+  }
+
+  grpc::Status CoordinatorImpl::planMerge(
+      grpc::ServerContext *context,
+      const coordinator_proto::MergePlanRequest *plan_request,
+      coordinator_proto::MergeSchedule *schedule)
+  {
+    std::vector<int> stages;
+    MergeTraffic traffic;
+    int max_stages = plan_request->max_stages() > 0 ? plan_request->max_stages() : 3;
+    schedule->set_job_id(-1);
+    if (!plan_merge_schedule(plan_request->merge_factor(), max_stages, stages, traffic))
+    {
+      schedule->set_ifplanned(false);
+      return grpc::Status::OK;
+    }
+    schedule->set_ifplanned(true);
+    for (int i = 0; i < int(stages.size()); i++)
+    {
+      schedule->add_num_of_stripes(stages[i]);
+    }
+    schedule->set_cross_blocks(traffic.g_cross + traffic.l_cross + traffic.d_cross);
+    schedule->set_intra_blocks(traffic.g_intra + traffic.l_intra + traffic.d_intra);
+    if (plan_request->execute())
+    {
+      schedule->set_job_id(add_merge_job(stages, plan_request->max_concurrency()));
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << "[MERGE] Plan " << plan_request->merge_factor() << " =";
+      for (int i = 0; i < int(stages.size()); i++)
+      {
+        std::cout << " " << stages[i];
+      }
+      std::cout << ", cross-cluster blocks " << schedule->cross_blocks() << std::endl;
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status CoordinatorImpl::appendMerge(
+      grpc::ServerContext *context,
+      const coordinator_proto::AppendMergeRequest *append_request,
+      coordinator_proto::RepIfMerged *mergeReplyClient)
+  {
+    MergeJobInfo info;
+    if (!append_merge(append_request->stripe_id(), append_request->wide_stripe_id(), info))
+    {
+      mergeReplyClient->set_ifmerged(false);
+      return grpc::Status::OK;
+    }
+    mergeReplyClient->set_ifmerged(true);
+    mergeReplyClient->set_lc(info.lc);
+    mergeReplyClient->set_gc(info.gc);
+    mergeReplyClient->set_dc(info.dc);
+    return grpc::Status::OK;
+  }
+
+  grpc::Status CoordinatorImpl::splitStripe(
+      grpc::ServerContext *context,
+      const coordinator_proto::StripeIdFromClient *stripe_id,
+      coordinator_proto::RepIfMerged *mergeReplyClient)
+  {
+    MergeJobInfo info;
+    if (!split_stripe(stripe_id->stripe_id(), info))
+    {
+      mergeReplyClient->set_ifmerged(false);
+      return grpc::Status::OK;
+    }
+    mergeReplyClient->set_ifmerged(true);
+    mergeReplyClient->set_lc(info.lc);
+    mergeReplyClient->set_gc(info.gc);
+    mergeReplyClient->set_dc(info.dc);
+    return grpc::Status::OK;
+  }
+
+  // split a merged stripe back into stripes of k data blocks, the reverse of merging
+  bool CoordinatorImpl::split_stripe(int stripe_id, MergeJobInfo &info)
+  {
+    std::unique_lock<std::recursive_mutex> merge_lck(m_merge_mutex);
+    std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+    int k = m_encode_parameters.k_datablock;
+    auto it_s = m_stripe_table.find(stripe_id);
+    if (it_s == m_stripe_table.end() || it_s->second.k <= k || it_s->second.k % k != 0)
+    {
+      return false;
+    }
+    std::vector<MergeBatch> batches;
+    std::vector<Block *> old_parity_blocks;
+    if (!plan_split_stripe(stripe_id, batches, old_parity_blocks))
+    {
+      std::cout << "[SPLIT] not enough clusters to place the parities of the sub-stripes of Stripe" << stripe_id << std::endl;
+      return false;
+    }
+    // the blocks now belong to the sub-stripes, the GETs and DELs of the stripe wait for them to be installed
+    set_stripes_merging(std::vector<int>(1, stripe_id), true);
+    t_lck.unlock();
+    // the sub-stripes one by one, the last one deletes the old parities
+    for (auto itb = batches.begin(); itb != batches.end(); itb++)
+    {
+      execute_merge_batch(*itb);
+      info.lc += itb->t_lc;
+      info.gc += itb->t_gc;
+      info.dc += itb->t_dc;
+      info.g_bytes += itb->g_bytes;
+      info.l_bytes += itb->l_bytes;
+      info.d_bytes += itb->d_bytes;
+    }
+    std::vector<int> sub_stripe_ids;
+    t_lck.lock();
+    m_stripe_table.erase(stripe_id);
+    m_meta_log.append(del_stripe_record(stripe_id));
+    {
+      StripeShard &s_shard = stripe_shard(stripe_id);
+      std::unique_lock<std::mutex> a_lck(s_shard.access_mutex);
+      s_shard.access.erase(stripe_id);
+    }
+    for (auto itb = batches.begin(); itb != batches.end(); itb++)
+    {
+      m_stripe_table[itb->larger_stripe.stripe_id] = itb->larger_stripe;
+      m_meta_log.append(stripe_record(itb->larger_stripe));
+      update_object_stripe(itb->larger_stripe);
+      sub_stripe_ids.push_back(itb->larger_stripe.stripe_id);
+    }
+    // the sub-stripes take the place of the stripe in its merge group
+    for (auto it_g = m_merge_groups.begin(); it_g != m_merge_groups.end(); it_g++)
+    {
+      auto it = std::find(it_g->begin(), it_g->end(), stripe_id);
+      if (it != it_g->end())
+      {
+        it = it_g->erase(it);
+        it_g->insert(it, sub_stripe_ids.begin(), sub_stripe_ids.end());
+        break;
+      }
+    }
+    m_meta_log.append(merge_groups_record());
+    for (auto itp = old_parity_blocks.begin(); itp != old_parity_blocks.end(); itp++)
+    {
+      m_block_arena.free(*itp);
+    }
+    set_stripes_merging(std::vector<int>(1, stripe_id), false);
+    t_lck.unlock();
+    m_meta_log.sync();
+    if (IF_DEBUG)
+    {
+      std::cout << "[SPLIT] Stripe" << stripe_id << " into " << sub_stripe_ids.size() << " stripes" << std::endl;
+    }
+    return true;
+  }
+
+  // each sub-stripe keeps k data blocks of the stripe in place, in the order of block ids,
+  // and gets new parities written by the same recalculation steps as a merged stripe, without relocation,
+  // the new parities are placed by the rules of Optimal, the global ones together in a cluster without other blocks
+  // of the sub-stripe, and each local one with the data blocks of its group if the cluster holds at most g_m of them,
+  // false without changing anything if some sub-stripe may not find the clusters for its parities
+  bool CoordinatorImpl::plan_split_stripe(int stripe_id, std::vector<MergeBatch> &batches, std::vector<Block *> &old_parity_blocks)
+  {
+    int k = m_encode_parameters.k_datablock;
     int l = m_encode_parameters.l_localparityblock;
+    int g_m = m_encode_parameters.g_m_globalparityblock;
+    EncodeType encodetype = m_encode_parameters.encodetype;
+    Stripe &t_stripe = m_stripe_table[stripe_id];
+    int num_of_subs = t_stripe.k / k;
+    std::vector<Block *> data_blocks;
+    int old_g_cluster_id = -1;
+    for (auto itb = t_stripe.blocks.begin(); itb != t_stripe.blocks.end(); itb++)
+    {
+      if ((*itb)->block_type == 'D')
+      {
+        data_blocks.push_back(*itb);
+      }
+      else
+      {
+        old_parity_blocks.push_back(*itb);
+      }
+    }
+    std::sort(data_blocks.begin(), data_blocks.end(), [](Block *a, Block *b)
+              { return a->block_id < b->block_id; });
+    // at most the global parities and every local parity of a sub-stripe take a cluster without its data blocks
+    for (int j = 0; j < num_of_subs; j++)
+    {
+      std::unordered_set<int> data_clusters;
+      for (int i = 0; i < k; i++)
+      {
+        data_clusters.insert(data_blocks[j * k + i]->map2cluster);
+      }
+      if (m_num_of_Clusters - int(data_clusters.size()) < l + 1)
+      {
+        old_parity_blocks.clear();
+        return false;
+      }
+    }
+    for (auto itc = t_stripe.place2clusters.begin(); itc != t_stripe.place2clusters.end(); itc++)
+    {
+      m_cluster_table[*itc].stripes.erase(stripe_id);
+    }
+
+    batches.resize(num_of_subs);
+    for (int j = 0; j < num_of_subs; j++)
+    {
+      MergeBatch &batch = batches[j];
+      int s_stripe_id = m_cur_stripe_id++;
+      batch.l_cluster_id.resize(l);
+      batch.parity_location.resize(l);
+      batch.l_main_plan.resize(l);
+      batch.old_parities.resize(l + 1);
+      batch.old_parities_cluster_set.resize(l + 1);
+      Stripe &sub_stripe = batch.larger_stripe;
+      sub_stripe.stripe_id = s_stripe_id;
+      sub_stripe.k = k;
+      sub_stripe.l = l;
+      sub_stripe.g_m = g_m;
+      // cluster id -> number of blocks of the sub-stripe, and the groups of them
+      std::map<int, int> blocks_in_sub_cluster;
+      std::map<int, std::unordered_set<int>> groups_in_sub_cluster;
+      for (int i = 0; i < k; i++)
+      {
+        Block *t_block = data_blocks[j * k + i];
+        int t_cluster_id = t_block->map2cluster;
+        update_stripe_info_in_node(false, t_block->map2node, stripe_id);
+        update_stripe_info_in_node(true, t_block->map2node, s_stripe_id);
+        m_cluster_table[t_cluster_id].stripes.insert(s_stripe_id);
+        update_block_stripe(t_block, s_stripe_id);
+        t_block->block_id = i;
+        sub_stripe.blocks.push_back(t_block);
+        sub_stripe.place2clusters.insert(t_cluster_id);
+        blocks_in_sub_cluster[t_cluster_id]++;
+        groups_in_sub_cluster[t_cluster_id].insert(t_block->map2group);
+        if (std::find(sub_stripe.object_keys.begin(), sub_stripe.object_keys.end(), *t_block->map2key) == sub_stripe.object_keys.end())
+        {
+          auto it_o = std::find(t_stripe.object_keys.begin(), t_stripe.object_keys.end(), *t_block->map2key);
+          if (it_o != t_stripe.object_keys.end())
+          {
+            sub_stripe.object_keys.push_back(*t_block->map2key);
+            sub_stripe.object_sizes.push_back(t_stripe.object_sizes[it_o - t_stripe.object_keys.begin()]);
+          }
+        }
+        batch.block_size = t_block->block_size;
+        Node &t_node = m_node_table[t_block->map2node];
+        for (int gid = -1; gid < l; gid++)
+        {
+          // the data blocks for global recalculation, and for the local recalculation of the group
+          if (gid >= 0 && gid != int(t_block->map2group))
+          {
+            continue;
+          }
+          std::map<int, proxy_proto::locationInfo> &t_location_map = (gid == -1 ? batch.block_location : batch.parity_location[gid]);
+          if (t_location_map.find(t_cluster_id) == t_location_map.end())
+          {
+            Cluster &t_cluster = m_cluster_table[t_cluster_id];
+            proxy_proto::locationInfo new_location;
+            new_location.set_cluster_id(t_cluster_id);
+            new_location.set_proxy_ip(t_cluster.proxy_ip);
+            new_location.set_proxy_port(t_cluster.proxy_port);
+            t_location_map[t_cluster_id] = new_location;
+          }
+          proxy_proto::locationInfo &t_location = t_location_map[t_cluster_id];
+          t_location.add_datanodeip(t_node.node_ip);
+          t_location.add_datanodeport(t_node.node_port);
+          t_location.add_blockkeys(t_block->block_key());
+          t_location.add_blockids(t_block->block_id);
+          t_location.add_groupids(t_block->map2group);
+        }
+      }
+
+      // the parity blocks of a sub-stripe holding a single object belong to it
+      bool single_object = sub_stripe.object_keys.size() == 1;
+      auto add_parity = [this, &batch, &sub_stripe, &blocks_in_sub_cluster, s_stripe_id, single_object](char type, int idx, int group_id, int cluster_id)
+      {
+        int t_block_id = (type == 'G' ? sub_stripe.k + idx : sub_stripe.k + sub_stripe.g_m + idx);
+        int t_map2node = randomly_select_a_node(cluster_id, s_stripe_id);
+        Block *t_block = m_block_arena.alloc(Block(t_block_id, s_stripe_id, idx, type, batch.block_size, group_id, s_stripe_id, cluster_id, t_map2node,
+                                                   single_object ? m_block_arena.intern_key(sub_stripe.object_keys[0]) : nullptr));
+        sub_stripe.blocks.push_back(t_block);
+        sub_stripe.place2clusters.insert(cluster_id);
+        update_stripe_info_in_node(true, t_map2node, s_stripe_id);
+        m_cluster_table[cluster_id].stripes.insert(s_stripe_id);
+        add_block_to_cluster(t_block);
+        blocks_in_sub_cluster[cluster_id]++;
+        return t_block;
+      };
+      // there is always one as checked above
+      auto empty_cluster = [this, &blocks_in_sub_cluster, s_stripe_id](int preferred)
+      {
+        if (preferred != -1 && blocks_in_sub_cluster[preferred] == 0)
+        {
+          return preferred;
+        }
+        return randomly_select_a_cluster(s_stripe_id, [&blocks_in_sub_cluster](int cluster_id)
+                                         { return blocks_in_sub_cluster[cluster_id] == 0; });
+      };
+      // global parities, in the cluster of the old ones if possible
+      if (old_g_cluster_id == -1)
+      {
+        for (auto itp = old_parity_blocks.begin(); itp != old_parity_blocks.end(); itp++)
+        {
+          if ((*itp)->block_type == 'G')
+          {
+            old_g_cluster_id = (*itp)->map2cluster;
+          }
+        }
+      }
+      batch.g_cluster_id = empty_cluster(old_g_cluster_id);
+      for (int i = 0; i < g_m; i++)
+      {
+        Block *t_block = add_parity('G', i, l, batch.g_cluster_id);
+        Node &g_node = m_node_table[t_block->map2node];
+        batch.g_main_plan.add_p_datanodeip(g_node.node_ip);
+        batch.g_main_plan.add_p_datanodeport(g_node.node_port);
+        batch.g_main_plan.add_p_blockkeys(t_block->block_key());
+        // the local parities of Optimal Cauchy LRC are derived from the global ones
+        if (encodetype == Optimal_Cauchy_LRC)
+        {
+          for (int gid = 0; gid < l; gid++)
+          {
+            std::map<int, proxy_proto::locationInfo> &t_location_map = batch.parity_location[gid];
+            if (t_location_map.find(batch.g_cluster_id) == t_location_map.end())
+            {
+              Cluster &t_cluster = m_cluster_table[batch.g_cluster_id];
+              proxy_proto::locationInfo new_location;
+              new_location.set_cluster_id(batch.g_cluster_id);
+              new_location.set_proxy_ip(t_cluster.proxy_ip);
+              new_location.set_proxy_port(t_cluster.proxy_port);
+              t_location_map[batch.g_cluster_id] = new_location;
+            }
+            proxy_proto::locationInfo &t_location = t_location_map[batch.g_cluster_id];
+            t_location.add_datanodeip(g_node.node_ip);
+            t_location.add_datanodeport(g_node.node_port);
+            t_location.add_blockkeys(t_block->block_key());
+            t_location.add_blockids(t_block->block_id);
+          }
+        }
+      }
+      // local parities
+      for (int i = 0; i < l; i++)
+      {
+        int l_cid = -1;
+        for (auto itc = groups_in_sub_cluster.begin(); itc != groups_in_sub_cluster.end(); itc++)
+        {
+          if (itc->second.size() == 1 && *(itc->second.begin()) == i && blocks_in_sub_cluster[itc->first] < g_m + 1)
+          {
+            l_cid = itc->first;
+            break;
+          }
+        }
+        if (l_cid == -1)
+        {
+          l_cid = empty_cluster(-1);
+        }
+        groups_in_sub_cluster[l_cid].insert(i);
+        batch.l_cluster_id[i] = l_cid;
+        Block *t_block = add_parity('L', i, i, l_cid);
+        Node &l_node = m_node_table[t_block->map2node];
+        batch.l_main_plan[i].add_p_datanodeip(l_node.node_ip);
+        batch.l_main_plan[i].add_p_datanodeport(l_node.node_port);
+        batch.l_main_plan[i].add_p_blockkeys(t_block->block_key());
+      }
+      batch.clusters.insert(sub_stripe.place2clusters.begin(), sub_stripe.place2clusters.end());
+    }
+
+    // the old parities, deleted with the last sub-stripe
+    MergeBatch &last_batch = batches.back();
+    for (auto itp = old_parity_blocks.begin(); itp != old_parity_blocks.end(); itp++)
+    {
+      Block *t_block = *itp;
+      int gid = (t_block->block_type == 'G' ? l : int(t_block->map2group));
+      Node &t_node = m_node_table[t_block->map2node];
+      last_batch.old_parities[gid].add_datanodeip(t_node.node_ip);
+      last_batch.old_parities[gid].add_datanodeport(t_node.node_port);
+      last_batch.old_parities[gid].add_blockkeys(t_block->block_key());
+      last_batch.old_parities_cluster_set[gid].insert(t_block->map2cluster);
+      last_batch.clusters.insert(t_block->map2cluster);
+      update_stripe_info_in_node(false, t_block->map2node, stripe_id);
+      remove_block_from_cluster(t_block->map2cluster, t_block);
+    }
+    for (auto itb = batches.begin(); itb != batches.end(); itb++)
+    {
+      estimate_merge_traffic(*itb);
+    }
+    return true;
+  }
+
+  // the GET requests of each stripe, halved every check so that only recent reads count
+  std::vector<int> CoordinatorImpl::hot_stripes_to_split(int min_accesses)
+  {
+    std::vector<int> hot_stripes;
+    SharedLock t_lck(m_stripe_table_rwlock);
+    for (int i = 0; i < METADATA_SHARD_NUM; i++)
+    {
+      StripeShard &s_shard = m_stripe_shards[i];
+      std::unique_lock<std::mutex> a_lck(s_shard.access_mutex);
+      for (auto it = s_shard.access.begin(); it != s_shard.access.end();)
+      {
+        auto its = m_stripe_table.find(it->first);
+        if (its != m_stripe_table.end() && its->second.k > m_encode_parameters.k_datablock && it->second >= min_accesses)
+        {
+          hot_stripes.push_back(it->first);
+        }
+        it->second /= 2;
+        if (it->second == 0)
+        {
+          it = s_shard.access.erase(it);
+        }
+        else
+        {
+          it++;
+        }
+      }
+    }
+    std::sort(hot_stripes.begin(), hot_stripes.end());
+    return hot_stripes;
+  }
+
+  // with the stripe table locked exclusively, point the objects of the stripe to it
+  void CoordinatorImpl::update_object_stripe(Stripe &stripe)
+  {
+    for (auto it = stripe.object_keys.begin(); it != stripe.object_keys.end(); it++)
+    {
+      ObjectShard &o_shard = object_shard(*it);
+      std::unique_lock<RWMutex> o_lck(o_shard.rwlock);
+      auto it_o = o_shard.commit_table.find(*it);
+      if (it_o != o_shard.commit_table.end())
+      {
+        it_o->second.map2stripe = stripe.stripe_id;
+        m_meta_log.append(object_record(it_o->first, it_o->second));
+      }
+    }
+  }
+
+  // merge a single stripe into a wider one as a batch of two stripes of different widths,
+  // the new local parities are the old ones of both added together, so only the newcomer's local parities are sent,
+  // the global parities are recalculated from the data blocks, with partial decoding one partial block per cluster
+  bool CoordinatorImpl::append_merge(int stripe_id, int wide_stripe_id, MergeJobInfo &info)
+  {
+    std::unique_lock<std::recursive_mutex> merge_lck(m_merge_mutex);
+    std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+    if (wide_stripe_id < 0)
+    {
+      wide_stripe_id = select_wide_stripe(stripe_id);
+    }
+    if (stripe_id == wide_stripe_id || m_stripe_table.find(stripe_id) == m_stripe_table.end() ||
+        m_stripe_table.find(wide_stripe_id) == m_stripe_table.end())
+    {
+      return false;
+    }
+    Stripe &t_stripe = m_stripe_table[stripe_id];
+    Stripe &w_stripe = m_stripe_table[wide_stripe_id];
+    if (t_stripe.blocks.empty() || w_stripe.blocks.empty() ||
+        t_stripe.blocks[0]->block_size != w_stripe.blocks[0]->block_size)
+    {
+      return false;
+    }
+    // the wide stripe goes first, so its data blocks keep their block ids
+    std::vector<int> stripe_ids = {wide_stripe_id, stripe_id};
+    MergeBatch batch;
+    plan_merge_batch(stripe_ids, batch, m_cur_stripe_id++);
+    set_stripes_merging(stripe_ids, true);
+    t_lck.unlock();
+    execute_merge_batch(batch);
+    t_lck.lock();
+    m_stripe_table.erase(stripe_id);
+    m_stripe_table.erase(wide_stripe_id);
+    m_stripe_table[batch.larger_stripe.stripe_id] = batch.larger_stripe;
+    m_meta_log.append(del_stripe_record(stripe_id));
+    m_meta_log.append(del_stripe_record(wide_stripe_id));
+    m_meta_log.append(stripe_record(batch.larger_stripe));
+    update_object_stripe(batch.larger_stripe);
+    set_stripes_merging(stripe_ids, false);
+    for (auto itp = batch.old_parity_blocks.begin(); itp != batch.old_parity_blocks.end(); itp++)
+    {
+      m_block_arena.free(*itp);
+    }
+    // the larger stripe takes the place of the wide one in its merge group
+    for (auto it_g = m_merge_groups.begin(); it_g != m_merge_groups.end(); it_g++)
+    {
+      for (auto it_s = it_g->begin(); it_s != it_g->end(); it_s++)
+      {
+        if (*it_s == wide_stripe_id)
+        {
+          *it_s = batch.larger_stripe.stripe_id;
+        }
+      }
+      it_g->erase(std::remove(it_g->begin(), it_g->end(), stripe_id), it_g->end());
+    }
+    m_merge_groups.erase(std::remove_if(m_merge_groups.begin(), m_merge_groups.end(),
+                                        [](const std::vector<int> &group)
+                                        { return group.empty(); }),
+                         m_merge_groups.end());
+    m_meta_log.append(merge_groups_record());
+    t_lck.unlock();
+    m_meta_log.sync();
+    info.lc = batch.t_lc;
+    info.gc = batch.t_gc;
+    info.dc = batch.t_dc;
+    info.g_bytes = batch.g_bytes;
+    info.l_bytes = batch.l_bytes;
+    info.d_bytes = batch.d_bytes;
+    if (IF_DEBUG)
+    {
+      std::cout << "[MERGE] Append Stripe" << stripe_id << " to Stripe" << wide_stripe_id << " as Stripe"
+                << batch.larger_stripe.stripe_id << ", k = " << batch.larger_stripe.k << std::endl;
+    }
+    return true;
+  }
+
+  // the widest other stripe, preferring the one sharing the most clusters with the stripe
+  int CoordinatorImpl::select_wide_stripe(int stripe_id)
+  {
+    auto it_t = m_stripe_table.find(stripe_id);
+    if (it_t == m_stripe_table.end())
+    {
+      return -1;
+    }
+    int best = -1, best_k = 0, best_shared = 0;
+    for (auto its = m_stripe_table.begin(); its != m_stripe_table.end(); its++)
+    {
+      if (its->first == stripe_id)
+      {
+        continue;
+      }
+      int shared = 0;
+      for (auto itc = it_t->second.place2clusters.begin(); itc != it_t->second.place2clusters.end(); itc++)
+      {
+        if (its->second.place2clusters.count(*itc))
+        {
+          shared++;
+        }
+      }
+      if (best == -1 || its->second.k > best_k || (its->second.k == best_k && shared > best_shared))
+      {
+        best = its->first;
+        best_k = its->second.k;
+        best_shared = shared;
+      }
+    }
+    return best;
+  }
+
+  // try every ordered factorization of merge_factor into at most max_stages stages on a dry run,
+  // and keep the feasible one sending the fewest blocks across clusters,
+  // ties are broken by the blocks sent within clusters, then by the number of stages
+  bool CoordinatorImpl::plan_merge_schedule(int merge_factor, int max_stages, std::vector<int> &stages, MergeTraffic &traffic)
+  {
+    std::vector<std::vector<int>> candidates;
+    std::vector<int> cur;
+    std::function<void(int)> factorize = [&](int rest)
+    {
+      if (rest == 1)
+      {
+        if (!cur.empty())
+        {
+          candidates.push_back(cur);
+        }
+        return;
+      }
+      if (int(cur.size()) == max_stages)
+      {
+        return;
+      }
+      for (int x = 2; x <= rest; x++)
+      {
+        if (rest % x == 0)
+        {
+          cur.push_back(x);
+          factorize(rest / x);
+          cur.pop_back();
+        }
+      }
+    };
+    if (merge_factor < 2)
+    {
+      return false;
+    }
+    factorize(merge_factor);
+
+    std::unique_lock<std::recursive_mutex> merge_lck(m_merge_mutex);
+    // the simulated stages rewrite the live metadata until restored
+    std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+    bool found = false;
+    long long best_cross = 0, best_intra = 0;
+    MergeSnapshot snapshot;
+    take_merge_snapshot(snapshot);
+    for (auto itc = candidates.begin(); itc != candidates.end(); itc++)
+    {
+      MergeTraffic t_traffic;
+      bool feasible = true;
+      for (auto itx = itc->begin(); itx != itc->end(); itx++)
+      {
+        if (!check_merge_stage(*itx))
+        {
+          feasible = false;
+          break;
+        }
+        simulate_merge_stage(*itx, t_traffic, snapshot);
+      }
+      restore_merge_snapshot(snapshot);
+      if (!feasible)
+      {
+        continue;
+      }
+      long long t_cross = t_traffic.g_cross + t_traffic.l_cross + t_traffic.d_cross;
+      long long t_intra = t_traffic.g_intra + t_traffic.l_intra + t_traffic.d_intra;
+      if (!found || t_cross < best_cross || (t_cross == best_cross && t_intra < best_intra) ||
+          (t_cross == best_cross && t_intra == best_intra && itc->size() < stages.size()))
+      {
+        found = true;
+        best_cross = t_cross;
+        best_intra = t_intra;
+        stages = *itc;
+        traffic = t_traffic;
+      }
+    }
+    return found;
+  }
+
+  // launch the next merge stage of the policy in the background,
+  // when the merge groups hold enough stripes, the clusters are idle and the bandwidth budget allows
+  void CoordinatorImpl::merge_daemon()
+  {
+    int job_id = -1;
+    long long last_ops = m_num_of_ops;
+    auto last_check = std::chrono::steady_clock::now();
+    auto next_launch = last_check;
+    std::unique_lock<std::mutex> lck(m_job_mutex);
+    while (!m_stop_merge_workers)
+    {
+      m_job_cv.wait_for(lck, std::chrono::milliseconds(m_merge_policy.check_interval_ms));
+      if (m_stop_merge_workers)
+      {
+        return;
+      }
+      // the observed load, SET and GET requests per second since the last check
+      auto now = std::chrono::steady_clock::now();
+      double interval = std::chrono::duration<double>(now - last_check).count();
+      long long cur_ops = m_num_of_ops;
+      double ops_per_sec = interval > 0 ? double(cur_ops - last_ops) / interval : 0;
+      last_ops = cur_ops;
+      last_check = now;
+      if (!m_merge_policy.enable)
+      {
+        continue;
+      }
+      if (job_id != -1)
+      {
+        MergeJobInfo &info = m_merge_jobs[job_id].info;
+        if (info.state == MERGE_QUEUED || info.state == MERGE_RUNNING)
+        {
+          continue;
+        }
+        // keep the average cross-cluster traffic under the budget
+        if (info.state == MERGE_DONE && m_merge_policy.bandwidth > 0)
+        {
+          double t_budget = double(info.g_bytes + info.l_bytes + info.d_bytes) / double(m_merge_policy.bandwidth);
+          double t_cost = info.lc + info.gc + info.dc;
+          if (t_budget > t_cost)
+          {
+            next_launch = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                    std::chrono::duration<double>(t_budget - t_cost));
+          }
+        }
+        job_id = -1;
+      }
+      if (now < next_launch ||
+          (m_merge_policy.max_ops_per_sec > 0 && ops_per_sec > m_merge_policy.max_ops_per_sec))
+      {
+        continue;
+      }
+      MergePolicy policy = m_merge_policy;
+      lck.unlock();
+      // split the merged stripes that became hot, their degraded reads touch too many blocks
+      if (policy.split_min_accesses > 0)
+      {
+        std::vector<int> hot_stripes = hot_stripes_to_split(policy.split_min_accesses);
+        for (auto it = hot_stripes.begin(); it != hot_stripes.end(); it++)
+        {
+          MergeJobInfo info;
+          if (stripe_deleting(*it))
+          {
+            continue;
+          }
+          if (split_stripe(*it, info) && IF_DEBUG)
+          {
+            std::cout << "[SPLIT] Daemon splits hot Stripe" << *it << std::endl;
+          }
+        }
+      }
+      int num_of_stripes = -1;
+      {
+        // the merge metadata changes only within a stage
+        std::unique_lock<std::recursive_mutex> merge_lck(m_merge_mutex);
+        SharedLock t_lck(m_stripe_table_rwlock);
+        if (m_merge_degree < int(policy.stages.size()))
+        {
+          num_of_stripes = policy.stages[m_merge_degree];
+          bool ready = !m_merge_groups.empty() && check_merge_stage(num_of_stripes);
+          for (auto it = m_merge_groups.begin(); ready && it != m_merge_groups.end(); it++)
+          {
+            ready = int((*it).size()) >= std::max(num_of_stripes, policy.min_stripes_per_group);
+            // a stripe delete in flight frees its blocks when the proxy reports, the stage waits for it
+            for (auto it_s = (*it).begin(); ready && it_s != (*it).end(); it_s++)
+            {
+              ready = !stripe_deleting(*it_s);
+            }
+          }
+          if (!ready)
+          {
+            num_of_stripes = -1;
+          }
+        }
+      }
+      if (num_of_stripes > 0)
+      {
+        std::vector<int> stages(1, num_of_stripes);
+        job_id = add_merge_job(stages, policy.max_concurrency);
+        if (IF_DEBUG)
+        {
+          std::cout << "[MERGE] Daemon starts job " << job_id << " to merge every " << num_of_stripes << " stripes" << std::endl;
+        }
+      }
+      lck.lock();
+    }
+  }
+
+  grpc::Status CoordinatorImpl::getMergeStatus(
+      grpc::ServerContext *context,
+      const coordinator_proto::MergeJobId *job_id,
+      coordinator_proto::MergeJobStatus *job_status)
+  {
+    std::unique_lock<std::mutex> lck(m_job_mutex);
+    auto it = m_merge_jobs.find(job_id->job_id());
+    if (it == m_merge_jobs.end())
+    {
+      job_status->set_job_id(-1);
+      return grpc::Status::OK;
+    }
+    fill_merge_status(it->second.info, job_status);
+    return grpc::Status::OK;
+  }
+
+  // a queued job is cancelled at once, a running one after its current stage
+  grpc::Status CoordinatorImpl::cancelMerge(
+      grpc::ServerContext *context,
+      const coordinator_proto::MergeJobId *job_id,
+      coordinator_proto::MergeJobStatus *job_status)
+  {
+    std::unique_lock<std::mutex> lck(m_job_mutex);
+    auto it = m_merge_jobs.find(job_id->job_id());
+    if (it == m_merge_jobs.end())
+    {
+      job_status->set_job_id(-1);
+      return grpc::Status::OK;
+    }
+    MergeJob &job = it->second;
+    if (job.info.state == MERGE_QUEUED)
+    {
+      job.info.state = MERGE_CANCELLED;
+      auto itq = std::find(m_merge_job_queue.begin(), m_merge_job_queue.end(), job.info.job_id);
+      if (itq != m_merge_job_queue.end())
+      {
+        m_merge_job_queue.erase(itq);
+      }
+    }
+    else if (job.info.state == MERGE_RUNNING)
+    {
+      job.cancelling = true;
+    }
+    fill_merge_status(job.info, job_status);
+    return grpc::Status::OK;
+  }
+
+  void CoordinatorImpl::fill_merge_status(MergeJobInfo &info, coordinator_proto::MergeJobStatus *job_status)
+  {
+    job_status->set_job_id(info.job_id);
+    job_status->set_state((int)info.state);
+    job_status->set_stages_done(info.stages_done);
+    job_status->set_stages_total(info.stages_total);
+    job_status->set_stripes_merged(info.stripes_merged);
+    job_status->set_stripes_total(info.stripes_total);
+    job_status->set_g_bytes(info.g_bytes);
+    job_status->set_l_bytes(info.l_bytes);
+    job_status->set_d_bytes(info.d_bytes);
+    job_status->set_lc(info.lc);
+    job_status->set_gc(info.gc);
+    job_status->set_dc(info.dc);
+  }
+
+  void CoordinatorImpl::merge_worker()
+  {
+    while (true)
+    {
+      int job_id;
+      {
+        std::unique_lock<std::mutex> lck(m_job_mutex);
+        while (!m_stop_merge_workers && m_merge_job_queue.empty())
+        {
+          m_job_cv.wait(lck);
+        }
+        if (m_stop_merge_workers)
+        {
+          return;
+        }
+        job_id = m_merge_job_queue.front();
+        m_merge_job_queue.pop_front();
+      }
+      // the stages of different jobs never interleave, each one plans from the groups the previous one left
+      std::unique_lock<std::recursive_mutex> merge_lck(m_merge_mutex);
+      {
+        std::unique_lock<std::mutex> lck(m_job_mutex);
+        if (m_merge_jobs[job_id].info.state == MERGE_CANCELLED)
+        {
+          continue;
+        }
+        m_merge_jobs[job_id].info.state = MERGE_RUNNING;
+      }
+      // the job stays in m_merge_jobs, std::map keeps the reference valid
+      MergeJob &job = m_merge_jobs[job_id];
+      MergeJobState final_state = MERGE_DONE;
+      for (int i = 0; i < int(job.stages.size()); i++)
+      {
+        {
+          std::unique_lock<std::mutex> lck(m_job_mutex);
+          if (job.cancelling)
+          {
+            final_state = MERGE_CANCELLED;
+            break;
+          }
+        }
+        if (!merge_stage(job.stages[i], job.max_concurrency, job.info))
+        {
+          final_state = MERGE_FAILED;
+          break;
+        }
+        std::unique_lock<std::mutex> lck(m_job_mutex);
+        job.info.stages_done++;
+      }
+      std::unique_lock<std::mutex> lck(m_job_mutex);
+      job.info.state = final_state;
+      if (IF_DEBUG)
+      {
+        std::cout << "[MERGE] Job " << job_id << " finished with state " << final_state << std::endl;
+      }
+    }
+  }
+
+  // merge every num_of_stripes stripes of each merge group, the time and traffic are added to info
+  // if the stripes can be merged every num_of_stripes in the current stage
+  bool CoordinatorImpl::check_merge_stage(int num_of_stripes)
+  {
     int b = m_encode_parameters.b_datapergroup;
     int g_m = m_encode_parameters.g_m_globalparityblock;
     int m = b % (g_m + 1);
     EncodeType encodetype = m_encode_parameters.encodetype;
-    int num_of_stripes = numofstripe->num_of_stripes();
     int total_stripes = m_stripe_table.size();
-    if (total_stripes % num_of_stripes != 0 ||
+    if (num_of_stripes <= 0 || total_stripes % num_of_stripes != 0 ||
         (encodetype == Azure_LRC && m_merge_degree == 0 && m != 0 && m != g_m && num_of_stripes != g_m / m) ||
         (encodetype == Optimal_Cauchy_LRC && m_merge_degree == 0 && m != 0 && m != g_m && num_of_stripes != g_m / m))
     {
-      mergeReplyClient->set_ifmerged(false);
-      return grpc::Status::OK;
+      return false;
+    }
+    MultiStripesPlacementType m_s_placementtype = m_encode_parameters.m_stripe_placementtype;
+    if (m_s_placementtype == DIS || m_s_placementtype == OPT)
+    {
+      int num_stripepergroup = m_merge_groups[0].size();
+      if (num_stripepergroup % num_of_stripes != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool CoordinatorImpl::merge_stage(int num_of_stripes, int max_concurrency, MergeJobInfo &info)
+  {
+    // one stage at a time
+    std::unique_lock<std::recursive_mutex> merge_lck(m_merge_mutex);
+    std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+    if (!check_merge_stage(num_of_stripes))
+    {
+      return false;
+    }
+    // the maximum number of batches merged in parallel, 0 for no limit
+    if (max_concurrency <= 0)
+    {
+      max_concurrency = m_num_of_Clusters;
+    }
+    int tot_stripe_num = int(m_stripe_table.size());
+    int stripe_cnt = 0;
+    double t_lc = 0.0;
+    double t_gc = 0.0;
+    double t_dc = 0.0;
+    {
+      std::unique_lock<std::mutex> job_lck(m_job_mutex);
+      info.stripes_merged = 0;
+      info.stripes_total = tot_stripe_num;
+    }
+    // plan all batches first
+    std::vector<MergeBatch> batches;
+    std::vector<std::vector<int>> new_merge_groups;
+    plan_merge_stage(num_of_stripes, batches, new_merge_groups);
+    // the SETs go on while the batches run, the stripes they append to the groups are kept after the stage
+    std::vector<int> planned_sizes;
+    for (auto it = m_merge_groups.begin(); it != m_merge_groups.end(); it++)
+    {
+      planned_sizes.push_back(int((*it).size()));
+    }
+    // the plans have rewritten the blocks of the stripes, the GETs and DELs on them wait for their batches
+    for (auto itb = batches.begin(); itb != batches.end(); itb++)
+    {
+      set_stripes_merging(itb->old_stripe_ids, true);
+    }
+    t_lck.unlock();
+
+    // then execute the batches, the ones touching disjoint sets of clusters run in parallel
+    struct timeval e_start_time, e_end_time;
+    gettimeofday(&e_start_time, NULL);
+    int num_of_batches = int(batches.size());
+    int num_of_started = 0;
+    int num_of_running = 0;
+    std::vector<bool> started(num_of_batches, false);
+    std::unordered_set<int> busy_clusters;
+    std::mutex batch_mutex;
+    std::condition_variable batch_cv;
+    auto run_batch = [this, &batches, &batch_mutex, &batch_cv, &busy_clusters, &num_of_running,
+                      &stripe_cnt, tot_stripe_num, num_of_stripes, &t_lc, &t_gc, &t_dc, &info](int idx)
+    {
+      MergeBatch &batch = batches[idx];
+      execute_merge_batch(batch);
+      std::unique_lock<std::mutex> lck(batch_mutex);
+      for (auto itc = batch.clusters.begin(); itc != batch.clusters.end(); itc++)
+      {
+        busy_clusters.erase(*itc);
+      }
+      num_of_running--;
+      t_lc += batch.t_lc;
+      t_gc += batch.t_gc;
+      t_dc += batch.t_dc;
+      // update stripes meta information
+      {
+        std::unique_lock<RWMutex> t_lck(m_stripe_table_rwlock);
+        for (auto its = batch.old_stripe_ids.begin(); its != batch.old_stripe_ids.end(); its++)
+        {
+          m_stripe_table.erase(*its);
+          m_meta_log.append(del_stripe_record(*its));
+        }
+        m_stripe_table[batch.larger_stripe.stripe_id] = batch.larger_stripe;
+        m_meta_log.append(stripe_record(batch.larger_stripe));
+        update_object_stripe(batch.larger_stripe);
+        set_stripes_merging(batch.old_stripe_ids, false);
+      }
+      for (auto itp = batch.old_parity_blocks.begin(); itp != batch.old_parity_blocks.end(); itp++)
+      {
+        m_block_arena.free(*itp);
+      }
+      stripe_cnt += num_of_stripes;
+      {
+        std::unique_lock<std::mutex> job_lck(m_job_mutex);
+        info.stripes_merged = stripe_cnt;
+        info.g_bytes += batch.g_bytes;
+        info.l_bytes += batch.l_bytes;
+        info.d_bytes += batch.d_bytes;
+      }
+      std::cout << "[Merging Stage " << m_merge_degree + 1 << "] Process " << stripe_cnt << "/" << tot_stripe_num
+                << "  lc:" << t_lc << " gc:" << t_gc << " dc:" << t_dc << std::endl;
+      batch_cv.notify_all();
+    };
+    std::vector<std::thread> workers;
+    std::unique_lock<std::mutex> lck(batch_mutex);
+    while (num_of_started < num_of_batches)
+    {
+      // the earliest batch that conflicts with none of the running ones
+      int next = -1;
+      for (int i = 0; i < num_of_batches && num_of_running < max_concurrency; i++)
+      {
+        if (started[i])
+        {
+          continue;
+        }
+        bool conflict = false;
+        for (auto itc = batches[i].clusters.begin(); itc != batches[i].clusters.end(); itc++)
+        {
+          if (busy_clusters.find(*itc) != busy_clusters.end())
+          {
+            conflict = true;
+            break;
+          }
+        }
+        if (!conflict)
+        {
+          next = i;
+          break;
+        }
+      }
+      if (next == -1)
+      {
+        batch_cv.wait(lck);
+        continue;
+      }
+      started[next] = true;
+      num_of_started++;
+      num_of_running++;
+      busy_clusters.insert(batches[next].clusters.begin(), batches[next].clusters.end());
+      workers.push_back(std::thread(run_batch, next));
     }
-    MultiStripesPlacementType m_s_placementtype = m_encode_parameters.m_stripe_placementtype;
-    if (m_s_placementtype == DIS || m_s_placementtype == OPT)
+    lck.unlock();
+    for (int i = 0; i < int(workers.size()); i++)
     {
-      int num_stripepergroup = m_merge_groups[0].size();
-      if (num_stripepergroup % num_of_stripes != 0)
+      workers[i].join();
+    }
+    gettimeofday(&e_end_time, NULL);
+    // the per-batch times add up, scale them down to the elapsed time when batches overlap
+    double e_time = e_end_time.tv_sec - e_start_time.tv_sec + (e_end_time.tv_usec - e_start_time.tv_usec) * 1.0 / 1000000;
+    double s_time = t_lc + t_gc + t_dc;
+    if (s_time > e_time && s_time > 0)
+    {
+      t_lc *= e_time / s_time;
+      t_gc *= e_time / s_time;
+      t_dc *= e_time / s_time;
+    }
+    // update m_merge_groups
+    t_lck.lock();
+    for (int i = 0; i < int(m_merge_groups.size()); i++)
+    {
+      int from = i < int(planned_sizes.size()) ? planned_sizes[i] : 0;
+      if (from < int(m_merge_groups[i].size()))
       {
-        mergeReplyClient->set_ifmerged(false);
-        return grpc::Status::OK;
+        new_merge_groups.push_back(std::vector<int>(m_merge_groups[i].begin() + from, m_merge_groups[i].end()));
       }
     }
-    int tot_stripe_num = int(m_stripe_table.size());
-    int stripe_cnt = 0;
-    double t_lc = 0.0;
-    double t_gc = 0.0;
-    double t_dc = 0.0;
+    m_merge_groups = new_merge_groups;
+    m_merge_degree += 1;
+    m_meta_log.append(merge_groups_record());
+    m_meta_log.append(counters_record());
+    {
+      std::unique_lock<std::mutex> job_lck(m_job_mutex);
+      info.lc += t_lc;
+      info.gc += t_gc;
+      info.dc += t_dc;
+    }
+
+    if (IF_DEBUG)
+    {
+      // print the result
+      std::cout << std::endl;
+      std::cout << "After Merge of this stage:" << std::endl;
+      for (int i = 0; i < m_num_of_Clusters; i++)
+      {
+        Cluster &t_cluster = m_cluster_table[i];
+        if (int(t_cluster.blocks.size()) > 0)
+        {
+          std::cout << "Cluster " << i << ": ";
+          for (auto it = t_cluster.blocks.begin(); it != t_cluster.blocks.end(); it++)
+          {
+            std::cout << "[" << (*it)->block_key() << ":S" << (*it)->map2stripe << "G" << (*it)->map2group << "N" << (*it)->map2node << "] ";
+          }
+          std::cout << std::endl;
+        }
+      }
+      std::cout << "Merge Group: ";
+      for (auto it1 = m_merge_groups.begin(); it1 != m_merge_groups.end(); it1++)
+      {
+        std::cout << "[ ";
+        for (auto it2 = (*it1).begin(); it2 != (*it1).end(); it2++)
+        {
+          std::cout << (*it2) << " ";
+        }
+        std::cout << "] ";
+      }
+      std::cout << std::endl;
+      std::cout << std::endl;
+    }
+    t_lck.unlock();
+    m_meta_log.sync();
+
+    return true;
+  }
+
+
+  // plan the merge of every num_of_stripes stripes of each merge group,
+  // each plan depends on the placement decided by the previous ones
+  // the larger stripes take real stripe ids unless next_stripe_id is given by a simulation
+  void CoordinatorImpl::plan_merge_stage(int num_of_stripes, std::vector<MergeBatch> &batches,
+                                         std::vector<std::vector<int>> &new_merge_groups, int *next_stripe_id)
+  {
     std::vector<std::vector<int>>::iterator it_g;
-    std::vector<int>::iterator it_s, it_t;
-    std::vector<std::vector<int>> new_merge_groups;
+    std::vector<int>::iterator it_s;
+    batches.clear();
+    new_merge_groups.clear();
+    if (m_encode_parameters.m_stripe_placementtype == Ran)
+    {
+      regroup_merge_stripes(num_of_stripes);
+    }
     for (it_g = m_merge_groups.begin(); it_g != m_merge_groups.end(); it_g++)
     {
       std::vector<int> s_merge_group;
       // for each xi stripes
       for (it_s = (*it_g).begin(); it_s != (*it_g).end(); it_s += num_of_stripes)
       {
-        int cur_block_id = 0;
-        int l_stripe_id = m_cur_stripe_id;
-        int l_cluster_id[l];
-        int g_cluster_id;
-        std::vector<int> l_node_id;
-        std::vector<int> g_node_id;
-        std::unordered_set<int> old_stripe_id_set;
-
-        // for request
-        std::map<int, proxy_proto::locationInfo> block_location;
-        proxy_proto::mainRecalPlan l_recal_plan[l];
-        proxy_proto::mainRecalPlan g_main_plan;
-        std::map<int, proxy_proto::locationInfo> parity_location[l];
-        proxy_proto::mainRecalPlan l_main_plan[l];
-        proxy_proto::NodeAndBlock old_parities;
-        std::unordered_set<int> old_parities_cluster_set;
-
-        int block_size;
-        // merge and generate new stripe information
-        Stripe larger_stripe;
-        larger_stripe.stripe_id = l_stripe_id;
-        larger_stripe.l = m_encode_parameters.l_localparityblock;
-        larger_stripe.g_m = m_encode_parameters.g_m_globalparityblock;
-        // for each stripe
-        for (it_t = it_s; it_t != it_s + num_of_stripes; it_t++)
-        {
-          int t_stripe_id = *(it_t);
-          old_stripe_id_set.insert(t_stripe_id);
-          Stripe &t_stripe = m_stripe_table[t_stripe_id];
-          larger_stripe.k = t_stripe.k * num_of_stripes;
-          larger_stripe.object_keys.insert(larger_stripe.object_keys.end(), t_stripe.object_keys.begin(), t_stripe.object_keys.end());
-          larger_stripe.object_sizes.insert(larger_stripe.object_sizes.end(), t_stripe.object_sizes.begin(), t_stripe.object_sizes.end());
-          std::vector<Block *>::iterator it_b, it_c;
-          // for each block
-          for (it_b = t_stripe.blocks.begin(); it_b != t_stripe.blocks.end(); it_b++)
-          {
-            Block *t_block = *it_b;
-            update_stripe_info_in_node(false, t_block->map2node, t_block->map2stripe);
-            m_cluster_table[t_block->map2cluster].stripes.erase(t_block->map2stripe);
-            t_block->map2stripe = l_stripe_id;
-            if (t_block->block_type == 'D')
+        std::vector<int> stripe_ids(it_s, it_s + num_of_stripes);
+        batches.push_back(MergeBatch());
+        plan_merge_batch(stripe_ids, batches.back(), next_stripe_id != nullptr ? (*next_stripe_id)++ : m_cur_stripe_id++);
+        s_merge_group.push_back(batches.back().larger_stripe.stripe_id);
+      }
+      new_merge_groups.push_back(s_merge_group);
+    }
+  }
+
+  // with random placement the merge groups carry no layout, so rebuild them before a stage,
+  // each run of num_of_stripes stripes is grown greedily from the smallest stripe id left,
+  // adding the stripe sharing the most clusters with the run, then the one adding the fewest new clusters,
+  // stripes no longer in the stripe table are dropped
+  void CoordinatorImpl::regroup_merge_stripes(int num_of_stripes)
+  {
+    int group_size = num_of_stripes;
+    if (!m_merge_groups.empty() && int(m_merge_groups[0].size()) % num_of_stripes == 0)
+    {
+      group_size = int(m_merge_groups[0].size());
+    }
+    std::set<int> remaining;
+    std::unordered_map<int, std::unordered_set<int>> stripes_in_cluster;
+    for (auto its = m_stripe_table.begin(); its != m_stripe_table.end(); its++)
+    {
+      remaining.insert(its->first);
+      for (auto itc = its->second.place2clusters.begin(); itc != its->second.place2clusters.end(); itc++)
+      {
+        stripes_in_cluster[*itc].insert(its->first);
+      }
+    }
+    auto take = [&](int stripe_id)
+    {
+      remaining.erase(stripe_id);
+      std::unordered_set<int> &clusters = m_stripe_table[stripe_id].place2clusters;
+      for (auto itc = clusters.begin(); itc != clusters.end(); itc++)
+      {
+        stripes_in_cluster[*itc].erase(stripe_id);
+      }
+    };
+
+    std::vector<std::vector<int>> new_merge_groups;
+    std::vector<int> t_group;
+    while (int(remaining.size()) >= num_of_stripes)
+    {
+      int seed = *remaining.begin();
+      take(seed);
+      t_group.push_back(seed);
+      std::unordered_set<int> run_clusters = m_stripe_table[seed].place2clusters;
+      std::unordered_map<int, int> shared; // stripe id, number of clusters shared with the run
+      for (auto itc = run_clusters.begin(); itc != run_clusters.end(); itc++)
+      {
+        for (auto it = stripes_in_cluster[*itc].begin(); it != stripes_in_cluster[*itc].end(); it++)
+        {
+          shared[*it]++;
+        }
+      }
+      for (int i = 1; i < num_of_stripes; i++)
+      {
+        int best = -1, best_shared = 0, best_extra = 0;
+        for (auto it = shared.begin(); it != shared.end(); it++)
+        {
+          int extra = int(m_stripe_table[it->first].place2clusters.size()) - it->second;
+          if (best == -1 || it->second > best_shared ||
+              (it->second == best_shared && (extra < best_extra || (extra == best_extra && it->first < best))))
+          {
+            best = it->first;
+            best_shared = it->second;
+            best_extra = extra;
+          }
+        }
+        if (best == -1)
+        {
+          best = *remaining.begin();
+        }
+        take(best);
+        shared.erase(best);
+        t_group.push_back(best);
+        std::unordered_set<int> &clusters = m_stripe_table[best].place2clusters;
+        for (auto itc = clusters.begin(); itc != clusters.end(); itc++)
+        {
+          if (run_clusters.insert(*itc).second)
+          {
+            for (auto it = stripes_in_cluster[*itc].begin(); it != stripes_in_cluster[*itc].end(); it++)
             {
-              int t_cluster_id = t_block->map2cluster;
-              t_block->block_id = cur_block_id++;
-              larger_stripe.blocks.push_back(t_block);
-              // for global parity block recalculation, find out the location of each data block
-              if (block_location.find(t_cluster_id) == block_location.end())
-              {
-                Cluster &t_cluster = m_cluster_table[t_cluster_id];
-                proxy_proto::locationInfo new_location;
-                new_location.set_cluster_id(t_cluster_id);
-                new_location.set_proxy_ip(t_cluster.proxy_ip);
-                new_location.set_proxy_port(t_cluster.proxy_port);
-                block_location[t_cluster_id] = new_location;
-              }
-              int t_node_id = t_block->map2node;
-              Node &t_node = m_node_table[t_node_id];
-              proxy_proto::locationInfo &t_location = block_location[t_cluster_id];
-              t_location.add_datanodeip(t_node.node_ip);
-              t_location.add_datanodeport(t_node.node_port);
-              t_location.add_blockkeys(t_block->block_key);
-              t_location.add_blockids(t_block->block_id);
-              update_stripe_info_in_node(true, t_block->map2node, l_stripe_id);
-              m_cluster_table[t_block->map2cluster].stripes.insert(l_stripe_id);
+              shared[*it]++;
             }
-            else if (t_block->block_type == 'L')
-            {
-              int t_cluster_id = t_block->map2cluster;
-              int t_gid = t_block->map2group;
-              l_cluster_id[t_gid] = t_block->map2cluster;
-              Node &l_node = m_node_table[t_block->map2node];
-              l_node_id.push_back(t_block->map2node);
-              l_recal_plan[t_gid].add_p_datanodeip(l_node.node_ip);
-              l_recal_plan[t_gid].add_p_datanodeport(l_node.node_port);
-              l_recal_plan[t_gid].add_p_blockkeys(t_block->block_key);
-              // for local parity block recalculation, find out the location of old local parities
-              if (parity_location[t_gid].find(t_cluster_id) == parity_location[t_gid].end())
+          }
+        }
+      }
+      if (int(t_group.size()) == group_size)
+      {
+        new_merge_groups.push_back(t_group);
+        t_group.clear();
+      }
+    }
+    if (!t_group.empty())
+    {
+      new_merge_groups.push_back(t_group);
+    }
+    m_merge_groups = new_merge_groups;
+  }
+
+  // plan a stage without sending the plans, and update the metadata as if merged
+  void CoordinatorImpl::simulate_merge_stage(int num_of_stripes, MergeTraffic &traffic, MergeSnapshot &snapshot)
+  {
+    std::vector<MergeBatch> batches;
+    std::vector<std::vector<int>> new_merge_groups;
+    std::vector<Block *> &new_blocks = snapshot.new_blocks;
+    plan_merge_stage(num_of_stripes, batches, new_merge_groups, &snapshot.next_stripe_id);
+    for (auto itb = batches.begin(); itb != batches.end(); itb++)
+    {
+      traffic.g_cross += itb->traffic.g_cross;
+      traffic.g_intra += itb->traffic.g_intra;
+      traffic.l_cross += itb->traffic.l_cross;
+      traffic.l_intra += itb->traffic.l_intra;
+      traffic.d_cross += itb->traffic.d_cross;
+      traffic.d_intra += itb->traffic.d_intra;
+      for (auto its = itb->old_stripe_ids.begin(); its != itb->old_stripe_ids.end(); its++)
+      {
+        m_stripe_table.erase(*its);
+      }
+      m_stripe_table[itb->larger_stripe.stripe_id] = itb->larger_stripe;
+      // the parity blocks of a larger stripe are newly allocated
+      for (auto itk = itb->larger_stripe.blocks.begin(); itk != itb->larger_stripe.blocks.end(); itk++)
+      {
+        if ((*itk)->block_type == 'L' || (*itk)->block_type == 'G')
+        {
+          new_blocks.push_back(*itk);
+        }
+      }
+    }
+    m_merge_groups = new_merge_groups;
+    m_merge_degree += 1;
+  }
+
+  void CoordinatorImpl::take_merge_snapshot(MergeSnapshot &snapshot)
+  {
+    snapshot.cluster_table = m_cluster_table;
+    snapshot.node_table = m_node_table;
+    snapshot.merge_groups = m_merge_groups;
+    snapshot.merge_degree = m_merge_degree;
+    snapshot.first_stripe_id = m_cur_stripe_id;
+    snapshot.next_stripe_id = snapshot.first_stripe_id;
+    snapshot.stripe_table.clear();
+    snapshot.blocks.clear();
+    // with random placement the groups are rebuilt from the whole stripe table, see regroup_merge_stripes
+    std::vector<int> stripe_ids;
+    if (m_encode_parameters.m_stripe_placementtype == Ran)
+    {
+      for (auto its = m_stripe_table.begin(); its != m_stripe_table.end(); its++)
+      {
+        stripe_ids.push_back(its->first);
+      }
+    }
+    else
+    {
+      for (auto it_g = m_merge_groups.begin(); it_g != m_merge_groups.end(); it_g++)
+      {
+        stripe_ids.insert(stripe_ids.end(), it_g->begin(), it_g->end());
+      }
+    }
+    for (auto it_s = stripe_ids.begin(); it_s != stripe_ids.end(); it_s++)
+    {
+      auto its = m_stripe_table.find(*it_s);
+      if (its == m_stripe_table.end())
+      {
+        continue;
+      }
+      snapshot.stripe_table[its->first] = its->second;
+      for (auto itb = its->second.blocks.begin(); itb != its->second.blocks.end(); itb++)
+      {
+        snapshot.blocks[*itb] = **itb;
+      }
+    }
+  }
+
+  // undo the simulated stages, the parity blocks created by them are freed
+  void CoordinatorImpl::restore_merge_snapshot(MergeSnapshot &snapshot)
+  {
+    for (auto itb = snapshot.new_blocks.begin(); itb != snapshot.new_blocks.end(); itb++)
+    {
+      m_block_arena.free(*itb);
+    }
+    snapshot.new_blocks.clear();
+    for (auto itb = snapshot.blocks.begin(); itb != snapshot.blocks.end(); itb++)
+    {
+      *(itb->first) = itb->second;
+    }
+    m_cluster_table = snapshot.cluster_table;
+    m_node_table = snapshot.node_table;
+    // the larger stripes of the simulated stages go, the merged ones come back
+    for (int i = snapshot.first_stripe_id; i < snapshot.next_stripe_id; i++)
+    {
+      m_stripe_table.erase(i);
+    }
+    snapshot.next_stripe_id = snapshot.first_stripe_id;
+    for (auto its = snapshot.stripe_table.begin(); its != snapshot.stripe_table.end(); its++)
+    {
+      m_stripe_table[its->first] = its->second;
+    }
+    m_merge_groups = snapshot.merge_groups;
+    m_merge_degree = snapshot.merge_degree;
+  }
+
+  void CoordinatorImpl::plan_merge_batch(std::vector<int> &stripe_ids, MergeBatch &batch, int l_stripe_id)
+  {
+    int l = m_encode_parameters.l_localparityblock;
+    int g_m = m_encode_parameters.g_m_globalparityblock;
+    EncodeType encodetype = m_encode_parameters.encodetype;
+    int num_of_stripes = int(stripe_ids.size());
+    int cur_block_id = 0;
+    batch.old_stripe_ids = stripe_ids;
+    batch.l_cluster_id.resize(l);
+    batch.parity_location.resize(l);
+    batch.l_main_plan.resize(l);
+    std::vector<int> &l_cluster_id = batch.l_cluster_id;
+    int &g_cluster_id = batch.g_cluster_id;
+    std::vector<int> l_node_id;
+    std::vector<int> g_node_id;
+
+    // for request
+    std::map<int, proxy_proto::locationInfo> &block_location = batch.block_location;
+    proxy_proto::mainRecalPlan l_recal_plan[l];
+    proxy_proto::mainRecalPlan &g_main_plan = batch.g_main_plan;
+    std::vector<std::map<int, proxy_proto::locationInfo>> &parity_location = batch.parity_location;
+    std::vector<proxy_proto::mainRecalPlan> &l_main_plan = batch.l_main_plan;
+    // old parities to delete, by group, the global ones at l
+    batch.old_parities.resize(l + 1);
+    batch.old_parities_cluster_set.resize(l + 1);
+    std::vector<proxy_proto::NodeAndBlock> &old_parities = batch.old_parities;
+    std::vector<std::unordered_set<int>> &old_parities_cluster_set = batch.old_parities_cluster_set;
+
+    int &block_size = batch.block_size;
+    // merge and generate new stripe information
+    Stripe &larger_stripe = batch.larger_stripe;
+    larger_stripe.stripe_id = l_stripe_id;
+    larger_stripe.k = 0; // the stripes to merge may differ in width, see append_merge
+    larger_stripe.l = m_encode_parameters.l_localparityblock;
+    larger_stripe.g_m = m_encode_parameters.g_m_globalparityblock;
+    // for each stripe
+    for (auto it_t = stripe_ids.begin(); it_t != stripe_ids.end(); it_t++)
+    {
+      int t_stripe_id = *(it_t);
+      Stripe &t_stripe = m_stripe_table[t_stripe_id];
+      larger_stripe.k += t_stripe.k;
+      larger_stripe.object_keys.insert(larger_stripe.object_keys.end(), t_stripe.object_keys.begin(), t_stripe.object_keys.end());
+      larger_stripe.object_sizes.insert(larger_stripe.object_sizes.end(), t_stripe.object_sizes.begin(), t_stripe.object_sizes.end());
+      std::vector<Block *>::iterator it_b;
+      // for each block
+      for (it_b = t_stripe.blocks.begin(); it_b != t_stripe.blocks.end(); it_b++)
+      {
+        Block *t_block = *it_b;
+        update_stripe_info_in_node(false, t_block->map2node, t_block->map2stripe);
+        m_cluster_table[t_block->map2cluster].stripes.erase(t_block->map2stripe);
+        update_block_stripe(t_block, l_stripe_id);
+        if (t_block->block_type == 'D')
+        {
+          int t_cluster_id = t_block->map2cluster;
+          t_block->block_id = cur_block_id++;
+          larger_stripe.blocks.push_back(t_block);
+          // for global parity block recalculation, find out the location of each data block
+          if (block_location.find(t_cluster_id) == block_location.end())
+          {
+            Cluster &t_cluster = m_cluster_table[t_cluster_id];
+            proxy_proto::locationInfo new_location;
+            new_location.set_cluster_id(t_cluster_id);
+            new_location.set_proxy_ip(t_cluster.proxy_ip);
+            new_location.set_proxy_port(t_cluster.proxy_port);
+            block_location[t_cluster_id] = new_location;
+          }
+          int t_node_id = t_block->map2node;
+          Node &t_node = m_node_table[t_node_id];
+          proxy_proto::locationInfo &t_location = block_location[t_cluster_id];
+          t_location.add_datanodeip(t_node.node_ip);
+          t_location.add_datanodeport(t_node.node_port);
+          t_location.add_blockkeys(t_block->block_key());
+          t_location.add_blockids(t_block->block_id);
+          t_location.add_groupids(t_block->map2group);
+          update_stripe_info_in_node(true, t_block->map2node, l_stripe_id);
+          m_cluster_table[t_block->map2cluster].stripes.insert(l_stripe_id);
+        }
+        else if (t_block->block_type == 'L')
+        {
+          int t_cluster_id = t_block->map2cluster;
+          int t_gid = t_block->map2group;
+          l_cluster_id[t_gid] = t_block->map2cluster;
+          Node &l_node = m_node_table[t_block->map2node];
+          l_node_id.push_back(t_block->map2node);
+          l_recal_plan[t_gid].add_p_datanodeip(l_node.node_ip);
+          l_recal_plan[t_gid].add_p_datanodeport(l_node.node_port);
+          l_recal_plan[t_gid].add_p_blockkeys(t_block->block_key());
+          // for local parity block recalculation, find out the location of old local parities
+          if (parity_location[t_gid].find(t_cluster_id) == parity_location[t_gid].end())
+          {
+            Cluster &t_cluster = m_cluster_table[t_cluster_id];
+            proxy_proto::locationInfo new_location;
+            new_location.set_cluster_id(t_cluster_id);
+            new_location.set_proxy_ip(t_cluster.proxy_ip);
+            new_location.set_proxy_port(t_cluster.proxy_port);
+            parity_location[t_gid][t_cluster_id] = new_location;
+          }
+          proxy_proto::locationInfo &t_location = parity_location[t_gid][t_cluster_id];
+          t_location.add_datanodeip(l_node.node_ip);
+          t_location.add_datanodeport(l_node.node_port);
+          t_location.add_blockkeys(t_block->block_key());
+          t_location.add_blockids(t_block->block_id);
+          // remove the old local parity block from the cluster
+          remove_block_from_cluster(t_block->map2cluster, t_block);
+          batch.old_parity_blocks.push_back(t_block);
+          // for delete
+          old_parities[t_gid].add_datanodeip(l_node.node_ip);
+          old_parities[t_gid].add_datanodeport(l_node.node_port);
+          old_parities[t_gid].add_blockkeys(t_block->block_key());
+          old_parities_cluster_set[t_gid].insert(t_block->map2cluster);
+        }
+        else if (t_block->block_type == 'G')
+        {
+          // for global parity block recalculation
+          g_cluster_id = t_block->map2cluster;
+          Node &g_node = m_node_table[t_block->map2node];
+          g_node_id.push_back(t_block->map2node);
+          // g_main_plan.add_p_datanodeip(g_node.node_ip);
+          // g_main_plan.add_p_datanodeport(g_node.node_port);
+          // g_main_plan.add_p_blockkeys(t_block->block_key());
+          // for local parity block recalculation of Optimal Cauchy LRC
+          // find out the location of old global parities
+          if (encodetype == Optimal_Cauchy_LRC){
+            for (int t_gid = 0; t_gid < l; t_gid++){
+              if (parity_location[t_gid].find(g_cluster_id) == parity_location[t_gid].end())
               {
-                Cluster &t_cluster = m_cluster_table[t_cluster_id];
+                Cluster &t_cluster = m_cluster_table[g_cluster_id];
                 proxy_proto::locationInfo new_location;
-                new_location.set_cluster_id(t_cluster_id);
+                new_location.set_cluster_id(g_cluster_id);
                 new_location.set_proxy_ip(t_cluster.proxy_ip);
                 new_location.set_proxy_port(t_cluster.proxy_port);
-                parity_location[t_gid][t_cluster_id] = new_location;
+                parity_location[t_gid][g_cluster_id] = new_location;
               }
-              proxy_proto::locationInfo &t_location = parity_location[t_gid][t_cluster_id];
-              t_location.add_datanodeip(l_node.node_ip);
-              t_location.add_datanodeport(l_node.node_port);
-              t_location.add_blockkeys(t_block->block_key);
+              proxy_proto::locationInfo &t_location = parity_location[t_gid][g_cluster_id];
+              t_location.add_datanodeip(g_node.node_ip);
+              t_location.add_datanodeport(g_node.node_port);
+              t_location.add_blockkeys(t_block->block_key());
               t_location.add_blockids(t_block->block_id);
-              // remove the old local parity block from the cluster
-              Cluster &l_cluster = m_cluster_table[t_block->map2cluster];
-              for (it_c = l_cluster.blocks.begin(); it_c != l_cluster.blocks.end(); it_c++)
-              {
-                if ((*it_c)->block_key == t_block->block_key)
-                {
-                  l_cluster.blocks.erase(it_c);
-                  break;
-                }
-              }
-              // for delete
-              old_parities.add_datanodeip(l_node.node_ip);
-              old_parities.add_datanodeport(l_node.node_port);
-              old_parities.add_blockkeys(t_block->block_key);
-              old_parities_cluster_set.insert(t_block->map2cluster);
-            }
-            else if (t_block->block_type == 'G')
-            {
-              // for global parity block recalculation
-              g_cluster_id = t_block->map2cluster;
-              Node &g_node = m_node_table[t_block->map2node];
-              g_node_id.push_back(t_block->map2node);
-              // g_main_plan.add_p_datanodeip(g_node.node_ip);
-              // g_main_plan.add_p_datanodeport(g_node.node_port);
-              // g_main_plan.add_p_blockkeys(t_block->block_key);
-              // for local parity block recalculation of Optimal Cauchy LRC
-              // find out the location of old global parities
-              if (encodetype == Optimal_Cauchy_LRC){
-                for (int t_gid = 0; t_gid < l; t_gid++){
-                  if (parity_location[t_gid].find(g_cluster_id) == parity_location[t_gid].end())
-                  {
-                    Cluster &t_cluster = m_cluster_table[g_cluster_id];
-                    proxy_proto::locationInfo new_location;
-                    new_location.set_cluster_id(g_cluster_id);
-                    new_location.set_proxy_ip(t_cluster.proxy_ip);
-                    new_location.set_proxy_port(t_cluster.proxy_port);
-                    parity_location[t_gid][g_cluster_id] = new_location;
-                  }
-                  proxy_proto::locationInfo &t_location = parity_location[t_gid][g_cluster_id];
-                  t_location.add_datanodeip(g_node.node_ip);
-                  t_location.add_datanodeport(g_node.node_port);
-                  t_location.add_blockkeys(t_block->block_key);
-                  t_location.add_blockids(t_block->block_id);
-                }
-              }
-              // remove the old global parity block from the cluster
-              Cluster &g_cluster = m_cluster_table[t_block->map2cluster];
-              for (it_c = g_cluster.blocks.begin(); it_c != g_cluster.blocks.end(); it_c++)
-              {
-                if ((*it_c)->block_key == t_block->block_key)
-                {
-                  g_cluster.blocks.erase(it_c);
-                  break;
-                }
-              }
-              // for delete
-              old_parities.add_datanodeip(g_node.node_ip);
-              old_parities.add_datanodeport(g_node.node_port);
-              old_parities.add_blockkeys(t_block->block_key);
-              old_parities_cluster_set.insert(t_block->map2cluster);
             }
-            block_size = t_block->block_size;
           }
-          larger_stripe.place2clusters.insert(t_stripe.place2clusters.begin(), t_stripe.place2clusters.end());
+          // remove the old global parity block from the cluster
+          remove_block_from_cluster(t_block->map2cluster, t_block);
+          batch.old_parity_blocks.push_back(t_block);
+          // for delete
+          old_parities[l].add_datanodeip(g_node.node_ip);
+          old_parities[l].add_datanodeport(g_node.node_port);
+          old_parities[l].add_blockkeys(t_block->block_key());
+          old_parities_cluster_set[l].insert(t_block->map2cluster);
         }
-        if (IF_DEBUG)
+        block_size = t_block->block_size;
+      }
+      larger_stripe.place2clusters.insert(t_stripe.place2clusters.begin(), t_stripe.place2clusters.end());
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << std::endl;
+      std::cout << "l_cluster_id : ";
+      for (int i = 0; i < l; i++)
+      {
+        std::cout << l_cluster_id[i] << " ";
+      }
+      std::cout << std::endl;
+      std::cout << "l_node_id : ";
+      for (int i = 0; i < int(l_node_id.size()); i++)
+      {
+        std::cout << l_node_id[i] << " ";
+      }
+      std::cout << std::endl;
+      std::cout << "g_cluster_id : " << g_cluster_id << std::endl;
+      std::cout << "g_node_id : ";
+      for (int i = 0; i < int(g_node_id.size()); i++)
+      {
+        std::cout << g_node_id[i] << " ";
+      }
+      std::cout << std::endl;
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << "\033[1;33m[MERGE] Select cluster and node to place new parity blocks:\033[0m" << std::endl;
+    }
+    // generate new parity block
+    for (int i = 0; i < l; i++)
+    {
+      std::string t_block_key = "Stripe" + std::to_string(l_stripe_id) + "_L" + std::to_string(i);
+      int t_map2cluster = l_cluster_id[i];
+      int t_map2node = l_node_id[l * (num_of_stripes - 1) + i];
+      int t_block_id = larger_stripe.k + g_m + i;
+      Block *t_block = m_block_arena.alloc(Block(t_block_id, l_stripe_id, i, 'L', block_size, i, l_stripe_id, t_map2cluster, t_map2node, nullptr));
+      if (IF_DEBUG)
+      {
+        std::cout << "\033[1;33m" << t_block->block_key() << ": Cluster" << t_block->map2cluster << ", Node" << t_block->map2node << "\033[0m" << std::endl;
+      }
+      larger_stripe.blocks.push_back(t_block);
+      update_stripe_info_in_node(true, t_map2node, l_stripe_id);
+      m_cluster_table[t_map2cluster].stripes.insert(l_stripe_id);
+      Cluster &t_cluster = m_cluster_table[t_map2cluster];
+      add_block_to_cluster(t_block);
+      auto it = std::find(t_cluster.nodes.begin(), t_cluster.nodes.end(), t_map2node);
+      if (it == t_cluster.nodes.end())
+      {
+        std::cout << "[Generate new parity block] the selected node not in the selected cluster!" << std::endl;
+      }
+      // for local parity block recalculation, the location of the new parities
+      Node &l_node = m_node_table[t_map2node];
+      l_main_plan[i].add_p_datanodeip(l_node.node_ip);
+      l_main_plan[i].add_p_datanodeport(l_node.node_port);
+      l_main_plan[i].add_p_blockkeys(t_block_key);
+    }
+    for (int i = 0; i < g_m; i++)
+    {
+      std::string t_block_key = "Stripe" + std::to_string(l_stripe_id) + "_G" + std::to_string(i);
+      int t_map2node = g_node_id[g_m * (num_of_stripes - 1) + i];
+      int t_block_id = larger_stripe.k + i;
+      Block *t_block = m_block_arena.alloc(Block(t_block_id, l_stripe_id, i, 'G', block_size, l, l_stripe_id, g_cluster_id, t_map2node, nullptr));
+      if (IF_DEBUG)
+      {
+        std::cout << "\033[1;33m" << t_block->block_key() << ": Cluster" << t_block->map2cluster << ", Node" << t_block->map2node << "\033[0m" << std::endl;
+      }
+      larger_stripe.blocks.push_back(t_block);
+      update_stripe_info_in_node(true, t_map2node, l_stripe_id);
+      m_cluster_table[g_cluster_id].stripes.insert(l_stripe_id);
+      Cluster &t_cluster = m_cluster_table[g_cluster_id];
+      add_block_to_cluster(t_block);
+      auto it = std::find(t_cluster.nodes.begin(), t_cluster.nodes.end(), t_map2node);
+      if (it == t_cluster.nodes.end())
+      {
+        std::cout << "[Generate new parity block] the selected node not in the selected cluster!" << std::endl;
+      }
+      // for global parity block recalculation, the location of the new parities
+      Node &g_node = m_node_table[t_map2node];
+      g_main_plan.add_p_datanodeip(g_node.node_ip);
+      g_main_plan.add_p_datanodeport(g_node.node_port);
+      g_main_plan.add_p_blockkeys(t_block_key);
+      // for local parity block recalculation of Optimal Cauchy LRC, derive new global parities
+      if (encodetype == Optimal_Cauchy_LRC){
+        for (int t_gid = 0; t_gid < l; t_gid++){
+          proxy_proto::locationInfo &t_location = parity_location[t_gid][g_cluster_id];
+          t_location.add_datanodeip(g_node.node_ip);
+          t_location.add_datanodeport(g_node.node_port);
+          t_location.add_blockkeys(t_block_key);
+          t_location.add_blockids(t_block_id);
+        }
+      }
+    }
+
+    if (IF_DEBUG)
+    {
+      // print the result
+      std::cout << std::endl;
+      std::cout << "Data placement before data block relocation:" << std::endl;
+      for (int i = 0; i < m_num_of_Clusters; i++)
+      {
+        Cluster &t_cluster = m_cluster_table[i];
+        if (int(t_cluster.blocks.size()) > 0)
         {
-          std::cout << std::endl;
-          std::cout << "l_cluster_id : ";
-          for (int i = 0; i < l; i++)
+          std::cout << "Cluster " << i << ": ";
+          for (auto it = t_cluster.blocks.begin(); it != t_cluster.blocks.end(); it++)
           {
-            std::cout << l_cluster_id[i] << " ";
+            std::cout << "[" << (*it)->block_key() << ":S" << (*it)->map2stripe << "G" << (*it)->map2group << "N" << (*it)->map2node << "] ";
           }
           std::cout << std::endl;
-          std::cout << "l_node_id : ";
-          for (int i = 0; i < int(l_node_id.size()); i++)
+        }
+      }
+      std::cout << std::endl;
+    }
+
+    // find out the data blocks to relocate
+    int &num2mov_v = batch.num2mov_v, &num2mov_k = batch.num2mov_k;
+    std::unordered_set<int>::iterator it;
+    std::vector<std::string> &block_to_move_key = batch.block_to_move_key;
+    std::vector<int> &block_src_node = batch.block_src_node;
+    std::vector<int> &block_des_node = batch.block_des_node;
+    std::vector<int> &block_to_move_group = batch.block_to_move_group;
+    std::unordered_set<int> new_cluster_set;
+    // the blocks that voilate single-cluster fault tolerance
+    for (it = larger_stripe.place2clusters.begin(); it != larger_stripe.place2clusters.end(); it++)
+    {
+      std::map<char, std::vector<ECProject::Block *>> block_info;
+      int t_cluster_id = *it;
+      blocks_in_cluster(block_info, t_cluster_id, l_stripe_id);
+      int nt = block_info['T'].size(); // num of blocks from the xi stripes in the cluster
+      int nd = block_info['D'].size(); // num of data blocks
+      int nl = block_info['L'].size(); // num of local parity blocks
+      int ng = block_info['G'].size(); // num of global parity blocks
+      if (IF_DEBUG)
+      {
+        std::cout << "\033[1;31m";
+        std::cout << "(Blocks number)Cluster" << t_cluster_id << ",Stripe" << l_stripe_id << ": total-" << nt << " data-" << nd << " local-" << nl << " global-" << ng;
+        std::cout << "\033[0m" << std::endl;
+      }
+      int max_group_id = -1;
+      int max_group_num = 0;
+      find_max_group(max_group_id, max_group_num, t_cluster_id, l_stripe_id);
+      std::vector<ECProject::Block *> block_to_move;
+      std::vector<ECProject::Block *>::iterator it_b;
+      int num_to_move = 0;
+      if (ng > 0 && nd > 0) // move the other blocks except global parity blocks, when there is any data block
+      {
+        if (IF_DEBUG)
+        {
+          std::cout << "\033[1;35mCase 1\033[0m\n";
+        }
+        for (it_b = block_info['D'].begin(); it_b != block_info['D'].end(); it_b++)
+        {
+          block_to_move.push_back(*it_b);
+        }
+        for (it_b = block_info['L'].begin(); it_b != block_info['L'].end(); it_b++)
+        {
+          block_to_move.push_back(*it_b);
+        }
+        num_to_move = nd + nl;
+      }
+      else if (nt > g_m + 1 && nd > 0) // remain the blocks from the group with maximum number of blocks in the cluster, but the remaining number can't exceed g+1
+      {
+        if (IF_DEBUG)
+        {
+          std::cout << "\033[1;35mCase 2\033[0m\n";
+        }
+        int m_cnt = 0;
+        if (max_group_num >= g_m + 1)
+        {
+          num_to_move = nt - g_m - 1;
+          m_cnt = max_group_num - g_m - 1;
+        }
+        else
+        {
+          num_to_move = nt - max_group_num;
+        }
+        for (it_b = block_info['T'].begin(); it_b != block_info['T'].end(); it_b++)
+        {
+          if ((*it_b)->map2group != max_group_id)
           {
-            std::cout << l_node_id[i] << " ";
+            block_to_move.push_back(*it_b);
           }
-          std::cout << std::endl;
-          std::cout << "g_cluster_id : " << g_cluster_id << std::endl;
-          std::cout << "g_node_id : ";
-          for (int i = 0; i < int(g_node_id.size()); i++)
+          else if (m_cnt && (*it_b)->map2group == max_group_id)
           {
-            std::cout << g_node_id[i] << " ";
+            block_to_move.push_back(*it_b);
+            m_cnt--;
           }
-          std::cout << std::endl;
         }
+      }
+      else if (nt != max_group_num && nd > 0) //// remain the blocks from the group with maximum number of blocks in the cluster
+      {
         if (IF_DEBUG)
         {
-          std::cout << "\033[1;33m[MERGE] Select cluster and node to place new parity blocks:\033[0m" << std::endl;
+          std::cout << "\033[1;35mCase 3\033[0m\n";
         }
-        // generate new parity block
-        for (int i = 0; i < l; i++)
+        num_to_move = nt - max_group_num;
+        for (it_b = block_info['T'].begin(); it_b != block_info['T'].end(); it_b++)
         {
-          std::string t_block_key = "Stripe" + std::to_string(l_stripe_id) + "_L" + std::to_string(i);
-          int t_map2cluster = l_cluster_id[i];
-          int t_map2node = l_node_id[l * (num_of_stripes - 1) + i];
-          int t_block_id = larger_stripe.k + g_m + i;
-          Block *t_block = new Block(t_block_id, t_block_key, 'L', block_size, i, l_stripe_id, t_map2cluster, t_map2node, "");
-          if (IF_DEBUG)
+          if (int((*it_b)->map2group) != max_group_id)
           {
-            std::cout << "\033[1;33m" << t_block->block_key << ": Cluster" << t_block->map2cluster << ", Node" << t_block->map2node << "\033[0m" << std::endl;
+            block_to_move.push_back(*it_b);
           }
-          larger_stripe.blocks.push_back(t_block);
-          update_stripe_info_in_node(true, t_map2node, l_stripe_id);
-          m_cluster_table[t_map2cluster].stripes.insert(l_stripe_id);
-          Cluster &t_cluster = m_cluster_table[t_map2cluster];
-          t_cluster.blocks.push_back(t_block);
-          auto it = std::find(t_cluster.nodes.begin(), t_cluster.nodes.end(), t_map2node);
-          if (it == t_cluster.nodes.end())
-          {
-            std::cout << "[Generate new parity block] the selected node not in the selected cluster!" << std::endl;
-          }
-          // for local parity block recalculation, the location of the new parities
-          Node &l_node = m_node_table[t_map2node];
-          l_main_plan[i].add_p_datanodeip(l_node.node_ip);
-          l_main_plan[i].add_p_datanodeport(l_node.node_port);
-          l_main_plan[i].add_p_blockkeys(t_block_key);
-        }
-        for (int i = 0; i < g_m; i++)
-        {
-          std::string t_block_key = "Stripe" + std::to_string(l_stripe_id) + "_G" + std::to_string(i);
-          int t_map2node = g_node_id[g_m * (num_of_stripes - 1) + i];
-          int t_block_id = larger_stripe.k + i;
-          Block *t_block = new Block(t_block_id, t_block_key, 'G', block_size, l, l_stripe_id, g_cluster_id, t_map2node, "");
-          if (IF_DEBUG)
+        }
+      }
+      if (num_to_move != int(block_to_move.size()))
+      {
+        std::cout << "[MERGE] Error! number of blocks to move not matches!" << std::endl;
+      }
+      // find destination cluster and node for each block
+      for (it_b = block_to_move.begin(); it_b != block_to_move.end(); it_b++)
+      {
+        block_to_move_key.push_back((*it_b)->block_key());
+        block_to_move_group.push_back((*it_b)->block_type == 'L' ? int((*it_b)->map2group) : -1);
+        block_src_node.push_back((*it_b)->map2node);
+        bool flag_m = false;
+        std::unordered_set<int>::iterator it_a;
+        for (it_a = larger_stripe.place2clusters.begin(); it_a != larger_stripe.place2clusters.end(); it_a++)
+        {
+          int t_cid = *it_a;
+          if (t_cid != t_cluster_id)
           {
-            std::cout << "\033[1;33m" << t_block->block_key << ": Cluster" << t_block->map2cluster << ", Node" << t_block->map2node << "\033[0m" << std::endl;
-          }
-          larger_stripe.blocks.push_back(t_block);
-          update_stripe_info_in_node(true, t_map2node, l_stripe_id);
-          m_cluster_table[g_cluster_id].stripes.insert(l_stripe_id);
-          Cluster &t_cluster = m_cluster_table[g_cluster_id];
-          t_cluster.blocks.push_back(t_block);
-          auto it = std::find(t_cluster.nodes.begin(), t_cluster.nodes.end(), t_map2node);
-          if (it == t_cluster.nodes.end())
-          {
-            std::cout << "[Generate new parity block] the selected node not in the selected cluster!" << std::endl;
-          }
-          // for global parity block recalculation, the location of the new parities
-          Node &g_node = m_node_table[t_map2node];
-          g_main_plan.add_p_datanodeip(g_node.node_ip);
-          g_main_plan.add_p_datanodeport(g_node.node_port);
-          g_main_plan.add_p_blockkeys(t_block_key);
-          // for local parity block recalculation of Optimal Cauchy LRC, derive new global parities
-          if (encodetype == Optimal_Cauchy_LRC){
-            for (int t_gid = 0; t_gid < l; t_gid++){
-              proxy_proto::locationInfo &t_location = parity_location[t_gid][g_cluster_id];
-              t_location.add_datanodeip(g_node.node_ip);
-              t_location.add_datanodeport(g_node.node_port);
-              t_location.add_blockkeys(t_block_key);
-              t_location.add_blockids(t_block_id);
+            max_group_id = -1;
+            max_group_num = 0;
+            int block_num = count_block_num('T', t_cid, l_stripe_id, -1);
+            find_max_group(max_group_id, max_group_num, t_cid, l_stripe_id);
+            if (!find_block('G', t_cid, l_stripe_id) && 0 < block_num && block_num < g_m + 1 && int((*it_b)->map2group) == max_group_id)
+            {
+              update_stripe_info_in_node(false, (*it_b)->map2node, (*it_b)->map2stripe);
+              int r_node_id = randomly_select_a_node(t_cid, l_stripe_id);
+              (*it_b)->map2cluster = t_cid;
+              (*it_b)->map2node = r_node_id;
+              remove_block_from_cluster(t_cluster_id, *it_b);
+              add_block_to_cluster(*it_b);
+              block_des_node.push_back((*it_b)->map2node);
+              update_stripe_info_in_node(true, (*it_b)->map2node, l_stripe_id);
+              m_cluster_table[(*it_b)->map2cluster].stripes.insert(l_stripe_id);
+              flag_m = true;
+              break;
             }
           }
         }
-
-        if (IF_DEBUG)
+        if (!flag_m)
         {
-          // print the result
-          std::cout << std::endl;
-          std::cout << "Data placement before data block relocation:" << std::endl;
-          for (int i = 0; i < m_num_of_Clusters; i++)
+          for (it_a = new_cluster_set.begin(); it_a != new_cluster_set.end(); it_a++)
           {
-            Cluster &t_cluster = m_cluster_table[i];
-            if (int(t_cluster.blocks.size()) > 0)
+            int t_cid = *it_a;
+            if (t_cid != t_cluster_id)
             {
-              std::cout << "Cluster " << i << ": ";
-              for (auto it = t_cluster.blocks.begin(); it != t_cluster.blocks.end(); it++)
+              max_group_id = -1;
+              max_group_num = 0;
+              int block_num = count_block_num('T', t_cid, l_stripe_id, -1);
+              find_max_group(max_group_id, max_group_num, t_cid, l_stripe_id);
+              if (!find_block('G', t_cid, l_stripe_id) && block_num > 0 && block_num < g_m + 1 && (*it_b)->map2group == max_group_id)
               {
-                std::cout << "[" << (*it)->block_key << ":S" << (*it)->map2stripe << "G" << (*it)->map2group << "N" << (*it)->map2node << "] ";
+                update_stripe_info_in_node(false, (*it_b)->map2node, (*it_b)->map2stripe);
+                int r_node_id = randomly_select_a_node(t_cid, l_stripe_id);
+                (*it_b)->map2cluster = t_cid;
+                (*it_b)->map2node = r_node_id;
+                remove_block_from_cluster(t_cluster_id, *it_b);
+                add_block_to_cluster(*it_b);
+                block_des_node.push_back((*it_b)->map2node);
+                update_stripe_info_in_node(true, (*it_b)->map2node, l_stripe_id);
+                m_cluster_table[(*it_b)->map2cluster].stripes.insert(l_stripe_id);
+                flag_m = true;
+                break;
               }
-              std::cout << std::endl;
             }
           }
-          std::cout << std::endl;
         }
+        if (!flag_m) // select an new cluster and place into it
+        {
+          int t_cid = randomly_select_a_cluster(l_stripe_id, [this, l_stripe_id](int cluster_id)
+                                                { return count_block_num('T', cluster_id, l_stripe_id, -1) == 0; });
+          if (t_cid == -1)
+          {
+            // the block stays where it is
+            std::cout << "[MERGE] reloc1 : can't find out a des-cluster to move block " << (*it_b)->block_key() << std::endl;
+            block_to_move_key.pop_back();
+            block_to_move_group.pop_back();
+            block_src_node.pop_back();
+            continue;
+          }
+          update_stripe_info_in_node(false, (*it_b)->map2node, (*it_b)->map2stripe);
+          int r_node_id = randomly_select_a_node(t_cid, l_stripe_id);
+          (*it_b)->map2cluster = t_cid;
+          (*it_b)->map2node = r_node_id;
+          remove_block_from_cluster(t_cluster_id, *it_b);
+          add_block_to_cluster(*it_b);
+          block_des_node.push_back((*it_b)->map2node);
+          update_stripe_info_in_node(true, (*it_b)->map2node, l_stripe_id);
+          m_cluster_table[(*it_b)->map2cluster].stripes.insert(l_stripe_id);
+          flag_m = true;
+          new_cluster_set.insert(t_cid);
+        }
+        if (!flag_m)
+        {
+          std::cout << "[MERGE] reloc1 : can't find out a des-cluster to move block " << (*it_b)->block_key() << std::endl;
+        }
+      }
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << "[MERGE] voilated blocks to relocate:";
+      for (int ii = 0; ii < int(block_to_move_key.size()); ii++)
+      {
+        std::cout << block_to_move_key[ii] << "[" << block_src_node[ii] << "->" << block_des_node[ii] << "] ";
+      }
+      std::cout << std::endl;
+    }
+    larger_stripe.place2clusters.insert(new_cluster_set.begin(), new_cluster_set.end());
+    num2mov_v = int(block_to_move_key.size());
 
-        // find out the data blocks to relocate
-        int num2mov_v = 0, num2mov_k = 0;
-        std::unordered_set<int>::iterator it;
-        std::vector<std::string> block_to_move_key;
-        std::vector<int> block_src_node;
-        std::vector<int> block_des_node;
-        std::unordered_set<int> new_cluster_set;
-        // the blocks that voilate single-cluster fault tolerance
-        for (it = larger_stripe.place2clusters.begin(); it != larger_stripe.place2clusters.end(); it++)
-        {
-          std::map<char, std::vector<ECProject::Block *>> block_info;
-          int t_cluster_id = *it;
-          Cluster &t_cluster = m_cluster_table[t_cluster_id];
-          blocks_in_cluster(block_info, t_cluster_id, l_stripe_id);
-          int nt = block_info['T'].size(); // num of blocks from the xi stripes in the cluster
-          int nd = block_info['D'].size(); // num of data blocks
-          int nl = block_info['L'].size(); // num of local parity blocks
-          int ng = block_info['G'].size(); // num of global parity blocks
-          if (IF_DEBUG)
+    // to keep each locap group placed in fewest cluster
+    int bi = larger_stripe.k / larger_stripe.l;
+    int c_a = ceil(bi + 1, g_m + 1);
+    for (int i = 0; i < larger_stripe.l; i++) // for each local group
+    {
+      int c_b = 0;
+      std::vector<int> block_from_group_in_cluster;
+      // std::cout << "\033[1;31m";
+      for (int j = 0; j < m_num_of_Clusters; j++)
+      {
+        int b_cnt = count_block_num('T', j, l_stripe_id, i);
+        if (b_cnt > 0)
+          c_b++;
+        block_from_group_in_cluster.push_back(b_cnt);
+        // std::cout << j << ":" << b_cnt << " ";
+      }
+      // std::cout << "\033[0m" << std::endl;
+      if (c_b > c_a)
+      {
+        if (IF_DEBUG)
+        {
+          std::cout << "\033[1;31m[MERGE] Group " << i << " Cluster number: actual-" << c_b << " expected-" << c_a << "\033[0m" << std::endl;
+        }
+        int c_m = c_b - c_a;
+        auto idxs = argsort(block_from_group_in_cluster);
+        std::vector<int> del_cluster;
+        int c_cnt = 0;
+        int idx = 0;
+        while (c_cnt < c_m)
+        {
+          if (block_from_group_in_cluster[idxs[idx]] > 0)
           {
-            std::cout << "\033[1;31m";
-            std::cout << "(Blocks number)Cluster" << t_cluster_id << ",Stripe" << l_stripe_id << ": total-" << nt << " data-" << nd << " local-" << nl << " global-" << ng;
-            std::cout << "\033[0m" << std::endl;
+            del_cluster.push_back(idxs[idx]);
+            c_cnt++;
           }
-          int max_group_id = -1;
-          int max_group_num = 0;
-          find_max_group(max_group_id, max_group_num, t_cluster_id, l_stripe_id);
-          std::vector<ECProject::Block *> block_to_move;
-          std::vector<ECProject::Block *>::iterator it_b, it_c;
-          int num_to_move = 0;
-          if (ng > 0 && nd > 0) // move the other blocks except global parity blocks, when there is any data block
+          idx++;
+        }
+        std::vector<ECProject::Block *> block_to_move;
+        std::vector<ECProject::Block *>::iterator it_b;
+        for (int j = 0; j < int(del_cluster.size()); j++)
+        {
+          int t_cluster_id = del_cluster[j];
+          std::vector<Block *> &t_stripe_blocks = m_cluster_table[t_cluster_id].stripe_blocks[l_stripe_id];
+          for (it_b = t_stripe_blocks.begin(); it_b != t_stripe_blocks.end(); it_b++)
           {
-            if (IF_DEBUG)
-            {
-              std::cout << "\033[1;35mCase 1\033[0m\n";
-            }
-            for (it_b = block_info['D'].begin(); it_b != block_info['D'].end(); it_b++)
+            if (int((*it_b)->map2group) == i)
             {
-              block_to_move.push_back(*it_b);
+              block_to_move.push_back((*it_b));
             }
-            for (it_b = block_info['L'].begin(); it_b != block_info['L'].end(); it_b++)
-            {
-              block_to_move.push_back(*it_b);
-            }
-            num_to_move = nd + nl;
           }
-          else if (nt > g_m + 1 && nd > 0) // remain the blocks from the group with maximum number of blocks in the cluster, but the remaining number can't exceed g+1
+        }
+        // find destination cluster and node for each moved block
+        for (it_b = block_to_move.begin(); it_b != block_to_move.end(); it_b++)
+        {
+          int t_cluster_id = (*it_b)->map2cluster;
+          block_to_move_key.push_back((*it_b)->block_key());
+          block_to_move_group.push_back((*it_b)->block_type == 'L' ? int((*it_b)->map2group) : -1);
+          block_src_node.push_back((*it_b)->map2node);
+          bool flag_m = false;
+          std::unordered_set<int>::iterator it_a;
+          for (it_a = larger_stripe.place2clusters.begin(); it_a != larger_stripe.place2clusters.end(); it_a++)
           {
-            if (IF_DEBUG)
-            {
-              std::cout << "\033[1;35mCase 2\033[0m\n";
-            }
-            int m_cnt = 0;
-            if (max_group_num >= g_m + 1)
-            {
-              num_to_move = nt - g_m - 1;
-              m_cnt = max_group_num - g_m - 1;
-            }
-            else
-            {
-              num_to_move = nt - max_group_num;
-            }
-            for (it_b = block_info['T'].begin(); it_b != block_info['T'].end(); it_b++)
+            int t_cid = *it_a;
+            if (t_cid != t_cluster_id)
             {
-              if ((*it_b)->map2group != max_group_id)
+              int max_group_id = -1, max_group_num = 0;
+              int block_num = count_block_num('T', t_cid, l_stripe_id, -1);
+              find_max_group(max_group_id, max_group_num, t_cid, l_stripe_id);
+              if (!find_block('G', t_cid, l_stripe_id) && block_num > 0 && block_num < g_m + 1 && (*it_b)->map2group == max_group_id)
               {
-                block_to_move.push_back(*it_b);
-              }
-              else if (m_cnt && (*it_b)->map2group == max_group_id)
-              {
-                block_to_move.push_back(*it_b);
-                m_cnt--;
+                update_stripe_info_in_node(false, (*it_b)->map2node, (*it_b)->map2stripe);
+                int r_node_id = randomly_select_a_node(t_cid, l_stripe_id);
+                (*it_b)->map2cluster = t_cid;
+                (*it_b)->map2node = r_node_id;
+                remove_block_from_cluster(t_cluster_id, *it_b);
+                add_block_to_cluster(*it_b);
+                block_des_node.push_back((*it_b)->map2node);
+                update_stripe_info_in_node(true, (*it_b)->map2node, l_stripe_id);
+                m_cluster_table[(*it_b)->map2cluster].stripes.insert(l_stripe_id);
+                flag_m = true;
+                break;
               }
             }
           }
-          else if (nt != max_group_num && nd > 0) //// remain the blocks from the group with maximum number of blocks in the cluster
+          if (!flag_m)
           {
-            if (IF_DEBUG)
-            {
-              std::cout << "\033[1;35mCase 3\033[0m\n";
-            }
-            num_to_move = nt - max_group_num;
-            for (it_b = block_info['T'].begin(); it_b != block_info['T'].end(); it_b++)
-            {
-              if (int((*it_b)->map2group) != max_group_id)
-              {
-                block_to_move.push_back(*it_b);
-              }
-            }
+            // the block stays where it is
+            std::cout << "[MERGE] reloc2 : can't find out a des-cluster to move block " << (*it_b)->block_key() << std::endl;
+            block_to_move_key.pop_back();
+            block_to_move_group.pop_back();
+            block_src_node.pop_back();
           }
-          if (num_to_move != int(block_to_move.size()))
+        }
+      }
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << "[MERGE] all blocks to relocate:";
+      for (int ii = 0; ii < int(block_to_move_key.size()); ii++)
+      {
+        std::cout << block_to_move_key[ii] << "[" << block_src_node[ii] << "->" << block_des_node[ii] << "] ";
+      }
+      std::cout << std::endl;
+    }
+    num2mov_k = int(block_to_move_key.size()) - num2mov_v;
+
+    // remove the 'empty' cluster from the set
+    // std::vector<int> empty_clusters;
+    std::unordered_set<int>::iterator it_a;
+    if (IF_DEBUG)
+    {
+      std::cout << "[MERGE] Clusters that places Stripe " << l_stripe_id << ":";
+    }
+    for (it_a = larger_stripe.place2clusters.begin(); it_a != larger_stripe.place2clusters.end();)
+    {
+      int t_cid = *it_a;
+      if (IF_DEBUG)
+      {
+        std::cout << " " << t_cid;
+      }
+      if (t_cid >= 0 && count_block_num('T', t_cid, l_stripe_id, -1) == 0)
+      {
+        // empty_clusters.push_back(t_cid);
+        it_a = larger_stripe.place2clusters.erase(it_a);
+        if (IF_DEBUG)
+        {
+          std::cout << "(remove)";
+        }
+      }
+      else
+      {
+        it_a++;
+      }
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << std::endl;
+    }
+    // for (int i = 0; i < int(empty_clusters.size()); i++)
+    // {
+    //   auto it_e = larger_stripe.place2clusters.find(empty_clusters[i]);
+    //   if (it_e != larger_stripe.place2clusters.end())
+    //   {
+    //     larger_stripe.place2clusters.erase(it_e);
+    //   }
+    // }
+
+    // the clusters touched by the merge of this batch
+    for (int i = 0; i <= l; i++)
+    {
+      batch.clusters.insert(old_parities_cluster_set[i].begin(), old_parities_cluster_set[i].end());
+    }
+    for (auto itb = block_location.begin(); itb != block_location.end(); itb++)
+    {
+      batch.clusters.insert(itb->first);
+    }
+    for (int i = 0; i < l; i++)
+    {
+      batch.clusters.insert(l_cluster_id[i]);
+      for (auto itp = parity_location[i].begin(); itp != parity_location[i].end(); itp++)
+      {
+        batch.clusters.insert(itp->first);
+      }
+    }
+    batch.clusters.insert(g_cluster_id);
+    for (int i = 0; i < int(block_to_move_key.size()); i++)
+    {
+      batch.clusters.insert(m_node_table[block_src_node[i]].cluster_id);
+      batch.clusters.insert(m_node_table[block_des_node[i]].cluster_id);
+    }
+    estimate_merge_traffic(batch);
+  }
+
+  // the blocks sent across clusters and within a cluster by each step of the merge of the batch,
+  // the reads and writes between the proxy and the datanodes of its cluster are counted as intra-cluster
+  void CoordinatorImpl::estimate_merge_traffic(MergeBatch &batch)
+  {
+    int l = m_encode_parameters.l_localparityblock;
+    int g_m = m_encode_parameters.g_m_globalparityblock;
+    MergeTraffic &traffic = batch.traffic;
+    traffic = MergeTraffic();
+    if (m_encode_parameters.partial_decoding)
+    {
+      // fused recalculation, counted as global recalculation, as its time,
+      // a helper cluster sends one partial block for each new parity it contributes to in the cluster of the main proxy
+      std::map<int, std::vector<int>> parities_in_cluster; // group ids, l for global parities
+      for (int i = 0; i < g_m; i++)
+      {
+        parities_in_cluster[batch.g_cluster_id].push_back(l);
+      }
+      for (int i = 0; i < l; i++)
+      {
+        parities_in_cluster[batch.l_cluster_id[i]].push_back(i);
+      }
+      for (auto itm = parities_in_cluster.begin(); itm != parities_in_cluster.end(); itm++)
+      {
+        for (auto itb = batch.block_location.begin(); itb != batch.block_location.end(); itb++)
+        {
+          if (itb->first == itm->first)
           {
-            std::cout << "[MERGE] Error! number of blocks to move not matches!" << std::endl;
+            continue;
           }
-          // find destination cluster and node for each block
-          for (it_b = block_to_move.begin(); it_b != block_to_move.end(); it_b++)
+          proxy_proto::locationInfo &t_location = itb->second;
+          for (auto itg = itm->second.begin(); itg != itm->second.end(); itg++)
           {
-            block_to_move_key.push_back((*it_b)->block_key);
-            block_src_node.push_back((*it_b)->map2node);
-            bool flag_m = false;
-            std::unordered_set<int>::iterator it_a;
-            for (it_a = larger_stripe.place2clusters.begin(); it_a != larger_stripe.place2clusters.end(); it_a++)
-            {
-              int t_cid = *it_a;
-              if (t_cid != t_cluster_id)
-              {
-                max_group_id = -1;
-                max_group_num = 0;
-                int block_num = count_block_num('T', t_cid, l_stripe_id, -1);
-                find_max_group(max_group_id, max_group_num, t_cid, l_stripe_id);
-                if (!find_block('G', t_cid, l_stripe_id) && 0 < block_num && block_num < g_m + 1 && int((*it_b)->map2group) == max_group_id)
-                {
-                  update_stripe_info_in_node(false, (*it_b)->map2node, (*it_b)->map2stripe);
-                  int r_node_id = randomly_select_a_node(t_cid, l_stripe_id);
-                  (*it_b)->map2cluster = t_cid;
-                  (*it_b)->map2node = r_node_id;
-                  for (it_c = t_cluster.blocks.begin(); it_c != t_cluster.blocks.end(); it_c++)
-                  {
-                    if ((*it_c)->block_key == (*it_b)->block_key)
-                    {
-                      t_cluster.blocks.erase(it_c);
-                      break;
-                    }
-                  }
-                  Cluster &t_cluster_des = m_cluster_table[t_cid];
-                  t_cluster_des.blocks.push_back((*it_b));
-                  block_des_node.push_back((*it_b)->map2node);
-                  update_stripe_info_in_node(true, (*it_b)->map2node, l_stripe_id);
-                  m_cluster_table[(*it_b)->map2cluster].stripes.insert(l_stripe_id);
-                  flag_m = true;
-                  break;
-                }
-              }
-            }
-            if (!flag_m)
-            {
-              for (it_a = new_cluster_set.begin(); it_a != new_cluster_set.end(); it_a++)
-              {
-                int t_cid = *it_a;
-                if (t_cid != t_cluster_id)
-                {
-                  max_group_id = -1;
-                  max_group_num = 0;
-                  int block_num = count_block_num('T', t_cid, l_stripe_id, -1);
-                  find_max_group(max_group_id, max_group_num, t_cid, l_stripe_id);
-                  if (!find_block('G', t_cid, l_stripe_id) && block_num > 0 && block_num < g_m + 1 && (*it_b)->map2group == max_group_id)
-                  {
-                    update_stripe_info_in_node(false, (*it_b)->map2node, (*it_b)->map2stripe);
-                    int r_node_id = randomly_select_a_node(t_cid, l_stripe_id);
-                    (*it_b)->map2cluster = t_cid;
-                    (*it_b)->map2node = r_node_id;
-                    for (it_c = t_cluster.blocks.begin(); it_c != t_cluster.blocks.end(); it_c++)
-                    {
-                      if ((*it_c)->block_key == (*it_b)->block_key)
-                      {
-                        t_cluster.blocks.erase(it_c);
-                        break;
-                      }
-                    }
-                    Cluster &t_cluster_des = m_cluster_table[t_cid];
-                    t_cluster_des.blocks.push_back((*it_b));
-                    block_des_node.push_back((*it_b)->map2node);
-                    update_stripe_info_in_node(true, (*it_b)->map2node, l_stripe_id);
-                    m_cluster_table[(*it_b)->map2cluster].stripes.insert(l_stripe_id);
-                    flag_m = true;
-                    break;
-                  }
-                }
-              }
-            }
-            if (!flag_m) // select an new cluster and place into it
+            bool contribute = (*itg == l || m_encode_parameters.encodetype == Optimal_Cauchy_LRC);
+            for (int ii = 0; !contribute && ii < t_location.groupids_size(); ii++)
             {
-              int t_cid = rand_num(m_num_of_Clusters);
-              while (count_block_num('T', t_cid, l_stripe_id, -1) > 0)
-              {
-                t_cid = rand_num(m_num_of_Clusters);
-              }
-              update_stripe_info_in_node(false, (*it_b)->map2node, (*it_b)->map2stripe);
-              int r_node_id = randomly_select_a_node(t_cid, l_stripe_id);
-              (*it_b)->map2cluster = t_cid;
-              (*it_b)->map2node = r_node_id;
-              for (it_c = t_cluster.blocks.begin(); it_c != t_cluster.blocks.end(); it_c++)
-              {
-                if ((*it_c)->block_key == (*it_b)->block_key)
-                {
-                  t_cluster.blocks.erase(it_c);
-                  break;
-                }
-              }
-              Cluster &t_cluster_des = m_cluster_table[t_cid];
-              t_cluster_des.blocks.push_back((*it_b));
-              block_des_node.push_back((*it_b)->map2node);
-              update_stripe_info_in_node(true, (*it_b)->map2node, l_stripe_id);
-              m_cluster_table[(*it_b)->map2cluster].stripes.insert(l_stripe_id);
-              flag_m = true;
-              new_cluster_set.insert(t_cid);
+              contribute = (t_location.groupids(ii) == *itg);
             }
-            if (!flag_m)
+            if (contribute)
             {
-              std::cout << "[MERGE] reloc1 : can't find out a des-cluster to move block " << (*it_b)->block_key << std::endl;
+              traffic.g_cross++;
             }
           }
         }
+      }
+      // each data block is read once, and each new parity block written once
+      for (auto itb = batch.block_location.begin(); itb != batch.block_location.end(); itb++)
+      {
+        traffic.g_intra += itb->second.blockkeys_size();
+      }
+      traffic.g_intra += g_m + l;
+    }
+    else
+    {
+      // the helper clusters send their blocks
+      for (auto itb = batch.block_location.begin(); itb != batch.block_location.end(); itb++)
+      {
+        if (itb->first != batch.g_cluster_id)
+        {
+          traffic.g_cross += itb->second.blockkeys_size();
+        }
+        traffic.g_intra += itb->second.blockkeys_size();
+      }
+      traffic.g_intra += g_m;
+      for (int i = 0; i < l; i++)
+      {
+        for (auto itp = batch.parity_location[i].begin(); itp != batch.parity_location[i].end(); itp++)
+        {
+          if (itp->first != batch.l_cluster_id[i])
+          {
+            traffic.l_cross += itp->second.blockkeys_size();
+          }
+          traffic.l_intra += itp->second.blockkeys_size();
+        }
+        traffic.l_intra += 1;
+      }
+    }
+    for (int i = 0; i < int(batch.block_to_move_key.size()); i++)
+    {
+      if (m_node_table[batch.block_src_node[i]].cluster_id != m_node_table[batch.block_des_node[i]].cluster_id)
+      {
+        traffic.d_cross++;
+      }
+      else
+      {
+        traffic.d_intra++;
+      }
+    }
+    batch.g_bytes = (long long)batch.block_size * traffic.g_cross;
+    batch.l_bytes = (long long)batch.block_size * traffic.l_cross;
+    batch.d_bytes = (long long)batch.block_size * traffic.d_cross;
+  }
+
+  void CoordinatorImpl::execute_merge_batch(MergeBatch &batch)
+  {
+    int l = m_encode_parameters.l_localparityblock;
+    int g_m = m_encode_parameters.g_m_globalparityblock;
+    EncodeType encodetype = m_encode_parameters.encodetype;
+    Stripe &larger_stripe = batch.larger_stripe;
+    int l_stripe_id = larger_stripe.stripe_id;
+    int block_size = batch.block_size;
+    int g_cluster_id = batch.g_cluster_id;
+    std::vector<int> &l_cluster_id = batch.l_cluster_id;
+    std::map<int, proxy_proto::locationInfo> &block_location = batch.block_location;
+    std::vector<std::map<int, proxy_proto::locationInfo>> &parity_location = batch.parity_location;
+    proxy_proto::mainRecalPlan &g_main_plan = batch.g_main_plan;
+    std::vector<proxy_proto::mainRecalPlan> &l_main_plan = batch.l_main_plan;
+    std::vector<proxy_proto::NodeAndBlock> &old_parities = batch.old_parities;
+    std::vector<std::unordered_set<int>> &old_parities_cluster_set = batch.old_parities_cluster_set;
+    std::vector<std::string> &block_to_move_key = batch.block_to_move_key;
+    std::vector<int> &block_src_node = batch.block_src_node;
+    std::vector<int> &block_des_node = batch.block_des_node;
+    std::vector<int> &block_to_move_group = batch.block_to_move_group;
+    int num2mov_v = batch.num2mov_v;
+
+    // time
+    double t_lc = 0.0, t_gc = 0.0, t_dc = 0.0;
+    std::mutex time_mutex;
+    auto add_time = [&time_mutex](double &t_time, struct timeval &start_time)
+    {
+      struct timeval end_time;
+      gettimeofday(&end_time, NULL);
+      std::unique_lock<std::mutex> lck(time_mutex);
+      t_time += end_time.tv_sec - start_time.tv_sec + (end_time.tv_usec - start_time.tv_usec) * 1.0 / 1000000;
+    };
+    // wait until the task finishes in the proxy
+    auto check_task = [this](int t_cluster_id, int task_id)
+    {
+      proxy_proto::AskIfSuccess ask_c;
+      ask_c.set_task_id(task_id);
+      grpc::ClientContext context_c;
+      proxy_proto::RepIfSuccess response_c;
+      std::string chosen_proxy_c = m_cluster_table[t_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[t_cluster_id].proxy_port);
+      grpc::Status stat_c = m_proxy_ptrs[chosen_proxy_c]->checkStep(&context_c, ask_c, &response_c);
+      return stat_c.ok() && response_c.ifsuccess();
+    };
+    // the port the main proxy opens for the helper proxies of a recalculation, -1 if it fails
+    auto open_recal = [this](int t_cluster_id, int task_id)
+    {
+      proxy_proto::RecalPort ask_p;
+      ask_p.set_task_id(task_id);
+      grpc::ClientContext context_p;
+      proxy_proto::RecalPort response_p;
+      std::string chosen_proxy_p = m_cluster_table[t_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[t_cluster_id].proxy_port);
+      grpc::Status stat_p = m_proxy_ptrs[chosen_proxy_p]->openRecal(&context_p, ask_p, &response_p);
+      if (!stat_p.ok())
+      {
+        std::cout << "[MERGE] proxy " << chosen_proxy_p << " failed to open a port for task " << task_id << std::endl;
+        return -1;
+      }
+      return response_p.port();
+    };
+
+    // the steps of the merge and their dependencies
+    std::vector<MergeTask> tasks;
+    // the recalculation task writing each new global parity and local parity of each group
+    int g_task = -1;
+    std::vector<int> l_tasks(l, -1);
+    if (m_encode_parameters.partial_decoding)
+    {
+      // fused recalculation, the helper proxies read each data block once,
+      // and send the partial global and local parities to the main proxies in one round
+      // if the data blocks in the cluster are needed to recalculate the parity block
+      auto if_contribute = [&larger_stripe, g_m, encodetype](int parity_id, proxy_proto::locationInfo &t_location)
+      {
+        if (parity_id < larger_stripe.k + g_m || encodetype == Optimal_Cauchy_LRC)
+        {
+          return true;
+        }
+        for (int ii = 0; ii < t_location.groupids_size(); ii++)
+        {
+          if (t_location.groupids(ii) == parity_id - larger_stripe.k - g_m)
+          {
+            return true;
+          }
+        }
+        return false;
+      };
+      // main proxy of each cluster, for the new parities placed in the cluster
+      std::map<int, proxy_proto::mainRecalPlan> f_main_plans;
+      auto add_new_parity = [&f_main_plans](int t_cluster_id, int parity_id, proxy_proto::mainRecalPlan &t_plan, int ii)
+      {
+        proxy_proto::mainRecalPlan &f_plan = f_main_plans[t_cluster_id];
+        f_plan.add_p_blockids(parity_id);
+        f_plan.add_p_datanodeip(t_plan.p_datanodeip(ii));
+        f_plan.add_p_datanodeport(t_plan.p_datanodeport(ii));
+        f_plan.add_p_blockkeys(t_plan.p_blockkeys(ii));
+      };
+      for (int i = 0; i < g_m; i++)
+      {
+        add_new_parity(g_cluster_id, larger_stripe.k + i, g_main_plan, i);
+      }
+      for (int i = 0; i < l; i++)
+      {
+        add_new_parity(l_cluster_id[i], larger_stripe.k + g_m + i, l_main_plan[i], 0);
+      }
+      int f_task_id = ++m_cur_task_id;
+      std::map<int, proxy_proto::helpRecalPlan> f_help_plans;
+      for (auto itm = f_main_plans.begin(); itm != f_main_plans.end(); itm++)
+      {
+        int m_cluster_id = itm->first;
+        proxy_proto::mainRecalPlan &f_plan = itm->second;
+        f_plan.set_type(true);
+        f_plan.set_if_fused(true);
+        f_plan.set_k(larger_stripe.k);
+        f_plan.set_l(l);
+        f_plan.set_g_m(g_m);
+        f_plan.set_block_size(block_size);
+        f_plan.set_if_partial_decoding(true);
+        f_plan.set_stripe_id(l_stripe_id);
+        f_plan.set_encodetype(encodetype);
+        f_plan.set_task_id(f_task_id);
+        for (auto itb = block_location.begin(); itb != block_location.end(); itb++)
+        {
+          bool flag = false;
+          for (int ii = 0; ii < f_plan.p_blockids_size(); ii++)
+          {
+            flag = flag || if_contribute(f_plan.p_blockids(ii), itb->second);
+          }
+          if (!flag)
+          {
+            continue;
+          }
+          f_plan.add_clusters()->CopyFrom(itb->second);
+          if (itb->first == m_cluster_id)
+          {
+            continue;
+          }
+          // the helper proxy sends the partial parities to this main proxy
+          proxy_proto::helpRecalPlan &f_help_plan = f_help_plans[itb->first];
+          proxy_proto::fusedTarget *t_target = f_help_plan.add_targets();
+          t_target->set_mainproxyip(m_cluster_table[m_cluster_id].proxy_ip);
+          t_target->set_cluster_id(m_cluster_id);
+          for (int ii = 0; ii < f_plan.p_blockids_size(); ii++)
+          {
+            t_target->add_parityids(f_plan.p_blockids(ii));
+          }
+        }
+      }
+      for (auto ith = f_help_plans.begin(); ith != f_help_plans.end(); ith++)
+      {
+        proxy_proto::locationInfo &t_location = block_location[ith->first];
+        proxy_proto::helpRecalPlan &f_help_plan = ith->second;
+        f_help_plan.set_type(true);
+        f_help_plan.set_if_fused(true);
+        f_help_plan.set_if_partial_decoding(true);
+        f_help_plan.set_k(larger_stripe.k);
+        f_help_plan.set_l(l);
+        f_help_plan.set_g_m(g_m);
+        f_help_plan.set_encodetype(encodetype);
+        f_help_plan.set_block_size(block_size);
+        for (int ii = 0; ii < int(t_location.blockkeys_size()); ii++)
+        {
+          f_help_plan.add_datanodeip(t_location.datanodeip(ii));
+          f_help_plan.add_datanodeport(t_location.datanodeport(ii));
+          f_help_plan.add_blockkeys(t_location.blockkeys(ii));
+          f_help_plan.add_blockids(t_location.blockids(ii));
+          f_help_plan.add_groupids(t_location.groupids(ii));
+        }
+      }
+      auto send_f_main_plan = [this](int t_cluster_id, proxy_proto::mainRecalPlan &f_plan, ProxyFanout &fanout)
+      {
+        std::string chosen_proxy_m = m_cluster_table[t_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[t_cluster_id].proxy_port);
+        m_proxy_ptrs[chosen_proxy_m]->async()->mainRecal(fanout.context(), &f_plan, fanout.hold<proxy_proto::RecalReply>(),
+                                                         fanout.done(chosen_proxy_m));
         if (IF_DEBUG)
         {
-          std::cout << "[MERGE] voilated blocks to relocate:";
-          for (int ii = 0; ii < int(block_to_move_key.size()); ii++)
-          {
-            std::cout << block_to_move_key[ii] << "[" << block_src_node[ii] << "->" << block_des_node[ii] << "] ";
-          }
-          std::cout << std::endl;
+          std::cout << "Selected main proxy " << chosen_proxy_m << std::endl;
         }
-        larger_stripe.place2clusters.insert(new_cluster_set.begin(), new_cluster_set.end());
-        num2mov_v = int(block_to_move_key.size());
-
-        // to keep each locap group placed in fewest cluster
-        int bi = larger_stripe.k / larger_stripe.l;
-        int c_a = ceil(bi + 1, g_m + 1);
-        for (int i = 0; i < larger_stripe.l; i++) // for each local group
+      };
+      auto send_f_help_plan = [this](int t_cluster_id, proxy_proto::helpRecalPlan &f_help_plan, ProxyFanout &fanout)
+      {
+        std::string chosen_proxy_h = m_cluster_table[t_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[t_cluster_id].proxy_port);
+        m_proxy_ptrs[chosen_proxy_h]->async()->helpRecal(fanout.context(), &f_help_plan, fanout.hold<proxy_proto::RecalReply>(),
+                                                         fanout.done(chosen_proxy_h));
+        if (IF_DEBUG)
+        {
+          std::cout << "Selected helper proxy " << chosen_proxy_h << std::endl;
+        }
+      };
+      MergeTask f_task;
+      for (auto itm = f_main_plans.begin(); itm != f_main_plans.end(); itm++)
+      {
+        f_task.clusters.push_back(itm->first);
+      }
+      f_task.run = [f_main_plans, f_help_plans, send_f_main_plan, send_f_help_plan, check_task, open_recal, add_time, &t_gc, l_stripe_id, f_task_id]() mutable
+      {
+        if (IF_DEBUG)
+        {
+          std::cout << "[MERGE] Start to recalculate global and local parity blocks for Stripe" << l_stripe_id << std::endl;
+        }
+        struct timeval g_start_time;
+        gettimeofday(&g_start_time, NULL);
+        try
         {
-          int c_b = 0;
-          std::vector<int> block_from_group_in_cluster;
-          // std::cout << "\033[1;31m";
-          for (int j = 0; j < m_num_of_Clusters; j++)
+          if (IF_DEBUG)
           {
-            int b_cnt = count_block_num('T', j, l_stripe_id, i);
-            if (b_cnt > 0)
-              c_b++;
-            block_from_group_in_cluster.push_back(b_cnt);
-            // std::cout << j << ":" << b_cnt << " ";
+            std::cout << "[Fused Parities Recalculation] Send main and help proxy plans!" << std::endl;
           }
-          // std::cout << "\033[0m" << std::endl;
-          if (c_b > c_a)
+          // the helper proxies send to the ports the main proxies opened for the task
+          std::map<int, int> recal_ports;
+          for (auto itm = f_main_plans.begin(); itm != f_main_plans.end(); itm++)
           {
-            if (IF_DEBUG)
+            recal_ports[itm->first] = open_recal(itm->first, f_task_id);
+            if (recal_ports[itm->first] < 0)
             {
-              std::cout << "\033[1;31m[MERGE] Group " << i << " Cluster number: actual-" << c_b << " expected-" << c_a << "\033[0m" << std::endl;
-            }
-            int c_m = c_b - c_a;
-            auto idxs = argsort(block_from_group_in_cluster);
-            std::vector<int> del_cluster;
-            int c_cnt = 0;
-            int idx = 0;
-            while (c_cnt < c_m)
-            {
-              if (block_from_group_in_cluster[idxs[idx]] > 0)
-              {
-                del_cluster.push_back(idxs[idx]);
-                c_cnt++;
-              }
-              idx++;
-            }
-            std::vector<ECProject::Block *> block_to_move;
-            std::vector<ECProject::Block *>::iterator it_b, it_c;
-            for (int j = 0; j < int(del_cluster.size()); j++)
-            {
-              int t_cluster_id = del_cluster[j];
-              Cluster &t_cluster = m_cluster_table[t_cluster_id];
-              for (it_b = t_cluster.blocks.begin(); it_b != t_cluster.blocks.end(); it_b++)
-              {
-                if ((*it_b)->map2stripe == l_stripe_id && int((*it_b)->map2group) == i)
-                {
-                  block_to_move.push_back((*it_b));
-                }
-              }
+              return;
             }
-            // find destination cluster and node for each moved block
-            for (it_b = block_to_move.begin(); it_b != block_to_move.end(); it_b++)
+          }
+          for (auto ith = f_help_plans.begin(); ith != f_help_plans.end(); ith++)
+          {
+            for (int ii = 0; ii < ith->second.targets_size(); ii++)
             {
-              int t_cluster_id = (*it_b)->map2cluster;
-              Cluster &t_cluster = m_cluster_table[t_cluster_id];
-              block_to_move_key.push_back((*it_b)->block_key);
-              block_src_node.push_back((*it_b)->map2node);
-              bool flag_m = false;
-              std::unordered_set<int>::iterator it_a;
-              for (it_a = larger_stripe.place2clusters.begin(); it_a != larger_stripe.place2clusters.end(); it_a++)
-              {
-                int t_cid = *it_a;
-                if (t_cid != t_cluster_id)
-                {
-                  int max_group_id = -1, max_group_num = 0;
-                  int block_num = count_block_num('T', t_cid, l_stripe_id, -1);
-                  find_max_group(max_group_id, max_group_num, t_cid, l_stripe_id);
-                  if (!find_block('G', t_cid, l_stripe_id) && block_num > 0 && block_num < g_m + 1 && (*it_b)->map2group == max_group_id)
-                  {
-                    update_stripe_info_in_node(false, (*it_b)->map2node, (*it_b)->map2stripe);
-                    int r_node_id = randomly_select_a_node(t_cid, l_stripe_id);
-                    (*it_b)->map2cluster = t_cid;
-                    (*it_b)->map2node = r_node_id;
-                    for (it_c = t_cluster.blocks.begin(); it_c != t_cluster.blocks.end(); it_c++)
-                    {
-                      if ((*it_c)->block_key == (*it_b)->block_key)
-                      {
-                        t_cluster.blocks.erase(it_c);
-                        break;
-                      }
-                    }
-                    Cluster &t_cluster_des = m_cluster_table[t_cid];
-                    t_cluster_des.blocks.push_back((*it_b));
-                    block_des_node.push_back((*it_b)->map2node);
-                    update_stripe_info_in_node(true, (*it_b)->map2node, l_stripe_id);
-                    m_cluster_table[(*it_b)->map2cluster].stripes.insert(l_stripe_id);
-                    flag_m = true;
-                    break;
-                  }
-                }
-              }
-              if (!flag_m)
-              {
-                std::cout << "[MERGE] reloc2 : can't find out a des-cluster to move block " << (*it_b)->block_key << std::endl;
-              }
+              proxy_proto::fusedTarget *t_target = ith->second.mutable_targets(ii);
+              t_target->set_mainproxyport(recal_ports[t_target->cluster_id()]);
             }
           }
-        }
-        if (IF_DEBUG)
-        {
-          std::cout << "[MERGE] all blocks to relocate:";
-          for (int ii = 0; ii < int(block_to_move_key.size()); ii++)
+          ProxyFanout fanout;
+          for (auto itm = f_main_plans.begin(); itm != f_main_plans.end(); itm++)
           {
-            std::cout << block_to_move_key[ii] << "[" << block_src_node[ii] << "->" << block_des_node[ii] << "] ";
+            send_f_main_plan(itm->first, itm->second, fanout);
           }
-          std::cout << std::endl;
+          for (auto ith = f_help_plans.begin(); ith != f_help_plans.end(); ith++)
+          {
+            send_f_help_plan(ith->first, ith->second, fanout);
+          }
+          fanout.wait();
         }
-        num2mov_k = int(block_to_move_key.size()) - num2mov_v;
-
-        // remove the 'empty' cluster from the set
-        // std::vector<int> empty_clusters;
-        std::unordered_set<int>::iterator it_a;
-        if (IF_DEBUG)
+        catch (const std::exception &e)
         {
-          std::cout << "[MERGE] Clusters that places Stripe " << l_stripe_id << ":";
+          std::cerr << e.what() << '\n';
         }
-        for (it_a = larger_stripe.place2clusters.begin(); it_a != larger_stripe.place2clusters.end();)
+        // check
+        for (auto itm = f_main_plans.begin(); itm != f_main_plans.end(); itm++)
         {
-          int t_cid = *it_a;
-          if (IF_DEBUG)
+          if (check_task(itm->first, f_task_id) && IF_DEBUG)
           {
-            std::cout << " " << t_cid;
-          }
-          if (t_cid >= 0 && count_block_num('T', t_cid, l_stripe_id, -1) == 0)
-          {
-            // empty_clusters.push_back(t_cid);
-            it_a = larger_stripe.place2clusters.erase(it_a);
-            if (IF_DEBUG)
-            {
-              std::cout << "(remove)";
-            }
+            std::cout << "[MERGE] parity block recalculate success for Stripe" << l_stripe_id << " in Cluster" << itm->first << std::endl;
           }
-          else
+        }
+        // the time of local parity block recalculation is included
+        add_time(t_gc, g_start_time);
+      };
+      tasks.push_back(f_task);
+      g_task = int(tasks.size()) - 1;
+      for (int i = 0; i < l; i++)
+      {
+        l_tasks[i] = g_task;
+      }
+    }
+    else
+    {
+      // global parity block recalculation
+      int g_task_id = ++m_cur_task_id;
+      auto send_main_plan = [this, larger_stripe, l, g_m, block_size, g_main_plan, block_location, g_cluster_id, l_stripe_id, g_task_id](ProxyFanout &fanout) mutable
+      {
+        // main
+        g_main_plan.set_type(true);
+        g_main_plan.set_k(larger_stripe.k);
+        g_main_plan.set_l(l);
+        g_main_plan.set_g_m(g_m);
+        g_main_plan.set_block_size(block_size);
+        g_main_plan.set_if_partial_decoding(m_encode_parameters.partial_decoding);
+        g_main_plan.set_stripe_id(l_stripe_id);
+        g_main_plan.set_encodetype(m_encode_parameters.encodetype);
+        g_main_plan.set_task_id(g_task_id);
+        for (auto itb = block_location.begin(); itb != block_location.end(); itb++)
+        {
+          proxy_proto::locationInfo t_location = block_location[itb->first];
+          auto new_cluster = g_main_plan.add_clusters();
+          new_cluster->set_cluster_id(t_location.cluster_id());
+          new_cluster->set_proxy_ip(t_location.proxy_ip());
+          new_cluster->set_proxy_port(t_location.proxy_port());
+          for (int ii = 0; ii < int(t_location.blockkeys_size()); ii++)
           {
-            it_a++;
+            new_cluster->add_datanodeip(t_location.datanodeip(ii));
+            new_cluster->add_datanodeport(t_location.datanodeport(ii));
+            new_cluster->add_blockkeys(t_location.blockkeys(ii));
+            new_cluster->add_blockids(t_location.blockids(ii));
           }
         }
+        proxy_proto::mainRecalPlan *t_main_plan = fanout.hold<proxy_proto::mainRecalPlan>();
+        *t_main_plan = g_main_plan;
+        std::string chosen_proxy_m = m_cluster_table[g_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[g_cluster_id].proxy_port);
+        m_proxy_ptrs[chosen_proxy_m]->async()->mainRecal(fanout.context(), t_main_plan, fanout.hold<proxy_proto::RecalReply>(),
+                                                         fanout.done(chosen_proxy_m));
         if (IF_DEBUG)
         {
-          std::cout << std::endl;
+          std::cout << "Selected main proxy " << chosen_proxy_m << std::endl;
         }
-        // for (int i = 0; i < int(empty_clusters.size()); i++)
-        // {
-        //   auto it_e = larger_stripe.place2clusters.find(empty_clusters[i]);
-        //   if (it_e != larger_stripe.place2clusters.end())
-        //   {
-        //     larger_stripe.place2clusters.erase(it_e);
-        //   }
-        // }
-
-        // time
-        double temp_time = 0.0;
-        struct timeval l_start_time, l_end_time;
-        struct timeval g_start_time, g_end_time;
-        struct timeval d_start_time, d_end_time;
+      };
 
+      // help
+      auto send_help_plan = [this, larger_stripe, block_location, g_cluster_id, block_size, g_m](int first, int recal_port, ProxyFanout &fanout)
+      {
+        proxy_proto::helpRecalPlan &g_help_plan = *fanout.hold<proxy_proto::helpRecalPlan>();
+        proxy_proto::locationInfo t_location = block_location.at(first);
+        g_help_plan.set_k(larger_stripe.k);
+        g_help_plan.set_type(true);
+        g_help_plan.set_encodetype(m_encode_parameters.encodetype);
+        g_help_plan.set_mainproxyip(m_cluster_table[g_cluster_id].proxy_ip);
+        g_help_plan.set_mainproxyport(recal_port);
+        for (int ii = 0; ii < int(t_location.blockkeys_size()); ii++)
+        {
+          g_help_plan.add_datanodeip(t_location.datanodeip(ii));
+          g_help_plan.add_datanodeport(t_location.datanodeport(ii));
+          g_help_plan.add_blockkeys(t_location.blockkeys(ii));
+          g_help_plan.add_blockids(t_location.blockids(ii));
+        }
+        g_help_plan.set_if_partial_decoding(m_encode_parameters.partial_decoding);
+        g_help_plan.set_block_size(block_size);
+        g_help_plan.set_parity_num(g_m);
+        std::string chosen_proxy_h = t_location.proxy_ip() + ":" + std::to_string(t_location.proxy_port());
+        m_proxy_ptrs[chosen_proxy_h]->async()->helpRecal(fanout.context(), &g_help_plan, fanout.hold<proxy_proto::RecalReply>(),
+                                                         fanout.done(chosen_proxy_h));
+        if (IF_DEBUG)
+        {
+          std::cout << "Selected helper proxy " << chosen_proxy_h << std::endl;
+        }
+      };
+      MergeTask gr_task;
+      gr_task.clusters.push_back(g_cluster_id);
+      gr_task.run = [send_main_plan, send_help_plan, check_task, open_recal, add_time, &t_gc, &block_location, g_cluster_id, l_stripe_id, g_task_id]() mutable
+      {
         if (IF_DEBUG)
         {
           std::cout << "[MERGE] Start to recalculate global parity blocks for Stripe" << l_stripe_id << std::endl;
         }
-        temp_time = 0.0;
+        struct timeval g_start_time;
         gettimeofday(&g_start_time, NULL);
-        // global parity block recalculation
-        auto send_main_plan = [this, larger_stripe, l, g_m, block_size, g_main_plan, block_location, g_cluster_id, l_stripe_id]() mutable
-        {
-          // main
-          g_main_plan.set_type(true);
-          g_main_plan.set_k(larger_stripe.k);
-          g_main_plan.set_l(l);
-          g_main_plan.set_g_m(g_m);
-          g_main_plan.set_block_size(block_size);
-          g_main_plan.set_if_partial_decoding(m_encode_parameters.partial_decoding);
-          g_main_plan.set_stripe_id(l_stripe_id);
-          g_main_plan.set_encodetype(m_encode_parameters.encodetype);
-          for (auto itb = block_location.begin(); itb != block_location.end(); itb++)
-          {
-            proxy_proto::locationInfo t_location = block_location[itb->first];
-            auto new_cluster = g_main_plan.add_clusters();
-            new_cluster->set_cluster_id(t_location.cluster_id());
-            new_cluster->set_proxy_ip(t_location.proxy_ip());
-            new_cluster->set_proxy_port(t_location.proxy_port());
-            for (int ii = 0; ii < int(t_location.blockkeys_size()); ii++)
-            {
-              new_cluster->add_datanodeip(t_location.datanodeip(ii));
-              new_cluster->add_datanodeport(t_location.datanodeport(ii));
-              new_cluster->add_blockkeys(t_location.blockkeys(ii));
-              new_cluster->add_blockids(t_location.blockids(ii));
-            }
-          }
-          grpc::ClientContext context_m;
-          proxy_proto::RecalReply response_m;
-          std::string chosen_proxy_m = m_cluster_table[g_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[g_cluster_id].proxy_port);
-          grpc::Status stat1 = m_proxy_ptrs[chosen_proxy_m]->mainRecal(&context_m, g_main_plan, &response_m);
-          if (IF_DEBUG)
-          {
-            std::cout << "Selected main proxy " << chosen_proxy_m << std::endl;
-          }
-        };
-
-        // help
-        auto send_help_plan = [this, larger_stripe, block_location, g_cluster_id, block_size, g_m](int first)
-        {
-          proxy_proto::helpRecalPlan g_help_plan;
-          proxy_proto::locationInfo t_location = block_location.at(first);
-          g_help_plan.set_k(larger_stripe.k);
-          g_help_plan.set_type(true);
-          g_help_plan.set_encodetype(m_encode_parameters.encodetype);
-          g_help_plan.set_mainproxyip(m_cluster_table[g_cluster_id].proxy_ip);
-          // port to accept data: mainproxy_port + cluster_id + 2
-          g_help_plan.set_mainproxyport(m_cluster_table[g_cluster_id].proxy_port + 1);
-          for (int ii = 0; ii < int(t_location.blockkeys_size()); ii++)
-          {
-            g_help_plan.add_datanodeip(t_location.datanodeip(ii));
-            g_help_plan.add_datanodeport(t_location.datanodeport(ii));
-            g_help_plan.add_blockkeys(t_location.blockkeys(ii));
-            g_help_plan.add_blockids(t_location.blockids(ii));
-          }
-          g_help_plan.set_if_partial_decoding(m_encode_parameters.partial_decoding);
-          g_help_plan.set_block_size(block_size);
-          g_help_plan.set_parity_num(g_m);
-          grpc::ClientContext context_h;
-          proxy_proto::RecalReply response_h;
-          std::string chosen_proxy_h = t_location.proxy_ip() + ":" + std::to_string(t_location.proxy_port());
-          grpc::Status stat = m_proxy_ptrs[chosen_proxy_h]->helpRecal(&context_h, g_help_plan, &response_h);
-          if (IF_DEBUG)
-          {
-            std::cout << "Selected helper proxy " << chosen_proxy_h << std::endl;
-          }
-        };
         try
         {
           if (IF_DEBUG)
           {
             std::cout << "[Global Parities Recalculation] Send main and help proxy plans!" << std::endl;
           }
-          std::thread my_main_thread(send_main_plan);
-          std::vector<std::thread> senders;
+          int recal_port = open_recal(g_cluster_id, g_task_id);
+          if (recal_port < 0)
+          {
+            return;
+          }
+          ProxyFanout fanout;
+          send_main_plan(fanout);
           for (auto itb = block_location.begin(); itb != block_location.end(); itb++)
           {
             if (itb->first != g_cluster_id)
             {
-              // send_help_plan(itb->first);
-              senders.push_back(std::thread(send_help_plan, itb->first));
+              send_help_plan(itb->first, recal_port, fanout);
             }
           }
-          for (int j = 0; j < int(senders.size()); j++)
-          {
-            senders[j].join();
-          }
-          my_main_thread.join();
+          fanout.wait();
         }
         catch (const std::exception &e)
         {
           std::cerr << e.what() << '\n';
         }
         // check
-        proxy_proto::AskIfSuccess ask_c0;
-        ask_c0.set_step(0);
-        grpc::ClientContext context_c0;
-        proxy_proto::RepIfSuccess response_c0;
-        std::string chosen_proxy_c0 = m_cluster_table[g_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[g_cluster_id].proxy_port);
-        grpc::Status stat_c0 = m_proxy_ptrs[chosen_proxy_c0]->checkStep(&context_c0, ask_c0, &response_c0);
-        if (stat_c0.ok() && response_c0.ifsuccess() && IF_DEBUG)
+        if (check_task(g_cluster_id, g_task_id) && IF_DEBUG)
         {
           std::cout << "[MERGE] global parity block recalculate success for Stripe" << l_stripe_id << std::endl;
         }
-        gettimeofday(&g_end_time, NULL);
-        temp_time = g_end_time.tv_sec - g_start_time.tv_sec + (g_end_time.tv_usec - g_start_time.tv_usec) * 1.0 / 1000000;
-        t_gc += temp_time;
+        add_time(t_gc, g_start_time);
+      };
+      tasks.push_back(gr_task);
+      g_task = int(tasks.size()) - 1;
 
-        // local parity blocks recalculation
-        if (IF_DEBUG)
+      // local parity blocks recalculation
+      auto send_l_main_plan = [this, larger_stripe, l, block_size, &l_main_plan, &parity_location, &l_cluster_id, l_stripe_id](int gid, int task_id, ProxyFanout &fanout) mutable
+      {
+        l_main_plan[gid].set_type(false);
+        l_main_plan[gid].set_k(larger_stripe.k);
+        l_main_plan[gid].set_l(l);
+        l_main_plan[gid].set_group_id(gid);
+        l_main_plan[gid].set_block_size(block_size);
+        l_main_plan[gid].set_if_partial_decoding(m_encode_parameters.partial_decoding);
+        l_main_plan[gid].set_stripe_id(l_stripe_id);
+        l_main_plan[gid].set_encodetype(m_encode_parameters.encodetype);
+        l_main_plan[gid].set_task_id(task_id);
+        for (auto itb = parity_location[gid].begin(); itb != parity_location[gid].end(); itb++)
         {
-          std::cout << "[MERGE] Start to recalculate local parity blocks for Stripe" << l_stripe_id << std::endl;
-        }
-        temp_time = 0.0;
-        gettimeofday(&l_start_time, NULL);
-        auto send_l_main_plan = [this, larger_stripe, l, block_size, &l_main_plan, &parity_location, &l_cluster_id, l_stripe_id](int gid) mutable
-        {
-          l_main_plan[gid].set_type(false);
-          l_main_plan[gid].set_k(larger_stripe.k);
-          l_main_plan[gid].set_l(l);
-          l_main_plan[gid].set_group_id(gid);
-          l_main_plan[gid].set_block_size(block_size);
-          l_main_plan[gid].set_if_partial_decoding(m_encode_parameters.partial_decoding);
-          l_main_plan[gid].set_stripe_id(l_stripe_id);
-          l_main_plan[gid].set_encodetype(m_encode_parameters.encodetype);
-          for (auto itb = parity_location[gid].begin(); itb != parity_location[gid].end(); itb++)
-          {
-            proxy_proto::locationInfo t_location = parity_location[gid][itb->first];
-            auto new_cluster = l_main_plan[gid].add_clusters();
-            new_cluster->set_cluster_id(t_location.cluster_id());
-            new_cluster->set_proxy_ip(t_location.proxy_ip());
-            new_cluster->set_proxy_port(t_location.proxy_port());
-            for (int ii = 0; ii < int(t_location.blockkeys_size()); ii++)
-            {
-              new_cluster->add_datanodeip(t_location.datanodeip(ii));
-              new_cluster->add_datanodeport(t_location.datanodeport(ii));
-              new_cluster->add_blockkeys(t_location.blockkeys(ii));
-              new_cluster->add_blockids(t_location.blockids(ii));
-            }
-          }
-          grpc::ClientContext context_m;
-          proxy_proto::RecalReply response_m;
-          std::string chosen_proxy_m = m_cluster_table[l_cluster_id[gid]].proxy_ip + ":" + std::to_string(m_cluster_table[l_cluster_id[gid]].proxy_port);
-          grpc::Status stat1 = m_proxy_ptrs[chosen_proxy_m]->mainRecal(&context_m, l_main_plan[gid], &response_m);
-          if (IF_DEBUG)
-          {
-            std::cout << "Selected main proxy " << chosen_proxy_m << std::endl;
-          }
-        };
-        auto send_l_help_plan = [this, larger_stripe, &parity_location, &l_cluster_id, block_size](int first, int gid)
-        {
-          proxy_proto::helpRecalPlan l_help_plan;
-          proxy_proto::locationInfo t_location = parity_location[gid].at(first);
-          l_help_plan.set_type(false);
-          l_help_plan.set_k(larger_stripe.k);
-          l_help_plan.set_encodetype(m_encode_parameters.encodetype);
-          l_help_plan.set_mainproxyip(m_cluster_table[l_cluster_id[gid]].proxy_ip);
-          l_help_plan.set_mainproxyport(m_cluster_table[l_cluster_id[gid]].proxy_port + 1);
+          proxy_proto::locationInfo t_location = parity_location[gid][itb->first];
+          auto new_cluster = l_main_plan[gid].add_clusters();
+          new_cluster->set_cluster_id(t_location.cluster_id());
+          new_cluster->set_proxy_ip(t_location.proxy_ip());
+          new_cluster->set_proxy_port(t_location.proxy_port());
           for (int ii = 0; ii < int(t_location.blockkeys_size()); ii++)
           {
-            l_help_plan.add_datanodeip(t_location.datanodeip(ii));
-            l_help_plan.add_datanodeport(t_location.datanodeport(ii));
-            l_help_plan.add_blockkeys(t_location.blockkeys(ii));
-            l_help_plan.add_blockids(t_location.blockids(ii));
-          }
-          l_help_plan.set_if_partial_decoding(m_encode_parameters.partial_decoding);
-          l_help_plan.set_block_size(block_size);
-          l_help_plan.set_parity_num(1);
-          grpc::ClientContext context_h;
-          proxy_proto::RecalReply response_h;
-          std::string chosen_proxy_h = t_location.proxy_ip() + ":" + std::to_string(t_location.proxy_port());
-          grpc::Status stat = m_proxy_ptrs[chosen_proxy_h]->helpRecal(&context_h, l_help_plan, &response_h);
+            new_cluster->add_datanodeip(t_location.datanodeip(ii));
+            new_cluster->add_datanodeport(t_location.datanodeport(ii));
+            new_cluster->add_blockkeys(t_location.blockkeys(ii));
+            new_cluster->add_blockids(t_location.blockids(ii));
+          }
+        }
+        std::string chosen_proxy_m = m_cluster_table[l_cluster_id[gid]].proxy_ip + ":" + std::to_string(m_cluster_table[l_cluster_id[gid]].proxy_port);
+        m_proxy_ptrs[chosen_proxy_m]->async()->mainRecal(fanout.context(), &l_main_plan[gid], fanout.hold<proxy_proto::RecalReply>(),
+                                                         fanout.done(chosen_proxy_m));
+        if (IF_DEBUG)
+        {
+          std::cout << "Selected main proxy " << chosen_proxy_m << std::endl;
+        }
+      };
+      auto send_l_help_plan = [this, larger_stripe, &parity_location, &l_cluster_id, block_size](int first, int gid, int recal_port, ProxyFanout &fanout)
+      {
+        proxy_proto::helpRecalPlan &l_help_plan = *fanout.hold<proxy_proto::helpRecalPlan>();
+        proxy_proto::locationInfo t_location = parity_location[gid].at(first);
+        l_help_plan.set_type(false);
+        l_help_plan.set_k(larger_stripe.k);
+        l_help_plan.set_encodetype(m_encode_parameters.encodetype);
+        l_help_plan.set_mainproxyip(m_cluster_table[l_cluster_id[gid]].proxy_ip);
+        l_help_plan.set_mainproxyport(recal_port);
+        for (int ii = 0; ii < int(t_location.blockkeys_size()); ii++)
+        {
+          l_help_plan.add_datanodeip(t_location.datanodeip(ii));
+          l_help_plan.add_datanodeport(t_location.datanodeport(ii));
+          l_help_plan.add_blockkeys(t_location.blockkeys(ii));
+          l_help_plan.add_blockids(t_location.blockids(ii));
+        }
+        l_help_plan.set_if_partial_decoding(m_encode_parameters.partial_decoding);
+        l_help_plan.set_block_size(block_size);
+        l_help_plan.set_parity_num(1);
+        std::string chosen_proxy_h = t_location.proxy_ip() + ":" + std::to_string(t_location.proxy_port());
+        m_proxy_ptrs[chosen_proxy_h]->async()->helpRecal(fanout.context(), &l_help_plan, fanout.hold<proxy_proto::RecalReply>(),
+                                                         fanout.done(chosen_proxy_h));
+        if (IF_DEBUG)
+        {
+          std::cout << "Selected helper proxy " << chosen_proxy_h << std::endl;
+        }
+      };
+      for (int i = 0; i < l; i++)
+      {
+        int l_task_id = ++m_cur_task_id;
+        MergeTask lr_task;
+        // the local parities of Optimal Cauchy LRC are derived from the new global parities
+        if (encodetype == Optimal_Cauchy_LRC)
+        {
+          lr_task.deps.push_back(g_task);
+        }
+        lr_task.clusters.push_back(l_cluster_id[i]);
+        lr_task.run = [send_l_main_plan, send_l_help_plan, check_task, open_recal, add_time, &t_lc, &parity_location, &l_cluster_id, l_stripe_id, i, l_task_id]() mutable
+        {
           if (IF_DEBUG)
           {
-            std::cout << "Selected helper proxy " << chosen_proxy_h << std::endl;
+            std::cout << "[MERGE] Start to recalculate local parity blocks for Stripe" << l_stripe_id << ", Group " << i << std::endl;
           }
-        };
-        for (int i = 0; i < l; i++)
-        {
+          struct timeval l_start_time;
+          gettimeofday(&l_start_time, NULL);
           try
           {
             if (IF_DEBUG)
             {
               std::cout << "[Local Parities Recalculation] Send main and help proxy plans!" << std::endl;
             }
-            std::thread my_l_main_thread(send_l_main_plan, i);
-            std::vector<std::thread> senders;
+            int recal_port = open_recal(l_cluster_id[i], l_task_id);
+            if (recal_port < 0)
+            {
+              return;
+            }
+            ProxyFanout fanout;
+            send_l_main_plan(i, l_task_id, fanout);
             for (auto itb = parity_location[i].begin(); itb != parity_location[i].end(); itb++)
             {
               if (itb->first != l_cluster_id[i])
               {
-                senders.push_back(std::thread(send_l_help_plan, itb->first, i));
+                send_l_help_plan(itb->first, i, recal_port, fanout);
               }
             }
-            for (int j = 0; j < int(senders.size()); j++)
-            {
-              senders[j].join();
-            }
-            my_l_main_thread.join();
+            fanout.wait();
           }
           catch (const std::exception &e)
           {
             std::cerr << e.what() << '\n';
           }
           // check
-          proxy_proto::AskIfSuccess ask_c1;
-          ask_c1.set_step(1);
-          grpc::ClientContext context_c1;
-          proxy_proto::RepIfSuccess response_c1;
-          std::string chosen_proxy_c1 = m_cluster_table[l_cluster_id[i]].proxy_ip + ":" + std::to_string(m_cluster_table[l_cluster_id[i]].proxy_port);
-          grpc::Status stat_c1 = m_proxy_ptrs[chosen_proxy_c1]->checkStep(&context_c1, ask_c1, &response_c1);
-          if (stat_c1.ok() && response_c1.ifsuccess() && IF_DEBUG)
+          if (check_task(l_cluster_id[i], l_task_id) && IF_DEBUG)
           {
-            std::cout << "[MERGE] local parity block recalculate success for Stripe" << l_stripe_id  << ", Group " << i << std::endl;
+            std::cout << "[MERGE] local parity block recalculate success for Stripe" << l_stripe_id << ", Group " << i << std::endl;
           }
-        }
-        gettimeofday(&l_end_time, NULL);
-        temp_time = l_end_time.tv_sec - l_start_time.tv_sec + (l_end_time.tv_usec - l_start_time.tv_usec) * 1.0 / 1000000;
-        t_lc += temp_time;
+          add_time(t_lc, l_start_time);
+        };
+        tasks.push_back(lr_task);
+        l_tasks[i] = int(tasks.size()) - 1;
+      }
+    }
 
-        // send delete old parity blocks request
+    // delete the old parity blocks once no recalculation reads them,
+    // the old local parities of a group are read by its local recalculation,
+    // and the old global parities by the local recalculation of Optimal Cauchy LRC
+    for (int i = 0; i <= l; i++)
+    {
+      if (old_parities[i].blockkeys_size() == 0)
+      {
+        continue;
+      }
+      MergeTask del_task;
+      if (!m_encode_parameters.partial_decoding)
+      {
+        if (i < l)
+        {
+          del_task.deps.push_back(l_tasks[i]);
+        }
+        else if (encodetype == Optimal_Cauchy_LRC)
+        {
+          del_task.deps.insert(del_task.deps.end(), l_tasks.begin(), l_tasks.end());
+        }
+      }
+      // randomly select a proxy
+      int idx = rand_num(int(old_parities_cluster_set[i].size()));
+      int del_cluster_id = *(std::next(old_parities_cluster_set[i].begin(), idx));
+      int del_task_id = ++m_cur_task_id;
+      old_parities[i].set_stripe_id(-1);
+      old_parities[i].set_key("");
+      old_parities[i].set_task_id(del_task_id);
+      del_task.run = [this, check_task, &old_parities, i, del_cluster_id, del_task_id]()
+      {
         grpc::ClientContext del_context;
         proxy_proto::DelReply del_reply;
-        old_parities.set_stripe_id(-1);
-        old_parities.set_key("");
-        // randomly select a proxy
-        int idx = rand_num(int(old_parities_cluster_set.size()));
-        int del_cluster_id = *(std::next(old_parities_cluster_set.begin(), idx));
         std::string del_chosen_proxy = m_cluster_table[del_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[del_cluster_id].proxy_port);
-        grpc::Status del_status = m_proxy_ptrs[del_chosen_proxy]->deleteBlock(&del_context, old_parities, &del_reply);
-        if (del_status.ok() && del_reply.ifcommit())
+        grpc::Status del_status = m_proxy_ptrs[del_chosen_proxy]->deleteBlock(&del_context, old_parities[i], &del_reply);
+        if (del_status.ok() && check_task(del_cluster_id, del_task_id))
         {
           std::cout << "[MERGE] Delete old parity blocks success!" << std::endl;
         }
+      };
+      tasks.push_back(del_task);
+    }
 
-
-        // data block relocation
-        if (int(block_to_move_key.size()) > 0)
+    // data block relocation, after the recalculation reading the data blocks or writing the new parity blocks to move,
+    // that is the global one for data blocks and new global parities, and the local one of the group for new local parities
+    for (int i = -1; i < l; i++)
+    {
+      std::vector<int> idxs;
+      for (int ii = 0; ii < int(block_to_move_key.size()); ii++)
+      {
+        if (block_to_move_group[ii] == i)
         {
-          if (IF_DEBUG)
-          {
-            std::cout << "[MERGE] Start to relocate data blocks for Stripe" << l_stripe_id << std::endl;
-          }
-          temp_time = 0.0;
-          gettimeofday(&d_start_time, NULL);
-          proxy_proto::blockRelocPlan b_reloc_plan;
-          for (int i = 0; i < int(block_to_move_key.size()); i++)
-          {
-            int src_node_id = block_src_node[i];
-            int des_node_id = block_des_node[i];
-            b_reloc_plan.add_blocktomove(block_to_move_key[i]);
-            b_reloc_plan.add_fromdatanodeip(m_node_table[src_node_id].node_ip);
-            b_reloc_plan.add_fromdatanodeport(m_node_table[src_node_id].node_port);
-            b_reloc_plan.add_todatanodeip(m_node_table[des_node_id].node_ip);
-            b_reloc_plan.add_todatanodeport(m_node_table[des_node_id].node_port);
-          }
-          b_reloc_plan.set_block_size(block_size);
-          int r_cluster_id = rand_num(m_num_of_Clusters);
-          std::string chosen_proxy_b = m_cluster_table[r_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[r_cluster_id].proxy_port);
-          grpc::ClientContext context_b;
-          proxy_proto::blockRelocReply response_b;
-          grpc::Status stat_b = m_proxy_ptrs[chosen_proxy_b]->blockReloc(&context_b, b_reloc_plan, &response_b);
-          // check
-          proxy_proto::AskIfSuccess ask_c2;
-          ask_c2.set_step(2);
-          grpc::ClientContext context_c2;
-          proxy_proto::RepIfSuccess response_c2;
-          grpc::Status stat_c2 = m_proxy_ptrs[chosen_proxy_b]->checkStep(&context_c2, ask_c2, &response_c2);
-          if (stat_c2.ok() && response_c2.ifsuccess() && IF_DEBUG)
-          {
-            std::cout << "[MERGE] block relocaltion success!" << std::endl;
-          }
-          gettimeofday(&d_end_time, NULL);
-          temp_time = d_end_time.tv_sec - d_start_time.tv_sec + (d_end_time.tv_usec - d_start_time.tv_usec) * 1.0 / 1000000;
-          // for the implementation of the relocation process: src_node -> proxy -> des_node, the time should be halved
-          // next optimizable direction: src_node -> des_node  Done!!! Done!!!
-          // temp_time /= 2;
-          t_lc += temp_time * double(num2mov_k) / double(block_to_move_key.size());
-          t_dc += temp_time * double(num2mov_v) / double(block_to_move_key.size());
+          idxs.push_back(ii);
         }
-
-        // update stripes meta information
-        std::unordered_set<int>::iterator iter;
-        for (iter = old_stripe_id_set.begin(); iter != old_stripe_id_set.end(); iter++)
+      }
+      if (idxs.empty())
+      {
+        continue;
+      }
+      MergeTask reloc_task;
+      reloc_task.deps.push_back(i == -1 ? g_task : l_tasks[i]);
+      int num_v = 0;
+      proxy_proto::blockRelocPlan b_reloc_plan;
+      for (int ii = 0; ii < int(idxs.size()); ii++)
+      {
+        int src_node_id = block_src_node[idxs[ii]];
+        int des_node_id = block_des_node[idxs[ii]];
+        b_reloc_plan.add_blocktomove(block_to_move_key[idxs[ii]]);
+        b_reloc_plan.add_fromdatanodeip(m_node_table[src_node_id].node_ip);
+        b_reloc_plan.add_fromdatanodeport(m_node_table[src_node_id].node_port);
+        b_reloc_plan.add_todatanodeip(m_node_table[des_node_id].node_ip);
+        b_reloc_plan.add_todatanodeport(m_node_table[des_node_id].node_port);
+        if (idxs[ii] < num2mov_v)
         {
-          auto its = m_stripe_table.find(*iter);
-          if (its != m_stripe_table.end())
-          {
-            m_stripe_table.erase(its);
-          }
+          num_v++;
         }
-        m_stripe_table[l_stripe_id] = larger_stripe;
-        m_cur_stripe_id++;
-        s_merge_group.push_back(l_stripe_id);
-        stripe_cnt += num_of_stripes;
-        
-        std::cout << "[Merging Stage " << m_merge_degree + 1 << "] Process " << stripe_cnt << "/" << tot_stripe_num 
-                  << "  lc:" << t_lc << " gc:" << t_gc << " dc:" << t_dc << std::endl;
       }
-      new_merge_groups.push_back(s_merge_group);
+      int reloc_task_id = ++m_cur_task_id;
+      b_reloc_plan.set_block_size(block_size);
+      b_reloc_plan.set_task_id(reloc_task_id);
+      // randomly select a proxy from the clusters of this batch
+      int r_idx = rand_num(int(batch.clusters.size()));
+      int r_cluster_id = *(std::next(batch.clusters.begin(), r_idx));
+      int num_k = int(idxs.size()) - num_v;
+      reloc_task.run = [this, b_reloc_plan, check_task, &time_mutex, &t_lc, &t_dc, r_cluster_id, reloc_task_id, num_v, num_k, l_stripe_id]()
+      {
+        if (IF_DEBUG)
+        {
+          std::cout << "[MERGE] Start to relocate data blocks for Stripe" << l_stripe_id << std::endl;
+        }
+        struct timeval d_start_time, d_end_time;
+        gettimeofday(&d_start_time, NULL);
+        std::string chosen_proxy_b = m_cluster_table[r_cluster_id].proxy_ip + ":" + std::to_string(m_cluster_table[r_cluster_id].proxy_port);
+        grpc::ClientContext context_b;
+        proxy_proto::blockRelocReply response_b;
+        grpc::Status stat_b = m_proxy_ptrs[chosen_proxy_b]->blockReloc(&context_b, b_reloc_plan, &response_b);
+        // check
+        if (check_task(r_cluster_id, reloc_task_id) && IF_DEBUG)
+        {
+          std::cout << "[MERGE] block relocaltion success!" << std::endl;
+        }
+        gettimeofday(&d_end_time, NULL);
+        double temp_time = d_end_time.tv_sec - d_start_time.tv_sec + (d_end_time.tv_usec - d_start_time.tv_usec) * 1.0 / 1000000;
+        std::unique_lock<std::mutex> lck(time_mutex);
+        t_lc += temp_time * double(num_k) / double(num_v + num_k);
+        t_dc += temp_time * double(num_v) / double(num_v + num_k);
+      };
+      tasks.push_back(reloc_task);
     }
-    // update m_merge_groups
-    m_merge_groups.clear();
-    m_merge_groups = new_merge_groups;
-    mergeReplyClient->set_ifmerged(true);
-    mergeReplyClient->set_lc(t_lc);
-    mergeReplyClient->set_gc(t_gc);
-    mergeReplyClient->set_dc(t_dc);
 
-    if (IF_DEBUG)
+    struct timeval e_start_time, e_end_time;
+    gettimeofday(&e_start_time, NULL);
+    run_merge_tasks(tasks);
+    gettimeofday(&e_end_time, NULL);
+    // the steps overlap, scale the time of each step down to the elapsed time
+    double e_time = e_end_time.tv_sec - e_start_time.tv_sec + (e_end_time.tv_usec - e_start_time.tv_usec) * 1.0 / 1000000;
+    double s_time = t_lc + t_gc + t_dc;
+    if (s_time > e_time && s_time > 0)
     {
-      // print the result
-      std::cout << std::endl;
-      std::cout << "After Merge of this stage:" << std::endl;
-      for (int i = 0; i < m_num_of_Clusters; i++)
+      t_lc *= e_time / s_time;
+      t_gc *= e_time / s_time;
+      t_dc *= e_time / s_time;
+    }
+    batch.t_lc = t_lc;
+    batch.t_gc = t_gc;
+    batch.t_dc = t_dc;
+  }
+
+  void CoordinatorImpl::run_merge_tasks(std::vector<MergeTask> &tasks)
+  {
+    int num_of_tasks = int(tasks.size());
+    int num_of_done = 0;
+    std::vector<int> state(num_of_tasks, 0); // 0: waiting, 1: running, 2: done
+    std::unordered_set<int> busy_clusters;
+    std::mutex task_mutex;
+    std::condition_variable task_cv;
+    std::vector<std::thread> workers;
+    auto run_task = [&tasks, &state, &busy_clusters, &num_of_done, &task_mutex, &task_cv](int idx)
+    {
+      tasks[idx].run();
+      std::unique_lock<std::mutex> lck(task_mutex);
+      state[idx] = 2;
+      for (auto itc = tasks[idx].clusters.begin(); itc != tasks[idx].clusters.end(); itc++)
       {
-        Cluster &t_cluster = m_cluster_table[i];
-        if (int(t_cluster.blocks.size()) > 0)
-        {
-          std::cout << "Cluster " << i << ": ";
-          for (auto it = t_cluster.blocks.begin(); it != t_cluster.blocks.end(); it++)
-          {
-            std::cout << "[" << (*it)->block_key << ":S" << (*it)->map2stripe << "G" << (*it)->map2group << "N" << (*it)->map2node << "] ";
-          }
-          std::cout << std::endl;
-        }
+        busy_clusters.erase(*itc);
       }
-      std::cout << "Merge Group: ";
-      for (auto it1 = m_merge_groups.begin(); it1 != m_merge_groups.end(); it1++)
+      num_of_done++;
+      task_cv.notify_all();
+    };
+    std::unique_lock<std::mutex> lck(task_mutex);
+    while (num_of_done < num_of_tasks)
+    {
+      // dispatch the tasks whose dependencies are done and whose main proxies are free
+      bool dispatched = false;
+      for (int i = 0; i < num_of_tasks; i++)
       {
-        std::cout << "[ ";
-        for (auto it2 = (*it1).begin(); it2 != (*it1).end(); it2++)
+        if (state[i] != 0)
         {
-          std::cout << (*it2) << " ";
+          continue;
         }
-        std::cout << "] ";
+        bool ready = true;
+        for (auto itd = tasks[i].deps.begin(); ready && itd != tasks[i].deps.end(); itd++)
+        {
+          ready = (*itd < 0 || state[*itd] == 2);
+        }
+        for (auto itc = tasks[i].clusters.begin(); ready && itc != tasks[i].clusters.end(); itc++)
+        {
+          ready = (busy_clusters.find(*itc) == busy_clusters.end());
+        }
+        if (!ready)
+        {
+          continue;
+        }
+        state[i] = 1;
+        busy_clusters.insert(tasks[i].clusters.begin(), tasks[i].clusters.end());
+        workers.push_back(std::thread(run_task, i));
+        dispatched = true;
+      }
+      if (!dispatched)
+      {
+        task_cv.wait(lck);
       }
-      std::cout << std::endl;
-      std::cout << std::endl;
     }
-    m_merge_degree += 1;
-
-    return grpc::Status::OK;
+    lck.unlock();
+    for (int i = 0; i < int(workers.size()); i++)
+    {
+      workers[i].join();
+    }
   }
 
   void CoordinatorImpl::blocks_in_cluster(std::map<char, std::vector<ECProject::Block *>> &block_info, int cluster_id, int stripe_id)
   {
     std::vector<ECProject::Block *> tt, td, tl, tg;
     Cluster &cluster = m_cluster_table[cluster_id];
-    std::vector<Block *>::iterator it;
-    for (it = cluster.blocks.begin(); it != cluster.blocks.end(); it++)
+    auto it_s = cluster.stripe_blocks.find(stripe_id);
+    if (it_s != cluster.stripe_blocks.end())
     {
-      Block *block = *it;
-      if (block->map2stripe == stripe_id)
+      for (auto it = it_s->second.begin(); it != it_s->second.end(); it++)
       {
+        Block *block = *it;
         tt.push_back(block);
         if (block->block_type == 'D')
         {
@@ -2218,12 +5905,12 @@ namespace ECProject
 
   void CoordinatorImpl::find_max_group(int &max_group_id, int &max_group_num, int cluster_id, int stripe_id)
   {
-    int group_cnt[5] = {0};
+    std::vector<int> group_cnt(m_encode_parameters.l_localparityblock + 1, 0);
     Cluster &cluster = m_cluster_table[cluster_id];
-    std::vector<Block *>::iterator it;
-    for (it = cluster.blocks.begin(); it != cluster.blocks.end(); it++)
+    auto it_s = cluster.stripe_blocks.find(stripe_id);
+    if (it_s != cluster.stripe_blocks.end())
     {
-      if ((*it)->map2stripe == stripe_id)
+      for (auto it = it_s->second.begin(); it != it_s->second.end(); it++)
       {
         group_cnt[(*it)->map2group]++;
       }
@@ -2242,33 +5929,15 @@ namespace ECProject
   {
     int cnt = 0;
     Cluster &cluster = m_cluster_table[cluster_id];
-    std::vector<Block *>::iterator it;
-    for (it = cluster.blocks.begin(); it != cluster.blocks.end(); it++)
+    auto it_s = cluster.stripe_blocks.find(stripe_id);
+    if (it_s != cluster.stripe_blocks.end())
     {
-      Block *block = *it;
-      if (block->map2stripe == stripe_id)
+      for (auto it = it_s->second.begin(); it != it_s->second.end(); it++)
       {
-        if (group_id == -1)
-        {
-          if (type == 'T')
-          {
-            cnt++;
-          }
-          else if (block->block_type == type)
-          {
-            cnt++;
-          }
-        }
-        else if (int(block->map2group) == group_id)
+        Block *block = *it;
+        if ((group_id == -1 || int(block->map2group) == group_id) && (type == 'T' || block->block_type == type))
         {
-          if (type == 'T')
-          {
-            cnt++;
-          }
-          else if (block->block_type == type)
-          {
-            cnt++;
-          }
+          cnt++;
         }
       }
     }
@@ -2283,18 +5952,81 @@ namespace ECProject
   bool CoordinatorImpl::find_block(char type, int cluster_id, int stripe_id)
   {
     Cluster &cluster = m_cluster_table[cluster_id];
-    std::vector<Block *>::iterator it;
-    for (it = cluster.blocks.begin(); it != cluster.blocks.end(); it++)
+    if (stripe_id == -1)
     {
-      if (stripe_id != -1 && int((*it)->map2stripe) == stripe_id && (*it)->block_type == type)
+      for (auto it = cluster.blocks.begin(); it != cluster.blocks.end(); it++)
       {
-        return true;
+        if ((*it)->block_type == type)
+        {
+          return true;
+        }
       }
-      else if (stripe_id == -1 && (*it)->block_type == type)
+      return false;
+    }
+    auto it_s = cluster.stripe_blocks.find(stripe_id);
+    if (it_s != cluster.stripe_blocks.end())
+    {
+      for (auto it = it_s->second.begin(); it != it_s->second.end(); it++)
       {
-        return true;
+        if ((*it)->block_type == type)
+        {
+          return true;
+        }
       }
     }
     return false;
   }
+
+  // the blocks of a cluster are indexed by position and by stripe, keep them in step through these
+  void CoordinatorImpl::add_block_to_cluster(Block *block)
+  {
+    Cluster &cluster = m_cluster_table[block->map2cluster];
+    cluster.block_pos[block] = int(cluster.blocks.size());
+    cluster.blocks.push_back(block);
+    cluster.stripe_blocks[block->map2stripe].push_back(block);
+  }
+
+  // the last block takes the place of the removed one
+  void CoordinatorImpl::remove_block_from_cluster(int cluster_id, Block *block)
+  {
+    Cluster &cluster = m_cluster_table[cluster_id];
+    auto it_p = cluster.block_pos.find(block);
+    if (it_p == cluster.block_pos.end())
+    {
+      return;
+    }
+    int pos = it_p->second;
+    cluster.block_pos.erase(it_p);
+    if (pos != int(cluster.blocks.size()) - 1)
+    {
+      cluster.blocks[pos] = cluster.blocks.back();
+      cluster.block_pos[cluster.blocks[pos]] = pos;
+    }
+    cluster.blocks.pop_back();
+    auto it_s = cluster.stripe_blocks.find(block->map2stripe);
+    if (it_s != cluster.stripe_blocks.end())
+    {
+      std::vector<Block *> &t_blocks = it_s->second;
+      t_blocks.erase(std::remove(t_blocks.begin(), t_blocks.end(), block), t_blocks.end());
+      if (t_blocks.empty())
+      {
+        cluster.stripe_blocks.erase(it_s);
+      }
+    }
+  }
+
+  void CoordinatorImpl::update_block_stripe(Block *block, int stripe_id)
+  {
+    Cluster &cluster = m_cluster_table[block->map2cluster];
+    bool in_cluster = cluster.block_pos.find(block) != cluster.block_pos.end();
+    if (in_cluster)
+    {
+      remove_block_from_cluster(block->map2cluster, block);
+    }
+    block->map2stripe = stripe_id;
+    if (in_cluster)
+    {
+      add_block_to_cluster(block);
+    }
+  }
 } // namespace ECProject
@@ -3,6 +3,9 @@
 #include <fstream>
 #include <unistd.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/statvfs.h>
 
 namespace ECProject
 {
@@ -16,6 +19,52 @@ namespace ECProject
         return grpc::Status::OK;
     }
 
+    grpc::Status DatanodeImpl::heartbeat(
+        grpc::ServerContext *context,
+        const datanode_proto::CheckaliveCMD *request,
+        datanode_proto::NodeStatus *status)
+    {
+        std::string targetdir = storage_dir();
+        struct statvfs fs;
+        if (statvfs(access(targetdir.c_str(), 0) == -1 ? "." : targetdir.c_str(), &fs) == 0)
+        {
+            status->set_free_bytes((long long)fs.f_bavail * fs.f_frsize);
+        }
+        else
+        {
+            status->set_free_bytes(-1);
+        }
+        status->set_block_num(m_block_num);
+        {
+            std::unique_lock<std::mutex> lck(m_heartbeat_mutex);
+            auto now = std::chrono::steady_clock::now();
+            long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_last_heartbeat).count();
+            m_last_heartbeat = now;
+            status->set_io_bytes_per_sec(m_io_bytes.exchange(0) * 1000 / std::max(ms, 1LL));
+        }
+        return grpc::Status::OK;
+    }
+
+    // the blocks stored before the datanode started
+    int DatanodeImpl::count_blocks()
+    {
+        int block_num = 0;
+        DIR *dir = opendir(storage_dir().c_str());
+        if (dir == nullptr)
+        {
+            return 0;
+        }
+        for (struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+        {
+            if (entry->d_name[0] != '.')
+            {
+                block_num++;
+            }
+        }
+        closedir(dir);
+        return block_num;
+    }
+
     grpc::Status DatanodeImpl::handleSet(
         grpc::ServerContext *context,
         const datanode_proto::SetInfo *set_info,
@@ -49,8 +98,13 @@ namespace ECProject
                     mkdir(targetdir.c_str(), S_IRWXU);
                 }
                 
+                if (access(writepath.c_str(), 0) == -1)
+                {
+                    m_block_num++;
+                }
                 std::ofstream ofs(writepath, std::ios::binary | std::ios::out | std::ios::trunc);
                 ofs.write(buf.data(), block_size);
+                m_io_bytes += block_size;
                 if (IF_DEBUG)
                 {
                     std::cout << "[Datanode" << m_port << "][Write] successfully write " << block_key << " with " << ofs.tellp() << "bytes" << std::endl;
@@ -92,8 +146,13 @@ namespace ECProject
                     mkdir(targetdir.c_str(), S_IRWXU);
                 }
 
+                if (access(writepath.c_str(), 0) == -1)
+                {
+                    m_block_num++;
+                }
                 std::ofstream ofs(writepath, std::ios::binary | std::ios::out | std::ios::trunc);
                 ofs.write(buf.data(), block_size);
+                m_io_bytes += block_size;
                 if (IF_DEBUG)
                 {
                     std::cout << "[Datanode" << m_port << "][Write] successfully write " << block_key << " with " << ofs.tellp() << "bytes" << std::endl;
@@ -139,9 +198,10 @@ namespace ECProject
     {
         std::string block_key = get_info->block_key();
         int block_size = get_info->block_size();
+        int block_offset = get_info->offset();
         std::string proxy_ip = get_info->proxy_ip();
         int proxy_port = get_info->proxy_port();
-        auto handler = [this](std::string block_key, int block_size, std::string proxy_ip, int proxy_port) mutable
+        auto handler = [this](std::string block_key, int block_size, int block_offset, std::string proxy_ip, int proxy_port) mutable
         {
             std::string targetdir = "./storage/" + std::to_string(m_port) + "/";
             std::string readpath = targetdir + block_key;
@@ -155,19 +215,32 @@ namespace ECProject
                 {
                     std::cout << "[Datanode" << m_port << "][GET] read from the disk and write to socket with port " << m_port + 20 << std::endl;
                 }
-                char *buf = new char[block_size];
-                std::ifstream ifs(readpath);
-                ifs.read(buf, block_size);
-                ifs.close();
-                if (IF_DEBUG)
-                {
-                    std::cout << "[Datanode" << m_port << "][GET] read " << readpath << " with length of " << strlen(buf) << std::endl;
-                }
+                std::vector<char> buf(block_size);
+                int fd = open(readpath.c_str(), O_RDONLY);
 
+                // read only the requested range from the disk and write to socket chunk by chunk
                 asio::error_code error;
                 asio::ip::tcp::socket socket(io_context);
                 acceptor.accept(socket);
-                asio::write(socket, asio::buffer(buf, block_size), error);
+                for (int offset = 0; offset < block_size; offset += READ_CHUNK_SIZE)
+                {
+                    int len = std::min(READ_CHUNK_SIZE, block_size - offset);
+                    ssize_t n = fd < 0 ? -1 : pread(fd, buf.data() + offset, len, block_offset + offset);
+                    if (n < len)
+                    {
+                        memset(buf.data() + offset + std::max(n, ssize_t(0)), 0, len - std::max(n, ssize_t(0)));
+                    }
+                    asio::write(socket, asio::buffer(buf.data() + offset, len), error);
+                }
+                if (fd >= 0)
+                {
+                    close(fd);
+                }
+                m_io_bytes += block_size;
+                if (IF_DEBUG)
+                {
+                    std::cout << "[Datanode" << m_port << "][GET] read " << readpath << " from " << block_offset << " with length of " << block_size << std::endl;
+                }
                 asio::error_code ignore_ec;
                 socket.shutdown(asio::ip::tcp::socket::shutdown_both, ignore_ec);
                 socket.close(ignore_ec);
@@ -175,7 +248,6 @@ namespace ECProject
                 {
                     std::cout << "[Datanode" << m_port << "][GET] write to socket!" << std::endl;
                 }
-                delete buf;
             }
         };
         try
@@ -184,7 +256,7 @@ namespace ECProject
             {
                 std::cout << "[Datanode" << m_port << "][GET] ready to handle get!" << std::endl;
             }
-            std::thread my_thread(handler, block_key, block_size, proxy_ip, proxy_port);
+            std::thread my_thread(handler, block_key, block_size, block_offset, proxy_ip, proxy_port);
             my_thread.detach();
             response->set_message(true);
         }
@@ -211,6 +283,10 @@ namespace ECProject
         {
             std::cout << "[DEL] delete error!" << std::endl;
         }
+        else
+        {
+            m_block_num--;
+        }
         response->set_message(true);
         return grpc::Status::OK;
     }
@@ -287,4 +287,120 @@ bool ECProject::perform_addition(char **data_ptrs, char **coding_ptrs, int block
         jerasure_matrix_encode(num_of_block_each_parity, 1, 8, new_matrix.data(), &data_ptrs[i * num_of_block_each_parity], &coding_ptrs[i], blocksize);
     }
     return true;
-}
\ No newline at end of file
+}
+
+// the coefficients to decode each failed data block from k survived blocks,
+// failed_idxs.size() * k, row-major, the columns follow survive_idxs
+bool ECProject::make_decoding_coefficients(int k, int g_m, int real_l, std::vector<int> &survive_idxs, std::vector<int> &failed_idxs, std::vector<int> &coefficients, EncodeType encode_type)
+{
+    if (int(survive_idxs.size()) != k)
+    {
+        return false;
+    }
+    std::vector<int> new_matrix((g_m + real_l) * k, 0);
+    lrc_make_matrix(k, g_m, real_l, new_matrix.data(), encode_type);
+    std::vector<int> k_k_matrix(k * k, 0);
+    for (int i = 0; i < k; i++)
+    {
+        int idx = survive_idxs[i];
+        if (idx < k)
+        {
+            k_k_matrix[i * k + idx] = 1;
+        }
+        else
+        {
+            memcpy(&k_k_matrix[i * k], &new_matrix[(idx - k) * k], k * sizeof(int));
+        }
+    }
+    std::vector<int> inv_matrix(k * k, 0);
+    if (jerasure_invert_matrix(k_k_matrix.data(), inv_matrix.data(), k, 8) == -1)
+    {
+        return false;
+    }
+    coefficients.clear();
+    for (int i = 0; i < int(failed_idxs.size()); i++)
+    {
+        int idx = failed_idxs[i];
+        if (idx >= k)
+        {
+            return false;
+        }
+        coefficients.insert(coefficients.end(), inv_matrix.begin() + idx * k, inv_matrix.begin() + (idx + 1) * k);
+    }
+    return true;
+}
+
+// select the parity blocks from the candidates to decode the failed data blocks with the received ones,
+// the candidates in front are preferred
+bool ECProject::plan_partial_decoding(int k, int g_m, int real_l, std::vector<int> &received_idxs, std::vector<int> &candidate_idxs, std::vector<int> &failed_idxs, std::vector<int> &survive_idxs, std::vector<int> &coefficients, EncodeType encode_type)
+{
+    int need = k - int(received_idxs.size());
+    if (need <= 0 || need > int(candidate_idxs.size()))
+    {
+        return false;
+    }
+    auto combinations = std::make_shared<std::vector<std::vector<int>>>();
+    combine(combinations, candidate_idxs.size(), need);
+    for (auto &comb : *combinations)
+    {
+        survive_idxs = received_idxs;
+        for (auto &c : comb)
+        {
+            survive_idxs.push_back(candidate_idxs[c - 1]);
+        }
+        if (make_decoding_coefficients(k, g_m, real_l, survive_idxs, failed_idxs, coefficients, encode_type))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// the coefficients of the data blocks for each new parity block in merging, parity_idxs.size() * data_idxs.size(), row-major
+// global parities are the same as encode_partial_blocks_for_gr, a local parity is the sum of the data blocks in its group,
+// and for Optimal Cauchy LRC, plus the sum of the global parities
+bool ECProject::make_recal_coefficients(int k, int g_m, int real_l, std::vector<int> &data_idxs, std::vector<int> &group_idxs, std::vector<int> &parity_idxs, std::vector<int> &coefficients, EncodeType encode_type)
+{
+    int *rs_matrix = NULL;
+    if (encode_type == Azure_LRC)
+    {
+        rs_matrix = reed_sol_vandermonde_coding_matrix(k, g_m, 8);
+    }
+    else if (encode_type == Optimal_Cauchy_LRC)
+    {
+        rs_matrix = cauchy_good_general_coding_matrix(k, g_m, 8);
+    }
+    if (rs_matrix == NULL || data_idxs.size() != group_idxs.size())
+    {
+        free(rs_matrix);
+        return false;
+    }
+    int block_num = int(data_idxs.size());
+    coefficients.assign(parity_idxs.size() * block_num, 0);
+    for (int i = 0; i < int(parity_idxs.size()); i++)
+    {
+        int p = parity_idxs[i];
+        for (int j = 0; j < block_num; j++)
+        {
+            int d = data_idxs[j];
+            if (p < k + g_m)
+            {
+                coefficients[i * block_num + j] = rs_matrix[(p - k) * k + d];
+            }
+            else
+            {
+                int coef = (group_idxs[j] == p - k - g_m) ? 1 : 0;
+                if (encode_type == Optimal_Cauchy_LRC)
+                {
+                    for (int r = 0; r < g_m; r++)
+                    {
+                        coef ^= rs_matrix[r * k + d];
+                    }
+                }
+                coefficients[i * block_num + j] = coef;
+            }
+        }
+    }
+    free(rs_matrix);
+    return true;
+}
@@ -31,8 +31,21 @@ static const char* coordinatorService_method_names[] = {
   "/coordinator_proto.coordinatorService/getValue",
   "/coordinator_proto.coordinatorService/delByKey",
   "/coordinator_proto.coordinatorService/delByStripe",
+  "/coordinator_proto.coordinatorService/uploadOriginKeyValues",
+  "/coordinator_proto.coordinatorService/reportCommitAborts",
+  "/coordinator_proto.coordinatorService/checkCommitAborts",
+  "/coordinator_proto.coordinatorService/getValues",
+  "/coordinator_proto.coordinatorService/delByKeys",
   "/coordinator_proto.coordinatorService/requestMerge",
+  "/coordinator_proto.coordinatorService/startMerge",
+  "/coordinator_proto.coordinatorService/getMergeStatus",
+  "/coordinator_proto.coordinatorService/cancelMerge",
+  "/coordinator_proto.coordinatorService/setMergePolicy",
+  "/coordinator_proto.coordinatorService/planMerge",
+  "/coordinator_proto.coordinatorService/appendMerge",
+  "/coordinator_proto.coordinatorService/splitStripe",
   "/coordinator_proto.coordinatorService/listStripes",
+  "/coordinator_proto.coordinatorService/reportNodeStatus",
 };
 
 std::unique_ptr< coordinatorService::Stub> coordinatorService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -51,8 +64,21 @@ coordinatorService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>&
   , rpcmethod_getValue_(coordinatorService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_delByKey_(coordinatorService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_delByStripe_(coordinatorService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_requestMerge_(coordinatorService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_listStripes_(coordinatorService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_uploadOriginKeyValues_(coordinatorService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_reportCommitAborts_(coordinatorService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_checkCommitAborts_(coordinatorService_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_getValues_(coordinatorService_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_delByKeys_(coordinatorService_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_requestMerge_(coordinatorService_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_startMerge_(coordinatorService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_getMergeStatus_(coordinatorService_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_cancelMerge_(coordinatorService_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_setMergePolicy_(coordinatorService_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_planMerge_(coordinatorService_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_appendMerge_(coordinatorService_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_splitStripe_(coordinatorService_method_names[21], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_listStripes_(coordinatorService_method_names[22], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_reportNodeStatus_(coordinatorService_method_names[23], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status coordinatorService::Stub::sayHelloToCoordinator(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::coordinator_proto::ReplyFromCoordinator* response) {
@@ -262,6 +288,121 @@ void coordinatorService::Stub::async::delByStripe(::grpc::ClientContext* context
   return result;
 }
 
+::grpc::Status coordinatorService::Stub::uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::coordinator_proto::ReplyProxyIPPorts* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::RequestProxyIPPorts, ::coordinator_proto::ReplyProxyIPPorts, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_uploadOriginKeyValues_, context, request, response);
+}
+
+void coordinatorService::Stub::async::uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::RequestProxyIPPorts, ::coordinator_proto::ReplyProxyIPPorts, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_uploadOriginKeyValues_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_uploadOriginKeyValues_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyProxyIPPorts>* coordinatorService::Stub::PrepareAsyncuploadOriginKeyValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::ReplyProxyIPPorts, ::coordinator_proto::RequestProxyIPPorts, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_uploadOriginKeyValues_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyProxyIPPorts>* coordinatorService::Stub::AsyncuploadOriginKeyValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncuploadOriginKeyValuesRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::coordinator_proto::ReplyFromCoordinator* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::CommitAbortKeys, ::coordinator_proto::ReplyFromCoordinator, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_reportCommitAborts_, context, request, response);
+}
+
+void coordinatorService::Stub::async::reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::CommitAbortKeys, ::coordinator_proto::ReplyFromCoordinator, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_reportCommitAborts_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_reportCommitAborts_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>* coordinatorService::Stub::PrepareAsyncreportCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::ReplyFromCoordinator, ::coordinator_proto::CommitAbortKeys, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_reportCommitAborts_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>* coordinatorService::Stub::AsyncreportCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncreportCommitAbortsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::coordinator_proto::RepIfSuccess* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::AskIfSuccessBatch, ::coordinator_proto::RepIfSuccess, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_checkCommitAborts_, context, request, response);
+}
+
+void coordinatorService::Stub::async::checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::AskIfSuccessBatch, ::coordinator_proto::RepIfSuccess, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_checkCommitAborts_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_checkCommitAborts_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>* coordinatorService::Stub::PrepareAsynccheckCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::RepIfSuccess, ::coordinator_proto::AskIfSuccessBatch, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_checkCommitAborts_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>* coordinatorService::Stub::AsynccheckCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsynccheckCommitAbortsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::coordinator_proto::RepIfGetSuccesses* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::KeysAndClientIP, ::coordinator_proto::RepIfGetSuccesses, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_getValues_, context, request, response);
+}
+
+void coordinatorService::Stub::async::getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::KeysAndClientIP, ::coordinator_proto::RepIfGetSuccesses, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_getValues_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_getValues_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfGetSuccesses>* coordinatorService::Stub::PrepareAsyncgetValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::RepIfGetSuccesses, ::coordinator_proto::KeysAndClientIP, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_getValues_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfGetSuccesses>* coordinatorService::Stub::AsyncgetValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncgetValuesRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::coordinator_proto::RepIfDeling* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::KeysFromClient, ::coordinator_proto::RepIfDeling, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_delByKeys_, context, request, response);
+}
+
+void coordinatorService::Stub::async::delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::KeysFromClient, ::coordinator_proto::RepIfDeling, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_delByKeys_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_delByKeys_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>* coordinatorService::Stub::PrepareAsyncdelByKeysRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::RepIfDeling, ::coordinator_proto::KeysFromClient, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_delByKeys_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>* coordinatorService::Stub::AsyncdelByKeysRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncdelByKeysRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status coordinatorService::Stub::requestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::coordinator_proto::RepIfMerged* response) {
   return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_requestMerge_, context, request, response);
 }
@@ -285,6 +426,167 @@ void coordinatorService::Stub::async::requestMerge(::grpc::ClientContext* contex
   return result;
 }
 
+::grpc::Status coordinatorService::Stub::startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::coordinator_proto::MergeJobStatus* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::MergeJobRequest, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_startMerge_, context, request, response);
+}
+
+void coordinatorService::Stub::async::startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::MergeJobRequest, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_startMerge_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_startMerge_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* coordinatorService::Stub::PrepareAsyncstartMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::MergeJobStatus, ::coordinator_proto::MergeJobRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_startMerge_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* coordinatorService::Stub::AsyncstartMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncstartMergeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::coordinator_proto::MergeJobStatus* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_getMergeStatus_, context, request, response);
+}
+
+void coordinatorService::Stub::async::getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_getMergeStatus_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_getMergeStatus_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* coordinatorService::Stub::PrepareAsyncgetMergeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::MergeJobStatus, ::coordinator_proto::MergeJobId, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_getMergeStatus_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* coordinatorService::Stub::AsyncgetMergeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncgetMergeStatusRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::coordinator_proto::MergeJobStatus* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_cancelMerge_, context, request, response);
+}
+
+void coordinatorService::Stub::async::cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_cancelMerge_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_cancelMerge_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* coordinatorService::Stub::PrepareAsynccancelMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::MergeJobStatus, ::coordinator_proto::MergeJobId, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_cancelMerge_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* coordinatorService::Stub::AsynccancelMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsynccancelMergeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::coordinator_proto::RepIfSuccess* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::MergePolicy, ::coordinator_proto::RepIfSuccess, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_setMergePolicy_, context, request, response);
+}
+
+void coordinatorService::Stub::async::setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::MergePolicy, ::coordinator_proto::RepIfSuccess, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_setMergePolicy_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_setMergePolicy_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>* coordinatorService::Stub::PrepareAsyncsetMergePolicyRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::RepIfSuccess, ::coordinator_proto::MergePolicy, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_setMergePolicy_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>* coordinatorService::Stub::AsyncsetMergePolicyRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncsetMergePolicyRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::coordinator_proto::MergeSchedule* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::MergePlanRequest, ::coordinator_proto::MergeSchedule, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_planMerge_, context, request, response);
+}
+
+void coordinatorService::Stub::async::planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::MergePlanRequest, ::coordinator_proto::MergeSchedule, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_planMerge_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_planMerge_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeSchedule>* coordinatorService::Stub::PrepareAsyncplanMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::MergeSchedule, ::coordinator_proto::MergePlanRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_planMerge_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeSchedule>* coordinatorService::Stub::AsyncplanMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncplanMergeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::coordinator_proto::RepIfMerged* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::AppendMergeRequest, ::coordinator_proto::RepIfMerged, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_appendMerge_, context, request, response);
+}
+
+void coordinatorService::Stub::async::appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::AppendMergeRequest, ::coordinator_proto::RepIfMerged, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_appendMerge_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_appendMerge_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* coordinatorService::Stub::PrepareAsyncappendMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::RepIfMerged, ::coordinator_proto::AppendMergeRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_appendMerge_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* coordinatorService::Stub::AsyncappendMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncappendMergeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status coordinatorService::Stub::splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::coordinator_proto::RepIfMerged* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::StripeIdFromClient, ::coordinator_proto::RepIfMerged, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_splitStripe_, context, request, response);
+}
+
+void coordinatorService::Stub::async::splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::StripeIdFromClient, ::coordinator_proto::RepIfMerged, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_splitStripe_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_splitStripe_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* coordinatorService::Stub::PrepareAsyncsplitStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::RepIfMerged, ::coordinator_proto::StripeIdFromClient, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_splitStripe_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* coordinatorService::Stub::AsyncsplitStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncsplitStripeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status coordinatorService::Stub::listStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::coordinator_proto::RepStripeIds* response) {
   return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_listStripes_, context, request, response);
 }
@@ -308,6 +610,29 @@ void coordinatorService::Stub::async::listStripes(::grpc::ClientContext* context
   return result;
 }
 
+::grpc::Status coordinatorService::Stub::reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::coordinator_proto::ReplyFromCoordinator* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::coordinator_proto::NodeStatuses, ::coordinator_proto::ReplyFromCoordinator, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_reportNodeStatus_, context, request, response);
+}
+
+void coordinatorService::Stub::async::reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::coordinator_proto::NodeStatuses, ::coordinator_proto::ReplyFromCoordinator, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_reportNodeStatus_, context, request, response, std::move(f));
+}
+
+void coordinatorService::Stub::async::reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_reportNodeStatus_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>* coordinatorService::Stub::PrepareAsyncreportNodeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::coordinator_proto::ReplyFromCoordinator, ::coordinator_proto::NodeStatuses, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_reportNodeStatus_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>* coordinatorService::Stub::AsyncreportNodeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncreportNodeStatusRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 coordinatorService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       coordinatorService_method_names[0],
@@ -402,6 +727,56 @@ coordinatorService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       coordinatorService_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::RequestProxyIPPorts, ::coordinator_proto::ReplyProxyIPPorts, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::RequestProxyIPPorts* req,
+             ::coordinator_proto::ReplyProxyIPPorts* resp) {
+               return service->uploadOriginKeyValues(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[10],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::CommitAbortKeys, ::coordinator_proto::ReplyFromCoordinator, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::CommitAbortKeys* req,
+             ::coordinator_proto::ReplyFromCoordinator* resp) {
+               return service->reportCommitAborts(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[11],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::AskIfSuccessBatch, ::coordinator_proto::RepIfSuccess, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::AskIfSuccessBatch* req,
+             ::coordinator_proto::RepIfSuccess* resp) {
+               return service->checkCommitAborts(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[12],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::KeysAndClientIP, ::coordinator_proto::RepIfGetSuccesses, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::KeysAndClientIP* req,
+             ::coordinator_proto::RepIfGetSuccesses* resp) {
+               return service->getValues(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[13],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::KeysFromClient, ::coordinator_proto::RepIfDeling, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::KeysFromClient* req,
+             ::coordinator_proto::RepIfDeling* resp) {
+               return service->delByKeys(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[14],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](coordinatorService::Service* service,
              ::grpc::ServerContext* ctx,
@@ -410,7 +785,77 @@ coordinatorService::Service::Service() {
                return service->requestMerge(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      coordinatorService_method_names[10],
+      coordinatorService_method_names[15],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::MergeJobRequest, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::MergeJobRequest* req,
+             ::coordinator_proto::MergeJobStatus* resp) {
+               return service->startMerge(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[16],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::MergeJobId* req,
+             ::coordinator_proto::MergeJobStatus* resp) {
+               return service->getMergeStatus(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[17],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::MergeJobId* req,
+             ::coordinator_proto::MergeJobStatus* resp) {
+               return service->cancelMerge(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[18],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::MergePolicy, ::coordinator_proto::RepIfSuccess, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::MergePolicy* req,
+             ::coordinator_proto::RepIfSuccess* resp) {
+               return service->setMergePolicy(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[19],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::MergePlanRequest, ::coordinator_proto::MergeSchedule, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::MergePlanRequest* req,
+             ::coordinator_proto::MergeSchedule* resp) {
+               return service->planMerge(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[20],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::AppendMergeRequest, ::coordinator_proto::RepIfMerged, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::AppendMergeRequest* req,
+             ::coordinator_proto::RepIfMerged* resp) {
+               return service->appendMerge(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[21],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::StripeIdFromClient, ::coordinator_proto::RepIfMerged, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::StripeIdFromClient* req,
+             ::coordinator_proto::RepIfMerged* resp) {
+               return service->splitStripe(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[22],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](coordinatorService::Service* service,
@@ -419,6 +864,16 @@ coordinatorService::Service::Service() {
              ::coordinator_proto::RepStripeIds* resp) {
                return service->listStripes(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      coordinatorService_method_names[23],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< coordinatorService::Service, ::coordinator_proto::NodeStatuses, ::coordinator_proto::ReplyFromCoordinator, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](coordinatorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::coordinator_proto::NodeStatuses* req,
+             ::coordinator_proto::ReplyFromCoordinator* resp) {
+               return service->reportNodeStatus(ctx, req, resp);
+             }, this)));
 }
 
 coordinatorService::Service::~Service() {
@@ -487,6 +942,41 @@ coordinatorService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status coordinatorService::Service::uploadOriginKeyValues(::grpc::ServerContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::reportCommitAborts(::grpc::ServerContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::checkCommitAborts(::grpc::ServerContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::getValues(::grpc::ServerContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::delByKeys(::grpc::ServerContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status coordinatorService::Service::requestMerge(::grpc::ServerContext* context, const ::coordinator_proto::NumberOfStripesToMerge* request, ::coordinator_proto::RepIfMerged* response) {
   (void) context;
   (void) request;
@@ -494,6 +984,55 @@ coordinatorService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status coordinatorService::Service::startMerge(::grpc::ServerContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::getMergeStatus(::grpc::ServerContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::cancelMerge(::grpc::ServerContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::setMergePolicy(::grpc::ServerContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::planMerge(::grpc::ServerContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::appendMerge(::grpc::ServerContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status coordinatorService::Service::splitStripe(::grpc::ServerContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status coordinatorService::Service::listStripes(::grpc::ServerContext* context, const ::coordinator_proto::RequestToCoordinator* request, ::coordinator_proto::RepStripeIds* response) {
   (void) context;
   (void) request;
@@ -501,6 +1040,13 @@ coordinatorService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status coordinatorService::Service::reportNodeStatus(::grpc::ServerContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace coordinator_proto
 
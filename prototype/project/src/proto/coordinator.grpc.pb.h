@@ -119,6 +119,42 @@ class coordinatorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>> PrepareAsyncdelByStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>>(PrepareAsyncdelByStripeRaw(context, request, cq));
     }
+    // batch, many objects in one request
+    virtual ::grpc::Status uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::coordinator_proto::ReplyProxyIPPorts* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyProxyIPPorts>> AsyncuploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyProxyIPPorts>>(AsyncuploadOriginKeyValuesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyProxyIPPorts>> PrepareAsyncuploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyProxyIPPorts>>(PrepareAsyncuploadOriginKeyValuesRaw(context, request, cq));
+    }
+    virtual ::grpc::Status reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::coordinator_proto::ReplyFromCoordinator* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>> AsyncreportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>>(AsyncreportCommitAbortsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>> PrepareAsyncreportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>>(PrepareAsyncreportCommitAbortsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::coordinator_proto::RepIfSuccess* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>> AsynccheckCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>>(AsynccheckCommitAbortsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>> PrepareAsynccheckCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>>(PrepareAsynccheckCommitAbortsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::coordinator_proto::RepIfGetSuccesses* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfGetSuccesses>> AsyncgetValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfGetSuccesses>>(AsyncgetValuesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfGetSuccesses>> PrepareAsyncgetValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfGetSuccesses>>(PrepareAsyncgetValuesRaw(context, request, cq));
+    }
+    virtual ::grpc::Status delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::coordinator_proto::RepIfDeling* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>> AsyncdelByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>>(AsyncdelByKeysRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>> PrepareAsyncdelByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>>(PrepareAsyncdelByKeysRaw(context, request, cq));
+    }
     // lrcwidestripe, merge
     virtual ::grpc::Status requestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::coordinator_proto::RepIfMerged* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>> AsyncrequestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::grpc::CompletionQueue* cq) {
@@ -127,6 +163,55 @@ class coordinatorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>> PrepareAsyncrequestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>>(PrepareAsyncrequestMergeRaw(context, request, cq));
     }
+    virtual ::grpc::Status startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::coordinator_proto::MergeJobStatus* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>> AsyncstartMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>>(AsyncstartMergeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>> PrepareAsyncstartMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>>(PrepareAsyncstartMergeRaw(context, request, cq));
+    }
+    virtual ::grpc::Status getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::coordinator_proto::MergeJobStatus* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>> AsyncgetMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>>(AsyncgetMergeStatusRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>> PrepareAsyncgetMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>>(PrepareAsyncgetMergeStatusRaw(context, request, cq));
+    }
+    virtual ::grpc::Status cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::coordinator_proto::MergeJobStatus* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>> AsynccancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>>(AsynccancelMergeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>> PrepareAsynccancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>>(PrepareAsynccancelMergeRaw(context, request, cq));
+    }
+    virtual ::grpc::Status setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::coordinator_proto::RepIfSuccess* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>> AsyncsetMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>>(AsyncsetMergePolicyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>> PrepareAsyncsetMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>>(PrepareAsyncsetMergePolicyRaw(context, request, cq));
+    }
+    virtual ::grpc::Status planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::coordinator_proto::MergeSchedule* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeSchedule>> AsyncplanMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeSchedule>>(AsyncplanMergeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeSchedule>> PrepareAsyncplanMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeSchedule>>(PrepareAsyncplanMergeRaw(context, request, cq));
+    }
+    virtual ::grpc::Status appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::coordinator_proto::RepIfMerged* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>> AsyncappendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>>(AsyncappendMergeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>> PrepareAsyncappendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>>(PrepareAsyncappendMergeRaw(context, request, cq));
+    }
+    virtual ::grpc::Status splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::coordinator_proto::RepIfMerged* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>> AsyncsplitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>>(AsyncsplitStripeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>> PrepareAsyncsplitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>>(PrepareAsyncsplitStripeRaw(context, request, cq));
+    }
     // other
     virtual ::grpc::Status listStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::coordinator_proto::RepStripeIds* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepStripeIds>> AsynclistStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::grpc::CompletionQueue* cq) {
@@ -135,6 +220,13 @@ class coordinatorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepStripeIds>> PrepareAsynclistStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepStripeIds>>(PrepareAsynclistStripesRaw(context, request, cq));
     }
+    virtual ::grpc::Status reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::coordinator_proto::ReplyFromCoordinator* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>> AsyncreportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>>(AsyncreportNodeStatusRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>> PrepareAsyncreportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>>(PrepareAsyncreportNodeStatusRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -161,12 +253,39 @@ class coordinatorService final {
       virtual void delByKey(::grpc::ClientContext* context, const ::coordinator_proto::KeyFromClient* request, ::coordinator_proto::RepIfDeling* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void delByStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfDeling* response, std::function<void(::grpc::Status)>) = 0;
       virtual void delByStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfDeling* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // batch, many objects in one request
+      virtual void uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // lrcwidestripe, merge
       virtual void requestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge* request, ::coordinator_proto::RepIfMerged* response, std::function<void(::grpc::Status)>) = 0;
       virtual void requestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge* request, ::coordinator_proto::RepIfMerged* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // other
       virtual void listStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator* request, ::coordinator_proto::RepStripeIds* response, std::function<void(::grpc::Status)>) = 0;
       virtual void listStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator* request, ::coordinator_proto::RepStripeIds* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -190,10 +309,36 @@ class coordinatorService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>* PrepareAsyncdelByKeyRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeyFromClient& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>* AsyncdelByStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>* PrepareAsyncdelByStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyProxyIPPorts>* AsyncuploadOriginKeyValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyProxyIPPorts>* PrepareAsyncuploadOriginKeyValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>* AsyncreportCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>* PrepareAsyncreportCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>* AsynccheckCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>* PrepareAsynccheckCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfGetSuccesses>* AsyncgetValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfGetSuccesses>* PrepareAsyncgetValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>* AsyncdelByKeysRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfDeling>* PrepareAsyncdelByKeysRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>* AsyncrequestMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>* PrepareAsyncrequestMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>* AsyncstartMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>* PrepareAsyncstartMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>* AsyncgetMergeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>* PrepareAsyncgetMergeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>* AsynccancelMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeJobStatus>* PrepareAsynccancelMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>* AsyncsetMergePolicyRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfSuccess>* PrepareAsyncsetMergePolicyRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeSchedule>* AsyncplanMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::MergeSchedule>* PrepareAsyncplanMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>* AsyncappendMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>* PrepareAsyncappendMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>* AsyncsplitStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepIfMerged>* PrepareAsyncsplitStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepStripeIds>* AsynclistStripesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::RepStripeIds>* PrepareAsynclistStripesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>* AsyncreportNodeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::coordinator_proto::ReplyFromCoordinator>* PrepareAsyncreportNodeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -261,6 +406,41 @@ class coordinatorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>> PrepareAsyncdelByStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>>(PrepareAsyncdelByStripeRaw(context, request, cq));
     }
+    ::grpc::Status uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::coordinator_proto::ReplyProxyIPPorts* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyProxyIPPorts>> AsyncuploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyProxyIPPorts>>(AsyncuploadOriginKeyValuesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyProxyIPPorts>> PrepareAsyncuploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyProxyIPPorts>>(PrepareAsyncuploadOriginKeyValuesRaw(context, request, cq));
+    }
+    ::grpc::Status reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::coordinator_proto::ReplyFromCoordinator* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>> AsyncreportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>>(AsyncreportCommitAbortsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>> PrepareAsyncreportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>>(PrepareAsyncreportCommitAbortsRaw(context, request, cq));
+    }
+    ::grpc::Status checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::coordinator_proto::RepIfSuccess* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>> AsynccheckCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>>(AsynccheckCommitAbortsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>> PrepareAsynccheckCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>>(PrepareAsynccheckCommitAbortsRaw(context, request, cq));
+    }
+    ::grpc::Status getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::coordinator_proto::RepIfGetSuccesses* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfGetSuccesses>> AsyncgetValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfGetSuccesses>>(AsyncgetValuesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfGetSuccesses>> PrepareAsyncgetValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfGetSuccesses>>(PrepareAsyncgetValuesRaw(context, request, cq));
+    }
+    ::grpc::Status delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::coordinator_proto::RepIfDeling* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>> AsyncdelByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>>(AsyncdelByKeysRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>> PrepareAsyncdelByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>>(PrepareAsyncdelByKeysRaw(context, request, cq));
+    }
     ::grpc::Status requestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::coordinator_proto::RepIfMerged* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>> AsyncrequestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>>(AsyncrequestMergeRaw(context, request, cq));
@@ -268,6 +448,55 @@ class coordinatorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>> PrepareAsyncrequestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>>(PrepareAsyncrequestMergeRaw(context, request, cq));
     }
+    ::grpc::Status startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::coordinator_proto::MergeJobStatus* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>> AsyncstartMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>>(AsyncstartMergeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>> PrepareAsyncstartMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>>(PrepareAsyncstartMergeRaw(context, request, cq));
+    }
+    ::grpc::Status getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::coordinator_proto::MergeJobStatus* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>> AsyncgetMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>>(AsyncgetMergeStatusRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>> PrepareAsyncgetMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>>(PrepareAsyncgetMergeStatusRaw(context, request, cq));
+    }
+    ::grpc::Status cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::coordinator_proto::MergeJobStatus* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>> AsynccancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>>(AsynccancelMergeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>> PrepareAsynccancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>>(PrepareAsynccancelMergeRaw(context, request, cq));
+    }
+    ::grpc::Status setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::coordinator_proto::RepIfSuccess* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>> AsyncsetMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>>(AsyncsetMergePolicyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>> PrepareAsyncsetMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>>(PrepareAsyncsetMergePolicyRaw(context, request, cq));
+    }
+    ::grpc::Status planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::coordinator_proto::MergeSchedule* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeSchedule>> AsyncplanMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeSchedule>>(AsyncplanMergeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeSchedule>> PrepareAsyncplanMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeSchedule>>(PrepareAsyncplanMergeRaw(context, request, cq));
+    }
+    ::grpc::Status appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::coordinator_proto::RepIfMerged* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>> AsyncappendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>>(AsyncappendMergeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>> PrepareAsyncappendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>>(PrepareAsyncappendMergeRaw(context, request, cq));
+    }
+    ::grpc::Status splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::coordinator_proto::RepIfMerged* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>> AsyncsplitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>>(AsyncsplitStripeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>> PrepareAsyncsplitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>>(PrepareAsyncsplitStripeRaw(context, request, cq));
+    }
     ::grpc::Status listStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::coordinator_proto::RepStripeIds* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepStripeIds>> AsynclistStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepStripeIds>>(AsynclistStripesRaw(context, request, cq));
@@ -275,6 +504,13 @@ class coordinatorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepStripeIds>> PrepareAsynclistStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepStripeIds>>(PrepareAsynclistStripesRaw(context, request, cq));
     }
+    ::grpc::Status reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::coordinator_proto::ReplyFromCoordinator* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>> AsyncreportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>>(AsyncreportNodeStatusRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>> PrepareAsyncreportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>>(PrepareAsyncreportNodeStatusRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -296,10 +532,36 @@ class coordinatorService final {
       void delByKey(::grpc::ClientContext* context, const ::coordinator_proto::KeyFromClient* request, ::coordinator_proto::RepIfDeling* response, ::grpc::ClientUnaryReactor* reactor) override;
       void delByStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfDeling* response, std::function<void(::grpc::Status)>) override;
       void delByStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfDeling* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response, std::function<void(::grpc::Status)>) override;
+      void uploadOriginKeyValues(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response, std::function<void(::grpc::Status)>) override;
+      void reportCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response, std::function<void(::grpc::Status)>) override;
+      void checkCommitAborts(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response, std::function<void(::grpc::Status)>) override;
+      void getValues(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response, std::function<void(::grpc::Status)>) override;
+      void delByKeys(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response, ::grpc::ClientUnaryReactor* reactor) override;
       void requestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge* request, ::coordinator_proto::RepIfMerged* response, std::function<void(::grpc::Status)>) override;
       void requestMerge(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge* request, ::coordinator_proto::RepIfMerged* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)>) override;
+      void startMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)>) override;
+      void getMergeStatus(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, std::function<void(::grpc::Status)>) override;
+      void cancelMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response, std::function<void(::grpc::Status)>) override;
+      void setMergePolicy(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response, std::function<void(::grpc::Status)>) override;
+      void planMerge(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response, std::function<void(::grpc::Status)>) override;
+      void appendMerge(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response, std::function<void(::grpc::Status)>) override;
+      void splitStripe(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response, ::grpc::ClientUnaryReactor* reactor) override;
       void listStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator* request, ::coordinator_proto::RepStripeIds* response, std::function<void(::grpc::Status)>) override;
       void listStripes(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator* request, ::coordinator_proto::RepStripeIds* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response, std::function<void(::grpc::Status)>) override;
+      void reportNodeStatus(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -329,10 +591,36 @@ class coordinatorService final {
     ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>* PrepareAsyncdelByKeyRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeyFromClient& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>* AsyncdelByStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>* PrepareAsyncdelByStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyProxyIPPorts>* AsyncuploadOriginKeyValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyProxyIPPorts>* PrepareAsyncuploadOriginKeyValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestProxyIPPorts& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>* AsyncreportCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>* PrepareAsyncreportCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::CommitAbortKeys& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>* AsynccheckCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>* PrepareAsynccheckCommitAbortsRaw(::grpc::ClientContext* context, const ::coordinator_proto::AskIfSuccessBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfGetSuccesses>* AsyncgetValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfGetSuccesses>* PrepareAsyncgetValuesRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysAndClientIP& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>* AsyncdelByKeysRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfDeling>* PrepareAsyncdelByKeysRaw(::grpc::ClientContext* context, const ::coordinator_proto::KeysFromClient& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* AsyncrequestMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* PrepareAsyncrequestMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::NumberOfStripesToMerge& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* AsyncstartMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* PrepareAsyncstartMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* AsyncgetMergeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* PrepareAsyncgetMergeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* AsynccancelMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeJobStatus>* PrepareAsynccancelMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergeJobId& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>* AsyncsetMergePolicyRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfSuccess>* PrepareAsyncsetMergePolicyRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePolicy& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeSchedule>* AsyncplanMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::MergeSchedule>* PrepareAsyncplanMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::MergePlanRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* AsyncappendMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* PrepareAsyncappendMergeRaw(::grpc::ClientContext* context, const ::coordinator_proto::AppendMergeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* AsyncsplitStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepIfMerged>* PrepareAsyncsplitStripeRaw(::grpc::ClientContext* context, const ::coordinator_proto::StripeIdFromClient& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepStripeIds>* AsynclistStripesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::coordinator_proto::RepStripeIds>* PrepareAsynclistStripesRaw(::grpc::ClientContext* context, const ::coordinator_proto::RequestToCoordinator& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>* AsyncreportNodeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::coordinator_proto::ReplyFromCoordinator>* PrepareAsyncreportNodeStatusRaw(::grpc::ClientContext* context, const ::coordinator_proto::NodeStatuses& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_sayHelloToCoordinator_;
     const ::grpc::internal::RpcMethod rpcmethod_checkalive_;
     const ::grpc::internal::RpcMethod rpcmethod_setParameter_;
@@ -342,8 +630,21 @@ class coordinatorService final {
     const ::grpc::internal::RpcMethod rpcmethod_getValue_;
     const ::grpc::internal::RpcMethod rpcmethod_delByKey_;
     const ::grpc::internal::RpcMethod rpcmethod_delByStripe_;
+    const ::grpc::internal::RpcMethod rpcmethod_uploadOriginKeyValues_;
+    const ::grpc::internal::RpcMethod rpcmethod_reportCommitAborts_;
+    const ::grpc::internal::RpcMethod rpcmethod_checkCommitAborts_;
+    const ::grpc::internal::RpcMethod rpcmethod_getValues_;
+    const ::grpc::internal::RpcMethod rpcmethod_delByKeys_;
     const ::grpc::internal::RpcMethod rpcmethod_requestMerge_;
+    const ::grpc::internal::RpcMethod rpcmethod_startMerge_;
+    const ::grpc::internal::RpcMethod rpcmethod_getMergeStatus_;
+    const ::grpc::internal::RpcMethod rpcmethod_cancelMerge_;
+    const ::grpc::internal::RpcMethod rpcmethod_setMergePolicy_;
+    const ::grpc::internal::RpcMethod rpcmethod_planMerge_;
+    const ::grpc::internal::RpcMethod rpcmethod_appendMerge_;
+    const ::grpc::internal::RpcMethod rpcmethod_splitStripe_;
     const ::grpc::internal::RpcMethod rpcmethod_listStripes_;
+    const ::grpc::internal::RpcMethod rpcmethod_reportNodeStatus_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -365,10 +666,24 @@ class coordinatorService final {
     // delete
     virtual ::grpc::Status delByKey(::grpc::ServerContext* context, const ::coordinator_proto::KeyFromClient* request, ::coordinator_proto::RepIfDeling* response);
     virtual ::grpc::Status delByStripe(::grpc::ServerContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfDeling* response);
+    // batch, many objects in one request
+    virtual ::grpc::Status uploadOriginKeyValues(::grpc::ServerContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response);
+    virtual ::grpc::Status reportCommitAborts(::grpc::ServerContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response);
+    virtual ::grpc::Status checkCommitAborts(::grpc::ServerContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response);
+    virtual ::grpc::Status getValues(::grpc::ServerContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response);
+    virtual ::grpc::Status delByKeys(::grpc::ServerContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response);
     // lrcwidestripe, merge
     virtual ::grpc::Status requestMerge(::grpc::ServerContext* context, const ::coordinator_proto::NumberOfStripesToMerge* request, ::coordinator_proto::RepIfMerged* response);
+    virtual ::grpc::Status startMerge(::grpc::ServerContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response);
+    virtual ::grpc::Status getMergeStatus(::grpc::ServerContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response);
+    virtual ::grpc::Status cancelMerge(::grpc::ServerContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response);
+    virtual ::grpc::Status setMergePolicy(::grpc::ServerContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response);
+    virtual ::grpc::Status planMerge(::grpc::ServerContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response);
+    virtual ::grpc::Status appendMerge(::grpc::ServerContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response);
+    virtual ::grpc::Status splitStripe(::grpc::ServerContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response);
     // other
     virtual ::grpc::Status listStripes(::grpc::ServerContext* context, const ::coordinator_proto::RequestToCoordinator* request, ::coordinator_proto::RepStripeIds* response);
+    virtual ::grpc::Status reportNodeStatus(::grpc::ServerContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_sayHelloToCoordinator : public BaseClass {
@@ -551,12 +866,112 @@ class coordinatorService final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_uploadOriginKeyValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_uploadOriginKeyValues() {
+      ::grpc::Service::MarkMethodAsync(9);
+    }
+    ~WithAsyncMethod_uploadOriginKeyValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status uploadOriginKeyValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPorts* /*request*/, ::coordinator_proto::ReplyProxyIPPorts* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestuploadOriginKeyValues(::grpc::ServerContext* context, ::coordinator_proto::RequestProxyIPPorts* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::ReplyProxyIPPorts>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_reportCommitAborts : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_reportCommitAborts() {
+      ::grpc::Service::MarkMethodAsync(10);
+    }
+    ~WithAsyncMethod_reportCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status reportCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::CommitAbortKeys* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestreportCommitAborts(::grpc::ServerContext* context, ::coordinator_proto::CommitAbortKeys* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::ReplyFromCoordinator>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_checkCommitAborts : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_checkCommitAborts() {
+      ::grpc::Service::MarkMethodAsync(11);
+    }
+    ~WithAsyncMethod_checkCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status checkCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AskIfSuccessBatch* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestcheckCommitAborts(::grpc::ServerContext* context, ::coordinator_proto::AskIfSuccessBatch* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::RepIfSuccess>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_getValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_getValues() {
+      ::grpc::Service::MarkMethodAsync(12);
+    }
+    ~WithAsyncMethod_getValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccesses* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestgetValues(::grpc::ServerContext* context, ::coordinator_proto::KeysAndClientIP* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::RepIfGetSuccesses>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_delByKeys : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_delByKeys() {
+      ::grpc::Service::MarkMethodAsync(13);
+    }
+    ~WithAsyncMethod_delByKeys() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delByKeys(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdelByKeys(::grpc::ServerContext* context, ::coordinator_proto::KeysFromClient* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::RepIfDeling>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_requestMerge : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_requestMerge() {
-      ::grpc::Service::MarkMethodAsync(9);
+      ::grpc::Service::MarkMethodAsync(14);
     }
     ~WithAsyncMethod_requestMerge() override {
       BaseClassMustBeDerivedFromService(this);
@@ -567,7 +982,147 @@ class coordinatorService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestrequestMerge(::grpc::ServerContext* context, ::coordinator_proto::NumberOfStripesToMerge* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::RepIfMerged>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_startMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_startMerge() {
+      ::grpc::Service::MarkMethodAsync(15);
+    }
+    ~WithAsyncMethod_startMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status startMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobRequest* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequeststartMerge(::grpc::ServerContext* context, ::coordinator_proto::MergeJobRequest* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::MergeJobStatus>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_getMergeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_getMergeStatus() {
+      ::grpc::Service::MarkMethodAsync(16);
+    }
+    ~WithAsyncMethod_getMergeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMergeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestgetMergeStatus(::grpc::ServerContext* context, ::coordinator_proto::MergeJobId* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::MergeJobStatus>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_cancelMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_cancelMerge() {
+      ::grpc::Service::MarkMethodAsync(17);
+    }
+    ~WithAsyncMethod_cancelMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status cancelMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestcancelMerge(::grpc::ServerContext* context, ::coordinator_proto::MergeJobId* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::MergeJobStatus>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_setMergePolicy : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_setMergePolicy() {
+      ::grpc::Service::MarkMethodAsync(18);
+    }
+    ~WithAsyncMethod_setMergePolicy() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setMergePolicy(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePolicy* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsetMergePolicy(::grpc::ServerContext* context, ::coordinator_proto::MergePolicy* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::RepIfSuccess>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_planMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_planMerge() {
+      ::grpc::Service::MarkMethodAsync(19);
+    }
+    ~WithAsyncMethod_planMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status planMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePlanRequest* /*request*/, ::coordinator_proto::MergeSchedule* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestplanMerge(::grpc::ServerContext* context, ::coordinator_proto::MergePlanRequest* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::MergeSchedule>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_appendMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_appendMerge() {
+      ::grpc::Service::MarkMethodAsync(20);
+    }
+    ~WithAsyncMethod_appendMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status appendMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AppendMergeRequest* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestappendMerge(::grpc::ServerContext* context, ::coordinator_proto::AppendMergeRequest* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::RepIfMerged>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_splitStripe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_splitStripe() {
+      ::grpc::Service::MarkMethodAsync(21);
+    }
+    ~WithAsyncMethod_splitStripe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status splitStripe(::grpc::ServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsplitStripe(::grpc::ServerContext* context, ::coordinator_proto::StripeIdFromClient* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::RepIfMerged>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -576,7 +1131,7 @@ class coordinatorService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_listStripes() {
-      ::grpc::Service::MarkMethodAsync(10);
+      ::grpc::Service::MarkMethodAsync(22);
     }
     ~WithAsyncMethod_listStripes() override {
       BaseClassMustBeDerivedFromService(this);
@@ -587,10 +1142,30 @@ class coordinatorService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestlistStripes(::grpc::ServerContext* context, ::coordinator_proto::RequestToCoordinator* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::RepStripeIds>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_reportNodeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_reportNodeStatus() {
+      ::grpc::Service::MarkMethodAsync(23);
+    }
+    ~WithAsyncMethod_reportNodeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status reportNodeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NodeStatuses* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestreportNodeStatus(::grpc::ServerContext* context, ::coordinator_proto::NodeStatuses* request, ::grpc::ServerAsyncResponseWriter< ::coordinator_proto::ReplyFromCoordinator>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_sayHelloToCoordinator<WithAsyncMethod_checkalive<WithAsyncMethod_setParameter<WithAsyncMethod_uploadOriginKeyValue<WithAsyncMethod_reportCommitAbort<WithAsyncMethod_checkCommitAbort<WithAsyncMethod_getValue<WithAsyncMethod_delByKey<WithAsyncMethod_delByStripe<WithAsyncMethod_requestMerge<WithAsyncMethod_listStripes<Service > > > > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_sayHelloToCoordinator<WithAsyncMethod_checkalive<WithAsyncMethod_setParameter<WithAsyncMethod_uploadOriginKeyValue<WithAsyncMethod_reportCommitAbort<WithAsyncMethod_checkCommitAbort<WithAsyncMethod_getValue<WithAsyncMethod_delByKey<WithAsyncMethod_delByStripe<WithAsyncMethod_uploadOriginKeyValues<WithAsyncMethod_reportCommitAborts<WithAsyncMethod_checkCommitAborts<WithAsyncMethod_getValues<WithAsyncMethod_delByKeys<WithAsyncMethod_requestMerge<WithAsyncMethod_startMerge<WithAsyncMethod_getMergeStatus<WithAsyncMethod_cancelMerge<WithAsyncMethod_setMergePolicy<WithAsyncMethod_planMerge<WithAsyncMethod_appendMerge<WithAsyncMethod_splitStripe<WithAsyncMethod_listStripes<WithAsyncMethod_reportNodeStatus<Service > > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_sayHelloToCoordinator : public BaseClass {
    private:
@@ -835,69 +1410,420 @@ class coordinatorService final {
       ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithCallbackMethod_requestMerge : public BaseClass {
+  class WithCallbackMethod_uploadOriginKeyValues : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_requestMerge() {
+    WithCallbackMethod_uploadOriginKeyValues() {
       ::grpc::Service::MarkMethodCallback(9,
-          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged>(
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::RequestProxyIPPorts, ::coordinator_proto::ReplyProxyIPPorts>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::NumberOfStripesToMerge* request, ::coordinator_proto::RepIfMerged* response) { return this->requestMerge(context, request, response); }));}
-    void SetMessageAllocatorFor_requestMerge(
-        ::grpc::MessageAllocator< ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged>* allocator) {
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::RequestProxyIPPorts* request, ::coordinator_proto::ReplyProxyIPPorts* response) { return this->uploadOriginKeyValues(context, request, response); }));}
+    void SetMessageAllocatorFor_uploadOriginKeyValues(
+        ::grpc::MessageAllocator< ::coordinator_proto::RequestProxyIPPorts, ::coordinator_proto::ReplyProxyIPPorts>* allocator) {
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged>*>(handler)
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::RequestProxyIPPorts, ::coordinator_proto::ReplyProxyIPPorts>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~WithCallbackMethod_requestMerge() override {
+    ~WithCallbackMethod_uploadOriginKeyValues() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status requestMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+    ::grpc::Status uploadOriginKeyValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPorts* /*request*/, ::coordinator_proto::ReplyProxyIPPorts* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* requestMerge(
-      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerUnaryReactor* uploadOriginKeyValues(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPorts* /*request*/, ::coordinator_proto::ReplyProxyIPPorts* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithCallbackMethod_listStripes : public BaseClass {
+  class WithCallbackMethod_reportCommitAborts : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_listStripes() {
+    WithCallbackMethod_reportCommitAborts() {
       ::grpc::Service::MarkMethodCallback(10,
-          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds>(
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::CommitAbortKeys, ::coordinator_proto::ReplyFromCoordinator>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::RequestToCoordinator* request, ::coordinator_proto::RepStripeIds* response) { return this->listStripes(context, request, response); }));}
-    void SetMessageAllocatorFor_listStripes(
-        ::grpc::MessageAllocator< ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds>* allocator) {
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::CommitAbortKeys* request, ::coordinator_proto::ReplyFromCoordinator* response) { return this->reportCommitAborts(context, request, response); }));}
+    void SetMessageAllocatorFor_reportCommitAborts(
+        ::grpc::MessageAllocator< ::coordinator_proto::CommitAbortKeys, ::coordinator_proto::ReplyFromCoordinator>* allocator) {
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds>*>(handler)
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::CommitAbortKeys, ::coordinator_proto::ReplyFromCoordinator>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~WithCallbackMethod_listStripes() override {
+    ~WithCallbackMethod_reportCommitAborts() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status listStripes(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::RepStripeIds* /*response*/) override {
+    ::grpc::Status reportCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::CommitAbortKeys* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* listStripes(
-      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::RepStripeIds* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerUnaryReactor* reportCommitAborts(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::CommitAbortKeys* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_sayHelloToCoordinator<WithCallbackMethod_checkalive<WithCallbackMethod_setParameter<WithCallbackMethod_uploadOriginKeyValue<WithCallbackMethod_reportCommitAbort<WithCallbackMethod_checkCommitAbort<WithCallbackMethod_getValue<WithCallbackMethod_delByKey<WithCallbackMethod_delByStripe<WithCallbackMethod_requestMerge<WithCallbackMethod_listStripes<Service > > > > > > > > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
-  class WithGenericMethod_sayHelloToCoordinator : public BaseClass {
+  class WithCallbackMethod_checkCommitAborts : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_sayHelloToCoordinator() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
+    WithCallbackMethod_checkCommitAborts() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::AskIfSuccessBatch, ::coordinator_proto::RepIfSuccess>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::AskIfSuccessBatch* request, ::coordinator_proto::RepIfSuccess* response) { return this->checkCommitAborts(context, request, response); }));}
+    void SetMessageAllocatorFor_checkCommitAborts(
+        ::grpc::MessageAllocator< ::coordinator_proto::AskIfSuccessBatch, ::coordinator_proto::RepIfSuccess>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::AskIfSuccessBatch, ::coordinator_proto::RepIfSuccess>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_checkCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status checkCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AskIfSuccessBatch* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* checkCommitAborts(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::AskIfSuccessBatch* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_getValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_getValues() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::KeysAndClientIP, ::coordinator_proto::RepIfGetSuccesses>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::KeysAndClientIP* request, ::coordinator_proto::RepIfGetSuccesses* response) { return this->getValues(context, request, response); }));}
+    void SetMessageAllocatorFor_getValues(
+        ::grpc::MessageAllocator< ::coordinator_proto::KeysAndClientIP, ::coordinator_proto::RepIfGetSuccesses>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::KeysAndClientIP, ::coordinator_proto::RepIfGetSuccesses>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_getValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccesses* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* getValues(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::KeysAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccesses* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_delByKeys : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_delByKeys() {
+      ::grpc::Service::MarkMethodCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::KeysFromClient, ::coordinator_proto::RepIfDeling>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::KeysFromClient* request, ::coordinator_proto::RepIfDeling* response) { return this->delByKeys(context, request, response); }));}
+    void SetMessageAllocatorFor_delByKeys(
+        ::grpc::MessageAllocator< ::coordinator_proto::KeysFromClient, ::coordinator_proto::RepIfDeling>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::KeysFromClient, ::coordinator_proto::RepIfDeling>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_delByKeys() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delByKeys(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* delByKeys(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::KeysFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_requestMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_requestMerge() {
+      ::grpc::Service::MarkMethodCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::NumberOfStripesToMerge* request, ::coordinator_proto::RepIfMerged* response) { return this->requestMerge(context, request, response); }));}
+    void SetMessageAllocatorFor_requestMerge(
+        ::grpc::MessageAllocator< ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_requestMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status requestMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* requestMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_startMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_startMerge() {
+      ::grpc::Service::MarkMethodCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergeJobRequest, ::coordinator_proto::MergeJobStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::MergeJobRequest* request, ::coordinator_proto::MergeJobStatus* response) { return this->startMerge(context, request, response); }));}
+    void SetMessageAllocatorFor_startMerge(
+        ::grpc::MessageAllocator< ::coordinator_proto::MergeJobRequest, ::coordinator_proto::MergeJobStatus>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergeJobRequest, ::coordinator_proto::MergeJobStatus>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_startMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status startMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobRequest* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* startMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::MergeJobRequest* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_getMergeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_getMergeStatus() {
+      ::grpc::Service::MarkMethodCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response) { return this->getMergeStatus(context, request, response); }));}
+    void SetMessageAllocatorFor_getMergeStatus(
+        ::grpc::MessageAllocator< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_getMergeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMergeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* getMergeStatus(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_cancelMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_cancelMerge() {
+      ::grpc::Service::MarkMethodCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::MergeJobId* request, ::coordinator_proto::MergeJobStatus* response) { return this->cancelMerge(context, request, response); }));}
+    void SetMessageAllocatorFor_cancelMerge(
+        ::grpc::MessageAllocator< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_cancelMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status cancelMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* cancelMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_setMergePolicy : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_setMergePolicy() {
+      ::grpc::Service::MarkMethodCallback(18,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergePolicy, ::coordinator_proto::RepIfSuccess>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::MergePolicy* request, ::coordinator_proto::RepIfSuccess* response) { return this->setMergePolicy(context, request, response); }));}
+    void SetMessageAllocatorFor_setMergePolicy(
+        ::grpc::MessageAllocator< ::coordinator_proto::MergePolicy, ::coordinator_proto::RepIfSuccess>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(18);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergePolicy, ::coordinator_proto::RepIfSuccess>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_setMergePolicy() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setMergePolicy(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePolicy* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* setMergePolicy(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::MergePolicy* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_planMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_planMerge() {
+      ::grpc::Service::MarkMethodCallback(19,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergePlanRequest, ::coordinator_proto::MergeSchedule>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::MergePlanRequest* request, ::coordinator_proto::MergeSchedule* response) { return this->planMerge(context, request, response); }));}
+    void SetMessageAllocatorFor_planMerge(
+        ::grpc::MessageAllocator< ::coordinator_proto::MergePlanRequest, ::coordinator_proto::MergeSchedule>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(19);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::MergePlanRequest, ::coordinator_proto::MergeSchedule>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_planMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status planMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePlanRequest* /*request*/, ::coordinator_proto::MergeSchedule* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* planMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::MergePlanRequest* /*request*/, ::coordinator_proto::MergeSchedule* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_appendMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_appendMerge() {
+      ::grpc::Service::MarkMethodCallback(20,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::AppendMergeRequest, ::coordinator_proto::RepIfMerged>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::AppendMergeRequest* request, ::coordinator_proto::RepIfMerged* response) { return this->appendMerge(context, request, response); }));}
+    void SetMessageAllocatorFor_appendMerge(
+        ::grpc::MessageAllocator< ::coordinator_proto::AppendMergeRequest, ::coordinator_proto::RepIfMerged>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(20);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::AppendMergeRequest, ::coordinator_proto::RepIfMerged>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_appendMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status appendMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AppendMergeRequest* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* appendMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::AppendMergeRequest* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_splitStripe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_splitStripe() {
+      ::grpc::Service::MarkMethodCallback(21,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::StripeIdFromClient, ::coordinator_proto::RepIfMerged>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::StripeIdFromClient* request, ::coordinator_proto::RepIfMerged* response) { return this->splitStripe(context, request, response); }));}
+    void SetMessageAllocatorFor_splitStripe(
+        ::grpc::MessageAllocator< ::coordinator_proto::StripeIdFromClient, ::coordinator_proto::RepIfMerged>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(21);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::StripeIdFromClient, ::coordinator_proto::RepIfMerged>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_splitStripe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status splitStripe(::grpc::ServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* splitStripe(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_listStripes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_listStripes() {
+      ::grpc::Service::MarkMethodCallback(22,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::RequestToCoordinator* request, ::coordinator_proto::RepStripeIds* response) { return this->listStripes(context, request, response); }));}
+    void SetMessageAllocatorFor_listStripes(
+        ::grpc::MessageAllocator< ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(22);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_listStripes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status listStripes(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::RepStripeIds* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* listStripes(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::RepStripeIds* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_reportNodeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_reportNodeStatus() {
+      ::grpc::Service::MarkMethodCallback(23,
+          new ::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::NodeStatuses, ::coordinator_proto::ReplyFromCoordinator>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::coordinator_proto::NodeStatuses* request, ::coordinator_proto::ReplyFromCoordinator* response) { return this->reportNodeStatus(context, request, response); }));}
+    void SetMessageAllocatorFor_reportNodeStatus(
+        ::grpc::MessageAllocator< ::coordinator_proto::NodeStatuses, ::coordinator_proto::ReplyFromCoordinator>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(23);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::coordinator_proto::NodeStatuses, ::coordinator_proto::ReplyFromCoordinator>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_reportNodeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status reportNodeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NodeStatuses* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* reportNodeStatus(
+      ::grpc::CallbackServerContext* /*context*/, const ::coordinator_proto::NodeStatuses* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_sayHelloToCoordinator<WithCallbackMethod_checkalive<WithCallbackMethod_setParameter<WithCallbackMethod_uploadOriginKeyValue<WithCallbackMethod_reportCommitAbort<WithCallbackMethod_checkCommitAbort<WithCallbackMethod_getValue<WithCallbackMethod_delByKey<WithCallbackMethod_delByStripe<WithCallbackMethod_uploadOriginKeyValues<WithCallbackMethod_reportCommitAborts<WithCallbackMethod_checkCommitAborts<WithCallbackMethod_getValues<WithCallbackMethod_delByKeys<WithCallbackMethod_requestMerge<WithCallbackMethod_startMerge<WithCallbackMethod_getMergeStatus<WithCallbackMethod_cancelMerge<WithCallbackMethod_setMergePolicy<WithCallbackMethod_planMerge<WithCallbackMethod_appendMerge<WithCallbackMethod_splitStripe<WithCallbackMethod_listStripes<WithCallbackMethod_reportNodeStatus<Service > > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_sayHelloToCoordinator : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_sayHelloToCoordinator() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
     ~WithGenericMethod_sayHelloToCoordinator() override {
       BaseClassMustBeDerivedFromService(this);
     }
@@ -1044,257 +1970,738 @@ class coordinatorService final {
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_requestMerge : public BaseClass {
+  class WithGenericMethod_uploadOriginKeyValues : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_requestMerge() {
+    WithGenericMethod_uploadOriginKeyValues() {
       ::grpc::Service::MarkMethodGeneric(9);
     }
-    ~WithGenericMethod_requestMerge() override {
+    ~WithGenericMethod_uploadOriginKeyValues() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status requestMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+    ::grpc::Status uploadOriginKeyValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPorts* /*request*/, ::coordinator_proto::ReplyProxyIPPorts* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_listStripes : public BaseClass {
+  class WithGenericMethod_reportCommitAborts : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_listStripes() {
+    WithGenericMethod_reportCommitAborts() {
       ::grpc::Service::MarkMethodGeneric(10);
     }
-    ~WithGenericMethod_listStripes() override {
+    ~WithGenericMethod_reportCommitAborts() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status listStripes(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::RepStripeIds* /*response*/) override {
+    ::grpc::Status reportCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::CommitAbortKeys* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithRawMethod_sayHelloToCoordinator : public BaseClass {
+  class WithGenericMethod_checkCommitAborts : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_sayHelloToCoordinator() {
-      ::grpc::Service::MarkMethodRaw(0);
+    WithGenericMethod_checkCommitAborts() {
+      ::grpc::Service::MarkMethodGeneric(11);
     }
-    ~WithRawMethod_sayHelloToCoordinator() override {
+    ~WithGenericMethod_checkCommitAborts() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status sayHelloToCoordinator(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+    ::grpc::Status checkCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AskIfSuccessBatch* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestsayHelloToCoordinator(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+  };
+  template <class BaseClass>
+  class WithGenericMethod_getValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_getValues() {
+      ::grpc::Service::MarkMethodGeneric(12);
+    }
+    ~WithGenericMethod_getValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccesses* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithRawMethod_checkalive : public BaseClass {
+  class WithGenericMethod_delByKeys : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_checkalive() {
-      ::grpc::Service::MarkMethodRaw(1);
+    WithGenericMethod_delByKeys() {
+      ::grpc::Service::MarkMethodGeneric(13);
     }
-    ~WithRawMethod_checkalive() override {
+    ~WithGenericMethod_delByKeys() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status checkalive(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+    ::grpc::Status delByKeys(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_requestMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_requestMerge() {
+      ::grpc::Service::MarkMethodGeneric(14);
+    }
+    ~WithGenericMethod_requestMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status requestMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_startMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_startMerge() {
+      ::grpc::Service::MarkMethodGeneric(15);
+    }
+    ~WithGenericMethod_startMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status startMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobRequest* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_getMergeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_getMergeStatus() {
+      ::grpc::Service::MarkMethodGeneric(16);
+    }
+    ~WithGenericMethod_getMergeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMergeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_cancelMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_cancelMerge() {
+      ::grpc::Service::MarkMethodGeneric(17);
+    }
+    ~WithGenericMethod_cancelMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status cancelMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_setMergePolicy : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_setMergePolicy() {
+      ::grpc::Service::MarkMethodGeneric(18);
+    }
+    ~WithGenericMethod_setMergePolicy() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setMergePolicy(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePolicy* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_planMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_planMerge() {
+      ::grpc::Service::MarkMethodGeneric(19);
+    }
+    ~WithGenericMethod_planMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status planMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePlanRequest* /*request*/, ::coordinator_proto::MergeSchedule* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_appendMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_appendMerge() {
+      ::grpc::Service::MarkMethodGeneric(20);
+    }
+    ~WithGenericMethod_appendMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status appendMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AppendMergeRequest* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_splitStripe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_splitStripe() {
+      ::grpc::Service::MarkMethodGeneric(21);
+    }
+    ~WithGenericMethod_splitStripe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status splitStripe(::grpc::ServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_listStripes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_listStripes() {
+      ::grpc::Service::MarkMethodGeneric(22);
+    }
+    ~WithGenericMethod_listStripes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status listStripes(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::RepStripeIds* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_reportNodeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_reportNodeStatus() {
+      ::grpc::Service::MarkMethodGeneric(23);
+    }
+    ~WithGenericMethod_reportNodeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status reportNodeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NodeStatuses* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_sayHelloToCoordinator : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_sayHelloToCoordinator() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_sayHelloToCoordinator() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status sayHelloToCoordinator(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsayHelloToCoordinator(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_checkalive : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_checkalive() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_checkalive() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status checkalive(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestcheckalive(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_setParameter : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_setParameter() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_setParameter() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setParameter(::grpc::ServerContext* /*context*/, const ::coordinator_proto::Parameter* /*request*/, ::coordinator_proto::RepIfSetParaSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsetParameter(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_uploadOriginKeyValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_uploadOriginKeyValue() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_uploadOriginKeyValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status uploadOriginKeyValue(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPort* /*request*/, ::coordinator_proto::ReplyProxyIPPort* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestuploadOriginKeyValue(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_reportCommitAbort : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_reportCommitAbort() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_reportCommitAbort() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status reportCommitAbort(::grpc::ServerContext* /*context*/, const ::coordinator_proto::CommitAbortKey* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestreportCommitAbort(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_checkCommitAbort : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_checkCommitAbort() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_checkCommitAbort() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status checkCommitAbort(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AskIfSuccess* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestcheckCommitAbort(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_getValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_getValue() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_getValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getValue(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeyAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestgetValue(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_delByKey : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_delByKey() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_delByKey() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delByKey(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeyFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdelByKey(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_delByStripe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_delByStripe() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_delByStripe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delByStripe(::grpc::ServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdelByStripe(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_uploadOriginKeyValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_uploadOriginKeyValues() {
+      ::grpc::Service::MarkMethodRaw(9);
+    }
+    ~WithRawMethod_uploadOriginKeyValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status uploadOriginKeyValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPorts* /*request*/, ::coordinator_proto::ReplyProxyIPPorts* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestuploadOriginKeyValues(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_reportCommitAborts : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_reportCommitAborts() {
+      ::grpc::Service::MarkMethodRaw(10);
+    }
+    ~WithRawMethod_reportCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status reportCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::CommitAbortKeys* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestreportCommitAborts(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_checkCommitAborts : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_checkCommitAborts() {
+      ::grpc::Service::MarkMethodRaw(11);
+    }
+    ~WithRawMethod_checkCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status checkCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AskIfSuccessBatch* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestcheckCommitAborts(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_getValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_getValues() {
+      ::grpc::Service::MarkMethodRaw(12);
+    }
+    ~WithRawMethod_getValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccesses* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestgetValues(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_delByKeys : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_delByKeys() {
+      ::grpc::Service::MarkMethodRaw(13);
+    }
+    ~WithRawMethod_delByKeys() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delByKeys(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdelByKeys(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_requestMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_requestMerge() {
+      ::grpc::Service::MarkMethodRaw(14);
+    }
+    ~WithRawMethod_requestMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status requestMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void Requestcheckalive(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestrequestMerge(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_setParameter : public BaseClass {
+  class WithRawMethod_startMerge : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_setParameter() {
-      ::grpc::Service::MarkMethodRaw(2);
+    WithRawMethod_startMerge() {
+      ::grpc::Service::MarkMethodRaw(15);
     }
-    ~WithRawMethod_setParameter() override {
+    ~WithRawMethod_startMerge() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status setParameter(::grpc::ServerContext* /*context*/, const ::coordinator_proto::Parameter* /*request*/, ::coordinator_proto::RepIfSetParaSuccess* /*response*/) override {
+    ::grpc::Status startMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobRequest* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestsetParameter(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    void RequeststartMerge(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_uploadOriginKeyValue : public BaseClass {
+  class WithRawMethod_getMergeStatus : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_uploadOriginKeyValue() {
-      ::grpc::Service::MarkMethodRaw(3);
+    WithRawMethod_getMergeStatus() {
+      ::grpc::Service::MarkMethodRaw(16);
     }
-    ~WithRawMethod_uploadOriginKeyValue() override {
+    ~WithRawMethod_getMergeStatus() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status uploadOriginKeyValue(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPort* /*request*/, ::coordinator_proto::ReplyProxyIPPort* /*response*/) override {
+    ::grpc::Status getMergeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestuploadOriginKeyValue(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestgetMergeStatus(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_reportCommitAbort : public BaseClass {
+  class WithRawMethod_cancelMerge : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_reportCommitAbort() {
-      ::grpc::Service::MarkMethodRaw(4);
+    WithRawMethod_cancelMerge() {
+      ::grpc::Service::MarkMethodRaw(17);
     }
-    ~WithRawMethod_reportCommitAbort() override {
+    ~WithRawMethod_cancelMerge() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status reportCommitAbort(::grpc::ServerContext* /*context*/, const ::coordinator_proto::CommitAbortKey* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+    ::grpc::Status cancelMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestreportCommitAbort(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestcancelMerge(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_checkCommitAbort : public BaseClass {
+  class WithRawMethod_setMergePolicy : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_checkCommitAbort() {
-      ::grpc::Service::MarkMethodRaw(5);
+    WithRawMethod_setMergePolicy() {
+      ::grpc::Service::MarkMethodRaw(18);
     }
-    ~WithRawMethod_checkCommitAbort() override {
+    ~WithRawMethod_setMergePolicy() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status checkCommitAbort(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AskIfSuccess* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+    ::grpc::Status setMergePolicy(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePolicy* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestcheckCommitAbort(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestsetMergePolicy(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_getValue : public BaseClass {
+  class WithRawMethod_planMerge : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_getValue() {
-      ::grpc::Service::MarkMethodRaw(6);
+    WithRawMethod_planMerge() {
+      ::grpc::Service::MarkMethodRaw(19);
     }
-    ~WithRawMethod_getValue() override {
+    ~WithRawMethod_planMerge() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status getValue(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeyAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccess* /*response*/) override {
+    ::grpc::Status planMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePlanRequest* /*request*/, ::coordinator_proto::MergeSchedule* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestgetValue(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestplanMerge(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_delByKey : public BaseClass {
+  class WithRawMethod_appendMerge : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_delByKey() {
-      ::grpc::Service::MarkMethodRaw(7);
+    WithRawMethod_appendMerge() {
+      ::grpc::Service::MarkMethodRaw(20);
     }
-    ~WithRawMethod_delByKey() override {
+    ~WithRawMethod_appendMerge() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status delByKey(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeyFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+    ::grpc::Status appendMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AppendMergeRequest* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestdelByKey(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestappendMerge(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_delByStripe : public BaseClass {
+  class WithRawMethod_splitStripe : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_delByStripe() {
-      ::grpc::Service::MarkMethodRaw(8);
+    WithRawMethod_splitStripe() {
+      ::grpc::Service::MarkMethodRaw(21);
     }
-    ~WithRawMethod_delByStripe() override {
+    ~WithRawMethod_splitStripe() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status delByStripe(::grpc::ServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+    ::grpc::Status splitStripe(::grpc::ServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestdelByStripe(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestsplitStripe(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_requestMerge : public BaseClass {
+  class WithRawMethod_listStripes : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_requestMerge() {
-      ::grpc::Service::MarkMethodRaw(9);
+    WithRawMethod_listStripes() {
+      ::grpc::Service::MarkMethodRaw(22);
     }
-    ~WithRawMethod_requestMerge() override {
+    ~WithRawMethod_listStripes() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status requestMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+    ::grpc::Status listStripes(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::RepStripeIds* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestrequestMerge(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestlistStripes(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_listStripes : public BaseClass {
+  class WithRawMethod_reportNodeStatus : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_listStripes() {
-      ::grpc::Service::MarkMethodRaw(10);
+    WithRawMethod_reportNodeStatus() {
+      ::grpc::Service::MarkMethodRaw(23);
     }
-    ~WithRawMethod_listStripes() override {
+    ~WithRawMethod_reportNodeStatus() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status listStripes(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestToCoordinator* /*request*/, ::coordinator_proto::RepStripeIds* /*response*/) override {
+    ::grpc::Status reportNodeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NodeStatuses* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestlistStripes(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestreportNodeStatus(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1496,12 +2903,122 @@ class coordinatorService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_uploadOriginKeyValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_uploadOriginKeyValues() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->uploadOriginKeyValues(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_uploadOriginKeyValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status uploadOriginKeyValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPorts* /*request*/, ::coordinator_proto::ReplyProxyIPPorts* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* uploadOriginKeyValues(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_reportCommitAborts : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_reportCommitAborts() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->reportCommitAborts(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_reportCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status reportCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::CommitAbortKeys* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* reportCommitAborts(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_checkCommitAborts : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_checkCommitAborts() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->checkCommitAborts(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_checkCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status checkCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AskIfSuccessBatch* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* checkCommitAborts(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_getValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_getValues() {
+      ::grpc::Service::MarkMethodRawCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->getValues(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_getValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccesses* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* getValues(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_delByKeys : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_delByKeys() {
+      ::grpc::Service::MarkMethodRawCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->delByKeys(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_delByKeys() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status delByKeys(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* delByKeys(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_requestMerge : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_requestMerge() {
-      ::grpc::Service::MarkMethodRawCallback(9,
+      ::grpc::Service::MarkMethodRawCallback(14,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->requestMerge(context, request, response); }));
@@ -1510,11 +3027,165 @@ class coordinatorService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status requestMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+    ::grpc::Status requestMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NumberOfStripesToMerge* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* requestMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_startMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_startMerge() {
+      ::grpc::Service::MarkMethodRawCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->startMerge(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_startMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status startMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobRequest* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* startMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_getMergeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_getMergeStatus() {
+      ::grpc::Service::MarkMethodRawCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->getMergeStatus(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_getMergeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status getMergeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* getMergeStatus(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_cancelMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_cancelMerge() {
+      ::grpc::Service::MarkMethodRawCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->cancelMerge(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_cancelMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status cancelMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* cancelMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_setMergePolicy : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_setMergePolicy() {
+      ::grpc::Service::MarkMethodRawCallback(18,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->setMergePolicy(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_setMergePolicy() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status setMergePolicy(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePolicy* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* setMergePolicy(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_planMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_planMerge() {
+      ::grpc::Service::MarkMethodRawCallback(19,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->planMerge(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_planMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status planMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePlanRequest* /*request*/, ::coordinator_proto::MergeSchedule* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* planMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_appendMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_appendMerge() {
+      ::grpc::Service::MarkMethodRawCallback(20,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->appendMerge(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_appendMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status appendMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AppendMergeRequest* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* appendMerge(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_splitStripe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_splitStripe() {
+      ::grpc::Service::MarkMethodRawCallback(21,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->splitStripe(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_splitStripe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status splitStripe(::grpc::ServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* requestMerge(
+    virtual ::grpc::ServerUnaryReactor* splitStripe(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
@@ -1523,7 +3194,7 @@ class coordinatorService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_listStripes() {
-      ::grpc::Service::MarkMethodRawCallback(10,
+      ::grpc::Service::MarkMethodRawCallback(22,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->listStripes(context, request, response); }));
@@ -1540,6 +3211,28 @@ class coordinatorService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_reportNodeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_reportNodeStatus() {
+      ::grpc::Service::MarkMethodRawCallback(23,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->reportNodeStatus(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_reportNodeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status reportNodeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NodeStatuses* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* reportNodeStatus(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_sayHelloToCoordinator : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1783,12 +3476,147 @@ class coordinatorService final {
     virtual ::grpc::Status StreameddelByStripe(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::StripeIdFromClient,::coordinator_proto::RepIfDeling>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_uploadOriginKeyValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_uploadOriginKeyValues() {
+      ::grpc::Service::MarkMethodStreamed(9,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::RequestProxyIPPorts, ::coordinator_proto::ReplyProxyIPPorts>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::RequestProxyIPPorts, ::coordinator_proto::ReplyProxyIPPorts>* streamer) {
+                       return this->StreameduploadOriginKeyValues(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_uploadOriginKeyValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status uploadOriginKeyValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::RequestProxyIPPorts* /*request*/, ::coordinator_proto::ReplyProxyIPPorts* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreameduploadOriginKeyValues(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::RequestProxyIPPorts,::coordinator_proto::ReplyProxyIPPorts>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_reportCommitAborts : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_reportCommitAborts() {
+      ::grpc::Service::MarkMethodStreamed(10,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::CommitAbortKeys, ::coordinator_proto::ReplyFromCoordinator>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::CommitAbortKeys, ::coordinator_proto::ReplyFromCoordinator>* streamer) {
+                       return this->StreamedreportCommitAborts(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_reportCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status reportCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::CommitAbortKeys* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedreportCommitAborts(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::CommitAbortKeys,::coordinator_proto::ReplyFromCoordinator>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_checkCommitAborts : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_checkCommitAborts() {
+      ::grpc::Service::MarkMethodStreamed(11,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::AskIfSuccessBatch, ::coordinator_proto::RepIfSuccess>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::AskIfSuccessBatch, ::coordinator_proto::RepIfSuccess>* streamer) {
+                       return this->StreamedcheckCommitAborts(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_checkCommitAborts() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status checkCommitAborts(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AskIfSuccessBatch* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedcheckCommitAborts(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::AskIfSuccessBatch,::coordinator_proto::RepIfSuccess>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_getValues : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_getValues() {
+      ::grpc::Service::MarkMethodStreamed(12,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::KeysAndClientIP, ::coordinator_proto::RepIfGetSuccesses>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::KeysAndClientIP, ::coordinator_proto::RepIfGetSuccesses>* streamer) {
+                       return this->StreamedgetValues(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_getValues() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status getValues(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysAndClientIP* /*request*/, ::coordinator_proto::RepIfGetSuccesses* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedgetValues(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::KeysAndClientIP,::coordinator_proto::RepIfGetSuccesses>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_delByKeys : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_delByKeys() {
+      ::grpc::Service::MarkMethodStreamed(13,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::KeysFromClient, ::coordinator_proto::RepIfDeling>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::KeysFromClient, ::coordinator_proto::RepIfDeling>* streamer) {
+                       return this->StreameddelByKeys(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_delByKeys() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status delByKeys(::grpc::ServerContext* /*context*/, const ::coordinator_proto::KeysFromClient* /*request*/, ::coordinator_proto::RepIfDeling* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreameddelByKeys(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::KeysFromClient,::coordinator_proto::RepIfDeling>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_requestMerge : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_requestMerge() {
-      ::grpc::Service::MarkMethodStreamed(9,
+      ::grpc::Service::MarkMethodStreamed(14,
         new ::grpc::internal::StreamedUnaryHandler<
           ::coordinator_proto::NumberOfStripesToMerge, ::coordinator_proto::RepIfMerged>(
             [this](::grpc::ServerContext* context,
@@ -1810,12 +3638,201 @@ class coordinatorService final {
     virtual ::grpc::Status StreamedrequestMerge(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::NumberOfStripesToMerge,::coordinator_proto::RepIfMerged>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_startMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_startMerge() {
+      ::grpc::Service::MarkMethodStreamed(15,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::MergeJobRequest, ::coordinator_proto::MergeJobStatus>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::MergeJobRequest, ::coordinator_proto::MergeJobStatus>* streamer) {
+                       return this->StreamedstartMerge(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_startMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status startMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobRequest* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedstartMerge(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::MergeJobRequest,::coordinator_proto::MergeJobStatus>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_getMergeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_getMergeStatus() {
+      ::grpc::Service::MarkMethodStreamed(16,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>* streamer) {
+                       return this->StreamedgetMergeStatus(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_getMergeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status getMergeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedgetMergeStatus(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::MergeJobId,::coordinator_proto::MergeJobStatus>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_cancelMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_cancelMerge() {
+      ::grpc::Service::MarkMethodStreamed(17,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::MergeJobId, ::coordinator_proto::MergeJobStatus>* streamer) {
+                       return this->StreamedcancelMerge(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_cancelMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status cancelMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergeJobId* /*request*/, ::coordinator_proto::MergeJobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedcancelMerge(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::MergeJobId,::coordinator_proto::MergeJobStatus>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_setMergePolicy : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_setMergePolicy() {
+      ::grpc::Service::MarkMethodStreamed(18,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::MergePolicy, ::coordinator_proto::RepIfSuccess>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::MergePolicy, ::coordinator_proto::RepIfSuccess>* streamer) {
+                       return this->StreamedsetMergePolicy(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_setMergePolicy() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status setMergePolicy(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePolicy* /*request*/, ::coordinator_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedsetMergePolicy(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::MergePolicy,::coordinator_proto::RepIfSuccess>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_planMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_planMerge() {
+      ::grpc::Service::MarkMethodStreamed(19,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::MergePlanRequest, ::coordinator_proto::MergeSchedule>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::MergePlanRequest, ::coordinator_proto::MergeSchedule>* streamer) {
+                       return this->StreamedplanMerge(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_planMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status planMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::MergePlanRequest* /*request*/, ::coordinator_proto::MergeSchedule* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedplanMerge(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::MergePlanRequest,::coordinator_proto::MergeSchedule>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_appendMerge : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_appendMerge() {
+      ::grpc::Service::MarkMethodStreamed(20,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::AppendMergeRequest, ::coordinator_proto::RepIfMerged>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::AppendMergeRequest, ::coordinator_proto::RepIfMerged>* streamer) {
+                       return this->StreamedappendMerge(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_appendMerge() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status appendMerge(::grpc::ServerContext* /*context*/, const ::coordinator_proto::AppendMergeRequest* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedappendMerge(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::AppendMergeRequest,::coordinator_proto::RepIfMerged>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_splitStripe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_splitStripe() {
+      ::grpc::Service::MarkMethodStreamed(21,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::StripeIdFromClient, ::coordinator_proto::RepIfMerged>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::StripeIdFromClient, ::coordinator_proto::RepIfMerged>* streamer) {
+                       return this->StreamedsplitStripe(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_splitStripe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status splitStripe(::grpc::ServerContext* /*context*/, const ::coordinator_proto::StripeIdFromClient* /*request*/, ::coordinator_proto::RepIfMerged* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedsplitStripe(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::StripeIdFromClient,::coordinator_proto::RepIfMerged>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_listStripes : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_listStripes() {
-      ::grpc::Service::MarkMethodStreamed(10,
+      ::grpc::Service::MarkMethodStreamed(22,
         new ::grpc::internal::StreamedUnaryHandler<
           ::coordinator_proto::RequestToCoordinator, ::coordinator_proto::RepStripeIds>(
             [this](::grpc::ServerContext* context,
@@ -1836,9 +3853,36 @@ class coordinatorService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedlistStripes(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::RequestToCoordinator,::coordinator_proto::RepStripeIds>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_sayHelloToCoordinator<WithStreamedUnaryMethod_checkalive<WithStreamedUnaryMethod_setParameter<WithStreamedUnaryMethod_uploadOriginKeyValue<WithStreamedUnaryMethod_reportCommitAbort<WithStreamedUnaryMethod_checkCommitAbort<WithStreamedUnaryMethod_getValue<WithStreamedUnaryMethod_delByKey<WithStreamedUnaryMethod_delByStripe<WithStreamedUnaryMethod_requestMerge<WithStreamedUnaryMethod_listStripes<Service > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_reportNodeStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_reportNodeStatus() {
+      ::grpc::Service::MarkMethodStreamed(23,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::coordinator_proto::NodeStatuses, ::coordinator_proto::ReplyFromCoordinator>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::coordinator_proto::NodeStatuses, ::coordinator_proto::ReplyFromCoordinator>* streamer) {
+                       return this->StreamedreportNodeStatus(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_reportNodeStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status reportNodeStatus(::grpc::ServerContext* /*context*/, const ::coordinator_proto::NodeStatuses* /*request*/, ::coordinator_proto::ReplyFromCoordinator* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedreportNodeStatus(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::coordinator_proto::NodeStatuses,::coordinator_proto::ReplyFromCoordinator>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_sayHelloToCoordinator<WithStreamedUnaryMethod_checkalive<WithStreamedUnaryMethod_setParameter<WithStreamedUnaryMethod_uploadOriginKeyValue<WithStreamedUnaryMethod_reportCommitAbort<WithStreamedUnaryMethod_checkCommitAbort<WithStreamedUnaryMethod_getValue<WithStreamedUnaryMethod_delByKey<WithStreamedUnaryMethod_delByStripe<WithStreamedUnaryMethod_uploadOriginKeyValues<WithStreamedUnaryMethod_reportCommitAborts<WithStreamedUnaryMethod_checkCommitAborts<WithStreamedUnaryMethod_getValues<WithStreamedUnaryMethod_delByKeys<WithStreamedUnaryMethod_requestMerge<WithStreamedUnaryMethod_startMerge<WithStreamedUnaryMethod_getMergeStatus<WithStreamedUnaryMethod_cancelMerge<WithStreamedUnaryMethod_setMergePolicy<WithStreamedUnaryMethod_planMerge<WithStreamedUnaryMethod_appendMerge<WithStreamedUnaryMethod_splitStripe<WithStreamedUnaryMethod_listStripes<WithStreamedUnaryMethod_reportNodeStatus<Service > > > > > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_sayHelloToCoordinator<WithStreamedUnaryMethod_checkalive<WithStreamedUnaryMethod_setParameter<WithStreamedUnaryMethod_uploadOriginKeyValue<WithStreamedUnaryMethod_reportCommitAbort<WithStreamedUnaryMethod_checkCommitAbort<WithStreamedUnaryMethod_getValue<WithStreamedUnaryMethod_delByKey<WithStreamedUnaryMethod_delByStripe<WithStreamedUnaryMethod_requestMerge<WithStreamedUnaryMethod_listStripes<Service > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_sayHelloToCoordinator<WithStreamedUnaryMethod_checkalive<WithStreamedUnaryMethod_setParameter<WithStreamedUnaryMethod_uploadOriginKeyValue<WithStreamedUnaryMethod_reportCommitAbort<WithStreamedUnaryMethod_checkCommitAbort<WithStreamedUnaryMethod_getValue<WithStreamedUnaryMethod_delByKey<WithStreamedUnaryMethod_delByStripe<WithStreamedUnaryMethod_uploadOriginKeyValues<WithStreamedUnaryMethod_reportCommitAborts<WithStreamedUnaryMethod_checkCommitAborts<WithStreamedUnaryMethod_getValues<WithStreamedUnaryMethod_delByKeys<WithStreamedUnaryMethod_requestMerge<WithStreamedUnaryMethod_startMerge<WithStreamedUnaryMethod_getMergeStatus<WithStreamedUnaryMethod_cancelMerge<WithStreamedUnaryMethod_setMergePolicy<WithStreamedUnaryMethod_planMerge<WithStreamedUnaryMethod_appendMerge<WithStreamedUnaryMethod_splitStripe<WithStreamedUnaryMethod_listStripes<WithStreamedUnaryMethod_reportNodeStatus<Service > > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace coordinator_proto
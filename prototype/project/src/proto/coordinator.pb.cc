@@ -23,15 +23,17 @@ namespace _pbi = _pb::internal;
 namespace coordinator_proto {
 PROTOBUF_CONSTEXPR Parameter::Parameter(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.partial_decoding_)*/false
-  , /*decltype(_impl_.encodetype_)*/0
+    /*decltype(_impl_.encodetype_)*/0
   , /*decltype(_impl_.s_stripe_placementtype_)*/0
   , /*decltype(_impl_.m_stripe_placementtype_)*/0
   , /*decltype(_impl_.k_datablock_)*/0
+  , /*decltype(_impl_.partial_decoding_)*/false
+  , /*decltype(_impl_.reset_)*/false
   , /*decltype(_impl_.l_localparityblock_)*/0
   , /*decltype(_impl_.g_m_globalparityblock_)*/0
   , /*decltype(_impl_.b_datapergroup_)*/0
   , /*decltype(_impl_.x_stripepermergegroup_)*/0
+  , /*decltype(_impl_.pack_block_size_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ParameterDefaultTypeInternal {
   PROTOBUF_CONSTEXPR ParameterDefaultTypeInternal()
@@ -158,6 +160,8 @@ PROTOBUF_CONSTEXPR KeyAndClientIP::KeyAndClientIP(
     /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.clientip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.clientport_)*/0
+  , /*decltype(_impl_.offset_)*/0
+  , /*decltype(_impl_.length_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct KeyAndClientIPDefaultTypeInternal {
   PROTOBUF_CONSTEXPR KeyAndClientIPDefaultTypeInternal()
@@ -221,9 +225,136 @@ struct RepIfDelingDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RepIfDelingDefaultTypeInternal _RepIfDeling_default_instance_;
+PROTOBUF_CONSTEXPR RequestProxyIPPorts::RequestProxyIPPorts(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.objects_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestProxyIPPortsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestProxyIPPortsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestProxyIPPortsDefaultTypeInternal() {}
+  union {
+    RequestProxyIPPorts _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestProxyIPPortsDefaultTypeInternal _RequestProxyIPPorts_default_instance_;
+PROTOBUF_CONSTEXPR ReplyProxyIPPorts::ReplyProxyIPPorts(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.proxies_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplyProxyIPPortsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyProxyIPPortsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyProxyIPPortsDefaultTypeInternal() {}
+  union {
+    ReplyProxyIPPorts _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyProxyIPPortsDefaultTypeInternal _ReplyProxyIPPorts_default_instance_;
+PROTOBUF_CONSTEXPR NodeStatus::NodeStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.node_ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.free_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.node_port_)*/0
+  , /*decltype(_impl_.block_num_)*/0
+  , /*decltype(_impl_.io_bytes_per_sec_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NodeStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeStatusDefaultTypeInternal() {}
+  union {
+    NodeStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeStatusDefaultTypeInternal _NodeStatus_default_instance_;
+PROTOBUF_CONSTEXPR NodeStatuses::NodeStatuses(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nodes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NodeStatusesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeStatusesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeStatusesDefaultTypeInternal() {}
+  union {
+    NodeStatuses _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeStatusesDefaultTypeInternal _NodeStatuses_default_instance_;
+PROTOBUF_CONSTEXPR CommitAbortKeys::CommitAbortKeys(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommitAbortKeysDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitAbortKeysDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitAbortKeysDefaultTypeInternal() {}
+  union {
+    CommitAbortKeys _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitAbortKeysDefaultTypeInternal _CommitAbortKeys_default_instance_;
+PROTOBUF_CONSTEXPR AskIfSuccessBatch::AskIfSuccessBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.asks_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AskIfSuccessBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AskIfSuccessBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AskIfSuccessBatchDefaultTypeInternal() {}
+  union {
+    AskIfSuccessBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AskIfSuccessBatchDefaultTypeInternal _AskIfSuccessBatch_default_instance_;
+PROTOBUF_CONSTEXPR KeysAndClientIP::KeysAndClientIP(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.clientip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientport_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeysAndClientIPDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeysAndClientIPDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeysAndClientIPDefaultTypeInternal() {}
+  union {
+    KeysAndClientIP _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeysAndClientIPDefaultTypeInternal _KeysAndClientIP_default_instance_;
+PROTOBUF_CONSTEXPR RepIfGetSuccesses::RepIfGetSuccesses(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.valuesizebytes_)*/{}
+  , /*decltype(_impl_._valuesizebytes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.ifgetsuccess_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RepIfGetSuccessesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RepIfGetSuccessesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RepIfGetSuccessesDefaultTypeInternal() {}
+  union {
+    RepIfGetSuccesses _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RepIfGetSuccessesDefaultTypeInternal _RepIfGetSuccesses_default_instance_;
+PROTOBUF_CONSTEXPR KeysFromClient::KeysFromClient(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeysFromClientDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeysFromClientDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeysFromClientDefaultTypeInternal() {}
+  union {
+    KeysFromClient _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeysFromClientDefaultTypeInternal _KeysFromClient_default_instance_;
 PROTOBUF_CONSTEXPR NumberOfStripesToMerge::NumberOfStripesToMerge(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.num_of_stripes_)*/0
+  , /*decltype(_impl_.max_concurrency_)*/0
+  , /*decltype(_impl_.dry_run_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct NumberOfStripesToMergeDefaultTypeInternal {
   PROTOBUF_CONSTEXPR NumberOfStripesToMergeDefaultTypeInternal()
@@ -238,8 +369,14 @@ PROTOBUF_CONSTEXPR RepIfMerged::RepIfMerged(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.lc_)*/0
   , /*decltype(_impl_.gc_)*/0
-  , /*decltype(_impl_.dc_)*/0
   , /*decltype(_impl_.ifmerged_)*/false
+  , /*decltype(_impl_.g_cross_)*/0
+  , /*decltype(_impl_.dc_)*/0
+  , /*decltype(_impl_.g_intra_)*/0
+  , /*decltype(_impl_.l_cross_)*/0
+  , /*decltype(_impl_.l_intra_)*/0
+  , /*decltype(_impl_.d_cross_)*/0
+  , /*decltype(_impl_.d_intra_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RepIfMergedDefaultTypeInternal {
   PROTOBUF_CONSTEXPR RepIfMergedDefaultTypeInternal()
@@ -250,6 +387,127 @@ struct RepIfMergedDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RepIfMergedDefaultTypeInternal _RepIfMerged_default_instance_;
+PROTOBUF_CONSTEXPR MergeJobRequest::MergeJobRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.num_of_stripes_)*/{}
+  , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.max_concurrency_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MergeJobRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MergeJobRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MergeJobRequestDefaultTypeInternal() {}
+  union {
+    MergeJobRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MergeJobRequestDefaultTypeInternal _MergeJobRequest_default_instance_;
+PROTOBUF_CONSTEXPR MergePlanRequest::MergePlanRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.merge_factor_)*/0
+  , /*decltype(_impl_.max_stages_)*/0
+  , /*decltype(_impl_.execute_)*/false
+  , /*decltype(_impl_.max_concurrency_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MergePlanRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MergePlanRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MergePlanRequestDefaultTypeInternal() {}
+  union {
+    MergePlanRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MergePlanRequestDefaultTypeInternal _MergePlanRequest_default_instance_;
+PROTOBUF_CONSTEXPR MergeSchedule::MergeSchedule(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.num_of_stripes_)*/{}
+  , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.ifplanned_)*/false
+  , /*decltype(_impl_.cross_blocks_)*/0
+  , /*decltype(_impl_.intra_blocks_)*/0
+  , /*decltype(_impl_.job_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MergeScheduleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MergeScheduleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MergeScheduleDefaultTypeInternal() {}
+  union {
+    MergeSchedule _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MergeScheduleDefaultTypeInternal _MergeSchedule_default_instance_;
+PROTOBUF_CONSTEXPR AppendMergeRequest::AppendMergeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stripe_id_)*/0
+  , /*decltype(_impl_.wide_stripe_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendMergeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendMergeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendMergeRequestDefaultTypeInternal() {}
+  union {
+    AppendMergeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendMergeRequestDefaultTypeInternal _AppendMergeRequest_default_instance_;
+PROTOBUF_CONSTEXPR MergeJobId::MergeJobId(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.job_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MergeJobIdDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MergeJobIdDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MergeJobIdDefaultTypeInternal() {}
+  union {
+    MergeJobId _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MergeJobIdDefaultTypeInternal _MergeJobId_default_instance_;
+PROTOBUF_CONSTEXPR MergeJobStatus::MergeJobStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.job_id_)*/0
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_.stages_done_)*/0
+  , /*decltype(_impl_.stages_total_)*/0
+  , /*decltype(_impl_.stripes_merged_)*/0
+  , /*decltype(_impl_.stripes_total_)*/0
+  , /*decltype(_impl_.g_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.l_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.d_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.lc_)*/0
+  , /*decltype(_impl_.gc_)*/0
+  , /*decltype(_impl_.dc_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MergeJobStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MergeJobStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MergeJobStatusDefaultTypeInternal() {}
+  union {
+    MergeJobStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MergeJobStatusDefaultTypeInternal _MergeJobStatus_default_instance_;
+PROTOBUF_CONSTEXPR MergePolicy::MergePolicy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.num_of_stripes_)*/{}
+  , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.enable_)*/false
+  , /*decltype(_impl_.min_stripes_per_group_)*/0
+  , /*decltype(_impl_.bandwidth_)*/int64_t{0}
+  , /*decltype(_impl_.max_ops_per_sec_)*/0
+  , /*decltype(_impl_.check_interval_ms_)*/0
+  , /*decltype(_impl_.max_concurrency_)*/0
+  , /*decltype(_impl_.split_min_accesses_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MergePolicyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MergePolicyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MergePolicyDefaultTypeInternal() {}
+  union {
+    MergePolicy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MergePolicyDefaultTypeInternal _MergePolicy_default_instance_;
 PROTOBUF_CONSTEXPR RepStripeIds::RepStripeIds(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.stripe_ids_)*/{}
@@ -265,7 +523,7 @@ struct RepStripeIdsDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RepStripeIdsDefaultTypeInternal _RepStripeIds_default_instance_;
 }  // namespace coordinator_proto
-static ::_pb::Metadata file_level_metadata_coordinator_2eproto[17];
+static ::_pb::Metadata file_level_metadata_coordinator_2eproto[33];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_coordinator_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_coordinator_2eproto = nullptr;
 
@@ -285,6 +543,8 @@ const uint32_t TableStruct_coordinator_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::Parameter, _impl_.g_m_globalparityblock_),
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::Parameter, _impl_.b_datapergroup_),
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::Parameter, _impl_.x_stripepermergegroup_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::Parameter, _impl_.reset_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::Parameter, _impl_.pack_block_size_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfSetParaSuccess, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -357,6 +617,8 @@ const uint32_t TableStruct_coordinator_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeyAndClientIP, _impl_.key_),
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeyAndClientIP, _impl_.clientip_),
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeyAndClientIP, _impl_.clientport_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeyAndClientIP, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeyAndClientIP, _impl_.length_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfGetSuccess, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -387,12 +649,84 @@ const uint32_t TableStruct_coordinator_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfDeling, _impl_.ifdeling_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RequestProxyIPPorts, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RequestProxyIPPorts, _impl_.objects_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::ReplyProxyIPPorts, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::ReplyProxyIPPorts, _impl_.proxies_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NodeStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NodeStatus, _impl_.node_ip_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NodeStatus, _impl_.node_port_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NodeStatus, _impl_.free_bytes_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NodeStatus, _impl_.block_num_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NodeStatus, _impl_.io_bytes_per_sec_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NodeStatuses, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NodeStatuses, _impl_.nodes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::CommitAbortKeys, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::CommitAbortKeys, _impl_.keys_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::AskIfSuccessBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::AskIfSuccessBatch, _impl_.asks_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeysAndClientIP, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeysAndClientIP, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeysAndClientIP, _impl_.clientip_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeysAndClientIP, _impl_.clientport_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfGetSuccesses, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfGetSuccesses, _impl_.ifgetsuccess_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfGetSuccesses, _impl_.valuesizebytes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeysFromClient, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::KeysFromClient, _impl_.keys_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::NumberOfStripesToMerge, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::NumberOfStripesToMerge, _impl_.num_of_stripes_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NumberOfStripesToMerge, _impl_.max_concurrency_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::NumberOfStripesToMerge, _impl_.dry_run_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -403,6 +737,88 @@ const uint32_t TableStruct_coordinator_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.lc_),
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.gc_),
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.dc_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.g_cross_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.g_intra_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.l_cross_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.l_intra_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.d_cross_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepIfMerged, _impl_.d_intra_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobRequest, _impl_.num_of_stripes_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobRequest, _impl_.max_concurrency_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePlanRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePlanRequest, _impl_.merge_factor_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePlanRequest, _impl_.max_stages_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePlanRequest, _impl_.execute_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePlanRequest, _impl_.max_concurrency_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeSchedule, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeSchedule, _impl_.ifplanned_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeSchedule, _impl_.num_of_stripes_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeSchedule, _impl_.cross_blocks_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeSchedule, _impl_.intra_blocks_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeSchedule, _impl_.job_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::AppendMergeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::AppendMergeRequest, _impl_.stripe_id_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::AppendMergeRequest, _impl_.wide_stripe_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobId, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobId, _impl_.job_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.job_id_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.stages_done_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.stages_total_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.stripes_merged_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.stripes_total_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.g_bytes_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.l_bytes_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.d_bytes_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.lc_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.gc_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergeJobStatus, _impl_.dc_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _impl_.enable_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _impl_.num_of_stripes_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _impl_.min_stripes_per_group_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _impl_.max_ops_per_sec_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _impl_.bandwidth_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _impl_.check_interval_ms_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _impl_.max_concurrency_),
+  PROTOBUF_FIELD_OFFSET(::coordinator_proto::MergePolicy, _impl_.split_min_accesses_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::coordinator_proto::RepStripeIds, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -413,22 +829,38 @@ const uint32_t TableStruct_coordinator_2eproto::offsets[] PROTOBUF_SECTION_VARIA
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::coordinator_proto::Parameter)},
-  { 15, -1, -1, sizeof(::coordinator_proto::RepIfSetParaSuccess)},
-  { 22, -1, -1, sizeof(::coordinator_proto::RequestToCoordinator)},
-  { 29, -1, -1, sizeof(::coordinator_proto::ReplyFromCoordinator)},
-  { 36, -1, -1, sizeof(::coordinator_proto::RequestProxyIPPort)},
-  { 44, -1, -1, sizeof(::coordinator_proto::ReplyProxyIPPort)},
-  { 52, -1, -1, sizeof(::coordinator_proto::CommitAbortKey)},
-  { 62, -1, -1, sizeof(::coordinator_proto::AskIfSuccess)},
-  { 71, -1, -1, sizeof(::coordinator_proto::RepIfSuccess)},
-  { 78, -1, -1, sizeof(::coordinator_proto::KeyAndClientIP)},
-  { 87, -1, -1, sizeof(::coordinator_proto::RepIfGetSuccess)},
-  { 95, -1, -1, sizeof(::coordinator_proto::KeyFromClient)},
-  { 102, -1, -1, sizeof(::coordinator_proto::StripeIdFromClient)},
-  { 109, -1, -1, sizeof(::coordinator_proto::RepIfDeling)},
-  { 116, -1, -1, sizeof(::coordinator_proto::NumberOfStripesToMerge)},
-  { 123, -1, -1, sizeof(::coordinator_proto::RepIfMerged)},
-  { 133, -1, -1, sizeof(::coordinator_proto::RepStripeIds)},
+  { 17, -1, -1, sizeof(::coordinator_proto::RepIfSetParaSuccess)},
+  { 24, -1, -1, sizeof(::coordinator_proto::RequestToCoordinator)},
+  { 31, -1, -1, sizeof(::coordinator_proto::ReplyFromCoordinator)},
+  { 38, -1, -1, sizeof(::coordinator_proto::RequestProxyIPPort)},
+  { 46, -1, -1, sizeof(::coordinator_proto::ReplyProxyIPPort)},
+  { 54, -1, -1, sizeof(::coordinator_proto::CommitAbortKey)},
+  { 64, -1, -1, sizeof(::coordinator_proto::AskIfSuccess)},
+  { 73, -1, -1, sizeof(::coordinator_proto::RepIfSuccess)},
+  { 80, -1, -1, sizeof(::coordinator_proto::KeyAndClientIP)},
+  { 91, -1, -1, sizeof(::coordinator_proto::RepIfGetSuccess)},
+  { 99, -1, -1, sizeof(::coordinator_proto::KeyFromClient)},
+  { 106, -1, -1, sizeof(::coordinator_proto::StripeIdFromClient)},
+  { 113, -1, -1, sizeof(::coordinator_proto::RepIfDeling)},
+  { 120, -1, -1, sizeof(::coordinator_proto::RequestProxyIPPorts)},
+  { 127, -1, -1, sizeof(::coordinator_proto::ReplyProxyIPPorts)},
+  { 134, -1, -1, sizeof(::coordinator_proto::NodeStatus)},
+  { 145, -1, -1, sizeof(::coordinator_proto::NodeStatuses)},
+  { 152, -1, -1, sizeof(::coordinator_proto::CommitAbortKeys)},
+  { 159, -1, -1, sizeof(::coordinator_proto::AskIfSuccessBatch)},
+  { 166, -1, -1, sizeof(::coordinator_proto::KeysAndClientIP)},
+  { 175, -1, -1, sizeof(::coordinator_proto::RepIfGetSuccesses)},
+  { 183, -1, -1, sizeof(::coordinator_proto::KeysFromClient)},
+  { 190, -1, -1, sizeof(::coordinator_proto::NumberOfStripesToMerge)},
+  { 199, -1, -1, sizeof(::coordinator_proto::RepIfMerged)},
+  { 215, -1, -1, sizeof(::coordinator_proto::MergeJobRequest)},
+  { 223, -1, -1, sizeof(::coordinator_proto::MergePlanRequest)},
+  { 233, -1, -1, sizeof(::coordinator_proto::MergeSchedule)},
+  { 244, -1, -1, sizeof(::coordinator_proto::AppendMergeRequest)},
+  { 252, -1, -1, sizeof(::coordinator_proto::MergeJobId)},
+  { 259, -1, -1, sizeof(::coordinator_proto::MergeJobStatus)},
+  { 277, -1, -1, sizeof(::coordinator_proto::MergePolicy)},
+  { 291, -1, -1, sizeof(::coordinator_proto::RepStripeIds)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -446,20 +878,37 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::coordinator_proto::_KeyFromClient_default_instance_._instance,
   &::coordinator_proto::_StripeIdFromClient_default_instance_._instance,
   &::coordinator_proto::_RepIfDeling_default_instance_._instance,
+  &::coordinator_proto::_RequestProxyIPPorts_default_instance_._instance,
+  &::coordinator_proto::_ReplyProxyIPPorts_default_instance_._instance,
+  &::coordinator_proto::_NodeStatus_default_instance_._instance,
+  &::coordinator_proto::_NodeStatuses_default_instance_._instance,
+  &::coordinator_proto::_CommitAbortKeys_default_instance_._instance,
+  &::coordinator_proto::_AskIfSuccessBatch_default_instance_._instance,
+  &::coordinator_proto::_KeysAndClientIP_default_instance_._instance,
+  &::coordinator_proto::_RepIfGetSuccesses_default_instance_._instance,
+  &::coordinator_proto::_KeysFromClient_default_instance_._instance,
   &::coordinator_proto::_NumberOfStripesToMerge_default_instance_._instance,
   &::coordinator_proto::_RepIfMerged_default_instance_._instance,
+  &::coordinator_proto::_MergeJobRequest_default_instance_._instance,
+  &::coordinator_proto::_MergePlanRequest_default_instance_._instance,
+  &::coordinator_proto::_MergeSchedule_default_instance_._instance,
+  &::coordinator_proto::_AppendMergeRequest_default_instance_._instance,
+  &::coordinator_proto::_MergeJobId_default_instance_._instance,
+  &::coordinator_proto::_MergeJobStatus_default_instance_._instance,
+  &::coordinator_proto::_MergePolicy_default_instance_._instance,
   &::coordinator_proto::_RepStripeIds_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_coordinator_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\021coordinator.proto\022\021coordinator_proto\"\200"
+  "\n\021coordinator.proto\022\021coordinator_proto\"\250"
   "\002\n\tParameter\022\030\n\020partial_decoding\030\001 \001(\010\022\022"
   "\n\nencodetype\030\002 \001(\005\022\036\n\026s_stripe_placement"
   "type\030\003 \001(\005\022\036\n\026m_stripe_placementtype\030\004 \001"
   "(\005\022\023\n\013k_datablock\030\005 \001(\005\022\032\n\022l_localparity"
   "block\030\006 \001(\005\022\035\n\025g_m_globalparityblock\030\007 \001"
   "(\005\022\026\n\016b_datapergroup\030\010 \001(\005\022\035\n\025x_stripepe"
-  "rmergegroup\030\t \001(\005\"-\n\023RepIfSetParaSuccess"
+  "rmergegroup\030\t \001(\005\022\r\n\005reset\030\n \001(\010\022\027\n\017pack"
+  "_block_size\030\013 \001(\005\"-\n\023RepIfSetParaSuccess"
   "\022\026\n\016ifsetparameter\030\001 \001(\010\"$\n\024RequestToCoo"
   "rdinator\022\014\n\004name\030\001 \001(\t\"\'\n\024ReplyFromCoord"
   "inator\022\017\n\007message\030\001 \001(\t\"9\n\022RequestProxyI"
@@ -470,49 +919,119 @@ const char descriptor_table_protodef_coordinator_2eproto[] PROTOBUF_SECTION_VARI
   "pp\030\003 \001(\005\022\021\n\tstripe_id\030\004 \001(\005\";\n\014AskIfSucc"
   "ess\022\013\n\003key\030\001 \001(\t\022\013\n\003opp\030\002 \001(\005\022\021\n\tstripe_"
   "id\030\003 \001(\005\" \n\014RepIfSuccess\022\020\n\010ifcommit\030\001 \001"
-  "(\010\"C\n\016KeyAndClientIP\022\013\n\003key\030\001 \001(\t\022\020\n\010cli"
-  "entip\030\002 \001(\t\022\022\n\nclientport\030\003 \001(\005\"\?\n\017RepIf"
-  "GetSuccess\022\024\n\014ifgetsuccess\030\001 \001(\010\022\026\n\016valu"
-  "esizebytes\030\002 \001(\005\"\034\n\rKeyFromClient\022\013\n\003key"
-  "\030\001 \001(\t\"\'\n\022StripeIdFromClient\022\021\n\tstripe_i"
-  "d\030\001 \001(\005\"\037\n\013RepIfDeling\022\020\n\010ifdeling\030\001 \001(\010"
-  "\"0\n\026NumberOfStripesToMerge\022\026\n\016num_of_str"
-  "ipes\030\001 \001(\005\"C\n\013RepIfMerged\022\020\n\010ifmerged\030\001 "
-  "\001(\010\022\n\n\002lc\030\002 \001(\001\022\n\n\002gc\030\003 \001(\001\022\n\n\002dc\030\004 \001(\001\""
-  "\"\n\014RepStripeIds\022\022\n\nstripe_ids\030\001 \003(\0052\221\010\n\022"
-  "coordinatorService\022k\n\025sayHelloToCoordina"
-  "tor\022\'.coordinator_proto.RequestToCoordin"
-  "ator\032\'.coordinator_proto.ReplyFromCoordi"
-  "nator\"\000\022`\n\ncheckalive\022\'.coordinator_prot"
-  "o.RequestToCoordinator\032\'.coordinator_pro"
-  "to.ReplyFromCoordinator\"\000\022V\n\014setParamete"
-  "r\022\034.coordinator_proto.Parameter\032&.coordi"
-  "nator_proto.RepIfSetParaSuccess\"\000\022d\n\024upl"
-  "oadOriginKeyValue\022%.coordinator_proto.Re"
-  "questProxyIPPort\032#.coordinator_proto.Rep"
-  "lyProxyIPPort\"\000\022a\n\021reportCommitAbort\022!.c"
-  "oordinator_proto.CommitAbortKey\032\'.coordi"
-  "nator_proto.ReplyFromCoordinator\"\000\022V\n\020ch"
-  "eckCommitAbort\022\037.coordinator_proto.AskIf"
-  "Success\032\037.coordinator_proto.RepIfSuccess"
-  "\"\000\022S\n\010getValue\022!.coordinator_proto.KeyAn"
-  "dClientIP\032\".coordinator_proto.RepIfGetSu"
-  "ccess\"\000\022N\n\010delByKey\022 .coordinator_proto."
-  "KeyFromClient\032\036.coordinator_proto.RepIfD"
-  "eling\"\000\022V\n\013delByStripe\022%.coordinator_pro"
-  "to.StripeIdFromClient\032\036.coordinator_prot"
-  "o.RepIfDeling\"\000\022[\n\014requestMerge\022).coordi"
-  "nator_proto.NumberOfStripesToMerge\032\036.coo"
-  "rdinator_proto.RepIfMerged\"\000\022Y\n\013listStri"
-  "pes\022\'.coordinator_proto.RequestToCoordin"
-  "ator\032\037.coordinator_proto.RepStripeIds\"\000b"
-  "\006proto3"
+  "(\010\"c\n\016KeyAndClientIP\022\013\n\003key\030\001 \001(\t\022\020\n\010cli"
+  "entip\030\002 \001(\t\022\022\n\nclientport\030\003 \001(\005\022\016\n\006offse"
+  "t\030\004 \001(\005\022\016\n\006length\030\005 \001(\005\"\?\n\017RepIfGetSucce"
+  "ss\022\024\n\014ifgetsuccess\030\001 \001(\010\022\026\n\016valuesizebyt"
+  "es\030\002 \001(\005\"\034\n\rKeyFromClient\022\013\n\003key\030\001 \001(\t\"\'"
+  "\n\022StripeIdFromClient\022\021\n\tstripe_id\030\001 \001(\005\""
+  "\037\n\013RepIfDeling\022\020\n\010ifdeling\030\001 \001(\010\"M\n\023Requ"
+  "estProxyIPPorts\0226\n\007objects\030\001 \003(\0132%.coord"
+  "inator_proto.RequestProxyIPPort\"I\n\021Reply"
+  "ProxyIPPorts\0224\n\007proxies\030\001 \003(\0132#.coordina"
+  "tor_proto.ReplyProxyIPPort\"q\n\nNodeStatus"
+  "\022\017\n\007node_ip\030\001 \001(\t\022\021\n\tnode_port\030\002 \001(\005\022\022\n\n"
+  "free_bytes\030\003 \001(\003\022\021\n\tblock_num\030\004 \001(\005\022\030\n\020i"
+  "o_bytes_per_sec\030\005 \001(\003\"<\n\014NodeStatuses\022,\n"
+  "\005nodes\030\001 \003(\0132\035.coordinator_proto.NodeSta"
+  "tus\"B\n\017CommitAbortKeys\022/\n\004keys\030\001 \003(\0132!.c"
+  "oordinator_proto.CommitAbortKey\"B\n\021AskIf"
+  "SuccessBatch\022-\n\004asks\030\001 \003(\0132\037.coordinator"
+  "_proto.AskIfSuccess\"E\n\017KeysAndClientIP\022\014"
+  "\n\004keys\030\001 \003(\t\022\020\n\010clientip\030\002 \001(\t\022\022\n\nclient"
+  "port\030\003 \001(\005\"A\n\021RepIfGetSuccesses\022\024\n\014ifget"
+  "success\030\001 \001(\010\022\026\n\016valuesizebytes\030\002 \003(\005\"\036\n"
+  "\016KeysFromClient\022\014\n\004keys\030\001 \003(\t\"Z\n\026NumberO"
+  "fStripesToMerge\022\026\n\016num_of_stripes\030\001 \001(\005\022"
+  "\027\n\017max_concurrency\030\002 \001(\005\022\017\n\007dry_run\030\003 \001("
+  "\010\"\251\001\n\013RepIfMerged\022\020\n\010ifmerged\030\001 \001(\010\022\n\n\002l"
+  "c\030\002 \001(\001\022\n\n\002gc\030\003 \001(\001\022\n\n\002dc\030\004 \001(\001\022\017\n\007g_cro"
+  "ss\030\005 \001(\005\022\017\n\007g_intra\030\006 \001(\005\022\017\n\007l_cross\030\007 \001"
+  "(\005\022\017\n\007l_intra\030\010 \001(\005\022\017\n\007d_cross\030\t \001(\005\022\017\n\007"
+  "d_intra\030\n \001(\005\"B\n\017MergeJobRequest\022\026\n\016num_"
+  "of_stripes\030\001 \003(\005\022\027\n\017max_concurrency\030\002 \001("
+  "\005\"f\n\020MergePlanRequest\022\024\n\014merge_factor\030\001 "
+  "\001(\005\022\022\n\nmax_stages\030\002 \001(\005\022\017\n\007execute\030\003 \001(\010"
+  "\022\027\n\017max_concurrency\030\004 \001(\005\"v\n\rMergeSchedu"
+  "le\022\021\n\tifplanned\030\001 \001(\010\022\026\n\016num_of_stripes\030"
+  "\002 \003(\005\022\024\n\014cross_blocks\030\003 \001(\005\022\024\n\014intra_blo"
+  "cks\030\004 \001(\005\022\016\n\006job_id\030\005 \001(\005\"\?\n\022AppendMerge"
+  "Request\022\021\n\tstripe_id\030\001 \001(\005\022\026\n\016wide_strip"
+  "e_id\030\002 \001(\005\"\034\n\nMergeJobId\022\016\n\006job_id\030\001 \001(\005"
+  "\"\340\001\n\016MergeJobStatus\022\016\n\006job_id\030\001 \001(\005\022\r\n\005s"
+  "tate\030\002 \001(\005\022\023\n\013stages_done\030\003 \001(\005\022\024\n\014stage"
+  "s_total\030\004 \001(\005\022\026\n\016stripes_merged\030\005 \001(\005\022\025\n"
+  "\rstripes_total\030\006 \001(\005\022\017\n\007g_bytes\030\007 \001(\003\022\017\n"
+  "\007l_bytes\030\010 \001(\003\022\017\n\007d_bytes\030\t \001(\003\022\n\n\002lc\030\n "
+  "\001(\001\022\n\n\002gc\030\013 \001(\001\022\n\n\002dc\030\014 \001(\001\"\320\001\n\013MergePol"
+  "icy\022\016\n\006enable\030\001 \001(\010\022\026\n\016num_of_stripes\030\002 "
+  "\003(\005\022\035\n\025min_stripes_per_group\030\003 \001(\005\022\027\n\017ma"
+  "x_ops_per_sec\030\004 \001(\005\022\021\n\tbandwidth\030\005 \001(\003\022\031"
+  "\n\021check_interval_ms\030\006 \001(\005\022\027\n\017max_concurr"
+  "ency\030\007 \001(\005\022\032\n\022split_min_accesses\030\010 \001(\005\"\""
+  "\n\014RepStripeIds\022\022\n\nstripe_ids\030\001 \003(\0052\243\021\n\022c"
+  "oordinatorService\022k\n\025sayHelloToCoordinat"
+  "or\022\'.coordinator_proto.RequestToCoordina"
+  "tor\032\'.coordinator_proto.ReplyFromCoordin"
+  "ator\"\000\022`\n\ncheckalive\022\'.coordinator_proto"
+  ".RequestToCoordinator\032\'.coordinator_prot"
+  "o.ReplyFromCoordinator\"\000\022V\n\014setParameter"
+  "\022\034.coordinator_proto.Parameter\032&.coordin"
+  "ator_proto.RepIfSetParaSuccess\"\000\022d\n\024uplo"
+  "adOriginKeyValue\022%.coordinator_proto.Req"
+  "uestProxyIPPort\032#.coordinator_proto.Repl"
+  "yProxyIPPort\"\000\022a\n\021reportCommitAbort\022!.co"
+  "ordinator_proto.CommitAbortKey\032\'.coordin"
+  "ator_proto.ReplyFromCoordinator\"\000\022V\n\020che"
+  "ckCommitAbort\022\037.coordinator_proto.AskIfS"
+  "uccess\032\037.coordinator_proto.RepIfSuccess\""
+  "\000\022S\n\010getValue\022!.coordinator_proto.KeyAnd"
+  "ClientIP\032\".coordinator_proto.RepIfGetSuc"
+  "cess\"\000\022N\n\010delByKey\022 .coordinator_proto.K"
+  "eyFromClient\032\036.coordinator_proto.RepIfDe"
+  "ling\"\000\022V\n\013delByStripe\022%.coordinator_prot"
+  "o.StripeIdFromClient\032\036.coordinator_proto"
+  ".RepIfDeling\"\000\022g\n\025uploadOriginKeyValues\022"
+  "&.coordinator_proto.RequestProxyIPPorts\032"
+  "$.coordinator_proto.ReplyProxyIPPorts\"\000\022"
+  "c\n\022reportCommitAborts\022\".coordinator_prot"
+  "o.CommitAbortKeys\032\'.coordinator_proto.Re"
+  "plyFromCoordinator\"\000\022\\\n\021checkCommitAbort"
+  "s\022$.coordinator_proto.AskIfSuccessBatch\032"
+  "\037.coordinator_proto.RepIfSuccess\"\000\022W\n\tge"
+  "tValues\022\".coordinator_proto.KeysAndClien"
+  "tIP\032$.coordinator_proto.RepIfGetSuccesse"
+  "s\"\000\022P\n\tdelByKeys\022!.coordinator_proto.Key"
+  "sFromClient\032\036.coordinator_proto.RepIfDel"
+  "ing\"\000\022[\n\014requestMerge\022).coordinator_prot"
+  "o.NumberOfStripesToMerge\032\036.coordinator_p"
+  "roto.RepIfMerged\"\000\022U\n\nstartMerge\022\".coord"
+  "inator_proto.MergeJobRequest\032!.coordinat"
+  "or_proto.MergeJobStatus\"\000\022T\n\016getMergeSta"
+  "tus\022\035.coordinator_proto.MergeJobId\032!.coo"
+  "rdinator_proto.MergeJobStatus\"\000\022Q\n\013cance"
+  "lMerge\022\035.coordinator_proto.MergeJobId\032!."
+  "coordinator_proto.MergeJobStatus\"\000\022S\n\016se"
+  "tMergePolicy\022\036.coordinator_proto.MergePo"
+  "licy\032\037.coordinator_proto.RepIfSuccess\"\000\022"
+  "T\n\tplanMerge\022#.coordinator_proto.MergePl"
+  "anRequest\032 .coordinator_proto.MergeSched"
+  "ule\"\000\022V\n\013appendMerge\022%.coordinator_proto"
+  ".AppendMergeRequest\032\036.coordinator_proto."
+  "RepIfMerged\"\000\022V\n\013splitStripe\022%.coordinat"
+  "or_proto.StripeIdFromClient\032\036.coordinato"
+  "r_proto.RepIfMerged\"\000\022Y\n\013listStripes\022\'.c"
+  "oordinator_proto.RequestToCoordinator\032\037."
+  "coordinator_proto.RepStripeIds\"\000\022^\n\020repo"
+  "rtNodeStatus\022\037.coordinator_proto.NodeSta"
+  "tuses\032\'.coordinator_proto.ReplyFromCoord"
+  "inator\"\000b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_coordinator_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_coordinator_2eproto = {
-    false, false, 2167, descriptor_table_protodef_coordinator_2eproto,
+    false, false, 5016, descriptor_table_protodef_coordinator_2eproto,
     "coordinator.proto",
-    &descriptor_table_coordinator_2eproto_once, nullptr, 0, 17,
+    &descriptor_table_coordinator_2eproto_once, nullptr, 0, 33,
     schemas, file_default_instances, TableStruct_coordinator_2eproto::offsets,
     file_level_metadata_coordinator_2eproto, file_level_enum_descriptors_coordinator_2eproto,
     file_level_service_descriptors_coordinator_2eproto,
@@ -541,21 +1060,23 @@ Parameter::Parameter(const Parameter& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   Parameter* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.partial_decoding_){}
-    , decltype(_impl_.encodetype_){}
+      decltype(_impl_.encodetype_){}
     , decltype(_impl_.s_stripe_placementtype_){}
     , decltype(_impl_.m_stripe_placementtype_){}
     , decltype(_impl_.k_datablock_){}
+    , decltype(_impl_.partial_decoding_){}
+    , decltype(_impl_.reset_){}
     , decltype(_impl_.l_localparityblock_){}
     , decltype(_impl_.g_m_globalparityblock_){}
     , decltype(_impl_.b_datapergroup_){}
     , decltype(_impl_.x_stripepermergegroup_){}
+    , decltype(_impl_.pack_block_size_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.partial_decoding_, &from._impl_.partial_decoding_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.x_stripepermergegroup_) -
-    reinterpret_cast<char*>(&_impl_.partial_decoding_)) + sizeof(_impl_.x_stripepermergegroup_));
+  ::memcpy(&_impl_.encodetype_, &from._impl_.encodetype_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pack_block_size_) -
+    reinterpret_cast<char*>(&_impl_.encodetype_)) + sizeof(_impl_.pack_block_size_));
   // @@protoc_insertion_point(copy_constructor:coordinator_proto.Parameter)
 }
 
@@ -564,15 +1085,17 @@ inline void Parameter::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.partial_decoding_){false}
-    , decltype(_impl_.encodetype_){0}
+      decltype(_impl_.encodetype_){0}
     , decltype(_impl_.s_stripe_placementtype_){0}
     , decltype(_impl_.m_stripe_placementtype_){0}
     , decltype(_impl_.k_datablock_){0}
+    , decltype(_impl_.partial_decoding_){false}
+    , decltype(_impl_.reset_){false}
     , decltype(_impl_.l_localparityblock_){0}
     , decltype(_impl_.g_m_globalparityblock_){0}
     , decltype(_impl_.b_datapergroup_){0}
     , decltype(_impl_.x_stripepermergegroup_){0}
+    , decltype(_impl_.pack_block_size_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -600,9 +1123,9 @@ void Parameter::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.partial_decoding_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.x_stripepermergegroup_) -
-      reinterpret_cast<char*>(&_impl_.partial_decoding_)) + sizeof(_impl_.x_stripepermergegroup_));
+  ::memset(&_impl_.encodetype_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.pack_block_size_) -
+      reinterpret_cast<char*>(&_impl_.encodetype_)) + sizeof(_impl_.pack_block_size_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -684,6 +1207,22 @@ const char* Parameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
         } else
           goto handle_unusual;
         continue;
+      // bool reset = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.reset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 pack_block_size = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.pack_block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -767,6 +1306,18 @@ uint8_t* Parameter::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_x_stripepermergegroup(), target);
   }
 
+  // bool reset = 10;
+  if (this->_internal_reset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_reset(), target);
+  }
+
+  // int32 pack_block_size = 11;
+  if (this->_internal_pack_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_pack_block_size(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -783,11 +1334,6 @@ size_t Parameter::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bool partial_decoding = 1;
-  if (this->_internal_partial_decoding() != 0) {
-    total_size += 1 + 1;
-  }
-
   // int32 encodetype = 2;
   if (this->_internal_encodetype() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_encodetype());
@@ -808,6 +1354,16 @@ size_t Parameter::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_k_datablock());
   }
 
+  // bool partial_decoding = 1;
+  if (this->_internal_partial_decoding() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool reset = 10;
+  if (this->_internal_reset() != 0) {
+    total_size += 1 + 1;
+  }
+
   // int32 l_localparityblock = 6;
   if (this->_internal_l_localparityblock() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_l_localparityblock());
@@ -828,6 +1384,11 @@ size_t Parameter::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x_stripepermergegroup());
   }
 
+  // int32 pack_block_size = 11;
+  if (this->_internal_pack_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_pack_block_size());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -846,9 +1407,6 @@ void Parameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROT
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_partial_decoding() != 0) {
-    _this->_internal_set_partial_decoding(from._internal_partial_decoding());
-  }
   if (from._internal_encodetype() != 0) {
     _this->_internal_set_encodetype(from._internal_encodetype());
   }
@@ -861,6 +1419,12 @@ void Parameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROT
   if (from._internal_k_datablock() != 0) {
     _this->_internal_set_k_datablock(from._internal_k_datablock());
   }
+  if (from._internal_partial_decoding() != 0) {
+    _this->_internal_set_partial_decoding(from._internal_partial_decoding());
+  }
+  if (from._internal_reset() != 0) {
+    _this->_internal_set_reset(from._internal_reset());
+  }
   if (from._internal_l_localparityblock() != 0) {
     _this->_internal_set_l_localparityblock(from._internal_l_localparityblock());
   }
@@ -873,6 +1437,9 @@ void Parameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROT
   if (from._internal_x_stripepermergegroup() != 0) {
     _this->_internal_set_x_stripepermergegroup(from._internal_x_stripepermergegroup());
   }
+  if (from._internal_pack_block_size() != 0) {
+    _this->_internal_set_pack_block_size(from._internal_pack_block_size());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -891,11 +1458,11 @@ void Parameter::InternalSwap(Parameter* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Parameter, _impl_.x_stripepermergegroup_)
-      + sizeof(Parameter::_impl_.x_stripepermergegroup_)
-      - PROTOBUF_FIELD_OFFSET(Parameter, _impl_.partial_decoding_)>(
-          reinterpret_cast<char*>(&_impl_.partial_decoding_),
-          reinterpret_cast<char*>(&other->_impl_.partial_decoding_));
+      PROTOBUF_FIELD_OFFSET(Parameter, _impl_.pack_block_size_)
+      + sizeof(Parameter::_impl_.pack_block_size_)
+      - PROTOBUF_FIELD_OFFSET(Parameter, _impl_.encodetype_)>(
+          reinterpret_cast<char*>(&_impl_.encodetype_),
+          reinterpret_cast<char*>(&other->_impl_.encodetype_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Parameter::GetMetadata() const {
@@ -2695,6 +3262,8 @@ KeyAndClientIP::KeyAndClientIP(const KeyAndClientIP& from)
       decltype(_impl_.key_){}
     , decltype(_impl_.clientip_){}
     , decltype(_impl_.clientport_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.length_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -2714,7 +3283,9 @@ KeyAndClientIP::KeyAndClientIP(const KeyAndClientIP& from)
     _this->_impl_.clientip_.Set(from._internal_clientip(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.clientport_ = from._impl_.clientport_;
+  ::memcpy(&_impl_.clientport_, &from._impl_.clientport_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.length_) -
+    reinterpret_cast<char*>(&_impl_.clientport_)) + sizeof(_impl_.length_));
   // @@protoc_insertion_point(copy_constructor:coordinator_proto.KeyAndClientIP)
 }
 
@@ -2726,6 +3297,8 @@ inline void KeyAndClientIP::SharedCtor(
       decltype(_impl_.key_){}
     , decltype(_impl_.clientip_){}
     , decltype(_impl_.clientport_){0}
+    , decltype(_impl_.offset_){0}
+    , decltype(_impl_.length_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.key_.InitDefault();
@@ -2765,7 +3338,9 @@ void KeyAndClientIP::Clear() {
 
   _impl_.key_.ClearToEmpty();
   _impl_.clientip_.ClearToEmpty();
-  _impl_.clientport_ = 0;
+  ::memset(&_impl_.clientport_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.length_) -
+      reinterpret_cast<char*>(&_impl_.clientport_)) + sizeof(_impl_.length_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2803,6 +3378,22 @@ const char* KeyAndClientIP::_InternalParse(const char* ptr, ::_pbi::ParseContext
         } else
           goto handle_unusual;
         continue;
+      // int32 offset = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 length = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2858,6 +3449,18 @@ uint8_t* KeyAndClientIP::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_clientport(), target);
   }
 
+  // int32 offset = 4;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_offset(), target);
+  }
+
+  // int32 length = 5;
+  if (this->_internal_length() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_length(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2893,6 +3496,16 @@ size_t KeyAndClientIP::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_clientport());
   }
 
+  // int32 offset = 4;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_offset());
+  }
+
+  // int32 length = 5;
+  if (this->_internal_length() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_length());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -2920,6 +3533,12 @@ void KeyAndClientIP::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   if (from._internal_clientport() != 0) {
     _this->_internal_set_clientport(from._internal_clientport());
   }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_length() != 0) {
+    _this->_internal_set_length(from._internal_length());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -2947,7 +3566,12 @@ void KeyAndClientIP::InternalSwap(KeyAndClientIP* other) {
       &_impl_.clientip_, lhs_arena,
       &other->_impl_.clientip_, rhs_arena
   );
-  swap(_impl_.clientport_, other->_impl_.clientport_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(KeyAndClientIP, _impl_.length_)
+      + sizeof(KeyAndClientIP::_impl_.length_)
+      - PROTOBUF_FIELD_OFFSET(KeyAndClientIP, _impl_.clientport_)>(
+          reinterpret_cast<char*>(&_impl_.clientport_),
+          reinterpret_cast<char*>(&other->_impl_.clientport_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata KeyAndClientIP::GetMetadata() const {
@@ -3728,40 +4352,3822 @@ void RepIfDeling::InternalSwap(RepIfDeling* other) {
 
 // ===================================================================
 
-class NumberOfStripesToMerge::_Internal {
+class RequestProxyIPPorts::_Internal {
  public:
 };
 
-NumberOfStripesToMerge::NumberOfStripesToMerge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+RequestProxyIPPorts::RequestProxyIPPorts(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:coordinator_proto.NumberOfStripesToMerge)
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.RequestProxyIPPorts)
 }
-NumberOfStripesToMerge::NumberOfStripesToMerge(const NumberOfStripesToMerge& from)
+RequestProxyIPPorts::RequestProxyIPPorts(const RequestProxyIPPorts& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  NumberOfStripesToMerge* const _this = this; (void)_this;
+  RequestProxyIPPorts* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.num_of_stripes_){}
+      decltype(_impl_.objects_){from._impl_.objects_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.num_of_stripes_ = from._impl_.num_of_stripes_;
-  // @@protoc_insertion_point(copy_constructor:coordinator_proto.NumberOfStripesToMerge)
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.RequestProxyIPPorts)
 }
 
-inline void NumberOfStripesToMerge::SharedCtor(
+inline void RequestProxyIPPorts::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.objects_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RequestProxyIPPorts::~RequestProxyIPPorts() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.RequestProxyIPPorts)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestProxyIPPorts::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.objects_.~RepeatedPtrField();
+}
+
+void RequestProxyIPPorts::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestProxyIPPorts::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.RequestProxyIPPorts)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.objects_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestProxyIPPorts::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .coordinator_proto.RequestProxyIPPort objects = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_objects(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestProxyIPPorts::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.RequestProxyIPPorts)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.RequestProxyIPPort objects = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_objects_size()); i < n; i++) {
+    const auto& repfield = this->_internal_objects(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.RequestProxyIPPorts)
+  return target;
+}
+
+size_t RequestProxyIPPorts::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.RequestProxyIPPorts)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.RequestProxyIPPort objects = 1;
+  total_size += 1UL * this->_internal_objects_size();
+  for (const auto& msg : this->_impl_.objects_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestProxyIPPorts::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestProxyIPPorts::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestProxyIPPorts::GetClassData() const { return &_class_data_; }
+
+
+void RequestProxyIPPorts::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestProxyIPPorts*>(&to_msg);
+  auto& from = static_cast<const RequestProxyIPPorts&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.RequestProxyIPPorts)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.objects_.MergeFrom(from._impl_.objects_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestProxyIPPorts::CopyFrom(const RequestProxyIPPorts& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.RequestProxyIPPorts)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestProxyIPPorts::IsInitialized() const {
+  return true;
+}
+
+void RequestProxyIPPorts::InternalSwap(RequestProxyIPPorts* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.objects_.InternalSwap(&other->_impl_.objects_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestProxyIPPorts::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[14]);
+}
+
+// ===================================================================
+
+class ReplyProxyIPPorts::_Internal {
+ public:
+};
+
+ReplyProxyIPPorts::ReplyProxyIPPorts(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.ReplyProxyIPPorts)
+}
+ReplyProxyIPPorts::ReplyProxyIPPorts(const ReplyProxyIPPorts& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplyProxyIPPorts* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.proxies_){from._impl_.proxies_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.ReplyProxyIPPorts)
+}
+
+inline void ReplyProxyIPPorts::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.proxies_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReplyProxyIPPorts::~ReplyProxyIPPorts() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.ReplyProxyIPPorts)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplyProxyIPPorts::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.proxies_.~RepeatedPtrField();
+}
+
+void ReplyProxyIPPorts::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplyProxyIPPorts::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.ReplyProxyIPPorts)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.proxies_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplyProxyIPPorts::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .coordinator_proto.ReplyProxyIPPort proxies = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_proxies(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplyProxyIPPorts::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.ReplyProxyIPPorts)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.ReplyProxyIPPort proxies = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_proxies_size()); i < n; i++) {
+    const auto& repfield = this->_internal_proxies(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.ReplyProxyIPPorts)
+  return target;
+}
+
+size_t ReplyProxyIPPorts::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.ReplyProxyIPPorts)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.ReplyProxyIPPort proxies = 1;
+  total_size += 1UL * this->_internal_proxies_size();
+  for (const auto& msg : this->_impl_.proxies_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplyProxyIPPorts::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplyProxyIPPorts::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplyProxyIPPorts::GetClassData() const { return &_class_data_; }
+
+
+void ReplyProxyIPPorts::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplyProxyIPPorts*>(&to_msg);
+  auto& from = static_cast<const ReplyProxyIPPorts&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.ReplyProxyIPPorts)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.proxies_.MergeFrom(from._impl_.proxies_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplyProxyIPPorts::CopyFrom(const ReplyProxyIPPorts& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.ReplyProxyIPPorts)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplyProxyIPPorts::IsInitialized() const {
+  return true;
+}
+
+void ReplyProxyIPPorts::InternalSwap(ReplyProxyIPPorts* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.proxies_.InternalSwap(&other->_impl_.proxies_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplyProxyIPPorts::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[15]);
+}
+
+// ===================================================================
+
+class NodeStatus::_Internal {
+ public:
+};
+
+NodeStatus::NodeStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.NodeStatus)
+}
+NodeStatus::NodeStatus(const NodeStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_ip_){}
+    , decltype(_impl_.free_bytes_){}
+    , decltype(_impl_.node_port_){}
+    , decltype(_impl_.block_num_){}
+    , decltype(_impl_.io_bytes_per_sec_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node_ip().empty()) {
+    _this->_impl_.node_ip_.Set(from._internal_node_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.free_bytes_, &from._impl_.free_bytes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.io_bytes_per_sec_) -
+    reinterpret_cast<char*>(&_impl_.free_bytes_)) + sizeof(_impl_.io_bytes_per_sec_));
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.NodeStatus)
+}
+
+inline void NodeStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_ip_){}
+    , decltype(_impl_.free_bytes_){int64_t{0}}
+    , decltype(_impl_.node_port_){0}
+    , decltype(_impl_.block_num_){0}
+    , decltype(_impl_.io_bytes_per_sec_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NodeStatus::~NodeStatus() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.NodeStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NodeStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.node_ip_.Destroy();
+}
+
+void NodeStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NodeStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.NodeStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.node_ip_.ClearToEmpty();
+  ::memset(&_impl_.free_bytes_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.io_bytes_per_sec_) -
+      reinterpret_cast<char*>(&_impl_.free_bytes_)) + sizeof(_impl_.io_bytes_per_sec_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string node_ip = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "coordinator_proto.NodeStatus.node_ip"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 node_port = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.node_port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 free_bytes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.free_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 block_num = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.block_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 io_bytes_per_sec = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.io_bytes_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.NodeStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string node_ip = 1;
+  if (!this->_internal_node_ip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node_ip().data(), static_cast<int>(this->_internal_node_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "coordinator_proto.NodeStatus.node_ip");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_node_ip(), target);
+  }
+
+  // int32 node_port = 2;
+  if (this->_internal_node_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_node_port(), target);
+  }
+
+  // int64 free_bytes = 3;
+  if (this->_internal_free_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_free_bytes(), target);
+  }
+
+  // int32 block_num = 4;
+  if (this->_internal_block_num() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_block_num(), target);
+  }
+
+  // int64 io_bytes_per_sec = 5;
+  if (this->_internal_io_bytes_per_sec() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_io_bytes_per_sec(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.NodeStatus)
+  return target;
+}
+
+size_t NodeStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.NodeStatus)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string node_ip = 1;
+  if (!this->_internal_node_ip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node_ip());
+  }
+
+  // int64 free_bytes = 3;
+  if (this->_internal_free_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_free_bytes());
+  }
+
+  // int32 node_port = 2;
+  if (this->_internal_node_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_node_port());
+  }
+
+  // int32 block_num = 4;
+  if (this->_internal_block_num() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_block_num());
+  }
+
+  // int64 io_bytes_per_sec = 5;
+  if (this->_internal_io_bytes_per_sec() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_io_bytes_per_sec());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeStatus::GetClassData() const { return &_class_data_; }
+
+
+void NodeStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeStatus*>(&to_msg);
+  auto& from = static_cast<const NodeStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.NodeStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_node_ip().empty()) {
+    _this->_internal_set_node_ip(from._internal_node_ip());
+  }
+  if (from._internal_free_bytes() != 0) {
+    _this->_internal_set_free_bytes(from._internal_free_bytes());
+  }
+  if (from._internal_node_port() != 0) {
+    _this->_internal_set_node_port(from._internal_node_port());
+  }
+  if (from._internal_block_num() != 0) {
+    _this->_internal_set_block_num(from._internal_block_num());
+  }
+  if (from._internal_io_bytes_per_sec() != 0) {
+    _this->_internal_set_io_bytes_per_sec(from._internal_io_bytes_per_sec());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NodeStatus::CopyFrom(const NodeStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.NodeStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeStatus::IsInitialized() const {
+  return true;
+}
+
+void NodeStatus::InternalSwap(NodeStatus* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_ip_, lhs_arena,
+      &other->_impl_.node_ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.io_bytes_per_sec_)
+      + sizeof(NodeStatus::_impl_.io_bytes_per_sec_)
+      - PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.free_bytes_)>(
+          reinterpret_cast<char*>(&_impl_.free_bytes_),
+          reinterpret_cast<char*>(&other->_impl_.free_bytes_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NodeStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[16]);
+}
+
+// ===================================================================
+
+class NodeStatuses::_Internal {
+ public:
+};
+
+NodeStatuses::NodeStatuses(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.NodeStatuses)
+}
+NodeStatuses::NodeStatuses(const NodeStatuses& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeStatuses* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){from._impl_.nodes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.NodeStatuses)
+}
+
+inline void NodeStatuses::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NodeStatuses::~NodeStatuses() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.NodeStatuses)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NodeStatuses::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodes_.~RepeatedPtrField();
+}
+
+void NodeStatuses::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NodeStatuses::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.NodeStatuses)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeStatuses::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .coordinator_proto.NodeStatus nodes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_nodes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeStatuses::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.NodeStatuses)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.NodeStatus nodes = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_nodes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_nodes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.NodeStatuses)
+  return target;
+}
+
+size_t NodeStatuses::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.NodeStatuses)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.NodeStatus nodes = 1;
+  total_size += 1UL * this->_internal_nodes_size();
+  for (const auto& msg : this->_impl_.nodes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeStatuses::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeStatuses::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeStatuses::GetClassData() const { return &_class_data_; }
+
+
+void NodeStatuses::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeStatuses*>(&to_msg);
+  auto& from = static_cast<const NodeStatuses&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.NodeStatuses)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nodes_.MergeFrom(from._impl_.nodes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NodeStatuses::CopyFrom(const NodeStatuses& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.NodeStatuses)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeStatuses::IsInitialized() const {
+  return true;
+}
+
+void NodeStatuses::InternalSwap(NodeStatuses* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.nodes_.InternalSwap(&other->_impl_.nodes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NodeStatuses::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[17]);
+}
+
+// ===================================================================
+
+class CommitAbortKeys::_Internal {
+ public:
+};
+
+CommitAbortKeys::CommitAbortKeys(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.CommitAbortKeys)
+}
+CommitAbortKeys::CommitAbortKeys(const CommitAbortKeys& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommitAbortKeys* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.CommitAbortKeys)
+}
+
+inline void CommitAbortKeys::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CommitAbortKeys::~CommitAbortKeys() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.CommitAbortKeys)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommitAbortKeys::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+}
+
+void CommitAbortKeys::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommitAbortKeys::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.CommitAbortKeys)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommitAbortKeys::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .coordinator_proto.CommitAbortKey keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_keys(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommitAbortKeys::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.CommitAbortKeys)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.CommitAbortKey keys = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_keys_size()); i < n; i++) {
+    const auto& repfield = this->_internal_keys(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.CommitAbortKeys)
+  return target;
+}
+
+size_t CommitAbortKeys::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.CommitAbortKeys)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.CommitAbortKey keys = 1;
+  total_size += 1UL * this->_internal_keys_size();
+  for (const auto& msg : this->_impl_.keys_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitAbortKeys::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommitAbortKeys::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitAbortKeys::GetClassData() const { return &_class_data_; }
+
+
+void CommitAbortKeys::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitAbortKeys*>(&to_msg);
+  auto& from = static_cast<const CommitAbortKeys&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.CommitAbortKeys)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommitAbortKeys::CopyFrom(const CommitAbortKeys& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.CommitAbortKeys)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommitAbortKeys::IsInitialized() const {
+  return true;
+}
+
+void CommitAbortKeys::InternalSwap(CommitAbortKeys* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitAbortKeys::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[18]);
+}
+
+// ===================================================================
+
+class AskIfSuccessBatch::_Internal {
+ public:
+};
+
+AskIfSuccessBatch::AskIfSuccessBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.AskIfSuccessBatch)
+}
+AskIfSuccessBatch::AskIfSuccessBatch(const AskIfSuccessBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AskIfSuccessBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.asks_){from._impl_.asks_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.AskIfSuccessBatch)
+}
+
+inline void AskIfSuccessBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.asks_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AskIfSuccessBatch::~AskIfSuccessBatch() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.AskIfSuccessBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AskIfSuccessBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.asks_.~RepeatedPtrField();
+}
+
+void AskIfSuccessBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AskIfSuccessBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.AskIfSuccessBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.asks_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AskIfSuccessBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .coordinator_proto.AskIfSuccess asks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_asks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AskIfSuccessBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.AskIfSuccessBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.AskIfSuccess asks = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_asks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_asks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.AskIfSuccessBatch)
+  return target;
+}
+
+size_t AskIfSuccessBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.AskIfSuccessBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .coordinator_proto.AskIfSuccess asks = 1;
+  total_size += 1UL * this->_internal_asks_size();
+  for (const auto& msg : this->_impl_.asks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AskIfSuccessBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AskIfSuccessBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AskIfSuccessBatch::GetClassData() const { return &_class_data_; }
+
+
+void AskIfSuccessBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AskIfSuccessBatch*>(&to_msg);
+  auto& from = static_cast<const AskIfSuccessBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.AskIfSuccessBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.asks_.MergeFrom(from._impl_.asks_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AskIfSuccessBatch::CopyFrom(const AskIfSuccessBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.AskIfSuccessBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AskIfSuccessBatch::IsInitialized() const {
+  return true;
+}
+
+void AskIfSuccessBatch::InternalSwap(AskIfSuccessBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.asks_.InternalSwap(&other->_impl_.asks_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AskIfSuccessBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[19]);
+}
+
+// ===================================================================
+
+class KeysAndClientIP::_Internal {
+ public:
+};
+
+KeysAndClientIP::KeysAndClientIP(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.KeysAndClientIP)
+}
+KeysAndClientIP::KeysAndClientIP(const KeysAndClientIP& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeysAndClientIP* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.clientip_){}
+    , decltype(_impl_.clientport_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.clientip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientip().empty()) {
+    _this->_impl_.clientip_.Set(from._internal_clientip(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.clientport_ = from._impl_.clientport_;
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.KeysAndClientIP)
+}
+
+inline void KeysAndClientIP::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , decltype(_impl_.clientip_){}
+    , decltype(_impl_.clientport_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.clientip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+KeysAndClientIP::~KeysAndClientIP() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.KeysAndClientIP)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void KeysAndClientIP::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.clientip_.Destroy();
+}
+
+void KeysAndClientIP::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void KeysAndClientIP::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.KeysAndClientIP)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _impl_.clientip_.ClearToEmpty();
+  _impl_.clientport_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeysAndClientIP::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "coordinator_proto.KeysAndClientIP.keys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string clientip = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_clientip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "coordinator_proto.KeysAndClientIP.clientip"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 clientport = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.clientport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KeysAndClientIP::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.KeysAndClientIP)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "coordinator_proto.KeysAndClientIP.keys");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // string clientip = 2;
+  if (!this->_internal_clientip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_clientip().data(), static_cast<int>(this->_internal_clientip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "coordinator_proto.KeysAndClientIP.clientip");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_clientip(), target);
+  }
+
+  // int32 clientport = 3;
+  if (this->_internal_clientport() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_clientport(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.KeysAndClientIP)
+  return target;
+}
+
+size_t KeysAndClientIP::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.KeysAndClientIP)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
+  }
+
+  // string clientip = 2;
+  if (!this->_internal_clientip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_clientip());
+  }
+
+  // int32 clientport = 3;
+  if (this->_internal_clientport() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_clientport());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeysAndClientIP::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeysAndClientIP::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeysAndClientIP::GetClassData() const { return &_class_data_; }
+
+
+void KeysAndClientIP::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeysAndClientIP*>(&to_msg);
+  auto& from = static_cast<const KeysAndClientIP&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.KeysAndClientIP)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  if (!from._internal_clientip().empty()) {
+    _this->_internal_set_clientip(from._internal_clientip());
+  }
+  if (from._internal_clientport() != 0) {
+    _this->_internal_set_clientport(from._internal_clientport());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KeysAndClientIP::CopyFrom(const KeysAndClientIP& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.KeysAndClientIP)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KeysAndClientIP::IsInitialized() const {
+  return true;
+}
+
+void KeysAndClientIP::InternalSwap(KeysAndClientIP* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientip_, lhs_arena,
+      &other->_impl_.clientip_, rhs_arena
+  );
+  swap(_impl_.clientport_, other->_impl_.clientport_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata KeysAndClientIP::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[20]);
+}
+
+// ===================================================================
+
+class RepIfGetSuccesses::_Internal {
+ public:
+};
+
+RepIfGetSuccesses::RepIfGetSuccesses(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.RepIfGetSuccesses)
+}
+RepIfGetSuccesses::RepIfGetSuccesses(const RepIfGetSuccesses& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RepIfGetSuccesses* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.valuesizebytes_){from._impl_.valuesizebytes_}
+    , /*decltype(_impl_._valuesizebytes_cached_byte_size_)*/{0}
+    , decltype(_impl_.ifgetsuccess_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.ifgetsuccess_ = from._impl_.ifgetsuccess_;
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.RepIfGetSuccesses)
+}
+
+inline void RepIfGetSuccesses::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.valuesizebytes_){arena}
+    , /*decltype(_impl_._valuesizebytes_cached_byte_size_)*/{0}
+    , decltype(_impl_.ifgetsuccess_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RepIfGetSuccesses::~RepIfGetSuccesses() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.RepIfGetSuccesses)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RepIfGetSuccesses::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.valuesizebytes_.~RepeatedField();
+}
+
+void RepIfGetSuccesses::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RepIfGetSuccesses::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.RepIfGetSuccesses)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.valuesizebytes_.Clear();
+  _impl_.ifgetsuccess_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RepIfGetSuccesses::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool ifgetsuccess = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ifgetsuccess_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 valuesizebytes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_valuesizebytes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_valuesizebytes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RepIfGetSuccesses::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.RepIfGetSuccesses)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool ifgetsuccess = 1;
+  if (this->_internal_ifgetsuccess() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_ifgetsuccess(), target);
+  }
+
+  // repeated int32 valuesizebytes = 2;
+  {
+    int byte_size = _impl_._valuesizebytes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_valuesizebytes(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.RepIfGetSuccesses)
+  return target;
+}
+
+size_t RepIfGetSuccesses::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.RepIfGetSuccesses)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 valuesizebytes = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.valuesizebytes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._valuesizebytes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // bool ifgetsuccess = 1;
+  if (this->_internal_ifgetsuccess() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RepIfGetSuccesses::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RepIfGetSuccesses::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RepIfGetSuccesses::GetClassData() const { return &_class_data_; }
+
+
+void RepIfGetSuccesses::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RepIfGetSuccesses*>(&to_msg);
+  auto& from = static_cast<const RepIfGetSuccesses&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.RepIfGetSuccesses)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.valuesizebytes_.MergeFrom(from._impl_.valuesizebytes_);
+  if (from._internal_ifgetsuccess() != 0) {
+    _this->_internal_set_ifgetsuccess(from._internal_ifgetsuccess());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RepIfGetSuccesses::CopyFrom(const RepIfGetSuccesses& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.RepIfGetSuccesses)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RepIfGetSuccesses::IsInitialized() const {
+  return true;
+}
+
+void RepIfGetSuccesses::InternalSwap(RepIfGetSuccesses* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.valuesizebytes_.InternalSwap(&other->_impl_.valuesizebytes_);
+  swap(_impl_.ifgetsuccess_, other->_impl_.ifgetsuccess_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RepIfGetSuccesses::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[21]);
+}
+
+// ===================================================================
+
+class KeysFromClient::_Internal {
+ public:
+};
+
+KeysFromClient::KeysFromClient(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.KeysFromClient)
+}
+KeysFromClient::KeysFromClient(const KeysFromClient& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeysFromClient* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.KeysFromClient)
+}
+
+inline void KeysFromClient::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+KeysFromClient::~KeysFromClient() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.KeysFromClient)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void KeysFromClient::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+}
+
+void KeysFromClient::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void KeysFromClient::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.KeysFromClient)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeysFromClient::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "coordinator_proto.KeysFromClient.keys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KeysFromClient::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.KeysFromClient)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "coordinator_proto.KeysFromClient.keys");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.KeysFromClient)
+  return target;
+}
+
+size_t KeysFromClient::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.KeysFromClient)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeysFromClient::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeysFromClient::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeysFromClient::GetClassData() const { return &_class_data_; }
+
+
+void KeysFromClient::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeysFromClient*>(&to_msg);
+  auto& from = static_cast<const KeysFromClient&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.KeysFromClient)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KeysFromClient::CopyFrom(const KeysFromClient& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.KeysFromClient)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KeysFromClient::IsInitialized() const {
+  return true;
+}
+
+void KeysFromClient::InternalSwap(KeysFromClient* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata KeysFromClient::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[22]);
+}
+
+// ===================================================================
+
+class NumberOfStripesToMerge::_Internal {
+ public:
+};
+
+NumberOfStripesToMerge::NumberOfStripesToMerge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.NumberOfStripesToMerge)
+}
+NumberOfStripesToMerge::NumberOfStripesToMerge(const NumberOfStripesToMerge& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NumberOfStripesToMerge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.num_of_stripes_){}
+    , decltype(_impl_.max_concurrency_){}
+    , decltype(_impl_.dry_run_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_of_stripes_, &from._impl_.num_of_stripes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dry_run_) -
+    reinterpret_cast<char*>(&_impl_.num_of_stripes_)) + sizeof(_impl_.dry_run_));
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.NumberOfStripesToMerge)
+}
+
+inline void NumberOfStripesToMerge::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.num_of_stripes_){0}
+    , decltype(_impl_.max_concurrency_){0}
+    , decltype(_impl_.dry_run_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NumberOfStripesToMerge::~NumberOfStripesToMerge() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.NumberOfStripesToMerge)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NumberOfStripesToMerge::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void NumberOfStripesToMerge::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NumberOfStripesToMerge::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.NumberOfStripesToMerge)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.num_of_stripes_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dry_run_) -
+      reinterpret_cast<char*>(&_impl_.num_of_stripes_)) + sizeof(_impl_.dry_run_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NumberOfStripesToMerge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 num_of_stripes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.num_of_stripes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_concurrency = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_concurrency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool dry_run = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.dry_run_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NumberOfStripesToMerge::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.NumberOfStripesToMerge)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 num_of_stripes = 1;
+  if (this->_internal_num_of_stripes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_num_of_stripes(), target);
+  }
+
+  // int32 max_concurrency = 2;
+  if (this->_internal_max_concurrency() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_concurrency(), target);
+  }
+
+  // bool dry_run = 3;
+  if (this->_internal_dry_run() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_dry_run(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.NumberOfStripesToMerge)
+  return target;
+}
+
+size_t NumberOfStripesToMerge::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.NumberOfStripesToMerge)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 num_of_stripes = 1;
+  if (this->_internal_num_of_stripes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_of_stripes());
+  }
+
+  // int32 max_concurrency = 2;
+  if (this->_internal_max_concurrency() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_concurrency());
+  }
+
+  // bool dry_run = 3;
+  if (this->_internal_dry_run() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NumberOfStripesToMerge::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NumberOfStripesToMerge::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NumberOfStripesToMerge::GetClassData() const { return &_class_data_; }
+
+
+void NumberOfStripesToMerge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NumberOfStripesToMerge*>(&to_msg);
+  auto& from = static_cast<const NumberOfStripesToMerge&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.NumberOfStripesToMerge)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_num_of_stripes() != 0) {
+    _this->_internal_set_num_of_stripes(from._internal_num_of_stripes());
+  }
+  if (from._internal_max_concurrency() != 0) {
+    _this->_internal_set_max_concurrency(from._internal_max_concurrency());
+  }
+  if (from._internal_dry_run() != 0) {
+    _this->_internal_set_dry_run(from._internal_dry_run());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NumberOfStripesToMerge::CopyFrom(const NumberOfStripesToMerge& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.NumberOfStripesToMerge)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NumberOfStripesToMerge::IsInitialized() const {
+  return true;
+}
+
+void NumberOfStripesToMerge::InternalSwap(NumberOfStripesToMerge* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NumberOfStripesToMerge, _impl_.dry_run_)
+      + sizeof(NumberOfStripesToMerge::_impl_.dry_run_)
+      - PROTOBUF_FIELD_OFFSET(NumberOfStripesToMerge, _impl_.num_of_stripes_)>(
+          reinterpret_cast<char*>(&_impl_.num_of_stripes_),
+          reinterpret_cast<char*>(&other->_impl_.num_of_stripes_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NumberOfStripesToMerge::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[23]);
+}
+
+// ===================================================================
+
+class RepIfMerged::_Internal {
+ public:
+};
+
+RepIfMerged::RepIfMerged(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.RepIfMerged)
+}
+RepIfMerged::RepIfMerged(const RepIfMerged& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RepIfMerged* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lc_){}
+    , decltype(_impl_.gc_){}
+    , decltype(_impl_.ifmerged_){}
+    , decltype(_impl_.g_cross_){}
+    , decltype(_impl_.dc_){}
+    , decltype(_impl_.g_intra_){}
+    , decltype(_impl_.l_cross_){}
+    , decltype(_impl_.l_intra_){}
+    , decltype(_impl_.d_cross_){}
+    , decltype(_impl_.d_intra_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lc_, &from._impl_.lc_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.d_intra_) -
+    reinterpret_cast<char*>(&_impl_.lc_)) + sizeof(_impl_.d_intra_));
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.RepIfMerged)
+}
+
+inline void RepIfMerged::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lc_){0}
+    , decltype(_impl_.gc_){0}
+    , decltype(_impl_.ifmerged_){false}
+    , decltype(_impl_.g_cross_){0}
+    , decltype(_impl_.dc_){0}
+    , decltype(_impl_.g_intra_){0}
+    , decltype(_impl_.l_cross_){0}
+    , decltype(_impl_.l_intra_){0}
+    , decltype(_impl_.d_cross_){0}
+    , decltype(_impl_.d_intra_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RepIfMerged::~RepIfMerged() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.RepIfMerged)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RepIfMerged::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RepIfMerged::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RepIfMerged::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.RepIfMerged)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.lc_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.d_intra_) -
+      reinterpret_cast<char*>(&_impl_.lc_)) + sizeof(_impl_.d_intra_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RepIfMerged::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool ifmerged = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ifmerged_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double lc = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.lc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double gc = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.gc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double dc = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.dc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 g_cross = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.g_cross_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 g_intra = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.g_intra_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 l_cross = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.l_cross_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 l_intra = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.l_intra_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 d_cross = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.d_cross_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 d_intra = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.d_intra_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RepIfMerged::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.RepIfMerged)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool ifmerged = 1;
+  if (this->_internal_ifmerged() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_ifmerged(), target);
+  }
+
+  // double lc = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lc = this->_internal_lc();
+  uint64_t raw_lc;
+  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
+  if (raw_lc != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_lc(), target);
+  }
+
+  // double gc = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gc = this->_internal_gc();
+  uint64_t raw_gc;
+  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
+  if (raw_gc != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_gc(), target);
+  }
+
+  // double dc = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dc = this->_internal_dc();
+  uint64_t raw_dc;
+  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
+  if (raw_dc != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_dc(), target);
+  }
+
+  // int32 g_cross = 5;
+  if (this->_internal_g_cross() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_g_cross(), target);
+  }
+
+  // int32 g_intra = 6;
+  if (this->_internal_g_intra() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_g_intra(), target);
+  }
+
+  // int32 l_cross = 7;
+  if (this->_internal_l_cross() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_l_cross(), target);
+  }
+
+  // int32 l_intra = 8;
+  if (this->_internal_l_intra() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_l_intra(), target);
+  }
+
+  // int32 d_cross = 9;
+  if (this->_internal_d_cross() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_d_cross(), target);
+  }
+
+  // int32 d_intra = 10;
+  if (this->_internal_d_intra() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_d_intra(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.RepIfMerged)
+  return target;
+}
+
+size_t RepIfMerged::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.RepIfMerged)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double lc = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lc = this->_internal_lc();
+  uint64_t raw_lc;
+  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
+  if (raw_lc != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double gc = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gc = this->_internal_gc();
+  uint64_t raw_gc;
+  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
+  if (raw_gc != 0) {
+    total_size += 1 + 8;
+  }
+
+  // bool ifmerged = 1;
+  if (this->_internal_ifmerged() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 g_cross = 5;
+  if (this->_internal_g_cross() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_g_cross());
+  }
+
+  // double dc = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dc = this->_internal_dc();
+  uint64_t raw_dc;
+  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
+  if (raw_dc != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 g_intra = 6;
+  if (this->_internal_g_intra() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_g_intra());
+  }
+
+  // int32 l_cross = 7;
+  if (this->_internal_l_cross() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_l_cross());
+  }
+
+  // int32 l_intra = 8;
+  if (this->_internal_l_intra() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_l_intra());
+  }
+
+  // int32 d_cross = 9;
+  if (this->_internal_d_cross() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_d_cross());
+  }
+
+  // int32 d_intra = 10;
+  if (this->_internal_d_intra() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_d_intra());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RepIfMerged::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RepIfMerged::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RepIfMerged::GetClassData() const { return &_class_data_; }
+
+
+void RepIfMerged::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RepIfMerged*>(&to_msg);
+  auto& from = static_cast<const RepIfMerged&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.RepIfMerged)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lc = from._internal_lc();
+  uint64_t raw_lc;
+  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
+  if (raw_lc != 0) {
+    _this->_internal_set_lc(from._internal_lc());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gc = from._internal_gc();
+  uint64_t raw_gc;
+  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
+  if (raw_gc != 0) {
+    _this->_internal_set_gc(from._internal_gc());
+  }
+  if (from._internal_ifmerged() != 0) {
+    _this->_internal_set_ifmerged(from._internal_ifmerged());
+  }
+  if (from._internal_g_cross() != 0) {
+    _this->_internal_set_g_cross(from._internal_g_cross());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dc = from._internal_dc();
+  uint64_t raw_dc;
+  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
+  if (raw_dc != 0) {
+    _this->_internal_set_dc(from._internal_dc());
+  }
+  if (from._internal_g_intra() != 0) {
+    _this->_internal_set_g_intra(from._internal_g_intra());
+  }
+  if (from._internal_l_cross() != 0) {
+    _this->_internal_set_l_cross(from._internal_l_cross());
+  }
+  if (from._internal_l_intra() != 0) {
+    _this->_internal_set_l_intra(from._internal_l_intra());
+  }
+  if (from._internal_d_cross() != 0) {
+    _this->_internal_set_d_cross(from._internal_d_cross());
+  }
+  if (from._internal_d_intra() != 0) {
+    _this->_internal_set_d_intra(from._internal_d_intra());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RepIfMerged::CopyFrom(const RepIfMerged& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.RepIfMerged)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RepIfMerged::IsInitialized() const {
+  return true;
+}
+
+void RepIfMerged::InternalSwap(RepIfMerged* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RepIfMerged, _impl_.d_intra_)
+      + sizeof(RepIfMerged::_impl_.d_intra_)
+      - PROTOBUF_FIELD_OFFSET(RepIfMerged, _impl_.lc_)>(
+          reinterpret_cast<char*>(&_impl_.lc_),
+          reinterpret_cast<char*>(&other->_impl_.lc_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RepIfMerged::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[24]);
+}
+
+// ===================================================================
+
+class MergeJobRequest::_Internal {
+ public:
+};
+
+MergeJobRequest::MergeJobRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.MergeJobRequest)
+}
+MergeJobRequest::MergeJobRequest(const MergeJobRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MergeJobRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.num_of_stripes_){from._impl_.num_of_stripes_}
+    , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+    , decltype(_impl_.max_concurrency_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.max_concurrency_ = from._impl_.max_concurrency_;
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.MergeJobRequest)
+}
+
+inline void MergeJobRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.num_of_stripes_){arena}
+    , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+    , decltype(_impl_.max_concurrency_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MergeJobRequest::~MergeJobRequest() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.MergeJobRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MergeJobRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.num_of_stripes_.~RepeatedField();
+}
+
+void MergeJobRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MergeJobRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.MergeJobRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.num_of_stripes_.Clear();
+  _impl_.max_concurrency_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MergeJobRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 num_of_stripes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_num_of_stripes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_num_of_stripes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_concurrency = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_concurrency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MergeJobRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.MergeJobRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 num_of_stripes = 1;
+  {
+    int byte_size = _impl_._num_of_stripes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_num_of_stripes(), byte_size, target);
+    }
+  }
+
+  // int32 max_concurrency = 2;
+  if (this->_internal_max_concurrency() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_concurrency(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.MergeJobRequest)
+  return target;
+}
+
+size_t MergeJobRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.MergeJobRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 num_of_stripes = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.num_of_stripes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._num_of_stripes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // int32 max_concurrency = 2;
+  if (this->_internal_max_concurrency() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_concurrency());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MergeJobRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MergeJobRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MergeJobRequest::GetClassData() const { return &_class_data_; }
+
+
+void MergeJobRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MergeJobRequest*>(&to_msg);
+  auto& from = static_cast<const MergeJobRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.MergeJobRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.num_of_stripes_.MergeFrom(from._impl_.num_of_stripes_);
+  if (from._internal_max_concurrency() != 0) {
+    _this->_internal_set_max_concurrency(from._internal_max_concurrency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MergeJobRequest::CopyFrom(const MergeJobRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.MergeJobRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MergeJobRequest::IsInitialized() const {
+  return true;
+}
+
+void MergeJobRequest::InternalSwap(MergeJobRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.num_of_stripes_.InternalSwap(&other->_impl_.num_of_stripes_);
+  swap(_impl_.max_concurrency_, other->_impl_.max_concurrency_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MergeJobRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[25]);
+}
+
+// ===================================================================
+
+class MergePlanRequest::_Internal {
+ public:
+};
+
+MergePlanRequest::MergePlanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.MergePlanRequest)
+}
+MergePlanRequest::MergePlanRequest(const MergePlanRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MergePlanRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.merge_factor_){}
+    , decltype(_impl_.max_stages_){}
+    , decltype(_impl_.execute_){}
+    , decltype(_impl_.max_concurrency_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.merge_factor_, &from._impl_.merge_factor_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_concurrency_) -
+    reinterpret_cast<char*>(&_impl_.merge_factor_)) + sizeof(_impl_.max_concurrency_));
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.MergePlanRequest)
+}
+
+inline void MergePlanRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.merge_factor_){0}
+    , decltype(_impl_.max_stages_){0}
+    , decltype(_impl_.execute_){false}
+    , decltype(_impl_.max_concurrency_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MergePlanRequest::~MergePlanRequest() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.MergePlanRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MergePlanRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MergePlanRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MergePlanRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.MergePlanRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.merge_factor_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_concurrency_) -
+      reinterpret_cast<char*>(&_impl_.merge_factor_)) + sizeof(_impl_.max_concurrency_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MergePlanRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 merge_factor = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.merge_factor_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_stages = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_stages_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool execute = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.execute_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_concurrency = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_concurrency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MergePlanRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.MergePlanRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 merge_factor = 1;
+  if (this->_internal_merge_factor() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_merge_factor(), target);
+  }
+
+  // int32 max_stages = 2;
+  if (this->_internal_max_stages() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_stages(), target);
+  }
+
+  // bool execute = 3;
+  if (this->_internal_execute() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_execute(), target);
+  }
+
+  // int32 max_concurrency = 4;
+  if (this->_internal_max_concurrency() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_max_concurrency(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.MergePlanRequest)
+  return target;
+}
+
+size_t MergePlanRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.MergePlanRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 merge_factor = 1;
+  if (this->_internal_merge_factor() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_merge_factor());
+  }
+
+  // int32 max_stages = 2;
+  if (this->_internal_max_stages() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_stages());
+  }
+
+  // bool execute = 3;
+  if (this->_internal_execute() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 max_concurrency = 4;
+  if (this->_internal_max_concurrency() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_concurrency());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MergePlanRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MergePlanRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MergePlanRequest::GetClassData() const { return &_class_data_; }
+
+
+void MergePlanRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MergePlanRequest*>(&to_msg);
+  auto& from = static_cast<const MergePlanRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.MergePlanRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_merge_factor() != 0) {
+    _this->_internal_set_merge_factor(from._internal_merge_factor());
+  }
+  if (from._internal_max_stages() != 0) {
+    _this->_internal_set_max_stages(from._internal_max_stages());
+  }
+  if (from._internal_execute() != 0) {
+    _this->_internal_set_execute(from._internal_execute());
+  }
+  if (from._internal_max_concurrency() != 0) {
+    _this->_internal_set_max_concurrency(from._internal_max_concurrency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MergePlanRequest::CopyFrom(const MergePlanRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.MergePlanRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MergePlanRequest::IsInitialized() const {
+  return true;
+}
+
+void MergePlanRequest::InternalSwap(MergePlanRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MergePlanRequest, _impl_.max_concurrency_)
+      + sizeof(MergePlanRequest::_impl_.max_concurrency_)
+      - PROTOBUF_FIELD_OFFSET(MergePlanRequest, _impl_.merge_factor_)>(
+          reinterpret_cast<char*>(&_impl_.merge_factor_),
+          reinterpret_cast<char*>(&other->_impl_.merge_factor_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MergePlanRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[26]);
+}
+
+// ===================================================================
+
+class MergeSchedule::_Internal {
+ public:
+};
+
+MergeSchedule::MergeSchedule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.MergeSchedule)
+}
+MergeSchedule::MergeSchedule(const MergeSchedule& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MergeSchedule* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.num_of_stripes_){from._impl_.num_of_stripes_}
+    , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+    , decltype(_impl_.ifplanned_){}
+    , decltype(_impl_.cross_blocks_){}
+    , decltype(_impl_.intra_blocks_){}
+    , decltype(_impl_.job_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ifplanned_, &from._impl_.ifplanned_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.job_id_) -
+    reinterpret_cast<char*>(&_impl_.ifplanned_)) + sizeof(_impl_.job_id_));
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.MergeSchedule)
+}
+
+inline void MergeSchedule::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.num_of_stripes_){arena}
+    , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+    , decltype(_impl_.ifplanned_){false}
+    , decltype(_impl_.cross_blocks_){0}
+    , decltype(_impl_.intra_blocks_){0}
+    , decltype(_impl_.job_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MergeSchedule::~MergeSchedule() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.MergeSchedule)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MergeSchedule::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.num_of_stripes_.~RepeatedField();
+}
+
+void MergeSchedule::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MergeSchedule::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.MergeSchedule)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.num_of_stripes_.Clear();
+  ::memset(&_impl_.ifplanned_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.job_id_) -
+      reinterpret_cast<char*>(&_impl_.ifplanned_)) + sizeof(_impl_.job_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MergeSchedule::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool ifplanned = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ifplanned_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 num_of_stripes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_num_of_stripes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_num_of_stripes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 cross_blocks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.cross_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 intra_blocks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.intra_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 job_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.job_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MergeSchedule::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.MergeSchedule)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool ifplanned = 1;
+  if (this->_internal_ifplanned() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_ifplanned(), target);
+  }
+
+  // repeated int32 num_of_stripes = 2;
+  {
+    int byte_size = _impl_._num_of_stripes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_num_of_stripes(), byte_size, target);
+    }
+  }
+
+  // int32 cross_blocks = 3;
+  if (this->_internal_cross_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_cross_blocks(), target);
+  }
+
+  // int32 intra_blocks = 4;
+  if (this->_internal_intra_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_intra_blocks(), target);
+  }
+
+  // int32 job_id = 5;
+  if (this->_internal_job_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_job_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.MergeSchedule)
+  return target;
+}
+
+size_t MergeSchedule::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.MergeSchedule)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 num_of_stripes = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.num_of_stripes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._num_of_stripes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // bool ifplanned = 1;
+  if (this->_internal_ifplanned() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 cross_blocks = 3;
+  if (this->_internal_cross_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cross_blocks());
+  }
+
+  // int32 intra_blocks = 4;
+  if (this->_internal_intra_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_intra_blocks());
+  }
+
+  // int32 job_id = 5;
+  if (this->_internal_job_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_job_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MergeSchedule::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MergeSchedule::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MergeSchedule::GetClassData() const { return &_class_data_; }
+
+
+void MergeSchedule::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MergeSchedule*>(&to_msg);
+  auto& from = static_cast<const MergeSchedule&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.MergeSchedule)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.num_of_stripes_.MergeFrom(from._impl_.num_of_stripes_);
+  if (from._internal_ifplanned() != 0) {
+    _this->_internal_set_ifplanned(from._internal_ifplanned());
+  }
+  if (from._internal_cross_blocks() != 0) {
+    _this->_internal_set_cross_blocks(from._internal_cross_blocks());
+  }
+  if (from._internal_intra_blocks() != 0) {
+    _this->_internal_set_intra_blocks(from._internal_intra_blocks());
+  }
+  if (from._internal_job_id() != 0) {
+    _this->_internal_set_job_id(from._internal_job_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MergeSchedule::CopyFrom(const MergeSchedule& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.MergeSchedule)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MergeSchedule::IsInitialized() const {
+  return true;
+}
+
+void MergeSchedule::InternalSwap(MergeSchedule* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.num_of_stripes_.InternalSwap(&other->_impl_.num_of_stripes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MergeSchedule, _impl_.job_id_)
+      + sizeof(MergeSchedule::_impl_.job_id_)
+      - PROTOBUF_FIELD_OFFSET(MergeSchedule, _impl_.ifplanned_)>(
+          reinterpret_cast<char*>(&_impl_.ifplanned_),
+          reinterpret_cast<char*>(&other->_impl_.ifplanned_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MergeSchedule::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[27]);
+}
+
+// ===================================================================
+
+class AppendMergeRequest::_Internal {
+ public:
+};
+
+AppendMergeRequest::AppendMergeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.AppendMergeRequest)
+}
+AppendMergeRequest::AppendMergeRequest(const AppendMergeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendMergeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stripe_id_){}
+    , decltype(_impl_.wide_stripe_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.stripe_id_, &from._impl_.stripe_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.wide_stripe_id_) -
+    reinterpret_cast<char*>(&_impl_.stripe_id_)) + sizeof(_impl_.wide_stripe_id_));
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.AppendMergeRequest)
+}
+
+inline void AppendMergeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stripe_id_){0}
+    , decltype(_impl_.wide_stripe_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AppendMergeRequest::~AppendMergeRequest() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.AppendMergeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppendMergeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void AppendMergeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppendMergeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.AppendMergeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.stripe_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.wide_stripe_id_) -
+      reinterpret_cast<char*>(&_impl_.stripe_id_)) + sizeof(_impl_.wide_stripe_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppendMergeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 stripe_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.stripe_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 wide_stripe_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.wide_stripe_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppendMergeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.AppendMergeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 stripe_id = 1;
+  if (this->_internal_stripe_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_stripe_id(), target);
+  }
+
+  // int32 wide_stripe_id = 2;
+  if (this->_internal_wide_stripe_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_wide_stripe_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.AppendMergeRequest)
+  return target;
+}
+
+size_t AppendMergeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.AppendMergeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 stripe_id = 1;
+  if (this->_internal_stripe_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stripe_id());
+  }
+
+  // int32 wide_stripe_id = 2;
+  if (this->_internal_wide_stripe_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_wide_stripe_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendMergeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendMergeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendMergeRequest::GetClassData() const { return &_class_data_; }
+
+
+void AppendMergeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendMergeRequest*>(&to_msg);
+  auto& from = static_cast<const AppendMergeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.AppendMergeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_stripe_id() != 0) {
+    _this->_internal_set_stripe_id(from._internal_stripe_id());
+  }
+  if (from._internal_wide_stripe_id() != 0) {
+    _this->_internal_set_wide_stripe_id(from._internal_wide_stripe_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppendMergeRequest::CopyFrom(const AppendMergeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.AppendMergeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppendMergeRequest::IsInitialized() const {
+  return true;
+}
+
+void AppendMergeRequest::InternalSwap(AppendMergeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AppendMergeRequest, _impl_.wide_stripe_id_)
+      + sizeof(AppendMergeRequest::_impl_.wide_stripe_id_)
+      - PROTOBUF_FIELD_OFFSET(AppendMergeRequest, _impl_.stripe_id_)>(
+          reinterpret_cast<char*>(&_impl_.stripe_id_),
+          reinterpret_cast<char*>(&other->_impl_.stripe_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppendMergeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[28]);
+}
+
+// ===================================================================
+
+class MergeJobId::_Internal {
+ public:
+};
+
+MergeJobId::MergeJobId(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.MergeJobId)
+}
+MergeJobId::MergeJobId(const MergeJobId& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MergeJobId* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.job_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.job_id_ = from._impl_.job_id_;
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.MergeJobId)
+}
+
+inline void MergeJobId::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.job_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MergeJobId::~MergeJobId() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.MergeJobId)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MergeJobId::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MergeJobId::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MergeJobId::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.MergeJobId)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.job_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MergeJobId::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 job_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.job_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MergeJobId::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.MergeJobId)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 job_id = 1;
+  if (this->_internal_job_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_job_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.MergeJobId)
+  return target;
+}
+
+size_t MergeJobId::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.MergeJobId)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 job_id = 1;
+  if (this->_internal_job_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_job_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MergeJobId::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MergeJobId::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MergeJobId::GetClassData() const { return &_class_data_; }
+
+
+void MergeJobId::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MergeJobId*>(&to_msg);
+  auto& from = static_cast<const MergeJobId&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.MergeJobId)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_job_id() != 0) {
+    _this->_internal_set_job_id(from._internal_job_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MergeJobId::CopyFrom(const MergeJobId& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.MergeJobId)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MergeJobId::IsInitialized() const {
+  return true;
+}
+
+void MergeJobId::InternalSwap(MergeJobId* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.job_id_, other->_impl_.job_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MergeJobId::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
+      file_level_metadata_coordinator_2eproto[29]);
+}
+
+// ===================================================================
+
+class MergeJobStatus::_Internal {
+ public:
+};
+
+MergeJobStatus::MergeJobStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.MergeJobStatus)
+}
+MergeJobStatus::MergeJobStatus(const MergeJobStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MergeJobStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.job_id_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.stages_done_){}
+    , decltype(_impl_.stages_total_){}
+    , decltype(_impl_.stripes_merged_){}
+    , decltype(_impl_.stripes_total_){}
+    , decltype(_impl_.g_bytes_){}
+    , decltype(_impl_.l_bytes_){}
+    , decltype(_impl_.d_bytes_){}
+    , decltype(_impl_.lc_){}
+    , decltype(_impl_.gc_){}
+    , decltype(_impl_.dc_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.job_id_, &from._impl_.job_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dc_) -
+    reinterpret_cast<char*>(&_impl_.job_id_)) + sizeof(_impl_.dc_));
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.MergeJobStatus)
+}
+
+inline void MergeJobStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.job_id_){0}
+    , decltype(_impl_.state_){0}
+    , decltype(_impl_.stages_done_){0}
+    , decltype(_impl_.stages_total_){0}
+    , decltype(_impl_.stripes_merged_){0}
+    , decltype(_impl_.stripes_total_){0}
+    , decltype(_impl_.g_bytes_){int64_t{0}}
+    , decltype(_impl_.l_bytes_){int64_t{0}}
+    , decltype(_impl_.d_bytes_){int64_t{0}}
+    , decltype(_impl_.lc_){0}
+    , decltype(_impl_.gc_){0}
+    , decltype(_impl_.dc_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-NumberOfStripesToMerge::~NumberOfStripesToMerge() {
-  // @@protoc_insertion_point(destructor:coordinator_proto.NumberOfStripesToMerge)
+MergeJobStatus::~MergeJobStatus() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.MergeJobStatus)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3769,38 +8175,128 @@ NumberOfStripesToMerge::~NumberOfStripesToMerge() {
   SharedDtor();
 }
 
-inline void NumberOfStripesToMerge::SharedDtor() {
+inline void MergeJobStatus::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void NumberOfStripesToMerge::SetCachedSize(int size) const {
+void MergeJobStatus::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void NumberOfStripesToMerge::Clear() {
-// @@protoc_insertion_point(message_clear_start:coordinator_proto.NumberOfStripesToMerge)
+void MergeJobStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.MergeJobStatus)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.num_of_stripes_ = 0;
+  ::memset(&_impl_.job_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dc_) -
+      reinterpret_cast<char*>(&_impl_.job_id_)) + sizeof(_impl_.dc_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NumberOfStripesToMerge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* MergeJobStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 num_of_stripes = 1;
+      // int32 job_id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.num_of_stripes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.job_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 stages_done = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.stages_done_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 stages_total = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.stages_total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 stripes_merged = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.stripes_merged_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 stripes_total = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.stripes_total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 g_bytes = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.g_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 l_bytes = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.l_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
+      // int64 d_bytes = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.d_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double lc = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _impl_.lc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double gc = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _impl_.gc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double dc = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _impl_.dc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3824,130 +8320,335 @@ failure:
 #undef CHK_
 }
 
-uint8_t* NumberOfStripesToMerge::_InternalSerialize(
+uint8_t* MergeJobStatus::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.NumberOfStripesToMerge)
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.MergeJobStatus)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 num_of_stripes = 1;
-  if (this->_internal_num_of_stripes() != 0) {
+  // int32 job_id = 1;
+  if (this->_internal_job_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_num_of_stripes(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_job_id(), target);
+  }
+
+  // int32 state = 2;
+  if (this->_internal_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_state(), target);
+  }
+
+  // int32 stages_done = 3;
+  if (this->_internal_stages_done() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_stages_done(), target);
+  }
+
+  // int32 stages_total = 4;
+  if (this->_internal_stages_total() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_stages_total(), target);
+  }
+
+  // int32 stripes_merged = 5;
+  if (this->_internal_stripes_merged() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_stripes_merged(), target);
+  }
+
+  // int32 stripes_total = 6;
+  if (this->_internal_stripes_total() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_stripes_total(), target);
+  }
+
+  // int64 g_bytes = 7;
+  if (this->_internal_g_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_g_bytes(), target);
+  }
+
+  // int64 l_bytes = 8;
+  if (this->_internal_l_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_l_bytes(), target);
+  }
+
+  // int64 d_bytes = 9;
+  if (this->_internal_d_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_d_bytes(), target);
+  }
+
+  // double lc = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lc = this->_internal_lc();
+  uint64_t raw_lc;
+  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
+  if (raw_lc != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_lc(), target);
+  }
+
+  // double gc = 11;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gc = this->_internal_gc();
+  uint64_t raw_gc;
+  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
+  if (raw_gc != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_gc(), target);
+  }
+
+  // double dc = 12;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dc = this->_internal_dc();
+  uint64_t raw_dc;
+  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
+  if (raw_dc != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_dc(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.NumberOfStripesToMerge)
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.MergeJobStatus)
   return target;
 }
 
-size_t NumberOfStripesToMerge::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.NumberOfStripesToMerge)
+size_t MergeJobStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.MergeJobStatus)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 num_of_stripes = 1;
-  if (this->_internal_num_of_stripes() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_of_stripes());
+  // int32 job_id = 1;
+  if (this->_internal_job_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_job_id());
+  }
+
+  // int32 state = 2;
+  if (this->_internal_state() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_state());
+  }
+
+  // int32 stages_done = 3;
+  if (this->_internal_stages_done() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stages_done());
+  }
+
+  // int32 stages_total = 4;
+  if (this->_internal_stages_total() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stages_total());
+  }
+
+  // int32 stripes_merged = 5;
+  if (this->_internal_stripes_merged() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stripes_merged());
+  }
+
+  // int32 stripes_total = 6;
+  if (this->_internal_stripes_total() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stripes_total());
+  }
+
+  // int64 g_bytes = 7;
+  if (this->_internal_g_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_g_bytes());
+  }
+
+  // int64 l_bytes = 8;
+  if (this->_internal_l_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_l_bytes());
+  }
+
+  // int64 d_bytes = 9;
+  if (this->_internal_d_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_d_bytes());
+  }
+
+  // double lc = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lc = this->_internal_lc();
+  uint64_t raw_lc;
+  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
+  if (raw_lc != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double gc = 11;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gc = this->_internal_gc();
+  uint64_t raw_gc;
+  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
+  if (raw_gc != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double dc = 12;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dc = this->_internal_dc();
+  uint64_t raw_dc;
+  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
+  if (raw_dc != 0) {
+    total_size += 1 + 8;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NumberOfStripesToMerge::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MergeJobStatus::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    NumberOfStripesToMerge::MergeImpl
+    MergeJobStatus::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NumberOfStripesToMerge::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MergeJobStatus::GetClassData() const { return &_class_data_; }
 
 
-void NumberOfStripesToMerge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<NumberOfStripesToMerge*>(&to_msg);
-  auto& from = static_cast<const NumberOfStripesToMerge&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.NumberOfStripesToMerge)
+void MergeJobStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MergeJobStatus*>(&to_msg);
+  auto& from = static_cast<const MergeJobStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.MergeJobStatus)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_num_of_stripes() != 0) {
-    _this->_internal_set_num_of_stripes(from._internal_num_of_stripes());
+  if (from._internal_job_id() != 0) {
+    _this->_internal_set_job_id(from._internal_job_id());
+  }
+  if (from._internal_state() != 0) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  if (from._internal_stages_done() != 0) {
+    _this->_internal_set_stages_done(from._internal_stages_done());
+  }
+  if (from._internal_stages_total() != 0) {
+    _this->_internal_set_stages_total(from._internal_stages_total());
+  }
+  if (from._internal_stripes_merged() != 0) {
+    _this->_internal_set_stripes_merged(from._internal_stripes_merged());
+  }
+  if (from._internal_stripes_total() != 0) {
+    _this->_internal_set_stripes_total(from._internal_stripes_total());
+  }
+  if (from._internal_g_bytes() != 0) {
+    _this->_internal_set_g_bytes(from._internal_g_bytes());
+  }
+  if (from._internal_l_bytes() != 0) {
+    _this->_internal_set_l_bytes(from._internal_l_bytes());
+  }
+  if (from._internal_d_bytes() != 0) {
+    _this->_internal_set_d_bytes(from._internal_d_bytes());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lc = from._internal_lc();
+  uint64_t raw_lc;
+  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
+  if (raw_lc != 0) {
+    _this->_internal_set_lc(from._internal_lc());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gc = from._internal_gc();
+  uint64_t raw_gc;
+  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
+  if (raw_gc != 0) {
+    _this->_internal_set_gc(from._internal_gc());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dc = from._internal_dc();
+  uint64_t raw_dc;
+  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
+  if (raw_dc != 0) {
+    _this->_internal_set_dc(from._internal_dc());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void NumberOfStripesToMerge::CopyFrom(const NumberOfStripesToMerge& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.NumberOfStripesToMerge)
+void MergeJobStatus::CopyFrom(const MergeJobStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.MergeJobStatus)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NumberOfStripesToMerge::IsInitialized() const {
+bool MergeJobStatus::IsInitialized() const {
   return true;
 }
 
-void NumberOfStripesToMerge::InternalSwap(NumberOfStripesToMerge* other) {
+void MergeJobStatus::InternalSwap(MergeJobStatus* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.num_of_stripes_, other->_impl_.num_of_stripes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MergeJobStatus, _impl_.dc_)
+      + sizeof(MergeJobStatus::_impl_.dc_)
+      - PROTOBUF_FIELD_OFFSET(MergeJobStatus, _impl_.job_id_)>(
+          reinterpret_cast<char*>(&_impl_.job_id_),
+          reinterpret_cast<char*>(&other->_impl_.job_id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata NumberOfStripesToMerge::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata MergeJobStatus::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
-      file_level_metadata_coordinator_2eproto[14]);
+      file_level_metadata_coordinator_2eproto[30]);
 }
 
 // ===================================================================
 
-class RepIfMerged::_Internal {
+class MergePolicy::_Internal {
  public:
 };
 
-RepIfMerged::RepIfMerged(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+MergePolicy::MergePolicy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:coordinator_proto.RepIfMerged)
+  // @@protoc_insertion_point(arena_constructor:coordinator_proto.MergePolicy)
 }
-RepIfMerged::RepIfMerged(const RepIfMerged& from)
+MergePolicy::MergePolicy(const MergePolicy& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  RepIfMerged* const _this = this; (void)_this;
+  MergePolicy* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.lc_){}
-    , decltype(_impl_.gc_){}
-    , decltype(_impl_.dc_){}
-    , decltype(_impl_.ifmerged_){}
+      decltype(_impl_.num_of_stripes_){from._impl_.num_of_stripes_}
+    , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+    , decltype(_impl_.enable_){}
+    , decltype(_impl_.min_stripes_per_group_){}
+    , decltype(_impl_.bandwidth_){}
+    , decltype(_impl_.max_ops_per_sec_){}
+    , decltype(_impl_.check_interval_ms_){}
+    , decltype(_impl_.max_concurrency_){}
+    , decltype(_impl_.split_min_accesses_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.lc_, &from._impl_.lc_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ifmerged_) -
-    reinterpret_cast<char*>(&_impl_.lc_)) + sizeof(_impl_.ifmerged_));
-  // @@protoc_insertion_point(copy_constructor:coordinator_proto.RepIfMerged)
+  ::memcpy(&_impl_.enable_, &from._impl_.enable_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.split_min_accesses_) -
+    reinterpret_cast<char*>(&_impl_.enable_)) + sizeof(_impl_.split_min_accesses_));
+  // @@protoc_insertion_point(copy_constructor:coordinator_proto.MergePolicy)
 }
 
-inline void RepIfMerged::SharedCtor(
+inline void MergePolicy::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.lc_){0}
-    , decltype(_impl_.gc_){0}
-    , decltype(_impl_.dc_){0}
-    , decltype(_impl_.ifmerged_){false}
+      decltype(_impl_.num_of_stripes_){arena}
+    , /*decltype(_impl_._num_of_stripes_cached_byte_size_)*/{0}
+    , decltype(_impl_.enable_){false}
+    , decltype(_impl_.min_stripes_per_group_){0}
+    , decltype(_impl_.bandwidth_){int64_t{0}}
+    , decltype(_impl_.max_ops_per_sec_){0}
+    , decltype(_impl_.check_interval_ms_){0}
+    , decltype(_impl_.max_concurrency_){0}
+    , decltype(_impl_.split_min_accesses_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-RepIfMerged::~RepIfMerged() {
-  // @@protoc_insertion_point(destructor:coordinator_proto.RepIfMerged)
+MergePolicy::~MergePolicy() {
+  // @@protoc_insertion_point(destructor:coordinator_proto.MergePolicy)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3955,61 +8656,98 @@ RepIfMerged::~RepIfMerged() {
   SharedDtor();
 }
 
-inline void RepIfMerged::SharedDtor() {
+inline void MergePolicy::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.num_of_stripes_.~RepeatedField();
 }
 
-void RepIfMerged::SetCachedSize(int size) const {
+void MergePolicy::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void RepIfMerged::Clear() {
-// @@protoc_insertion_point(message_clear_start:coordinator_proto.RepIfMerged)
+void MergePolicy::Clear() {
+// @@protoc_insertion_point(message_clear_start:coordinator_proto.MergePolicy)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.lc_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.ifmerged_) -
-      reinterpret_cast<char*>(&_impl_.lc_)) + sizeof(_impl_.ifmerged_));
+  _impl_.num_of_stripes_.Clear();
+  ::memset(&_impl_.enable_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.split_min_accesses_) -
+      reinterpret_cast<char*>(&_impl_.enable_)) + sizeof(_impl_.split_min_accesses_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RepIfMerged::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* MergePolicy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bool ifmerged = 1;
+      // bool enable = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.ifmerged_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.enable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // double lc = 2;
+      // repeated int32 num_of_stripes = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          _impl_.lc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_num_of_stripes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_num_of_stripes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // double gc = 3;
+      // int32 min_stripes_per_group = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
-          _impl_.gc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.min_stripes_per_group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // double dc = 4;
+      // int32 max_ops_per_sec = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
-          _impl_.dc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_ops_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 bandwidth = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.bandwidth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 check_interval_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.check_interval_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_concurrency = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.max_concurrency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 split_min_accesses = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.split_min_accesses_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -4036,167 +8774,198 @@ failure:
 #undef CHK_
 }
 
-uint8_t* RepIfMerged::_InternalSerialize(
+uint8_t* MergePolicy::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.RepIfMerged)
+  // @@protoc_insertion_point(serialize_to_array_start:coordinator_proto.MergePolicy)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bool ifmerged = 1;
-  if (this->_internal_ifmerged() != 0) {
+  // bool enable = 1;
+  if (this->_internal_enable() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_ifmerged(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_enable(), target);
   }
 
-  // double lc = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lc = this->_internal_lc();
-  uint64_t raw_lc;
-  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
-  if (raw_lc != 0) {
+  // repeated int32 num_of_stripes = 2;
+  {
+    int byte_size = _impl_._num_of_stripes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_num_of_stripes(), byte_size, target);
+    }
+  }
+
+  // int32 min_stripes_per_group = 3;
+  if (this->_internal_min_stripes_per_group() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_lc(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_min_stripes_per_group(), target);
   }
 
-  // double gc = 3;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_gc = this->_internal_gc();
-  uint64_t raw_gc;
-  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
-  if (raw_gc != 0) {
+  // int32 max_ops_per_sec = 4;
+  if (this->_internal_max_ops_per_sec() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_gc(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_max_ops_per_sec(), target);
   }
 
-  // double dc = 4;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_dc = this->_internal_dc();
-  uint64_t raw_dc;
-  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
-  if (raw_dc != 0) {
+  // int64 bandwidth = 5;
+  if (this->_internal_bandwidth() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_dc(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_bandwidth(), target);
+  }
+
+  // int32 check_interval_ms = 6;
+  if (this->_internal_check_interval_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_check_interval_ms(), target);
+  }
+
+  // int32 max_concurrency = 7;
+  if (this->_internal_max_concurrency() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_max_concurrency(), target);
+  }
+
+  // int32 split_min_accesses = 8;
+  if (this->_internal_split_min_accesses() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_split_min_accesses(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.RepIfMerged)
+  // @@protoc_insertion_point(serialize_to_array_end:coordinator_proto.MergePolicy)
   return target;
 }
 
-size_t RepIfMerged::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.RepIfMerged)
+size_t MergePolicy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:coordinator_proto.MergePolicy)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // double lc = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lc = this->_internal_lc();
-  uint64_t raw_lc;
-  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
-  if (raw_lc != 0) {
-    total_size += 1 + 8;
+  // repeated int32 num_of_stripes = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.num_of_stripes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._num_of_stripes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  // double gc = 3;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_gc = this->_internal_gc();
-  uint64_t raw_gc;
-  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
-  if (raw_gc != 0) {
-    total_size += 1 + 8;
+  // bool enable = 1;
+  if (this->_internal_enable() != 0) {
+    total_size += 1 + 1;
   }
 
-  // double dc = 4;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_dc = this->_internal_dc();
-  uint64_t raw_dc;
-  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
-  if (raw_dc != 0) {
-    total_size += 1 + 8;
+  // int32 min_stripes_per_group = 3;
+  if (this->_internal_min_stripes_per_group() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min_stripes_per_group());
   }
 
-  // bool ifmerged = 1;
-  if (this->_internal_ifmerged() != 0) {
-    total_size += 1 + 1;
+  // int64 bandwidth = 5;
+  if (this->_internal_bandwidth() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_bandwidth());
+  }
+
+  // int32 max_ops_per_sec = 4;
+  if (this->_internal_max_ops_per_sec() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_ops_per_sec());
+  }
+
+  // int32 check_interval_ms = 6;
+  if (this->_internal_check_interval_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_check_interval_ms());
+  }
+
+  // int32 max_concurrency = 7;
+  if (this->_internal_max_concurrency() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_concurrency());
+  }
+
+  // int32 split_min_accesses = 8;
+  if (this->_internal_split_min_accesses() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_split_min_accesses());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RepIfMerged::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MergePolicy::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    RepIfMerged::MergeImpl
+    MergePolicy::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RepIfMerged::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MergePolicy::GetClassData() const { return &_class_data_; }
 
 
-void RepIfMerged::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<RepIfMerged*>(&to_msg);
-  auto& from = static_cast<const RepIfMerged&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.RepIfMerged)
+void MergePolicy::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MergePolicy*>(&to_msg);
+  auto& from = static_cast<const MergePolicy&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:coordinator_proto.MergePolicy)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lc = from._internal_lc();
-  uint64_t raw_lc;
-  memcpy(&raw_lc, &tmp_lc, sizeof(tmp_lc));
-  if (raw_lc != 0) {
-    _this->_internal_set_lc(from._internal_lc());
+  _this->_impl_.num_of_stripes_.MergeFrom(from._impl_.num_of_stripes_);
+  if (from._internal_enable() != 0) {
+    _this->_internal_set_enable(from._internal_enable());
   }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_gc = from._internal_gc();
-  uint64_t raw_gc;
-  memcpy(&raw_gc, &tmp_gc, sizeof(tmp_gc));
-  if (raw_gc != 0) {
-    _this->_internal_set_gc(from._internal_gc());
+  if (from._internal_min_stripes_per_group() != 0) {
+    _this->_internal_set_min_stripes_per_group(from._internal_min_stripes_per_group());
   }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_dc = from._internal_dc();
-  uint64_t raw_dc;
-  memcpy(&raw_dc, &tmp_dc, sizeof(tmp_dc));
-  if (raw_dc != 0) {
-    _this->_internal_set_dc(from._internal_dc());
+  if (from._internal_bandwidth() != 0) {
+    _this->_internal_set_bandwidth(from._internal_bandwidth());
   }
-  if (from._internal_ifmerged() != 0) {
-    _this->_internal_set_ifmerged(from._internal_ifmerged());
+  if (from._internal_max_ops_per_sec() != 0) {
+    _this->_internal_set_max_ops_per_sec(from._internal_max_ops_per_sec());
+  }
+  if (from._internal_check_interval_ms() != 0) {
+    _this->_internal_set_check_interval_ms(from._internal_check_interval_ms());
+  }
+  if (from._internal_max_concurrency() != 0) {
+    _this->_internal_set_max_concurrency(from._internal_max_concurrency());
+  }
+  if (from._internal_split_min_accesses() != 0) {
+    _this->_internal_set_split_min_accesses(from._internal_split_min_accesses());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RepIfMerged::CopyFrom(const RepIfMerged& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.RepIfMerged)
+void MergePolicy::CopyFrom(const MergePolicy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:coordinator_proto.MergePolicy)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RepIfMerged::IsInitialized() const {
+bool MergePolicy::IsInitialized() const {
   return true;
 }
 
-void RepIfMerged::InternalSwap(RepIfMerged* other) {
+void MergePolicy::InternalSwap(MergePolicy* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.num_of_stripes_.InternalSwap(&other->_impl_.num_of_stripes_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RepIfMerged, _impl_.ifmerged_)
-      + sizeof(RepIfMerged::_impl_.ifmerged_)
-      - PROTOBUF_FIELD_OFFSET(RepIfMerged, _impl_.lc_)>(
-          reinterpret_cast<char*>(&_impl_.lc_),
-          reinterpret_cast<char*>(&other->_impl_.lc_));
+      PROTOBUF_FIELD_OFFSET(MergePolicy, _impl_.split_min_accesses_)
+      + sizeof(MergePolicy::_impl_.split_min_accesses_)
+      - PROTOBUF_FIELD_OFFSET(MergePolicy, _impl_.enable_)>(
+          reinterpret_cast<char*>(&_impl_.enable_),
+          reinterpret_cast<char*>(&other->_impl_.enable_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RepIfMerged::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata MergePolicy::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
-      file_level_metadata_coordinator_2eproto[15]);
+      file_level_metadata_coordinator_2eproto[31]);
 }
 
 // ===================================================================
@@ -4389,7 +9158,7 @@ void RepStripeIds::InternalSwap(RepStripeIds* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata RepStripeIds::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_coordinator_2eproto_getter, &descriptor_table_coordinator_2eproto_once,
-      file_level_metadata_coordinator_2eproto[16]);
+      file_level_metadata_coordinator_2eproto[32]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -4451,6 +9220,42 @@ template<> PROTOBUF_NOINLINE ::coordinator_proto::RepIfDeling*
 Arena::CreateMaybeMessage< ::coordinator_proto::RepIfDeling >(Arena* arena) {
   return Arena::CreateMessageInternal< ::coordinator_proto::RepIfDeling >(arena);
 }
+template<> PROTOBUF_NOINLINE ::coordinator_proto::RequestProxyIPPorts*
+Arena::CreateMaybeMessage< ::coordinator_proto::RequestProxyIPPorts >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::RequestProxyIPPorts >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::ReplyProxyIPPorts*
+Arena::CreateMaybeMessage< ::coordinator_proto::ReplyProxyIPPorts >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::ReplyProxyIPPorts >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::NodeStatus*
+Arena::CreateMaybeMessage< ::coordinator_proto::NodeStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::NodeStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::NodeStatuses*
+Arena::CreateMaybeMessage< ::coordinator_proto::NodeStatuses >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::NodeStatuses >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::CommitAbortKeys*
+Arena::CreateMaybeMessage< ::coordinator_proto::CommitAbortKeys >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::CommitAbortKeys >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::AskIfSuccessBatch*
+Arena::CreateMaybeMessage< ::coordinator_proto::AskIfSuccessBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::AskIfSuccessBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::KeysAndClientIP*
+Arena::CreateMaybeMessage< ::coordinator_proto::KeysAndClientIP >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::KeysAndClientIP >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::RepIfGetSuccesses*
+Arena::CreateMaybeMessage< ::coordinator_proto::RepIfGetSuccesses >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::RepIfGetSuccesses >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::KeysFromClient*
+Arena::CreateMaybeMessage< ::coordinator_proto::KeysFromClient >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::KeysFromClient >(arena);
+}
 template<> PROTOBUF_NOINLINE ::coordinator_proto::NumberOfStripesToMerge*
 Arena::CreateMaybeMessage< ::coordinator_proto::NumberOfStripesToMerge >(Arena* arena) {
   return Arena::CreateMessageInternal< ::coordinator_proto::NumberOfStripesToMerge >(arena);
@@ -4459,6 +9264,34 @@ template<> PROTOBUF_NOINLINE ::coordinator_proto::RepIfMerged*
 Arena::CreateMaybeMessage< ::coordinator_proto::RepIfMerged >(Arena* arena) {
   return Arena::CreateMessageInternal< ::coordinator_proto::RepIfMerged >(arena);
 }
+template<> PROTOBUF_NOINLINE ::coordinator_proto::MergeJobRequest*
+Arena::CreateMaybeMessage< ::coordinator_proto::MergeJobRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::MergeJobRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::MergePlanRequest*
+Arena::CreateMaybeMessage< ::coordinator_proto::MergePlanRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::MergePlanRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::MergeSchedule*
+Arena::CreateMaybeMessage< ::coordinator_proto::MergeSchedule >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::MergeSchedule >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::AppendMergeRequest*
+Arena::CreateMaybeMessage< ::coordinator_proto::AppendMergeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::AppendMergeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::MergeJobId*
+Arena::CreateMaybeMessage< ::coordinator_proto::MergeJobId >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::MergeJobId >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::MergeJobStatus*
+Arena::CreateMaybeMessage< ::coordinator_proto::MergeJobStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::MergeJobStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::coordinator_proto::MergePolicy*
+Arena::CreateMaybeMessage< ::coordinator_proto::MergePolicy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::coordinator_proto::MergePolicy >(arena);
+}
 template<> PROTOBUF_NOINLINE ::coordinator_proto::RepStripeIds*
 Arena::CreateMaybeMessage< ::coordinator_proto::RepStripeIds >(Arena* arena) {
   return Arena::CreateMessageInternal< ::coordinator_proto::RepStripeIds >(arena);
@@ -45,18 +45,57 @@ struct TableStruct_coordinator_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_coordinator_2eproto;
 namespace coordinator_proto {
+class AppendMergeRequest;
+struct AppendMergeRequestDefaultTypeInternal;
+extern AppendMergeRequestDefaultTypeInternal _AppendMergeRequest_default_instance_;
 class AskIfSuccess;
 struct AskIfSuccessDefaultTypeInternal;
 extern AskIfSuccessDefaultTypeInternal _AskIfSuccess_default_instance_;
+class AskIfSuccessBatch;
+struct AskIfSuccessBatchDefaultTypeInternal;
+extern AskIfSuccessBatchDefaultTypeInternal _AskIfSuccessBatch_default_instance_;
 class CommitAbortKey;
 struct CommitAbortKeyDefaultTypeInternal;
 extern CommitAbortKeyDefaultTypeInternal _CommitAbortKey_default_instance_;
+class CommitAbortKeys;
+struct CommitAbortKeysDefaultTypeInternal;
+extern CommitAbortKeysDefaultTypeInternal _CommitAbortKeys_default_instance_;
 class KeyAndClientIP;
 struct KeyAndClientIPDefaultTypeInternal;
 extern KeyAndClientIPDefaultTypeInternal _KeyAndClientIP_default_instance_;
 class KeyFromClient;
 struct KeyFromClientDefaultTypeInternal;
 extern KeyFromClientDefaultTypeInternal _KeyFromClient_default_instance_;
+class KeysAndClientIP;
+struct KeysAndClientIPDefaultTypeInternal;
+extern KeysAndClientIPDefaultTypeInternal _KeysAndClientIP_default_instance_;
+class KeysFromClient;
+struct KeysFromClientDefaultTypeInternal;
+extern KeysFromClientDefaultTypeInternal _KeysFromClient_default_instance_;
+class MergeJobId;
+struct MergeJobIdDefaultTypeInternal;
+extern MergeJobIdDefaultTypeInternal _MergeJobId_default_instance_;
+class MergeJobRequest;
+struct MergeJobRequestDefaultTypeInternal;
+extern MergeJobRequestDefaultTypeInternal _MergeJobRequest_default_instance_;
+class MergeJobStatus;
+struct MergeJobStatusDefaultTypeInternal;
+extern MergeJobStatusDefaultTypeInternal _MergeJobStatus_default_instance_;
+class MergePlanRequest;
+struct MergePlanRequestDefaultTypeInternal;
+extern MergePlanRequestDefaultTypeInternal _MergePlanRequest_default_instance_;
+class MergePolicy;
+struct MergePolicyDefaultTypeInternal;
+extern MergePolicyDefaultTypeInternal _MergePolicy_default_instance_;
+class MergeSchedule;
+struct MergeScheduleDefaultTypeInternal;
+extern MergeScheduleDefaultTypeInternal _MergeSchedule_default_instance_;
+class NodeStatus;
+struct NodeStatusDefaultTypeInternal;
+extern NodeStatusDefaultTypeInternal _NodeStatus_default_instance_;
+class NodeStatuses;
+struct NodeStatusesDefaultTypeInternal;
+extern NodeStatusesDefaultTypeInternal _NodeStatuses_default_instance_;
 class NumberOfStripesToMerge;
 struct NumberOfStripesToMergeDefaultTypeInternal;
 extern NumberOfStripesToMergeDefaultTypeInternal _NumberOfStripesToMerge_default_instance_;
@@ -69,6 +108,9 @@ extern RepIfDelingDefaultTypeInternal _RepIfDeling_default_instance_;
 class RepIfGetSuccess;
 struct RepIfGetSuccessDefaultTypeInternal;
 extern RepIfGetSuccessDefaultTypeInternal _RepIfGetSuccess_default_instance_;
+class RepIfGetSuccesses;
+struct RepIfGetSuccessesDefaultTypeInternal;
+extern RepIfGetSuccessesDefaultTypeInternal _RepIfGetSuccesses_default_instance_;
 class RepIfMerged;
 struct RepIfMergedDefaultTypeInternal;
 extern RepIfMergedDefaultTypeInternal _RepIfMerged_default_instance_;
@@ -87,9 +129,15 @@ extern ReplyFromCoordinatorDefaultTypeInternal _ReplyFromCoordinator_default_ins
 class ReplyProxyIPPort;
 struct ReplyProxyIPPortDefaultTypeInternal;
 extern ReplyProxyIPPortDefaultTypeInternal _ReplyProxyIPPort_default_instance_;
+class ReplyProxyIPPorts;
+struct ReplyProxyIPPortsDefaultTypeInternal;
+extern ReplyProxyIPPortsDefaultTypeInternal _ReplyProxyIPPorts_default_instance_;
 class RequestProxyIPPort;
 struct RequestProxyIPPortDefaultTypeInternal;
 extern RequestProxyIPPortDefaultTypeInternal _RequestProxyIPPort_default_instance_;
+class RequestProxyIPPorts;
+struct RequestProxyIPPortsDefaultTypeInternal;
+extern RequestProxyIPPortsDefaultTypeInternal _RequestProxyIPPorts_default_instance_;
 class RequestToCoordinator;
 struct RequestToCoordinatorDefaultTypeInternal;
 extern RequestToCoordinatorDefaultTypeInternal _RequestToCoordinator_default_instance_;
@@ -98,21 +146,37 @@ struct StripeIdFromClientDefaultTypeInternal;
 extern StripeIdFromClientDefaultTypeInternal _StripeIdFromClient_default_instance_;
 }  // namespace coordinator_proto
 PROTOBUF_NAMESPACE_OPEN
+template<> ::coordinator_proto::AppendMergeRequest* Arena::CreateMaybeMessage<::coordinator_proto::AppendMergeRequest>(Arena*);
 template<> ::coordinator_proto::AskIfSuccess* Arena::CreateMaybeMessage<::coordinator_proto::AskIfSuccess>(Arena*);
+template<> ::coordinator_proto::AskIfSuccessBatch* Arena::CreateMaybeMessage<::coordinator_proto::AskIfSuccessBatch>(Arena*);
 template<> ::coordinator_proto::CommitAbortKey* Arena::CreateMaybeMessage<::coordinator_proto::CommitAbortKey>(Arena*);
+template<> ::coordinator_proto::CommitAbortKeys* Arena::CreateMaybeMessage<::coordinator_proto::CommitAbortKeys>(Arena*);
 template<> ::coordinator_proto::KeyAndClientIP* Arena::CreateMaybeMessage<::coordinator_proto::KeyAndClientIP>(Arena*);
 template<> ::coordinator_proto::KeyFromClient* Arena::CreateMaybeMessage<::coordinator_proto::KeyFromClient>(Arena*);
+template<> ::coordinator_proto::KeysAndClientIP* Arena::CreateMaybeMessage<::coordinator_proto::KeysAndClientIP>(Arena*);
+template<> ::coordinator_proto::KeysFromClient* Arena::CreateMaybeMessage<::coordinator_proto::KeysFromClient>(Arena*);
+template<> ::coordinator_proto::MergeJobId* Arena::CreateMaybeMessage<::coordinator_proto::MergeJobId>(Arena*);
+template<> ::coordinator_proto::MergeJobRequest* Arena::CreateMaybeMessage<::coordinator_proto::MergeJobRequest>(Arena*);
+template<> ::coordinator_proto::MergeJobStatus* Arena::CreateMaybeMessage<::coordinator_proto::MergeJobStatus>(Arena*);
+template<> ::coordinator_proto::MergePlanRequest* Arena::CreateMaybeMessage<::coordinator_proto::MergePlanRequest>(Arena*);
+template<> ::coordinator_proto::MergePolicy* Arena::CreateMaybeMessage<::coordinator_proto::MergePolicy>(Arena*);
+template<> ::coordinator_proto::MergeSchedule* Arena::CreateMaybeMessage<::coordinator_proto::MergeSchedule>(Arena*);
+template<> ::coordinator_proto::NodeStatus* Arena::CreateMaybeMessage<::coordinator_proto::NodeStatus>(Arena*);
+template<> ::coordinator_proto::NodeStatuses* Arena::CreateMaybeMessage<::coordinator_proto::NodeStatuses>(Arena*);
 template<> ::coordinator_proto::NumberOfStripesToMerge* Arena::CreateMaybeMessage<::coordinator_proto::NumberOfStripesToMerge>(Arena*);
 template<> ::coordinator_proto::Parameter* Arena::CreateMaybeMessage<::coordinator_proto::Parameter>(Arena*);
 template<> ::coordinator_proto::RepIfDeling* Arena::CreateMaybeMessage<::coordinator_proto::RepIfDeling>(Arena*);
 template<> ::coordinator_proto::RepIfGetSuccess* Arena::CreateMaybeMessage<::coordinator_proto::RepIfGetSuccess>(Arena*);
+template<> ::coordinator_proto::RepIfGetSuccesses* Arena::CreateMaybeMessage<::coordinator_proto::RepIfGetSuccesses>(Arena*);
 template<> ::coordinator_proto::RepIfMerged* Arena::CreateMaybeMessage<::coordinator_proto::RepIfMerged>(Arena*);
 template<> ::coordinator_proto::RepIfSetParaSuccess* Arena::CreateMaybeMessage<::coordinator_proto::RepIfSetParaSuccess>(Arena*);
 template<> ::coordinator_proto::RepIfSuccess* Arena::CreateMaybeMessage<::coordinator_proto::RepIfSuccess>(Arena*);
 template<> ::coordinator_proto::RepStripeIds* Arena::CreateMaybeMessage<::coordinator_proto::RepStripeIds>(Arena*);
 template<> ::coordinator_proto::ReplyFromCoordinator* Arena::CreateMaybeMessage<::coordinator_proto::ReplyFromCoordinator>(Arena*);
 template<> ::coordinator_proto::ReplyProxyIPPort* Arena::CreateMaybeMessage<::coordinator_proto::ReplyProxyIPPort>(Arena*);
+template<> ::coordinator_proto::ReplyProxyIPPorts* Arena::CreateMaybeMessage<::coordinator_proto::ReplyProxyIPPorts>(Arena*);
 template<> ::coordinator_proto::RequestProxyIPPort* Arena::CreateMaybeMessage<::coordinator_proto::RequestProxyIPPort>(Arena*);
+template<> ::coordinator_proto::RequestProxyIPPorts* Arena::CreateMaybeMessage<::coordinator_proto::RequestProxyIPPorts>(Arena*);
 template<> ::coordinator_proto::RequestToCoordinator* Arena::CreateMaybeMessage<::coordinator_proto::RequestToCoordinator>(Arena*);
 template<> ::coordinator_proto::StripeIdFromClient* Arena::CreateMaybeMessage<::coordinator_proto::StripeIdFromClient>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -241,25 +305,18 @@ class Parameter final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPartialDecodingFieldNumber = 1,
     kEncodetypeFieldNumber = 2,
     kSStripePlacementtypeFieldNumber = 3,
     kMStripePlacementtypeFieldNumber = 4,
     kKDatablockFieldNumber = 5,
+    kPartialDecodingFieldNumber = 1,
+    kResetFieldNumber = 10,
     kLLocalparityblockFieldNumber = 6,
     kGMGlobalparityblockFieldNumber = 7,
     kBDatapergroupFieldNumber = 8,
     kXStripepermergegroupFieldNumber = 9,
+    kPackBlockSizeFieldNumber = 11,
   };
-  // bool partial_decoding = 1;
-  void clear_partial_decoding();
-  bool partial_decoding() const;
-  void set_partial_decoding(bool value);
-  private:
-  bool _internal_partial_decoding() const;
-  void _internal_set_partial_decoding(bool value);
-  public:
-
   // int32 encodetype = 2;
   void clear_encodetype();
   int32_t encodetype() const;
@@ -296,6 +353,24 @@ class Parameter final :
   void _internal_set_k_datablock(int32_t value);
   public:
 
+  // bool partial_decoding = 1;
+  void clear_partial_decoding();
+  bool partial_decoding() const;
+  void set_partial_decoding(bool value);
+  private:
+  bool _internal_partial_decoding() const;
+  void _internal_set_partial_decoding(bool value);
+  public:
+
+  // bool reset = 10;
+  void clear_reset();
+  bool reset() const;
+  void set_reset(bool value);
+  private:
+  bool _internal_reset() const;
+  void _internal_set_reset(bool value);
+  public:
+
   // int32 l_localparityblock = 6;
   void clear_l_localparityblock();
   int32_t l_localparityblock() const;
@@ -332,6 +407,15 @@ class Parameter final :
   void _internal_set_x_stripepermergegroup(int32_t value);
   public:
 
+  // int32 pack_block_size = 11;
+  void clear_pack_block_size();
+  int32_t pack_block_size() const;
+  void set_pack_block_size(int32_t value);
+  private:
+  int32_t _internal_pack_block_size() const;
+  void _internal_set_pack_block_size(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:coordinator_proto.Parameter)
  private:
   class _Internal;
@@ -340,15 +424,17 @@ class Parameter final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    bool partial_decoding_;
     int32_t encodetype_;
     int32_t s_stripe_placementtype_;
     int32_t m_stripe_placementtype_;
     int32_t k_datablock_;
+    bool partial_decoding_;
+    bool reset_;
     int32_t l_localparityblock_;
     int32_t g_m_globalparityblock_;
     int32_t b_datapergroup_;
     int32_t x_stripepermergegroup_;
+    int32_t pack_block_size_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1771,6 +1857,8 @@ class KeyAndClientIP final :
     kKeyFieldNumber = 1,
     kClientipFieldNumber = 2,
     kClientportFieldNumber = 3,
+    kOffsetFieldNumber = 4,
+    kLengthFieldNumber = 5,
   };
   // string key = 1;
   void clear_key();
@@ -1809,6 +1897,24 @@ class KeyAndClientIP final :
   void _internal_set_clientport(int32_t value);
   public:
 
+  // int32 offset = 4;
+  void clear_offset();
+  int32_t offset() const;
+  void set_offset(int32_t value);
+  private:
+  int32_t _internal_offset() const;
+  void _internal_set_offset(int32_t value);
+  public:
+
+  // int32 length = 5;
+  void clear_length();
+  int32_t length() const;
+  void set_length(int32_t value);
+  private:
+  int32_t _internal_length() const;
+  void _internal_set_length(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:coordinator_proto.KeyAndClientIP)
  private:
   class _Internal;
@@ -1820,6 +1926,8 @@ class KeyAndClientIP final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientip_;
     int32_t clientport_;
+    int32_t offset_;
+    int32_t length_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2435,24 +2543,24 @@ class RepIfDeling final :
 };
 // -------------------------------------------------------------------
 
-class NumberOfStripesToMerge final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.NumberOfStripesToMerge) */ {
+class RequestProxyIPPorts final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.RequestProxyIPPorts) */ {
  public:
-  inline NumberOfStripesToMerge() : NumberOfStripesToMerge(nullptr) {}
-  ~NumberOfStripesToMerge() override;
-  explicit PROTOBUF_CONSTEXPR NumberOfStripesToMerge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline RequestProxyIPPorts() : RequestProxyIPPorts(nullptr) {}
+  ~RequestProxyIPPorts() override;
+  explicit PROTOBUF_CONSTEXPR RequestProxyIPPorts(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  NumberOfStripesToMerge(const NumberOfStripesToMerge& from);
-  NumberOfStripesToMerge(NumberOfStripesToMerge&& from) noexcept
-    : NumberOfStripesToMerge() {
+  RequestProxyIPPorts(const RequestProxyIPPorts& from);
+  RequestProxyIPPorts(RequestProxyIPPorts&& from) noexcept
+    : RequestProxyIPPorts() {
     *this = ::std::move(from);
   }
 
-  inline NumberOfStripesToMerge& operator=(const NumberOfStripesToMerge& from) {
+  inline RequestProxyIPPorts& operator=(const RequestProxyIPPorts& from) {
     CopyFrom(from);
     return *this;
   }
-  inline NumberOfStripesToMerge& operator=(NumberOfStripesToMerge&& from) noexcept {
+  inline RequestProxyIPPorts& operator=(RequestProxyIPPorts&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2475,20 +2583,20 @@ class NumberOfStripesToMerge final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const NumberOfStripesToMerge& default_instance() {
+  static const RequestProxyIPPorts& default_instance() {
     return *internal_default_instance();
   }
-  static inline const NumberOfStripesToMerge* internal_default_instance() {
-    return reinterpret_cast<const NumberOfStripesToMerge*>(
-               &_NumberOfStripesToMerge_default_instance_);
+  static inline const RequestProxyIPPorts* internal_default_instance() {
+    return reinterpret_cast<const RequestProxyIPPorts*>(
+               &_RequestProxyIPPorts_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(NumberOfStripesToMerge& a, NumberOfStripesToMerge& b) {
+  friend void swap(RequestProxyIPPorts& a, RequestProxyIPPorts& b) {
     a.Swap(&b);
   }
-  inline void Swap(NumberOfStripesToMerge* other) {
+  inline void Swap(RequestProxyIPPorts* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2501,7 +2609,7 @@ class NumberOfStripesToMerge final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(NumberOfStripesToMerge* other) {
+  void UnsafeArenaSwap(RequestProxyIPPorts* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2509,14 +2617,14 @@ class NumberOfStripesToMerge final :
 
   // implements Message ----------------------------------------------
 
-  NumberOfStripesToMerge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<NumberOfStripesToMerge>(arena);
+  RequestProxyIPPorts* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestProxyIPPorts>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const NumberOfStripesToMerge& from);
+  void CopyFrom(const RequestProxyIPPorts& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const NumberOfStripesToMerge& from) {
-    NumberOfStripesToMerge::MergeImpl(*this, from);
+  void MergeFrom( const RequestProxyIPPorts& from) {
+    RequestProxyIPPorts::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2534,15 +2642,15 @@ class NumberOfStripesToMerge final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(NumberOfStripesToMerge* other);
+  void InternalSwap(RequestProxyIPPorts* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "coordinator_proto.NumberOfStripesToMerge";
+    return "coordinator_proto.RequestProxyIPPorts";
   }
   protected:
-  explicit NumberOfStripesToMerge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit RequestProxyIPPorts(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2556,18 +2664,27 @@ class NumberOfStripesToMerge final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNumOfStripesFieldNumber = 1,
+    kObjectsFieldNumber = 1,
   };
-  // int32 num_of_stripes = 1;
-  void clear_num_of_stripes();
-  int32_t num_of_stripes() const;
-  void set_num_of_stripes(int32_t value);
+  // repeated .coordinator_proto.RequestProxyIPPort objects = 1;
+  int objects_size() const;
   private:
-  int32_t _internal_num_of_stripes() const;
-  void _internal_set_num_of_stripes(int32_t value);
+  int _internal_objects_size() const;
+  public:
+  void clear_objects();
+  ::coordinator_proto::RequestProxyIPPort* mutable_objects(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::RequestProxyIPPort >*
+      mutable_objects();
+  private:
+  const ::coordinator_proto::RequestProxyIPPort& _internal_objects(int index) const;
+  ::coordinator_proto::RequestProxyIPPort* _internal_add_objects();
   public:
+  const ::coordinator_proto::RequestProxyIPPort& objects(int index) const;
+  ::coordinator_proto::RequestProxyIPPort* add_objects();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::RequestProxyIPPort >&
+      objects() const;
 
-  // @@protoc_insertion_point(class_scope:coordinator_proto.NumberOfStripesToMerge)
+  // @@protoc_insertion_point(class_scope:coordinator_proto.RequestProxyIPPorts)
  private:
   class _Internal;
 
@@ -2575,7 +2692,7 @@ class NumberOfStripesToMerge final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t num_of_stripes_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::RequestProxyIPPort > objects_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2583,24 +2700,24 @@ class NumberOfStripesToMerge final :
 };
 // -------------------------------------------------------------------
 
-class RepIfMerged final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.RepIfMerged) */ {
+class ReplyProxyIPPorts final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.ReplyProxyIPPorts) */ {
  public:
-  inline RepIfMerged() : RepIfMerged(nullptr) {}
-  ~RepIfMerged() override;
-  explicit PROTOBUF_CONSTEXPR RepIfMerged(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ReplyProxyIPPorts() : ReplyProxyIPPorts(nullptr) {}
+  ~ReplyProxyIPPorts() override;
+  explicit PROTOBUF_CONSTEXPR ReplyProxyIPPorts(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RepIfMerged(const RepIfMerged& from);
-  RepIfMerged(RepIfMerged&& from) noexcept
-    : RepIfMerged() {
+  ReplyProxyIPPorts(const ReplyProxyIPPorts& from);
+  ReplyProxyIPPorts(ReplyProxyIPPorts&& from) noexcept
+    : ReplyProxyIPPorts() {
     *this = ::std::move(from);
   }
 
-  inline RepIfMerged& operator=(const RepIfMerged& from) {
+  inline ReplyProxyIPPorts& operator=(const ReplyProxyIPPorts& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RepIfMerged& operator=(RepIfMerged&& from) noexcept {
+  inline ReplyProxyIPPorts& operator=(ReplyProxyIPPorts&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2623,20 +2740,20 @@ class RepIfMerged final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const RepIfMerged& default_instance() {
+  static const ReplyProxyIPPorts& default_instance() {
     return *internal_default_instance();
   }
-  static inline const RepIfMerged* internal_default_instance() {
-    return reinterpret_cast<const RepIfMerged*>(
-               &_RepIfMerged_default_instance_);
+  static inline const ReplyProxyIPPorts* internal_default_instance() {
+    return reinterpret_cast<const ReplyProxyIPPorts*>(
+               &_ReplyProxyIPPorts_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(RepIfMerged& a, RepIfMerged& b) {
+  friend void swap(ReplyProxyIPPorts& a, ReplyProxyIPPorts& b) {
     a.Swap(&b);
   }
-  inline void Swap(RepIfMerged* other) {
+  inline void Swap(ReplyProxyIPPorts* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2649,7 +2766,7 @@ class RepIfMerged final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RepIfMerged* other) {
+  void UnsafeArenaSwap(ReplyProxyIPPorts* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2657,14 +2774,14 @@ class RepIfMerged final :
 
   // implements Message ----------------------------------------------
 
-  RepIfMerged* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<RepIfMerged>(arena);
+  ReplyProxyIPPorts* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplyProxyIPPorts>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const RepIfMerged& from);
+  void CopyFrom(const ReplyProxyIPPorts& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const RepIfMerged& from) {
-    RepIfMerged::MergeImpl(*this, from);
+  void MergeFrom( const ReplyProxyIPPorts& from) {
+    ReplyProxyIPPorts::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2682,15 +2799,15 @@ class RepIfMerged final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RepIfMerged* other);
+  void InternalSwap(ReplyProxyIPPorts* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "coordinator_proto.RepIfMerged";
+    return "coordinator_proto.ReplyProxyIPPorts";
   }
   protected:
-  explicit RepIfMerged(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ReplyProxyIPPorts(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2704,48 +2821,27 @@ class RepIfMerged final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kLcFieldNumber = 2,
-    kGcFieldNumber = 3,
-    kDcFieldNumber = 4,
-    kIfmergedFieldNumber = 1,
+    kProxiesFieldNumber = 1,
   };
-  // double lc = 2;
-  void clear_lc();
-  double lc() const;
-  void set_lc(double value);
-  private:
-  double _internal_lc() const;
-  void _internal_set_lc(double value);
-  public:
-
-  // double gc = 3;
-  void clear_gc();
-  double gc() const;
-  void set_gc(double value);
+  // repeated .coordinator_proto.ReplyProxyIPPort proxies = 1;
+  int proxies_size() const;
   private:
-  double _internal_gc() const;
-  void _internal_set_gc(double value);
-  public:
-
-  // double dc = 4;
-  void clear_dc();
-  double dc() const;
-  void set_dc(double value);
-  private:
-  double _internal_dc() const;
-  void _internal_set_dc(double value);
+  int _internal_proxies_size() const;
   public:
-
-  // bool ifmerged = 1;
-  void clear_ifmerged();
-  bool ifmerged() const;
-  void set_ifmerged(bool value);
+  void clear_proxies();
+  ::coordinator_proto::ReplyProxyIPPort* mutable_proxies(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::ReplyProxyIPPort >*
+      mutable_proxies();
   private:
-  bool _internal_ifmerged() const;
-  void _internal_set_ifmerged(bool value);
+  const ::coordinator_proto::ReplyProxyIPPort& _internal_proxies(int index) const;
+  ::coordinator_proto::ReplyProxyIPPort* _internal_add_proxies();
   public:
+  const ::coordinator_proto::ReplyProxyIPPort& proxies(int index) const;
+  ::coordinator_proto::ReplyProxyIPPort* add_proxies();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::ReplyProxyIPPort >&
+      proxies() const;
 
-  // @@protoc_insertion_point(class_scope:coordinator_proto.RepIfMerged)
+  // @@protoc_insertion_point(class_scope:coordinator_proto.ReplyProxyIPPorts)
  private:
   class _Internal;
 
@@ -2753,10 +2849,7 @@ class RepIfMerged final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    double lc_;
-    double gc_;
-    double dc_;
-    bool ifmerged_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::ReplyProxyIPPort > proxies_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2764,24 +2857,24 @@ class RepIfMerged final :
 };
 // -------------------------------------------------------------------
 
-class RepStripeIds final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.RepStripeIds) */ {
+class NodeStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.NodeStatus) */ {
  public:
-  inline RepStripeIds() : RepStripeIds(nullptr) {}
-  ~RepStripeIds() override;
-  explicit PROTOBUF_CONSTEXPR RepStripeIds(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline NodeStatus() : NodeStatus(nullptr) {}
+  ~NodeStatus() override;
+  explicit PROTOBUF_CONSTEXPR NodeStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RepStripeIds(const RepStripeIds& from);
-  RepStripeIds(RepStripeIds&& from) noexcept
-    : RepStripeIds() {
+  NodeStatus(const NodeStatus& from);
+  NodeStatus(NodeStatus&& from) noexcept
+    : NodeStatus() {
     *this = ::std::move(from);
   }
 
-  inline RepStripeIds& operator=(const RepStripeIds& from) {
+  inline NodeStatus& operator=(const NodeStatus& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RepStripeIds& operator=(RepStripeIds&& from) noexcept {
+  inline NodeStatus& operator=(NodeStatus&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2804,20 +2897,20 @@ class RepStripeIds final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const RepStripeIds& default_instance() {
+  static const NodeStatus& default_instance() {
     return *internal_default_instance();
   }
-  static inline const RepStripeIds* internal_default_instance() {
-    return reinterpret_cast<const RepStripeIds*>(
-               &_RepStripeIds_default_instance_);
+  static inline const NodeStatus* internal_default_instance() {
+    return reinterpret_cast<const NodeStatus*>(
+               &_NodeStatus_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     16;
 
-  friend void swap(RepStripeIds& a, RepStripeIds& b) {
+  friend void swap(NodeStatus& a, NodeStatus& b) {
     a.Swap(&b);
   }
-  inline void Swap(RepStripeIds* other) {
+  inline void Swap(NodeStatus* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2830,7 +2923,7 @@ class RepStripeIds final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RepStripeIds* other) {
+  void UnsafeArenaSwap(NodeStatus* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2838,14 +2931,14 @@ class RepStripeIds final :
 
   // implements Message ----------------------------------------------
 
-  RepStripeIds* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<RepStripeIds>(arena);
+  NodeStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeStatus>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const RepStripeIds& from);
+  void CopyFrom(const NodeStatus& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const RepStripeIds& from) {
-    RepStripeIds::MergeImpl(*this, from);
+  void MergeFrom( const NodeStatus& from) {
+    NodeStatus::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2863,15 +2956,15 @@ class RepStripeIds final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RepStripeIds* other);
+  void InternalSwap(NodeStatus* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "coordinator_proto.RepStripeIds";
+    return "coordinator_proto.NodeStatus";
   }
   protected:
-  explicit RepStripeIds(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit NodeStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2885,31 +2978,63 @@ class RepStripeIds final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kStripeIdsFieldNumber = 1,
+    kNodeIpFieldNumber = 1,
+    kFreeBytesFieldNumber = 3,
+    kNodePortFieldNumber = 2,
+    kBlockNumFieldNumber = 4,
+    kIoBytesPerSecFieldNumber = 5,
   };
-  // repeated int32 stripe_ids = 1;
-  int stripe_ids_size() const;
+  // string node_ip = 1;
+  void clear_node_ip();
+  const std::string& node_ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_ip();
+  PROTOBUF_NODISCARD std::string* release_node_ip();
+  void set_allocated_node_ip(std::string* node_ip);
   private:
-  int _internal_stripe_ids_size() const;
+  const std::string& _internal_node_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_ip(const std::string& value);
+  std::string* _internal_mutable_node_ip();
   public:
-  void clear_stripe_ids();
+
+  // int64 free_bytes = 3;
+  void clear_free_bytes();
+  int64_t free_bytes() const;
+  void set_free_bytes(int64_t value);
   private:
-  int32_t _internal_stripe_ids(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      _internal_stripe_ids() const;
-  void _internal_add_stripe_ids(int32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      _internal_mutable_stripe_ids();
+  int64_t _internal_free_bytes() const;
+  void _internal_set_free_bytes(int64_t value);
   public:
-  int32_t stripe_ids(int index) const;
-  void set_stripe_ids(int index, int32_t value);
-  void add_stripe_ids(int32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      stripe_ids() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      mutable_stripe_ids();
 
-  // @@protoc_insertion_point(class_scope:coordinator_proto.RepStripeIds)
+  // int32 node_port = 2;
+  void clear_node_port();
+  int32_t node_port() const;
+  void set_node_port(int32_t value);
+  private:
+  int32_t _internal_node_port() const;
+  void _internal_set_node_port(int32_t value);
+  public:
+
+  // int32 block_num = 4;
+  void clear_block_num();
+  int32_t block_num() const;
+  void set_block_num(int32_t value);
+  private:
+  int32_t _internal_block_num() const;
+  void _internal_set_block_num(int32_t value);
+  public:
+
+  // int64 io_bytes_per_sec = 5;
+  void clear_io_bytes_per_sec();
+  int64_t io_bytes_per_sec() const;
+  void set_io_bytes_per_sec(int64_t value);
+  private:
+  int64_t _internal_io_bytes_per_sec() const;
+  void _internal_set_io_bytes_per_sec(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.NodeStatus)
  private:
   class _Internal;
 
@@ -2917,1092 +3042,5728 @@ class RepStripeIds final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > stripe_ids_;
-    mutable std::atomic<int> _stripe_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_ip_;
+    int64_t free_bytes_;
+    int32_t node_port_;
+    int32_t block_num_;
+    int64_t io_bytes_per_sec_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_coordinator_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class NodeStatuses final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.NodeStatuses) */ {
+ public:
+  inline NodeStatuses() : NodeStatuses(nullptr) {}
+  ~NodeStatuses() override;
+  explicit PROTOBUF_CONSTEXPR NodeStatuses(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  NodeStatuses(const NodeStatuses& from);
+  NodeStatuses(NodeStatuses&& from) noexcept
+    : NodeStatuses() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Parameter
+  inline NodeStatuses& operator=(const NodeStatuses& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NodeStatuses& operator=(NodeStatuses&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// bool partial_decoding = 1;
-inline void Parameter::clear_partial_decoding() {
-  _impl_.partial_decoding_ = false;
-}
-inline bool Parameter::_internal_partial_decoding() const {
-  return _impl_.partial_decoding_;
-}
-inline bool Parameter::partial_decoding() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.partial_decoding)
-  return _internal_partial_decoding();
-}
-inline void Parameter::_internal_set_partial_decoding(bool value) {
-  
-  _impl_.partial_decoding_ = value;
-}
-inline void Parameter::set_partial_decoding(bool value) {
-  _internal_set_partial_decoding(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.partial_decoding)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeStatuses& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NodeStatuses* internal_default_instance() {
+    return reinterpret_cast<const NodeStatuses*>(
+               &_NodeStatuses_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-// int32 encodetype = 2;
-inline void Parameter::clear_encodetype() {
-  _impl_.encodetype_ = 0;
-}
-inline int32_t Parameter::_internal_encodetype() const {
-  return _impl_.encodetype_;
+  friend void swap(NodeStatuses& a, NodeStatuses& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NodeStatuses* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeStatuses* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NodeStatuses* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeStatuses>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NodeStatuses& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeStatuses& from) {
+    NodeStatuses::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NodeStatuses* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.NodeStatuses";
+  }
+  protected:
+  explicit NodeStatuses(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodesFieldNumber = 1,
+  };
+  // repeated .coordinator_proto.NodeStatus nodes = 1;
+  int nodes_size() const;
+  private:
+  int _internal_nodes_size() const;
+  public:
+  void clear_nodes();
+  ::coordinator_proto::NodeStatus* mutable_nodes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::NodeStatus >*
+      mutable_nodes();
+  private:
+  const ::coordinator_proto::NodeStatus& _internal_nodes(int index) const;
+  ::coordinator_proto::NodeStatus* _internal_add_nodes();
+  public:
+  const ::coordinator_proto::NodeStatus& nodes(int index) const;
+  ::coordinator_proto::NodeStatus* add_nodes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::NodeStatus >&
+      nodes() const;
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.NodeStatuses)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::NodeStatus > nodes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitAbortKeys final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.CommitAbortKeys) */ {
+ public:
+  inline CommitAbortKeys() : CommitAbortKeys(nullptr) {}
+  ~CommitAbortKeys() override;
+  explicit PROTOBUF_CONSTEXPR CommitAbortKeys(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitAbortKeys(const CommitAbortKeys& from);
+  CommitAbortKeys(CommitAbortKeys&& from) noexcept
+    : CommitAbortKeys() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitAbortKeys& operator=(const CommitAbortKeys& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitAbortKeys& operator=(CommitAbortKeys&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitAbortKeys& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitAbortKeys* internal_default_instance() {
+    return reinterpret_cast<const CommitAbortKeys*>(
+               &_CommitAbortKeys_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(CommitAbortKeys& a, CommitAbortKeys& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitAbortKeys* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitAbortKeys* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitAbortKeys* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitAbortKeys>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitAbortKeys& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitAbortKeys& from) {
+    CommitAbortKeys::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitAbortKeys* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.CommitAbortKeys";
+  }
+  protected:
+  explicit CommitAbortKeys(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+  };
+  // repeated .coordinator_proto.CommitAbortKey keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  ::coordinator_proto::CommitAbortKey* mutable_keys(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::CommitAbortKey >*
+      mutable_keys();
+  private:
+  const ::coordinator_proto::CommitAbortKey& _internal_keys(int index) const;
+  ::coordinator_proto::CommitAbortKey* _internal_add_keys();
+  public:
+  const ::coordinator_proto::CommitAbortKey& keys(int index) const;
+  ::coordinator_proto::CommitAbortKey* add_keys();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::CommitAbortKey >&
+      keys() const;
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.CommitAbortKeys)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::CommitAbortKey > keys_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AskIfSuccessBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.AskIfSuccessBatch) */ {
+ public:
+  inline AskIfSuccessBatch() : AskIfSuccessBatch(nullptr) {}
+  ~AskIfSuccessBatch() override;
+  explicit PROTOBUF_CONSTEXPR AskIfSuccessBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AskIfSuccessBatch(const AskIfSuccessBatch& from);
+  AskIfSuccessBatch(AskIfSuccessBatch&& from) noexcept
+    : AskIfSuccessBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline AskIfSuccessBatch& operator=(const AskIfSuccessBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AskIfSuccessBatch& operator=(AskIfSuccessBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AskIfSuccessBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AskIfSuccessBatch* internal_default_instance() {
+    return reinterpret_cast<const AskIfSuccessBatch*>(
+               &_AskIfSuccessBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(AskIfSuccessBatch& a, AskIfSuccessBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AskIfSuccessBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AskIfSuccessBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AskIfSuccessBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AskIfSuccessBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AskIfSuccessBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AskIfSuccessBatch& from) {
+    AskIfSuccessBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AskIfSuccessBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.AskIfSuccessBatch";
+  }
+  protected:
+  explicit AskIfSuccessBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAsksFieldNumber = 1,
+  };
+  // repeated .coordinator_proto.AskIfSuccess asks = 1;
+  int asks_size() const;
+  private:
+  int _internal_asks_size() const;
+  public:
+  void clear_asks();
+  ::coordinator_proto::AskIfSuccess* mutable_asks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::AskIfSuccess >*
+      mutable_asks();
+  private:
+  const ::coordinator_proto::AskIfSuccess& _internal_asks(int index) const;
+  ::coordinator_proto::AskIfSuccess* _internal_add_asks();
+  public:
+  const ::coordinator_proto::AskIfSuccess& asks(int index) const;
+  ::coordinator_proto::AskIfSuccess* add_asks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::AskIfSuccess >&
+      asks() const;
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.AskIfSuccessBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::AskIfSuccess > asks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeysAndClientIP final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.KeysAndClientIP) */ {
+ public:
+  inline KeysAndClientIP() : KeysAndClientIP(nullptr) {}
+  ~KeysAndClientIP() override;
+  explicit PROTOBUF_CONSTEXPR KeysAndClientIP(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeysAndClientIP(const KeysAndClientIP& from);
+  KeysAndClientIP(KeysAndClientIP&& from) noexcept
+    : KeysAndClientIP() {
+    *this = ::std::move(from);
+  }
+
+  inline KeysAndClientIP& operator=(const KeysAndClientIP& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeysAndClientIP& operator=(KeysAndClientIP&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeysAndClientIP& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeysAndClientIP* internal_default_instance() {
+    return reinterpret_cast<const KeysAndClientIP*>(
+               &_KeysAndClientIP_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(KeysAndClientIP& a, KeysAndClientIP& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeysAndClientIP* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeysAndClientIP* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeysAndClientIP* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeysAndClientIP>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeysAndClientIP& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeysAndClientIP& from) {
+    KeysAndClientIP::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeysAndClientIP* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.KeysAndClientIP";
+  }
+  protected:
+  explicit KeysAndClientIP(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+    kClientipFieldNumber = 2,
+    kClientportFieldNumber = 3,
+  };
+  // repeated string keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // string clientip = 2;
+  void clear_clientip();
+  const std::string& clientip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientip();
+  PROTOBUF_NODISCARD std::string* release_clientip();
+  void set_allocated_clientip(std::string* clientip);
+  private:
+  const std::string& _internal_clientip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientip(const std::string& value);
+  std::string* _internal_mutable_clientip();
+  public:
+
+  // int32 clientport = 3;
+  void clear_clientport();
+  int32_t clientport() const;
+  void set_clientport(int32_t value);
+  private:
+  int32_t _internal_clientport() const;
+  void _internal_set_clientport(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.KeysAndClientIP)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientip_;
+    int32_t clientport_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RepIfGetSuccesses final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.RepIfGetSuccesses) */ {
+ public:
+  inline RepIfGetSuccesses() : RepIfGetSuccesses(nullptr) {}
+  ~RepIfGetSuccesses() override;
+  explicit PROTOBUF_CONSTEXPR RepIfGetSuccesses(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RepIfGetSuccesses(const RepIfGetSuccesses& from);
+  RepIfGetSuccesses(RepIfGetSuccesses&& from) noexcept
+    : RepIfGetSuccesses() {
+    *this = ::std::move(from);
+  }
+
+  inline RepIfGetSuccesses& operator=(const RepIfGetSuccesses& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RepIfGetSuccesses& operator=(RepIfGetSuccesses&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RepIfGetSuccesses& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RepIfGetSuccesses* internal_default_instance() {
+    return reinterpret_cast<const RepIfGetSuccesses*>(
+               &_RepIfGetSuccesses_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(RepIfGetSuccesses& a, RepIfGetSuccesses& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RepIfGetSuccesses* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RepIfGetSuccesses* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RepIfGetSuccesses* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RepIfGetSuccesses>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RepIfGetSuccesses& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RepIfGetSuccesses& from) {
+    RepIfGetSuccesses::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RepIfGetSuccesses* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.RepIfGetSuccesses";
+  }
+  protected:
+  explicit RepIfGetSuccesses(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesizebytesFieldNumber = 2,
+    kIfgetsuccessFieldNumber = 1,
+  };
+  // repeated int32 valuesizebytes = 2;
+  int valuesizebytes_size() const;
+  private:
+  int _internal_valuesizebytes_size() const;
+  public:
+  void clear_valuesizebytes();
+  private:
+  int32_t _internal_valuesizebytes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_valuesizebytes() const;
+  void _internal_add_valuesizebytes(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_valuesizebytes();
+  public:
+  int32_t valuesizebytes(int index) const;
+  void set_valuesizebytes(int index, int32_t value);
+  void add_valuesizebytes(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      valuesizebytes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_valuesizebytes();
+
+  // bool ifgetsuccess = 1;
+  void clear_ifgetsuccess();
+  bool ifgetsuccess() const;
+  void set_ifgetsuccess(bool value);
+  private:
+  bool _internal_ifgetsuccess() const;
+  void _internal_set_ifgetsuccess(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.RepIfGetSuccesses)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > valuesizebytes_;
+    mutable std::atomic<int> _valuesizebytes_cached_byte_size_;
+    bool ifgetsuccess_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeysFromClient final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.KeysFromClient) */ {
+ public:
+  inline KeysFromClient() : KeysFromClient(nullptr) {}
+  ~KeysFromClient() override;
+  explicit PROTOBUF_CONSTEXPR KeysFromClient(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeysFromClient(const KeysFromClient& from);
+  KeysFromClient(KeysFromClient&& from) noexcept
+    : KeysFromClient() {
+    *this = ::std::move(from);
+  }
+
+  inline KeysFromClient& operator=(const KeysFromClient& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeysFromClient& operator=(KeysFromClient&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeysFromClient& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeysFromClient* internal_default_instance() {
+    return reinterpret_cast<const KeysFromClient*>(
+               &_KeysFromClient_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(KeysFromClient& a, KeysFromClient& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeysFromClient* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeysFromClient* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeysFromClient* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeysFromClient>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeysFromClient& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeysFromClient& from) {
+    KeysFromClient::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeysFromClient* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.KeysFromClient";
+  }
+  protected:
+  explicit KeysFromClient(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+  };
+  // repeated string keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.KeysFromClient)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NumberOfStripesToMerge final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.NumberOfStripesToMerge) */ {
+ public:
+  inline NumberOfStripesToMerge() : NumberOfStripesToMerge(nullptr) {}
+  ~NumberOfStripesToMerge() override;
+  explicit PROTOBUF_CONSTEXPR NumberOfStripesToMerge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NumberOfStripesToMerge(const NumberOfStripesToMerge& from);
+  NumberOfStripesToMerge(NumberOfStripesToMerge&& from) noexcept
+    : NumberOfStripesToMerge() {
+    *this = ::std::move(from);
+  }
+
+  inline NumberOfStripesToMerge& operator=(const NumberOfStripesToMerge& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NumberOfStripesToMerge& operator=(NumberOfStripesToMerge&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NumberOfStripesToMerge& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NumberOfStripesToMerge* internal_default_instance() {
+    return reinterpret_cast<const NumberOfStripesToMerge*>(
+               &_NumberOfStripesToMerge_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(NumberOfStripesToMerge& a, NumberOfStripesToMerge& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NumberOfStripesToMerge* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NumberOfStripesToMerge* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NumberOfStripesToMerge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NumberOfStripesToMerge>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NumberOfStripesToMerge& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NumberOfStripesToMerge& from) {
+    NumberOfStripesToMerge::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NumberOfStripesToMerge* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.NumberOfStripesToMerge";
+  }
+  protected:
+  explicit NumberOfStripesToMerge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumOfStripesFieldNumber = 1,
+    kMaxConcurrencyFieldNumber = 2,
+    kDryRunFieldNumber = 3,
+  };
+  // int32 num_of_stripes = 1;
+  void clear_num_of_stripes();
+  int32_t num_of_stripes() const;
+  void set_num_of_stripes(int32_t value);
+  private:
+  int32_t _internal_num_of_stripes() const;
+  void _internal_set_num_of_stripes(int32_t value);
+  public:
+
+  // int32 max_concurrency = 2;
+  void clear_max_concurrency();
+  int32_t max_concurrency() const;
+  void set_max_concurrency(int32_t value);
+  private:
+  int32_t _internal_max_concurrency() const;
+  void _internal_set_max_concurrency(int32_t value);
+  public:
+
+  // bool dry_run = 3;
+  void clear_dry_run();
+  bool dry_run() const;
+  void set_dry_run(bool value);
+  private:
+  bool _internal_dry_run() const;
+  void _internal_set_dry_run(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.NumberOfStripesToMerge)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t num_of_stripes_;
+    int32_t max_concurrency_;
+    bool dry_run_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RepIfMerged final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.RepIfMerged) */ {
+ public:
+  inline RepIfMerged() : RepIfMerged(nullptr) {}
+  ~RepIfMerged() override;
+  explicit PROTOBUF_CONSTEXPR RepIfMerged(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RepIfMerged(const RepIfMerged& from);
+  RepIfMerged(RepIfMerged&& from) noexcept
+    : RepIfMerged() {
+    *this = ::std::move(from);
+  }
+
+  inline RepIfMerged& operator=(const RepIfMerged& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RepIfMerged& operator=(RepIfMerged&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RepIfMerged& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RepIfMerged* internal_default_instance() {
+    return reinterpret_cast<const RepIfMerged*>(
+               &_RepIfMerged_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(RepIfMerged& a, RepIfMerged& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RepIfMerged* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RepIfMerged* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RepIfMerged* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RepIfMerged>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RepIfMerged& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RepIfMerged& from) {
+    RepIfMerged::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RepIfMerged* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.RepIfMerged";
+  }
+  protected:
+  explicit RepIfMerged(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLcFieldNumber = 2,
+    kGcFieldNumber = 3,
+    kIfmergedFieldNumber = 1,
+    kGCrossFieldNumber = 5,
+    kDcFieldNumber = 4,
+    kGIntraFieldNumber = 6,
+    kLCrossFieldNumber = 7,
+    kLIntraFieldNumber = 8,
+    kDCrossFieldNumber = 9,
+    kDIntraFieldNumber = 10,
+  };
+  // double lc = 2;
+  void clear_lc();
+  double lc() const;
+  void set_lc(double value);
+  private:
+  double _internal_lc() const;
+  void _internal_set_lc(double value);
+  public:
+
+  // double gc = 3;
+  void clear_gc();
+  double gc() const;
+  void set_gc(double value);
+  private:
+  double _internal_gc() const;
+  void _internal_set_gc(double value);
+  public:
+
+  // bool ifmerged = 1;
+  void clear_ifmerged();
+  bool ifmerged() const;
+  void set_ifmerged(bool value);
+  private:
+  bool _internal_ifmerged() const;
+  void _internal_set_ifmerged(bool value);
+  public:
+
+  // int32 g_cross = 5;
+  void clear_g_cross();
+  int32_t g_cross() const;
+  void set_g_cross(int32_t value);
+  private:
+  int32_t _internal_g_cross() const;
+  void _internal_set_g_cross(int32_t value);
+  public:
+
+  // double dc = 4;
+  void clear_dc();
+  double dc() const;
+  void set_dc(double value);
+  private:
+  double _internal_dc() const;
+  void _internal_set_dc(double value);
+  public:
+
+  // int32 g_intra = 6;
+  void clear_g_intra();
+  int32_t g_intra() const;
+  void set_g_intra(int32_t value);
+  private:
+  int32_t _internal_g_intra() const;
+  void _internal_set_g_intra(int32_t value);
+  public:
+
+  // int32 l_cross = 7;
+  void clear_l_cross();
+  int32_t l_cross() const;
+  void set_l_cross(int32_t value);
+  private:
+  int32_t _internal_l_cross() const;
+  void _internal_set_l_cross(int32_t value);
+  public:
+
+  // int32 l_intra = 8;
+  void clear_l_intra();
+  int32_t l_intra() const;
+  void set_l_intra(int32_t value);
+  private:
+  int32_t _internal_l_intra() const;
+  void _internal_set_l_intra(int32_t value);
+  public:
+
+  // int32 d_cross = 9;
+  void clear_d_cross();
+  int32_t d_cross() const;
+  void set_d_cross(int32_t value);
+  private:
+  int32_t _internal_d_cross() const;
+  void _internal_set_d_cross(int32_t value);
+  public:
+
+  // int32 d_intra = 10;
+  void clear_d_intra();
+  int32_t d_intra() const;
+  void set_d_intra(int32_t value);
+  private:
+  int32_t _internal_d_intra() const;
+  void _internal_set_d_intra(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.RepIfMerged)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double lc_;
+    double gc_;
+    bool ifmerged_;
+    int32_t g_cross_;
+    double dc_;
+    int32_t g_intra_;
+    int32_t l_cross_;
+    int32_t l_intra_;
+    int32_t d_cross_;
+    int32_t d_intra_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MergeJobRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.MergeJobRequest) */ {
+ public:
+  inline MergeJobRequest() : MergeJobRequest(nullptr) {}
+  ~MergeJobRequest() override;
+  explicit PROTOBUF_CONSTEXPR MergeJobRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MergeJobRequest(const MergeJobRequest& from);
+  MergeJobRequest(MergeJobRequest&& from) noexcept
+    : MergeJobRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MergeJobRequest& operator=(const MergeJobRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MergeJobRequest& operator=(MergeJobRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MergeJobRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MergeJobRequest* internal_default_instance() {
+    return reinterpret_cast<const MergeJobRequest*>(
+               &_MergeJobRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(MergeJobRequest& a, MergeJobRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MergeJobRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MergeJobRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MergeJobRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MergeJobRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MergeJobRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MergeJobRequest& from) {
+    MergeJobRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MergeJobRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.MergeJobRequest";
+  }
+  protected:
+  explicit MergeJobRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumOfStripesFieldNumber = 1,
+    kMaxConcurrencyFieldNumber = 2,
+  };
+  // repeated int32 num_of_stripes = 1;
+  int num_of_stripes_size() const;
+  private:
+  int _internal_num_of_stripes_size() const;
+  public:
+  void clear_num_of_stripes();
+  private:
+  int32_t _internal_num_of_stripes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_num_of_stripes() const;
+  void _internal_add_num_of_stripes(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_num_of_stripes();
+  public:
+  int32_t num_of_stripes(int index) const;
+  void set_num_of_stripes(int index, int32_t value);
+  void add_num_of_stripes(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      num_of_stripes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_num_of_stripes();
+
+  // int32 max_concurrency = 2;
+  void clear_max_concurrency();
+  int32_t max_concurrency() const;
+  void set_max_concurrency(int32_t value);
+  private:
+  int32_t _internal_max_concurrency() const;
+  void _internal_set_max_concurrency(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.MergeJobRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > num_of_stripes_;
+    mutable std::atomic<int> _num_of_stripes_cached_byte_size_;
+    int32_t max_concurrency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MergePlanRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.MergePlanRequest) */ {
+ public:
+  inline MergePlanRequest() : MergePlanRequest(nullptr) {}
+  ~MergePlanRequest() override;
+  explicit PROTOBUF_CONSTEXPR MergePlanRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MergePlanRequest(const MergePlanRequest& from);
+  MergePlanRequest(MergePlanRequest&& from) noexcept
+    : MergePlanRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MergePlanRequest& operator=(const MergePlanRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MergePlanRequest& operator=(MergePlanRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MergePlanRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MergePlanRequest* internal_default_instance() {
+    return reinterpret_cast<const MergePlanRequest*>(
+               &_MergePlanRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(MergePlanRequest& a, MergePlanRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MergePlanRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MergePlanRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MergePlanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MergePlanRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MergePlanRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MergePlanRequest& from) {
+    MergePlanRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MergePlanRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.MergePlanRequest";
+  }
+  protected:
+  explicit MergePlanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMergeFactorFieldNumber = 1,
+    kMaxStagesFieldNumber = 2,
+    kExecuteFieldNumber = 3,
+    kMaxConcurrencyFieldNumber = 4,
+  };
+  // int32 merge_factor = 1;
+  void clear_merge_factor();
+  int32_t merge_factor() const;
+  void set_merge_factor(int32_t value);
+  private:
+  int32_t _internal_merge_factor() const;
+  void _internal_set_merge_factor(int32_t value);
+  public:
+
+  // int32 max_stages = 2;
+  void clear_max_stages();
+  int32_t max_stages() const;
+  void set_max_stages(int32_t value);
+  private:
+  int32_t _internal_max_stages() const;
+  void _internal_set_max_stages(int32_t value);
+  public:
+
+  // bool execute = 3;
+  void clear_execute();
+  bool execute() const;
+  void set_execute(bool value);
+  private:
+  bool _internal_execute() const;
+  void _internal_set_execute(bool value);
+  public:
+
+  // int32 max_concurrency = 4;
+  void clear_max_concurrency();
+  int32_t max_concurrency() const;
+  void set_max_concurrency(int32_t value);
+  private:
+  int32_t _internal_max_concurrency() const;
+  void _internal_set_max_concurrency(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.MergePlanRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t merge_factor_;
+    int32_t max_stages_;
+    bool execute_;
+    int32_t max_concurrency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MergeSchedule final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.MergeSchedule) */ {
+ public:
+  inline MergeSchedule() : MergeSchedule(nullptr) {}
+  ~MergeSchedule() override;
+  explicit PROTOBUF_CONSTEXPR MergeSchedule(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MergeSchedule(const MergeSchedule& from);
+  MergeSchedule(MergeSchedule&& from) noexcept
+    : MergeSchedule() {
+    *this = ::std::move(from);
+  }
+
+  inline MergeSchedule& operator=(const MergeSchedule& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MergeSchedule& operator=(MergeSchedule&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MergeSchedule& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MergeSchedule* internal_default_instance() {
+    return reinterpret_cast<const MergeSchedule*>(
+               &_MergeSchedule_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(MergeSchedule& a, MergeSchedule& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MergeSchedule* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MergeSchedule* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MergeSchedule* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MergeSchedule>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MergeSchedule& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MergeSchedule& from) {
+    MergeSchedule::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MergeSchedule* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.MergeSchedule";
+  }
+  protected:
+  explicit MergeSchedule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumOfStripesFieldNumber = 2,
+    kIfplannedFieldNumber = 1,
+    kCrossBlocksFieldNumber = 3,
+    kIntraBlocksFieldNumber = 4,
+    kJobIdFieldNumber = 5,
+  };
+  // repeated int32 num_of_stripes = 2;
+  int num_of_stripes_size() const;
+  private:
+  int _internal_num_of_stripes_size() const;
+  public:
+  void clear_num_of_stripes();
+  private:
+  int32_t _internal_num_of_stripes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_num_of_stripes() const;
+  void _internal_add_num_of_stripes(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_num_of_stripes();
+  public:
+  int32_t num_of_stripes(int index) const;
+  void set_num_of_stripes(int index, int32_t value);
+  void add_num_of_stripes(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      num_of_stripes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_num_of_stripes();
+
+  // bool ifplanned = 1;
+  void clear_ifplanned();
+  bool ifplanned() const;
+  void set_ifplanned(bool value);
+  private:
+  bool _internal_ifplanned() const;
+  void _internal_set_ifplanned(bool value);
+  public:
+
+  // int32 cross_blocks = 3;
+  void clear_cross_blocks();
+  int32_t cross_blocks() const;
+  void set_cross_blocks(int32_t value);
+  private:
+  int32_t _internal_cross_blocks() const;
+  void _internal_set_cross_blocks(int32_t value);
+  public:
+
+  // int32 intra_blocks = 4;
+  void clear_intra_blocks();
+  int32_t intra_blocks() const;
+  void set_intra_blocks(int32_t value);
+  private:
+  int32_t _internal_intra_blocks() const;
+  void _internal_set_intra_blocks(int32_t value);
+  public:
+
+  // int32 job_id = 5;
+  void clear_job_id();
+  int32_t job_id() const;
+  void set_job_id(int32_t value);
+  private:
+  int32_t _internal_job_id() const;
+  void _internal_set_job_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.MergeSchedule)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > num_of_stripes_;
+    mutable std::atomic<int> _num_of_stripes_cached_byte_size_;
+    bool ifplanned_;
+    int32_t cross_blocks_;
+    int32_t intra_blocks_;
+    int32_t job_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppendMergeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.AppendMergeRequest) */ {
+ public:
+  inline AppendMergeRequest() : AppendMergeRequest(nullptr) {}
+  ~AppendMergeRequest() override;
+  explicit PROTOBUF_CONSTEXPR AppendMergeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AppendMergeRequest(const AppendMergeRequest& from);
+  AppendMergeRequest(AppendMergeRequest&& from) noexcept
+    : AppendMergeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline AppendMergeRequest& operator=(const AppendMergeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppendMergeRequest& operator=(AppendMergeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendMergeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppendMergeRequest* internal_default_instance() {
+    return reinterpret_cast<const AppendMergeRequest*>(
+               &_AppendMergeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(AppendMergeRequest& a, AppendMergeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppendMergeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppendMergeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AppendMergeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppendMergeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AppendMergeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendMergeRequest& from) {
+    AppendMergeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppendMergeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.AppendMergeRequest";
+  }
+  protected:
+  explicit AppendMergeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStripeIdFieldNumber = 1,
+    kWideStripeIdFieldNumber = 2,
+  };
+  // int32 stripe_id = 1;
+  void clear_stripe_id();
+  int32_t stripe_id() const;
+  void set_stripe_id(int32_t value);
+  private:
+  int32_t _internal_stripe_id() const;
+  void _internal_set_stripe_id(int32_t value);
+  public:
+
+  // int32 wide_stripe_id = 2;
+  void clear_wide_stripe_id();
+  int32_t wide_stripe_id() const;
+  void set_wide_stripe_id(int32_t value);
+  private:
+  int32_t _internal_wide_stripe_id() const;
+  void _internal_set_wide_stripe_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.AppendMergeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t stripe_id_;
+    int32_t wide_stripe_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MergeJobId final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.MergeJobId) */ {
+ public:
+  inline MergeJobId() : MergeJobId(nullptr) {}
+  ~MergeJobId() override;
+  explicit PROTOBUF_CONSTEXPR MergeJobId(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MergeJobId(const MergeJobId& from);
+  MergeJobId(MergeJobId&& from) noexcept
+    : MergeJobId() {
+    *this = ::std::move(from);
+  }
+
+  inline MergeJobId& operator=(const MergeJobId& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MergeJobId& operator=(MergeJobId&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MergeJobId& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MergeJobId* internal_default_instance() {
+    return reinterpret_cast<const MergeJobId*>(
+               &_MergeJobId_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(MergeJobId& a, MergeJobId& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MergeJobId* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MergeJobId* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MergeJobId* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MergeJobId>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MergeJobId& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MergeJobId& from) {
+    MergeJobId::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MergeJobId* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.MergeJobId";
+  }
+  protected:
+  explicit MergeJobId(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kJobIdFieldNumber = 1,
+  };
+  // int32 job_id = 1;
+  void clear_job_id();
+  int32_t job_id() const;
+  void set_job_id(int32_t value);
+  private:
+  int32_t _internal_job_id() const;
+  void _internal_set_job_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.MergeJobId)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t job_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MergeJobStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.MergeJobStatus) */ {
+ public:
+  inline MergeJobStatus() : MergeJobStatus(nullptr) {}
+  ~MergeJobStatus() override;
+  explicit PROTOBUF_CONSTEXPR MergeJobStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MergeJobStatus(const MergeJobStatus& from);
+  MergeJobStatus(MergeJobStatus&& from) noexcept
+    : MergeJobStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline MergeJobStatus& operator=(const MergeJobStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MergeJobStatus& operator=(MergeJobStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MergeJobStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MergeJobStatus* internal_default_instance() {
+    return reinterpret_cast<const MergeJobStatus*>(
+               &_MergeJobStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(MergeJobStatus& a, MergeJobStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MergeJobStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MergeJobStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MergeJobStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MergeJobStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MergeJobStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MergeJobStatus& from) {
+    MergeJobStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MergeJobStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.MergeJobStatus";
+  }
+  protected:
+  explicit MergeJobStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kJobIdFieldNumber = 1,
+    kStateFieldNumber = 2,
+    kStagesDoneFieldNumber = 3,
+    kStagesTotalFieldNumber = 4,
+    kStripesMergedFieldNumber = 5,
+    kStripesTotalFieldNumber = 6,
+    kGBytesFieldNumber = 7,
+    kLBytesFieldNumber = 8,
+    kDBytesFieldNumber = 9,
+    kLcFieldNumber = 10,
+    kGcFieldNumber = 11,
+    kDcFieldNumber = 12,
+  };
+  // int32 job_id = 1;
+  void clear_job_id();
+  int32_t job_id() const;
+  void set_job_id(int32_t value);
+  private:
+  int32_t _internal_job_id() const;
+  void _internal_set_job_id(int32_t value);
+  public:
+
+  // int32 state = 2;
+  void clear_state();
+  int32_t state() const;
+  void set_state(int32_t value);
+  private:
+  int32_t _internal_state() const;
+  void _internal_set_state(int32_t value);
+  public:
+
+  // int32 stages_done = 3;
+  void clear_stages_done();
+  int32_t stages_done() const;
+  void set_stages_done(int32_t value);
+  private:
+  int32_t _internal_stages_done() const;
+  void _internal_set_stages_done(int32_t value);
+  public:
+
+  // int32 stages_total = 4;
+  void clear_stages_total();
+  int32_t stages_total() const;
+  void set_stages_total(int32_t value);
+  private:
+  int32_t _internal_stages_total() const;
+  void _internal_set_stages_total(int32_t value);
+  public:
+
+  // int32 stripes_merged = 5;
+  void clear_stripes_merged();
+  int32_t stripes_merged() const;
+  void set_stripes_merged(int32_t value);
+  private:
+  int32_t _internal_stripes_merged() const;
+  void _internal_set_stripes_merged(int32_t value);
+  public:
+
+  // int32 stripes_total = 6;
+  void clear_stripes_total();
+  int32_t stripes_total() const;
+  void set_stripes_total(int32_t value);
+  private:
+  int32_t _internal_stripes_total() const;
+  void _internal_set_stripes_total(int32_t value);
+  public:
+
+  // int64 g_bytes = 7;
+  void clear_g_bytes();
+  int64_t g_bytes() const;
+  void set_g_bytes(int64_t value);
+  private:
+  int64_t _internal_g_bytes() const;
+  void _internal_set_g_bytes(int64_t value);
+  public:
+
+  // int64 l_bytes = 8;
+  void clear_l_bytes();
+  int64_t l_bytes() const;
+  void set_l_bytes(int64_t value);
+  private:
+  int64_t _internal_l_bytes() const;
+  void _internal_set_l_bytes(int64_t value);
+  public:
+
+  // int64 d_bytes = 9;
+  void clear_d_bytes();
+  int64_t d_bytes() const;
+  void set_d_bytes(int64_t value);
+  private:
+  int64_t _internal_d_bytes() const;
+  void _internal_set_d_bytes(int64_t value);
+  public:
+
+  // double lc = 10;
+  void clear_lc();
+  double lc() const;
+  void set_lc(double value);
+  private:
+  double _internal_lc() const;
+  void _internal_set_lc(double value);
+  public:
+
+  // double gc = 11;
+  void clear_gc();
+  double gc() const;
+  void set_gc(double value);
+  private:
+  double _internal_gc() const;
+  void _internal_set_gc(double value);
+  public:
+
+  // double dc = 12;
+  void clear_dc();
+  double dc() const;
+  void set_dc(double value);
+  private:
+  double _internal_dc() const;
+  void _internal_set_dc(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.MergeJobStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t job_id_;
+    int32_t state_;
+    int32_t stages_done_;
+    int32_t stages_total_;
+    int32_t stripes_merged_;
+    int32_t stripes_total_;
+    int64_t g_bytes_;
+    int64_t l_bytes_;
+    int64_t d_bytes_;
+    double lc_;
+    double gc_;
+    double dc_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MergePolicy final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.MergePolicy) */ {
+ public:
+  inline MergePolicy() : MergePolicy(nullptr) {}
+  ~MergePolicy() override;
+  explicit PROTOBUF_CONSTEXPR MergePolicy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MergePolicy(const MergePolicy& from);
+  MergePolicy(MergePolicy&& from) noexcept
+    : MergePolicy() {
+    *this = ::std::move(from);
+  }
+
+  inline MergePolicy& operator=(const MergePolicy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MergePolicy& operator=(MergePolicy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MergePolicy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MergePolicy* internal_default_instance() {
+    return reinterpret_cast<const MergePolicy*>(
+               &_MergePolicy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(MergePolicy& a, MergePolicy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MergePolicy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MergePolicy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MergePolicy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MergePolicy>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MergePolicy& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MergePolicy& from) {
+    MergePolicy::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MergePolicy* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.MergePolicy";
+  }
+  protected:
+  explicit MergePolicy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumOfStripesFieldNumber = 2,
+    kEnableFieldNumber = 1,
+    kMinStripesPerGroupFieldNumber = 3,
+    kBandwidthFieldNumber = 5,
+    kMaxOpsPerSecFieldNumber = 4,
+    kCheckIntervalMsFieldNumber = 6,
+    kMaxConcurrencyFieldNumber = 7,
+    kSplitMinAccessesFieldNumber = 8,
+  };
+  // repeated int32 num_of_stripes = 2;
+  int num_of_stripes_size() const;
+  private:
+  int _internal_num_of_stripes_size() const;
+  public:
+  void clear_num_of_stripes();
+  private:
+  int32_t _internal_num_of_stripes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_num_of_stripes() const;
+  void _internal_add_num_of_stripes(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_num_of_stripes();
+  public:
+  int32_t num_of_stripes(int index) const;
+  void set_num_of_stripes(int index, int32_t value);
+  void add_num_of_stripes(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      num_of_stripes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_num_of_stripes();
+
+  // bool enable = 1;
+  void clear_enable();
+  bool enable() const;
+  void set_enable(bool value);
+  private:
+  bool _internal_enable() const;
+  void _internal_set_enable(bool value);
+  public:
+
+  // int32 min_stripes_per_group = 3;
+  void clear_min_stripes_per_group();
+  int32_t min_stripes_per_group() const;
+  void set_min_stripes_per_group(int32_t value);
+  private:
+  int32_t _internal_min_stripes_per_group() const;
+  void _internal_set_min_stripes_per_group(int32_t value);
+  public:
+
+  // int64 bandwidth = 5;
+  void clear_bandwidth();
+  int64_t bandwidth() const;
+  void set_bandwidth(int64_t value);
+  private:
+  int64_t _internal_bandwidth() const;
+  void _internal_set_bandwidth(int64_t value);
+  public:
+
+  // int32 max_ops_per_sec = 4;
+  void clear_max_ops_per_sec();
+  int32_t max_ops_per_sec() const;
+  void set_max_ops_per_sec(int32_t value);
+  private:
+  int32_t _internal_max_ops_per_sec() const;
+  void _internal_set_max_ops_per_sec(int32_t value);
+  public:
+
+  // int32 check_interval_ms = 6;
+  void clear_check_interval_ms();
+  int32_t check_interval_ms() const;
+  void set_check_interval_ms(int32_t value);
+  private:
+  int32_t _internal_check_interval_ms() const;
+  void _internal_set_check_interval_ms(int32_t value);
+  public:
+
+  // int32 max_concurrency = 7;
+  void clear_max_concurrency();
+  int32_t max_concurrency() const;
+  void set_max_concurrency(int32_t value);
+  private:
+  int32_t _internal_max_concurrency() const;
+  void _internal_set_max_concurrency(int32_t value);
+  public:
+
+  // int32 split_min_accesses = 8;
+  void clear_split_min_accesses();
+  int32_t split_min_accesses() const;
+  void set_split_min_accesses(int32_t value);
+  private:
+  int32_t _internal_split_min_accesses() const;
+  void _internal_set_split_min_accesses(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.MergePolicy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > num_of_stripes_;
+    mutable std::atomic<int> _num_of_stripes_cached_byte_size_;
+    bool enable_;
+    int32_t min_stripes_per_group_;
+    int64_t bandwidth_;
+    int32_t max_ops_per_sec_;
+    int32_t check_interval_ms_;
+    int32_t max_concurrency_;
+    int32_t split_min_accesses_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RepStripeIds final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:coordinator_proto.RepStripeIds) */ {
+ public:
+  inline RepStripeIds() : RepStripeIds(nullptr) {}
+  ~RepStripeIds() override;
+  explicit PROTOBUF_CONSTEXPR RepStripeIds(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RepStripeIds(const RepStripeIds& from);
+  RepStripeIds(RepStripeIds&& from) noexcept
+    : RepStripeIds() {
+    *this = ::std::move(from);
+  }
+
+  inline RepStripeIds& operator=(const RepStripeIds& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RepStripeIds& operator=(RepStripeIds&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RepStripeIds& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RepStripeIds* internal_default_instance() {
+    return reinterpret_cast<const RepStripeIds*>(
+               &_RepStripeIds_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(RepStripeIds& a, RepStripeIds& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RepStripeIds* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RepStripeIds* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RepStripeIds* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RepStripeIds>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RepStripeIds& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RepStripeIds& from) {
+    RepStripeIds::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RepStripeIds* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "coordinator_proto.RepStripeIds";
+  }
+  protected:
+  explicit RepStripeIds(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStripeIdsFieldNumber = 1,
+  };
+  // repeated int32 stripe_ids = 1;
+  int stripe_ids_size() const;
+  private:
+  int _internal_stripe_ids_size() const;
+  public:
+  void clear_stripe_ids();
+  private:
+  int32_t _internal_stripe_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_stripe_ids() const;
+  void _internal_add_stripe_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_stripe_ids();
+  public:
+  int32_t stripe_ids(int index) const;
+  void set_stripe_ids(int index, int32_t value);
+  void add_stripe_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      stripe_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_stripe_ids();
+
+  // @@protoc_insertion_point(class_scope:coordinator_proto.RepStripeIds)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > stripe_ids_;
+    mutable std::atomic<int> _stripe_ids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_coordinator_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Parameter
+
+// bool partial_decoding = 1;
+inline void Parameter::clear_partial_decoding() {
+  _impl_.partial_decoding_ = false;
+}
+inline bool Parameter::_internal_partial_decoding() const {
+  return _impl_.partial_decoding_;
+}
+inline bool Parameter::partial_decoding() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.partial_decoding)
+  return _internal_partial_decoding();
+}
+inline void Parameter::_internal_set_partial_decoding(bool value) {
+  
+  _impl_.partial_decoding_ = value;
+}
+inline void Parameter::set_partial_decoding(bool value) {
+  _internal_set_partial_decoding(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.partial_decoding)
+}
+
+// int32 encodetype = 2;
+inline void Parameter::clear_encodetype() {
+  _impl_.encodetype_ = 0;
+}
+inline int32_t Parameter::_internal_encodetype() const {
+  return _impl_.encodetype_;
+}
+inline int32_t Parameter::encodetype() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.encodetype)
+  return _internal_encodetype();
+}
+inline void Parameter::_internal_set_encodetype(int32_t value) {
+  
+  _impl_.encodetype_ = value;
+}
+inline void Parameter::set_encodetype(int32_t value) {
+  _internal_set_encodetype(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.encodetype)
+}
+
+// int32 s_stripe_placementtype = 3;
+inline void Parameter::clear_s_stripe_placementtype() {
+  _impl_.s_stripe_placementtype_ = 0;
+}
+inline int32_t Parameter::_internal_s_stripe_placementtype() const {
+  return _impl_.s_stripe_placementtype_;
+}
+inline int32_t Parameter::s_stripe_placementtype() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.s_stripe_placementtype)
+  return _internal_s_stripe_placementtype();
+}
+inline void Parameter::_internal_set_s_stripe_placementtype(int32_t value) {
+  
+  _impl_.s_stripe_placementtype_ = value;
+}
+inline void Parameter::set_s_stripe_placementtype(int32_t value) {
+  _internal_set_s_stripe_placementtype(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.s_stripe_placementtype)
+}
+
+// int32 m_stripe_placementtype = 4;
+inline void Parameter::clear_m_stripe_placementtype() {
+  _impl_.m_stripe_placementtype_ = 0;
+}
+inline int32_t Parameter::_internal_m_stripe_placementtype() const {
+  return _impl_.m_stripe_placementtype_;
+}
+inline int32_t Parameter::m_stripe_placementtype() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.m_stripe_placementtype)
+  return _internal_m_stripe_placementtype();
+}
+inline void Parameter::_internal_set_m_stripe_placementtype(int32_t value) {
+  
+  _impl_.m_stripe_placementtype_ = value;
+}
+inline void Parameter::set_m_stripe_placementtype(int32_t value) {
+  _internal_set_m_stripe_placementtype(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.m_stripe_placementtype)
+}
+
+// int32 k_datablock = 5;
+inline void Parameter::clear_k_datablock() {
+  _impl_.k_datablock_ = 0;
+}
+inline int32_t Parameter::_internal_k_datablock() const {
+  return _impl_.k_datablock_;
+}
+inline int32_t Parameter::k_datablock() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.k_datablock)
+  return _internal_k_datablock();
+}
+inline void Parameter::_internal_set_k_datablock(int32_t value) {
+  
+  _impl_.k_datablock_ = value;
+}
+inline void Parameter::set_k_datablock(int32_t value) {
+  _internal_set_k_datablock(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.k_datablock)
+}
+
+// int32 l_localparityblock = 6;
+inline void Parameter::clear_l_localparityblock() {
+  _impl_.l_localparityblock_ = 0;
+}
+inline int32_t Parameter::_internal_l_localparityblock() const {
+  return _impl_.l_localparityblock_;
+}
+inline int32_t Parameter::l_localparityblock() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.l_localparityblock)
+  return _internal_l_localparityblock();
+}
+inline void Parameter::_internal_set_l_localparityblock(int32_t value) {
+  
+  _impl_.l_localparityblock_ = value;
+}
+inline void Parameter::set_l_localparityblock(int32_t value) {
+  _internal_set_l_localparityblock(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.l_localparityblock)
+}
+
+// int32 g_m_globalparityblock = 7;
+inline void Parameter::clear_g_m_globalparityblock() {
+  _impl_.g_m_globalparityblock_ = 0;
+}
+inline int32_t Parameter::_internal_g_m_globalparityblock() const {
+  return _impl_.g_m_globalparityblock_;
+}
+inline int32_t Parameter::g_m_globalparityblock() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.g_m_globalparityblock)
+  return _internal_g_m_globalparityblock();
+}
+inline void Parameter::_internal_set_g_m_globalparityblock(int32_t value) {
+  
+  _impl_.g_m_globalparityblock_ = value;
+}
+inline void Parameter::set_g_m_globalparityblock(int32_t value) {
+  _internal_set_g_m_globalparityblock(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.g_m_globalparityblock)
+}
+
+// int32 b_datapergroup = 8;
+inline void Parameter::clear_b_datapergroup() {
+  _impl_.b_datapergroup_ = 0;
+}
+inline int32_t Parameter::_internal_b_datapergroup() const {
+  return _impl_.b_datapergroup_;
+}
+inline int32_t Parameter::b_datapergroup() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.b_datapergroup)
+  return _internal_b_datapergroup();
+}
+inline void Parameter::_internal_set_b_datapergroup(int32_t value) {
+  
+  _impl_.b_datapergroup_ = value;
+}
+inline void Parameter::set_b_datapergroup(int32_t value) {
+  _internal_set_b_datapergroup(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.b_datapergroup)
+}
+
+// int32 x_stripepermergegroup = 9;
+inline void Parameter::clear_x_stripepermergegroup() {
+  _impl_.x_stripepermergegroup_ = 0;
+}
+inline int32_t Parameter::_internal_x_stripepermergegroup() const {
+  return _impl_.x_stripepermergegroup_;
+}
+inline int32_t Parameter::x_stripepermergegroup() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.x_stripepermergegroup)
+  return _internal_x_stripepermergegroup();
+}
+inline void Parameter::_internal_set_x_stripepermergegroup(int32_t value) {
+  
+  _impl_.x_stripepermergegroup_ = value;
+}
+inline void Parameter::set_x_stripepermergegroup(int32_t value) {
+  _internal_set_x_stripepermergegroup(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.x_stripepermergegroup)
+}
+
+// bool reset = 10;
+inline void Parameter::clear_reset() {
+  _impl_.reset_ = false;
+}
+inline bool Parameter::_internal_reset() const {
+  return _impl_.reset_;
+}
+inline bool Parameter::reset() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.reset)
+  return _internal_reset();
+}
+inline void Parameter::_internal_set_reset(bool value) {
+  
+  _impl_.reset_ = value;
+}
+inline void Parameter::set_reset(bool value) {
+  _internal_set_reset(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.reset)
+}
+
+// int32 pack_block_size = 11;
+inline void Parameter::clear_pack_block_size() {
+  _impl_.pack_block_size_ = 0;
+}
+inline int32_t Parameter::_internal_pack_block_size() const {
+  return _impl_.pack_block_size_;
+}
+inline int32_t Parameter::pack_block_size() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.pack_block_size)
+  return _internal_pack_block_size();
+}
+inline void Parameter::_internal_set_pack_block_size(int32_t value) {
+  
+  _impl_.pack_block_size_ = value;
+}
+inline void Parameter::set_pack_block_size(int32_t value) {
+  _internal_set_pack_block_size(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.pack_block_size)
+}
+
+// -------------------------------------------------------------------
+
+// RepIfSetParaSuccess
+
+// bool ifsetparameter = 1;
+inline void RepIfSetParaSuccess::clear_ifsetparameter() {
+  _impl_.ifsetparameter_ = false;
+}
+inline bool RepIfSetParaSuccess::_internal_ifsetparameter() const {
+  return _impl_.ifsetparameter_;
+}
+inline bool RepIfSetParaSuccess::ifsetparameter() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfSetParaSuccess.ifsetparameter)
+  return _internal_ifsetparameter();
+}
+inline void RepIfSetParaSuccess::_internal_set_ifsetparameter(bool value) {
+  
+  _impl_.ifsetparameter_ = value;
+}
+inline void RepIfSetParaSuccess::set_ifsetparameter(bool value) {
+  _internal_set_ifsetparameter(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfSetParaSuccess.ifsetparameter)
+}
+
+// -------------------------------------------------------------------
+
+// RequestToCoordinator
+
+// string name = 1;
+inline void RequestToCoordinator::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RequestToCoordinator::name() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RequestToCoordinator.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RequestToCoordinator::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.RequestToCoordinator.name)
+}
+inline std::string* RequestToCoordinator::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.RequestToCoordinator.name)
+  return _s;
+}
+inline const std::string& RequestToCoordinator::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void RequestToCoordinator::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RequestToCoordinator::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RequestToCoordinator::release_name() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.RequestToCoordinator.name)
+  return _impl_.name_.Release();
+}
+inline void RequestToCoordinator::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.RequestToCoordinator.name)
+}
+
+// -------------------------------------------------------------------
+
+// ReplyFromCoordinator
+
+// string message = 1;
+inline void ReplyFromCoordinator::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& ReplyFromCoordinator::message() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.ReplyFromCoordinator.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyFromCoordinator::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.ReplyFromCoordinator.message)
+}
+inline std::string* ReplyFromCoordinator::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.ReplyFromCoordinator.message)
+  return _s;
+}
+inline const std::string& ReplyFromCoordinator::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void ReplyFromCoordinator::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyFromCoordinator::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyFromCoordinator::release_message() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.ReplyFromCoordinator.message)
+  return _impl_.message_.Release();
+}
+inline void ReplyFromCoordinator::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.ReplyFromCoordinator.message)
+}
+
+// -------------------------------------------------------------------
+
+// RequestProxyIPPort
+
+// string key = 1;
+inline void RequestProxyIPPort::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& RequestProxyIPPort::key() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RequestProxyIPPort.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RequestProxyIPPort::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.RequestProxyIPPort.key)
+}
+inline std::string* RequestProxyIPPort::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.RequestProxyIPPort.key)
+  return _s;
+}
+inline const std::string& RequestProxyIPPort::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void RequestProxyIPPort::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RequestProxyIPPort::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RequestProxyIPPort::release_key() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.RequestProxyIPPort.key)
+  return _impl_.key_.Release();
+}
+inline void RequestProxyIPPort::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.RequestProxyIPPort.key)
+}
+
+// int32 valuesizebytes = 2;
+inline void RequestProxyIPPort::clear_valuesizebytes() {
+  _impl_.valuesizebytes_ = 0;
+}
+inline int32_t RequestProxyIPPort::_internal_valuesizebytes() const {
+  return _impl_.valuesizebytes_;
+}
+inline int32_t RequestProxyIPPort::valuesizebytes() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RequestProxyIPPort.valuesizebytes)
+  return _internal_valuesizebytes();
+}
+inline void RequestProxyIPPort::_internal_set_valuesizebytes(int32_t value) {
+  
+  _impl_.valuesizebytes_ = value;
+}
+inline void RequestProxyIPPort::set_valuesizebytes(int32_t value) {
+  _internal_set_valuesizebytes(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RequestProxyIPPort.valuesizebytes)
+}
+
+// -------------------------------------------------------------------
+
+// ReplyProxyIPPort
+
+// string proxyip = 1;
+inline void ReplyProxyIPPort::clear_proxyip() {
+  _impl_.proxyip_.ClearToEmpty();
+}
+inline const std::string& ReplyProxyIPPort::proxyip() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.ReplyProxyIPPort.proxyip)
+  return _internal_proxyip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplyProxyIPPort::set_proxyip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.proxyip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.ReplyProxyIPPort.proxyip)
+}
+inline std::string* ReplyProxyIPPort::mutable_proxyip() {
+  std::string* _s = _internal_mutable_proxyip();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.ReplyProxyIPPort.proxyip)
+  return _s;
+}
+inline const std::string& ReplyProxyIPPort::_internal_proxyip() const {
+  return _impl_.proxyip_.Get();
+}
+inline void ReplyProxyIPPort::_internal_set_proxyip(const std::string& value) {
+  
+  _impl_.proxyip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplyProxyIPPort::_internal_mutable_proxyip() {
+  
+  return _impl_.proxyip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplyProxyIPPort::release_proxyip() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.ReplyProxyIPPort.proxyip)
+  return _impl_.proxyip_.Release();
+}
+inline void ReplyProxyIPPort::set_allocated_proxyip(std::string* proxyip) {
+  if (proxyip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.proxyip_.SetAllocated(proxyip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.proxyip_.IsDefault()) {
+    _impl_.proxyip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.ReplyProxyIPPort.proxyip)
+}
+
+// int32 proxyport = 2;
+inline void ReplyProxyIPPort::clear_proxyport() {
+  _impl_.proxyport_ = 0;
+}
+inline int32_t ReplyProxyIPPort::_internal_proxyport() const {
+  return _impl_.proxyport_;
+}
+inline int32_t ReplyProxyIPPort::proxyport() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.ReplyProxyIPPort.proxyport)
+  return _internal_proxyport();
+}
+inline void ReplyProxyIPPort::_internal_set_proxyport(int32_t value) {
+  
+  _impl_.proxyport_ = value;
+}
+inline void ReplyProxyIPPort::set_proxyport(int32_t value) {
+  _internal_set_proxyport(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.ReplyProxyIPPort.proxyport)
+}
+
+// -------------------------------------------------------------------
+
+// CommitAbortKey
+
+// string key = 1;
+inline void CommitAbortKey::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& CommitAbortKey::key() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKey.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommitAbortKey::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.CommitAbortKey.key)
+}
+inline std::string* CommitAbortKey::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.CommitAbortKey.key)
+  return _s;
+}
+inline const std::string& CommitAbortKey::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CommitAbortKey::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CommitAbortKey::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CommitAbortKey::release_key() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.CommitAbortKey.key)
+  return _impl_.key_.Release();
+}
+inline void CommitAbortKey::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.CommitAbortKey.key)
+}
+
+// bool ifcommitmetadata = 2;
+inline void CommitAbortKey::clear_ifcommitmetadata() {
+  _impl_.ifcommitmetadata_ = false;
+}
+inline bool CommitAbortKey::_internal_ifcommitmetadata() const {
+  return _impl_.ifcommitmetadata_;
+}
+inline bool CommitAbortKey::ifcommitmetadata() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKey.ifcommitmetadata)
+  return _internal_ifcommitmetadata();
+}
+inline void CommitAbortKey::_internal_set_ifcommitmetadata(bool value) {
+  
+  _impl_.ifcommitmetadata_ = value;
+}
+inline void CommitAbortKey::set_ifcommitmetadata(bool value) {
+  _internal_set_ifcommitmetadata(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.CommitAbortKey.ifcommitmetadata)
+}
+
+// int32 opp = 3;
+inline void CommitAbortKey::clear_opp() {
+  _impl_.opp_ = 0;
+}
+inline int32_t CommitAbortKey::_internal_opp() const {
+  return _impl_.opp_;
+}
+inline int32_t CommitAbortKey::opp() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKey.opp)
+  return _internal_opp();
+}
+inline void CommitAbortKey::_internal_set_opp(int32_t value) {
+  
+  _impl_.opp_ = value;
+}
+inline void CommitAbortKey::set_opp(int32_t value) {
+  _internal_set_opp(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.CommitAbortKey.opp)
+}
+
+// int32 stripe_id = 4;
+inline void CommitAbortKey::clear_stripe_id() {
+  _impl_.stripe_id_ = 0;
+}
+inline int32_t CommitAbortKey::_internal_stripe_id() const {
+  return _impl_.stripe_id_;
+}
+inline int32_t CommitAbortKey::stripe_id() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKey.stripe_id)
+  return _internal_stripe_id();
+}
+inline void CommitAbortKey::_internal_set_stripe_id(int32_t value) {
+  
+  _impl_.stripe_id_ = value;
+}
+inline void CommitAbortKey::set_stripe_id(int32_t value) {
+  _internal_set_stripe_id(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.CommitAbortKey.stripe_id)
+}
+
+// -------------------------------------------------------------------
+
+// AskIfSuccess
+
+// string key = 1;
+inline void AskIfSuccess::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& AskIfSuccess::key() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.AskIfSuccess.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AskIfSuccess::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.AskIfSuccess.key)
+}
+inline std::string* AskIfSuccess::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.AskIfSuccess.key)
+  return _s;
+}
+inline const std::string& AskIfSuccess::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void AskIfSuccess::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AskIfSuccess::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AskIfSuccess::release_key() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.AskIfSuccess.key)
+  return _impl_.key_.Release();
+}
+inline void AskIfSuccess::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.AskIfSuccess.key)
+}
+
+// int32 opp = 2;
+inline void AskIfSuccess::clear_opp() {
+  _impl_.opp_ = 0;
+}
+inline int32_t AskIfSuccess::_internal_opp() const {
+  return _impl_.opp_;
+}
+inline int32_t AskIfSuccess::opp() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.AskIfSuccess.opp)
+  return _internal_opp();
+}
+inline void AskIfSuccess::_internal_set_opp(int32_t value) {
+  
+  _impl_.opp_ = value;
+}
+inline void AskIfSuccess::set_opp(int32_t value) {
+  _internal_set_opp(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.AskIfSuccess.opp)
+}
+
+// int32 stripe_id = 3;
+inline void AskIfSuccess::clear_stripe_id() {
+  _impl_.stripe_id_ = 0;
+}
+inline int32_t AskIfSuccess::_internal_stripe_id() const {
+  return _impl_.stripe_id_;
+}
+inline int32_t AskIfSuccess::stripe_id() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.AskIfSuccess.stripe_id)
+  return _internal_stripe_id();
+}
+inline void AskIfSuccess::_internal_set_stripe_id(int32_t value) {
+  
+  _impl_.stripe_id_ = value;
+}
+inline void AskIfSuccess::set_stripe_id(int32_t value) {
+  _internal_set_stripe_id(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.AskIfSuccess.stripe_id)
+}
+
+// -------------------------------------------------------------------
+
+// RepIfSuccess
+
+// bool ifcommit = 1;
+inline void RepIfSuccess::clear_ifcommit() {
+  _impl_.ifcommit_ = false;
+}
+inline bool RepIfSuccess::_internal_ifcommit() const {
+  return _impl_.ifcommit_;
+}
+inline bool RepIfSuccess::ifcommit() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfSuccess.ifcommit)
+  return _internal_ifcommit();
+}
+inline void RepIfSuccess::_internal_set_ifcommit(bool value) {
+  
+  _impl_.ifcommit_ = value;
+}
+inline void RepIfSuccess::set_ifcommit(bool value) {
+  _internal_set_ifcommit(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfSuccess.ifcommit)
+}
+
+// -------------------------------------------------------------------
+
+// KeyAndClientIP
+
+// string key = 1;
+inline void KeyAndClientIP::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& KeyAndClientIP::key() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeyAndClientIP.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyAndClientIP::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeyAndClientIP.key)
+}
+inline std::string* KeyAndClientIP::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeyAndClientIP.key)
+  return _s;
+}
+inline const std::string& KeyAndClientIP::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void KeyAndClientIP::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyAndClientIP::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyAndClientIP::release_key() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.KeyAndClientIP.key)
+  return _impl_.key_.Release();
+}
+inline void KeyAndClientIP::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.KeyAndClientIP.key)
+}
+
+// string clientip = 2;
+inline void KeyAndClientIP::clear_clientip() {
+  _impl_.clientip_.ClearToEmpty();
+}
+inline const std::string& KeyAndClientIP::clientip() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeyAndClientIP.clientip)
+  return _internal_clientip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyAndClientIP::set_clientip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeyAndClientIP.clientip)
+}
+inline std::string* KeyAndClientIP::mutable_clientip() {
+  std::string* _s = _internal_mutable_clientip();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeyAndClientIP.clientip)
+  return _s;
+}
+inline const std::string& KeyAndClientIP::_internal_clientip() const {
+  return _impl_.clientip_.Get();
+}
+inline void KeyAndClientIP::_internal_set_clientip(const std::string& value) {
+  
+  _impl_.clientip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyAndClientIP::_internal_mutable_clientip() {
+  
+  return _impl_.clientip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyAndClientIP::release_clientip() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.KeyAndClientIP.clientip)
+  return _impl_.clientip_.Release();
+}
+inline void KeyAndClientIP::set_allocated_clientip(std::string* clientip) {
+  if (clientip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientip_.SetAllocated(clientip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientip_.IsDefault()) {
+    _impl_.clientip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.KeyAndClientIP.clientip)
+}
+
+// int32 clientport = 3;
+inline void KeyAndClientIP::clear_clientport() {
+  _impl_.clientport_ = 0;
+}
+inline int32_t KeyAndClientIP::_internal_clientport() const {
+  return _impl_.clientport_;
+}
+inline int32_t KeyAndClientIP::clientport() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeyAndClientIP.clientport)
+  return _internal_clientport();
+}
+inline void KeyAndClientIP::_internal_set_clientport(int32_t value) {
+  
+  _impl_.clientport_ = value;
+}
+inline void KeyAndClientIP::set_clientport(int32_t value) {
+  _internal_set_clientport(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeyAndClientIP.clientport)
+}
+
+// int32 offset = 4;
+inline void KeyAndClientIP::clear_offset() {
+  _impl_.offset_ = 0;
 }
-inline int32_t Parameter::encodetype() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.encodetype)
-  return _internal_encodetype();
+inline int32_t KeyAndClientIP::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline void Parameter::_internal_set_encodetype(int32_t value) {
+inline int32_t KeyAndClientIP::offset() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeyAndClientIP.offset)
+  return _internal_offset();
+}
+inline void KeyAndClientIP::_internal_set_offset(int32_t value) {
   
-  _impl_.encodetype_ = value;
+  _impl_.offset_ = value;
 }
-inline void Parameter::set_encodetype(int32_t value) {
-  _internal_set_encodetype(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.encodetype)
+inline void KeyAndClientIP::set_offset(int32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeyAndClientIP.offset)
 }
 
-// int32 s_stripe_placementtype = 3;
-inline void Parameter::clear_s_stripe_placementtype() {
-  _impl_.s_stripe_placementtype_ = 0;
+// int32 length = 5;
+inline void KeyAndClientIP::clear_length() {
+  _impl_.length_ = 0;
 }
-inline int32_t Parameter::_internal_s_stripe_placementtype() const {
-  return _impl_.s_stripe_placementtype_;
+inline int32_t KeyAndClientIP::_internal_length() const {
+  return _impl_.length_;
 }
-inline int32_t Parameter::s_stripe_placementtype() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.s_stripe_placementtype)
-  return _internal_s_stripe_placementtype();
+inline int32_t KeyAndClientIP::length() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeyAndClientIP.length)
+  return _internal_length();
 }
-inline void Parameter::_internal_set_s_stripe_placementtype(int32_t value) {
+inline void KeyAndClientIP::_internal_set_length(int32_t value) {
   
-  _impl_.s_stripe_placementtype_ = value;
+  _impl_.length_ = value;
 }
-inline void Parameter::set_s_stripe_placementtype(int32_t value) {
-  _internal_set_s_stripe_placementtype(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.s_stripe_placementtype)
+inline void KeyAndClientIP::set_length(int32_t value) {
+  _internal_set_length(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeyAndClientIP.length)
 }
 
-// int32 m_stripe_placementtype = 4;
-inline void Parameter::clear_m_stripe_placementtype() {
-  _impl_.m_stripe_placementtype_ = 0;
+// -------------------------------------------------------------------
+
+// RepIfGetSuccess
+
+// bool ifgetsuccess = 1;
+inline void RepIfGetSuccess::clear_ifgetsuccess() {
+  _impl_.ifgetsuccess_ = false;
 }
-inline int32_t Parameter::_internal_m_stripe_placementtype() const {
-  return _impl_.m_stripe_placementtype_;
+inline bool RepIfGetSuccess::_internal_ifgetsuccess() const {
+  return _impl_.ifgetsuccess_;
 }
-inline int32_t Parameter::m_stripe_placementtype() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.m_stripe_placementtype)
-  return _internal_m_stripe_placementtype();
+inline bool RepIfGetSuccess::ifgetsuccess() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfGetSuccess.ifgetsuccess)
+  return _internal_ifgetsuccess();
 }
-inline void Parameter::_internal_set_m_stripe_placementtype(int32_t value) {
+inline void RepIfGetSuccess::_internal_set_ifgetsuccess(bool value) {
   
-  _impl_.m_stripe_placementtype_ = value;
+  _impl_.ifgetsuccess_ = value;
 }
-inline void Parameter::set_m_stripe_placementtype(int32_t value) {
-  _internal_set_m_stripe_placementtype(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.m_stripe_placementtype)
+inline void RepIfGetSuccess::set_ifgetsuccess(bool value) {
+  _internal_set_ifgetsuccess(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfGetSuccess.ifgetsuccess)
 }
 
-// int32 k_datablock = 5;
-inline void Parameter::clear_k_datablock() {
-  _impl_.k_datablock_ = 0;
+// int32 valuesizebytes = 2;
+inline void RepIfGetSuccess::clear_valuesizebytes() {
+  _impl_.valuesizebytes_ = 0;
 }
-inline int32_t Parameter::_internal_k_datablock() const {
-  return _impl_.k_datablock_;
+inline int32_t RepIfGetSuccess::_internal_valuesizebytes() const {
+  return _impl_.valuesizebytes_;
 }
-inline int32_t Parameter::k_datablock() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.k_datablock)
-  return _internal_k_datablock();
+inline int32_t RepIfGetSuccess::valuesizebytes() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfGetSuccess.valuesizebytes)
+  return _internal_valuesizebytes();
 }
-inline void Parameter::_internal_set_k_datablock(int32_t value) {
+inline void RepIfGetSuccess::_internal_set_valuesizebytes(int32_t value) {
   
-  _impl_.k_datablock_ = value;
+  _impl_.valuesizebytes_ = value;
 }
-inline void Parameter::set_k_datablock(int32_t value) {
-  _internal_set_k_datablock(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.k_datablock)
+inline void RepIfGetSuccess::set_valuesizebytes(int32_t value) {
+  _internal_set_valuesizebytes(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfGetSuccess.valuesizebytes)
 }
 
-// int32 l_localparityblock = 6;
-inline void Parameter::clear_l_localparityblock() {
-  _impl_.l_localparityblock_ = 0;
+// -------------------------------------------------------------------
+
+// KeyFromClient
+
+// string key = 1;
+inline void KeyFromClient::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline int32_t Parameter::_internal_l_localparityblock() const {
-  return _impl_.l_localparityblock_;
+inline const std::string& KeyFromClient::key() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeyFromClient.key)
+  return _internal_key();
 }
-inline int32_t Parameter::l_localparityblock() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.l_localparityblock)
-  return _internal_l_localparityblock();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyFromClient::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeyFromClient.key)
 }
-inline void Parameter::_internal_set_l_localparityblock(int32_t value) {
+inline std::string* KeyFromClient::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeyFromClient.key)
+  return _s;
+}
+inline const std::string& KeyFromClient::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void KeyFromClient::_internal_set_key(const std::string& value) {
   
-  _impl_.l_localparityblock_ = value;
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline void Parameter::set_l_localparityblock(int32_t value) {
-  _internal_set_l_localparityblock(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.l_localparityblock)
+inline std::string* KeyFromClient::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyFromClient::release_key() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.KeyFromClient.key)
+  return _impl_.key_.Release();
+}
+inline void KeyFromClient::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.KeyFromClient.key)
 }
 
-// int32 g_m_globalparityblock = 7;
-inline void Parameter::clear_g_m_globalparityblock() {
-  _impl_.g_m_globalparityblock_ = 0;
+// -------------------------------------------------------------------
+
+// StripeIdFromClient
+
+// int32 stripe_id = 1;
+inline void StripeIdFromClient::clear_stripe_id() {
+  _impl_.stripe_id_ = 0;
+}
+inline int32_t StripeIdFromClient::_internal_stripe_id() const {
+  return _impl_.stripe_id_;
+}
+inline int32_t StripeIdFromClient::stripe_id() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.StripeIdFromClient.stripe_id)
+  return _internal_stripe_id();
+}
+inline void StripeIdFromClient::_internal_set_stripe_id(int32_t value) {
+  
+  _impl_.stripe_id_ = value;
+}
+inline void StripeIdFromClient::set_stripe_id(int32_t value) {
+  _internal_set_stripe_id(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.StripeIdFromClient.stripe_id)
+}
+
+// -------------------------------------------------------------------
+
+// RepIfDeling
+
+// bool ifdeling = 1;
+inline void RepIfDeling::clear_ifdeling() {
+  _impl_.ifdeling_ = false;
+}
+inline bool RepIfDeling::_internal_ifdeling() const {
+  return _impl_.ifdeling_;
+}
+inline bool RepIfDeling::ifdeling() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfDeling.ifdeling)
+  return _internal_ifdeling();
+}
+inline void RepIfDeling::_internal_set_ifdeling(bool value) {
+  
+  _impl_.ifdeling_ = value;
+}
+inline void RepIfDeling::set_ifdeling(bool value) {
+  _internal_set_ifdeling(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfDeling.ifdeling)
+}
+
+// -------------------------------------------------------------------
+
+// RequestProxyIPPorts
+
+// repeated .coordinator_proto.RequestProxyIPPort objects = 1;
+inline int RequestProxyIPPorts::_internal_objects_size() const {
+  return _impl_.objects_.size();
+}
+inline int RequestProxyIPPorts::objects_size() const {
+  return _internal_objects_size();
+}
+inline void RequestProxyIPPorts::clear_objects() {
+  _impl_.objects_.Clear();
+}
+inline ::coordinator_proto::RequestProxyIPPort* RequestProxyIPPorts::mutable_objects(int index) {
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.RequestProxyIPPorts.objects)
+  return _impl_.objects_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::RequestProxyIPPort >*
+RequestProxyIPPorts::mutable_objects() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.RequestProxyIPPorts.objects)
+  return &_impl_.objects_;
+}
+inline const ::coordinator_proto::RequestProxyIPPort& RequestProxyIPPorts::_internal_objects(int index) const {
+  return _impl_.objects_.Get(index);
+}
+inline const ::coordinator_proto::RequestProxyIPPort& RequestProxyIPPorts::objects(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RequestProxyIPPorts.objects)
+  return _internal_objects(index);
+}
+inline ::coordinator_proto::RequestProxyIPPort* RequestProxyIPPorts::_internal_add_objects() {
+  return _impl_.objects_.Add();
+}
+inline ::coordinator_proto::RequestProxyIPPort* RequestProxyIPPorts::add_objects() {
+  ::coordinator_proto::RequestProxyIPPort* _add = _internal_add_objects();
+  // @@protoc_insertion_point(field_add:coordinator_proto.RequestProxyIPPorts.objects)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::RequestProxyIPPort >&
+RequestProxyIPPorts::objects() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.RequestProxyIPPorts.objects)
+  return _impl_.objects_;
+}
+
+// -------------------------------------------------------------------
+
+// ReplyProxyIPPorts
+
+// repeated .coordinator_proto.ReplyProxyIPPort proxies = 1;
+inline int ReplyProxyIPPorts::_internal_proxies_size() const {
+  return _impl_.proxies_.size();
+}
+inline int ReplyProxyIPPorts::proxies_size() const {
+  return _internal_proxies_size();
+}
+inline void ReplyProxyIPPorts::clear_proxies() {
+  _impl_.proxies_.Clear();
+}
+inline ::coordinator_proto::ReplyProxyIPPort* ReplyProxyIPPorts::mutable_proxies(int index) {
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.ReplyProxyIPPorts.proxies)
+  return _impl_.proxies_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::ReplyProxyIPPort >*
+ReplyProxyIPPorts::mutable_proxies() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.ReplyProxyIPPorts.proxies)
+  return &_impl_.proxies_;
+}
+inline const ::coordinator_proto::ReplyProxyIPPort& ReplyProxyIPPorts::_internal_proxies(int index) const {
+  return _impl_.proxies_.Get(index);
+}
+inline const ::coordinator_proto::ReplyProxyIPPort& ReplyProxyIPPorts::proxies(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.ReplyProxyIPPorts.proxies)
+  return _internal_proxies(index);
+}
+inline ::coordinator_proto::ReplyProxyIPPort* ReplyProxyIPPorts::_internal_add_proxies() {
+  return _impl_.proxies_.Add();
+}
+inline ::coordinator_proto::ReplyProxyIPPort* ReplyProxyIPPorts::add_proxies() {
+  ::coordinator_proto::ReplyProxyIPPort* _add = _internal_add_proxies();
+  // @@protoc_insertion_point(field_add:coordinator_proto.ReplyProxyIPPorts.proxies)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::ReplyProxyIPPort >&
+ReplyProxyIPPorts::proxies() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.ReplyProxyIPPorts.proxies)
+  return _impl_.proxies_;
+}
+
+// -------------------------------------------------------------------
+
+// NodeStatus
+
+// string node_ip = 1;
+inline void NodeStatus::clear_node_ip() {
+  _impl_.node_ip_.ClearToEmpty();
+}
+inline const std::string& NodeStatus::node_ip() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NodeStatus.node_ip)
+  return _internal_node_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeStatus::set_node_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.NodeStatus.node_ip)
+}
+inline std::string* NodeStatus::mutable_node_ip() {
+  std::string* _s = _internal_mutable_node_ip();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.NodeStatus.node_ip)
+  return _s;
+}
+inline const std::string& NodeStatus::_internal_node_ip() const {
+  return _impl_.node_ip_.Get();
+}
+inline void NodeStatus::_internal_set_node_ip(const std::string& value) {
+  
+  _impl_.node_ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NodeStatus::_internal_mutable_node_ip() {
+  
+  return _impl_.node_ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NodeStatus::release_node_ip() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.NodeStatus.node_ip)
+  return _impl_.node_ip_.Release();
+}
+inline void NodeStatus::set_allocated_node_ip(std::string* node_ip) {
+  if (node_ip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_ip_.SetAllocated(node_ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_ip_.IsDefault()) {
+    _impl_.node_ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.NodeStatus.node_ip)
+}
+
+// int32 node_port = 2;
+inline void NodeStatus::clear_node_port() {
+  _impl_.node_port_ = 0;
+}
+inline int32_t NodeStatus::_internal_node_port() const {
+  return _impl_.node_port_;
+}
+inline int32_t NodeStatus::node_port() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NodeStatus.node_port)
+  return _internal_node_port();
+}
+inline void NodeStatus::_internal_set_node_port(int32_t value) {
+  
+  _impl_.node_port_ = value;
+}
+inline void NodeStatus::set_node_port(int32_t value) {
+  _internal_set_node_port(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.NodeStatus.node_port)
+}
+
+// int64 free_bytes = 3;
+inline void NodeStatus::clear_free_bytes() {
+  _impl_.free_bytes_ = int64_t{0};
+}
+inline int64_t NodeStatus::_internal_free_bytes() const {
+  return _impl_.free_bytes_;
+}
+inline int64_t NodeStatus::free_bytes() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NodeStatus.free_bytes)
+  return _internal_free_bytes();
+}
+inline void NodeStatus::_internal_set_free_bytes(int64_t value) {
+  
+  _impl_.free_bytes_ = value;
+}
+inline void NodeStatus::set_free_bytes(int64_t value) {
+  _internal_set_free_bytes(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.NodeStatus.free_bytes)
+}
+
+// int32 block_num = 4;
+inline void NodeStatus::clear_block_num() {
+  _impl_.block_num_ = 0;
 }
-inline int32_t Parameter::_internal_g_m_globalparityblock() const {
-  return _impl_.g_m_globalparityblock_;
+inline int32_t NodeStatus::_internal_block_num() const {
+  return _impl_.block_num_;
 }
-inline int32_t Parameter::g_m_globalparityblock() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.g_m_globalparityblock)
-  return _internal_g_m_globalparityblock();
+inline int32_t NodeStatus::block_num() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NodeStatus.block_num)
+  return _internal_block_num();
 }
-inline void Parameter::_internal_set_g_m_globalparityblock(int32_t value) {
+inline void NodeStatus::_internal_set_block_num(int32_t value) {
   
-  _impl_.g_m_globalparityblock_ = value;
+  _impl_.block_num_ = value;
 }
-inline void Parameter::set_g_m_globalparityblock(int32_t value) {
-  _internal_set_g_m_globalparityblock(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.g_m_globalparityblock)
+inline void NodeStatus::set_block_num(int32_t value) {
+  _internal_set_block_num(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.NodeStatus.block_num)
 }
 
-// int32 b_datapergroup = 8;
-inline void Parameter::clear_b_datapergroup() {
-  _impl_.b_datapergroup_ = 0;
+// int64 io_bytes_per_sec = 5;
+inline void NodeStatus::clear_io_bytes_per_sec() {
+  _impl_.io_bytes_per_sec_ = int64_t{0};
 }
-inline int32_t Parameter::_internal_b_datapergroup() const {
-  return _impl_.b_datapergroup_;
+inline int64_t NodeStatus::_internal_io_bytes_per_sec() const {
+  return _impl_.io_bytes_per_sec_;
 }
-inline int32_t Parameter::b_datapergroup() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.b_datapergroup)
-  return _internal_b_datapergroup();
+inline int64_t NodeStatus::io_bytes_per_sec() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NodeStatus.io_bytes_per_sec)
+  return _internal_io_bytes_per_sec();
 }
-inline void Parameter::_internal_set_b_datapergroup(int32_t value) {
+inline void NodeStatus::_internal_set_io_bytes_per_sec(int64_t value) {
   
-  _impl_.b_datapergroup_ = value;
+  _impl_.io_bytes_per_sec_ = value;
 }
-inline void Parameter::set_b_datapergroup(int32_t value) {
-  _internal_set_b_datapergroup(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.b_datapergroup)
+inline void NodeStatus::set_io_bytes_per_sec(int64_t value) {
+  _internal_set_io_bytes_per_sec(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.NodeStatus.io_bytes_per_sec)
 }
 
-// int32 x_stripepermergegroup = 9;
-inline void Parameter::clear_x_stripepermergegroup() {
-  _impl_.x_stripepermergegroup_ = 0;
+// -------------------------------------------------------------------
+
+// NodeStatuses
+
+// repeated .coordinator_proto.NodeStatus nodes = 1;
+inline int NodeStatuses::_internal_nodes_size() const {
+  return _impl_.nodes_.size();
 }
-inline int32_t Parameter::_internal_x_stripepermergegroup() const {
-  return _impl_.x_stripepermergegroup_;
+inline int NodeStatuses::nodes_size() const {
+  return _internal_nodes_size();
 }
-inline int32_t Parameter::x_stripepermergegroup() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.Parameter.x_stripepermergegroup)
-  return _internal_x_stripepermergegroup();
+inline void NodeStatuses::clear_nodes() {
+  _impl_.nodes_.Clear();
 }
-inline void Parameter::_internal_set_x_stripepermergegroup(int32_t value) {
-  
-  _impl_.x_stripepermergegroup_ = value;
+inline ::coordinator_proto::NodeStatus* NodeStatuses::mutable_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.NodeStatuses.nodes)
+  return _impl_.nodes_.Mutable(index);
 }
-inline void Parameter::set_x_stripepermergegroup(int32_t value) {
-  _internal_set_x_stripepermergegroup(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.Parameter.x_stripepermergegroup)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::NodeStatus >*
+NodeStatuses::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.NodeStatuses.nodes)
+  return &_impl_.nodes_;
+}
+inline const ::coordinator_proto::NodeStatus& NodeStatuses::_internal_nodes(int index) const {
+  return _impl_.nodes_.Get(index);
+}
+inline const ::coordinator_proto::NodeStatus& NodeStatuses::nodes(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NodeStatuses.nodes)
+  return _internal_nodes(index);
+}
+inline ::coordinator_proto::NodeStatus* NodeStatuses::_internal_add_nodes() {
+  return _impl_.nodes_.Add();
+}
+inline ::coordinator_proto::NodeStatus* NodeStatuses::add_nodes() {
+  ::coordinator_proto::NodeStatus* _add = _internal_add_nodes();
+  // @@protoc_insertion_point(field_add:coordinator_proto.NodeStatuses.nodes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::NodeStatus >&
+NodeStatuses::nodes() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.NodeStatuses.nodes)
+  return _impl_.nodes_;
 }
 
 // -------------------------------------------------------------------
 
-// RepIfSetParaSuccess
+// CommitAbortKeys
 
-// bool ifsetparameter = 1;
-inline void RepIfSetParaSuccess::clear_ifsetparameter() {
-  _impl_.ifsetparameter_ = false;
+// repeated .coordinator_proto.CommitAbortKey keys = 1;
+inline int CommitAbortKeys::_internal_keys_size() const {
+  return _impl_.keys_.size();
 }
-inline bool RepIfSetParaSuccess::_internal_ifsetparameter() const {
-  return _impl_.ifsetparameter_;
+inline int CommitAbortKeys::keys_size() const {
+  return _internal_keys_size();
 }
-inline bool RepIfSetParaSuccess::ifsetparameter() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfSetParaSuccess.ifsetparameter)
-  return _internal_ifsetparameter();
+inline void CommitAbortKeys::clear_keys() {
+  _impl_.keys_.Clear();
 }
-inline void RepIfSetParaSuccess::_internal_set_ifsetparameter(bool value) {
-  
-  _impl_.ifsetparameter_ = value;
+inline ::coordinator_proto::CommitAbortKey* CommitAbortKeys::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.CommitAbortKeys.keys)
+  return _impl_.keys_.Mutable(index);
 }
-inline void RepIfSetParaSuccess::set_ifsetparameter(bool value) {
-  _internal_set_ifsetparameter(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfSetParaSuccess.ifsetparameter)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::CommitAbortKey >*
+CommitAbortKeys::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.CommitAbortKeys.keys)
+  return &_impl_.keys_;
+}
+inline const ::coordinator_proto::CommitAbortKey& CommitAbortKeys::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const ::coordinator_proto::CommitAbortKey& CommitAbortKeys::keys(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKeys.keys)
+  return _internal_keys(index);
+}
+inline ::coordinator_proto::CommitAbortKey* CommitAbortKeys::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline ::coordinator_proto::CommitAbortKey* CommitAbortKeys::add_keys() {
+  ::coordinator_proto::CommitAbortKey* _add = _internal_add_keys();
+  // @@protoc_insertion_point(field_add:coordinator_proto.CommitAbortKeys.keys)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::CommitAbortKey >&
+CommitAbortKeys::keys() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.CommitAbortKeys.keys)
+  return _impl_.keys_;
 }
 
 // -------------------------------------------------------------------
 
-// RequestToCoordinator
+// AskIfSuccessBatch
 
-// string name = 1;
-inline void RequestToCoordinator::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// repeated .coordinator_proto.AskIfSuccess asks = 1;
+inline int AskIfSuccessBatch::_internal_asks_size() const {
+  return _impl_.asks_.size();
 }
-inline const std::string& RequestToCoordinator::name() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RequestToCoordinator.name)
-  return _internal_name();
+inline int AskIfSuccessBatch::asks_size() const {
+  return _internal_asks_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RequestToCoordinator::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.RequestToCoordinator.name)
+inline void AskIfSuccessBatch::clear_asks() {
+  _impl_.asks_.Clear();
 }
-inline std::string* RequestToCoordinator::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.RequestToCoordinator.name)
-  return _s;
+inline ::coordinator_proto::AskIfSuccess* AskIfSuccessBatch::mutable_asks(int index) {
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.AskIfSuccessBatch.asks)
+  return _impl_.asks_.Mutable(index);
 }
-inline const std::string& RequestToCoordinator::_internal_name() const {
-  return _impl_.name_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::AskIfSuccess >*
+AskIfSuccessBatch::mutable_asks() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.AskIfSuccessBatch.asks)
+  return &_impl_.asks_;
 }
-inline void RequestToCoordinator::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+inline const ::coordinator_proto::AskIfSuccess& AskIfSuccessBatch::_internal_asks(int index) const {
+  return _impl_.asks_.Get(index);
 }
-inline std::string* RequestToCoordinator::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline const ::coordinator_proto::AskIfSuccess& AskIfSuccessBatch::asks(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.AskIfSuccessBatch.asks)
+  return _internal_asks(index);
 }
-inline std::string* RequestToCoordinator::release_name() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.RequestToCoordinator.name)
-  return _impl_.name_.Release();
+inline ::coordinator_proto::AskIfSuccess* AskIfSuccessBatch::_internal_add_asks() {
+  return _impl_.asks_.Add();
 }
-inline void RequestToCoordinator::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.RequestToCoordinator.name)
+inline ::coordinator_proto::AskIfSuccess* AskIfSuccessBatch::add_asks() {
+  ::coordinator_proto::AskIfSuccess* _add = _internal_add_asks();
+  // @@protoc_insertion_point(field_add:coordinator_proto.AskIfSuccessBatch.asks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::coordinator_proto::AskIfSuccess >&
+AskIfSuccessBatch::asks() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.AskIfSuccessBatch.asks)
+  return _impl_.asks_;
 }
 
 // -------------------------------------------------------------------
 
-// ReplyFromCoordinator
+// KeysAndClientIP
 
-// string message = 1;
-inline void ReplyFromCoordinator::clear_message() {
-  _impl_.message_.ClearToEmpty();
+// repeated string keys = 1;
+inline int KeysAndClientIP::_internal_keys_size() const {
+  return _impl_.keys_.size();
 }
-inline const std::string& ReplyFromCoordinator::message() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.ReplyFromCoordinator.message)
-  return _internal_message();
+inline int KeysAndClientIP::keys_size() const {
+  return _internal_keys_size();
+}
+inline void KeysAndClientIP::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* KeysAndClientIP::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:coordinator_proto.KeysAndClientIP.keys)
+  return _s;
+}
+inline const std::string& KeysAndClientIP::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& KeysAndClientIP::keys(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeysAndClientIP.keys)
+  return _internal_keys(index);
+}
+inline std::string* KeysAndClientIP::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeysAndClientIP.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void KeysAndClientIP::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeysAndClientIP.keys)
+}
+inline void KeysAndClientIP::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeysAndClientIP.keys)
+}
+inline void KeysAndClientIP::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:coordinator_proto.KeysAndClientIP.keys)
+}
+inline void KeysAndClientIP::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:coordinator_proto.KeysAndClientIP.keys)
+}
+inline std::string* KeysAndClientIP::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void KeysAndClientIP::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:coordinator_proto.KeysAndClientIP.keys)
+}
+inline void KeysAndClientIP::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:coordinator_proto.KeysAndClientIP.keys)
+}
+inline void KeysAndClientIP::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:coordinator_proto.KeysAndClientIP.keys)
+}
+inline void KeysAndClientIP::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:coordinator_proto.KeysAndClientIP.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+KeysAndClientIP::keys() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.KeysAndClientIP.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+KeysAndClientIP::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.KeysAndClientIP.keys)
+  return &_impl_.keys_;
+}
+
+// string clientip = 2;
+inline void KeysAndClientIP::clear_clientip() {
+  _impl_.clientip_.ClearToEmpty();
+}
+inline const std::string& KeysAndClientIP::clientip() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeysAndClientIP.clientip)
+  return _internal_clientip();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ReplyFromCoordinator::set_message(ArgT0&& arg0, ArgT... args) {
+void KeysAndClientIP::set_clientip(ArgT0&& arg0, ArgT... args) {
  
- _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.ReplyFromCoordinator.message)
+ _impl_.clientip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeysAndClientIP.clientip)
 }
-inline std::string* ReplyFromCoordinator::mutable_message() {
-  std::string* _s = _internal_mutable_message();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.ReplyFromCoordinator.message)
+inline std::string* KeysAndClientIP::mutable_clientip() {
+  std::string* _s = _internal_mutable_clientip();
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeysAndClientIP.clientip)
   return _s;
 }
-inline const std::string& ReplyFromCoordinator::_internal_message() const {
-  return _impl_.message_.Get();
+inline const std::string& KeysAndClientIP::_internal_clientip() const {
+  return _impl_.clientip_.Get();
 }
-inline void ReplyFromCoordinator::_internal_set_message(const std::string& value) {
+inline void KeysAndClientIP::_internal_set_clientip(const std::string& value) {
   
-  _impl_.message_.Set(value, GetArenaForAllocation());
+  _impl_.clientip_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ReplyFromCoordinator::_internal_mutable_message() {
+inline std::string* KeysAndClientIP::_internal_mutable_clientip() {
   
-  return _impl_.message_.Mutable(GetArenaForAllocation());
+  return _impl_.clientip_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ReplyFromCoordinator::release_message() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.ReplyFromCoordinator.message)
-  return _impl_.message_.Release();
+inline std::string* KeysAndClientIP::release_clientip() {
+  // @@protoc_insertion_point(field_release:coordinator_proto.KeysAndClientIP.clientip)
+  return _impl_.clientip_.Release();
 }
-inline void ReplyFromCoordinator::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
+inline void KeysAndClientIP::set_allocated_clientip(std::string* clientip) {
+  if (clientip != nullptr) {
     
   } else {
     
   }
-  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+  _impl_.clientip_.SetAllocated(clientip, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.message_.IsDefault()) {
-    _impl_.message_.Set("", GetArenaForAllocation());
+  if (_impl_.clientip_.IsDefault()) {
+    _impl_.clientip_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.ReplyFromCoordinator.message)
+  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.KeysAndClientIP.clientip)
+}
+
+// int32 clientport = 3;
+inline void KeysAndClientIP::clear_clientport() {
+  _impl_.clientport_ = 0;
+}
+inline int32_t KeysAndClientIP::_internal_clientport() const {
+  return _impl_.clientport_;
+}
+inline int32_t KeysAndClientIP::clientport() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeysAndClientIP.clientport)
+  return _internal_clientport();
+}
+inline void KeysAndClientIP::_internal_set_clientport(int32_t value) {
+  
+  _impl_.clientport_ = value;
+}
+inline void KeysAndClientIP::set_clientport(int32_t value) {
+  _internal_set_clientport(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeysAndClientIP.clientport)
 }
 
 // -------------------------------------------------------------------
 
-// RequestProxyIPPort
+// RepIfGetSuccesses
 
-// string key = 1;
-inline void RequestProxyIPPort::clear_key() {
-  _impl_.key_.ClearToEmpty();
+// bool ifgetsuccess = 1;
+inline void RepIfGetSuccesses::clear_ifgetsuccess() {
+  _impl_.ifgetsuccess_ = false;
 }
-inline const std::string& RequestProxyIPPort::key() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RequestProxyIPPort.key)
-  return _internal_key();
+inline bool RepIfGetSuccesses::_internal_ifgetsuccess() const {
+  return _impl_.ifgetsuccess_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RequestProxyIPPort::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.RequestProxyIPPort.key)
+inline bool RepIfGetSuccesses::ifgetsuccess() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfGetSuccesses.ifgetsuccess)
+  return _internal_ifgetsuccess();
 }
-inline std::string* RequestProxyIPPort::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.RequestProxyIPPort.key)
-  return _s;
+inline void RepIfGetSuccesses::_internal_set_ifgetsuccess(bool value) {
+  
+  _impl_.ifgetsuccess_ = value;
 }
-inline const std::string& RequestProxyIPPort::_internal_key() const {
-  return _impl_.key_.Get();
+inline void RepIfGetSuccesses::set_ifgetsuccess(bool value) {
+  _internal_set_ifgetsuccess(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfGetSuccesses.ifgetsuccess)
 }
-inline void RequestProxyIPPort::_internal_set_key(const std::string& value) {
-  
-  _impl_.key_.Set(value, GetArenaForAllocation());
+
+// repeated int32 valuesizebytes = 2;
+inline int RepIfGetSuccesses::_internal_valuesizebytes_size() const {
+  return _impl_.valuesizebytes_.size();
 }
-inline std::string* RequestProxyIPPort::_internal_mutable_key() {
-  
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+inline int RepIfGetSuccesses::valuesizebytes_size() const {
+  return _internal_valuesizebytes_size();
 }
-inline std::string* RequestProxyIPPort::release_key() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.RequestProxyIPPort.key)
-  return _impl_.key_.Release();
+inline void RepIfGetSuccesses::clear_valuesizebytes() {
+  _impl_.valuesizebytes_.Clear();
 }
-inline void RequestProxyIPPort::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.RequestProxyIPPort.key)
+inline int32_t RepIfGetSuccesses::_internal_valuesizebytes(int index) const {
+  return _impl_.valuesizebytes_.Get(index);
+}
+inline int32_t RepIfGetSuccesses::valuesizebytes(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfGetSuccesses.valuesizebytes)
+  return _internal_valuesizebytes(index);
+}
+inline void RepIfGetSuccesses::set_valuesizebytes(int index, int32_t value) {
+  _impl_.valuesizebytes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfGetSuccesses.valuesizebytes)
+}
+inline void RepIfGetSuccesses::_internal_add_valuesizebytes(int32_t value) {
+  _impl_.valuesizebytes_.Add(value);
+}
+inline void RepIfGetSuccesses::add_valuesizebytes(int32_t value) {
+  _internal_add_valuesizebytes(value);
+  // @@protoc_insertion_point(field_add:coordinator_proto.RepIfGetSuccesses.valuesizebytes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+RepIfGetSuccesses::_internal_valuesizebytes() const {
+  return _impl_.valuesizebytes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+RepIfGetSuccesses::valuesizebytes() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.RepIfGetSuccesses.valuesizebytes)
+  return _internal_valuesizebytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+RepIfGetSuccesses::_internal_mutable_valuesizebytes() {
+  return &_impl_.valuesizebytes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+RepIfGetSuccesses::mutable_valuesizebytes() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.RepIfGetSuccesses.valuesizebytes)
+  return _internal_mutable_valuesizebytes();
+}
+
+// -------------------------------------------------------------------
+
+// KeysFromClient
+
+// repeated string keys = 1;
+inline int KeysFromClient::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int KeysFromClient::keys_size() const {
+  return _internal_keys_size();
+}
+inline void KeysFromClient::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* KeysFromClient::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:coordinator_proto.KeysFromClient.keys)
+  return _s;
+}
+inline const std::string& KeysFromClient::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& KeysFromClient::keys(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.KeysFromClient.keys)
+  return _internal_keys(index);
 }
-
-// int32 valuesizebytes = 2;
-inline void RequestProxyIPPort::clear_valuesizebytes() {
-  _impl_.valuesizebytes_ = 0;
+inline std::string* KeysFromClient::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeysFromClient.keys)
+  return _impl_.keys_.Mutable(index);
 }
-inline int32_t RequestProxyIPPort::_internal_valuesizebytes() const {
-  return _impl_.valuesizebytes_;
+inline void KeysFromClient::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeysFromClient.keys)
 }
-inline int32_t RequestProxyIPPort::valuesizebytes() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RequestProxyIPPort.valuesizebytes)
-  return _internal_valuesizebytes();
+inline void KeysFromClient::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:coordinator_proto.KeysFromClient.keys)
 }
-inline void RequestProxyIPPort::_internal_set_valuesizebytes(int32_t value) {
-  
-  _impl_.valuesizebytes_ = value;
+inline void KeysFromClient::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:coordinator_proto.KeysFromClient.keys)
 }
-inline void RequestProxyIPPort::set_valuesizebytes(int32_t value) {
-  _internal_set_valuesizebytes(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RequestProxyIPPort.valuesizebytes)
+inline void KeysFromClient::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:coordinator_proto.KeysFromClient.keys)
+}
+inline std::string* KeysFromClient::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void KeysFromClient::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:coordinator_proto.KeysFromClient.keys)
+}
+inline void KeysFromClient::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:coordinator_proto.KeysFromClient.keys)
+}
+inline void KeysFromClient::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:coordinator_proto.KeysFromClient.keys)
+}
+inline void KeysFromClient::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:coordinator_proto.KeysFromClient.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+KeysFromClient::keys() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.KeysFromClient.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+KeysFromClient::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.KeysFromClient.keys)
+  return &_impl_.keys_;
 }
 
 // -------------------------------------------------------------------
 
-// ReplyProxyIPPort
+// NumberOfStripesToMerge
 
-// string proxyip = 1;
-inline void ReplyProxyIPPort::clear_proxyip() {
-  _impl_.proxyip_.ClearToEmpty();
+// int32 num_of_stripes = 1;
+inline void NumberOfStripesToMerge::clear_num_of_stripes() {
+  _impl_.num_of_stripes_ = 0;
 }
-inline const std::string& ReplyProxyIPPort::proxyip() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.ReplyProxyIPPort.proxyip)
-  return _internal_proxyip();
+inline int32_t NumberOfStripesToMerge::_internal_num_of_stripes() const {
+  return _impl_.num_of_stripes_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ReplyProxyIPPort::set_proxyip(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.proxyip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.ReplyProxyIPPort.proxyip)
+inline int32_t NumberOfStripesToMerge::num_of_stripes() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NumberOfStripesToMerge.num_of_stripes)
+  return _internal_num_of_stripes();
 }
-inline std::string* ReplyProxyIPPort::mutable_proxyip() {
-  std::string* _s = _internal_mutable_proxyip();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.ReplyProxyIPPort.proxyip)
-  return _s;
+inline void NumberOfStripesToMerge::_internal_set_num_of_stripes(int32_t value) {
+  
+  _impl_.num_of_stripes_ = value;
 }
-inline const std::string& ReplyProxyIPPort::_internal_proxyip() const {
-  return _impl_.proxyip_.Get();
+inline void NumberOfStripesToMerge::set_num_of_stripes(int32_t value) {
+  _internal_set_num_of_stripes(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.NumberOfStripesToMerge.num_of_stripes)
 }
-inline void ReplyProxyIPPort::_internal_set_proxyip(const std::string& value) {
-  
-  _impl_.proxyip_.Set(value, GetArenaForAllocation());
+
+// int32 max_concurrency = 2;
+inline void NumberOfStripesToMerge::clear_max_concurrency() {
+  _impl_.max_concurrency_ = 0;
 }
-inline std::string* ReplyProxyIPPort::_internal_mutable_proxyip() {
-  
-  return _impl_.proxyip_.Mutable(GetArenaForAllocation());
+inline int32_t NumberOfStripesToMerge::_internal_max_concurrency() const {
+  return _impl_.max_concurrency_;
 }
-inline std::string* ReplyProxyIPPort::release_proxyip() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.ReplyProxyIPPort.proxyip)
-  return _impl_.proxyip_.Release();
+inline int32_t NumberOfStripesToMerge::max_concurrency() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NumberOfStripesToMerge.max_concurrency)
+  return _internal_max_concurrency();
 }
-inline void ReplyProxyIPPort::set_allocated_proxyip(std::string* proxyip) {
-  if (proxyip != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.proxyip_.SetAllocated(proxyip, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.proxyip_.IsDefault()) {
-    _impl_.proxyip_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.ReplyProxyIPPort.proxyip)
+inline void NumberOfStripesToMerge::_internal_set_max_concurrency(int32_t value) {
+  
+  _impl_.max_concurrency_ = value;
+}
+inline void NumberOfStripesToMerge::set_max_concurrency(int32_t value) {
+  _internal_set_max_concurrency(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.NumberOfStripesToMerge.max_concurrency)
 }
 
-// int32 proxyport = 2;
-inline void ReplyProxyIPPort::clear_proxyport() {
-  _impl_.proxyport_ = 0;
+// bool dry_run = 3;
+inline void NumberOfStripesToMerge::clear_dry_run() {
+  _impl_.dry_run_ = false;
 }
-inline int32_t ReplyProxyIPPort::_internal_proxyport() const {
-  return _impl_.proxyport_;
+inline bool NumberOfStripesToMerge::_internal_dry_run() const {
+  return _impl_.dry_run_;
 }
-inline int32_t ReplyProxyIPPort::proxyport() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.ReplyProxyIPPort.proxyport)
-  return _internal_proxyport();
+inline bool NumberOfStripesToMerge::dry_run() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.NumberOfStripesToMerge.dry_run)
+  return _internal_dry_run();
 }
-inline void ReplyProxyIPPort::_internal_set_proxyport(int32_t value) {
+inline void NumberOfStripesToMerge::_internal_set_dry_run(bool value) {
   
-  _impl_.proxyport_ = value;
+  _impl_.dry_run_ = value;
 }
-inline void ReplyProxyIPPort::set_proxyport(int32_t value) {
-  _internal_set_proxyport(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.ReplyProxyIPPort.proxyport)
+inline void NumberOfStripesToMerge::set_dry_run(bool value) {
+  _internal_set_dry_run(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.NumberOfStripesToMerge.dry_run)
 }
 
 // -------------------------------------------------------------------
 
-// CommitAbortKey
+// RepIfMerged
 
-// string key = 1;
-inline void CommitAbortKey::clear_key() {
-  _impl_.key_.ClearToEmpty();
+// bool ifmerged = 1;
+inline void RepIfMerged::clear_ifmerged() {
+  _impl_.ifmerged_ = false;
 }
-inline const std::string& CommitAbortKey::key() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKey.key)
-  return _internal_key();
+inline bool RepIfMerged::_internal_ifmerged() const {
+  return _impl_.ifmerged_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void CommitAbortKey::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.CommitAbortKey.key)
+inline bool RepIfMerged::ifmerged() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.ifmerged)
+  return _internal_ifmerged();
 }
-inline std::string* CommitAbortKey::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.CommitAbortKey.key)
-  return _s;
+inline void RepIfMerged::_internal_set_ifmerged(bool value) {
+  
+  _impl_.ifmerged_ = value;
 }
-inline const std::string& CommitAbortKey::_internal_key() const {
-  return _impl_.key_.Get();
+inline void RepIfMerged::set_ifmerged(bool value) {
+  _internal_set_ifmerged(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.ifmerged)
 }
-inline void CommitAbortKey::_internal_set_key(const std::string& value) {
-  
-  _impl_.key_.Set(value, GetArenaForAllocation());
+
+// double lc = 2;
+inline void RepIfMerged::clear_lc() {
+  _impl_.lc_ = 0;
 }
-inline std::string* CommitAbortKey::_internal_mutable_key() {
-  
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+inline double RepIfMerged::_internal_lc() const {
+  return _impl_.lc_;
 }
-inline std::string* CommitAbortKey::release_key() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.CommitAbortKey.key)
-  return _impl_.key_.Release();
+inline double RepIfMerged::lc() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.lc)
+  return _internal_lc();
 }
-inline void CommitAbortKey::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.CommitAbortKey.key)
+inline void RepIfMerged::_internal_set_lc(double value) {
+  
+  _impl_.lc_ = value;
+}
+inline void RepIfMerged::set_lc(double value) {
+  _internal_set_lc(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.lc)
 }
 
-// bool ifcommitmetadata = 2;
-inline void CommitAbortKey::clear_ifcommitmetadata() {
-  _impl_.ifcommitmetadata_ = false;
+// double gc = 3;
+inline void RepIfMerged::clear_gc() {
+  _impl_.gc_ = 0;
 }
-inline bool CommitAbortKey::_internal_ifcommitmetadata() const {
-  return _impl_.ifcommitmetadata_;
+inline double RepIfMerged::_internal_gc() const {
+  return _impl_.gc_;
 }
-inline bool CommitAbortKey::ifcommitmetadata() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKey.ifcommitmetadata)
-  return _internal_ifcommitmetadata();
+inline double RepIfMerged::gc() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.gc)
+  return _internal_gc();
 }
-inline void CommitAbortKey::_internal_set_ifcommitmetadata(bool value) {
+inline void RepIfMerged::_internal_set_gc(double value) {
   
-  _impl_.ifcommitmetadata_ = value;
+  _impl_.gc_ = value;
 }
-inline void CommitAbortKey::set_ifcommitmetadata(bool value) {
-  _internal_set_ifcommitmetadata(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.CommitAbortKey.ifcommitmetadata)
+inline void RepIfMerged::set_gc(double value) {
+  _internal_set_gc(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.gc)
 }
 
-// int32 opp = 3;
-inline void CommitAbortKey::clear_opp() {
-  _impl_.opp_ = 0;
+// double dc = 4;
+inline void RepIfMerged::clear_dc() {
+  _impl_.dc_ = 0;
 }
-inline int32_t CommitAbortKey::_internal_opp() const {
-  return _impl_.opp_;
+inline double RepIfMerged::_internal_dc() const {
+  return _impl_.dc_;
 }
-inline int32_t CommitAbortKey::opp() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKey.opp)
-  return _internal_opp();
+inline double RepIfMerged::dc() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.dc)
+  return _internal_dc();
 }
-inline void CommitAbortKey::_internal_set_opp(int32_t value) {
+inline void RepIfMerged::_internal_set_dc(double value) {
   
-  _impl_.opp_ = value;
+  _impl_.dc_ = value;
 }
-inline void CommitAbortKey::set_opp(int32_t value) {
-  _internal_set_opp(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.CommitAbortKey.opp)
+inline void RepIfMerged::set_dc(double value) {
+  _internal_set_dc(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.dc)
 }
 
-// int32 stripe_id = 4;
-inline void CommitAbortKey::clear_stripe_id() {
-  _impl_.stripe_id_ = 0;
+// int32 g_cross = 5;
+inline void RepIfMerged::clear_g_cross() {
+  _impl_.g_cross_ = 0;
 }
-inline int32_t CommitAbortKey::_internal_stripe_id() const {
-  return _impl_.stripe_id_;
+inline int32_t RepIfMerged::_internal_g_cross() const {
+  return _impl_.g_cross_;
 }
-inline int32_t CommitAbortKey::stripe_id() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.CommitAbortKey.stripe_id)
-  return _internal_stripe_id();
+inline int32_t RepIfMerged::g_cross() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.g_cross)
+  return _internal_g_cross();
 }
-inline void CommitAbortKey::_internal_set_stripe_id(int32_t value) {
+inline void RepIfMerged::_internal_set_g_cross(int32_t value) {
   
-  _impl_.stripe_id_ = value;
+  _impl_.g_cross_ = value;
 }
-inline void CommitAbortKey::set_stripe_id(int32_t value) {
-  _internal_set_stripe_id(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.CommitAbortKey.stripe_id)
+inline void RepIfMerged::set_g_cross(int32_t value) {
+  _internal_set_g_cross(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.g_cross)
 }
 
-// -------------------------------------------------------------------
-
-// AskIfSuccess
-
-// string key = 1;
-inline void AskIfSuccess::clear_key() {
-  _impl_.key_.ClearToEmpty();
+// int32 g_intra = 6;
+inline void RepIfMerged::clear_g_intra() {
+  _impl_.g_intra_ = 0;
 }
-inline const std::string& AskIfSuccess::key() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.AskIfSuccess.key)
-  return _internal_key();
+inline int32_t RepIfMerged::_internal_g_intra() const {
+  return _impl_.g_intra_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void AskIfSuccess::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.AskIfSuccess.key)
+inline int32_t RepIfMerged::g_intra() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.g_intra)
+  return _internal_g_intra();
 }
-inline std::string* AskIfSuccess::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.AskIfSuccess.key)
-  return _s;
+inline void RepIfMerged::_internal_set_g_intra(int32_t value) {
+  
+  _impl_.g_intra_ = value;
+}
+inline void RepIfMerged::set_g_intra(int32_t value) {
+  _internal_set_g_intra(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.g_intra)
+}
+
+// int32 l_cross = 7;
+inline void RepIfMerged::clear_l_cross() {
+  _impl_.l_cross_ = 0;
+}
+inline int32_t RepIfMerged::_internal_l_cross() const {
+  return _impl_.l_cross_;
 }
-inline const std::string& AskIfSuccess::_internal_key() const {
-  return _impl_.key_.Get();
+inline int32_t RepIfMerged::l_cross() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.l_cross)
+  return _internal_l_cross();
 }
-inline void AskIfSuccess::_internal_set_key(const std::string& value) {
+inline void RepIfMerged::_internal_set_l_cross(int32_t value) {
   
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.l_cross_ = value;
 }
-inline std::string* AskIfSuccess::_internal_mutable_key() {
-  
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+inline void RepIfMerged::set_l_cross(int32_t value) {
+  _internal_set_l_cross(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.l_cross)
 }
-inline std::string* AskIfSuccess::release_key() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.AskIfSuccess.key)
-  return _impl_.key_.Release();
+
+// int32 l_intra = 8;
+inline void RepIfMerged::clear_l_intra() {
+  _impl_.l_intra_ = 0;
 }
-inline void AskIfSuccess::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.AskIfSuccess.key)
+inline int32_t RepIfMerged::_internal_l_intra() const {
+  return _impl_.l_intra_;
+}
+inline int32_t RepIfMerged::l_intra() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.l_intra)
+  return _internal_l_intra();
+}
+inline void RepIfMerged::_internal_set_l_intra(int32_t value) {
+  
+  _impl_.l_intra_ = value;
+}
+inline void RepIfMerged::set_l_intra(int32_t value) {
+  _internal_set_l_intra(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.l_intra)
 }
 
-// int32 opp = 2;
-inline void AskIfSuccess::clear_opp() {
-  _impl_.opp_ = 0;
+// int32 d_cross = 9;
+inline void RepIfMerged::clear_d_cross() {
+  _impl_.d_cross_ = 0;
 }
-inline int32_t AskIfSuccess::_internal_opp() const {
-  return _impl_.opp_;
+inline int32_t RepIfMerged::_internal_d_cross() const {
+  return _impl_.d_cross_;
 }
-inline int32_t AskIfSuccess::opp() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.AskIfSuccess.opp)
-  return _internal_opp();
+inline int32_t RepIfMerged::d_cross() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.d_cross)
+  return _internal_d_cross();
 }
-inline void AskIfSuccess::_internal_set_opp(int32_t value) {
+inline void RepIfMerged::_internal_set_d_cross(int32_t value) {
   
-  _impl_.opp_ = value;
+  _impl_.d_cross_ = value;
 }
-inline void AskIfSuccess::set_opp(int32_t value) {
-  _internal_set_opp(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.AskIfSuccess.opp)
+inline void RepIfMerged::set_d_cross(int32_t value) {
+  _internal_set_d_cross(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.d_cross)
 }
 
-// int32 stripe_id = 3;
-inline void AskIfSuccess::clear_stripe_id() {
-  _impl_.stripe_id_ = 0;
+// int32 d_intra = 10;
+inline void RepIfMerged::clear_d_intra() {
+  _impl_.d_intra_ = 0;
 }
-inline int32_t AskIfSuccess::_internal_stripe_id() const {
-  return _impl_.stripe_id_;
+inline int32_t RepIfMerged::_internal_d_intra() const {
+  return _impl_.d_intra_;
 }
-inline int32_t AskIfSuccess::stripe_id() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.AskIfSuccess.stripe_id)
-  return _internal_stripe_id();
+inline int32_t RepIfMerged::d_intra() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.d_intra)
+  return _internal_d_intra();
 }
-inline void AskIfSuccess::_internal_set_stripe_id(int32_t value) {
+inline void RepIfMerged::_internal_set_d_intra(int32_t value) {
   
-  _impl_.stripe_id_ = value;
+  _impl_.d_intra_ = value;
 }
-inline void AskIfSuccess::set_stripe_id(int32_t value) {
-  _internal_set_stripe_id(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.AskIfSuccess.stripe_id)
+inline void RepIfMerged::set_d_intra(int32_t value) {
+  _internal_set_d_intra(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.d_intra)
 }
 
 // -------------------------------------------------------------------
 
-// RepIfSuccess
+// MergeJobRequest
 
-// bool ifcommit = 1;
-inline void RepIfSuccess::clear_ifcommit() {
-  _impl_.ifcommit_ = false;
+// repeated int32 num_of_stripes = 1;
+inline int MergeJobRequest::_internal_num_of_stripes_size() const {
+  return _impl_.num_of_stripes_.size();
 }
-inline bool RepIfSuccess::_internal_ifcommit() const {
-  return _impl_.ifcommit_;
+inline int MergeJobRequest::num_of_stripes_size() const {
+  return _internal_num_of_stripes_size();
 }
-inline bool RepIfSuccess::ifcommit() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfSuccess.ifcommit)
-  return _internal_ifcommit();
+inline void MergeJobRequest::clear_num_of_stripes() {
+  _impl_.num_of_stripes_.Clear();
 }
-inline void RepIfSuccess::_internal_set_ifcommit(bool value) {
+inline int32_t MergeJobRequest::_internal_num_of_stripes(int index) const {
+  return _impl_.num_of_stripes_.Get(index);
+}
+inline int32_t MergeJobRequest::num_of_stripes(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobRequest.num_of_stripes)
+  return _internal_num_of_stripes(index);
+}
+inline void MergeJobRequest::set_num_of_stripes(int index, int32_t value) {
+  _impl_.num_of_stripes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobRequest.num_of_stripes)
+}
+inline void MergeJobRequest::_internal_add_num_of_stripes(int32_t value) {
+  _impl_.num_of_stripes_.Add(value);
+}
+inline void MergeJobRequest::add_num_of_stripes(int32_t value) {
+  _internal_add_num_of_stripes(value);
+  // @@protoc_insertion_point(field_add:coordinator_proto.MergeJobRequest.num_of_stripes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+MergeJobRequest::_internal_num_of_stripes() const {
+  return _impl_.num_of_stripes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+MergeJobRequest::num_of_stripes() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.MergeJobRequest.num_of_stripes)
+  return _internal_num_of_stripes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+MergeJobRequest::_internal_mutable_num_of_stripes() {
+  return &_impl_.num_of_stripes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+MergeJobRequest::mutable_num_of_stripes() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.MergeJobRequest.num_of_stripes)
+  return _internal_mutable_num_of_stripes();
+}
+
+// int32 max_concurrency = 2;
+inline void MergeJobRequest::clear_max_concurrency() {
+  _impl_.max_concurrency_ = 0;
+}
+inline int32_t MergeJobRequest::_internal_max_concurrency() const {
+  return _impl_.max_concurrency_;
+}
+inline int32_t MergeJobRequest::max_concurrency() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobRequest.max_concurrency)
+  return _internal_max_concurrency();
+}
+inline void MergeJobRequest::_internal_set_max_concurrency(int32_t value) {
   
-  _impl_.ifcommit_ = value;
+  _impl_.max_concurrency_ = value;
 }
-inline void RepIfSuccess::set_ifcommit(bool value) {
-  _internal_set_ifcommit(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfSuccess.ifcommit)
+inline void MergeJobRequest::set_max_concurrency(int32_t value) {
+  _internal_set_max_concurrency(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobRequest.max_concurrency)
 }
 
 // -------------------------------------------------------------------
 
-// KeyAndClientIP
+// MergePlanRequest
 
-// string key = 1;
-inline void KeyAndClientIP::clear_key() {
-  _impl_.key_.ClearToEmpty();
-}
-inline const std::string& KeyAndClientIP::key() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.KeyAndClientIP.key)
-  return _internal_key();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void KeyAndClientIP::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.KeyAndClientIP.key)
+// int32 merge_factor = 1;
+inline void MergePlanRequest::clear_merge_factor() {
+  _impl_.merge_factor_ = 0;
 }
-inline std::string* KeyAndClientIP::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeyAndClientIP.key)
-  return _s;
+inline int32_t MergePlanRequest::_internal_merge_factor() const {
+  return _impl_.merge_factor_;
 }
-inline const std::string& KeyAndClientIP::_internal_key() const {
-  return _impl_.key_.Get();
+inline int32_t MergePlanRequest::merge_factor() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePlanRequest.merge_factor)
+  return _internal_merge_factor();
 }
-inline void KeyAndClientIP::_internal_set_key(const std::string& value) {
+inline void MergePlanRequest::_internal_set_merge_factor(int32_t value) {
   
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.merge_factor_ = value;
 }
-inline std::string* KeyAndClientIP::_internal_mutable_key() {
-  
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+inline void MergePlanRequest::set_merge_factor(int32_t value) {
+  _internal_set_merge_factor(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePlanRequest.merge_factor)
 }
-inline std::string* KeyAndClientIP::release_key() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.KeyAndClientIP.key)
-  return _impl_.key_.Release();
+
+// int32 max_stages = 2;
+inline void MergePlanRequest::clear_max_stages() {
+  _impl_.max_stages_ = 0;
 }
-inline void KeyAndClientIP::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.KeyAndClientIP.key)
+inline int32_t MergePlanRequest::_internal_max_stages() const {
+  return _impl_.max_stages_;
 }
-
-// string clientip = 2;
-inline void KeyAndClientIP::clear_clientip() {
-  _impl_.clientip_.ClearToEmpty();
+inline int32_t MergePlanRequest::max_stages() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePlanRequest.max_stages)
+  return _internal_max_stages();
 }
-inline const std::string& KeyAndClientIP::clientip() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.KeyAndClientIP.clientip)
-  return _internal_clientip();
+inline void MergePlanRequest::_internal_set_max_stages(int32_t value) {
+  
+  _impl_.max_stages_ = value;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void KeyAndClientIP::set_clientip(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.clientip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.KeyAndClientIP.clientip)
+inline void MergePlanRequest::set_max_stages(int32_t value) {
+  _internal_set_max_stages(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePlanRequest.max_stages)
 }
-inline std::string* KeyAndClientIP::mutable_clientip() {
-  std::string* _s = _internal_mutable_clientip();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeyAndClientIP.clientip)
-  return _s;
+
+// bool execute = 3;
+inline void MergePlanRequest::clear_execute() {
+  _impl_.execute_ = false;
 }
-inline const std::string& KeyAndClientIP::_internal_clientip() const {
-  return _impl_.clientip_.Get();
+inline bool MergePlanRequest::_internal_execute() const {
+  return _impl_.execute_;
 }
-inline void KeyAndClientIP::_internal_set_clientip(const std::string& value) {
-  
-  _impl_.clientip_.Set(value, GetArenaForAllocation());
+inline bool MergePlanRequest::execute() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePlanRequest.execute)
+  return _internal_execute();
 }
-inline std::string* KeyAndClientIP::_internal_mutable_clientip() {
+inline void MergePlanRequest::_internal_set_execute(bool value) {
   
-  return _impl_.clientip_.Mutable(GetArenaForAllocation());
-}
-inline std::string* KeyAndClientIP::release_clientip() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.KeyAndClientIP.clientip)
-  return _impl_.clientip_.Release();
+  _impl_.execute_ = value;
 }
-inline void KeyAndClientIP::set_allocated_clientip(std::string* clientip) {
-  if (clientip != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.clientip_.SetAllocated(clientip, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.clientip_.IsDefault()) {
-    _impl_.clientip_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.KeyAndClientIP.clientip)
+inline void MergePlanRequest::set_execute(bool value) {
+  _internal_set_execute(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePlanRequest.execute)
 }
 
-// int32 clientport = 3;
-inline void KeyAndClientIP::clear_clientport() {
-  _impl_.clientport_ = 0;
+// int32 max_concurrency = 4;
+inline void MergePlanRequest::clear_max_concurrency() {
+  _impl_.max_concurrency_ = 0;
 }
-inline int32_t KeyAndClientIP::_internal_clientport() const {
-  return _impl_.clientport_;
+inline int32_t MergePlanRequest::_internal_max_concurrency() const {
+  return _impl_.max_concurrency_;
 }
-inline int32_t KeyAndClientIP::clientport() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.KeyAndClientIP.clientport)
-  return _internal_clientport();
+inline int32_t MergePlanRequest::max_concurrency() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePlanRequest.max_concurrency)
+  return _internal_max_concurrency();
 }
-inline void KeyAndClientIP::_internal_set_clientport(int32_t value) {
+inline void MergePlanRequest::_internal_set_max_concurrency(int32_t value) {
   
-  _impl_.clientport_ = value;
+  _impl_.max_concurrency_ = value;
 }
-inline void KeyAndClientIP::set_clientport(int32_t value) {
-  _internal_set_clientport(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.KeyAndClientIP.clientport)
+inline void MergePlanRequest::set_max_concurrency(int32_t value) {
+  _internal_set_max_concurrency(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePlanRequest.max_concurrency)
 }
 
 // -------------------------------------------------------------------
 
-// RepIfGetSuccess
+// MergeSchedule
 
-// bool ifgetsuccess = 1;
-inline void RepIfGetSuccess::clear_ifgetsuccess() {
-  _impl_.ifgetsuccess_ = false;
+// bool ifplanned = 1;
+inline void MergeSchedule::clear_ifplanned() {
+  _impl_.ifplanned_ = false;
 }
-inline bool RepIfGetSuccess::_internal_ifgetsuccess() const {
-  return _impl_.ifgetsuccess_;
+inline bool MergeSchedule::_internal_ifplanned() const {
+  return _impl_.ifplanned_;
 }
-inline bool RepIfGetSuccess::ifgetsuccess() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfGetSuccess.ifgetsuccess)
-  return _internal_ifgetsuccess();
+inline bool MergeSchedule::ifplanned() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeSchedule.ifplanned)
+  return _internal_ifplanned();
 }
-inline void RepIfGetSuccess::_internal_set_ifgetsuccess(bool value) {
+inline void MergeSchedule::_internal_set_ifplanned(bool value) {
   
-  _impl_.ifgetsuccess_ = value;
+  _impl_.ifplanned_ = value;
 }
-inline void RepIfGetSuccess::set_ifgetsuccess(bool value) {
-  _internal_set_ifgetsuccess(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfGetSuccess.ifgetsuccess)
+inline void MergeSchedule::set_ifplanned(bool value) {
+  _internal_set_ifplanned(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeSchedule.ifplanned)
 }
 
-// int32 valuesizebytes = 2;
-inline void RepIfGetSuccess::clear_valuesizebytes() {
-  _impl_.valuesizebytes_ = 0;
+// repeated int32 num_of_stripes = 2;
+inline int MergeSchedule::_internal_num_of_stripes_size() const {
+  return _impl_.num_of_stripes_.size();
 }
-inline int32_t RepIfGetSuccess::_internal_valuesizebytes() const {
-  return _impl_.valuesizebytes_;
+inline int MergeSchedule::num_of_stripes_size() const {
+  return _internal_num_of_stripes_size();
 }
-inline int32_t RepIfGetSuccess::valuesizebytes() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfGetSuccess.valuesizebytes)
-  return _internal_valuesizebytes();
+inline void MergeSchedule::clear_num_of_stripes() {
+  _impl_.num_of_stripes_.Clear();
 }
-inline void RepIfGetSuccess::_internal_set_valuesizebytes(int32_t value) {
-  
-  _impl_.valuesizebytes_ = value;
+inline int32_t MergeSchedule::_internal_num_of_stripes(int index) const {
+  return _impl_.num_of_stripes_.Get(index);
 }
-inline void RepIfGetSuccess::set_valuesizebytes(int32_t value) {
-  _internal_set_valuesizebytes(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfGetSuccess.valuesizebytes)
+inline int32_t MergeSchedule::num_of_stripes(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeSchedule.num_of_stripes)
+  return _internal_num_of_stripes(index);
+}
+inline void MergeSchedule::set_num_of_stripes(int index, int32_t value) {
+  _impl_.num_of_stripes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeSchedule.num_of_stripes)
+}
+inline void MergeSchedule::_internal_add_num_of_stripes(int32_t value) {
+  _impl_.num_of_stripes_.Add(value);
+}
+inline void MergeSchedule::add_num_of_stripes(int32_t value) {
+  _internal_add_num_of_stripes(value);
+  // @@protoc_insertion_point(field_add:coordinator_proto.MergeSchedule.num_of_stripes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+MergeSchedule::_internal_num_of_stripes() const {
+  return _impl_.num_of_stripes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+MergeSchedule::num_of_stripes() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.MergeSchedule.num_of_stripes)
+  return _internal_num_of_stripes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+MergeSchedule::_internal_mutable_num_of_stripes() {
+  return &_impl_.num_of_stripes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+MergeSchedule::mutable_num_of_stripes() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.MergeSchedule.num_of_stripes)
+  return _internal_mutable_num_of_stripes();
 }
 
-// -------------------------------------------------------------------
-
-// KeyFromClient
+// int32 cross_blocks = 3;
+inline void MergeSchedule::clear_cross_blocks() {
+  _impl_.cross_blocks_ = 0;
+}
+inline int32_t MergeSchedule::_internal_cross_blocks() const {
+  return _impl_.cross_blocks_;
+}
+inline int32_t MergeSchedule::cross_blocks() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeSchedule.cross_blocks)
+  return _internal_cross_blocks();
+}
+inline void MergeSchedule::_internal_set_cross_blocks(int32_t value) {
+  
+  _impl_.cross_blocks_ = value;
+}
+inline void MergeSchedule::set_cross_blocks(int32_t value) {
+  _internal_set_cross_blocks(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeSchedule.cross_blocks)
+}
 
-// string key = 1;
-inline void KeyFromClient::clear_key() {
-  _impl_.key_.ClearToEmpty();
+// int32 intra_blocks = 4;
+inline void MergeSchedule::clear_intra_blocks() {
+  _impl_.intra_blocks_ = 0;
 }
-inline const std::string& KeyFromClient::key() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.KeyFromClient.key)
-  return _internal_key();
+inline int32_t MergeSchedule::_internal_intra_blocks() const {
+  return _impl_.intra_blocks_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void KeyFromClient::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:coordinator_proto.KeyFromClient.key)
+inline int32_t MergeSchedule::intra_blocks() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeSchedule.intra_blocks)
+  return _internal_intra_blocks();
 }
-inline std::string* KeyFromClient::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:coordinator_proto.KeyFromClient.key)
-  return _s;
+inline void MergeSchedule::_internal_set_intra_blocks(int32_t value) {
+  
+  _impl_.intra_blocks_ = value;
+}
+inline void MergeSchedule::set_intra_blocks(int32_t value) {
+  _internal_set_intra_blocks(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeSchedule.intra_blocks)
+}
+
+// int32 job_id = 5;
+inline void MergeSchedule::clear_job_id() {
+  _impl_.job_id_ = 0;
 }
-inline const std::string& KeyFromClient::_internal_key() const {
-  return _impl_.key_.Get();
+inline int32_t MergeSchedule::_internal_job_id() const {
+  return _impl_.job_id_;
 }
-inline void KeyFromClient::_internal_set_key(const std::string& value) {
-  
-  _impl_.key_.Set(value, GetArenaForAllocation());
+inline int32_t MergeSchedule::job_id() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeSchedule.job_id)
+  return _internal_job_id();
 }
-inline std::string* KeyFromClient::_internal_mutable_key() {
+inline void MergeSchedule::_internal_set_job_id(int32_t value) {
   
-  return _impl_.key_.Mutable(GetArenaForAllocation());
-}
-inline std::string* KeyFromClient::release_key() {
-  // @@protoc_insertion_point(field_release:coordinator_proto.KeyFromClient.key)
-  return _impl_.key_.Release();
+  _impl_.job_id_ = value;
 }
-inline void KeyFromClient::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:coordinator_proto.KeyFromClient.key)
+inline void MergeSchedule::set_job_id(int32_t value) {
+  _internal_set_job_id(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeSchedule.job_id)
 }
 
 // -------------------------------------------------------------------
 
-// StripeIdFromClient
+// AppendMergeRequest
 
 // int32 stripe_id = 1;
-inline void StripeIdFromClient::clear_stripe_id() {
+inline void AppendMergeRequest::clear_stripe_id() {
   _impl_.stripe_id_ = 0;
 }
-inline int32_t StripeIdFromClient::_internal_stripe_id() const {
+inline int32_t AppendMergeRequest::_internal_stripe_id() const {
   return _impl_.stripe_id_;
 }
-inline int32_t StripeIdFromClient::stripe_id() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.StripeIdFromClient.stripe_id)
+inline int32_t AppendMergeRequest::stripe_id() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.AppendMergeRequest.stripe_id)
   return _internal_stripe_id();
 }
-inline void StripeIdFromClient::_internal_set_stripe_id(int32_t value) {
+inline void AppendMergeRequest::_internal_set_stripe_id(int32_t value) {
   
   _impl_.stripe_id_ = value;
 }
-inline void StripeIdFromClient::set_stripe_id(int32_t value) {
+inline void AppendMergeRequest::set_stripe_id(int32_t value) {
   _internal_set_stripe_id(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.StripeIdFromClient.stripe_id)
+  // @@protoc_insertion_point(field_set:coordinator_proto.AppendMergeRequest.stripe_id)
+}
+
+// int32 wide_stripe_id = 2;
+inline void AppendMergeRequest::clear_wide_stripe_id() {
+  _impl_.wide_stripe_id_ = 0;
+}
+inline int32_t AppendMergeRequest::_internal_wide_stripe_id() const {
+  return _impl_.wide_stripe_id_;
+}
+inline int32_t AppendMergeRequest::wide_stripe_id() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.AppendMergeRequest.wide_stripe_id)
+  return _internal_wide_stripe_id();
+}
+inline void AppendMergeRequest::_internal_set_wide_stripe_id(int32_t value) {
+  
+  _impl_.wide_stripe_id_ = value;
+}
+inline void AppendMergeRequest::set_wide_stripe_id(int32_t value) {
+  _internal_set_wide_stripe_id(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.AppendMergeRequest.wide_stripe_id)
 }
 
 // -------------------------------------------------------------------
 
-// RepIfDeling
+// MergeJobId
 
-// bool ifdeling = 1;
-inline void RepIfDeling::clear_ifdeling() {
-  _impl_.ifdeling_ = false;
+// int32 job_id = 1;
+inline void MergeJobId::clear_job_id() {
+  _impl_.job_id_ = 0;
 }
-inline bool RepIfDeling::_internal_ifdeling() const {
-  return _impl_.ifdeling_;
+inline int32_t MergeJobId::_internal_job_id() const {
+  return _impl_.job_id_;
 }
-inline bool RepIfDeling::ifdeling() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfDeling.ifdeling)
-  return _internal_ifdeling();
+inline int32_t MergeJobId::job_id() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobId.job_id)
+  return _internal_job_id();
 }
-inline void RepIfDeling::_internal_set_ifdeling(bool value) {
+inline void MergeJobId::_internal_set_job_id(int32_t value) {
   
-  _impl_.ifdeling_ = value;
+  _impl_.job_id_ = value;
 }
-inline void RepIfDeling::set_ifdeling(bool value) {
-  _internal_set_ifdeling(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfDeling.ifdeling)
+inline void MergeJobId::set_job_id(int32_t value) {
+  _internal_set_job_id(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobId.job_id)
 }
 
 // -------------------------------------------------------------------
 
-// NumberOfStripesToMerge
+// MergeJobStatus
 
-// int32 num_of_stripes = 1;
-inline void NumberOfStripesToMerge::clear_num_of_stripes() {
-  _impl_.num_of_stripes_ = 0;
+// int32 job_id = 1;
+inline void MergeJobStatus::clear_job_id() {
+  _impl_.job_id_ = 0;
 }
-inline int32_t NumberOfStripesToMerge::_internal_num_of_stripes() const {
-  return _impl_.num_of_stripes_;
+inline int32_t MergeJobStatus::_internal_job_id() const {
+  return _impl_.job_id_;
 }
-inline int32_t NumberOfStripesToMerge::num_of_stripes() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.NumberOfStripesToMerge.num_of_stripes)
-  return _internal_num_of_stripes();
+inline int32_t MergeJobStatus::job_id() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.job_id)
+  return _internal_job_id();
 }
-inline void NumberOfStripesToMerge::_internal_set_num_of_stripes(int32_t value) {
+inline void MergeJobStatus::_internal_set_job_id(int32_t value) {
   
-  _impl_.num_of_stripes_ = value;
+  _impl_.job_id_ = value;
 }
-inline void NumberOfStripesToMerge::set_num_of_stripes(int32_t value) {
-  _internal_set_num_of_stripes(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.NumberOfStripesToMerge.num_of_stripes)
+inline void MergeJobStatus::set_job_id(int32_t value) {
+  _internal_set_job_id(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.job_id)
 }
 
-// -------------------------------------------------------------------
+// int32 state = 2;
+inline void MergeJobStatus::clear_state() {
+  _impl_.state_ = 0;
+}
+inline int32_t MergeJobStatus::_internal_state() const {
+  return _impl_.state_;
+}
+inline int32_t MergeJobStatus::state() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.state)
+  return _internal_state();
+}
+inline void MergeJobStatus::_internal_set_state(int32_t value) {
+  
+  _impl_.state_ = value;
+}
+inline void MergeJobStatus::set_state(int32_t value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.state)
+}
 
-// RepIfMerged
+// int32 stages_done = 3;
+inline void MergeJobStatus::clear_stages_done() {
+  _impl_.stages_done_ = 0;
+}
+inline int32_t MergeJobStatus::_internal_stages_done() const {
+  return _impl_.stages_done_;
+}
+inline int32_t MergeJobStatus::stages_done() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.stages_done)
+  return _internal_stages_done();
+}
+inline void MergeJobStatus::_internal_set_stages_done(int32_t value) {
+  
+  _impl_.stages_done_ = value;
+}
+inline void MergeJobStatus::set_stages_done(int32_t value) {
+  _internal_set_stages_done(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.stages_done)
+}
 
-// bool ifmerged = 1;
-inline void RepIfMerged::clear_ifmerged() {
-  _impl_.ifmerged_ = false;
+// int32 stages_total = 4;
+inline void MergeJobStatus::clear_stages_total() {
+  _impl_.stages_total_ = 0;
 }
-inline bool RepIfMerged::_internal_ifmerged() const {
-  return _impl_.ifmerged_;
+inline int32_t MergeJobStatus::_internal_stages_total() const {
+  return _impl_.stages_total_;
 }
-inline bool RepIfMerged::ifmerged() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.ifmerged)
-  return _internal_ifmerged();
+inline int32_t MergeJobStatus::stages_total() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.stages_total)
+  return _internal_stages_total();
 }
-inline void RepIfMerged::_internal_set_ifmerged(bool value) {
+inline void MergeJobStatus::_internal_set_stages_total(int32_t value) {
   
-  _impl_.ifmerged_ = value;
+  _impl_.stages_total_ = value;
 }
-inline void RepIfMerged::set_ifmerged(bool value) {
-  _internal_set_ifmerged(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.ifmerged)
+inline void MergeJobStatus::set_stages_total(int32_t value) {
+  _internal_set_stages_total(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.stages_total)
 }
 
-// double lc = 2;
-inline void RepIfMerged::clear_lc() {
+// int32 stripes_merged = 5;
+inline void MergeJobStatus::clear_stripes_merged() {
+  _impl_.stripes_merged_ = 0;
+}
+inline int32_t MergeJobStatus::_internal_stripes_merged() const {
+  return _impl_.stripes_merged_;
+}
+inline int32_t MergeJobStatus::stripes_merged() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.stripes_merged)
+  return _internal_stripes_merged();
+}
+inline void MergeJobStatus::_internal_set_stripes_merged(int32_t value) {
+  
+  _impl_.stripes_merged_ = value;
+}
+inline void MergeJobStatus::set_stripes_merged(int32_t value) {
+  _internal_set_stripes_merged(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.stripes_merged)
+}
+
+// int32 stripes_total = 6;
+inline void MergeJobStatus::clear_stripes_total() {
+  _impl_.stripes_total_ = 0;
+}
+inline int32_t MergeJobStatus::_internal_stripes_total() const {
+  return _impl_.stripes_total_;
+}
+inline int32_t MergeJobStatus::stripes_total() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.stripes_total)
+  return _internal_stripes_total();
+}
+inline void MergeJobStatus::_internal_set_stripes_total(int32_t value) {
+  
+  _impl_.stripes_total_ = value;
+}
+inline void MergeJobStatus::set_stripes_total(int32_t value) {
+  _internal_set_stripes_total(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.stripes_total)
+}
+
+// int64 g_bytes = 7;
+inline void MergeJobStatus::clear_g_bytes() {
+  _impl_.g_bytes_ = int64_t{0};
+}
+inline int64_t MergeJobStatus::_internal_g_bytes() const {
+  return _impl_.g_bytes_;
+}
+inline int64_t MergeJobStatus::g_bytes() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.g_bytes)
+  return _internal_g_bytes();
+}
+inline void MergeJobStatus::_internal_set_g_bytes(int64_t value) {
+  
+  _impl_.g_bytes_ = value;
+}
+inline void MergeJobStatus::set_g_bytes(int64_t value) {
+  _internal_set_g_bytes(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.g_bytes)
+}
+
+// int64 l_bytes = 8;
+inline void MergeJobStatus::clear_l_bytes() {
+  _impl_.l_bytes_ = int64_t{0};
+}
+inline int64_t MergeJobStatus::_internal_l_bytes() const {
+  return _impl_.l_bytes_;
+}
+inline int64_t MergeJobStatus::l_bytes() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.l_bytes)
+  return _internal_l_bytes();
+}
+inline void MergeJobStatus::_internal_set_l_bytes(int64_t value) {
+  
+  _impl_.l_bytes_ = value;
+}
+inline void MergeJobStatus::set_l_bytes(int64_t value) {
+  _internal_set_l_bytes(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.l_bytes)
+}
+
+// int64 d_bytes = 9;
+inline void MergeJobStatus::clear_d_bytes() {
+  _impl_.d_bytes_ = int64_t{0};
+}
+inline int64_t MergeJobStatus::_internal_d_bytes() const {
+  return _impl_.d_bytes_;
+}
+inline int64_t MergeJobStatus::d_bytes() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.d_bytes)
+  return _internal_d_bytes();
+}
+inline void MergeJobStatus::_internal_set_d_bytes(int64_t value) {
+  
+  _impl_.d_bytes_ = value;
+}
+inline void MergeJobStatus::set_d_bytes(int64_t value) {
+  _internal_set_d_bytes(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.d_bytes)
+}
+
+// double lc = 10;
+inline void MergeJobStatus::clear_lc() {
   _impl_.lc_ = 0;
 }
-inline double RepIfMerged::_internal_lc() const {
+inline double MergeJobStatus::_internal_lc() const {
   return _impl_.lc_;
 }
-inline double RepIfMerged::lc() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.lc)
+inline double MergeJobStatus::lc() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.lc)
   return _internal_lc();
 }
-inline void RepIfMerged::_internal_set_lc(double value) {
+inline void MergeJobStatus::_internal_set_lc(double value) {
   
   _impl_.lc_ = value;
 }
-inline void RepIfMerged::set_lc(double value) {
+inline void MergeJobStatus::set_lc(double value) {
   _internal_set_lc(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.lc)
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.lc)
 }
 
-// double gc = 3;
-inline void RepIfMerged::clear_gc() {
+// double gc = 11;
+inline void MergeJobStatus::clear_gc() {
   _impl_.gc_ = 0;
 }
-inline double RepIfMerged::_internal_gc() const {
+inline double MergeJobStatus::_internal_gc() const {
   return _impl_.gc_;
 }
-inline double RepIfMerged::gc() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.gc)
+inline double MergeJobStatus::gc() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.gc)
   return _internal_gc();
 }
-inline void RepIfMerged::_internal_set_gc(double value) {
+inline void MergeJobStatus::_internal_set_gc(double value) {
   
   _impl_.gc_ = value;
 }
-inline void RepIfMerged::set_gc(double value) {
+inline void MergeJobStatus::set_gc(double value) {
   _internal_set_gc(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.gc)
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.gc)
 }
 
-// double dc = 4;
-inline void RepIfMerged::clear_dc() {
+// double dc = 12;
+inline void MergeJobStatus::clear_dc() {
   _impl_.dc_ = 0;
 }
-inline double RepIfMerged::_internal_dc() const {
+inline double MergeJobStatus::_internal_dc() const {
   return _impl_.dc_;
 }
-inline double RepIfMerged::dc() const {
-  // @@protoc_insertion_point(field_get:coordinator_proto.RepIfMerged.dc)
+inline double MergeJobStatus::dc() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergeJobStatus.dc)
   return _internal_dc();
 }
-inline void RepIfMerged::_internal_set_dc(double value) {
+inline void MergeJobStatus::_internal_set_dc(double value) {
   
   _impl_.dc_ = value;
 }
-inline void RepIfMerged::set_dc(double value) {
+inline void MergeJobStatus::set_dc(double value) {
   _internal_set_dc(value);
-  // @@protoc_insertion_point(field_set:coordinator_proto.RepIfMerged.dc)
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergeJobStatus.dc)
+}
+
+// -------------------------------------------------------------------
+
+// MergePolicy
+
+// bool enable = 1;
+inline void MergePolicy::clear_enable() {
+  _impl_.enable_ = false;
+}
+inline bool MergePolicy::_internal_enable() const {
+  return _impl_.enable_;
+}
+inline bool MergePolicy::enable() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePolicy.enable)
+  return _internal_enable();
+}
+inline void MergePolicy::_internal_set_enable(bool value) {
+  
+  _impl_.enable_ = value;
+}
+inline void MergePolicy::set_enable(bool value) {
+  _internal_set_enable(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePolicy.enable)
+}
+
+// repeated int32 num_of_stripes = 2;
+inline int MergePolicy::_internal_num_of_stripes_size() const {
+  return _impl_.num_of_stripes_.size();
+}
+inline int MergePolicy::num_of_stripes_size() const {
+  return _internal_num_of_stripes_size();
+}
+inline void MergePolicy::clear_num_of_stripes() {
+  _impl_.num_of_stripes_.Clear();
+}
+inline int32_t MergePolicy::_internal_num_of_stripes(int index) const {
+  return _impl_.num_of_stripes_.Get(index);
+}
+inline int32_t MergePolicy::num_of_stripes(int index) const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePolicy.num_of_stripes)
+  return _internal_num_of_stripes(index);
+}
+inline void MergePolicy::set_num_of_stripes(int index, int32_t value) {
+  _impl_.num_of_stripes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePolicy.num_of_stripes)
+}
+inline void MergePolicy::_internal_add_num_of_stripes(int32_t value) {
+  _impl_.num_of_stripes_.Add(value);
+}
+inline void MergePolicy::add_num_of_stripes(int32_t value) {
+  _internal_add_num_of_stripes(value);
+  // @@protoc_insertion_point(field_add:coordinator_proto.MergePolicy.num_of_stripes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+MergePolicy::_internal_num_of_stripes() const {
+  return _impl_.num_of_stripes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+MergePolicy::num_of_stripes() const {
+  // @@protoc_insertion_point(field_list:coordinator_proto.MergePolicy.num_of_stripes)
+  return _internal_num_of_stripes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+MergePolicy::_internal_mutable_num_of_stripes() {
+  return &_impl_.num_of_stripes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+MergePolicy::mutable_num_of_stripes() {
+  // @@protoc_insertion_point(field_mutable_list:coordinator_proto.MergePolicy.num_of_stripes)
+  return _internal_mutable_num_of_stripes();
+}
+
+// int32 min_stripes_per_group = 3;
+inline void MergePolicy::clear_min_stripes_per_group() {
+  _impl_.min_stripes_per_group_ = 0;
+}
+inline int32_t MergePolicy::_internal_min_stripes_per_group() const {
+  return _impl_.min_stripes_per_group_;
+}
+inline int32_t MergePolicy::min_stripes_per_group() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePolicy.min_stripes_per_group)
+  return _internal_min_stripes_per_group();
+}
+inline void MergePolicy::_internal_set_min_stripes_per_group(int32_t value) {
+  
+  _impl_.min_stripes_per_group_ = value;
+}
+inline void MergePolicy::set_min_stripes_per_group(int32_t value) {
+  _internal_set_min_stripes_per_group(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePolicy.min_stripes_per_group)
+}
+
+// int32 max_ops_per_sec = 4;
+inline void MergePolicy::clear_max_ops_per_sec() {
+  _impl_.max_ops_per_sec_ = 0;
+}
+inline int32_t MergePolicy::_internal_max_ops_per_sec() const {
+  return _impl_.max_ops_per_sec_;
+}
+inline int32_t MergePolicy::max_ops_per_sec() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePolicy.max_ops_per_sec)
+  return _internal_max_ops_per_sec();
+}
+inline void MergePolicy::_internal_set_max_ops_per_sec(int32_t value) {
+  
+  _impl_.max_ops_per_sec_ = value;
+}
+inline void MergePolicy::set_max_ops_per_sec(int32_t value) {
+  _internal_set_max_ops_per_sec(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePolicy.max_ops_per_sec)
+}
+
+// int64 bandwidth = 5;
+inline void MergePolicy::clear_bandwidth() {
+  _impl_.bandwidth_ = int64_t{0};
+}
+inline int64_t MergePolicy::_internal_bandwidth() const {
+  return _impl_.bandwidth_;
+}
+inline int64_t MergePolicy::bandwidth() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePolicy.bandwidth)
+  return _internal_bandwidth();
+}
+inline void MergePolicy::_internal_set_bandwidth(int64_t value) {
+  
+  _impl_.bandwidth_ = value;
+}
+inline void MergePolicy::set_bandwidth(int64_t value) {
+  _internal_set_bandwidth(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePolicy.bandwidth)
+}
+
+// int32 check_interval_ms = 6;
+inline void MergePolicy::clear_check_interval_ms() {
+  _impl_.check_interval_ms_ = 0;
+}
+inline int32_t MergePolicy::_internal_check_interval_ms() const {
+  return _impl_.check_interval_ms_;
+}
+inline int32_t MergePolicy::check_interval_ms() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePolicy.check_interval_ms)
+  return _internal_check_interval_ms();
+}
+inline void MergePolicy::_internal_set_check_interval_ms(int32_t value) {
+  
+  _impl_.check_interval_ms_ = value;
+}
+inline void MergePolicy::set_check_interval_ms(int32_t value) {
+  _internal_set_check_interval_ms(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePolicy.check_interval_ms)
+}
+
+// int32 max_concurrency = 7;
+inline void MergePolicy::clear_max_concurrency() {
+  _impl_.max_concurrency_ = 0;
+}
+inline int32_t MergePolicy::_internal_max_concurrency() const {
+  return _impl_.max_concurrency_;
+}
+inline int32_t MergePolicy::max_concurrency() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePolicy.max_concurrency)
+  return _internal_max_concurrency();
+}
+inline void MergePolicy::_internal_set_max_concurrency(int32_t value) {
+  
+  _impl_.max_concurrency_ = value;
+}
+inline void MergePolicy::set_max_concurrency(int32_t value) {
+  _internal_set_max_concurrency(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePolicy.max_concurrency)
+}
+
+// int32 split_min_accesses = 8;
+inline void MergePolicy::clear_split_min_accesses() {
+  _impl_.split_min_accesses_ = 0;
+}
+inline int32_t MergePolicy::_internal_split_min_accesses() const {
+  return _impl_.split_min_accesses_;
+}
+inline int32_t MergePolicy::split_min_accesses() const {
+  // @@protoc_insertion_point(field_get:coordinator_proto.MergePolicy.split_min_accesses)
+  return _internal_split_min_accesses();
+}
+inline void MergePolicy::_internal_set_split_min_accesses(int32_t value) {
+  
+  _impl_.split_min_accesses_ = value;
+}
+inline void MergePolicy::set_split_min_accesses(int32_t value) {
+  _internal_set_split_min_accesses(value);
+  // @@protoc_insertion_point(field_set:coordinator_proto.MergePolicy.split_min_accesses)
 }
 
 // -------------------------------------------------------------------
@@ -4091,6 +8852,38 @@ RepStripeIds::mutable_stripe_ids() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
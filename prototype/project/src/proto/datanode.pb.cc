@@ -48,6 +48,21 @@ struct RequestResultDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestResultDefaultTypeInternal _RequestResult_default_instance_;
+PROTOBUF_CONSTEXPR NodeStatus::NodeStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.free_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.io_bytes_per_sec_)*/int64_t{0}
+  , /*decltype(_impl_.block_num_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NodeStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeStatusDefaultTypeInternal() {}
+  union {
+    NodeStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeStatusDefaultTypeInternal _NodeStatus_default_instance_;
 PROTOBUF_CONSTEXPR SetInfo::SetInfo(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.block_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -73,6 +88,7 @@ PROTOBUF_CONSTEXPR GetInfo::GetInfo(
   , /*decltype(_impl_.block_size_)*/0
   , /*decltype(_impl_.block_id_)*/0
   , /*decltype(_impl_.proxy_port_)*/0
+  , /*decltype(_impl_.offset_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct GetInfoDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetInfoDefaultTypeInternal()
@@ -97,7 +113,7 @@ struct DelInfoDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DelInfoDefaultTypeInternal _DelInfo_default_instance_;
 }  // namespace datanode_proto
-static ::_pb::Metadata file_level_metadata_datanode_2eproto[5];
+static ::_pb::Metadata file_level_metadata_datanode_2eproto[6];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_datanode_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_datanode_2eproto = nullptr;
 
@@ -118,6 +134,15 @@ const uint32_t TableStruct_datanode_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   PROTOBUF_FIELD_OFFSET(::datanode_proto::RequestResult, _impl_.message_),
   PROTOBUF_FIELD_OFFSET(::datanode_proto::RequestResult, _impl_.valuesizebytes_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::datanode_proto::NodeStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::datanode_proto::NodeStatus, _impl_.free_bytes_),
+  PROTOBUF_FIELD_OFFSET(::datanode_proto::NodeStatus, _impl_.block_num_),
+  PROTOBUF_FIELD_OFFSET(::datanode_proto::NodeStatus, _impl_.io_bytes_per_sec_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::datanode_proto::SetInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -140,6 +165,7 @@ const uint32_t TableStruct_datanode_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   PROTOBUF_FIELD_OFFSET(::datanode_proto::GetInfo, _impl_.block_id_),
   PROTOBUF_FIELD_OFFSET(::datanode_proto::GetInfo, _impl_.proxy_ip_),
   PROTOBUF_FIELD_OFFSET(::datanode_proto::GetInfo, _impl_.proxy_port_),
+  PROTOBUF_FIELD_OFFSET(::datanode_proto::GetInfo, _impl_.offset_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::datanode_proto::DelInfo, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -151,14 +177,16 @@ const uint32_t TableStruct_datanode_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::datanode_proto::CheckaliveCMD)},
   { 7, -1, -1, sizeof(::datanode_proto::RequestResult)},
-  { 15, -1, -1, sizeof(::datanode_proto::SetInfo)},
-  { 27, -1, -1, sizeof(::datanode_proto::GetInfo)},
-  { 38, -1, -1, sizeof(::datanode_proto::DelInfo)},
+  { 15, -1, -1, sizeof(::datanode_proto::NodeStatus)},
+  { 24, -1, -1, sizeof(::datanode_proto::SetInfo)},
+  { 36, -1, -1, sizeof(::datanode_proto::GetInfo)},
+  { 48, -1, -1, sizeof(::datanode_proto::DelInfo)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::datanode_proto::_CheckaliveCMD_default_instance_._instance,
   &::datanode_proto::_RequestResult_default_instance_._instance,
+  &::datanode_proto::_NodeStatus_default_instance_._instance,
   &::datanode_proto::_SetInfo_default_instance_._instance,
   &::datanode_proto::_GetInfo_default_instance_._instance,
   &::datanode_proto::_DelInfo_default_instance_._instance,
@@ -168,27 +196,31 @@ const char descriptor_table_protodef_datanode_2eproto[] PROTOBUF_SECTION_VARIABL
   "\n\016datanode.proto\022\016datanode_proto\"\035\n\rChec"
   "kaliveCMD\022\014\n\004name\030\001 \001(\t\"8\n\rRequestResult"
   "\022\017\n\007message\030\001 \001(\010\022\026\n\016valuesizebytes\030\002 \001("
-  "\005\"x\n\007SetInfo\022\021\n\tblock_key\030\001 \001(\t\022\022\n\nblock"
-  "_size\030\002 \001(\005\022\020\n\010block_id\030\003 \001(\005\022\020\n\010proxy_i"
-  "p\030\004 \001(\t\022\022\n\nproxy_port\030\005 \001(\005\022\016\n\006ispull\030\006 "
-  "\001(\010\"h\n\007GetInfo\022\021\n\tblock_key\030\001 \001(\t\022\022\n\nblo"
-  "ck_size\030\002 \001(\005\022\020\n\010block_id\030\003 \001(\005\022\020\n\010proxy"
-  "_ip\030\004 \001(\t\022\022\n\nproxy_port\030\005 \001(\005\"\034\n\007DelInfo"
-  "\022\021\n\tblock_key\030\001 \001(\t2\257\002\n\017datanodeService\022"
-  "J\n\ncheckalive\022\035.datanode_proto.Checkaliv"
-  "eCMD\032\035.datanode_proto.RequestResult\022C\n\th"
-  "andleSet\022\027.datanode_proto.SetInfo\032\035.data"
-  "node_proto.RequestResult\022C\n\thandleGet\022\027."
-  "datanode_proto.GetInfo\032\035.datanode_proto."
-  "RequestResult\022F\n\014handleDelete\022\027.datanode"
-  "_proto.DelInfo\032\035.datanode_proto.RequestR"
-  "esultb\006proto3"
+  "\005\"M\n\nNodeStatus\022\022\n\nfree_bytes\030\001 \001(\003\022\021\n\tb"
+  "lock_num\030\002 \001(\005\022\030\n\020io_bytes_per_sec\030\003 \001(\003"
+  "\"x\n\007SetInfo\022\021\n\tblock_key\030\001 \001(\t\022\022\n\nblock_"
+  "size\030\002 \001(\005\022\020\n\010block_id\030\003 \001(\005\022\020\n\010proxy_ip"
+  "\030\004 \001(\t\022\022\n\nproxy_port\030\005 \001(\005\022\016\n\006ispull\030\006 \001"
+  "(\010\"x\n\007GetInfo\022\021\n\tblock_key\030\001 \001(\t\022\022\n\nbloc"
+  "k_size\030\002 \001(\005\022\020\n\010block_id\030\003 \001(\005\022\020\n\010proxy_"
+  "ip\030\004 \001(\t\022\022\n\nproxy_port\030\005 \001(\005\022\016\n\006offset\030\006"
+  " \001(\005\"\034\n\007DelInfo\022\021\n\tblock_key\030\001 \001(\t2\367\002\n\017d"
+  "atanodeService\022J\n\ncheckalive\022\035.datanode_"
+  "proto.CheckaliveCMD\032\035.datanode_proto.Req"
+  "uestResult\022C\n\thandleSet\022\027.datanode_proto"
+  ".SetInfo\032\035.datanode_proto.RequestResult\022"
+  "C\n\thandleGet\022\027.datanode_proto.GetInfo\032\035."
+  "datanode_proto.RequestResult\022F\n\014handleDe"
+  "lete\022\027.datanode_proto.DelInfo\032\035.datanode"
+  "_proto.RequestResult\022F\n\theartbeat\022\035.data"
+  "node_proto.CheckaliveCMD\032\032.datanode_prot"
+  "o.NodeStatusb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_datanode_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_datanode_2eproto = {
-    false, false, 693, descriptor_table_protodef_datanode_2eproto,
+    false, false, 860, descriptor_table_protodef_datanode_2eproto,
     "datanode.proto",
-    &descriptor_table_datanode_2eproto_once, nullptr, 0, 5,
+    &descriptor_table_datanode_2eproto_once, nullptr, 0, 6,
     schemas, file_default_instances, TableStruct_datanode_2eproto::offsets,
     file_level_metadata_datanode_2eproto, file_level_enum_descriptors_datanode_2eproto,
     file_level_service_descriptors_datanode_2eproto,
@@ -617,6 +649,241 @@ void RequestResult::InternalSwap(RequestResult* other) {
 
 // ===================================================================
 
+class NodeStatus::_Internal {
+ public:
+};
+
+NodeStatus::NodeStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:datanode_proto.NodeStatus)
+}
+NodeStatus::NodeStatus(const NodeStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.free_bytes_){}
+    , decltype(_impl_.io_bytes_per_sec_){}
+    , decltype(_impl_.block_num_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.free_bytes_, &from._impl_.free_bytes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.block_num_) -
+    reinterpret_cast<char*>(&_impl_.free_bytes_)) + sizeof(_impl_.block_num_));
+  // @@protoc_insertion_point(copy_constructor:datanode_proto.NodeStatus)
+}
+
+inline void NodeStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.free_bytes_){int64_t{0}}
+    , decltype(_impl_.io_bytes_per_sec_){int64_t{0}}
+    , decltype(_impl_.block_num_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NodeStatus::~NodeStatus() {
+  // @@protoc_insertion_point(destructor:datanode_proto.NodeStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NodeStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void NodeStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NodeStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:datanode_proto.NodeStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.free_bytes_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.block_num_) -
+      reinterpret_cast<char*>(&_impl_.free_bytes_)) + sizeof(_impl_.block_num_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 free_bytes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.free_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 block_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.block_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 io_bytes_per_sec = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.io_bytes_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:datanode_proto.NodeStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 free_bytes = 1;
+  if (this->_internal_free_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_free_bytes(), target);
+  }
+
+  // int32 block_num = 2;
+  if (this->_internal_block_num() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_block_num(), target);
+  }
+
+  // int64 io_bytes_per_sec = 3;
+  if (this->_internal_io_bytes_per_sec() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_io_bytes_per_sec(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:datanode_proto.NodeStatus)
+  return target;
+}
+
+size_t NodeStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:datanode_proto.NodeStatus)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 free_bytes = 1;
+  if (this->_internal_free_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_free_bytes());
+  }
+
+  // int64 io_bytes_per_sec = 3;
+  if (this->_internal_io_bytes_per_sec() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_io_bytes_per_sec());
+  }
+
+  // int32 block_num = 2;
+  if (this->_internal_block_num() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_block_num());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeStatus::GetClassData() const { return &_class_data_; }
+
+
+void NodeStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeStatus*>(&to_msg);
+  auto& from = static_cast<const NodeStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:datanode_proto.NodeStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_free_bytes() != 0) {
+    _this->_internal_set_free_bytes(from._internal_free_bytes());
+  }
+  if (from._internal_io_bytes_per_sec() != 0) {
+    _this->_internal_set_io_bytes_per_sec(from._internal_io_bytes_per_sec());
+  }
+  if (from._internal_block_num() != 0) {
+    _this->_internal_set_block_num(from._internal_block_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NodeStatus::CopyFrom(const NodeStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:datanode_proto.NodeStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeStatus::IsInitialized() const {
+  return true;
+}
+
+void NodeStatus::InternalSwap(NodeStatus* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.block_num_)
+      + sizeof(NodeStatus::_impl_.block_num_)
+      - PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.free_bytes_)>(
+          reinterpret_cast<char*>(&_impl_.free_bytes_),
+          reinterpret_cast<char*>(&other->_impl_.free_bytes_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NodeStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_datanode_2eproto_getter, &descriptor_table_datanode_2eproto_once,
+      file_level_metadata_datanode_2eproto[2]);
+}
+
+// ===================================================================
+
 class SetInfo::_Internal {
  public:
 };
@@ -973,7 +1240,7 @@ void SetInfo::InternalSwap(SetInfo* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SetInfo::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_datanode_2eproto_getter, &descriptor_table_datanode_2eproto_once,
-      file_level_metadata_datanode_2eproto[2]);
+      file_level_metadata_datanode_2eproto[3]);
 }
 
 // ===================================================================
@@ -997,6 +1264,7 @@ GetInfo::GetInfo(const GetInfo& from)
     , decltype(_impl_.block_size_){}
     , decltype(_impl_.block_id_){}
     , decltype(_impl_.proxy_port_){}
+    , decltype(_impl_.offset_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1017,8 +1285,8 @@ GetInfo::GetInfo(const GetInfo& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.block_size_, &from._impl_.block_size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.proxy_port_) -
-    reinterpret_cast<char*>(&_impl_.block_size_)) + sizeof(_impl_.proxy_port_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.block_size_)) + sizeof(_impl_.offset_));
   // @@protoc_insertion_point(copy_constructor:datanode_proto.GetInfo)
 }
 
@@ -1032,6 +1300,7 @@ inline void GetInfo::SharedCtor(
     , decltype(_impl_.block_size_){0}
     , decltype(_impl_.block_id_){0}
     , decltype(_impl_.proxy_port_){0}
+    , decltype(_impl_.offset_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.block_key_.InitDefault();
@@ -1072,8 +1341,8 @@ void GetInfo::Clear() {
   _impl_.block_key_.ClearToEmpty();
   _impl_.proxy_ip_.ClearToEmpty();
   ::memset(&_impl_.block_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.proxy_port_) -
-      reinterpret_cast<char*>(&_impl_.block_size_)) + sizeof(_impl_.proxy_port_));
+      reinterpret_cast<char*>(&_impl_.offset_) -
+      reinterpret_cast<char*>(&_impl_.block_size_)) + sizeof(_impl_.offset_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1127,6 +1396,14 @@ const char* GetInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
         } else
           goto handle_unusual;
         continue;
+      // int32 offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1194,6 +1471,12 @@ uint8_t* GetInfo::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_proxy_port(), target);
   }
 
+  // int32 offset = 6;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_offset(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1239,6 +1522,11 @@ size_t GetInfo::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_proxy_port());
   }
 
+  // int32 offset = 6;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_offset());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1272,6 +1560,9 @@ void GetInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOB
   if (from._internal_proxy_port() != 0) {
     _this->_internal_set_proxy_port(from._internal_proxy_port());
   }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1300,8 +1591,8 @@ void GetInfo::InternalSwap(GetInfo* other) {
       &other->_impl_.proxy_ip_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetInfo, _impl_.proxy_port_)
-      + sizeof(GetInfo::_impl_.proxy_port_)
+      PROTOBUF_FIELD_OFFSET(GetInfo, _impl_.offset_)
+      + sizeof(GetInfo::_impl_.offset_)
       - PROTOBUF_FIELD_OFFSET(GetInfo, _impl_.block_size_)>(
           reinterpret_cast<char*>(&_impl_.block_size_),
           reinterpret_cast<char*>(&other->_impl_.block_size_));
@@ -1310,7 +1601,7 @@ void GetInfo::InternalSwap(GetInfo* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata GetInfo::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_datanode_2eproto_getter, &descriptor_table_datanode_2eproto_once,
-      file_level_metadata_datanode_2eproto[3]);
+      file_level_metadata_datanode_2eproto[4]);
 }
 
 // ===================================================================
@@ -1513,7 +1804,7 @@ void DelInfo::InternalSwap(DelInfo* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata DelInfo::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_datanode_2eproto_getter, &descriptor_table_datanode_2eproto_once,
-      file_level_metadata_datanode_2eproto[4]);
+      file_level_metadata_datanode_2eproto[5]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1527,6 +1818,10 @@ template<> PROTOBUF_NOINLINE ::datanode_proto::RequestResult*
 Arena::CreateMaybeMessage< ::datanode_proto::RequestResult >(Arena* arena) {
   return Arena::CreateMessageInternal< ::datanode_proto::RequestResult >(arena);
 }
+template<> PROTOBUF_NOINLINE ::datanode_proto::NodeStatus*
+Arena::CreateMaybeMessage< ::datanode_proto::NodeStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::datanode_proto::NodeStatus >(arena);
+}
 template<> PROTOBUF_NOINLINE ::datanode_proto::SetInfo*
 Arena::CreateMaybeMessage< ::datanode_proto::SetInfo >(Arena* arena) {
   return Arena::CreateMessageInternal< ::datanode_proto::SetInfo >(arena);
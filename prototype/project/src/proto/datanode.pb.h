@@ -54,6 +54,9 @@ extern DelInfoDefaultTypeInternal _DelInfo_default_instance_;
 class GetInfo;
 struct GetInfoDefaultTypeInternal;
 extern GetInfoDefaultTypeInternal _GetInfo_default_instance_;
+class NodeStatus;
+struct NodeStatusDefaultTypeInternal;
+extern NodeStatusDefaultTypeInternal _NodeStatus_default_instance_;
 class RequestResult;
 struct RequestResultDefaultTypeInternal;
 extern RequestResultDefaultTypeInternal _RequestResult_default_instance_;
@@ -65,6 +68,7 @@ PROTOBUF_NAMESPACE_OPEN
 template<> ::datanode_proto::CheckaliveCMD* Arena::CreateMaybeMessage<::datanode_proto::CheckaliveCMD>(Arena*);
 template<> ::datanode_proto::DelInfo* Arena::CreateMaybeMessage<::datanode_proto::DelInfo>(Arena*);
 template<> ::datanode_proto::GetInfo* Arena::CreateMaybeMessage<::datanode_proto::GetInfo>(Arena*);
+template<> ::datanode_proto::NodeStatus* Arena::CreateMaybeMessage<::datanode_proto::NodeStatus>(Arena*);
 template<> ::datanode_proto::RequestResult* Arena::CreateMaybeMessage<::datanode_proto::RequestResult>(Arena*);
 template<> ::datanode_proto::SetInfo* Arena::CreateMaybeMessage<::datanode_proto::SetInfo>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -384,6 +388,176 @@ class RequestResult final :
 };
 // -------------------------------------------------------------------
 
+class NodeStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:datanode_proto.NodeStatus) */ {
+ public:
+  inline NodeStatus() : NodeStatus(nullptr) {}
+  ~NodeStatus() override;
+  explicit PROTOBUF_CONSTEXPR NodeStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NodeStatus(const NodeStatus& from);
+  NodeStatus(NodeStatus&& from) noexcept
+    : NodeStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline NodeStatus& operator=(const NodeStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NodeStatus& operator=(NodeStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NodeStatus* internal_default_instance() {
+    return reinterpret_cast<const NodeStatus*>(
+               &_NodeStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(NodeStatus& a, NodeStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NodeStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NodeStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NodeStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeStatus& from) {
+    NodeStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NodeStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "datanode_proto.NodeStatus";
+  }
+  protected:
+  explicit NodeStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFreeBytesFieldNumber = 1,
+    kIoBytesPerSecFieldNumber = 3,
+    kBlockNumFieldNumber = 2,
+  };
+  // int64 free_bytes = 1;
+  void clear_free_bytes();
+  int64_t free_bytes() const;
+  void set_free_bytes(int64_t value);
+  private:
+  int64_t _internal_free_bytes() const;
+  void _internal_set_free_bytes(int64_t value);
+  public:
+
+  // int64 io_bytes_per_sec = 3;
+  void clear_io_bytes_per_sec();
+  int64_t io_bytes_per_sec() const;
+  void set_io_bytes_per_sec(int64_t value);
+  private:
+  int64_t _internal_io_bytes_per_sec() const;
+  void _internal_set_io_bytes_per_sec(int64_t value);
+  public:
+
+  // int32 block_num = 2;
+  void clear_block_num();
+  int32_t block_num() const;
+  void set_block_num(int32_t value);
+  private:
+  int32_t _internal_block_num() const;
+  void _internal_set_block_num(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:datanode_proto.NodeStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t free_bytes_;
+    int64_t io_bytes_per_sec_;
+    int32_t block_num_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datanode_2eproto;
+};
+// -------------------------------------------------------------------
+
 class SetInfo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:datanode_proto.SetInfo) */ {
  public:
@@ -432,7 +606,7 @@ class SetInfo final :
                &_SetInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(SetInfo& a, SetInfo& b) {
     a.Swap(&b);
@@ -645,7 +819,7 @@ class GetInfo final :
                &_GetInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(GetInfo& a, GetInfo& b) {
     a.Swap(&b);
@@ -723,6 +897,7 @@ class GetInfo final :
     kBlockSizeFieldNumber = 2,
     kBlockIdFieldNumber = 3,
     kProxyPortFieldNumber = 5,
+    kOffsetFieldNumber = 6,
   };
   // string block_key = 1;
   void clear_block_key();
@@ -779,6 +954,15 @@ class GetInfo final :
   void _internal_set_proxy_port(int32_t value);
   public:
 
+  // int32 offset = 6;
+  void clear_offset();
+  int32_t offset() const;
+  void set_offset(int32_t value);
+  private:
+  int32_t _internal_offset() const;
+  void _internal_set_offset(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:datanode_proto.GetInfo)
  private:
   class _Internal;
@@ -792,6 +976,7 @@ class GetInfo final :
     int32_t block_size_;
     int32_t block_id_;
     int32_t proxy_port_;
+    int32_t offset_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -847,7 +1032,7 @@ class DelInfo final :
                &_DelInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(DelInfo& a, DelInfo& b) {
     a.Swap(&b);
@@ -1057,6 +1242,70 @@ inline void RequestResult::set_valuesizebytes(int32_t value) {
 
 // -------------------------------------------------------------------
 
+// NodeStatus
+
+// int64 free_bytes = 1;
+inline void NodeStatus::clear_free_bytes() {
+  _impl_.free_bytes_ = int64_t{0};
+}
+inline int64_t NodeStatus::_internal_free_bytes() const {
+  return _impl_.free_bytes_;
+}
+inline int64_t NodeStatus::free_bytes() const {
+  // @@protoc_insertion_point(field_get:datanode_proto.NodeStatus.free_bytes)
+  return _internal_free_bytes();
+}
+inline void NodeStatus::_internal_set_free_bytes(int64_t value) {
+  
+  _impl_.free_bytes_ = value;
+}
+inline void NodeStatus::set_free_bytes(int64_t value) {
+  _internal_set_free_bytes(value);
+  // @@protoc_insertion_point(field_set:datanode_proto.NodeStatus.free_bytes)
+}
+
+// int32 block_num = 2;
+inline void NodeStatus::clear_block_num() {
+  _impl_.block_num_ = 0;
+}
+inline int32_t NodeStatus::_internal_block_num() const {
+  return _impl_.block_num_;
+}
+inline int32_t NodeStatus::block_num() const {
+  // @@protoc_insertion_point(field_get:datanode_proto.NodeStatus.block_num)
+  return _internal_block_num();
+}
+inline void NodeStatus::_internal_set_block_num(int32_t value) {
+  
+  _impl_.block_num_ = value;
+}
+inline void NodeStatus::set_block_num(int32_t value) {
+  _internal_set_block_num(value);
+  // @@protoc_insertion_point(field_set:datanode_proto.NodeStatus.block_num)
+}
+
+// int64 io_bytes_per_sec = 3;
+inline void NodeStatus::clear_io_bytes_per_sec() {
+  _impl_.io_bytes_per_sec_ = int64_t{0};
+}
+inline int64_t NodeStatus::_internal_io_bytes_per_sec() const {
+  return _impl_.io_bytes_per_sec_;
+}
+inline int64_t NodeStatus::io_bytes_per_sec() const {
+  // @@protoc_insertion_point(field_get:datanode_proto.NodeStatus.io_bytes_per_sec)
+  return _internal_io_bytes_per_sec();
+}
+inline void NodeStatus::_internal_set_io_bytes_per_sec(int64_t value) {
+  
+  _impl_.io_bytes_per_sec_ = value;
+}
+inline void NodeStatus::set_io_bytes_per_sec(int64_t value) {
+  _internal_set_io_bytes_per_sec(value);
+  // @@protoc_insertion_point(field_set:datanode_proto.NodeStatus.io_bytes_per_sec)
+}
+
+// -------------------------------------------------------------------
+
 // SetInfo
 
 // string block_key = 1;
@@ -1403,6 +1652,26 @@ inline void GetInfo::set_proxy_port(int32_t value) {
   // @@protoc_insertion_point(field_set:datanode_proto.GetInfo.proxy_port)
 }
 
+// int32 offset = 6;
+inline void GetInfo::clear_offset() {
+  _impl_.offset_ = 0;
+}
+inline int32_t GetInfo::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int32_t GetInfo::offset() const {
+  // @@protoc_insertion_point(field_get:datanode_proto.GetInfo.offset)
+  return _internal_offset();
+}
+inline void GetInfo::_internal_set_offset(int32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void GetInfo::set_offset(int32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:datanode_proto.GetInfo.offset)
+}
+
 // -------------------------------------------------------------------
 
 // DelInfo
@@ -1468,6 +1737,8 @@ inline void DelInfo::set_allocated_block_key(std::string* block_key) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
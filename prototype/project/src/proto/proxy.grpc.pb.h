@@ -75,6 +75,14 @@ class proxyService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>> PrepareAsyncdecodeAndGetObject(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>>(PrepareAsyncdecodeAndGetObjectRaw(context, request, cq));
     }
+    // partial decoding for degraded read
+    virtual ::grpc::Status helpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::proxy_proto::RepIfSuccess* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RepIfSuccess>> AsynchelpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RepIfSuccess>>(AsynchelpDecodeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RepIfSuccess>> PrepareAsynchelpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RepIfSuccess>>(PrepareAsynchelpDecodeRaw(context, request, cq));
+    }
     // delete
     virtual ::grpc::Status deleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::proxy_proto::DelReply* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::DelReply>> AsyncdeleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::grpc::CompletionQueue* cq) {
@@ -83,8 +91,38 @@ class proxyService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::DelReply>> PrepareAsyncdeleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::DelReply>>(PrepareAsyncdeleteBlockRaw(context, request, cq));
     }
+    // batch, the objects of a batch placed on or read through this proxy
+    virtual ::grpc::Status encodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::proxy_proto::SetReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>> AsyncencodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>>(AsyncencodeAndSetObjectsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>> PrepareAsyncencodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>>(PrepareAsyncencodeAndSetObjectsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status decodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::proxy_proto::GetReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>> AsyncdecodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>>(AsyncdecodeAndGetObjectsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>> PrepareAsyncdecodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>>(PrepareAsyncdecodeAndGetObjectsRaw(context, request, cq));
+    }
+    // encode a pack of small objects once they have arrived
+    virtual ::grpc::Status sealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::proxy_proto::SetReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>> AsyncsealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>>(AsyncsealPackRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>> PrepareAsyncsealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>>(PrepareAsyncsealPackRaw(context, request, cq));
+    }
     // lrcwidestripe, merge
-    // parity block recalculation
+    // parity block recalculation, the main proxy opens a port for the helper proxies first
+    virtual ::grpc::Status openRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::proxy_proto::RecalPort* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalPort>> AsyncopenRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalPort>>(AsyncopenRecalRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalPort>> PrepareAsyncopenRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalPort>>(PrepareAsyncopenRecalRaw(context, request, cq));
+    }
     virtual ::grpc::Status mainRecal(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan& request, ::proxy_proto::RecalReply* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalReply>> AsyncmainRecal(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalReply>>(AsyncmainRecalRaw(context, request, cq));
@@ -126,11 +164,24 @@ class proxyService final {
       // get and decode
       virtual void decodeAndGetObject(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::GetReply* response, std::function<void(::grpc::Status)>) = 0;
       virtual void decodeAndGetObject(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::GetReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // partial decoding for degraded read
+      virtual void helpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan* request, ::proxy_proto::RepIfSuccess* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void helpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan* request, ::proxy_proto::RepIfSuccess* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // delete
       virtual void deleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock* request, ::proxy_proto::DelReply* response, std::function<void(::grpc::Status)>) = 0;
       virtual void deleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock* request, ::proxy_proto::DelReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // batch, the objects of a batch placed on or read through this proxy
+      virtual void encodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::SetReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void encodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::SetReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void decodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::GetReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void decodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::GetReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // encode a pack of small objects once they have arrived
+      virtual void sealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::SetReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void sealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::SetReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // lrcwidestripe, merge
-      // parity block recalculation
+      // parity block recalculation, the main proxy opens a port for the helper proxies first
+      virtual void openRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort* request, ::proxy_proto::RecalPort* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void openRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort* request, ::proxy_proto::RecalPort* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void mainRecal(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan* request, ::proxy_proto::RecalReply* response, std::function<void(::grpc::Status)>) = 0;
       virtual void mainRecal(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan* request, ::proxy_proto::RecalReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void helpRecal(::grpc::ClientContext* context, const ::proxy_proto::helpRecalPlan* request, ::proxy_proto::RecalReply* response, std::function<void(::grpc::Status)>) = 0;
@@ -151,8 +202,18 @@ class proxyService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>* PrepareAsyncencodeAndSetObjectRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>* AsyncdecodeAndGetObjectRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>* PrepareAsyncdecodeAndGetObjectRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RepIfSuccess>* AsynchelpDecodeRaw(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RepIfSuccess>* PrepareAsynchelpDecodeRaw(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::DelReply>* AsyncdeleteBlockRaw(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::DelReply>* PrepareAsyncdeleteBlockRaw(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>* AsyncencodeAndSetObjectsRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>* PrepareAsyncencodeAndSetObjectsRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>* AsyncdecodeAndGetObjectsRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::GetReply>* PrepareAsyncdecodeAndGetObjectsRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>* AsyncsealPackRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::SetReply>* PrepareAsyncsealPackRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalPort>* AsyncopenRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalPort>* PrepareAsyncopenRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalReply>* AsyncmainRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalReply>* PrepareAsyncmainRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proxy_proto::RecalReply>* AsynchelpRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::helpRecalPlan& request, ::grpc::CompletionQueue* cq) = 0;
@@ -186,6 +247,13 @@ class proxyService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>> PrepareAsyncdecodeAndGetObject(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>>(PrepareAsyncdecodeAndGetObjectRaw(context, request, cq));
     }
+    ::grpc::Status helpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::proxy_proto::RepIfSuccess* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RepIfSuccess>> AsynchelpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RepIfSuccess>>(AsynchelpDecodeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RepIfSuccess>> PrepareAsynchelpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RepIfSuccess>>(PrepareAsynchelpDecodeRaw(context, request, cq));
+    }
     ::grpc::Status deleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::proxy_proto::DelReply* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::DelReply>> AsyncdeleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::DelReply>>(AsyncdeleteBlockRaw(context, request, cq));
@@ -193,6 +261,34 @@ class proxyService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::DelReply>> PrepareAsyncdeleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::DelReply>>(PrepareAsyncdeleteBlockRaw(context, request, cq));
     }
+    ::grpc::Status encodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::proxy_proto::SetReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>> AsyncencodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>>(AsyncencodeAndSetObjectsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>> PrepareAsyncencodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>>(PrepareAsyncencodeAndSetObjectsRaw(context, request, cq));
+    }
+    ::grpc::Status decodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::proxy_proto::GetReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>> AsyncdecodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>>(AsyncdecodeAndGetObjectsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>> PrepareAsyncdecodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>>(PrepareAsyncdecodeAndGetObjectsRaw(context, request, cq));
+    }
+    ::grpc::Status sealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::proxy_proto::SetReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>> AsyncsealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>>(AsyncsealPackRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>> PrepareAsyncsealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>>(PrepareAsyncsealPackRaw(context, request, cq));
+    }
+    ::grpc::Status openRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::proxy_proto::RecalPort* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalPort>> AsyncopenRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalPort>>(AsyncopenRecalRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalPort>> PrepareAsyncopenRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalPort>>(PrepareAsyncopenRecalRaw(context, request, cq));
+    }
     ::grpc::Status mainRecal(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan& request, ::proxy_proto::RecalReply* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalReply>> AsyncmainRecal(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalReply>>(AsyncmainRecalRaw(context, request, cq));
@@ -230,8 +326,18 @@ class proxyService final {
       void encodeAndSetObject(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::SetReply* response, ::grpc::ClientUnaryReactor* reactor) override;
       void decodeAndGetObject(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::GetReply* response, std::function<void(::grpc::Status)>) override;
       void decodeAndGetObject(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::GetReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void helpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan* request, ::proxy_proto::RepIfSuccess* response, std::function<void(::grpc::Status)>) override;
+      void helpDecode(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan* request, ::proxy_proto::RepIfSuccess* response, ::grpc::ClientUnaryReactor* reactor) override;
       void deleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock* request, ::proxy_proto::DelReply* response, std::function<void(::grpc::Status)>) override;
       void deleteBlock(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock* request, ::proxy_proto::DelReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void encodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::SetReply* response, std::function<void(::grpc::Status)>) override;
+      void encodeAndSetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::SetReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void decodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::GetReply* response, std::function<void(::grpc::Status)>) override;
+      void decodeAndGetObjects(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::GetReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void sealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::SetReply* response, std::function<void(::grpc::Status)>) override;
+      void sealPack(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::SetReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void openRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort* request, ::proxy_proto::RecalPort* response, std::function<void(::grpc::Status)>) override;
+      void openRecal(::grpc::ClientContext* context, const ::proxy_proto::RecalPort* request, ::proxy_proto::RecalPort* response, ::grpc::ClientUnaryReactor* reactor) override;
       void mainRecal(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan* request, ::proxy_proto::RecalReply* response, std::function<void(::grpc::Status)>) override;
       void mainRecal(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan* request, ::proxy_proto::RecalReply* response, ::grpc::ClientUnaryReactor* reactor) override;
       void helpRecal(::grpc::ClientContext* context, const ::proxy_proto::helpRecalPlan* request, ::proxy_proto::RecalReply* response, std::function<void(::grpc::Status)>) override;
@@ -257,8 +363,18 @@ class proxyService final {
     ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>* PrepareAsyncencodeAndSetObjectRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>* AsyncdecodeAndGetObjectRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>* PrepareAsyncdecodeAndGetObjectRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::RepIfSuccess>* AsynchelpDecodeRaw(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::RepIfSuccess>* PrepareAsynchelpDecodeRaw(::grpc::ClientContext* context, const ::proxy_proto::helpDecodePlan& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proxy_proto::DelReply>* AsyncdeleteBlockRaw(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proxy_proto::DelReply>* PrepareAsyncdeleteBlockRaw(::grpc::ClientContext* context, const ::proxy_proto::NodeAndBlock& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>* AsyncencodeAndSetObjectsRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>* PrepareAsyncencodeAndSetObjectsRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>* AsyncdecodeAndGetObjectsRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::GetReply>* PrepareAsyncdecodeAndGetObjectsRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>* AsyncsealPackRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::SetReply>* PrepareAsyncsealPackRaw(::grpc::ClientContext* context, const ::proxy_proto::ObjectAndPlacement& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalPort>* AsyncopenRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalPort>* PrepareAsyncopenRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::RecalPort& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalReply>* AsyncmainRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalReply>* PrepareAsyncmainRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::mainRecalPlan& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proxy_proto::RecalReply>* AsynchelpRecalRaw(::grpc::ClientContext* context, const ::proxy_proto::helpRecalPlan& request, ::grpc::CompletionQueue* cq) override;
@@ -270,7 +386,12 @@ class proxyService final {
     const ::grpc::internal::RpcMethod rpcmethod_checkalive_;
     const ::grpc::internal::RpcMethod rpcmethod_encodeAndSetObject_;
     const ::grpc::internal::RpcMethod rpcmethod_decodeAndGetObject_;
+    const ::grpc::internal::RpcMethod rpcmethod_helpDecode_;
     const ::grpc::internal::RpcMethod rpcmethod_deleteBlock_;
+    const ::grpc::internal::RpcMethod rpcmethod_encodeAndSetObjects_;
+    const ::grpc::internal::RpcMethod rpcmethod_decodeAndGetObjects_;
+    const ::grpc::internal::RpcMethod rpcmethod_sealPack_;
+    const ::grpc::internal::RpcMethod rpcmethod_openRecal_;
     const ::grpc::internal::RpcMethod rpcmethod_mainRecal_;
     const ::grpc::internal::RpcMethod rpcmethod_helpRecal_;
     const ::grpc::internal::RpcMethod rpcmethod_blockReloc_;
@@ -288,10 +409,18 @@ class proxyService final {
     virtual ::grpc::Status encodeAndSetObject(::grpc::ServerContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::SetReply* response);
     // get and decode
     virtual ::grpc::Status decodeAndGetObject(::grpc::ServerContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::GetReply* response);
+    // partial decoding for degraded read
+    virtual ::grpc::Status helpDecode(::grpc::ServerContext* context, const ::proxy_proto::helpDecodePlan* request, ::proxy_proto::RepIfSuccess* response);
     // delete
     virtual ::grpc::Status deleteBlock(::grpc::ServerContext* context, const ::proxy_proto::NodeAndBlock* request, ::proxy_proto::DelReply* response);
+    // batch, the objects of a batch placed on or read through this proxy
+    virtual ::grpc::Status encodeAndSetObjects(::grpc::ServerContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::SetReply* response);
+    virtual ::grpc::Status decodeAndGetObjects(::grpc::ServerContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::GetReply* response);
+    // encode a pack of small objects once they have arrived
+    virtual ::grpc::Status sealPack(::grpc::ServerContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::SetReply* response);
     // lrcwidestripe, merge
-    // parity block recalculation
+    // parity block recalculation, the main proxy opens a port for the helper proxies first
+    virtual ::grpc::Status openRecal(::grpc::ServerContext* context, const ::proxy_proto::RecalPort* request, ::proxy_proto::RecalPort* response);
     virtual ::grpc::Status mainRecal(::grpc::ServerContext* context, const ::proxy_proto::mainRecalPlan* request, ::proxy_proto::RecalReply* response);
     virtual ::grpc::Status helpRecal(::grpc::ServerContext* context, const ::proxy_proto::helpRecalPlan* request, ::proxy_proto::RecalReply* response);
     // block relocation
@@ -359,12 +488,32 @@ class proxyService final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_helpDecode : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_helpDecode() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_helpDecode() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status helpDecode(::grpc::ServerContext* /*context*/, const ::proxy_proto::helpDecodePlan* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequesthelpDecode(::grpc::ServerContext* context, ::proxy_proto::helpDecodePlan* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::RepIfSuccess>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_deleteBlock : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_deleteBlock() {
-      ::grpc::Service::MarkMethodAsync(3);
+      ::grpc::Service::MarkMethodAsync(4);
     }
     ~WithAsyncMethod_deleteBlock() override {
       BaseClassMustBeDerivedFromService(this);
@@ -375,7 +524,87 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestdeleteBlock(::grpc::ServerContext* context, ::proxy_proto::NodeAndBlock* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::DelReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_encodeAndSetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_encodeAndSetObjects() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_encodeAndSetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status encodeAndSetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestencodeAndSetObjects(::grpc::ServerContext* context, ::proxy_proto::ObjectBatch* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::SetReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_decodeAndGetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_decodeAndGetObjects() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_decodeAndGetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status decodeAndGetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::GetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdecodeAndGetObjects(::grpc::ServerContext* context, ::proxy_proto::ObjectBatch* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::GetReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_sealPack : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_sealPack() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_sealPack() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status sealPack(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsealPack(::grpc::ServerContext* context, ::proxy_proto::ObjectAndPlacement* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::SetReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_openRecal : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_openRecal() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_openRecal() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status openRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::RecalPort* /*request*/, ::proxy_proto::RecalPort* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestopenRecal(::grpc::ServerContext* context, ::proxy_proto::RecalPort* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::RecalPort>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -384,7 +613,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_mainRecal() {
-      ::grpc::Service::MarkMethodAsync(4);
+      ::grpc::Service::MarkMethodAsync(9);
     }
     ~WithAsyncMethod_mainRecal() override {
       BaseClassMustBeDerivedFromService(this);
@@ -395,7 +624,7 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestmainRecal(::grpc::ServerContext* context, ::proxy_proto::mainRecalPlan* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::RecalReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -404,7 +633,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_helpRecal() {
-      ::grpc::Service::MarkMethodAsync(5);
+      ::grpc::Service::MarkMethodAsync(10);
     }
     ~WithAsyncMethod_helpRecal() override {
       BaseClassMustBeDerivedFromService(this);
@@ -415,7 +644,7 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequesthelpRecal(::grpc::ServerContext* context, ::proxy_proto::helpRecalPlan* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::RecalReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -424,7 +653,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_blockReloc() {
-      ::grpc::Service::MarkMethodAsync(6);
+      ::grpc::Service::MarkMethodAsync(11);
     }
     ~WithAsyncMethod_blockReloc() override {
       BaseClassMustBeDerivedFromService(this);
@@ -435,7 +664,7 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestblockReloc(::grpc::ServerContext* context, ::proxy_proto::blockRelocPlan* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::blockRelocReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -444,7 +673,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_checkStep() {
-      ::grpc::Service::MarkMethodAsync(7);
+      ::grpc::Service::MarkMethodAsync(12);
     }
     ~WithAsyncMethod_checkStep() override {
       BaseClassMustBeDerivedFromService(this);
@@ -455,10 +684,10 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestcheckStep(::grpc::ServerContext* context, ::proxy_proto::AskIfSuccess* request, ::grpc::ServerAsyncResponseWriter< ::proxy_proto::RepIfSuccess>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_checkalive<WithAsyncMethod_encodeAndSetObject<WithAsyncMethod_decodeAndGetObject<WithAsyncMethod_deleteBlock<WithAsyncMethod_mainRecal<WithAsyncMethod_helpRecal<WithAsyncMethod_blockReloc<WithAsyncMethod_checkStep<Service > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_checkalive<WithAsyncMethod_encodeAndSetObject<WithAsyncMethod_decodeAndGetObject<WithAsyncMethod_helpDecode<WithAsyncMethod_deleteBlock<WithAsyncMethod_encodeAndSetObjects<WithAsyncMethod_decodeAndGetObjects<WithAsyncMethod_sealPack<WithAsyncMethod_openRecal<WithAsyncMethod_mainRecal<WithAsyncMethod_helpRecal<WithAsyncMethod_blockReloc<WithAsyncMethod_checkStep<Service > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_checkalive : public BaseClass {
    private:
@@ -541,18 +770,45 @@ class proxyService final {
       ::grpc::CallbackServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::GetReply* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_helpDecode : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_helpDecode() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::helpDecodePlan, ::proxy_proto::RepIfSuccess>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proxy_proto::helpDecodePlan* request, ::proxy_proto::RepIfSuccess* response) { return this->helpDecode(context, request, response); }));}
+    void SetMessageAllocatorFor_helpDecode(
+        ::grpc::MessageAllocator< ::proxy_proto::helpDecodePlan, ::proxy_proto::RepIfSuccess>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::helpDecodePlan, ::proxy_proto::RepIfSuccess>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_helpDecode() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status helpDecode(::grpc::ServerContext* /*context*/, const ::proxy_proto::helpDecodePlan* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* helpDecode(
+      ::grpc::CallbackServerContext* /*context*/, const ::proxy_proto::helpDecodePlan* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_deleteBlock : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_deleteBlock() {
-      ::grpc::Service::MarkMethodCallback(3,
+      ::grpc::Service::MarkMethodCallback(4,
           new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::NodeAndBlock, ::proxy_proto::DelReply>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::proxy_proto::NodeAndBlock* request, ::proxy_proto::DelReply* response) { return this->deleteBlock(context, request, response); }));}
     void SetMessageAllocatorFor_deleteBlock(
         ::grpc::MessageAllocator< ::proxy_proto::NodeAndBlock, ::proxy_proto::DelReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::NodeAndBlock, ::proxy_proto::DelReply>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -568,18 +824,126 @@ class proxyService final {
       ::grpc::CallbackServerContext* /*context*/, const ::proxy_proto::NodeAndBlock* /*request*/, ::proxy_proto::DelReply* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_encodeAndSetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_encodeAndSetObjects() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::ObjectBatch, ::proxy_proto::SetReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::SetReply* response) { return this->encodeAndSetObjects(context, request, response); }));}
+    void SetMessageAllocatorFor_encodeAndSetObjects(
+        ::grpc::MessageAllocator< ::proxy_proto::ObjectBatch, ::proxy_proto::SetReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::ObjectBatch, ::proxy_proto::SetReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_encodeAndSetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status encodeAndSetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* encodeAndSetObjects(
+      ::grpc::CallbackServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::SetReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_decodeAndGetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_decodeAndGetObjects() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::ObjectBatch, ::proxy_proto::GetReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proxy_proto::ObjectBatch* request, ::proxy_proto::GetReply* response) { return this->decodeAndGetObjects(context, request, response); }));}
+    void SetMessageAllocatorFor_decodeAndGetObjects(
+        ::grpc::MessageAllocator< ::proxy_proto::ObjectBatch, ::proxy_proto::GetReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::ObjectBatch, ::proxy_proto::GetReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_decodeAndGetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status decodeAndGetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::GetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* decodeAndGetObjects(
+      ::grpc::CallbackServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::GetReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_sealPack : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_sealPack() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::ObjectAndPlacement, ::proxy_proto::SetReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proxy_proto::ObjectAndPlacement* request, ::proxy_proto::SetReply* response) { return this->sealPack(context, request, response); }));}
+    void SetMessageAllocatorFor_sealPack(
+        ::grpc::MessageAllocator< ::proxy_proto::ObjectAndPlacement, ::proxy_proto::SetReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::ObjectAndPlacement, ::proxy_proto::SetReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_sealPack() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status sealPack(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* sealPack(
+      ::grpc::CallbackServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_openRecal : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_openRecal() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::RecalPort, ::proxy_proto::RecalPort>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proxy_proto::RecalPort* request, ::proxy_proto::RecalPort* response) { return this->openRecal(context, request, response); }));}
+    void SetMessageAllocatorFor_openRecal(
+        ::grpc::MessageAllocator< ::proxy_proto::RecalPort, ::proxy_proto::RecalPort>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::RecalPort, ::proxy_proto::RecalPort>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_openRecal() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status openRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::RecalPort* /*request*/, ::proxy_proto::RecalPort* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* openRecal(
+      ::grpc::CallbackServerContext* /*context*/, const ::proxy_proto::RecalPort* /*request*/, ::proxy_proto::RecalPort* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_mainRecal : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_mainRecal() {
-      ::grpc::Service::MarkMethodCallback(4,
+      ::grpc::Service::MarkMethodCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::mainRecalPlan, ::proxy_proto::RecalReply>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::proxy_proto::mainRecalPlan* request, ::proxy_proto::RecalReply* response) { return this->mainRecal(context, request, response); }));}
     void SetMessageAllocatorFor_mainRecal(
         ::grpc::MessageAllocator< ::proxy_proto::mainRecalPlan, ::proxy_proto::RecalReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::mainRecalPlan, ::proxy_proto::RecalReply>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -600,13 +964,13 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_helpRecal() {
-      ::grpc::Service::MarkMethodCallback(5,
+      ::grpc::Service::MarkMethodCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::helpRecalPlan, ::proxy_proto::RecalReply>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::proxy_proto::helpRecalPlan* request, ::proxy_proto::RecalReply* response) { return this->helpRecal(context, request, response); }));}
     void SetMessageAllocatorFor_helpRecal(
         ::grpc::MessageAllocator< ::proxy_proto::helpRecalPlan, ::proxy_proto::RecalReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::helpRecalPlan, ::proxy_proto::RecalReply>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -627,13 +991,13 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_blockReloc() {
-      ::grpc::Service::MarkMethodCallback(6,
+      ::grpc::Service::MarkMethodCallback(11,
           new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::blockRelocPlan, ::proxy_proto::blockRelocReply>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::proxy_proto::blockRelocPlan* request, ::proxy_proto::blockRelocReply* response) { return this->blockReloc(context, request, response); }));}
     void SetMessageAllocatorFor_blockReloc(
         ::grpc::MessageAllocator< ::proxy_proto::blockRelocPlan, ::proxy_proto::blockRelocReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::blockRelocPlan, ::proxy_proto::blockRelocReply>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -654,13 +1018,13 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_checkStep() {
-      ::grpc::Service::MarkMethodCallback(7,
+      ::grpc::Service::MarkMethodCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::proxy_proto::AskIfSuccess, ::proxy_proto::RepIfSuccess>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::proxy_proto::AskIfSuccess* request, ::proxy_proto::RepIfSuccess* response) { return this->checkStep(context, request, response); }));}
     void SetMessageAllocatorFor_checkStep(
         ::grpc::MessageAllocator< ::proxy_proto::AskIfSuccess, ::proxy_proto::RepIfSuccess>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::proxy_proto::AskIfSuccess, ::proxy_proto::RepIfSuccess>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -675,7 +1039,7 @@ class proxyService final {
     virtual ::grpc::ServerUnaryReactor* checkStep(
       ::grpc::CallbackServerContext* /*context*/, const ::proxy_proto::AskIfSuccess* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_checkalive<WithCallbackMethod_encodeAndSetObject<WithCallbackMethod_decodeAndGetObject<WithCallbackMethod_deleteBlock<WithCallbackMethod_mainRecal<WithCallbackMethod_helpRecal<WithCallbackMethod_blockReloc<WithCallbackMethod_checkStep<Service > > > > > > > > CallbackService;
+  typedef WithCallbackMethod_checkalive<WithCallbackMethod_encodeAndSetObject<WithCallbackMethod_decodeAndGetObject<WithCallbackMethod_helpDecode<WithCallbackMethod_deleteBlock<WithCallbackMethod_encodeAndSetObjects<WithCallbackMethod_decodeAndGetObjects<WithCallbackMethod_sealPack<WithCallbackMethod_openRecal<WithCallbackMethod_mainRecal<WithCallbackMethod_helpRecal<WithCallbackMethod_blockReloc<WithCallbackMethod_checkStep<Service > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_checkalive : public BaseClass {
@@ -729,158 +1093,263 @@ class proxyService final {
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_deleteBlock : public BaseClass {
+  class WithGenericMethod_helpDecode : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_deleteBlock() {
+    WithGenericMethod_helpDecode() {
       ::grpc::Service::MarkMethodGeneric(3);
     }
-    ~WithGenericMethod_deleteBlock() override {
+    ~WithGenericMethod_helpDecode() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status deleteBlock(::grpc::ServerContext* /*context*/, const ::proxy_proto::NodeAndBlock* /*request*/, ::proxy_proto::DelReply* /*response*/) override {
+    ::grpc::Status helpDecode(::grpc::ServerContext* /*context*/, const ::proxy_proto::helpDecodePlan* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_mainRecal : public BaseClass {
+  class WithGenericMethod_deleteBlock : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_mainRecal() {
+    WithGenericMethod_deleteBlock() {
       ::grpc::Service::MarkMethodGeneric(4);
     }
-    ~WithGenericMethod_mainRecal() override {
+    ~WithGenericMethod_deleteBlock() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status mainRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::mainRecalPlan* /*request*/, ::proxy_proto::RecalReply* /*response*/) override {
+    ::grpc::Status deleteBlock(::grpc::ServerContext* /*context*/, const ::proxy_proto::NodeAndBlock* /*request*/, ::proxy_proto::DelReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_helpRecal : public BaseClass {
+  class WithGenericMethod_encodeAndSetObjects : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_helpRecal() {
+    WithGenericMethod_encodeAndSetObjects() {
       ::grpc::Service::MarkMethodGeneric(5);
     }
-    ~WithGenericMethod_helpRecal() override {
+    ~WithGenericMethod_encodeAndSetObjects() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status helpRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::helpRecalPlan* /*request*/, ::proxy_proto::RecalReply* /*response*/) override {
+    ::grpc::Status encodeAndSetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_blockReloc : public BaseClass {
+  class WithGenericMethod_decodeAndGetObjects : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_blockReloc() {
+    WithGenericMethod_decodeAndGetObjects() {
       ::grpc::Service::MarkMethodGeneric(6);
     }
-    ~WithGenericMethod_blockReloc() override {
+    ~WithGenericMethod_decodeAndGetObjects() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status blockReloc(::grpc::ServerContext* /*context*/, const ::proxy_proto::blockRelocPlan* /*request*/, ::proxy_proto::blockRelocReply* /*response*/) override {
+    ::grpc::Status decodeAndGetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::GetReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_checkStep : public BaseClass {
+  class WithGenericMethod_sealPack : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_checkStep() {
+    WithGenericMethod_sealPack() {
       ::grpc::Service::MarkMethodGeneric(7);
     }
-    ~WithGenericMethod_checkStep() override {
+    ~WithGenericMethod_sealPack() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status checkStep(::grpc::ServerContext* /*context*/, const ::proxy_proto::AskIfSuccess* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/) override {
+    ::grpc::Status sealPack(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithRawMethod_checkalive : public BaseClass {
+  class WithGenericMethod_openRecal : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_checkalive() {
-      ::grpc::Service::MarkMethodRaw(0);
+    WithGenericMethod_openRecal() {
+      ::grpc::Service::MarkMethodGeneric(8);
     }
-    ~WithRawMethod_checkalive() override {
+    ~WithGenericMethod_openRecal() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status checkalive(::grpc::ServerContext* /*context*/, const ::proxy_proto::CheckaliveCMD* /*request*/, ::proxy_proto::RequestResult* /*response*/) override {
+    ::grpc::Status openRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::RecalPort* /*request*/, ::proxy_proto::RecalPort* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void Requestcheckalive(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawMethod_encodeAndSetObject : public BaseClass {
+  class WithGenericMethod_mainRecal : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_encodeAndSetObject() {
-      ::grpc::Service::MarkMethodRaw(1);
+    WithGenericMethod_mainRecal() {
+      ::grpc::Service::MarkMethodGeneric(9);
     }
-    ~WithRawMethod_encodeAndSetObject() override {
+    ~WithGenericMethod_mainRecal() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status encodeAndSetObject(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+    ::grpc::Status mainRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::mainRecalPlan* /*request*/, ::proxy_proto::RecalReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestencodeAndSetObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawMethod_decodeAndGetObject : public BaseClass {
+  class WithGenericMethod_helpRecal : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_decodeAndGetObject() {
-      ::grpc::Service::MarkMethodRaw(2);
+    WithGenericMethod_helpRecal() {
+      ::grpc::Service::MarkMethodGeneric(10);
     }
-    ~WithRawMethod_decodeAndGetObject() override {
+    ~WithGenericMethod_helpRecal() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status decodeAndGetObject(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::GetReply* /*response*/) override {
+    ::grpc::Status helpRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::helpRecalPlan* /*request*/, ::proxy_proto::RecalReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestdecodeAndGetObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawMethod_deleteBlock : public BaseClass {
+  class WithGenericMethod_blockReloc : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_deleteBlock() {
+    WithGenericMethod_blockReloc() {
+      ::grpc::Service::MarkMethodGeneric(11);
+    }
+    ~WithGenericMethod_blockReloc() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status blockReloc(::grpc::ServerContext* /*context*/, const ::proxy_proto::blockRelocPlan* /*request*/, ::proxy_proto::blockRelocReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_checkStep : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_checkStep() {
+      ::grpc::Service::MarkMethodGeneric(12);
+    }
+    ~WithGenericMethod_checkStep() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status checkStep(::grpc::ServerContext* /*context*/, const ::proxy_proto::AskIfSuccess* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_checkalive : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_checkalive() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_checkalive() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status checkalive(::grpc::ServerContext* /*context*/, const ::proxy_proto::CheckaliveCMD* /*request*/, ::proxy_proto::RequestResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestcheckalive(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_encodeAndSetObject : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_encodeAndSetObject() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_encodeAndSetObject() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status encodeAndSetObject(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestencodeAndSetObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_decodeAndGetObject : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_decodeAndGetObject() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_decodeAndGetObject() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status decodeAndGetObject(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::GetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdecodeAndGetObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_helpDecode : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_helpDecode() {
       ::grpc::Service::MarkMethodRaw(3);
     }
+    ~WithRawMethod_helpDecode() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status helpDecode(::grpc::ServerContext* /*context*/, const ::proxy_proto::helpDecodePlan* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequesthelpDecode(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_deleteBlock : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_deleteBlock() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
     ~WithRawMethod_deleteBlock() override {
       BaseClassMustBeDerivedFromService(this);
     }
@@ -890,7 +1359,87 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestdeleteBlock(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_encodeAndSetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_encodeAndSetObjects() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_encodeAndSetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status encodeAndSetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestencodeAndSetObjects(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_decodeAndGetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_decodeAndGetObjects() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_decodeAndGetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status decodeAndGetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::GetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestdecodeAndGetObjects(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_sealPack : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_sealPack() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_sealPack() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status sealPack(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestsealPack(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_openRecal : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_openRecal() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_openRecal() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status openRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::RecalPort* /*request*/, ::proxy_proto::RecalPort* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestopenRecal(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -899,7 +1448,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_mainRecal() {
-      ::grpc::Service::MarkMethodRaw(4);
+      ::grpc::Service::MarkMethodRaw(9);
     }
     ~WithRawMethod_mainRecal() override {
       BaseClassMustBeDerivedFromService(this);
@@ -910,7 +1459,7 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestmainRecal(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -919,7 +1468,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_helpRecal() {
-      ::grpc::Service::MarkMethodRaw(5);
+      ::grpc::Service::MarkMethodRaw(10);
     }
     ~WithRawMethod_helpRecal() override {
       BaseClassMustBeDerivedFromService(this);
@@ -930,7 +1479,7 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequesthelpRecal(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -939,7 +1488,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_blockReloc() {
-      ::grpc::Service::MarkMethodRaw(6);
+      ::grpc::Service::MarkMethodRaw(11);
     }
     ~WithRawMethod_blockReloc() override {
       BaseClassMustBeDerivedFromService(this);
@@ -950,7 +1499,7 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestblockReloc(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -959,7 +1508,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_checkStep() {
-      ::grpc::Service::MarkMethodRaw(7);
+      ::grpc::Service::MarkMethodRaw(12);
     }
     ~WithRawMethod_checkStep() override {
       BaseClassMustBeDerivedFromService(this);
@@ -970,7 +1519,7 @@ class proxyService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestcheckStep(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1040,12 +1589,34 @@ class proxyService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_helpDecode : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_helpDecode() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->helpDecode(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_helpDecode() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status helpDecode(::grpc::ServerContext* /*context*/, const ::proxy_proto::helpDecodePlan* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* helpDecode(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_deleteBlock : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_deleteBlock() {
-      ::grpc::Service::MarkMethodRawCallback(3,
+      ::grpc::Service::MarkMethodRawCallback(4,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->deleteBlock(context, request, response); }));
@@ -1062,12 +1633,100 @@ class proxyService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_encodeAndSetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_encodeAndSetObjects() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->encodeAndSetObjects(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_encodeAndSetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status encodeAndSetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* encodeAndSetObjects(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_decodeAndGetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_decodeAndGetObjects() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->decodeAndGetObjects(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_decodeAndGetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status decodeAndGetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::GetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* decodeAndGetObjects(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_sealPack : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_sealPack() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->sealPack(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_sealPack() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status sealPack(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* sealPack(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_openRecal : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_openRecal() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->openRecal(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_openRecal() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status openRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::RecalPort* /*request*/, ::proxy_proto::RecalPort* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* openRecal(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_mainRecal : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_mainRecal() {
-      ::grpc::Service::MarkMethodRawCallback(4,
+      ::grpc::Service::MarkMethodRawCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->mainRecal(context, request, response); }));
@@ -1089,7 +1748,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_helpRecal() {
-      ::grpc::Service::MarkMethodRawCallback(5,
+      ::grpc::Service::MarkMethodRawCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->helpRecal(context, request, response); }));
@@ -1111,7 +1770,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_blockReloc() {
-      ::grpc::Service::MarkMethodRawCallback(6,
+      ::grpc::Service::MarkMethodRawCallback(11,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->blockReloc(context, request, response); }));
@@ -1133,7 +1792,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_checkStep() {
-      ::grpc::Service::MarkMethodRawCallback(7,
+      ::grpc::Service::MarkMethodRawCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->checkStep(context, request, response); }));
@@ -1231,12 +1890,39 @@ class proxyService final {
     virtual ::grpc::Status StreameddecodeAndGetObject(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proxy_proto::ObjectAndPlacement,::proxy_proto::GetReply>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_helpDecode : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_helpDecode() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::proxy_proto::helpDecodePlan, ::proxy_proto::RepIfSuccess>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::proxy_proto::helpDecodePlan, ::proxy_proto::RepIfSuccess>* streamer) {
+                       return this->StreamedhelpDecode(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_helpDecode() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status helpDecode(::grpc::ServerContext* /*context*/, const ::proxy_proto::helpDecodePlan* /*request*/, ::proxy_proto::RepIfSuccess* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedhelpDecode(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proxy_proto::helpDecodePlan,::proxy_proto::RepIfSuccess>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_deleteBlock : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_deleteBlock() {
-      ::grpc::Service::MarkMethodStreamed(3,
+      ::grpc::Service::MarkMethodStreamed(4,
         new ::grpc::internal::StreamedUnaryHandler<
           ::proxy_proto::NodeAndBlock, ::proxy_proto::DelReply>(
             [this](::grpc::ServerContext* context,
@@ -1258,12 +1944,120 @@ class proxyService final {
     virtual ::grpc::Status StreameddeleteBlock(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proxy_proto::NodeAndBlock,::proxy_proto::DelReply>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_encodeAndSetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_encodeAndSetObjects() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::proxy_proto::ObjectBatch, ::proxy_proto::SetReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::proxy_proto::ObjectBatch, ::proxy_proto::SetReply>* streamer) {
+                       return this->StreamedencodeAndSetObjects(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_encodeAndSetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status encodeAndSetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedencodeAndSetObjects(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proxy_proto::ObjectBatch,::proxy_proto::SetReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_decodeAndGetObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_decodeAndGetObjects() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::proxy_proto::ObjectBatch, ::proxy_proto::GetReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::proxy_proto::ObjectBatch, ::proxy_proto::GetReply>* streamer) {
+                       return this->StreameddecodeAndGetObjects(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_decodeAndGetObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status decodeAndGetObjects(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectBatch* /*request*/, ::proxy_proto::GetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreameddecodeAndGetObjects(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proxy_proto::ObjectBatch,::proxy_proto::GetReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_sealPack : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_sealPack() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::proxy_proto::ObjectAndPlacement, ::proxy_proto::SetReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::proxy_proto::ObjectAndPlacement, ::proxy_proto::SetReply>* streamer) {
+                       return this->StreamedsealPack(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_sealPack() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status sealPack(::grpc::ServerContext* /*context*/, const ::proxy_proto::ObjectAndPlacement* /*request*/, ::proxy_proto::SetReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedsealPack(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proxy_proto::ObjectAndPlacement,::proxy_proto::SetReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_openRecal : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_openRecal() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::proxy_proto::RecalPort, ::proxy_proto::RecalPort>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::proxy_proto::RecalPort, ::proxy_proto::RecalPort>* streamer) {
+                       return this->StreamedopenRecal(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_openRecal() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status openRecal(::grpc::ServerContext* /*context*/, const ::proxy_proto::RecalPort* /*request*/, ::proxy_proto::RecalPort* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedopenRecal(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proxy_proto::RecalPort,::proxy_proto::RecalPort>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_mainRecal : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_mainRecal() {
-      ::grpc::Service::MarkMethodStreamed(4,
+      ::grpc::Service::MarkMethodStreamed(9,
         new ::grpc::internal::StreamedUnaryHandler<
           ::proxy_proto::mainRecalPlan, ::proxy_proto::RecalReply>(
             [this](::grpc::ServerContext* context,
@@ -1290,7 +2084,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_helpRecal() {
-      ::grpc::Service::MarkMethodStreamed(5,
+      ::grpc::Service::MarkMethodStreamed(10,
         new ::grpc::internal::StreamedUnaryHandler<
           ::proxy_proto::helpRecalPlan, ::proxy_proto::RecalReply>(
             [this](::grpc::ServerContext* context,
@@ -1317,7 +2111,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_blockReloc() {
-      ::grpc::Service::MarkMethodStreamed(6,
+      ::grpc::Service::MarkMethodStreamed(11,
         new ::grpc::internal::StreamedUnaryHandler<
           ::proxy_proto::blockRelocPlan, ::proxy_proto::blockRelocReply>(
             [this](::grpc::ServerContext* context,
@@ -1344,7 +2138,7 @@ class proxyService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_checkStep() {
-      ::grpc::Service::MarkMethodStreamed(7,
+      ::grpc::Service::MarkMethodStreamed(12,
         new ::grpc::internal::StreamedUnaryHandler<
           ::proxy_proto::AskIfSuccess, ::proxy_proto::RepIfSuccess>(
             [this](::grpc::ServerContext* context,
@@ -1365,9 +2159,9 @@ class proxyService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedcheckStep(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proxy_proto::AskIfSuccess,::proxy_proto::RepIfSuccess>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_checkalive<WithStreamedUnaryMethod_encodeAndSetObject<WithStreamedUnaryMethod_decodeAndGetObject<WithStreamedUnaryMethod_deleteBlock<WithStreamedUnaryMethod_mainRecal<WithStreamedUnaryMethod_helpRecal<WithStreamedUnaryMethod_blockReloc<WithStreamedUnaryMethod_checkStep<Service > > > > > > > > StreamedUnaryService;
+  typedef WithStreamedUnaryMethod_checkalive<WithStreamedUnaryMethod_encodeAndSetObject<WithStreamedUnaryMethod_decodeAndGetObject<WithStreamedUnaryMethod_helpDecode<WithStreamedUnaryMethod_deleteBlock<WithStreamedUnaryMethod_encodeAndSetObjects<WithStreamedUnaryMethod_decodeAndGetObjects<WithStreamedUnaryMethod_sealPack<WithStreamedUnaryMethod_openRecal<WithStreamedUnaryMethod_mainRecal<WithStreamedUnaryMethod_helpRecal<WithStreamedUnaryMethod_blockReloc<WithStreamedUnaryMethod_checkStep<Service > > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_checkalive<WithStreamedUnaryMethod_encodeAndSetObject<WithStreamedUnaryMethod_decodeAndGetObject<WithStreamedUnaryMethod_deleteBlock<WithStreamedUnaryMethod_mainRecal<WithStreamedUnaryMethod_helpRecal<WithStreamedUnaryMethod_blockReloc<WithStreamedUnaryMethod_checkStep<Service > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_checkalive<WithStreamedUnaryMethod_encodeAndSetObject<WithStreamedUnaryMethod_decodeAndGetObject<WithStreamedUnaryMethod_helpDecode<WithStreamedUnaryMethod_deleteBlock<WithStreamedUnaryMethod_encodeAndSetObjects<WithStreamedUnaryMethod_decodeAndGetObjects<WithStreamedUnaryMethod_sealPack<WithStreamedUnaryMethod_openRecal<WithStreamedUnaryMethod_mainRecal<WithStreamedUnaryMethod_helpRecal<WithStreamedUnaryMethod_blockReloc<WithStreamedUnaryMethod_checkStep<Service > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace proxy_proto
@@ -29,6 +29,8 @@ PROTOBUF_CONSTEXPR locationInfo::locationInfo(
   , /*decltype(_impl_.blockkeys_)*/{}
   , /*decltype(_impl_.blockids_)*/{}
   , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.groupids_)*/{}
+  , /*decltype(_impl_._groupids_cached_byte_size_)*/{0}
   , /*decltype(_impl_.proxy_ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.cluster_id_)*/0
   , /*decltype(_impl_.proxy_port_)*/0
@@ -49,8 +51,11 @@ PROTOBUF_CONSTEXPR mainRecalPlan::mainRecalPlan(
   , /*decltype(_impl_.p_datanodeport_)*/{}
   , /*decltype(_impl_._p_datanodeport_cached_byte_size_)*/{0}
   , /*decltype(_impl_.p_blockkeys_)*/{}
+  , /*decltype(_impl_.p_blockids_)*/{}
+  , /*decltype(_impl_._p_blockids_cached_byte_size_)*/{0}
   , /*decltype(_impl_.type_)*/false
   , /*decltype(_impl_.if_partial_decoding_)*/false
+  , /*decltype(_impl_.if_fused_)*/false
   , /*decltype(_impl_.k_)*/0
   , /*decltype(_impl_.l_)*/0
   , /*decltype(_impl_.g_m_)*/0
@@ -58,6 +63,7 @@ PROTOBUF_CONSTEXPR mainRecalPlan::mainRecalPlan(
   , /*decltype(_impl_.encodetype_)*/0
   , /*decltype(_impl_.stripe_id_)*/0
   , /*decltype(_impl_.group_id_)*/0
+  , /*decltype(_impl_.task_id_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct mainRecalPlanDefaultTypeInternal {
   PROTOBUF_CONSTEXPR mainRecalPlanDefaultTypeInternal()
@@ -81,6 +87,20 @@ struct RecalReplyDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecalReplyDefaultTypeInternal _RecalReply_default_instance_;
+PROTOBUF_CONSTEXPR RecalPort::RecalPort(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.task_id_)*/0
+  , /*decltype(_impl_.port_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecalPortDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecalPortDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecalPortDefaultTypeInternal() {}
+  union {
+    RecalPort _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecalPortDefaultTypeInternal _RecalPort_default_instance_;
 PROTOBUF_CONSTEXPR helpRecalPlan::helpRecalPlan(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.datanodeip_)*/{}
@@ -89,14 +109,20 @@ PROTOBUF_CONSTEXPR helpRecalPlan::helpRecalPlan(
   , /*decltype(_impl_.blockkeys_)*/{}
   , /*decltype(_impl_.blockids_)*/{}
   , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.groupids_)*/{}
+  , /*decltype(_impl_._groupids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.targets_)*/{}
   , /*decltype(_impl_.mainproxyip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mainproxyport_)*/0
   , /*decltype(_impl_.type_)*/false
   , /*decltype(_impl_.if_partial_decoding_)*/false
-  , /*decltype(_impl_.mainproxyport_)*/0
+  , /*decltype(_impl_.if_fused_)*/false
   , /*decltype(_impl_.block_size_)*/0
   , /*decltype(_impl_.parity_num_)*/0
   , /*decltype(_impl_.k_)*/0
   , /*decltype(_impl_.encodetype_)*/0
+  , /*decltype(_impl_.l_)*/0
+  , /*decltype(_impl_.g_m_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct helpRecalPlanDefaultTypeInternal {
   PROTOBUF_CONSTEXPR helpRecalPlanDefaultTypeInternal()
@@ -107,6 +133,23 @@ struct helpRecalPlanDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 helpRecalPlanDefaultTypeInternal _helpRecalPlan_default_instance_;
+PROTOBUF_CONSTEXPR fusedTarget::fusedTarget(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parityids_)*/{}
+  , /*decltype(_impl_._parityids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.mainproxyip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mainproxyport_)*/0
+  , /*decltype(_impl_.cluster_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct fusedTargetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR fusedTargetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~fusedTargetDefaultTypeInternal() {}
+  union {
+    fusedTarget _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 fusedTargetDefaultTypeInternal _fusedTarget_default_instance_;
 PROTOBUF_CONSTEXPR blockRelocPlan::blockRelocPlan(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.blocktomove_)*/{}
@@ -117,6 +160,10 @@ PROTOBUF_CONSTEXPR blockRelocPlan::blockRelocPlan(
   , /*decltype(_impl_.todatanodeport_)*/{}
   , /*decltype(_impl_._todatanodeport_cached_byte_size_)*/{0}
   , /*decltype(_impl_.block_size_)*/0
+  , /*decltype(_impl_.task_id_)*/0
+  , /*decltype(_impl_.max_parallel_)*/0
+  , /*decltype(_impl_.max_per_des_node_)*/0
+  , /*decltype(_impl_.bandwidth_)*/int64_t{0}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct blockRelocPlanDefaultTypeInternal {
   PROTOBUF_CONSTEXPR blockRelocPlanDefaultTypeInternal()
@@ -143,6 +190,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR AskIfSuccess::AskIfSuccess(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.step_)*/0
+  , /*decltype(_impl_.task_id_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct AskIfSuccessDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AskIfSuccessDefaultTypeInternal()
@@ -174,6 +222,7 @@ PROTOBUF_CONSTEXPR NodeAndBlock::NodeAndBlock(
   , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
   , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.stripe_id_)*/0
+  , /*decltype(_impl_.task_id_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct NodeAndBlockDefaultTypeInternal {
   PROTOBUF_CONSTEXPR NodeAndBlockDefaultTypeInternal()
@@ -231,6 +280,10 @@ PROTOBUF_CONSTEXPR ObjectAndPlacement::ObjectAndPlacement(
   , /*decltype(_impl_.blockkeys_)*/{}
   , /*decltype(_impl_.blockids_)*/{}
   , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.islocal_)*/{}
+  , /*decltype(_impl_.clusterids_)*/{}
+  , /*decltype(_impl_._clusterids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.packed_keys_)*/{}
   , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.clientip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.valuesizebyte_)*/0
@@ -241,6 +294,10 @@ PROTOBUF_CONSTEXPR ObjectAndPlacement::ObjectAndPlacement(
   , /*decltype(_impl_.block_size_)*/0
   , /*decltype(_impl_.encode_type_)*/0
   , /*decltype(_impl_.clientport_)*/0
+  , /*decltype(_impl_.if_partial_decoding_)*/false
+  , /*decltype(_impl_.with_key_size_)*/false
+  , /*decltype(_impl_.packed_)*/false
+  , /*decltype(_impl_.offset_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ObjectAndPlacementDefaultTypeInternal {
   PROTOBUF_CONSTEXPR ObjectAndPlacementDefaultTypeInternal()
@@ -251,6 +308,19 @@ struct ObjectAndPlacementDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ObjectAndPlacementDefaultTypeInternal _ObjectAndPlacement_default_instance_;
+PROTOBUF_CONSTEXPR ObjectBatch::ObjectBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.objects_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ObjectBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ObjectBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ObjectBatchDefaultTypeInternal() {}
+  union {
+    ObjectBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ObjectBatchDefaultTypeInternal _ObjectBatch_default_instance_;
 PROTOBUF_CONSTEXPR SetReply::SetReply(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.ifcommit_)*/false
@@ -277,8 +347,32 @@ struct GetReplyDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetReplyDefaultTypeInternal _GetReply_default_instance_;
+PROTOBUF_CONSTEXPR helpDecodePlan::helpDecodePlan(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.datanodeip_)*/{}
+  , /*decltype(_impl_.datanodeport_)*/{}
+  , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.blockkeys_)*/{}
+  , /*decltype(_impl_.blockids_)*/{}
+  , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.coefficients_)*/{}
+  , /*decltype(_impl_._coefficients_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.mainproxyip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mainproxyport_)*/0
+  , /*decltype(_impl_.block_size_)*/0
+  , /*decltype(_impl_.failed_num_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct helpDecodePlanDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR helpDecodePlanDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~helpDecodePlanDefaultTypeInternal() {}
+  union {
+    helpDecodePlan _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 helpDecodePlanDefaultTypeInternal _helpDecodePlan_default_instance_;
 }  // namespace proxy_proto
-static ::_pb::Metadata file_level_metadata_proxy_2eproto[15];
+static ::_pb::Metadata file_level_metadata_proxy_2eproto[19];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proxy_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proxy_2eproto = nullptr;
 
@@ -296,6 +390,7 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   PROTOBUF_FIELD_OFFSET(::proxy_proto::locationInfo, _impl_.datanodeport_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::locationInfo, _impl_.blockkeys_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::locationInfo, _impl_.blockids_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::locationInfo, _impl_.groupids_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::mainRecalPlan, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -315,6 +410,9 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   PROTOBUF_FIELD_OFFSET(::proxy_proto::mainRecalPlan, _impl_.encodetype_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::mainRecalPlan, _impl_.stripe_id_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::mainRecalPlan, _impl_.group_id_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::mainRecalPlan, _impl_.if_fused_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::mainRecalPlan, _impl_.p_blockids_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::mainRecalPlan, _impl_.task_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::RecalReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -323,6 +421,14 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::RecalReply, _impl_.result_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::RecalPort, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::RecalPort, _impl_.task_id_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::RecalPort, _impl_.port_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -340,6 +446,21 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _impl_.parity_num_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _impl_.k_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _impl_.encodetype_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _impl_.if_fused_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _impl_.groupids_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _impl_.l_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _impl_.g_m_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpRecalPlan, _impl_.targets_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::fusedTarget, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::fusedTarget, _impl_.mainproxyip_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::fusedTarget, _impl_.mainproxyport_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::fusedTarget, _impl_.parityids_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::fusedTarget, _impl_.cluster_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocPlan, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -352,6 +473,10 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocPlan, _impl_.todatanodeip_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocPlan, _impl_.todatanodeport_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocPlan, _impl_.block_size_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocPlan, _impl_.task_id_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocPlan, _impl_.max_parallel_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocPlan, _impl_.max_per_des_node_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocPlan, _impl_.bandwidth_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::blockRelocReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -366,6 +491,7 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::AskIfSuccess, _impl_.step_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::AskIfSuccess, _impl_.task_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::RepIfSuccess, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -384,6 +510,7 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   PROTOBUF_FIELD_OFFSET(::proxy_proto::NodeAndBlock, _impl_.datanodeport_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::NodeAndBlock, _impl_.stripe_id_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::NodeAndBlock, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::NodeAndBlock, _impl_.task_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::DelReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -425,6 +552,20 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.encode_type_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.clientip_),
   PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.clientport_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.islocal_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.if_partial_decoding_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.clusterids_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.with_key_size_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.packed_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectAndPlacement, _impl_.packed_keys_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::ObjectBatch, _impl_.objects_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::SetReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -439,30 +580,51 @@ const uint32_t TableStruct_proxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proxy_proto::GetReply, _impl_.getsuccess_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.mainproxyip_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.mainproxyport_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.datanodeip_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.datanodeport_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.blockkeys_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.blockids_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.block_size_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.failed_num_),
+  PROTOBUF_FIELD_OFFSET(::proxy_proto::helpDecodePlan, _impl_.coefficients_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::proxy_proto::locationInfo)},
-  { 13, -1, -1, sizeof(::proxy_proto::mainRecalPlan)},
-  { 32, -1, -1, sizeof(::proxy_proto::RecalReply)},
-  { 39, -1, -1, sizeof(::proxy_proto::helpRecalPlan)},
-  { 57, -1, -1, sizeof(::proxy_proto::blockRelocPlan)},
-  { 69, -1, -1, sizeof(::proxy_proto::blockRelocReply)},
-  { 76, -1, -1, sizeof(::proxy_proto::AskIfSuccess)},
-  { 83, -1, -1, sizeof(::proxy_proto::RepIfSuccess)},
-  { 90, -1, -1, sizeof(::proxy_proto::NodeAndBlock)},
-  { 101, -1, -1, sizeof(::proxy_proto::DelReply)},
-  { 108, -1, -1, sizeof(::proxy_proto::CheckaliveCMD)},
-  { 115, -1, -1, sizeof(::proxy_proto::RequestResult)},
-  { 122, -1, -1, sizeof(::proxy_proto::ObjectAndPlacement)},
-  { 142, -1, -1, sizeof(::proxy_proto::SetReply)},
-  { 149, -1, -1, sizeof(::proxy_proto::GetReply)},
+  { 14, -1, -1, sizeof(::proxy_proto::mainRecalPlan)},
+  { 36, -1, -1, sizeof(::proxy_proto::RecalReply)},
+  { 43, -1, -1, sizeof(::proxy_proto::RecalPort)},
+  { 51, -1, -1, sizeof(::proxy_proto::helpRecalPlan)},
+  { 74, -1, -1, sizeof(::proxy_proto::fusedTarget)},
+  { 84, -1, -1, sizeof(::proxy_proto::blockRelocPlan)},
+  { 100, -1, -1, sizeof(::proxy_proto::blockRelocReply)},
+  { 107, -1, -1, sizeof(::proxy_proto::AskIfSuccess)},
+  { 115, -1, -1, sizeof(::proxy_proto::RepIfSuccess)},
+  { 122, -1, -1, sizeof(::proxy_proto::NodeAndBlock)},
+  { 134, -1, -1, sizeof(::proxy_proto::DelReply)},
+  { 141, -1, -1, sizeof(::proxy_proto::CheckaliveCMD)},
+  { 148, -1, -1, sizeof(::proxy_proto::RequestResult)},
+  { 155, -1, -1, sizeof(::proxy_proto::ObjectAndPlacement)},
+  { 182, -1, -1, sizeof(::proxy_proto::ObjectBatch)},
+  { 189, -1, -1, sizeof(::proxy_proto::SetReply)},
+  { 196, -1, -1, sizeof(::proxy_proto::GetReply)},
+  { 203, -1, -1, sizeof(::proxy_proto::helpDecodePlan)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::proxy_proto::_locationInfo_default_instance_._instance,
   &::proxy_proto::_mainRecalPlan_default_instance_._instance,
   &::proxy_proto::_RecalReply_default_instance_._instance,
+  &::proxy_proto::_RecalPort_default_instance_._instance,
   &::proxy_proto::_helpRecalPlan_default_instance_._instance,
+  &::proxy_proto::_fusedTarget_default_instance_._instance,
   &::proxy_proto::_blockRelocPlan_default_instance_._instance,
   &::proxy_proto::_blockRelocReply_default_instance_._instance,
   &::proxy_proto::_AskIfSuccess_default_instance_._instance,
@@ -472,71 +634,103 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::proxy_proto::_CheckaliveCMD_default_instance_._instance,
   &::proxy_proto::_RequestResult_default_instance_._instance,
   &::proxy_proto::_ObjectAndPlacement_default_instance_._instance,
+  &::proxy_proto::_ObjectBatch_default_instance_._instance,
   &::proxy_proto::_SetReply_default_instance_._instance,
   &::proxy_proto::_GetReply_default_instance_._instance,
+  &::proxy_proto::_helpDecodePlan_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_proxy_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\013proxy.proto\022\013proxy_proto\"\227\001\n\014locationI"
+  "\n\013proxy.proto\022\013proxy_proto\"\251\001\n\014locationI"
   "nfo\022\022\n\ncluster_id\030\001 \001(\005\022\020\n\010proxy_ip\030\002 \001("
   "\t\022\022\n\nproxy_port\030\003 \001(\005\022\022\n\ndatanodeip\030\004 \003("
   "\t\022\024\n\014datanodeport\030\005 \003(\005\022\021\n\tblockkeys\030\006 \003"
-  "(\t\022\020\n\010blockids\030\007 \003(\005\"\232\002\n\rmainRecalPlan\022\014"
-  "\n\004type\030\001 \001(\010\022\033\n\023if_partial_decoding\030\002 \001("
-  "\010\022+\n\010clusters\030\003 \003(\0132\031.proxy_proto.locati"
-  "onInfo\022\024\n\014p_datanodeip\030\004 \003(\t\022\026\n\016p_datano"
-  "deport\030\005 \003(\005\022\023\n\013p_blockkeys\030\006 \003(\t\022\t\n\001k\030\007"
-  " \001(\005\022\t\n\001l\030\010 \001(\005\022\013\n\003g_m\030\t \001(\005\022\022\n\nblock_si"
-  "ze\030\n \001(\005\022\022\n\nencodetype\030\013 \001(\005\022\021\n\tstripe_i"
-  "d\030\014 \001(\005\022\020\n\010group_id\030\r \001(\005\"\034\n\nRecalReply\022"
-  "\016\n\006result\030\001 \001(\t\"\374\001\n\rhelpRecalPlan\022\014\n\004typ"
-  "e\030\001 \001(\010\022\033\n\023if_partial_decoding\030\002 \001(\010\022\023\n\013"
-  "mainproxyip\030\003 \001(\t\022\025\n\rmainproxyport\030\004 \001(\005"
-  "\022\022\n\ndatanodeip\030\005 \003(\t\022\024\n\014datanodeport\030\006 \003"
-  "(\005\022\021\n\tblockkeys\030\007 \003(\t\022\022\n\nblock_size\030\010 \001("
-  "\005\022\020\n\010blockids\030\t \003(\005\022\022\n\nparity_num\030\n \001(\005\022"
-  "\t\n\001k\030\013 \001(\005\022\022\n\nencodetype\030\014 \001(\005\"\231\001\n\016block"
-  "RelocPlan\022\023\n\013blocktomove\030\001 \003(\t\022\026\n\016fromda"
-  "tanodeip\030\002 \003(\t\022\030\n\020fromdatanodeport\030\003 \003(\005"
-  "\022\024\n\014todatanodeip\030\004 \003(\t\022\026\n\016todatanodeport"
-  "\030\005 \003(\005\022\022\n\nblock_size\030\006 \001(\005\"!\n\017blockReloc"
-  "Reply\022\016\n\006result\030\001 \001(\t\"\034\n\014AskIfSuccess\022\014\n"
-  "\004step\030\001 \001(\005\"!\n\014RepIfSuccess\022\021\n\tifsuccess"
-  "\030\001 \001(\010\"k\n\014NodeAndBlock\022\021\n\tblockkeys\030\001 \003("
-  "\t\022\022\n\ndatanodeip\030\002 \003(\t\022\024\n\014datanodeport\030\003 "
-  "\003(\005\022\021\n\tstripe_id\030\004 \001(\005\022\013\n\003key\030\005 \001(\t\"\034\n\010D"
-  "elReply\022\020\n\010ifcommit\030\001 \001(\010\"\035\n\rCheckaliveC"
-  "MD\022\014\n\004name\030\001 \001(\t\" \n\rRequestResult\022\017\n\007mes"
-  "sage\030\001 \001(\010\"\214\002\n\022ObjectAndPlacement\022\013\n\003key"
-  "\030\001 \001(\t\022\025\n\rvaluesizebyte\030\002 \001(\005\022\t\n\001k\030\003 \001(\005"
-  "\022\t\n\001l\030\004 \001(\005\022\013\n\003g_m\030\005 \001(\005\022\021\n\tstripe_id\030\006 "
-  "\001(\005\022\022\n\ndatanodeip\030\007 \003(\t\022\024\n\014datanodeport\030"
-  "\010 \003(\005\022\021\n\tblockkeys\030\t \003(\t\022\020\n\010blockids\030\n \003"
-  "(\005\022\022\n\nblock_size\030\013 \001(\005\022\023\n\013encode_type\030\014 "
-  "\001(\005\022\020\n\010clientip\030\r \001(\t\022\022\n\nclientport\030\016 \001("
-  "\005\"\034\n\010SetReply\022\020\n\010ifcommit\030\001 \001(\010\"\036\n\010GetRe"
-  "ply\022\022\n\ngetsuccess\030\001 \001(\0102\301\004\n\014proxyService"
-  "\022D\n\ncheckalive\022\032.proxy_proto.CheckaliveC"
-  "MD\032\032.proxy_proto.RequestResult\022L\n\022encode"
-  "AndSetObject\022\037.proxy_proto.ObjectAndPlac"
-  "ement\032\025.proxy_proto.SetReply\022L\n\022decodeAn"
-  "dGetObject\022\037.proxy_proto.ObjectAndPlacem"
-  "ent\032\025.proxy_proto.GetReply\022\?\n\013deleteBloc"
-  "k\022\031.proxy_proto.NodeAndBlock\032\025.proxy_pro"
-  "to.DelReply\022@\n\tmainRecal\022\032.proxy_proto.m"
-  "ainRecalPlan\032\027.proxy_proto.RecalReply\022@\n"
-  "\thelpRecal\022\032.proxy_proto.helpRecalPlan\032\027"
-  ".proxy_proto.RecalReply\022G\n\nblockReloc\022\033."
-  "proxy_proto.blockRelocPlan\032\034.proxy_proto"
-  ".blockRelocReply\022A\n\tcheckStep\022\031.proxy_pr"
-  "oto.AskIfSuccess\032\031.proxy_proto.RepIfSucc"
-  "essb\006proto3"
+  "(\t\022\020\n\010blockids\030\007 \003(\005\022\020\n\010groupids\030\010 \003(\005\"\321"
+  "\002\n\rmainRecalPlan\022\014\n\004type\030\001 \001(\010\022\033\n\023if_par"
+  "tial_decoding\030\002 \001(\010\022+\n\010clusters\030\003 \003(\0132\031."
+  "proxy_proto.locationInfo\022\024\n\014p_datanodeip"
+  "\030\004 \003(\t\022\026\n\016p_datanodeport\030\005 \003(\005\022\023\n\013p_bloc"
+  "kkeys\030\006 \003(\t\022\t\n\001k\030\007 \001(\005\022\t\n\001l\030\010 \001(\005\022\013\n\003g_m"
+  "\030\t \001(\005\022\022\n\nblock_size\030\n \001(\005\022\022\n\nencodetype"
+  "\030\013 \001(\005\022\021\n\tstripe_id\030\014 \001(\005\022\020\n\010group_id\030\r "
+  "\001(\005\022\020\n\010if_fused\030\016 \001(\010\022\022\n\np_blockids\030\017 \003("
+  "\005\022\017\n\007task_id\030\020 \001(\005\"\034\n\nRecalReply\022\016\n\006resu"
+  "lt\030\001 \001(\t\"*\n\tRecalPort\022\017\n\007task_id\030\001 \001(\005\022\014"
+  "\n\004port\030\002 \001(\005\"\343\002\n\rhelpRecalPlan\022\014\n\004type\030\001"
+  " \001(\010\022\033\n\023if_partial_decoding\030\002 \001(\010\022\023\n\013mai"
+  "nproxyip\030\003 \001(\t\022\025\n\rmainproxyport\030\004 \001(\005\022\022\n"
+  "\ndatanodeip\030\005 \003(\t\022\024\n\014datanodeport\030\006 \003(\005\022"
+  "\021\n\tblockkeys\030\007 \003(\t\022\022\n\nblock_size\030\010 \001(\005\022\020"
+  "\n\010blockids\030\t \003(\005\022\022\n\nparity_num\030\n \001(\005\022\t\n\001"
+  "k\030\013 \001(\005\022\022\n\nencodetype\030\014 \001(\005\022\020\n\010if_fused\030"
+  "\r \001(\010\022\020\n\010groupids\030\016 \003(\005\022\t\n\001l\030\017 \001(\005\022\013\n\003g_"
+  "m\030\020 \001(\005\022)\n\007targets\030\021 \003(\0132\030.proxy_proto.f"
+  "usedTarget\"`\n\013fusedTarget\022\023\n\013mainproxyip"
+  "\030\001 \001(\t\022\025\n\rmainproxyport\030\002 \001(\005\022\021\n\tparityi"
+  "ds\030\003 \003(\005\022\022\n\ncluster_id\030\004 \001(\005\"\355\001\n\016blockRe"
+  "locPlan\022\023\n\013blocktomove\030\001 \003(\t\022\026\n\016fromdata"
+  "nodeip\030\002 \003(\t\022\030\n\020fromdatanodeport\030\003 \003(\005\022\024"
+  "\n\014todatanodeip\030\004 \003(\t\022\026\n\016todatanodeport\030\005"
+  " \003(\005\022\022\n\nblock_size\030\006 \001(\005\022\017\n\007task_id\030\007 \001("
+  "\005\022\024\n\014max_parallel\030\010 \001(\005\022\030\n\020max_per_des_n"
+  "ode\030\t \001(\005\022\021\n\tbandwidth\030\n \001(\003\"!\n\017blockRel"
+  "ocReply\022\016\n\006result\030\001 \001(\t\"-\n\014AskIfSuccess\022"
+  "\014\n\004step\030\001 \001(\005\022\017\n\007task_id\030\002 \001(\005\"!\n\014RepIfS"
+  "uccess\022\021\n\tifsuccess\030\001 \001(\010\"|\n\014NodeAndBloc"
+  "k\022\021\n\tblockkeys\030\001 \003(\t\022\022\n\ndatanodeip\030\002 \003(\t"
+  "\022\024\n\014datanodeport\030\003 \003(\005\022\021\n\tstripe_id\030\004 \001("
+  "\005\022\013\n\003key\030\005 \001(\t\022\017\n\007task_id\030\006 \001(\005\"\034\n\010DelRe"
+  "ply\022\020\n\010ifcommit\030\001 \001(\010\"\035\n\rCheckaliveCMD\022\014"
+  "\n\004name\030\001 \001(\t\" \n\rRequestResult\022\017\n\007message"
+  "\030\001 \001(\010\"\232\003\n\022ObjectAndPlacement\022\013\n\003key\030\001 \001"
+  "(\t\022\025\n\rvaluesizebyte\030\002 \001(\005\022\t\n\001k\030\003 \001(\005\022\t\n\001"
+  "l\030\004 \001(\005\022\013\n\003g_m\030\005 \001(\005\022\021\n\tstripe_id\030\006 \001(\005\022"
+  "\022\n\ndatanodeip\030\007 \003(\t\022\024\n\014datanodeport\030\010 \003("
+  "\005\022\021\n\tblockkeys\030\t \003(\t\022\020\n\010blockids\030\n \003(\005\022\022"
+  "\n\nblock_size\030\013 \001(\005\022\023\n\013encode_type\030\014 \001(\005\022"
+  "\020\n\010clientip\030\r \001(\t\022\022\n\nclientport\030\016 \001(\005\022\017\n"
+  "\007islocal\030\017 \003(\010\022\033\n\023if_partial_decoding\030\020 "
+  "\001(\010\022\022\n\nclusterids\030\021 \003(\005\022\025\n\rwith_key_size"
+  "\030\022 \001(\010\022\016\n\006offset\030\023 \001(\005\022\016\n\006packed\030\024 \001(\010\022\023"
+  "\n\013packed_keys\030\025 \003(\t\"\?\n\013ObjectBatch\0220\n\007ob"
+  "jects\030\001 \003(\0132\037.proxy_proto.ObjectAndPlace"
+  "ment\"\034\n\010SetReply\022\020\n\010ifcommit\030\001 \001(\010\"\036\n\010Ge"
+  "tReply\022\022\n\ngetsuccess\030\001 \001(\010\"\311\001\n\016helpDecod"
+  "ePlan\022\023\n\013mainproxyip\030\001 \001(\t\022\025\n\rmainproxyp"
+  "ort\030\002 \001(\005\022\022\n\ndatanodeip\030\003 \003(\t\022\024\n\014datanod"
+  "eport\030\004 \003(\005\022\021\n\tblockkeys\030\005 \003(\t\022\020\n\010blocki"
+  "ds\030\006 \003(\005\022\022\n\nblock_size\030\007 \001(\005\022\022\n\nfailed_n"
+  "um\030\010 \001(\005\022\024\n\014coefficients\030\t \003(\0052\230\007\n\014proxy"
+  "Service\022D\n\ncheckalive\022\032.proxy_proto.Chec"
+  "kaliveCMD\032\032.proxy_proto.RequestResult\022L\n"
+  "\022encodeAndSetObject\022\037.proxy_proto.Object"
+  "AndPlacement\032\025.proxy_proto.SetReply\022L\n\022d"
+  "ecodeAndGetObject\022\037.proxy_proto.ObjectAn"
+  "dPlacement\032\025.proxy_proto.GetReply\022D\n\nhel"
+  "pDecode\022\033.proxy_proto.helpDecodePlan\032\031.p"
+  "roxy_proto.RepIfSuccess\022\?\n\013deleteBlock\022\031"
+  ".proxy_proto.NodeAndBlock\032\025.proxy_proto."
+  "DelReply\022F\n\023encodeAndSetObjects\022\030.proxy_"
+  "proto.ObjectBatch\032\025.proxy_proto.SetReply"
+  "\022F\n\023decodeAndGetObjects\022\030.proxy_proto.Ob"
+  "jectBatch\032\025.proxy_proto.GetReply\022B\n\010seal"
+  "Pack\022\037.proxy_proto.ObjectAndPlacement\032\025."
+  "proxy_proto.SetReply\022;\n\topenRecal\022\026.prox"
+  "y_proto.RecalPort\032\026.proxy_proto.RecalPor"
+  "t\022@\n\tmainRecal\022\032.proxy_proto.mainRecalPl"
+  "an\032\027.proxy_proto.RecalReply\022@\n\thelpRecal"
+  "\022\032.proxy_proto.helpRecalPlan\032\027.proxy_pro"
+  "to.RecalReply\022G\n\nblockReloc\022\033.proxy_prot"
+  "o.blockRelocPlan\032\034.proxy_proto.blockRelo"
+  "cReply\022A\n\tcheckStep\022\031.proxy_proto.AskIfS"
+  "uccess\032\031.proxy_proto.RepIfSuccessb\006proto"
+  "3"
   ;
 static ::_pbi::once_flag descriptor_table_proxy_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_proxy_2eproto = {
-    false, false, 2131, descriptor_table_protodef_proxy_2eproto,
+    false, false, 3321, descriptor_table_protodef_proxy_2eproto,
     "proxy.proto",
-    &descriptor_table_proxy_2eproto_once, nullptr, 0, 15,
+    &descriptor_table_proxy_2eproto_once, nullptr, 0, 19,
     schemas, file_default_instances, TableStruct_proxy_2eproto::offsets,
     file_level_metadata_proxy_2eproto, file_level_enum_descriptors_proxy_2eproto,
     file_level_service_descriptors_proxy_2eproto,
@@ -571,6 +765,8 @@ locationInfo::locationInfo(const locationInfo& from)
     , decltype(_impl_.blockkeys_){from._impl_.blockkeys_}
     , decltype(_impl_.blockids_){from._impl_.blockids_}
     , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+    , decltype(_impl_.groupids_){from._impl_.groupids_}
+    , /*decltype(_impl_._groupids_cached_byte_size_)*/{0}
     , decltype(_impl_.proxy_ip_){}
     , decltype(_impl_.cluster_id_){}
     , decltype(_impl_.proxy_port_){}
@@ -602,6 +798,8 @@ inline void locationInfo::SharedCtor(
     , decltype(_impl_.blockkeys_){arena}
     , decltype(_impl_.blockids_){arena}
     , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+    , decltype(_impl_.groupids_){arena}
+    , /*decltype(_impl_._groupids_cached_byte_size_)*/{0}
     , decltype(_impl_.proxy_ip_){}
     , decltype(_impl_.cluster_id_){0}
     , decltype(_impl_.proxy_port_){0}
@@ -628,6 +826,7 @@ inline void locationInfo::SharedDtor() {
   _impl_.datanodeport_.~RepeatedField();
   _impl_.blockkeys_.~RepeatedPtrField();
   _impl_.blockids_.~RepeatedField();
+  _impl_.groupids_.~RepeatedField();
   _impl_.proxy_ip_.Destroy();
 }
 
@@ -645,6 +844,7 @@ void locationInfo::Clear() {
   _impl_.datanodeport_.Clear();
   _impl_.blockkeys_.Clear();
   _impl_.blockids_.Clear();
+  _impl_.groupids_.Clear();
   _impl_.proxy_ip_.ClearToEmpty();
   ::memset(&_impl_.cluster_id_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&_impl_.proxy_port_) -
@@ -736,6 +936,17 @@ const char* locationInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // repeated int32 groupids = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_groupids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_groupids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -825,6 +1036,15 @@ uint8_t* locationInfo::_InternalSerialize(
     }
   }
 
+  // repeated int32 groupids = 8;
+  {
+    int byte_size = _impl_._groupids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          8, _internal_groupids(), byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -885,6 +1105,20 @@ size_t locationInfo::ByteSizeLong() const {
     total_size += data_size;
   }
 
+  // repeated int32 groupids = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.groupids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._groupids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // string proxy_ip = 2;
   if (!this->_internal_proxy_ip().empty()) {
     total_size += 1 +
@@ -924,6 +1158,7 @@ void locationInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   _this->_impl_.datanodeport_.MergeFrom(from._impl_.datanodeport_);
   _this->_impl_.blockkeys_.MergeFrom(from._impl_.blockkeys_);
   _this->_impl_.blockids_.MergeFrom(from._impl_.blockids_);
+  _this->_impl_.groupids_.MergeFrom(from._impl_.groupids_);
   if (!from._internal_proxy_ip().empty()) {
     _this->_internal_set_proxy_ip(from._internal_proxy_ip());
   }
@@ -956,6 +1191,7 @@ void locationInfo::InternalSwap(locationInfo* other) {
   _impl_.datanodeport_.InternalSwap(&other->_impl_.datanodeport_);
   _impl_.blockkeys_.InternalSwap(&other->_impl_.blockkeys_);
   _impl_.blockids_.InternalSwap(&other->_impl_.blockids_);
+  _impl_.groupids_.InternalSwap(&other->_impl_.groupids_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.proxy_ip_, lhs_arena,
       &other->_impl_.proxy_ip_, rhs_arena
@@ -995,8 +1231,11 @@ mainRecalPlan::mainRecalPlan(const mainRecalPlan& from)
     , decltype(_impl_.p_datanodeport_){from._impl_.p_datanodeport_}
     , /*decltype(_impl_._p_datanodeport_cached_byte_size_)*/{0}
     , decltype(_impl_.p_blockkeys_){from._impl_.p_blockkeys_}
+    , decltype(_impl_.p_blockids_){from._impl_.p_blockids_}
+    , /*decltype(_impl_._p_blockids_cached_byte_size_)*/{0}
     , decltype(_impl_.type_){}
     , decltype(_impl_.if_partial_decoding_){}
+    , decltype(_impl_.if_fused_){}
     , decltype(_impl_.k_){}
     , decltype(_impl_.l_){}
     , decltype(_impl_.g_m_){}
@@ -1004,12 +1243,13 @@ mainRecalPlan::mainRecalPlan(const mainRecalPlan& from)
     , decltype(_impl_.encodetype_){}
     , decltype(_impl_.stripe_id_){}
     , decltype(_impl_.group_id_){}
+    , decltype(_impl_.task_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::memcpy(&_impl_.type_, &from._impl_.type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.group_id_) -
-    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.group_id_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.task_id_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.task_id_));
   // @@protoc_insertion_point(copy_constructor:proxy_proto.mainRecalPlan)
 }
 
@@ -1023,8 +1263,11 @@ inline void mainRecalPlan::SharedCtor(
     , decltype(_impl_.p_datanodeport_){arena}
     , /*decltype(_impl_._p_datanodeport_cached_byte_size_)*/{0}
     , decltype(_impl_.p_blockkeys_){arena}
+    , decltype(_impl_.p_blockids_){arena}
+    , /*decltype(_impl_._p_blockids_cached_byte_size_)*/{0}
     , decltype(_impl_.type_){false}
     , decltype(_impl_.if_partial_decoding_){false}
+    , decltype(_impl_.if_fused_){false}
     , decltype(_impl_.k_){0}
     , decltype(_impl_.l_){0}
     , decltype(_impl_.g_m_){0}
@@ -1032,6 +1275,7 @@ inline void mainRecalPlan::SharedCtor(
     , decltype(_impl_.encodetype_){0}
     , decltype(_impl_.stripe_id_){0}
     , decltype(_impl_.group_id_){0}
+    , decltype(_impl_.task_id_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -1051,6 +1295,7 @@ inline void mainRecalPlan::SharedDtor() {
   _impl_.p_datanodeip_.~RepeatedPtrField();
   _impl_.p_datanodeport_.~RepeatedField();
   _impl_.p_blockkeys_.~RepeatedPtrField();
+  _impl_.p_blockids_.~RepeatedField();
 }
 
 void mainRecalPlan::SetCachedSize(int size) const {
@@ -1067,9 +1312,10 @@ void mainRecalPlan::Clear() {
   _impl_.p_datanodeip_.Clear();
   _impl_.p_datanodeport_.Clear();
   _impl_.p_blockkeys_.Clear();
+  _impl_.p_blockids_.Clear();
   ::memset(&_impl_.type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.group_id_) -
-      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.group_id_));
+      reinterpret_cast<char*>(&_impl_.task_id_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.task_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1205,6 +1451,33 @@ const char* mainRecalPlan::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // bool if_fused = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.if_fused_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 p_blockids = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_p_blockids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 120) {
+          _internal_add_p_blockids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 task_id = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.task_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1325,6 +1598,27 @@ uint8_t* mainRecalPlan::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(13, this->_internal_group_id(), target);
   }
 
+  // bool if_fused = 14;
+  if (this->_internal_if_fused() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(14, this->_internal_if_fused(), target);
+  }
+
+  // repeated int32 p_blockids = 15;
+  {
+    int byte_size = _impl_._p_blockids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          15, _internal_p_blockids(), byte_size, target);
+    }
+  }
+
+  // int32 task_id = 16;
+  if (this->_internal_task_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(16, this->_internal_task_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1378,6 +1672,20 @@ size_t mainRecalPlan::ByteSizeLong() const {
       _impl_.p_blockkeys_.Get(i));
   }
 
+  // repeated int32 p_blockids = 15;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.p_blockids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._p_blockids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // bool type = 1;
   if (this->_internal_type() != 0) {
     total_size += 1 + 1;
@@ -1388,6 +1696,11 @@ size_t mainRecalPlan::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
+  // bool if_fused = 14;
+  if (this->_internal_if_fused() != 0) {
+    total_size += 1 + 1;
+  }
+
   // int32 k = 7;
   if (this->_internal_k() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_k());
@@ -1423,6 +1736,13 @@ size_t mainRecalPlan::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_group_id());
   }
 
+  // int32 task_id = 16;
+  if (this->_internal_task_id() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_task_id());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1445,12 +1765,16 @@ void mainRecalPlan::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::
   _this->_impl_.p_datanodeip_.MergeFrom(from._impl_.p_datanodeip_);
   _this->_impl_.p_datanodeport_.MergeFrom(from._impl_.p_datanodeport_);
   _this->_impl_.p_blockkeys_.MergeFrom(from._impl_.p_blockkeys_);
+  _this->_impl_.p_blockids_.MergeFrom(from._impl_.p_blockids_);
   if (from._internal_type() != 0) {
     _this->_internal_set_type(from._internal_type());
   }
   if (from._internal_if_partial_decoding() != 0) {
     _this->_internal_set_if_partial_decoding(from._internal_if_partial_decoding());
   }
+  if (from._internal_if_fused() != 0) {
+    _this->_internal_set_if_fused(from._internal_if_fused());
+  }
   if (from._internal_k() != 0) {
     _this->_internal_set_k(from._internal_k());
   }
@@ -1472,6 +1796,9 @@ void mainRecalPlan::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::
   if (from._internal_group_id() != 0) {
     _this->_internal_set_group_id(from._internal_group_id());
   }
+  if (from._internal_task_id() != 0) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1493,9 +1820,10 @@ void mainRecalPlan::InternalSwap(mainRecalPlan* other) {
   _impl_.p_datanodeip_.InternalSwap(&other->_impl_.p_datanodeip_);
   _impl_.p_datanodeport_.InternalSwap(&other->_impl_.p_datanodeport_);
   _impl_.p_blockkeys_.InternalSwap(&other->_impl_.p_blockkeys_);
+  _impl_.p_blockids_.InternalSwap(&other->_impl_.p_blockids_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(mainRecalPlan, _impl_.group_id_)
-      + sizeof(mainRecalPlan::_impl_.group_id_)
+      PROTOBUF_FIELD_OFFSET(mainRecalPlan, _impl_.task_id_)
+      + sizeof(mainRecalPlan::_impl_.task_id_)
       - PROTOBUF_FIELD_OFFSET(mainRecalPlan, _impl_.type_)>(
           reinterpret_cast<char*>(&_impl_.type_),
           reinterpret_cast<char*>(&other->_impl_.type_));
@@ -1712,80 +2040,44 @@ void RecalReply::InternalSwap(RecalReply* other) {
 
 // ===================================================================
 
-class helpRecalPlan::_Internal {
+class RecalPort::_Internal {
  public:
 };
 
-helpRecalPlan::helpRecalPlan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+RecalPort::RecalPort(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:proxy_proto.helpRecalPlan)
+  // @@protoc_insertion_point(arena_constructor:proxy_proto.RecalPort)
 }
-helpRecalPlan::helpRecalPlan(const helpRecalPlan& from)
+RecalPort::RecalPort(const RecalPort& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  helpRecalPlan* const _this = this; (void)_this;
+  RecalPort* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.datanodeip_){from._impl_.datanodeip_}
-    , decltype(_impl_.datanodeport_){from._impl_.datanodeport_}
-    , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
-    , decltype(_impl_.blockkeys_){from._impl_.blockkeys_}
-    , decltype(_impl_.blockids_){from._impl_.blockids_}
-    , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
-    , decltype(_impl_.mainproxyip_){}
-    , decltype(_impl_.type_){}
-    , decltype(_impl_.if_partial_decoding_){}
-    , decltype(_impl_.mainproxyport_){}
-    , decltype(_impl_.block_size_){}
-    , decltype(_impl_.parity_num_){}
-    , decltype(_impl_.k_){}
-    , decltype(_impl_.encodetype_){}
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.port_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.mainproxyip_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_mainproxyip().empty()) {
-    _this->_impl_.mainproxyip_.Set(from._internal_mainproxyip(), 
-      _this->GetArenaForAllocation());
-  }
-  ::memcpy(&_impl_.type_, &from._impl_.type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.encodetype_) -
-    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.encodetype_));
-  // @@protoc_insertion_point(copy_constructor:proxy_proto.helpRecalPlan)
+  ::memcpy(&_impl_.task_id_, &from._impl_.task_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port_) -
+    reinterpret_cast<char*>(&_impl_.task_id_)) + sizeof(_impl_.port_));
+  // @@protoc_insertion_point(copy_constructor:proxy_proto.RecalPort)
 }
 
-inline void helpRecalPlan::SharedCtor(
+inline void RecalPort::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.datanodeip_){arena}
-    , decltype(_impl_.datanodeport_){arena}
-    , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
-    , decltype(_impl_.blockkeys_){arena}
-    , decltype(_impl_.blockids_){arena}
-    , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
-    , decltype(_impl_.mainproxyip_){}
-    , decltype(_impl_.type_){false}
-    , decltype(_impl_.if_partial_decoding_){false}
-    , decltype(_impl_.mainproxyport_){0}
-    , decltype(_impl_.block_size_){0}
-    , decltype(_impl_.parity_num_){0}
-    , decltype(_impl_.k_){0}
-    , decltype(_impl_.encodetype_){0}
+      decltype(_impl_.task_id_){0}
+    , decltype(_impl_.port_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.mainproxyip_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-helpRecalPlan::~helpRecalPlan() {
-  // @@protoc_insertion_point(destructor:proxy_proto.helpRecalPlan)
+RecalPort::~RecalPort() {
+  // @@protoc_insertion_point(destructor:proxy_proto.RecalPort)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1793,156 +2085,993 @@ helpRecalPlan::~helpRecalPlan() {
   SharedDtor();
 }
 
-inline void helpRecalPlan::SharedDtor() {
+inline void RecalPort::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.datanodeip_.~RepeatedPtrField();
-  _impl_.datanodeport_.~RepeatedField();
-  _impl_.blockkeys_.~RepeatedPtrField();
-  _impl_.blockids_.~RepeatedField();
-  _impl_.mainproxyip_.Destroy();
 }
 
-void helpRecalPlan::SetCachedSize(int size) const {
+void RecalPort::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void helpRecalPlan::Clear() {
-// @@protoc_insertion_point(message_clear_start:proxy_proto.helpRecalPlan)
+void RecalPort::Clear() {
+// @@protoc_insertion_point(message_clear_start:proxy_proto.RecalPort)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.datanodeip_.Clear();
-  _impl_.datanodeport_.Clear();
-  _impl_.blockkeys_.Clear();
-  _impl_.blockids_.Clear();
-  _impl_.mainproxyip_.ClearToEmpty();
-  ::memset(&_impl_.type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.encodetype_) -
-      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.encodetype_));
+  ::memset(&_impl_.task_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.port_) -
+      reinterpret_cast<char*>(&_impl_.task_id_)) + sizeof(_impl_.port_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* helpRecalPlan::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* RecalPort::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bool type = 1;
+      // int32 task_id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.task_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // bool if_partial_decoding = 2;
+      // int32 port = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.if_partial_decoding_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // string mainproxyip = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_mainproxyip();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpRecalPlan.mainproxyip"));
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 mainproxyport = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.mainproxyport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated string datanodeip = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_datanodeip();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpRecalPlan.datanodeip"));
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated int32 datanodeport = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_datanodeport(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<uint8_t>(tag) == 48) {
-          _internal_add_datanodeport(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // repeated string blockkeys = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_blockkeys();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpRecalPlan.blockkeys"));
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecalPort::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proxy_proto.RecalPort)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 task_id = 1;
+  if (this->_internal_task_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_task_id(), target);
+  }
+
+  // int32 port = 2;
+  if (this->_internal_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_port(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proxy_proto.RecalPort)
+  return target;
+}
+
+size_t RecalPort::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proxy_proto.RecalPort)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 task_id = 1;
+  if (this->_internal_task_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_task_id());
+  }
+
+  // int32 port = 2;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecalPort::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecalPort::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecalPort::GetClassData() const { return &_class_data_; }
+
+
+void RecalPort::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecalPort*>(&to_msg);
+  auto& from = static_cast<const RecalPort&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proxy_proto.RecalPort)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_task_id() != 0) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecalPort::CopyFrom(const RecalPort& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.RecalPort)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecalPort::IsInitialized() const {
+  return true;
+}
+
+void RecalPort::InternalSwap(RecalPort* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecalPort, _impl_.port_)
+      + sizeof(RecalPort::_impl_.port_)
+      - PROTOBUF_FIELD_OFFSET(RecalPort, _impl_.task_id_)>(
+          reinterpret_cast<char*>(&_impl_.task_id_),
+          reinterpret_cast<char*>(&other->_impl_.task_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecalPort::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
+      file_level_metadata_proxy_2eproto[3]);
+}
+
+// ===================================================================
+
+class helpRecalPlan::_Internal {
+ public:
+};
+
+helpRecalPlan::helpRecalPlan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proxy_proto.helpRecalPlan)
+}
+helpRecalPlan::helpRecalPlan(const helpRecalPlan& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  helpRecalPlan* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.datanodeip_){from._impl_.datanodeip_}
+    , decltype(_impl_.datanodeport_){from._impl_.datanodeport_}
+    , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
+    , decltype(_impl_.blockkeys_){from._impl_.blockkeys_}
+    , decltype(_impl_.blockids_){from._impl_.blockids_}
+    , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+    , decltype(_impl_.groupids_){from._impl_.groupids_}
+    , /*decltype(_impl_._groupids_cached_byte_size_)*/{0}
+    , decltype(_impl_.targets_){from._impl_.targets_}
+    , decltype(_impl_.mainproxyip_){}
+    , decltype(_impl_.mainproxyport_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.if_partial_decoding_){}
+    , decltype(_impl_.if_fused_){}
+    , decltype(_impl_.block_size_){}
+    , decltype(_impl_.parity_num_){}
+    , decltype(_impl_.k_){}
+    , decltype(_impl_.encodetype_){}
+    , decltype(_impl_.l_){}
+    , decltype(_impl_.g_m_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.mainproxyip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mainproxyip().empty()) {
+    _this->_impl_.mainproxyip_.Set(from._internal_mainproxyip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.mainproxyport_, &from._impl_.mainproxyport_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.g_m_) -
+    reinterpret_cast<char*>(&_impl_.mainproxyport_)) + sizeof(_impl_.g_m_));
+  // @@protoc_insertion_point(copy_constructor:proxy_proto.helpRecalPlan)
+}
+
+inline void helpRecalPlan::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.datanodeip_){arena}
+    , decltype(_impl_.datanodeport_){arena}
+    , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
+    , decltype(_impl_.blockkeys_){arena}
+    , decltype(_impl_.blockids_){arena}
+    , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+    , decltype(_impl_.groupids_){arena}
+    , /*decltype(_impl_._groupids_cached_byte_size_)*/{0}
+    , decltype(_impl_.targets_){arena}
+    , decltype(_impl_.mainproxyip_){}
+    , decltype(_impl_.mainproxyport_){0}
+    , decltype(_impl_.type_){false}
+    , decltype(_impl_.if_partial_decoding_){false}
+    , decltype(_impl_.if_fused_){false}
+    , decltype(_impl_.block_size_){0}
+    , decltype(_impl_.parity_num_){0}
+    , decltype(_impl_.k_){0}
+    , decltype(_impl_.encodetype_){0}
+    , decltype(_impl_.l_){0}
+    , decltype(_impl_.g_m_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.mainproxyip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+helpRecalPlan::~helpRecalPlan() {
+  // @@protoc_insertion_point(destructor:proxy_proto.helpRecalPlan)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void helpRecalPlan::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.datanodeip_.~RepeatedPtrField();
+  _impl_.datanodeport_.~RepeatedField();
+  _impl_.blockkeys_.~RepeatedPtrField();
+  _impl_.blockids_.~RepeatedField();
+  _impl_.groupids_.~RepeatedField();
+  _impl_.targets_.~RepeatedPtrField();
+  _impl_.mainproxyip_.Destroy();
+}
+
+void helpRecalPlan::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void helpRecalPlan::Clear() {
+// @@protoc_insertion_point(message_clear_start:proxy_proto.helpRecalPlan)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.datanodeip_.Clear();
+  _impl_.datanodeport_.Clear();
+  _impl_.blockkeys_.Clear();
+  _impl_.blockids_.Clear();
+  _impl_.groupids_.Clear();
+  _impl_.targets_.Clear();
+  _impl_.mainproxyip_.ClearToEmpty();
+  ::memset(&_impl_.mainproxyport_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.g_m_) -
+      reinterpret_cast<char*>(&_impl_.mainproxyport_)) + sizeof(_impl_.g_m_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* helpRecalPlan::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 block_size = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
-          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+      // bool if_partial_decoding = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.if_partial_decoding_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string mainproxyip = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_mainproxyip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpRecalPlan.mainproxyip"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 mainproxyport = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.mainproxyport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string datanodeip = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_datanodeip();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpRecalPlan.datanodeip"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 datanodeport = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_datanodeport(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_datanodeport(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string blockkeys = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_blockkeys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpRecalPlan.blockkeys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 block_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 blockids = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_blockids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_blockids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 parity_num = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.parity_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 k = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.k_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 encodetype = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.encodetype_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool if_fused = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.if_fused_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 groupids = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_groupids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 112) {
+          _internal_add_groupids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 l = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.l_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 g_m = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.g_m_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proxy_proto.fusedTarget targets = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_targets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<138>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* helpRecalPlan::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proxy_proto.helpRecalPlan)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_type(), target);
+  }
+
+  // bool if_partial_decoding = 2;
+  if (this->_internal_if_partial_decoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_if_partial_decoding(), target);
+  }
+
+  // string mainproxyip = 3;
+  if (!this->_internal_mainproxyip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_mainproxyip().data(), static_cast<int>(this->_internal_mainproxyip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proxy_proto.helpRecalPlan.mainproxyip");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_mainproxyip(), target);
+  }
+
+  // int32 mainproxyport = 4;
+  if (this->_internal_mainproxyport() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_mainproxyport(), target);
+  }
+
+  // repeated string datanodeip = 5;
+  for (int i = 0, n = this->_internal_datanodeip_size(); i < n; i++) {
+    const auto& s = this->_internal_datanodeip(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proxy_proto.helpRecalPlan.datanodeip");
+    target = stream->WriteString(5, s, target);
+  }
+
+  // repeated int32 datanodeport = 6;
+  {
+    int byte_size = _impl_._datanodeport_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          6, _internal_datanodeport(), byte_size, target);
+    }
+  }
+
+  // repeated string blockkeys = 7;
+  for (int i = 0, n = this->_internal_blockkeys_size(); i < n; i++) {
+    const auto& s = this->_internal_blockkeys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proxy_proto.helpRecalPlan.blockkeys");
+    target = stream->WriteString(7, s, target);
+  }
+
+  // int32 block_size = 8;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_block_size(), target);
+  }
+
+  // repeated int32 blockids = 9;
+  {
+    int byte_size = _impl_._blockids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          9, _internal_blockids(), byte_size, target);
+    }
+  }
+
+  // int32 parity_num = 10;
+  if (this->_internal_parity_num() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_parity_num(), target);
+  }
+
+  // int32 k = 11;
+  if (this->_internal_k() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_k(), target);
+  }
+
+  // int32 encodetype = 12;
+  if (this->_internal_encodetype() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_encodetype(), target);
+  }
+
+  // bool if_fused = 13;
+  if (this->_internal_if_fused() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_if_fused(), target);
+  }
+
+  // repeated int32 groupids = 14;
+  {
+    int byte_size = _impl_._groupids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          14, _internal_groupids(), byte_size, target);
+    }
+  }
+
+  // int32 l = 15;
+  if (this->_internal_l() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_l(), target);
+  }
+
+  // int32 g_m = 16;
+  if (this->_internal_g_m() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(16, this->_internal_g_m(), target);
+  }
+
+  // repeated .proxy_proto.fusedTarget targets = 17;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_targets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_targets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(17, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proxy_proto.helpRecalPlan)
+  return target;
+}
+
+size_t helpRecalPlan::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proxy_proto.helpRecalPlan)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string datanodeip = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.datanodeip_.size());
+  for (int i = 0, n = _impl_.datanodeip_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.datanodeip_.Get(i));
+  }
+
+  // repeated int32 datanodeport = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.datanodeport_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._datanodeport_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated string blockkeys = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.blockkeys_.size());
+  for (int i = 0, n = _impl_.blockkeys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.blockkeys_.Get(i));
+  }
+
+  // repeated int32 blockids = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.blockids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._blockids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 groupids = 14;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.groupids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._groupids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .proxy_proto.fusedTarget targets = 17;
+  total_size += 2UL * this->_internal_targets_size();
+  for (const auto& msg : this->_impl_.targets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string mainproxyip = 3;
+  if (!this->_internal_mainproxyip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_mainproxyip());
+  }
+
+  // int32 mainproxyport = 4;
+  if (this->_internal_mainproxyport() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_mainproxyport());
+  }
+
+  // bool type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool if_partial_decoding = 2;
+  if (this->_internal_if_partial_decoding() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool if_fused = 13;
+  if (this->_internal_if_fused() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 block_size = 8;
+  if (this->_internal_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_block_size());
+  }
+
+  // int32 parity_num = 10;
+  if (this->_internal_parity_num() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_parity_num());
+  }
+
+  // int32 k = 11;
+  if (this->_internal_k() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_k());
+  }
+
+  // int32 encodetype = 12;
+  if (this->_internal_encodetype() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_encodetype());
+  }
+
+  // int32 l = 15;
+  if (this->_internal_l() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_l());
+  }
+
+  // int32 g_m = 16;
+  if (this->_internal_g_m() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_g_m());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData helpRecalPlan::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    helpRecalPlan::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*helpRecalPlan::GetClassData() const { return &_class_data_; }
+
+
+void helpRecalPlan::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<helpRecalPlan*>(&to_msg);
+  auto& from = static_cast<const helpRecalPlan&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proxy_proto.helpRecalPlan)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.datanodeip_.MergeFrom(from._impl_.datanodeip_);
+  _this->_impl_.datanodeport_.MergeFrom(from._impl_.datanodeport_);
+  _this->_impl_.blockkeys_.MergeFrom(from._impl_.blockkeys_);
+  _this->_impl_.blockids_.MergeFrom(from._impl_.blockids_);
+  _this->_impl_.groupids_.MergeFrom(from._impl_.groupids_);
+  _this->_impl_.targets_.MergeFrom(from._impl_.targets_);
+  if (!from._internal_mainproxyip().empty()) {
+    _this->_internal_set_mainproxyip(from._internal_mainproxyip());
+  }
+  if (from._internal_mainproxyport() != 0) {
+    _this->_internal_set_mainproxyport(from._internal_mainproxyport());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_if_partial_decoding() != 0) {
+    _this->_internal_set_if_partial_decoding(from._internal_if_partial_decoding());
+  }
+  if (from._internal_if_fused() != 0) {
+    _this->_internal_set_if_fused(from._internal_if_fused());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  if (from._internal_parity_num() != 0) {
+    _this->_internal_set_parity_num(from._internal_parity_num());
+  }
+  if (from._internal_k() != 0) {
+    _this->_internal_set_k(from._internal_k());
+  }
+  if (from._internal_encodetype() != 0) {
+    _this->_internal_set_encodetype(from._internal_encodetype());
+  }
+  if (from._internal_l() != 0) {
+    _this->_internal_set_l(from._internal_l());
+  }
+  if (from._internal_g_m() != 0) {
+    _this->_internal_set_g_m(from._internal_g_m());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void helpRecalPlan::CopyFrom(const helpRecalPlan& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.helpRecalPlan)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool helpRecalPlan::IsInitialized() const {
+  return true;
+}
+
+void helpRecalPlan::InternalSwap(helpRecalPlan* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.datanodeip_.InternalSwap(&other->_impl_.datanodeip_);
+  _impl_.datanodeport_.InternalSwap(&other->_impl_.datanodeport_);
+  _impl_.blockkeys_.InternalSwap(&other->_impl_.blockkeys_);
+  _impl_.blockids_.InternalSwap(&other->_impl_.blockids_);
+  _impl_.groupids_.InternalSwap(&other->_impl_.groupids_);
+  _impl_.targets_.InternalSwap(&other->_impl_.targets_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mainproxyip_, lhs_arena,
+      &other->_impl_.mainproxyip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(helpRecalPlan, _impl_.g_m_)
+      + sizeof(helpRecalPlan::_impl_.g_m_)
+      - PROTOBUF_FIELD_OFFSET(helpRecalPlan, _impl_.mainproxyport_)>(
+          reinterpret_cast<char*>(&_impl_.mainproxyport_),
+          reinterpret_cast<char*>(&other->_impl_.mainproxyport_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata helpRecalPlan::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
+      file_level_metadata_proxy_2eproto[4]);
+}
+
+// ===================================================================
+
+class fusedTarget::_Internal {
+ public:
+};
+
+fusedTarget::fusedTarget(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proxy_proto.fusedTarget)
+}
+fusedTarget::fusedTarget(const fusedTarget& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  fusedTarget* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parityids_){from._impl_.parityids_}
+    , /*decltype(_impl_._parityids_cached_byte_size_)*/{0}
+    , decltype(_impl_.mainproxyip_){}
+    , decltype(_impl_.mainproxyport_){}
+    , decltype(_impl_.cluster_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.mainproxyip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mainproxyip().empty()) {
+    _this->_impl_.mainproxyip_.Set(from._internal_mainproxyip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.mainproxyport_, &from._impl_.mainproxyport_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cluster_id_) -
+    reinterpret_cast<char*>(&_impl_.mainproxyport_)) + sizeof(_impl_.cluster_id_));
+  // @@protoc_insertion_point(copy_constructor:proxy_proto.fusedTarget)
+}
+
+inline void fusedTarget::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parityids_){arena}
+    , /*decltype(_impl_._parityids_cached_byte_size_)*/{0}
+    , decltype(_impl_.mainproxyip_){}
+    , decltype(_impl_.mainproxyport_){0}
+    , decltype(_impl_.cluster_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.mainproxyip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+fusedTarget::~fusedTarget() {
+  // @@protoc_insertion_point(destructor:proxy_proto.fusedTarget)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void fusedTarget::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.parityids_.~RepeatedField();
+  _impl_.mainproxyip_.Destroy();
+}
+
+void fusedTarget::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void fusedTarget::Clear() {
+// @@protoc_insertion_point(message_clear_start:proxy_proto.fusedTarget)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.parityids_.Clear();
+  _impl_.mainproxyip_.ClearToEmpty();
+  ::memset(&_impl_.mainproxyport_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cluster_id_) -
+      reinterpret_cast<char*>(&_impl_.mainproxyport_)) + sizeof(_impl_.cluster_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* fusedTarget::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string mainproxyip = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_mainproxyip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.fusedTarget.mainproxyip"));
         } else
           goto handle_unusual;
         continue;
-      // repeated int32 blockids = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_blockids(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<uint8_t>(tag) == 72) {
-          _internal_add_blockids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+      // int32 mainproxyport = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.mainproxyport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 parity_num = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
-          _impl_.parity_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+      // repeated int32 parityids = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_parityids(), ptr, ctx);
           CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 k = 11;
-      case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
-          _impl_.k_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_parityids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 encodetype = 12;
-      case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
-          _impl_.encodetype_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+      // int32 cluster_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.cluster_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1970,289 +3099,154 @@ failure:
 #undef CHK_
 }
 
-uint8_t* helpRecalPlan::_InternalSerialize(
+uint8_t* fusedTarget::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proxy_proto.helpRecalPlan)
+  // @@protoc_insertion_point(serialize_to_array_start:proxy_proto.fusedTarget)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bool type = 1;
-  if (this->_internal_type() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_type(), target);
-  }
-
-  // bool if_partial_decoding = 2;
-  if (this->_internal_if_partial_decoding() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_if_partial_decoding(), target);
-  }
-
-  // string mainproxyip = 3;
+  // string mainproxyip = 1;
   if (!this->_internal_mainproxyip().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_mainproxyip().data(), static_cast<int>(this->_internal_mainproxyip().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "proxy_proto.helpRecalPlan.mainproxyip");
+      "proxy_proto.fusedTarget.mainproxyip");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_mainproxyip(), target);
+        1, this->_internal_mainproxyip(), target);
   }
 
-  // int32 mainproxyport = 4;
+  // int32 mainproxyport = 2;
   if (this->_internal_mainproxyport() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_mainproxyport(), target);
-  }
-
-  // repeated string datanodeip = 5;
-  for (int i = 0, n = this->_internal_datanodeip_size(); i < n; i++) {
-    const auto& s = this->_internal_datanodeip(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "proxy_proto.helpRecalPlan.datanodeip");
-    target = stream->WriteString(5, s, target);
-  }
-
-  // repeated int32 datanodeport = 6;
-  {
-    int byte_size = _impl_._datanodeport_cached_byte_size_.load(std::memory_order_relaxed);
-    if (byte_size > 0) {
-      target = stream->WriteInt32Packed(
-          6, _internal_datanodeport(), byte_size, target);
-    }
-  }
-
-  // repeated string blockkeys = 7;
-  for (int i = 0, n = this->_internal_blockkeys_size(); i < n; i++) {
-    const auto& s = this->_internal_blockkeys(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "proxy_proto.helpRecalPlan.blockkeys");
-    target = stream->WriteString(7, s, target);
-  }
-
-  // int32 block_size = 8;
-  if (this->_internal_block_size() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_block_size(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_mainproxyport(), target);
   }
 
-  // repeated int32 blockids = 9;
+  // repeated int32 parityids = 3;
   {
-    int byte_size = _impl_._blockids_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._parityids_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteInt32Packed(
-          9, _internal_blockids(), byte_size, target);
+          3, _internal_parityids(), byte_size, target);
     }
   }
 
-  // int32 parity_num = 10;
-  if (this->_internal_parity_num() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_parity_num(), target);
-  }
-
-  // int32 k = 11;
-  if (this->_internal_k() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_k(), target);
-  }
-
-  // int32 encodetype = 12;
-  if (this->_internal_encodetype() != 0) {
+  // int32 cluster_id = 4;
+  if (this->_internal_cluster_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_encodetype(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_cluster_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proxy_proto.helpRecalPlan)
-  return target;
-}
-
-size_t helpRecalPlan::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proxy_proto.helpRecalPlan)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated string datanodeip = 5;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.datanodeip_.size());
-  for (int i = 0, n = _impl_.datanodeip_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.datanodeip_.Get(i));
-  }
-
-  // repeated int32 datanodeport = 6;
-  {
-    size_t data_size = ::_pbi::WireFormatLite::
-      Int32Size(this->_impl_.datanodeport_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
-    }
-    int cached_size = ::_pbi::ToCachedSize(data_size);
-    _impl_._datanodeport_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
-  }
-
-  // repeated string blockkeys = 7;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.blockkeys_.size());
-  for (int i = 0, n = _impl_.blockkeys_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.blockkeys_.Get(i));
-  }
+  // @@protoc_insertion_point(serialize_to_array_end:proxy_proto.fusedTarget)
+  return target;
+}
 
-  // repeated int32 blockids = 9;
+size_t fusedTarget::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proxy_proto.fusedTarget)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 parityids = 3;
   {
     size_t data_size = ::_pbi::WireFormatLite::
-      Int32Size(this->_impl_.blockids_);
+      Int32Size(this->_impl_.parityids_);
     if (data_size > 0) {
       total_size += 1 +
         ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
     int cached_size = ::_pbi::ToCachedSize(data_size);
-    _impl_._blockids_cached_byte_size_.store(cached_size,
+    _impl_._parityids_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
-  // string mainproxyip = 3;
+  // string mainproxyip = 1;
   if (!this->_internal_mainproxyip().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_mainproxyip());
   }
 
-  // bool type = 1;
-  if (this->_internal_type() != 0) {
-    total_size += 1 + 1;
-  }
-
-  // bool if_partial_decoding = 2;
-  if (this->_internal_if_partial_decoding() != 0) {
-    total_size += 1 + 1;
-  }
-
-  // int32 mainproxyport = 4;
+  // int32 mainproxyport = 2;
   if (this->_internal_mainproxyport() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_mainproxyport());
   }
 
-  // int32 block_size = 8;
-  if (this->_internal_block_size() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_block_size());
-  }
-
-  // int32 parity_num = 10;
-  if (this->_internal_parity_num() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_parity_num());
-  }
-
-  // int32 k = 11;
-  if (this->_internal_k() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_k());
-  }
-
-  // int32 encodetype = 12;
-  if (this->_internal_encodetype() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_encodetype());
+  // int32 cluster_id = 4;
+  if (this->_internal_cluster_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cluster_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData helpRecalPlan::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData fusedTarget::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    helpRecalPlan::MergeImpl
+    fusedTarget::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*helpRecalPlan::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*fusedTarget::GetClassData() const { return &_class_data_; }
 
 
-void helpRecalPlan::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<helpRecalPlan*>(&to_msg);
-  auto& from = static_cast<const helpRecalPlan&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:proxy_proto.helpRecalPlan)
+void fusedTarget::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<fusedTarget*>(&to_msg);
+  auto& from = static_cast<const fusedTarget&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proxy_proto.fusedTarget)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.datanodeip_.MergeFrom(from._impl_.datanodeip_);
-  _this->_impl_.datanodeport_.MergeFrom(from._impl_.datanodeport_);
-  _this->_impl_.blockkeys_.MergeFrom(from._impl_.blockkeys_);
-  _this->_impl_.blockids_.MergeFrom(from._impl_.blockids_);
+  _this->_impl_.parityids_.MergeFrom(from._impl_.parityids_);
   if (!from._internal_mainproxyip().empty()) {
     _this->_internal_set_mainproxyip(from._internal_mainproxyip());
   }
-  if (from._internal_type() != 0) {
-    _this->_internal_set_type(from._internal_type());
-  }
-  if (from._internal_if_partial_decoding() != 0) {
-    _this->_internal_set_if_partial_decoding(from._internal_if_partial_decoding());
-  }
   if (from._internal_mainproxyport() != 0) {
     _this->_internal_set_mainproxyport(from._internal_mainproxyport());
   }
-  if (from._internal_block_size() != 0) {
-    _this->_internal_set_block_size(from._internal_block_size());
-  }
-  if (from._internal_parity_num() != 0) {
-    _this->_internal_set_parity_num(from._internal_parity_num());
-  }
-  if (from._internal_k() != 0) {
-    _this->_internal_set_k(from._internal_k());
-  }
-  if (from._internal_encodetype() != 0) {
-    _this->_internal_set_encodetype(from._internal_encodetype());
+  if (from._internal_cluster_id() != 0) {
+    _this->_internal_set_cluster_id(from._internal_cluster_id());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void helpRecalPlan::CopyFrom(const helpRecalPlan& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.helpRecalPlan)
+void fusedTarget::CopyFrom(const fusedTarget& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.fusedTarget)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool helpRecalPlan::IsInitialized() const {
+bool fusedTarget::IsInitialized() const {
   return true;
 }
 
-void helpRecalPlan::InternalSwap(helpRecalPlan* other) {
+void fusedTarget::InternalSwap(fusedTarget* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.datanodeip_.InternalSwap(&other->_impl_.datanodeip_);
-  _impl_.datanodeport_.InternalSwap(&other->_impl_.datanodeport_);
-  _impl_.blockkeys_.InternalSwap(&other->_impl_.blockkeys_);
-  _impl_.blockids_.InternalSwap(&other->_impl_.blockids_);
+  _impl_.parityids_.InternalSwap(&other->_impl_.parityids_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.mainproxyip_, lhs_arena,
       &other->_impl_.mainproxyip_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(helpRecalPlan, _impl_.encodetype_)
-      + sizeof(helpRecalPlan::_impl_.encodetype_)
-      - PROTOBUF_FIELD_OFFSET(helpRecalPlan, _impl_.type_)>(
-          reinterpret_cast<char*>(&_impl_.type_),
-          reinterpret_cast<char*>(&other->_impl_.type_));
+      PROTOBUF_FIELD_OFFSET(fusedTarget, _impl_.cluster_id_)
+      + sizeof(fusedTarget::_impl_.cluster_id_)
+      - PROTOBUF_FIELD_OFFSET(fusedTarget, _impl_.mainproxyport_)>(
+          reinterpret_cast<char*>(&_impl_.mainproxyport_),
+          reinterpret_cast<char*>(&other->_impl_.mainproxyport_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata helpRecalPlan::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata fusedTarget::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[3]);
+      file_level_metadata_proxy_2eproto[5]);
 }
 
 // ===================================================================
@@ -2279,10 +3273,16 @@ blockRelocPlan::blockRelocPlan(const blockRelocPlan& from)
     , decltype(_impl_.todatanodeport_){from._impl_.todatanodeport_}
     , /*decltype(_impl_._todatanodeport_cached_byte_size_)*/{0}
     , decltype(_impl_.block_size_){}
+    , decltype(_impl_.task_id_){}
+    , decltype(_impl_.max_parallel_){}
+    , decltype(_impl_.max_per_des_node_){}
+    , decltype(_impl_.bandwidth_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.block_size_ = from._impl_.block_size_;
+  ::memcpy(&_impl_.block_size_, &from._impl_.block_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bandwidth_) -
+    reinterpret_cast<char*>(&_impl_.block_size_)) + sizeof(_impl_.bandwidth_));
   // @@protoc_insertion_point(copy_constructor:proxy_proto.blockRelocPlan)
 }
 
@@ -2299,6 +3299,10 @@ inline void blockRelocPlan::SharedCtor(
     , decltype(_impl_.todatanodeport_){arena}
     , /*decltype(_impl_._todatanodeport_cached_byte_size_)*/{0}
     , decltype(_impl_.block_size_){0}
+    , decltype(_impl_.task_id_){0}
+    , decltype(_impl_.max_parallel_){0}
+    , decltype(_impl_.max_per_des_node_){0}
+    , decltype(_impl_.bandwidth_){int64_t{0}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -2336,7 +3340,9 @@ void blockRelocPlan::Clear() {
   _impl_.fromdatanodeport_.Clear();
   _impl_.todatanodeip_.Clear();
   _impl_.todatanodeport_.Clear();
-  _impl_.block_size_ = 0;
+  ::memset(&_impl_.block_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.bandwidth_) -
+      reinterpret_cast<char*>(&_impl_.block_size_)) + sizeof(_impl_.bandwidth_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2421,6 +3427,38 @@ const char* blockRelocPlan::_InternalParse(const char* ptr, ::_pbi::ParseContext
         } else
           goto handle_unusual;
         continue;
+      // int32 task_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.task_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_parallel = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.max_parallel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_per_des_node = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.max_per_des_node_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 bandwidth = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.bandwidth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2504,6 +3542,30 @@ uint8_t* blockRelocPlan::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_block_size(), target);
   }
 
+  // int32 task_id = 7;
+  if (this->_internal_task_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_task_id(), target);
+  }
+
+  // int32 max_parallel = 8;
+  if (this->_internal_max_parallel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_max_parallel(), target);
+  }
+
+  // int32 max_per_des_node = 9;
+  if (this->_internal_max_per_des_node() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_max_per_des_node(), target);
+  }
+
+  // int64 bandwidth = 10;
+  if (this->_internal_bandwidth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_bandwidth(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2577,6 +3639,26 @@ size_t blockRelocPlan::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_block_size());
   }
 
+  // int32 task_id = 7;
+  if (this->_internal_task_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_task_id());
+  }
+
+  // int32 max_parallel = 8;
+  if (this->_internal_max_parallel() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_parallel());
+  }
+
+  // int32 max_per_des_node = 9;
+  if (this->_internal_max_per_des_node() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_per_des_node());
+  }
+
+  // int64 bandwidth = 10;
+  if (this->_internal_bandwidth() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_bandwidth());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -2603,6 +3685,18 @@ void blockRelocPlan::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   if (from._internal_block_size() != 0) {
     _this->_internal_set_block_size(from._internal_block_size());
   }
+  if (from._internal_task_id() != 0) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
+  if (from._internal_max_parallel() != 0) {
+    _this->_internal_set_max_parallel(from._internal_max_parallel());
+  }
+  if (from._internal_max_per_des_node() != 0) {
+    _this->_internal_set_max_per_des_node(from._internal_max_per_des_node());
+  }
+  if (from._internal_bandwidth() != 0) {
+    _this->_internal_set_bandwidth(from._internal_bandwidth());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -2625,13 +3719,18 @@ void blockRelocPlan::InternalSwap(blockRelocPlan* other) {
   _impl_.fromdatanodeport_.InternalSwap(&other->_impl_.fromdatanodeport_);
   _impl_.todatanodeip_.InternalSwap(&other->_impl_.todatanodeip_);
   _impl_.todatanodeport_.InternalSwap(&other->_impl_.todatanodeport_);
-  swap(_impl_.block_size_, other->_impl_.block_size_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(blockRelocPlan, _impl_.bandwidth_)
+      + sizeof(blockRelocPlan::_impl_.bandwidth_)
+      - PROTOBUF_FIELD_OFFSET(blockRelocPlan, _impl_.block_size_)>(
+          reinterpret_cast<char*>(&_impl_.block_size_),
+          reinterpret_cast<char*>(&other->_impl_.block_size_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata blockRelocPlan::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[4]);
+      file_level_metadata_proxy_2eproto[6]);
 }
 
 // ===================================================================
@@ -2834,7 +3933,7 @@ void blockRelocReply::InternalSwap(blockRelocReply* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata blockRelocReply::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[5]);
+      file_level_metadata_proxy_2eproto[7]);
 }
 
 // ===================================================================
@@ -2854,10 +3953,13 @@ AskIfSuccess::AskIfSuccess(const AskIfSuccess& from)
   AskIfSuccess* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.step_){}
+    , decltype(_impl_.task_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.step_ = from._impl_.step_;
+  ::memcpy(&_impl_.step_, &from._impl_.step_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.task_id_) -
+    reinterpret_cast<char*>(&_impl_.step_)) + sizeof(_impl_.task_id_));
   // @@protoc_insertion_point(copy_constructor:proxy_proto.AskIfSuccess)
 }
 
@@ -2867,6 +3969,7 @@ inline void AskIfSuccess::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.step_){0}
+    , decltype(_impl_.task_id_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -2894,7 +3997,9 @@ void AskIfSuccess::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.step_ = 0;
+  ::memset(&_impl_.step_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.task_id_) -
+      reinterpret_cast<char*>(&_impl_.step_)) + sizeof(_impl_.task_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2912,6 +4017,14 @@ const char* AskIfSuccess::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // int32 task_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.task_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2947,6 +4060,12 @@ uint8_t* AskIfSuccess::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_step(), target);
   }
 
+  // int32 task_id = 2;
+  if (this->_internal_task_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_task_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2968,6 +4087,11 @@ size_t AskIfSuccess::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_step());
   }
 
+  // int32 task_id = 2;
+  if (this->_internal_task_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_task_id());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -2989,6 +4113,9 @@ void AskIfSuccess::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   if (from._internal_step() != 0) {
     _this->_internal_set_step(from._internal_step());
   }
+  if (from._internal_task_id() != 0) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -3006,13 +4133,18 @@ bool AskIfSuccess::IsInitialized() const {
 void AskIfSuccess::InternalSwap(AskIfSuccess* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.step_, other->_impl_.step_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AskIfSuccess, _impl_.task_id_)
+      + sizeof(AskIfSuccess::_impl_.task_id_)
+      - PROTOBUF_FIELD_OFFSET(AskIfSuccess, _impl_.step_)>(
+          reinterpret_cast<char*>(&_impl_.step_),
+          reinterpret_cast<char*>(&other->_impl_.step_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata AskIfSuccess::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[6]);
+      file_level_metadata_proxy_2eproto[8]);
 }
 
 // ===================================================================
@@ -3190,7 +4322,7 @@ void RepIfSuccess::InternalSwap(RepIfSuccess* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata RepIfSuccess::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[7]);
+      file_level_metadata_proxy_2eproto[9]);
 }
 
 // ===================================================================
@@ -3215,6 +4347,7 @@ NodeAndBlock::NodeAndBlock(const NodeAndBlock& from)
     , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
     , decltype(_impl_.key_){}
     , decltype(_impl_.stripe_id_){}
+    , decltype(_impl_.task_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -3226,7 +4359,9 @@ NodeAndBlock::NodeAndBlock(const NodeAndBlock& from)
     _this->_impl_.key_.Set(from._internal_key(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.stripe_id_ = from._impl_.stripe_id_;
+  ::memcpy(&_impl_.stripe_id_, &from._impl_.stripe_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.task_id_) -
+    reinterpret_cast<char*>(&_impl_.stripe_id_)) + sizeof(_impl_.task_id_));
   // @@protoc_insertion_point(copy_constructor:proxy_proto.NodeAndBlock)
 }
 
@@ -3241,6 +4376,7 @@ inline void NodeAndBlock::SharedCtor(
     , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
     , decltype(_impl_.key_){}
     , decltype(_impl_.stripe_id_){0}
+    , decltype(_impl_.task_id_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.key_.InitDefault();
@@ -3280,7 +4416,9 @@ void NodeAndBlock::Clear() {
   _impl_.datanodeip_.Clear();
   _impl_.datanodeport_.Clear();
   _impl_.key_.ClearToEmpty();
-  _impl_.stripe_id_ = 0;
+  ::memset(&_impl_.stripe_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.task_id_) -
+      reinterpret_cast<char*>(&_impl_.stripe_id_)) + sizeof(_impl_.task_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3349,6 +4487,14 @@ const char* NodeAndBlock::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // int32 task_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.task_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3423,6 +4569,12 @@ uint8_t* NodeAndBlock::_InternalSerialize(
         5, this->_internal_key(), target);
   }
 
+  // int32 task_id = 6;
+  if (this->_internal_task_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_task_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3481,6 +4633,11 @@ size_t NodeAndBlock::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stripe_id());
   }
 
+  // int32 task_id = 6;
+  if (this->_internal_task_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_task_id());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -3508,6 +4665,9 @@ void NodeAndBlock::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   if (from._internal_stripe_id() != 0) {
     _this->_internal_set_stripe_id(from._internal_stripe_id());
   }
+  if (from._internal_task_id() != 0) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -3534,13 +4694,18 @@ void NodeAndBlock::InternalSwap(NodeAndBlock* other) {
       &_impl_.key_, lhs_arena,
       &other->_impl_.key_, rhs_arena
   );
-  swap(_impl_.stripe_id_, other->_impl_.stripe_id_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeAndBlock, _impl_.task_id_)
+      + sizeof(NodeAndBlock::_impl_.task_id_)
+      - PROTOBUF_FIELD_OFFSET(NodeAndBlock, _impl_.stripe_id_)>(
+          reinterpret_cast<char*>(&_impl_.stripe_id_),
+          reinterpret_cast<char*>(&other->_impl_.stripe_id_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata NodeAndBlock::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[8]);
+      file_level_metadata_proxy_2eproto[10]);
 }
 
 // ===================================================================
@@ -3718,7 +4883,7 @@ void DelReply::InternalSwap(DelReply* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata DelReply::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[9]);
+      file_level_metadata_proxy_2eproto[11]);
 }
 
 // ===================================================================
@@ -3921,7 +5086,7 @@ void CheckaliveCMD::InternalSwap(CheckaliveCMD* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata CheckaliveCMD::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[10]);
+      file_level_metadata_proxy_2eproto[12]);
 }
 
 // ===================================================================
@@ -4099,7 +5264,7 @@ void RequestResult::InternalSwap(RequestResult* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata RequestResult::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[11]);
+      file_level_metadata_proxy_2eproto[13]);
 }
 
 // ===================================================================
@@ -4124,6 +5289,10 @@ ObjectAndPlacement::ObjectAndPlacement(const ObjectAndPlacement& from)
     , decltype(_impl_.blockkeys_){from._impl_.blockkeys_}
     , decltype(_impl_.blockids_){from._impl_.blockids_}
     , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+    , decltype(_impl_.islocal_){from._impl_.islocal_}
+    , decltype(_impl_.clusterids_){from._impl_.clusterids_}
+    , /*decltype(_impl_._clusterids_cached_byte_size_)*/{0}
+    , decltype(_impl_.packed_keys_){from._impl_.packed_keys_}
     , decltype(_impl_.key_){}
     , decltype(_impl_.clientip_){}
     , decltype(_impl_.valuesizebyte_){}
@@ -4134,6 +5303,10 @@ ObjectAndPlacement::ObjectAndPlacement(const ObjectAndPlacement& from)
     , decltype(_impl_.block_size_){}
     , decltype(_impl_.encode_type_){}
     , decltype(_impl_.clientport_){}
+    , decltype(_impl_.if_partial_decoding_){}
+    , decltype(_impl_.with_key_size_){}
+    , decltype(_impl_.packed_){}
+    , decltype(_impl_.offset_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -4154,8 +5327,8 @@ ObjectAndPlacement::ObjectAndPlacement(const ObjectAndPlacement& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.valuesizebyte_, &from._impl_.valuesizebyte_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clientport_) -
-    reinterpret_cast<char*>(&_impl_.valuesizebyte_)) + sizeof(_impl_.clientport_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.valuesizebyte_)) + sizeof(_impl_.offset_));
   // @@protoc_insertion_point(copy_constructor:proxy_proto.ObjectAndPlacement)
 }
 
@@ -4170,6 +5343,10 @@ inline void ObjectAndPlacement::SharedCtor(
     , decltype(_impl_.blockkeys_){arena}
     , decltype(_impl_.blockids_){arena}
     , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+    , decltype(_impl_.islocal_){arena}
+    , decltype(_impl_.clusterids_){arena}
+    , /*decltype(_impl_._clusterids_cached_byte_size_)*/{0}
+    , decltype(_impl_.packed_keys_){arena}
     , decltype(_impl_.key_){}
     , decltype(_impl_.clientip_){}
     , decltype(_impl_.valuesizebyte_){0}
@@ -4180,6 +5357,10 @@ inline void ObjectAndPlacement::SharedCtor(
     , decltype(_impl_.block_size_){0}
     , decltype(_impl_.encode_type_){0}
     , decltype(_impl_.clientport_){0}
+    , decltype(_impl_.if_partial_decoding_){false}
+    , decltype(_impl_.with_key_size_){false}
+    , decltype(_impl_.packed_){false}
+    , decltype(_impl_.offset_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.key_.InitDefault();
@@ -4207,6 +5388,9 @@ inline void ObjectAndPlacement::SharedDtor() {
   _impl_.datanodeport_.~RepeatedField();
   _impl_.blockkeys_.~RepeatedPtrField();
   _impl_.blockids_.~RepeatedField();
+  _impl_.islocal_.~RepeatedField();
+  _impl_.clusterids_.~RepeatedField();
+  _impl_.packed_keys_.~RepeatedPtrField();
   _impl_.key_.Destroy();
   _impl_.clientip_.Destroy();
 }
@@ -4225,11 +5409,14 @@ void ObjectAndPlacement::Clear() {
   _impl_.datanodeport_.Clear();
   _impl_.blockkeys_.Clear();
   _impl_.blockids_.Clear();
+  _impl_.islocal_.Clear();
+  _impl_.clusterids_.Clear();
+  _impl_.packed_keys_.Clear();
   _impl_.key_.ClearToEmpty();
   _impl_.clientip_.ClearToEmpty();
   ::memset(&_impl_.valuesizebyte_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.clientport_) -
-      reinterpret_cast<char*>(&_impl_.valuesizebyte_)) + sizeof(_impl_.clientport_));
+      reinterpret_cast<char*>(&_impl_.offset_) -
+      reinterpret_cast<char*>(&_impl_.valuesizebyte_)) + sizeof(_impl_.offset_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -4375,6 +5562,75 @@ const char* ObjectAndPlacement::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
+      // repeated bool islocal = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_islocal(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 120) {
+          _internal_add_islocal(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool if_partial_decoding = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.if_partial_decoding_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 clusterids = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_clusterids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 136) {
+          _internal_add_clusterids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool with_key_size = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _impl_.with_key_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 offset = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool packed = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _impl_.packed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string packed_keys = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_packed_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.ObjectAndPlacement.packed_keys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<170>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4473,41 +5729,89 @@ uint8_t* ObjectAndPlacement::_InternalSerialize(
     target = stream->WriteString(9, s, target);
   }
 
-  // repeated int32 blockids = 10;
+  // repeated int32 blockids = 10;
+  {
+    int byte_size = _impl_._blockids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          10, _internal_blockids(), byte_size, target);
+    }
+  }
+
+  // int32 block_size = 11;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_block_size(), target);
+  }
+
+  // int32 encode_type = 12;
+  if (this->_internal_encode_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_encode_type(), target);
+  }
+
+  // string clientip = 13;
+  if (!this->_internal_clientip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_clientip().data(), static_cast<int>(this->_internal_clientip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proxy_proto.ObjectAndPlacement.clientip");
+    target = stream->WriteStringMaybeAliased(
+        13, this->_internal_clientip(), target);
+  }
+
+  // int32 clientport = 14;
+  if (this->_internal_clientport() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_clientport(), target);
+  }
+
+  // repeated bool islocal = 15;
+  if (this->_internal_islocal_size() > 0) {
+    target = stream->WriteFixedPacked(15, _internal_islocal(), target);
+  }
+
+  // bool if_partial_decoding = 16;
+  if (this->_internal_if_partial_decoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(16, this->_internal_if_partial_decoding(), target);
+  }
+
+  // repeated int32 clusterids = 17;
   {
-    int byte_size = _impl_._blockids_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._clusterids_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteInt32Packed(
-          10, _internal_blockids(), byte_size, target);
+          17, _internal_clusterids(), byte_size, target);
     }
   }
 
-  // int32 block_size = 11;
-  if (this->_internal_block_size() != 0) {
+  // bool with_key_size = 18;
+  if (this->_internal_with_key_size() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_block_size(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(18, this->_internal_with_key_size(), target);
   }
 
-  // int32 encode_type = 12;
-  if (this->_internal_encode_type() != 0) {
+  // int32 offset = 19;
+  if (this->_internal_offset() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_encode_type(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(19, this->_internal_offset(), target);
   }
 
-  // string clientip = 13;
-  if (!this->_internal_clientip().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_clientip().data(), static_cast<int>(this->_internal_clientip().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "proxy_proto.ObjectAndPlacement.clientip");
-    target = stream->WriteStringMaybeAliased(
-        13, this->_internal_clientip(), target);
+  // bool packed = 20;
+  if (this->_internal_packed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(20, this->_internal_packed(), target);
   }
 
-  // int32 clientport = 14;
-  if (this->_internal_clientport() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_clientport(), target);
+  // repeated string packed_keys = 21;
+  for (int i = 0, n = this->_internal_packed_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_packed_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proxy_proto.ObjectAndPlacement.packed_keys");
+    target = stream->WriteString(21, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -4570,6 +5874,39 @@ size_t ObjectAndPlacement::ByteSizeLong() const {
     total_size += data_size;
   }
 
+  // repeated bool islocal = 15;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_islocal_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated int32 clusterids = 17;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.clusterids_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._clusterids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated string packed_keys = 21;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.packed_keys_.size());
+  for (int i = 0, n = _impl_.packed_keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.packed_keys_.Get(i));
+  }
+
   // string key = 1;
   if (!this->_internal_key().empty()) {
     total_size += 1 +
@@ -4624,6 +5961,28 @@ size_t ObjectAndPlacement::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_clientport());
   }
 
+  // bool if_partial_decoding = 16;
+  if (this->_internal_if_partial_decoding() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool with_key_size = 18;
+  if (this->_internal_with_key_size() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool packed = 20;
+  if (this->_internal_packed() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // int32 offset = 19;
+  if (this->_internal_offset() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_offset());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -4642,83 +6001,286 @@ void ObjectAndPlacement::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.datanodeip_.MergeFrom(from._impl_.datanodeip_);
-  _this->_impl_.datanodeport_.MergeFrom(from._impl_.datanodeport_);
-  _this->_impl_.blockkeys_.MergeFrom(from._impl_.blockkeys_);
-  _this->_impl_.blockids_.MergeFrom(from._impl_.blockids_);
-  if (!from._internal_key().empty()) {
-    _this->_internal_set_key(from._internal_key());
-  }
-  if (!from._internal_clientip().empty()) {
-    _this->_internal_set_clientip(from._internal_clientip());
-  }
-  if (from._internal_valuesizebyte() != 0) {
-    _this->_internal_set_valuesizebyte(from._internal_valuesizebyte());
-  }
-  if (from._internal_k() != 0) {
-    _this->_internal_set_k(from._internal_k());
-  }
-  if (from._internal_l() != 0) {
-    _this->_internal_set_l(from._internal_l());
-  }
-  if (from._internal_g_m() != 0) {
-    _this->_internal_set_g_m(from._internal_g_m());
-  }
-  if (from._internal_stripe_id() != 0) {
-    _this->_internal_set_stripe_id(from._internal_stripe_id());
-  }
-  if (from._internal_block_size() != 0) {
-    _this->_internal_set_block_size(from._internal_block_size());
-  }
-  if (from._internal_encode_type() != 0) {
-    _this->_internal_set_encode_type(from._internal_encode_type());
-  }
-  if (from._internal_clientport() != 0) {
-    _this->_internal_set_clientport(from._internal_clientport());
-  }
+  _this->_impl_.datanodeip_.MergeFrom(from._impl_.datanodeip_);
+  _this->_impl_.datanodeport_.MergeFrom(from._impl_.datanodeport_);
+  _this->_impl_.blockkeys_.MergeFrom(from._impl_.blockkeys_);
+  _this->_impl_.blockids_.MergeFrom(from._impl_.blockids_);
+  _this->_impl_.islocal_.MergeFrom(from._impl_.islocal_);
+  _this->_impl_.clusterids_.MergeFrom(from._impl_.clusterids_);
+  _this->_impl_.packed_keys_.MergeFrom(from._impl_.packed_keys_);
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_clientip().empty()) {
+    _this->_internal_set_clientip(from._internal_clientip());
+  }
+  if (from._internal_valuesizebyte() != 0) {
+    _this->_internal_set_valuesizebyte(from._internal_valuesizebyte());
+  }
+  if (from._internal_k() != 0) {
+    _this->_internal_set_k(from._internal_k());
+  }
+  if (from._internal_l() != 0) {
+    _this->_internal_set_l(from._internal_l());
+  }
+  if (from._internal_g_m() != 0) {
+    _this->_internal_set_g_m(from._internal_g_m());
+  }
+  if (from._internal_stripe_id() != 0) {
+    _this->_internal_set_stripe_id(from._internal_stripe_id());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  if (from._internal_encode_type() != 0) {
+    _this->_internal_set_encode_type(from._internal_encode_type());
+  }
+  if (from._internal_clientport() != 0) {
+    _this->_internal_set_clientport(from._internal_clientport());
+  }
+  if (from._internal_if_partial_decoding() != 0) {
+    _this->_internal_set_if_partial_decoding(from._internal_if_partial_decoding());
+  }
+  if (from._internal_with_key_size() != 0) {
+    _this->_internal_set_with_key_size(from._internal_with_key_size());
+  }
+  if (from._internal_packed() != 0) {
+    _this->_internal_set_packed(from._internal_packed());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ObjectAndPlacement::CopyFrom(const ObjectAndPlacement& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.ObjectAndPlacement)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ObjectAndPlacement::IsInitialized() const {
+  return true;
+}
+
+void ObjectAndPlacement::InternalSwap(ObjectAndPlacement* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.datanodeip_.InternalSwap(&other->_impl_.datanodeip_);
+  _impl_.datanodeport_.InternalSwap(&other->_impl_.datanodeport_);
+  _impl_.blockkeys_.InternalSwap(&other->_impl_.blockkeys_);
+  _impl_.blockids_.InternalSwap(&other->_impl_.blockids_);
+  _impl_.islocal_.InternalSwap(&other->_impl_.islocal_);
+  _impl_.clusterids_.InternalSwap(&other->_impl_.clusterids_);
+  _impl_.packed_keys_.InternalSwap(&other->_impl_.packed_keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientip_, lhs_arena,
+      &other->_impl_.clientip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ObjectAndPlacement, _impl_.offset_)
+      + sizeof(ObjectAndPlacement::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(ObjectAndPlacement, _impl_.valuesizebyte_)>(
+          reinterpret_cast<char*>(&_impl_.valuesizebyte_),
+          reinterpret_cast<char*>(&other->_impl_.valuesizebyte_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ObjectAndPlacement::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
+      file_level_metadata_proxy_2eproto[14]);
+}
+
+// ===================================================================
+
+class ObjectBatch::_Internal {
+ public:
+};
+
+ObjectBatch::ObjectBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proxy_proto.ObjectBatch)
+}
+ObjectBatch::ObjectBatch(const ObjectBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ObjectBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.objects_){from._impl_.objects_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proxy_proto.ObjectBatch)
+}
+
+inline void ObjectBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.objects_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ObjectBatch::~ObjectBatch() {
+  // @@protoc_insertion_point(destructor:proxy_proto.ObjectBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ObjectBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.objects_.~RepeatedPtrField();
+}
+
+void ObjectBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ObjectBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:proxy_proto.ObjectBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.objects_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ObjectBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proxy_proto.ObjectAndPlacement objects = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_objects(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ObjectBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proxy_proto.ObjectBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .proxy_proto.ObjectAndPlacement objects = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_objects_size()); i < n; i++) {
+    const auto& repfield = this->_internal_objects(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proxy_proto.ObjectBatch)
+  return target;
+}
+
+size_t ObjectBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proxy_proto.ObjectBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proxy_proto.ObjectAndPlacement objects = 1;
+  total_size += 1UL * this->_internal_objects_size();
+  for (const auto& msg : this->_impl_.objects_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ObjectBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ObjectBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ObjectBatch::GetClassData() const { return &_class_data_; }
+
+
+void ObjectBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ObjectBatch*>(&to_msg);
+  auto& from = static_cast<const ObjectBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proxy_proto.ObjectBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.objects_.MergeFrom(from._impl_.objects_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ObjectAndPlacement::CopyFrom(const ObjectAndPlacement& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.ObjectAndPlacement)
+void ObjectBatch::CopyFrom(const ObjectBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.ObjectBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ObjectAndPlacement::IsInitialized() const {
+bool ObjectBatch::IsInitialized() const {
   return true;
 }
 
-void ObjectAndPlacement::InternalSwap(ObjectAndPlacement* other) {
+void ObjectBatch::InternalSwap(ObjectBatch* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.datanodeip_.InternalSwap(&other->_impl_.datanodeip_);
-  _impl_.datanodeport_.InternalSwap(&other->_impl_.datanodeport_);
-  _impl_.blockkeys_.InternalSwap(&other->_impl_.blockkeys_);
-  _impl_.blockids_.InternalSwap(&other->_impl_.blockids_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.key_, lhs_arena,
-      &other->_impl_.key_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.clientip_, lhs_arena,
-      &other->_impl_.clientip_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ObjectAndPlacement, _impl_.clientport_)
-      + sizeof(ObjectAndPlacement::_impl_.clientport_)
-      - PROTOBUF_FIELD_OFFSET(ObjectAndPlacement, _impl_.valuesizebyte_)>(
-          reinterpret_cast<char*>(&_impl_.valuesizebyte_),
-          reinterpret_cast<char*>(&other->_impl_.valuesizebyte_));
+  _impl_.objects_.InternalSwap(&other->_impl_.objects_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ObjectAndPlacement::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ObjectBatch::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[12]);
+      file_level_metadata_proxy_2eproto[15]);
 }
 
 // ===================================================================
@@ -4896,7 +6458,7 @@ void SetReply::InternalSwap(SetReply* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SetReply::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[13]);
+      file_level_metadata_proxy_2eproto[16]);
 }
 
 // ===================================================================
@@ -4956,20 +6518,337 @@ void GetReply::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.getsuccess_ = false;
+  _impl_.getsuccess_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool getsuccess = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.getsuccess_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proxy_proto.GetReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool getsuccess = 1;
+  if (this->_internal_getsuccess() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_getsuccess(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proxy_proto.GetReply)
+  return target;
+}
+
+size_t GetReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proxy_proto.GetReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool getsuccess = 1;
+  if (this->_internal_getsuccess() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetReply::GetClassData() const { return &_class_data_; }
+
+
+void GetReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetReply*>(&to_msg);
+  auto& from = static_cast<const GetReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proxy_proto.GetReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_getsuccess() != 0) {
+    _this->_internal_set_getsuccess(from._internal_getsuccess());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetReply::CopyFrom(const GetReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.GetReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetReply::IsInitialized() const {
+  return true;
+}
+
+void GetReply::InternalSwap(GetReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.getsuccess_, other->_impl_.getsuccess_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
+      file_level_metadata_proxy_2eproto[17]);
+}
+
+// ===================================================================
+
+class helpDecodePlan::_Internal {
+ public:
+};
+
+helpDecodePlan::helpDecodePlan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proxy_proto.helpDecodePlan)
+}
+helpDecodePlan::helpDecodePlan(const helpDecodePlan& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  helpDecodePlan* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.datanodeip_){from._impl_.datanodeip_}
+    , decltype(_impl_.datanodeport_){from._impl_.datanodeport_}
+    , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
+    , decltype(_impl_.blockkeys_){from._impl_.blockkeys_}
+    , decltype(_impl_.blockids_){from._impl_.blockids_}
+    , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+    , decltype(_impl_.coefficients_){from._impl_.coefficients_}
+    , /*decltype(_impl_._coefficients_cached_byte_size_)*/{0}
+    , decltype(_impl_.mainproxyip_){}
+    , decltype(_impl_.mainproxyport_){}
+    , decltype(_impl_.block_size_){}
+    , decltype(_impl_.failed_num_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.mainproxyip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mainproxyip().empty()) {
+    _this->_impl_.mainproxyip_.Set(from._internal_mainproxyip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.mainproxyport_, &from._impl_.mainproxyport_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.failed_num_) -
+    reinterpret_cast<char*>(&_impl_.mainproxyport_)) + sizeof(_impl_.failed_num_));
+  // @@protoc_insertion_point(copy_constructor:proxy_proto.helpDecodePlan)
+}
+
+inline void helpDecodePlan::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.datanodeip_){arena}
+    , decltype(_impl_.datanodeport_){arena}
+    , /*decltype(_impl_._datanodeport_cached_byte_size_)*/{0}
+    , decltype(_impl_.blockkeys_){arena}
+    , decltype(_impl_.blockids_){arena}
+    , /*decltype(_impl_._blockids_cached_byte_size_)*/{0}
+    , decltype(_impl_.coefficients_){arena}
+    , /*decltype(_impl_._coefficients_cached_byte_size_)*/{0}
+    , decltype(_impl_.mainproxyip_){}
+    , decltype(_impl_.mainproxyport_){0}
+    , decltype(_impl_.block_size_){0}
+    , decltype(_impl_.failed_num_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.mainproxyip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+helpDecodePlan::~helpDecodePlan() {
+  // @@protoc_insertion_point(destructor:proxy_proto.helpDecodePlan)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void helpDecodePlan::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.datanodeip_.~RepeatedPtrField();
+  _impl_.datanodeport_.~RepeatedField();
+  _impl_.blockkeys_.~RepeatedPtrField();
+  _impl_.blockids_.~RepeatedField();
+  _impl_.coefficients_.~RepeatedField();
+  _impl_.mainproxyip_.Destroy();
+}
+
+void helpDecodePlan::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void helpDecodePlan::Clear() {
+// @@protoc_insertion_point(message_clear_start:proxy_proto.helpDecodePlan)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.datanodeip_.Clear();
+  _impl_.datanodeport_.Clear();
+  _impl_.blockkeys_.Clear();
+  _impl_.blockids_.Clear();
+  _impl_.coefficients_.Clear();
+  _impl_.mainproxyip_.ClearToEmpty();
+  ::memset(&_impl_.mainproxyport_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.failed_num_) -
+      reinterpret_cast<char*>(&_impl_.mainproxyport_)) + sizeof(_impl_.failed_num_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* helpDecodePlan::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bool getsuccess = 1;
+      // string mainproxyip = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.getsuccess_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_mainproxyip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpDecodePlan.mainproxyip"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 mainproxyport = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.mainproxyport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string datanodeip = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_datanodeip();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpDecodePlan.datanodeip"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 datanodeport = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_datanodeport(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_datanodeport(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string blockkeys = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_blockkeys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "proxy_proto.helpDecodePlan.blockkeys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 blockids = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_blockids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_blockids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 block_size = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 failed_num = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.failed_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 coefficients = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_coefficients(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_coefficients(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -4997,84 +6876,258 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GetReply::_InternalSerialize(
+uint8_t* helpDecodePlan::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proxy_proto.GetReply)
+  // @@protoc_insertion_point(serialize_to_array_start:proxy_proto.helpDecodePlan)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bool getsuccess = 1;
-  if (this->_internal_getsuccess() != 0) {
+  // string mainproxyip = 1;
+  if (!this->_internal_mainproxyip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_mainproxyip().data(), static_cast<int>(this->_internal_mainproxyip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proxy_proto.helpDecodePlan.mainproxyip");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_mainproxyip(), target);
+  }
+
+  // int32 mainproxyport = 2;
+  if (this->_internal_mainproxyport() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_getsuccess(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_mainproxyport(), target);
+  }
+
+  // repeated string datanodeip = 3;
+  for (int i = 0, n = this->_internal_datanodeip_size(); i < n; i++) {
+    const auto& s = this->_internal_datanodeip(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proxy_proto.helpDecodePlan.datanodeip");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // repeated int32 datanodeport = 4;
+  {
+    int byte_size = _impl_._datanodeport_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          4, _internal_datanodeport(), byte_size, target);
+    }
+  }
+
+  // repeated string blockkeys = 5;
+  for (int i = 0, n = this->_internal_blockkeys_size(); i < n; i++) {
+    const auto& s = this->_internal_blockkeys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proxy_proto.helpDecodePlan.blockkeys");
+    target = stream->WriteString(5, s, target);
+  }
+
+  // repeated int32 blockids = 6;
+  {
+    int byte_size = _impl_._blockids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          6, _internal_blockids(), byte_size, target);
+    }
+  }
+
+  // int32 block_size = 7;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_block_size(), target);
+  }
+
+  // int32 failed_num = 8;
+  if (this->_internal_failed_num() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_failed_num(), target);
+  }
+
+  // repeated int32 coefficients = 9;
+  {
+    int byte_size = _impl_._coefficients_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          9, _internal_coefficients(), byte_size, target);
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proxy_proto.GetReply)
+  // @@protoc_insertion_point(serialize_to_array_end:proxy_proto.helpDecodePlan)
   return target;
 }
 
-size_t GetReply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proxy_proto.GetReply)
+size_t helpDecodePlan::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proxy_proto.helpDecodePlan)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bool getsuccess = 1;
-  if (this->_internal_getsuccess() != 0) {
-    total_size += 1 + 1;
+  // repeated string datanodeip = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.datanodeip_.size());
+  for (int i = 0, n = _impl_.datanodeip_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.datanodeip_.Get(i));
+  }
+
+  // repeated int32 datanodeport = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.datanodeport_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._datanodeport_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated string blockkeys = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.blockkeys_.size());
+  for (int i = 0, n = _impl_.blockkeys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.blockkeys_.Get(i));
+  }
+
+  // repeated int32 blockids = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.blockids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._blockids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 coefficients = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.coefficients_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._coefficients_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string mainproxyip = 1;
+  if (!this->_internal_mainproxyip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_mainproxyip());
+  }
+
+  // int32 mainproxyport = 2;
+  if (this->_internal_mainproxyport() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_mainproxyport());
+  }
+
+  // int32 block_size = 7;
+  if (this->_internal_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_block_size());
+  }
+
+  // int32 failed_num = 8;
+  if (this->_internal_failed_num() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_failed_num());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetReply::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData helpDecodePlan::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GetReply::MergeImpl
+    helpDecodePlan::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetReply::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*helpDecodePlan::GetClassData() const { return &_class_data_; }
 
 
-void GetReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GetReply*>(&to_msg);
-  auto& from = static_cast<const GetReply&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:proxy_proto.GetReply)
+void helpDecodePlan::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<helpDecodePlan*>(&to_msg);
+  auto& from = static_cast<const helpDecodePlan&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proxy_proto.helpDecodePlan)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_getsuccess() != 0) {
-    _this->_internal_set_getsuccess(from._internal_getsuccess());
+  _this->_impl_.datanodeip_.MergeFrom(from._impl_.datanodeip_);
+  _this->_impl_.datanodeport_.MergeFrom(from._impl_.datanodeport_);
+  _this->_impl_.blockkeys_.MergeFrom(from._impl_.blockkeys_);
+  _this->_impl_.blockids_.MergeFrom(from._impl_.blockids_);
+  _this->_impl_.coefficients_.MergeFrom(from._impl_.coefficients_);
+  if (!from._internal_mainproxyip().empty()) {
+    _this->_internal_set_mainproxyip(from._internal_mainproxyip());
+  }
+  if (from._internal_mainproxyport() != 0) {
+    _this->_internal_set_mainproxyport(from._internal_mainproxyport());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  if (from._internal_failed_num() != 0) {
+    _this->_internal_set_failed_num(from._internal_failed_num());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GetReply::CopyFrom(const GetReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.GetReply)
+void helpDecodePlan::CopyFrom(const helpDecodePlan& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proxy_proto.helpDecodePlan)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetReply::IsInitialized() const {
+bool helpDecodePlan::IsInitialized() const {
   return true;
 }
 
-void GetReply::InternalSwap(GetReply* other) {
+void helpDecodePlan::InternalSwap(helpDecodePlan* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.getsuccess_, other->_impl_.getsuccess_);
+  _impl_.datanodeip_.InternalSwap(&other->_impl_.datanodeip_);
+  _impl_.datanodeport_.InternalSwap(&other->_impl_.datanodeport_);
+  _impl_.blockkeys_.InternalSwap(&other->_impl_.blockkeys_);
+  _impl_.blockids_.InternalSwap(&other->_impl_.blockids_);
+  _impl_.coefficients_.InternalSwap(&other->_impl_.coefficients_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mainproxyip_, lhs_arena,
+      &other->_impl_.mainproxyip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(helpDecodePlan, _impl_.failed_num_)
+      + sizeof(helpDecodePlan::_impl_.failed_num_)
+      - PROTOBUF_FIELD_OFFSET(helpDecodePlan, _impl_.mainproxyport_)>(
+          reinterpret_cast<char*>(&_impl_.mainproxyport_),
+          reinterpret_cast<char*>(&other->_impl_.mainproxyport_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetReply::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata helpDecodePlan::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_proxy_2eproto_getter, &descriptor_table_proxy_2eproto_once,
-      file_level_metadata_proxy_2eproto[14]);
+      file_level_metadata_proxy_2eproto[18]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -5092,10 +7145,18 @@ template<> PROTOBUF_NOINLINE ::proxy_proto::RecalReply*
 Arena::CreateMaybeMessage< ::proxy_proto::RecalReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proxy_proto::RecalReply >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proxy_proto::RecalPort*
+Arena::CreateMaybeMessage< ::proxy_proto::RecalPort >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proxy_proto::RecalPort >(arena);
+}
 template<> PROTOBUF_NOINLINE ::proxy_proto::helpRecalPlan*
 Arena::CreateMaybeMessage< ::proxy_proto::helpRecalPlan >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proxy_proto::helpRecalPlan >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proxy_proto::fusedTarget*
+Arena::CreateMaybeMessage< ::proxy_proto::fusedTarget >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proxy_proto::fusedTarget >(arena);
+}
 template<> PROTOBUF_NOINLINE ::proxy_proto::blockRelocPlan*
 Arena::CreateMaybeMessage< ::proxy_proto::blockRelocPlan >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proxy_proto::blockRelocPlan >(arena);
@@ -5132,6 +7193,10 @@ template<> PROTOBUF_NOINLINE ::proxy_proto::ObjectAndPlacement*
 Arena::CreateMaybeMessage< ::proxy_proto::ObjectAndPlacement >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proxy_proto::ObjectAndPlacement >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proxy_proto::ObjectBatch*
+Arena::CreateMaybeMessage< ::proxy_proto::ObjectBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proxy_proto::ObjectBatch >(arena);
+}
 template<> PROTOBUF_NOINLINE ::proxy_proto::SetReply*
 Arena::CreateMaybeMessage< ::proxy_proto::SetReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proxy_proto::SetReply >(arena);
@@ -5140,6 +7205,10 @@ template<> PROTOBUF_NOINLINE ::proxy_proto::GetReply*
 Arena::CreateMaybeMessage< ::proxy_proto::GetReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proxy_proto::GetReply >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proxy_proto::helpDecodePlan*
+Arena::CreateMaybeMessage< ::proxy_proto::helpDecodePlan >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proxy_proto::helpDecodePlan >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -63,6 +63,12 @@ extern NodeAndBlockDefaultTypeInternal _NodeAndBlock_default_instance_;
 class ObjectAndPlacement;
 struct ObjectAndPlacementDefaultTypeInternal;
 extern ObjectAndPlacementDefaultTypeInternal _ObjectAndPlacement_default_instance_;
+class ObjectBatch;
+struct ObjectBatchDefaultTypeInternal;
+extern ObjectBatchDefaultTypeInternal _ObjectBatch_default_instance_;
+class RecalPort;
+struct RecalPortDefaultTypeInternal;
+extern RecalPortDefaultTypeInternal _RecalPort_default_instance_;
 class RecalReply;
 struct RecalReplyDefaultTypeInternal;
 extern RecalReplyDefaultTypeInternal _RecalReply_default_instance_;
@@ -81,6 +87,12 @@ extern blockRelocPlanDefaultTypeInternal _blockRelocPlan_default_instance_;
 class blockRelocReply;
 struct blockRelocReplyDefaultTypeInternal;
 extern blockRelocReplyDefaultTypeInternal _blockRelocReply_default_instance_;
+class fusedTarget;
+struct fusedTargetDefaultTypeInternal;
+extern fusedTargetDefaultTypeInternal _fusedTarget_default_instance_;
+class helpDecodePlan;
+struct helpDecodePlanDefaultTypeInternal;
+extern helpDecodePlanDefaultTypeInternal _helpDecodePlan_default_instance_;
 class helpRecalPlan;
 struct helpRecalPlanDefaultTypeInternal;
 extern helpRecalPlanDefaultTypeInternal _helpRecalPlan_default_instance_;
@@ -98,12 +110,16 @@ template<> ::proxy_proto::DelReply* Arena::CreateMaybeMessage<::proxy_proto::Del
 template<> ::proxy_proto::GetReply* Arena::CreateMaybeMessage<::proxy_proto::GetReply>(Arena*);
 template<> ::proxy_proto::NodeAndBlock* Arena::CreateMaybeMessage<::proxy_proto::NodeAndBlock>(Arena*);
 template<> ::proxy_proto::ObjectAndPlacement* Arena::CreateMaybeMessage<::proxy_proto::ObjectAndPlacement>(Arena*);
+template<> ::proxy_proto::ObjectBatch* Arena::CreateMaybeMessage<::proxy_proto::ObjectBatch>(Arena*);
+template<> ::proxy_proto::RecalPort* Arena::CreateMaybeMessage<::proxy_proto::RecalPort>(Arena*);
 template<> ::proxy_proto::RecalReply* Arena::CreateMaybeMessage<::proxy_proto::RecalReply>(Arena*);
 template<> ::proxy_proto::RepIfSuccess* Arena::CreateMaybeMessage<::proxy_proto::RepIfSuccess>(Arena*);
 template<> ::proxy_proto::RequestResult* Arena::CreateMaybeMessage<::proxy_proto::RequestResult>(Arena*);
 template<> ::proxy_proto::SetReply* Arena::CreateMaybeMessage<::proxy_proto::SetReply>(Arena*);
 template<> ::proxy_proto::blockRelocPlan* Arena::CreateMaybeMessage<::proxy_proto::blockRelocPlan>(Arena*);
 template<> ::proxy_proto::blockRelocReply* Arena::CreateMaybeMessage<::proxy_proto::blockRelocReply>(Arena*);
+template<> ::proxy_proto::fusedTarget* Arena::CreateMaybeMessage<::proxy_proto::fusedTarget>(Arena*);
+template<> ::proxy_proto::helpDecodePlan* Arena::CreateMaybeMessage<::proxy_proto::helpDecodePlan>(Arena*);
 template<> ::proxy_proto::helpRecalPlan* Arena::CreateMaybeMessage<::proxy_proto::helpRecalPlan>(Arena*);
 template<> ::proxy_proto::locationInfo* Arena::CreateMaybeMessage<::proxy_proto::locationInfo>(Arena*);
 template<> ::proxy_proto::mainRecalPlan* Arena::CreateMaybeMessage<::proxy_proto::mainRecalPlan>(Arena*);
@@ -237,6 +253,7 @@ class locationInfo final :
     kDatanodeportFieldNumber = 5,
     kBlockkeysFieldNumber = 6,
     kBlockidsFieldNumber = 7,
+    kGroupidsFieldNumber = 8,
     kProxyIpFieldNumber = 2,
     kClusterIdFieldNumber = 1,
     kProxyPortFieldNumber = 3,
@@ -333,6 +350,28 @@ class locationInfo final :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_blockids();
 
+  // repeated int32 groupids = 8;
+  int groupids_size() const;
+  private:
+  int _internal_groupids_size() const;
+  public:
+  void clear_groupids();
+  private:
+  int32_t _internal_groupids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_groupids() const;
+  void _internal_add_groupids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_groupids();
+  public:
+  int32_t groupids(int index) const;
+  void set_groupids(int index, int32_t value);
+  void add_groupids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      groupids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_groupids();
+
   // string proxy_ip = 2;
   void clear_proxy_ip();
   const std::string& proxy_ip() const;
@@ -379,6 +418,8 @@ class locationInfo final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> blockkeys_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > blockids_;
     mutable std::atomic<int> _blockids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > groupids_;
+    mutable std::atomic<int> _groupids_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr proxy_ip_;
     int32_t cluster_id_;
     int32_t proxy_port_;
@@ -514,8 +555,10 @@ class mainRecalPlan final :
     kPDatanodeipFieldNumber = 4,
     kPDatanodeportFieldNumber = 5,
     kPBlockkeysFieldNumber = 6,
+    kPBlockidsFieldNumber = 15,
     kTypeFieldNumber = 1,
     kIfPartialDecodingFieldNumber = 2,
+    kIfFusedFieldNumber = 14,
     kKFieldNumber = 7,
     kLFieldNumber = 8,
     kGMFieldNumber = 9,
@@ -523,6 +566,7 @@ class mainRecalPlan final :
     kEncodetypeFieldNumber = 11,
     kStripeIdFieldNumber = 12,
     kGroupIdFieldNumber = 13,
+    kTaskIdFieldNumber = 16,
   };
   // repeated .proxy_proto.locationInfo clusters = 3;
   int clusters_size() const;
@@ -612,6 +656,28 @@ class mainRecalPlan final :
   std::string* _internal_add_p_blockkeys();
   public:
 
+  // repeated int32 p_blockids = 15;
+  int p_blockids_size() const;
+  private:
+  int _internal_p_blockids_size() const;
+  public:
+  void clear_p_blockids();
+  private:
+  int32_t _internal_p_blockids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_p_blockids() const;
+  void _internal_add_p_blockids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_p_blockids();
+  public:
+  int32_t p_blockids(int index) const;
+  void set_p_blockids(int index, int32_t value);
+  void add_p_blockids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      p_blockids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_p_blockids();
+
   // bool type = 1;
   void clear_type();
   bool type() const;
@@ -630,6 +696,15 @@ class mainRecalPlan final :
   void _internal_set_if_partial_decoding(bool value);
   public:
 
+  // bool if_fused = 14;
+  void clear_if_fused();
+  bool if_fused() const;
+  void set_if_fused(bool value);
+  private:
+  bool _internal_if_fused() const;
+  void _internal_set_if_fused(bool value);
+  public:
+
   // int32 k = 7;
   void clear_k();
   int32_t k() const;
@@ -693,6 +768,15 @@ class mainRecalPlan final :
   void _internal_set_group_id(int32_t value);
   public:
 
+  // int32 task_id = 16;
+  void clear_task_id();
+  int32_t task_id() const;
+  void set_task_id(int32_t value);
+  private:
+  int32_t _internal_task_id() const;
+  void _internal_set_task_id(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proxy_proto.mainRecalPlan)
  private:
   class _Internal;
@@ -706,8 +790,11 @@ class mainRecalPlan final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > p_datanodeport_;
     mutable std::atomic<int> _p_datanodeport_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> p_blockkeys_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > p_blockids_;
+    mutable std::atomic<int> _p_blockids_cached_byte_size_;
     bool type_;
     bool if_partial_decoding_;
+    bool if_fused_;
     int32_t k_;
     int32_t l_;
     int32_t g_m_;
@@ -715,6 +802,7 @@ class mainRecalPlan final :
     int32_t encodetype_;
     int32_t stripe_id_;
     int32_t group_id_;
+    int32_t task_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -875,6 +963,165 @@ class RecalReply final :
 };
 // -------------------------------------------------------------------
 
+class RecalPort final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proxy_proto.RecalPort) */ {
+ public:
+  inline RecalPort() : RecalPort(nullptr) {}
+  ~RecalPort() override;
+  explicit PROTOBUF_CONSTEXPR RecalPort(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecalPort(const RecalPort& from);
+  RecalPort(RecalPort&& from) noexcept
+    : RecalPort() {
+    *this = ::std::move(from);
+  }
+
+  inline RecalPort& operator=(const RecalPort& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecalPort& operator=(RecalPort&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecalPort& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecalPort* internal_default_instance() {
+    return reinterpret_cast<const RecalPort*>(
+               &_RecalPort_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RecalPort& a, RecalPort& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecalPort* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecalPort* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecalPort* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecalPort>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecalPort& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecalPort& from) {
+    RecalPort::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecalPort* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proxy_proto.RecalPort";
+  }
+  protected:
+  explicit RecalPort(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTaskIdFieldNumber = 1,
+    kPortFieldNumber = 2,
+  };
+  // int32 task_id = 1;
+  void clear_task_id();
+  int32_t task_id() const;
+  void set_task_id(int32_t value);
+  private:
+  int32_t _internal_task_id() const;
+  void _internal_set_task_id(int32_t value);
+  public:
+
+  // int32 port = 2;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proxy_proto.RecalPort)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t task_id_;
+    int32_t port_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proxy_2eproto;
+};
+// -------------------------------------------------------------------
+
 class helpRecalPlan final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proxy_proto.helpRecalPlan) */ {
  public:
@@ -923,7 +1170,7 @@ class helpRecalPlan final :
                &_helpRecalPlan_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(helpRecalPlan& a, helpRecalPlan& b) {
     a.Swap(&b);
@@ -1000,14 +1247,19 @@ class helpRecalPlan final :
     kDatanodeportFieldNumber = 6,
     kBlockkeysFieldNumber = 7,
     kBlockidsFieldNumber = 9,
+    kGroupidsFieldNumber = 14,
+    kTargetsFieldNumber = 17,
     kMainproxyipFieldNumber = 3,
+    kMainproxyportFieldNumber = 4,
     kTypeFieldNumber = 1,
     kIfPartialDecodingFieldNumber = 2,
-    kMainproxyportFieldNumber = 4,
+    kIfFusedFieldNumber = 13,
     kBlockSizeFieldNumber = 8,
     kParityNumFieldNumber = 10,
     kKFieldNumber = 11,
     kEncodetypeFieldNumber = 12,
+    kLFieldNumber = 15,
+    kGMFieldNumber = 16,
   };
   // repeated string datanodeip = 5;
   int datanodeip_size() const;
@@ -1101,6 +1353,46 @@ class helpRecalPlan final :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_blockids();
 
+  // repeated int32 groupids = 14;
+  int groupids_size() const;
+  private:
+  int _internal_groupids_size() const;
+  public:
+  void clear_groupids();
+  private:
+  int32_t _internal_groupids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_groupids() const;
+  void _internal_add_groupids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_groupids();
+  public:
+  int32_t groupids(int index) const;
+  void set_groupids(int index, int32_t value);
+  void add_groupids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      groupids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_groupids();
+
+  // repeated .proxy_proto.fusedTarget targets = 17;
+  int targets_size() const;
+  private:
+  int _internal_targets_size() const;
+  public:
+  void clear_targets();
+  ::proxy_proto::fusedTarget* mutable_targets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::fusedTarget >*
+      mutable_targets();
+  private:
+  const ::proxy_proto::fusedTarget& _internal_targets(int index) const;
+  ::proxy_proto::fusedTarget* _internal_add_targets();
+  public:
+  const ::proxy_proto::fusedTarget& targets(int index) const;
+  ::proxy_proto::fusedTarget* add_targets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::fusedTarget >&
+      targets() const;
+
   // string mainproxyip = 3;
   void clear_mainproxyip();
   const std::string& mainproxyip() const;
@@ -1115,6 +1407,15 @@ class helpRecalPlan final :
   std::string* _internal_mutable_mainproxyip();
   public:
 
+  // int32 mainproxyport = 4;
+  void clear_mainproxyport();
+  int32_t mainproxyport() const;
+  void set_mainproxyport(int32_t value);
+  private:
+  int32_t _internal_mainproxyport() const;
+  void _internal_set_mainproxyport(int32_t value);
+  public:
+
   // bool type = 1;
   void clear_type();
   bool type() const;
@@ -1133,13 +1434,13 @@ class helpRecalPlan final :
   void _internal_set_if_partial_decoding(bool value);
   public:
 
-  // int32 mainproxyport = 4;
-  void clear_mainproxyport();
-  int32_t mainproxyport() const;
-  void set_mainproxyport(int32_t value);
+  // bool if_fused = 13;
+  void clear_if_fused();
+  bool if_fused() const;
+  void set_if_fused(bool value);
   private:
-  int32_t _internal_mainproxyport() const;
-  void _internal_set_mainproxyport(int32_t value);
+  bool _internal_if_fused() const;
+  void _internal_set_if_fused(bool value);
   public:
 
   // int32 block_size = 8;
@@ -1178,6 +1479,24 @@ class helpRecalPlan final :
   void _internal_set_encodetype(int32_t value);
   public:
 
+  // int32 l = 15;
+  void clear_l();
+  int32_t l() const;
+  void set_l(int32_t value);
+  private:
+  int32_t _internal_l() const;
+  void _internal_set_l(int32_t value);
+  public:
+
+  // int32 g_m = 16;
+  void clear_g_m();
+  int32_t g_m() const;
+  void set_g_m(int32_t value);
+  private:
+  int32_t _internal_g_m() const;
+  void _internal_set_g_m(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proxy_proto.helpRecalPlan)
  private:
   class _Internal;
@@ -1192,14 +1511,20 @@ class helpRecalPlan final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> blockkeys_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > blockids_;
     mutable std::atomic<int> _blockids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > groupids_;
+    mutable std::atomic<int> _groupids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::fusedTarget > targets_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mainproxyip_;
+    int32_t mainproxyport_;
     bool type_;
     bool if_partial_decoding_;
-    int32_t mainproxyport_;
+    bool if_fused_;
     int32_t block_size_;
     int32_t parity_num_;
     int32_t k_;
     int32_t encodetype_;
+    int32_t l_;
+    int32_t g_m_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1207,24 +1532,24 @@ class helpRecalPlan final :
 };
 // -------------------------------------------------------------------
 
-class blockRelocPlan final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proxy_proto.blockRelocPlan) */ {
+class fusedTarget final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proxy_proto.fusedTarget) */ {
  public:
-  inline blockRelocPlan() : blockRelocPlan(nullptr) {}
-  ~blockRelocPlan() override;
-  explicit PROTOBUF_CONSTEXPR blockRelocPlan(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline fusedTarget() : fusedTarget(nullptr) {}
+  ~fusedTarget() override;
+  explicit PROTOBUF_CONSTEXPR fusedTarget(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  blockRelocPlan(const blockRelocPlan& from);
-  blockRelocPlan(blockRelocPlan&& from) noexcept
-    : blockRelocPlan() {
+  fusedTarget(const fusedTarget& from);
+  fusedTarget(fusedTarget&& from) noexcept
+    : fusedTarget() {
     *this = ::std::move(from);
   }
 
-  inline blockRelocPlan& operator=(const blockRelocPlan& from) {
+  inline fusedTarget& operator=(const fusedTarget& from) {
     CopyFrom(from);
     return *this;
   }
-  inline blockRelocPlan& operator=(blockRelocPlan&& from) noexcept {
+  inline fusedTarget& operator=(fusedTarget&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1247,20 +1572,20 @@ class blockRelocPlan final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const blockRelocPlan& default_instance() {
+  static const fusedTarget& default_instance() {
     return *internal_default_instance();
   }
-  static inline const blockRelocPlan* internal_default_instance() {
-    return reinterpret_cast<const blockRelocPlan*>(
-               &_blockRelocPlan_default_instance_);
+  static inline const fusedTarget* internal_default_instance() {
+    return reinterpret_cast<const fusedTarget*>(
+               &_fusedTarget_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
-  friend void swap(blockRelocPlan& a, blockRelocPlan& b) {
+  friend void swap(fusedTarget& a, fusedTarget& b) {
     a.Swap(&b);
   }
-  inline void Swap(blockRelocPlan* other) {
+  inline void Swap(fusedTarget* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1273,7 +1598,7 @@ class blockRelocPlan final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(blockRelocPlan* other) {
+  void UnsafeArenaSwap(fusedTarget* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1281,14 +1606,14 @@ class blockRelocPlan final :
 
   // implements Message ----------------------------------------------
 
-  blockRelocPlan* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<blockRelocPlan>(arena);
+  fusedTarget* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<fusedTarget>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const blockRelocPlan& from);
+  void CopyFrom(const fusedTarget& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const blockRelocPlan& from) {
-    blockRelocPlan::MergeImpl(*this, from);
+  void MergeFrom( const fusedTarget& from) {
+    fusedTarget::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1306,15 +1631,15 @@ class blockRelocPlan final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(blockRelocPlan* other);
+  void InternalSwap(fusedTarget* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proxy_proto.blockRelocPlan";
+    return "proxy_proto.fusedTarget";
   }
   protected:
-  explicit blockRelocPlan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit fusedTarget(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1328,43 +1653,247 @@ class blockRelocPlan final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlocktomoveFieldNumber = 1,
-    kFromdatanodeipFieldNumber = 2,
-    kFromdatanodeportFieldNumber = 3,
-    kTodatanodeipFieldNumber = 4,
-    kTodatanodeportFieldNumber = 5,
-    kBlockSizeFieldNumber = 6,
+    kParityidsFieldNumber = 3,
+    kMainproxyipFieldNumber = 1,
+    kMainproxyportFieldNumber = 2,
+    kClusterIdFieldNumber = 4,
   };
-  // repeated string blocktomove = 1;
-  int blocktomove_size() const;
+  // repeated int32 parityids = 3;
+  int parityids_size() const;
   private:
-  int _internal_blocktomove_size() const;
+  int _internal_parityids_size() const;
   public:
-  void clear_blocktomove();
-  const std::string& blocktomove(int index) const;
-  std::string* mutable_blocktomove(int index);
-  void set_blocktomove(int index, const std::string& value);
-  void set_blocktomove(int index, std::string&& value);
-  void set_blocktomove(int index, const char* value);
-  void set_blocktomove(int index, const char* value, size_t size);
-  std::string* add_blocktomove();
-  void add_blocktomove(const std::string& value);
-  void add_blocktomove(std::string&& value);
-  void add_blocktomove(const char* value);
-  void add_blocktomove(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& blocktomove() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_blocktomove();
+  void clear_parityids();
   private:
-  const std::string& _internal_blocktomove(int index) const;
-  std::string* _internal_add_blocktomove();
+  int32_t _internal_parityids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_parityids() const;
+  void _internal_add_parityids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_parityids();
   public:
+  int32_t parityids(int index) const;
+  void set_parityids(int index, int32_t value);
+  void add_parityids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      parityids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_parityids();
 
-  // repeated string fromdatanodeip = 2;
-  int fromdatanodeip_size() const;
-  private:
-  int _internal_fromdatanodeip_size() const;
-  public:
-  void clear_fromdatanodeip();
+  // string mainproxyip = 1;
+  void clear_mainproxyip();
+  const std::string& mainproxyip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mainproxyip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mainproxyip();
+  PROTOBUF_NODISCARD std::string* release_mainproxyip();
+  void set_allocated_mainproxyip(std::string* mainproxyip);
+  private:
+  const std::string& _internal_mainproxyip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mainproxyip(const std::string& value);
+  std::string* _internal_mutable_mainproxyip();
+  public:
+
+  // int32 mainproxyport = 2;
+  void clear_mainproxyport();
+  int32_t mainproxyport() const;
+  void set_mainproxyport(int32_t value);
+  private:
+  int32_t _internal_mainproxyport() const;
+  void _internal_set_mainproxyport(int32_t value);
+  public:
+
+  // int32 cluster_id = 4;
+  void clear_cluster_id();
+  int32_t cluster_id() const;
+  void set_cluster_id(int32_t value);
+  private:
+  int32_t _internal_cluster_id() const;
+  void _internal_set_cluster_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proxy_proto.fusedTarget)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > parityids_;
+    mutable std::atomic<int> _parityids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mainproxyip_;
+    int32_t mainproxyport_;
+    int32_t cluster_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proxy_2eproto;
+};
+// -------------------------------------------------------------------
+
+class blockRelocPlan final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proxy_proto.blockRelocPlan) */ {
+ public:
+  inline blockRelocPlan() : blockRelocPlan(nullptr) {}
+  ~blockRelocPlan() override;
+  explicit PROTOBUF_CONSTEXPR blockRelocPlan(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  blockRelocPlan(const blockRelocPlan& from);
+  blockRelocPlan(blockRelocPlan&& from) noexcept
+    : blockRelocPlan() {
+    *this = ::std::move(from);
+  }
+
+  inline blockRelocPlan& operator=(const blockRelocPlan& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline blockRelocPlan& operator=(blockRelocPlan&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const blockRelocPlan& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const blockRelocPlan* internal_default_instance() {
+    return reinterpret_cast<const blockRelocPlan*>(
+               &_blockRelocPlan_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(blockRelocPlan& a, blockRelocPlan& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(blockRelocPlan* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(blockRelocPlan* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  blockRelocPlan* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<blockRelocPlan>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const blockRelocPlan& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const blockRelocPlan& from) {
+    blockRelocPlan::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(blockRelocPlan* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proxy_proto.blockRelocPlan";
+  }
+  protected:
+  explicit blockRelocPlan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlocktomoveFieldNumber = 1,
+    kFromdatanodeipFieldNumber = 2,
+    kFromdatanodeportFieldNumber = 3,
+    kTodatanodeipFieldNumber = 4,
+    kTodatanodeportFieldNumber = 5,
+    kBlockSizeFieldNumber = 6,
+    kTaskIdFieldNumber = 7,
+    kMaxParallelFieldNumber = 8,
+    kMaxPerDesNodeFieldNumber = 9,
+    kBandwidthFieldNumber = 10,
+  };
+  // repeated string blocktomove = 1;
+  int blocktomove_size() const;
+  private:
+  int _internal_blocktomove_size() const;
+  public:
+  void clear_blocktomove();
+  const std::string& blocktomove(int index) const;
+  std::string* mutable_blocktomove(int index);
+  void set_blocktomove(int index, const std::string& value);
+  void set_blocktomove(int index, std::string&& value);
+  void set_blocktomove(int index, const char* value);
+  void set_blocktomove(int index, const char* value, size_t size);
+  std::string* add_blocktomove();
+  void add_blocktomove(const std::string& value);
+  void add_blocktomove(std::string&& value);
+  void add_blocktomove(const char* value);
+  void add_blocktomove(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& blocktomove() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_blocktomove();
+  private:
+  const std::string& _internal_blocktomove(int index) const;
+  std::string* _internal_add_blocktomove();
+  public:
+
+  // repeated string fromdatanodeip = 2;
+  int fromdatanodeip_size() const;
+  private:
+  int _internal_fromdatanodeip_size() const;
+  public:
+  void clear_fromdatanodeip();
   const std::string& fromdatanodeip(int index) const;
   std::string* mutable_fromdatanodeip(int index);
   void set_fromdatanodeip(int index, const std::string& value);
@@ -1460,6 +1989,42 @@ class blockRelocPlan final :
   void _internal_set_block_size(int32_t value);
   public:
 
+  // int32 task_id = 7;
+  void clear_task_id();
+  int32_t task_id() const;
+  void set_task_id(int32_t value);
+  private:
+  int32_t _internal_task_id() const;
+  void _internal_set_task_id(int32_t value);
+  public:
+
+  // int32 max_parallel = 8;
+  void clear_max_parallel();
+  int32_t max_parallel() const;
+  void set_max_parallel(int32_t value);
+  private:
+  int32_t _internal_max_parallel() const;
+  void _internal_set_max_parallel(int32_t value);
+  public:
+
+  // int32 max_per_des_node = 9;
+  void clear_max_per_des_node();
+  int32_t max_per_des_node() const;
+  void set_max_per_des_node(int32_t value);
+  private:
+  int32_t _internal_max_per_des_node() const;
+  void _internal_set_max_per_des_node(int32_t value);
+  public:
+
+  // int64 bandwidth = 10;
+  void clear_bandwidth();
+  int64_t bandwidth() const;
+  void set_bandwidth(int64_t value);
+  private:
+  int64_t _internal_bandwidth() const;
+  void _internal_set_bandwidth(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proxy_proto.blockRelocPlan)
  private:
   class _Internal;
@@ -1476,6 +2041,10 @@ class blockRelocPlan final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > todatanodeport_;
     mutable std::atomic<int> _todatanodeport_cached_byte_size_;
     int32_t block_size_;
+    int32_t task_id_;
+    int32_t max_parallel_;
+    int32_t max_per_des_node_;
+    int64_t bandwidth_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1531,7 +2100,7 @@ class blockRelocReply final :
                &_blockRelocReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    7;
 
   friend void swap(blockRelocReply& a, blockRelocReply& b) {
     a.Swap(&b);
@@ -1684,7 +2253,7 @@ class AskIfSuccess final :
                &_AskIfSuccess_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    8;
 
   friend void swap(AskIfSuccess& a, AskIfSuccess& b) {
     a.Swap(&b);
@@ -1758,6 +2327,7 @@ class AskIfSuccess final :
 
   enum : int {
     kStepFieldNumber = 1,
+    kTaskIdFieldNumber = 2,
   };
   // int32 step = 1;
   void clear_step();
@@ -1768,6 +2338,15 @@ class AskIfSuccess final :
   void _internal_set_step(int32_t value);
   public:
 
+  // int32 task_id = 2;
+  void clear_task_id();
+  int32_t task_id() const;
+  void set_task_id(int32_t value);
+  private:
+  int32_t _internal_task_id() const;
+  void _internal_set_task_id(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proxy_proto.AskIfSuccess)
  private:
   class _Internal;
@@ -1777,6 +2356,7 @@ class AskIfSuccess final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     int32_t step_;
+    int32_t task_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1832,7 +2412,7 @@ class RepIfSuccess final :
                &_RepIfSuccess_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    9;
 
   friend void swap(RepIfSuccess& a, RepIfSuccess& b) {
     a.Swap(&b);
@@ -1980,7 +2560,7 @@ class NodeAndBlock final :
                &_NodeAndBlock_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    10;
 
   friend void swap(NodeAndBlock& a, NodeAndBlock& b) {
     a.Swap(&b);
@@ -2058,6 +2638,7 @@ class NodeAndBlock final :
     kDatanodeportFieldNumber = 3,
     kKeyFieldNumber = 5,
     kStripeIdFieldNumber = 4,
+    kTaskIdFieldNumber = 6,
   };
   // repeated string blockkeys = 1;
   int blockkeys_size() const;
@@ -2152,6 +2733,15 @@ class NodeAndBlock final :
   void _internal_set_stripe_id(int32_t value);
   public:
 
+  // int32 task_id = 6;
+  void clear_task_id();
+  int32_t task_id() const;
+  void set_task_id(int32_t value);
+  private:
+  int32_t _internal_task_id() const;
+  void _internal_set_task_id(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proxy_proto.NodeAndBlock)
  private:
   class _Internal;
@@ -2166,6 +2756,7 @@ class NodeAndBlock final :
     mutable std::atomic<int> _datanodeport_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
     int32_t stripe_id_;
+    int32_t task_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2221,7 +2812,7 @@ class DelReply final :
                &_DelReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    11;
 
   friend void swap(DelReply& a, DelReply& b) {
     a.Swap(&b);
@@ -2369,7 +2960,7 @@ class CheckaliveCMD final :
                &_CheckaliveCMD_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    12;
 
   friend void swap(CheckaliveCMD& a, CheckaliveCMD& b) {
     a.Swap(&b);
@@ -2522,7 +3113,7 @@ class RequestResult final :
                &_RequestResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    13;
 
   friend void swap(RequestResult& a, RequestResult& b) {
     a.Swap(&b);
@@ -2670,7 +3261,7 @@ class ObjectAndPlacement final :
                &_ObjectAndPlacement_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    14;
 
   friend void swap(ObjectAndPlacement& a, ObjectAndPlacement& b) {
     a.Swap(&b);
@@ -2747,6 +3338,9 @@ class ObjectAndPlacement final :
     kDatanodeportFieldNumber = 8,
     kBlockkeysFieldNumber = 9,
     kBlockidsFieldNumber = 10,
+    kIslocalFieldNumber = 15,
+    kClusteridsFieldNumber = 17,
+    kPackedKeysFieldNumber = 21,
     kKeyFieldNumber = 1,
     kClientipFieldNumber = 13,
     kValuesizebyteFieldNumber = 2,
@@ -2757,6 +3351,10 @@ class ObjectAndPlacement final :
     kBlockSizeFieldNumber = 11,
     kEncodeTypeFieldNumber = 12,
     kClientportFieldNumber = 14,
+    kIfPartialDecodingFieldNumber = 16,
+    kWithKeySizeFieldNumber = 18,
+    kPackedFieldNumber = 20,
+    kOffsetFieldNumber = 19,
   };
   // repeated string datanodeip = 7;
   int datanodeip_size() const;
@@ -2850,6 +3448,74 @@ class ObjectAndPlacement final :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_blockids();
 
+  // repeated bool islocal = 15;
+  int islocal_size() const;
+  private:
+  int _internal_islocal_size() const;
+  public:
+  void clear_islocal();
+  private:
+  bool _internal_islocal(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_islocal() const;
+  void _internal_add_islocal(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_islocal();
+  public:
+  bool islocal(int index) const;
+  void set_islocal(int index, bool value);
+  void add_islocal(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      islocal() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_islocal();
+
+  // repeated int32 clusterids = 17;
+  int clusterids_size() const;
+  private:
+  int _internal_clusterids_size() const;
+  public:
+  void clear_clusterids();
+  private:
+  int32_t _internal_clusterids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_clusterids() const;
+  void _internal_add_clusterids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_clusterids();
+  public:
+  int32_t clusterids(int index) const;
+  void set_clusterids(int index, int32_t value);
+  void add_clusterids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      clusterids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_clusterids();
+
+  // repeated string packed_keys = 21;
+  int packed_keys_size() const;
+  private:
+  int _internal_packed_keys_size() const;
+  public:
+  void clear_packed_keys();
+  const std::string& packed_keys(int index) const;
+  std::string* mutable_packed_keys(int index);
+  void set_packed_keys(int index, const std::string& value);
+  void set_packed_keys(int index, std::string&& value);
+  void set_packed_keys(int index, const char* value);
+  void set_packed_keys(int index, const char* value, size_t size);
+  std::string* add_packed_keys();
+  void add_packed_keys(const std::string& value);
+  void add_packed_keys(std::string&& value);
+  void add_packed_keys(const char* value);
+  void add_packed_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& packed_keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_packed_keys();
+  private:
+  const std::string& _internal_packed_keys(int index) const;
+  std::string* _internal_add_packed_keys();
+  public:
+
   // string key = 1;
   void clear_key();
   const std::string& key() const;
@@ -2950,9 +3616,45 @@ class ObjectAndPlacement final :
   void _internal_set_clientport(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:proxy_proto.ObjectAndPlacement)
- private:
-  class _Internal;
+  // bool if_partial_decoding = 16;
+  void clear_if_partial_decoding();
+  bool if_partial_decoding() const;
+  void set_if_partial_decoding(bool value);
+  private:
+  bool _internal_if_partial_decoding() const;
+  void _internal_set_if_partial_decoding(bool value);
+  public:
+
+  // bool with_key_size = 18;
+  void clear_with_key_size();
+  bool with_key_size() const;
+  void set_with_key_size(bool value);
+  private:
+  bool _internal_with_key_size() const;
+  void _internal_set_with_key_size(bool value);
+  public:
+
+  // bool packed = 20;
+  void clear_packed();
+  bool packed() const;
+  void set_packed(bool value);
+  private:
+  bool _internal_packed() const;
+  void _internal_set_packed(bool value);
+  public:
+
+  // int32 offset = 19;
+  void clear_offset();
+  int32_t offset() const;
+  void set_offset(int32_t value);
+  private:
+  int32_t _internal_offset() const;
+  void _internal_set_offset(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proxy_proto.ObjectAndPlacement)
+ private:
+  class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
@@ -2964,6 +3666,10 @@ class ObjectAndPlacement final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> blockkeys_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > blockids_;
     mutable std::atomic<int> _blockids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > islocal_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > clusterids_;
+    mutable std::atomic<int> _clusterids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> packed_keys_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientip_;
     int32_t valuesizebyte_;
@@ -2974,6 +3680,167 @@ class ObjectAndPlacement final :
     int32_t block_size_;
     int32_t encode_type_;
     int32_t clientport_;
+    bool if_partial_decoding_;
+    bool with_key_size_;
+    bool packed_;
+    int32_t offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proxy_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ObjectBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proxy_proto.ObjectBatch) */ {
+ public:
+  inline ObjectBatch() : ObjectBatch(nullptr) {}
+  ~ObjectBatch() override;
+  explicit PROTOBUF_CONSTEXPR ObjectBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ObjectBatch(const ObjectBatch& from);
+  ObjectBatch(ObjectBatch&& from) noexcept
+    : ObjectBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline ObjectBatch& operator=(const ObjectBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ObjectBatch& operator=(ObjectBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ObjectBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ObjectBatch* internal_default_instance() {
+    return reinterpret_cast<const ObjectBatch*>(
+               &_ObjectBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ObjectBatch& a, ObjectBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ObjectBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ObjectBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ObjectBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ObjectBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ObjectBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ObjectBatch& from) {
+    ObjectBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ObjectBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proxy_proto.ObjectBatch";
+  }
+  protected:
+  explicit ObjectBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObjectsFieldNumber = 1,
+  };
+  // repeated .proxy_proto.ObjectAndPlacement objects = 1;
+  int objects_size() const;
+  private:
+  int _internal_objects_size() const;
+  public:
+  void clear_objects();
+  ::proxy_proto::ObjectAndPlacement* mutable_objects(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::ObjectAndPlacement >*
+      mutable_objects();
+  private:
+  const ::proxy_proto::ObjectAndPlacement& _internal_objects(int index) const;
+  ::proxy_proto::ObjectAndPlacement* _internal_add_objects();
+  public:
+  const ::proxy_proto::ObjectAndPlacement& objects(int index) const;
+  ::proxy_proto::ObjectAndPlacement* add_objects();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::ObjectAndPlacement >&
+      objects() const;
+
+  // @@protoc_insertion_point(class_scope:proxy_proto.ObjectBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::ObjectAndPlacement > objects_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3029,7 +3896,7 @@ class SetReply final :
                &_SetReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    16;
 
   friend void swap(SetReply& a, SetReply& b) {
     a.Swap(&b);
@@ -3177,7 +4044,7 @@ class GetReply final :
                &_GetReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    17;
 
   friend void swap(GetReply& a, GetReply& b) {
     a.Swap(&b);
@@ -3275,2641 +4142,4246 @@ class GetReply final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_proxy_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class helpDecodePlan final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proxy_proto.helpDecodePlan) */ {
+ public:
+  inline helpDecodePlan() : helpDecodePlan(nullptr) {}
+  ~helpDecodePlan() override;
+  explicit PROTOBUF_CONSTEXPR helpDecodePlan(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// locationInfo
+  helpDecodePlan(const helpDecodePlan& from);
+  helpDecodePlan(helpDecodePlan&& from) noexcept
+    : helpDecodePlan() {
+    *this = ::std::move(from);
+  }
 
-// int32 cluster_id = 1;
-inline void locationInfo::clear_cluster_id() {
-  _impl_.cluster_id_ = 0;
-}
-inline int32_t locationInfo::_internal_cluster_id() const {
-  return _impl_.cluster_id_;
-}
-inline int32_t locationInfo::cluster_id() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.cluster_id)
-  return _internal_cluster_id();
-}
-inline void locationInfo::_internal_set_cluster_id(int32_t value) {
-  
-  _impl_.cluster_id_ = value;
-}
-inline void locationInfo::set_cluster_id(int32_t value) {
-  _internal_set_cluster_id(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.cluster_id)
-}
+  inline helpDecodePlan& operator=(const helpDecodePlan& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline helpDecodePlan& operator=(helpDecodePlan&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string proxy_ip = 2;
-inline void locationInfo::clear_proxy_ip() {
-  _impl_.proxy_ip_.ClearToEmpty();
-}
-inline const std::string& locationInfo::proxy_ip() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.proxy_ip)
-  return _internal_proxy_ip();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void locationInfo::set_proxy_ip(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.proxy_ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.proxy_ip)
-}
-inline std::string* locationInfo::mutable_proxy_ip() {
-  std::string* _s = _internal_mutable_proxy_ip();
-  // @@protoc_insertion_point(field_mutable:proxy_proto.locationInfo.proxy_ip)
-  return _s;
-}
-inline const std::string& locationInfo::_internal_proxy_ip() const {
-  return _impl_.proxy_ip_.Get();
-}
-inline void locationInfo::_internal_set_proxy_ip(const std::string& value) {
-  
-  _impl_.proxy_ip_.Set(value, GetArenaForAllocation());
-}
-inline std::string* locationInfo::_internal_mutable_proxy_ip() {
-  
-  return _impl_.proxy_ip_.Mutable(GetArenaForAllocation());
-}
-inline std::string* locationInfo::release_proxy_ip() {
-  // @@protoc_insertion_point(field_release:proxy_proto.locationInfo.proxy_ip)
-  return _impl_.proxy_ip_.Release();
-}
-inline void locationInfo::set_allocated_proxy_ip(std::string* proxy_ip) {
-  if (proxy_ip != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  _impl_.proxy_ip_.SetAllocated(proxy_ip, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.proxy_ip_.IsDefault()) {
-    _impl_.proxy_ip_.Set("", GetArenaForAllocation());
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proxy_proto.locationInfo.proxy_ip)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const helpDecodePlan& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const helpDecodePlan* internal_default_instance() {
+    return reinterpret_cast<const helpDecodePlan*>(
+               &_helpDecodePlan_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
 
-// int32 proxy_port = 3;
-inline void locationInfo::clear_proxy_port() {
-  _impl_.proxy_port_ = 0;
-}
-inline int32_t locationInfo::_internal_proxy_port() const {
-  return _impl_.proxy_port_;
-}
-inline int32_t locationInfo::proxy_port() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.proxy_port)
-  return _internal_proxy_port();
-}
-inline void locationInfo::_internal_set_proxy_port(int32_t value) {
-  
-  _impl_.proxy_port_ = value;
+  friend void swap(helpDecodePlan& a, helpDecodePlan& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(helpDecodePlan* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(helpDecodePlan* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  helpDecodePlan* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<helpDecodePlan>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const helpDecodePlan& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const helpDecodePlan& from) {
+    helpDecodePlan::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(helpDecodePlan* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proxy_proto.helpDecodePlan";
+  }
+  protected:
+  explicit helpDecodePlan(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDatanodeipFieldNumber = 3,
+    kDatanodeportFieldNumber = 4,
+    kBlockkeysFieldNumber = 5,
+    kBlockidsFieldNumber = 6,
+    kCoefficientsFieldNumber = 9,
+    kMainproxyipFieldNumber = 1,
+    kMainproxyportFieldNumber = 2,
+    kBlockSizeFieldNumber = 7,
+    kFailedNumFieldNumber = 8,
+  };
+  // repeated string datanodeip = 3;
+  int datanodeip_size() const;
+  private:
+  int _internal_datanodeip_size() const;
+  public:
+  void clear_datanodeip();
+  const std::string& datanodeip(int index) const;
+  std::string* mutable_datanodeip(int index);
+  void set_datanodeip(int index, const std::string& value);
+  void set_datanodeip(int index, std::string&& value);
+  void set_datanodeip(int index, const char* value);
+  void set_datanodeip(int index, const char* value, size_t size);
+  std::string* add_datanodeip();
+  void add_datanodeip(const std::string& value);
+  void add_datanodeip(std::string&& value);
+  void add_datanodeip(const char* value);
+  void add_datanodeip(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& datanodeip() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_datanodeip();
+  private:
+  const std::string& _internal_datanodeip(int index) const;
+  std::string* _internal_add_datanodeip();
+  public:
+
+  // repeated int32 datanodeport = 4;
+  int datanodeport_size() const;
+  private:
+  int _internal_datanodeport_size() const;
+  public:
+  void clear_datanodeport();
+  private:
+  int32_t _internal_datanodeport(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_datanodeport() const;
+  void _internal_add_datanodeport(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_datanodeport();
+  public:
+  int32_t datanodeport(int index) const;
+  void set_datanodeport(int index, int32_t value);
+  void add_datanodeport(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      datanodeport() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_datanodeport();
+
+  // repeated string blockkeys = 5;
+  int blockkeys_size() const;
+  private:
+  int _internal_blockkeys_size() const;
+  public:
+  void clear_blockkeys();
+  const std::string& blockkeys(int index) const;
+  std::string* mutable_blockkeys(int index);
+  void set_blockkeys(int index, const std::string& value);
+  void set_blockkeys(int index, std::string&& value);
+  void set_blockkeys(int index, const char* value);
+  void set_blockkeys(int index, const char* value, size_t size);
+  std::string* add_blockkeys();
+  void add_blockkeys(const std::string& value);
+  void add_blockkeys(std::string&& value);
+  void add_blockkeys(const char* value);
+  void add_blockkeys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& blockkeys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_blockkeys();
+  private:
+  const std::string& _internal_blockkeys(int index) const;
+  std::string* _internal_add_blockkeys();
+  public:
+
+  // repeated int32 blockids = 6;
+  int blockids_size() const;
+  private:
+  int _internal_blockids_size() const;
+  public:
+  void clear_blockids();
+  private:
+  int32_t _internal_blockids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_blockids() const;
+  void _internal_add_blockids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_blockids();
+  public:
+  int32_t blockids(int index) const;
+  void set_blockids(int index, int32_t value);
+  void add_blockids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      blockids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_blockids();
+
+  // repeated int32 coefficients = 9;
+  int coefficients_size() const;
+  private:
+  int _internal_coefficients_size() const;
+  public:
+  void clear_coefficients();
+  private:
+  int32_t _internal_coefficients(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_coefficients() const;
+  void _internal_add_coefficients(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_coefficients();
+  public:
+  int32_t coefficients(int index) const;
+  void set_coefficients(int index, int32_t value);
+  void add_coefficients(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      coefficients() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_coefficients();
+
+  // string mainproxyip = 1;
+  void clear_mainproxyip();
+  const std::string& mainproxyip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mainproxyip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mainproxyip();
+  PROTOBUF_NODISCARD std::string* release_mainproxyip();
+  void set_allocated_mainproxyip(std::string* mainproxyip);
+  private:
+  const std::string& _internal_mainproxyip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mainproxyip(const std::string& value);
+  std::string* _internal_mutable_mainproxyip();
+  public:
+
+  // int32 mainproxyport = 2;
+  void clear_mainproxyport();
+  int32_t mainproxyport() const;
+  void set_mainproxyport(int32_t value);
+  private:
+  int32_t _internal_mainproxyport() const;
+  void _internal_set_mainproxyport(int32_t value);
+  public:
+
+  // int32 block_size = 7;
+  void clear_block_size();
+  int32_t block_size() const;
+  void set_block_size(int32_t value);
+  private:
+  int32_t _internal_block_size() const;
+  void _internal_set_block_size(int32_t value);
+  public:
+
+  // int32 failed_num = 8;
+  void clear_failed_num();
+  int32_t failed_num() const;
+  void set_failed_num(int32_t value);
+  private:
+  int32_t _internal_failed_num() const;
+  void _internal_set_failed_num(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proxy_proto.helpDecodePlan)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> datanodeip_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > datanodeport_;
+    mutable std::atomic<int> _datanodeport_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> blockkeys_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > blockids_;
+    mutable std::atomic<int> _blockids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > coefficients_;
+    mutable std::atomic<int> _coefficients_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mainproxyip_;
+    int32_t mainproxyport_;
+    int32_t block_size_;
+    int32_t failed_num_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proxy_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// locationInfo
+
+// int32 cluster_id = 1;
+inline void locationInfo::clear_cluster_id() {
+  _impl_.cluster_id_ = 0;
+}
+inline int32_t locationInfo::_internal_cluster_id() const {
+  return _impl_.cluster_id_;
+}
+inline int32_t locationInfo::cluster_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.cluster_id)
+  return _internal_cluster_id();
+}
+inline void locationInfo::_internal_set_cluster_id(int32_t value) {
+  
+  _impl_.cluster_id_ = value;
+}
+inline void locationInfo::set_cluster_id(int32_t value) {
+  _internal_set_cluster_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.cluster_id)
+}
+
+// string proxy_ip = 2;
+inline void locationInfo::clear_proxy_ip() {
+  _impl_.proxy_ip_.ClearToEmpty();
+}
+inline const std::string& locationInfo::proxy_ip() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.proxy_ip)
+  return _internal_proxy_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void locationInfo::set_proxy_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.proxy_ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.proxy_ip)
+}
+inline std::string* locationInfo::mutable_proxy_ip() {
+  std::string* _s = _internal_mutable_proxy_ip();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.locationInfo.proxy_ip)
+  return _s;
+}
+inline const std::string& locationInfo::_internal_proxy_ip() const {
+  return _impl_.proxy_ip_.Get();
+}
+inline void locationInfo::_internal_set_proxy_ip(const std::string& value) {
+  
+  _impl_.proxy_ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* locationInfo::_internal_mutable_proxy_ip() {
+  
+  return _impl_.proxy_ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* locationInfo::release_proxy_ip() {
+  // @@protoc_insertion_point(field_release:proxy_proto.locationInfo.proxy_ip)
+  return _impl_.proxy_ip_.Release();
+}
+inline void locationInfo::set_allocated_proxy_ip(std::string* proxy_ip) {
+  if (proxy_ip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.proxy_ip_.SetAllocated(proxy_ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.proxy_ip_.IsDefault()) {
+    _impl_.proxy_ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.locationInfo.proxy_ip)
+}
+
+// int32 proxy_port = 3;
+inline void locationInfo::clear_proxy_port() {
+  _impl_.proxy_port_ = 0;
+}
+inline int32_t locationInfo::_internal_proxy_port() const {
+  return _impl_.proxy_port_;
+}
+inline int32_t locationInfo::proxy_port() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.proxy_port)
+  return _internal_proxy_port();
+}
+inline void locationInfo::_internal_set_proxy_port(int32_t value) {
+  
+  _impl_.proxy_port_ = value;
+}
+inline void locationInfo::set_proxy_port(int32_t value) {
+  _internal_set_proxy_port(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.proxy_port)
+}
+
+// repeated string datanodeip = 4;
+inline int locationInfo::_internal_datanodeip_size() const {
+  return _impl_.datanodeip_.size();
+}
+inline int locationInfo::datanodeip_size() const {
+  return _internal_datanodeip_size();
+}
+inline void locationInfo::clear_datanodeip() {
+  _impl_.datanodeip_.Clear();
+}
+inline std::string* locationInfo::add_datanodeip() {
+  std::string* _s = _internal_add_datanodeip();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.locationInfo.datanodeip)
+  return _s;
+}
+inline const std::string& locationInfo::_internal_datanodeip(int index) const {
+  return _impl_.datanodeip_.Get(index);
+}
+inline const std::string& locationInfo::datanodeip(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.datanodeip)
+  return _internal_datanodeip(index);
+}
+inline std::string* locationInfo::mutable_datanodeip(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.locationInfo.datanodeip)
+  return _impl_.datanodeip_.Mutable(index);
+}
+inline void locationInfo::set_datanodeip(int index, const std::string& value) {
+  _impl_.datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.datanodeip)
+}
+inline void locationInfo::set_datanodeip(int index, std::string&& value) {
+  _impl_.datanodeip_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.datanodeip)
+}
+inline void locationInfo::set_datanodeip(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.locationInfo.datanodeip)
+}
+inline void locationInfo::set_datanodeip(int index, const char* value, size_t size) {
+  _impl_.datanodeip_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.locationInfo.datanodeip)
+}
+inline std::string* locationInfo::_internal_add_datanodeip() {
+  return _impl_.datanodeip_.Add();
+}
+inline void locationInfo::add_datanodeip(const std::string& value) {
+  _impl_.datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.datanodeip)
+}
+inline void locationInfo::add_datanodeip(std::string&& value) {
+  _impl_.datanodeip_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.datanodeip)
+}
+inline void locationInfo::add_datanodeip(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.locationInfo.datanodeip)
+}
+inline void locationInfo::add_datanodeip(const char* value, size_t size) {
+  _impl_.datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.locationInfo.datanodeip)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+locationInfo::datanodeip() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.datanodeip)
+  return _impl_.datanodeip_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+locationInfo::mutable_datanodeip() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.datanodeip)
+  return &_impl_.datanodeip_;
+}
+
+// repeated int32 datanodeport = 5;
+inline int locationInfo::_internal_datanodeport_size() const {
+  return _impl_.datanodeport_.size();
+}
+inline int locationInfo::datanodeport_size() const {
+  return _internal_datanodeport_size();
+}
+inline void locationInfo::clear_datanodeport() {
+  _impl_.datanodeport_.Clear();
+}
+inline int32_t locationInfo::_internal_datanodeport(int index) const {
+  return _impl_.datanodeport_.Get(index);
+}
+inline int32_t locationInfo::datanodeport(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.datanodeport)
+  return _internal_datanodeport(index);
+}
+inline void locationInfo::set_datanodeport(int index, int32_t value) {
+  _impl_.datanodeport_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.datanodeport)
+}
+inline void locationInfo::_internal_add_datanodeport(int32_t value) {
+  _impl_.datanodeport_.Add(value);
+}
+inline void locationInfo::add_datanodeport(int32_t value) {
+  _internal_add_datanodeport(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.datanodeport)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+locationInfo::_internal_datanodeport() const {
+  return _impl_.datanodeport_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+locationInfo::datanodeport() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.datanodeport)
+  return _internal_datanodeport();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+locationInfo::_internal_mutable_datanodeport() {
+  return &_impl_.datanodeport_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+locationInfo::mutable_datanodeport() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.datanodeport)
+  return _internal_mutable_datanodeport();
+}
+
+// repeated string blockkeys = 6;
+inline int locationInfo::_internal_blockkeys_size() const {
+  return _impl_.blockkeys_.size();
+}
+inline int locationInfo::blockkeys_size() const {
+  return _internal_blockkeys_size();
+}
+inline void locationInfo::clear_blockkeys() {
+  _impl_.blockkeys_.Clear();
+}
+inline std::string* locationInfo::add_blockkeys() {
+  std::string* _s = _internal_add_blockkeys();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.locationInfo.blockkeys)
+  return _s;
+}
+inline const std::string& locationInfo::_internal_blockkeys(int index) const {
+  return _impl_.blockkeys_.Get(index);
+}
+inline const std::string& locationInfo::blockkeys(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.blockkeys)
+  return _internal_blockkeys(index);
+}
+inline std::string* locationInfo::mutable_blockkeys(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.locationInfo.blockkeys)
+  return _impl_.blockkeys_.Mutable(index);
+}
+inline void locationInfo::set_blockkeys(int index, const std::string& value) {
+  _impl_.blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.blockkeys)
+}
+inline void locationInfo::set_blockkeys(int index, std::string&& value) {
+  _impl_.blockkeys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.blockkeys)
+}
+inline void locationInfo::set_blockkeys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.locationInfo.blockkeys)
+}
+inline void locationInfo::set_blockkeys(int index, const char* value, size_t size) {
+  _impl_.blockkeys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.locationInfo.blockkeys)
+}
+inline std::string* locationInfo::_internal_add_blockkeys() {
+  return _impl_.blockkeys_.Add();
+}
+inline void locationInfo::add_blockkeys(const std::string& value) {
+  _impl_.blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.blockkeys)
+}
+inline void locationInfo::add_blockkeys(std::string&& value) {
+  _impl_.blockkeys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.blockkeys)
+}
+inline void locationInfo::add_blockkeys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.locationInfo.blockkeys)
+}
+inline void locationInfo::add_blockkeys(const char* value, size_t size) {
+  _impl_.blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.locationInfo.blockkeys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+locationInfo::blockkeys() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.blockkeys)
+  return _impl_.blockkeys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+locationInfo::mutable_blockkeys() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.blockkeys)
+  return &_impl_.blockkeys_;
+}
+
+// repeated int32 blockids = 7;
+inline int locationInfo::_internal_blockids_size() const {
+  return _impl_.blockids_.size();
+}
+inline int locationInfo::blockids_size() const {
+  return _internal_blockids_size();
+}
+inline void locationInfo::clear_blockids() {
+  _impl_.blockids_.Clear();
+}
+inline int32_t locationInfo::_internal_blockids(int index) const {
+  return _impl_.blockids_.Get(index);
+}
+inline int32_t locationInfo::blockids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.blockids)
+  return _internal_blockids(index);
+}
+inline void locationInfo::set_blockids(int index, int32_t value) {
+  _impl_.blockids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.blockids)
+}
+inline void locationInfo::_internal_add_blockids(int32_t value) {
+  _impl_.blockids_.Add(value);
+}
+inline void locationInfo::add_blockids(int32_t value) {
+  _internal_add_blockids(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.blockids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+locationInfo::_internal_blockids() const {
+  return _impl_.blockids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+locationInfo::blockids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.blockids)
+  return _internal_blockids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+locationInfo::_internal_mutable_blockids() {
+  return &_impl_.blockids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+locationInfo::mutable_blockids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.blockids)
+  return _internal_mutable_blockids();
+}
+
+// repeated int32 groupids = 8;
+inline int locationInfo::_internal_groupids_size() const {
+  return _impl_.groupids_.size();
+}
+inline int locationInfo::groupids_size() const {
+  return _internal_groupids_size();
+}
+inline void locationInfo::clear_groupids() {
+  _impl_.groupids_.Clear();
+}
+inline int32_t locationInfo::_internal_groupids(int index) const {
+  return _impl_.groupids_.Get(index);
+}
+inline int32_t locationInfo::groupids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.groupids)
+  return _internal_groupids(index);
+}
+inline void locationInfo::set_groupids(int index, int32_t value) {
+  _impl_.groupids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.groupids)
+}
+inline void locationInfo::_internal_add_groupids(int32_t value) {
+  _impl_.groupids_.Add(value);
+}
+inline void locationInfo::add_groupids(int32_t value) {
+  _internal_add_groupids(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.groupids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+locationInfo::_internal_groupids() const {
+  return _impl_.groupids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+locationInfo::groupids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.groupids)
+  return _internal_groupids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+locationInfo::_internal_mutable_groupids() {
+  return &_impl_.groupids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+locationInfo::mutable_groupids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.groupids)
+  return _internal_mutable_groupids();
+}
+
+// -------------------------------------------------------------------
+
+// mainRecalPlan
+
+// bool type = 1;
+inline void mainRecalPlan::clear_type() {
+  _impl_.type_ = false;
+}
+inline bool mainRecalPlan::_internal_type() const {
+  return _impl_.type_;
+}
+inline bool mainRecalPlan::type() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.type)
+  return _internal_type();
+}
+inline void mainRecalPlan::_internal_set_type(bool value) {
+  
+  _impl_.type_ = value;
+}
+inline void mainRecalPlan::set_type(bool value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.type)
+}
+
+// bool if_partial_decoding = 2;
+inline void mainRecalPlan::clear_if_partial_decoding() {
+  _impl_.if_partial_decoding_ = false;
+}
+inline bool mainRecalPlan::_internal_if_partial_decoding() const {
+  return _impl_.if_partial_decoding_;
+}
+inline bool mainRecalPlan::if_partial_decoding() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.if_partial_decoding)
+  return _internal_if_partial_decoding();
+}
+inline void mainRecalPlan::_internal_set_if_partial_decoding(bool value) {
+  
+  _impl_.if_partial_decoding_ = value;
+}
+inline void mainRecalPlan::set_if_partial_decoding(bool value) {
+  _internal_set_if_partial_decoding(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.if_partial_decoding)
+}
+
+// repeated .proxy_proto.locationInfo clusters = 3;
+inline int mainRecalPlan::_internal_clusters_size() const {
+  return _impl_.clusters_.size();
+}
+inline int mainRecalPlan::clusters_size() const {
+  return _internal_clusters_size();
+}
+inline void mainRecalPlan::clear_clusters() {
+  _impl_.clusters_.Clear();
+}
+inline ::proxy_proto::locationInfo* mainRecalPlan::mutable_clusters(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.mainRecalPlan.clusters)
+  return _impl_.clusters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::locationInfo >*
+mainRecalPlan::mutable_clusters() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.clusters)
+  return &_impl_.clusters_;
+}
+inline const ::proxy_proto::locationInfo& mainRecalPlan::_internal_clusters(int index) const {
+  return _impl_.clusters_.Get(index);
+}
+inline const ::proxy_proto::locationInfo& mainRecalPlan::clusters(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.clusters)
+  return _internal_clusters(index);
+}
+inline ::proxy_proto::locationInfo* mainRecalPlan::_internal_add_clusters() {
+  return _impl_.clusters_.Add();
+}
+inline ::proxy_proto::locationInfo* mainRecalPlan::add_clusters() {
+  ::proxy_proto::locationInfo* _add = _internal_add_clusters();
+  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.clusters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::locationInfo >&
+mainRecalPlan::clusters() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.clusters)
+  return _impl_.clusters_;
+}
+
+// repeated string p_datanodeip = 4;
+inline int mainRecalPlan::_internal_p_datanodeip_size() const {
+  return _impl_.p_datanodeip_.size();
+}
+inline int mainRecalPlan::p_datanodeip_size() const {
+  return _internal_p_datanodeip_size();
+}
+inline void mainRecalPlan::clear_p_datanodeip() {
+  _impl_.p_datanodeip_.Clear();
+}
+inline std::string* mainRecalPlan::add_p_datanodeip() {
+  std::string* _s = _internal_add_p_datanodeip();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.mainRecalPlan.p_datanodeip)
+  return _s;
+}
+inline const std::string& mainRecalPlan::_internal_p_datanodeip(int index) const {
+  return _impl_.p_datanodeip_.Get(index);
+}
+inline const std::string& mainRecalPlan::p_datanodeip(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.p_datanodeip)
+  return _internal_p_datanodeip(index);
+}
+inline std::string* mainRecalPlan::mutable_p_datanodeip(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.mainRecalPlan.p_datanodeip)
+  return _impl_.p_datanodeip_.Mutable(index);
+}
+inline void mainRecalPlan::set_p_datanodeip(int index, const std::string& value) {
+  _impl_.p_datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_datanodeip)
 }
-inline void locationInfo::set_proxy_port(int32_t value) {
-  _internal_set_proxy_port(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.proxy_port)
+inline void mainRecalPlan::set_p_datanodeip(int index, std::string&& value) {
+  _impl_.p_datanodeip_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_datanodeip)
+}
+inline void mainRecalPlan::set_p_datanodeip(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.p_datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.mainRecalPlan.p_datanodeip)
+}
+inline void mainRecalPlan::set_p_datanodeip(int index, const char* value, size_t size) {
+  _impl_.p_datanodeip_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.mainRecalPlan.p_datanodeip)
+}
+inline std::string* mainRecalPlan::_internal_add_p_datanodeip() {
+  return _impl_.p_datanodeip_.Add();
+}
+inline void mainRecalPlan::add_p_datanodeip(const std::string& value) {
+  _impl_.p_datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_datanodeip)
+}
+inline void mainRecalPlan::add_p_datanodeip(std::string&& value) {
+  _impl_.p_datanodeip_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_datanodeip)
+}
+inline void mainRecalPlan::add_p_datanodeip(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.p_datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.mainRecalPlan.p_datanodeip)
+}
+inline void mainRecalPlan::add_p_datanodeip(const char* value, size_t size) {
+  _impl_.p_datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.mainRecalPlan.p_datanodeip)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+mainRecalPlan::p_datanodeip() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.p_datanodeip)
+  return _impl_.p_datanodeip_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+mainRecalPlan::mutable_p_datanodeip() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.p_datanodeip)
+  return &_impl_.p_datanodeip_;
 }
 
-// repeated string datanodeip = 4;
-inline int locationInfo::_internal_datanodeip_size() const {
-  return _impl_.datanodeip_.size();
+// repeated int32 p_datanodeport = 5;
+inline int mainRecalPlan::_internal_p_datanodeport_size() const {
+  return _impl_.p_datanodeport_.size();
+}
+inline int mainRecalPlan::p_datanodeport_size() const {
+  return _internal_p_datanodeport_size();
+}
+inline void mainRecalPlan::clear_p_datanodeport() {
+  _impl_.p_datanodeport_.Clear();
+}
+inline int32_t mainRecalPlan::_internal_p_datanodeport(int index) const {
+  return _impl_.p_datanodeport_.Get(index);
+}
+inline int32_t mainRecalPlan::p_datanodeport(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.p_datanodeport)
+  return _internal_p_datanodeport(index);
+}
+inline void mainRecalPlan::set_p_datanodeport(int index, int32_t value) {
+  _impl_.p_datanodeport_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_datanodeport)
+}
+inline void mainRecalPlan::_internal_add_p_datanodeport(int32_t value) {
+  _impl_.p_datanodeport_.Add(value);
+}
+inline void mainRecalPlan::add_p_datanodeport(int32_t value) {
+  _internal_add_p_datanodeport(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_datanodeport)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+mainRecalPlan::_internal_p_datanodeport() const {
+  return _impl_.p_datanodeport_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+mainRecalPlan::p_datanodeport() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.p_datanodeport)
+  return _internal_p_datanodeport();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+mainRecalPlan::_internal_mutable_p_datanodeport() {
+  return &_impl_.p_datanodeport_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+mainRecalPlan::mutable_p_datanodeport() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.p_datanodeport)
+  return _internal_mutable_p_datanodeport();
+}
+
+// repeated string p_blockkeys = 6;
+inline int mainRecalPlan::_internal_p_blockkeys_size() const {
+  return _impl_.p_blockkeys_.size();
+}
+inline int mainRecalPlan::p_blockkeys_size() const {
+  return _internal_p_blockkeys_size();
+}
+inline void mainRecalPlan::clear_p_blockkeys() {
+  _impl_.p_blockkeys_.Clear();
+}
+inline std::string* mainRecalPlan::add_p_blockkeys() {
+  std::string* _s = _internal_add_p_blockkeys();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.mainRecalPlan.p_blockkeys)
+  return _s;
+}
+inline const std::string& mainRecalPlan::_internal_p_blockkeys(int index) const {
+  return _impl_.p_blockkeys_.Get(index);
+}
+inline const std::string& mainRecalPlan::p_blockkeys(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.p_blockkeys)
+  return _internal_p_blockkeys(index);
+}
+inline std::string* mainRecalPlan::mutable_p_blockkeys(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.mainRecalPlan.p_blockkeys)
+  return _impl_.p_blockkeys_.Mutable(index);
+}
+inline void mainRecalPlan::set_p_blockkeys(int index, const std::string& value) {
+  _impl_.p_blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_blockkeys)
+}
+inline void mainRecalPlan::set_p_blockkeys(int index, std::string&& value) {
+  _impl_.p_blockkeys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_blockkeys)
+}
+inline void mainRecalPlan::set_p_blockkeys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.p_blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.mainRecalPlan.p_blockkeys)
+}
+inline void mainRecalPlan::set_p_blockkeys(int index, const char* value, size_t size) {
+  _impl_.p_blockkeys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.mainRecalPlan.p_blockkeys)
+}
+inline std::string* mainRecalPlan::_internal_add_p_blockkeys() {
+  return _impl_.p_blockkeys_.Add();
+}
+inline void mainRecalPlan::add_p_blockkeys(const std::string& value) {
+  _impl_.p_blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_blockkeys)
+}
+inline void mainRecalPlan::add_p_blockkeys(std::string&& value) {
+  _impl_.p_blockkeys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_blockkeys)
+}
+inline void mainRecalPlan::add_p_blockkeys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.p_blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.mainRecalPlan.p_blockkeys)
+}
+inline void mainRecalPlan::add_p_blockkeys(const char* value, size_t size) {
+  _impl_.p_blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.mainRecalPlan.p_blockkeys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+mainRecalPlan::p_blockkeys() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.p_blockkeys)
+  return _impl_.p_blockkeys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+mainRecalPlan::mutable_p_blockkeys() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.p_blockkeys)
+  return &_impl_.p_blockkeys_;
+}
+
+// int32 k = 7;
+inline void mainRecalPlan::clear_k() {
+  _impl_.k_ = 0;
+}
+inline int32_t mainRecalPlan::_internal_k() const {
+  return _impl_.k_;
+}
+inline int32_t mainRecalPlan::k() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.k)
+  return _internal_k();
+}
+inline void mainRecalPlan::_internal_set_k(int32_t value) {
+  
+  _impl_.k_ = value;
+}
+inline void mainRecalPlan::set_k(int32_t value) {
+  _internal_set_k(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.k)
+}
+
+// int32 l = 8;
+inline void mainRecalPlan::clear_l() {
+  _impl_.l_ = 0;
+}
+inline int32_t mainRecalPlan::_internal_l() const {
+  return _impl_.l_;
+}
+inline int32_t mainRecalPlan::l() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.l)
+  return _internal_l();
+}
+inline void mainRecalPlan::_internal_set_l(int32_t value) {
+  
+  _impl_.l_ = value;
+}
+inline void mainRecalPlan::set_l(int32_t value) {
+  _internal_set_l(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.l)
+}
+
+// int32 g_m = 9;
+inline void mainRecalPlan::clear_g_m() {
+  _impl_.g_m_ = 0;
+}
+inline int32_t mainRecalPlan::_internal_g_m() const {
+  return _impl_.g_m_;
+}
+inline int32_t mainRecalPlan::g_m() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.g_m)
+  return _internal_g_m();
+}
+inline void mainRecalPlan::_internal_set_g_m(int32_t value) {
+  
+  _impl_.g_m_ = value;
+}
+inline void mainRecalPlan::set_g_m(int32_t value) {
+  _internal_set_g_m(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.g_m)
+}
+
+// int32 block_size = 10;
+inline void mainRecalPlan::clear_block_size() {
+  _impl_.block_size_ = 0;
+}
+inline int32_t mainRecalPlan::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline int32_t mainRecalPlan::block_size() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.block_size)
+  return _internal_block_size();
+}
+inline void mainRecalPlan::_internal_set_block_size(int32_t value) {
+  
+  _impl_.block_size_ = value;
+}
+inline void mainRecalPlan::set_block_size(int32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.block_size)
+}
+
+// int32 encodetype = 11;
+inline void mainRecalPlan::clear_encodetype() {
+  _impl_.encodetype_ = 0;
+}
+inline int32_t mainRecalPlan::_internal_encodetype() const {
+  return _impl_.encodetype_;
 }
-inline int locationInfo::datanodeip_size() const {
-  return _internal_datanodeip_size();
+inline int32_t mainRecalPlan::encodetype() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.encodetype)
+  return _internal_encodetype();
 }
-inline void locationInfo::clear_datanodeip() {
-  _impl_.datanodeip_.Clear();
+inline void mainRecalPlan::_internal_set_encodetype(int32_t value) {
+  
+  _impl_.encodetype_ = value;
 }
-inline std::string* locationInfo::add_datanodeip() {
-  std::string* _s = _internal_add_datanodeip();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.locationInfo.datanodeip)
-  return _s;
+inline void mainRecalPlan::set_encodetype(int32_t value) {
+  _internal_set_encodetype(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.encodetype)
 }
-inline const std::string& locationInfo::_internal_datanodeip(int index) const {
-  return _impl_.datanodeip_.Get(index);
+
+// int32 stripe_id = 12;
+inline void mainRecalPlan::clear_stripe_id() {
+  _impl_.stripe_id_ = 0;
 }
-inline const std::string& locationInfo::datanodeip(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.datanodeip)
-  return _internal_datanodeip(index);
+inline int32_t mainRecalPlan::_internal_stripe_id() const {
+  return _impl_.stripe_id_;
 }
-inline std::string* locationInfo::mutable_datanodeip(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.locationInfo.datanodeip)
-  return _impl_.datanodeip_.Mutable(index);
+inline int32_t mainRecalPlan::stripe_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.stripe_id)
+  return _internal_stripe_id();
 }
-inline void locationInfo::set_datanodeip(int index, const std::string& value) {
-  _impl_.datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.datanodeip)
+inline void mainRecalPlan::_internal_set_stripe_id(int32_t value) {
+  
+  _impl_.stripe_id_ = value;
 }
-inline void locationInfo::set_datanodeip(int index, std::string&& value) {
-  _impl_.datanodeip_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.datanodeip)
+inline void mainRecalPlan::set_stripe_id(int32_t value) {
+  _internal_set_stripe_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.stripe_id)
 }
-inline void locationInfo::set_datanodeip(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.locationInfo.datanodeip)
+
+// int32 group_id = 13;
+inline void mainRecalPlan::clear_group_id() {
+  _impl_.group_id_ = 0;
 }
-inline void locationInfo::set_datanodeip(int index, const char* value, size_t size) {
-  _impl_.datanodeip_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.locationInfo.datanodeip)
+inline int32_t mainRecalPlan::_internal_group_id() const {
+  return _impl_.group_id_;
 }
-inline std::string* locationInfo::_internal_add_datanodeip() {
-  return _impl_.datanodeip_.Add();
+inline int32_t mainRecalPlan::group_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.group_id)
+  return _internal_group_id();
 }
-inline void locationInfo::add_datanodeip(const std::string& value) {
-  _impl_.datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.datanodeip)
+inline void mainRecalPlan::_internal_set_group_id(int32_t value) {
+  
+  _impl_.group_id_ = value;
 }
-inline void locationInfo::add_datanodeip(std::string&& value) {
-  _impl_.datanodeip_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.datanodeip)
+inline void mainRecalPlan::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.group_id)
 }
-inline void locationInfo::add_datanodeip(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.locationInfo.datanodeip)
+
+// bool if_fused = 14;
+inline void mainRecalPlan::clear_if_fused() {
+  _impl_.if_fused_ = false;
 }
-inline void locationInfo::add_datanodeip(const char* value, size_t size) {
-  _impl_.datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.locationInfo.datanodeip)
+inline bool mainRecalPlan::_internal_if_fused() const {
+  return _impl_.if_fused_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-locationInfo::datanodeip() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.datanodeip)
-  return _impl_.datanodeip_;
+inline bool mainRecalPlan::if_fused() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.if_fused)
+  return _internal_if_fused();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-locationInfo::mutable_datanodeip() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.datanodeip)
-  return &_impl_.datanodeip_;
+inline void mainRecalPlan::_internal_set_if_fused(bool value) {
+  
+  _impl_.if_fused_ = value;
+}
+inline void mainRecalPlan::set_if_fused(bool value) {
+  _internal_set_if_fused(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.if_fused)
 }
 
-// repeated int32 datanodeport = 5;
-inline int locationInfo::_internal_datanodeport_size() const {
-  return _impl_.datanodeport_.size();
+// repeated int32 p_blockids = 15;
+inline int mainRecalPlan::_internal_p_blockids_size() const {
+  return _impl_.p_blockids_.size();
 }
-inline int locationInfo::datanodeport_size() const {
-  return _internal_datanodeport_size();
+inline int mainRecalPlan::p_blockids_size() const {
+  return _internal_p_blockids_size();
 }
-inline void locationInfo::clear_datanodeport() {
-  _impl_.datanodeport_.Clear();
+inline void mainRecalPlan::clear_p_blockids() {
+  _impl_.p_blockids_.Clear();
 }
-inline int32_t locationInfo::_internal_datanodeport(int index) const {
-  return _impl_.datanodeport_.Get(index);
+inline int32_t mainRecalPlan::_internal_p_blockids(int index) const {
+  return _impl_.p_blockids_.Get(index);
 }
-inline int32_t locationInfo::datanodeport(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.datanodeport)
-  return _internal_datanodeport(index);
+inline int32_t mainRecalPlan::p_blockids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.p_blockids)
+  return _internal_p_blockids(index);
 }
-inline void locationInfo::set_datanodeport(int index, int32_t value) {
-  _impl_.datanodeport_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.datanodeport)
+inline void mainRecalPlan::set_p_blockids(int index, int32_t value) {
+  _impl_.p_blockids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_blockids)
 }
-inline void locationInfo::_internal_add_datanodeport(int32_t value) {
-  _impl_.datanodeport_.Add(value);
+inline void mainRecalPlan::_internal_add_p_blockids(int32_t value) {
+  _impl_.p_blockids_.Add(value);
 }
-inline void locationInfo::add_datanodeport(int32_t value) {
-  _internal_add_datanodeport(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.datanodeport)
+inline void mainRecalPlan::add_p_blockids(int32_t value) {
+  _internal_add_p_blockids(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_blockids)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-locationInfo::_internal_datanodeport() const {
-  return _impl_.datanodeport_;
+mainRecalPlan::_internal_p_blockids() const {
+  return _impl_.p_blockids_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-locationInfo::datanodeport() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.datanodeport)
-  return _internal_datanodeport();
+mainRecalPlan::p_blockids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.p_blockids)
+  return _internal_p_blockids();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-locationInfo::_internal_mutable_datanodeport() {
-  return &_impl_.datanodeport_;
+mainRecalPlan::_internal_mutable_p_blockids() {
+  return &_impl_.p_blockids_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-locationInfo::mutable_datanodeport() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.datanodeport)
-  return _internal_mutable_datanodeport();
+mainRecalPlan::mutable_p_blockids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.p_blockids)
+  return _internal_mutable_p_blockids();
 }
 
-// repeated string blockkeys = 6;
-inline int locationInfo::_internal_blockkeys_size() const {
-  return _impl_.blockkeys_.size();
-}
-inline int locationInfo::blockkeys_size() const {
-  return _internal_blockkeys_size();
-}
-inline void locationInfo::clear_blockkeys() {
-  _impl_.blockkeys_.Clear();
-}
-inline std::string* locationInfo::add_blockkeys() {
-  std::string* _s = _internal_add_blockkeys();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.locationInfo.blockkeys)
-  return _s;
-}
-inline const std::string& locationInfo::_internal_blockkeys(int index) const {
-  return _impl_.blockkeys_.Get(index);
+// int32 task_id = 16;
+inline void mainRecalPlan::clear_task_id() {
+  _impl_.task_id_ = 0;
 }
-inline const std::string& locationInfo::blockkeys(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.blockkeys)
-  return _internal_blockkeys(index);
+inline int32_t mainRecalPlan::_internal_task_id() const {
+  return _impl_.task_id_;
 }
-inline std::string* locationInfo::mutable_blockkeys(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.locationInfo.blockkeys)
-  return _impl_.blockkeys_.Mutable(index);
+inline int32_t mainRecalPlan::task_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.task_id)
+  return _internal_task_id();
 }
-inline void locationInfo::set_blockkeys(int index, const std::string& value) {
-  _impl_.blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.blockkeys)
+inline void mainRecalPlan::_internal_set_task_id(int32_t value) {
+  
+  _impl_.task_id_ = value;
 }
-inline void locationInfo::set_blockkeys(int index, std::string&& value) {
-  _impl_.blockkeys_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.blockkeys)
+inline void mainRecalPlan::set_task_id(int32_t value) {
+  _internal_set_task_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.task_id)
 }
-inline void locationInfo::set_blockkeys(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.locationInfo.blockkeys)
+
+// -------------------------------------------------------------------
+
+// RecalReply
+
+// string result = 1;
+inline void RecalReply::clear_result() {
+  _impl_.result_.ClearToEmpty();
 }
-inline void locationInfo::set_blockkeys(int index, const char* value, size_t size) {
-  _impl_.blockkeys_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.locationInfo.blockkeys)
+inline const std::string& RecalReply::result() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.RecalReply.result)
+  return _internal_result();
 }
-inline std::string* locationInfo::_internal_add_blockkeys() {
-  return _impl_.blockkeys_.Add();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecalReply::set_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.RecalReply.result)
 }
-inline void locationInfo::add_blockkeys(const std::string& value) {
-  _impl_.blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.blockkeys)
+inline std::string* RecalReply::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.RecalReply.result)
+  return _s;
 }
-inline void locationInfo::add_blockkeys(std::string&& value) {
-  _impl_.blockkeys_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.blockkeys)
+inline const std::string& RecalReply::_internal_result() const {
+  return _impl_.result_.Get();
 }
-inline void locationInfo::add_blockkeys(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.locationInfo.blockkeys)
+inline void RecalReply::_internal_set_result(const std::string& value) {
+  
+  _impl_.result_.Set(value, GetArenaForAllocation());
 }
-inline void locationInfo::add_blockkeys(const char* value, size_t size) {
-  _impl_.blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.locationInfo.blockkeys)
+inline std::string* RecalReply::_internal_mutable_result() {
+  
+  return _impl_.result_.Mutable(GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-locationInfo::blockkeys() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.blockkeys)
-  return _impl_.blockkeys_;
+inline std::string* RecalReply::release_result() {
+  // @@protoc_insertion_point(field_release:proxy_proto.RecalReply.result)
+  return _impl_.result_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-locationInfo::mutable_blockkeys() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.blockkeys)
-  return &_impl_.blockkeys_;
+inline void RecalReply::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.RecalReply.result)
 }
 
-// repeated int32 blockids = 7;
-inline int locationInfo::_internal_blockids_size() const {
-  return _impl_.blockids_.size();
-}
-inline int locationInfo::blockids_size() const {
-  return _internal_blockids_size();
-}
-inline void locationInfo::clear_blockids() {
-  _impl_.blockids_.Clear();
+// -------------------------------------------------------------------
+
+// RecalPort
+
+// int32 task_id = 1;
+inline void RecalPort::clear_task_id() {
+  _impl_.task_id_ = 0;
 }
-inline int32_t locationInfo::_internal_blockids(int index) const {
-  return _impl_.blockids_.Get(index);
+inline int32_t RecalPort::_internal_task_id() const {
+  return _impl_.task_id_;
 }
-inline int32_t locationInfo::blockids(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.locationInfo.blockids)
-  return _internal_blockids(index);
+inline int32_t RecalPort::task_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.RecalPort.task_id)
+  return _internal_task_id();
 }
-inline void locationInfo::set_blockids(int index, int32_t value) {
-  _impl_.blockids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.locationInfo.blockids)
+inline void RecalPort::_internal_set_task_id(int32_t value) {
+  
+  _impl_.task_id_ = value;
 }
-inline void locationInfo::_internal_add_blockids(int32_t value) {
-  _impl_.blockids_.Add(value);
+inline void RecalPort::set_task_id(int32_t value) {
+  _internal_set_task_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.RecalPort.task_id)
 }
-inline void locationInfo::add_blockids(int32_t value) {
-  _internal_add_blockids(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.locationInfo.blockids)
+
+// int32 port = 2;
+inline void RecalPort::clear_port() {
+  _impl_.port_ = 0;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-locationInfo::_internal_blockids() const {
-  return _impl_.blockids_;
+inline int32_t RecalPort::_internal_port() const {
+  return _impl_.port_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-locationInfo::blockids() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.locationInfo.blockids)
-  return _internal_blockids();
+inline int32_t RecalPort::port() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.RecalPort.port)
+  return _internal_port();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-locationInfo::_internal_mutable_blockids() {
-  return &_impl_.blockids_;
+inline void RecalPort::_internal_set_port(int32_t value) {
+  
+  _impl_.port_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-locationInfo::mutable_blockids() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.locationInfo.blockids)
-  return _internal_mutable_blockids();
+inline void RecalPort::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.RecalPort.port)
 }
 
 // -------------------------------------------------------------------
 
-// mainRecalPlan
+// helpRecalPlan
 
 // bool type = 1;
-inline void mainRecalPlan::clear_type() {
+inline void helpRecalPlan::clear_type() {
   _impl_.type_ = false;
 }
-inline bool mainRecalPlan::_internal_type() const {
+inline bool helpRecalPlan::_internal_type() const {
   return _impl_.type_;
 }
-inline bool mainRecalPlan::type() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.type)
+inline bool helpRecalPlan::type() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.type)
   return _internal_type();
 }
-inline void mainRecalPlan::_internal_set_type(bool value) {
+inline void helpRecalPlan::_internal_set_type(bool value) {
   
   _impl_.type_ = value;
 }
-inline void mainRecalPlan::set_type(bool value) {
+inline void helpRecalPlan::set_type(bool value) {
   _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.type)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.type)
 }
 
 // bool if_partial_decoding = 2;
-inline void mainRecalPlan::clear_if_partial_decoding() {
+inline void helpRecalPlan::clear_if_partial_decoding() {
   _impl_.if_partial_decoding_ = false;
 }
-inline bool mainRecalPlan::_internal_if_partial_decoding() const {
+inline bool helpRecalPlan::_internal_if_partial_decoding() const {
   return _impl_.if_partial_decoding_;
 }
-inline bool mainRecalPlan::if_partial_decoding() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.if_partial_decoding)
+inline bool helpRecalPlan::if_partial_decoding() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.if_partial_decoding)
   return _internal_if_partial_decoding();
 }
-inline void mainRecalPlan::_internal_set_if_partial_decoding(bool value) {
+inline void helpRecalPlan::_internal_set_if_partial_decoding(bool value) {
   
   _impl_.if_partial_decoding_ = value;
 }
-inline void mainRecalPlan::set_if_partial_decoding(bool value) {
+inline void helpRecalPlan::set_if_partial_decoding(bool value) {
   _internal_set_if_partial_decoding(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.if_partial_decoding)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.if_partial_decoding)
 }
 
-// repeated .proxy_proto.locationInfo clusters = 3;
-inline int mainRecalPlan::_internal_clusters_size() const {
-  return _impl_.clusters_.size();
+// string mainproxyip = 3;
+inline void helpRecalPlan::clear_mainproxyip() {
+  _impl_.mainproxyip_.ClearToEmpty();
 }
-inline int mainRecalPlan::clusters_size() const {
-  return _internal_clusters_size();
+inline const std::string& helpRecalPlan::mainproxyip() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.mainproxyip)
+  return _internal_mainproxyip();
 }
-inline void mainRecalPlan::clear_clusters() {
-  _impl_.clusters_.Clear();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void helpRecalPlan::set_mainproxyip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mainproxyip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.mainproxyip)
 }
-inline ::proxy_proto::locationInfo* mainRecalPlan::mutable_clusters(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.mainRecalPlan.clusters)
-  return _impl_.clusters_.Mutable(index);
+inline std::string* helpRecalPlan::mutable_mainproxyip() {
+  std::string* _s = _internal_mutable_mainproxyip();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.helpRecalPlan.mainproxyip)
+  return _s;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::locationInfo >*
-mainRecalPlan::mutable_clusters() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.clusters)
-  return &_impl_.clusters_;
+inline const std::string& helpRecalPlan::_internal_mainproxyip() const {
+  return _impl_.mainproxyip_.Get();
 }
-inline const ::proxy_proto::locationInfo& mainRecalPlan::_internal_clusters(int index) const {
-  return _impl_.clusters_.Get(index);
+inline void helpRecalPlan::_internal_set_mainproxyip(const std::string& value) {
+  
+  _impl_.mainproxyip_.Set(value, GetArenaForAllocation());
 }
-inline const ::proxy_proto::locationInfo& mainRecalPlan::clusters(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.clusters)
-  return _internal_clusters(index);
+inline std::string* helpRecalPlan::_internal_mutable_mainproxyip() {
+  
+  return _impl_.mainproxyip_.Mutable(GetArenaForAllocation());
 }
-inline ::proxy_proto::locationInfo* mainRecalPlan::_internal_add_clusters() {
-  return _impl_.clusters_.Add();
+inline std::string* helpRecalPlan::release_mainproxyip() {
+  // @@protoc_insertion_point(field_release:proxy_proto.helpRecalPlan.mainproxyip)
+  return _impl_.mainproxyip_.Release();
 }
-inline ::proxy_proto::locationInfo* mainRecalPlan::add_clusters() {
-  ::proxy_proto::locationInfo* _add = _internal_add_clusters();
-  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.clusters)
-  return _add;
+inline void helpRecalPlan::set_allocated_mainproxyip(std::string* mainproxyip) {
+  if (mainproxyip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.mainproxyip_.SetAllocated(mainproxyip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mainproxyip_.IsDefault()) {
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.helpRecalPlan.mainproxyip)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::locationInfo >&
-mainRecalPlan::clusters() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.clusters)
-  return _impl_.clusters_;
+
+// int32 mainproxyport = 4;
+inline void helpRecalPlan::clear_mainproxyport() {
+  _impl_.mainproxyport_ = 0;
+}
+inline int32_t helpRecalPlan::_internal_mainproxyport() const {
+  return _impl_.mainproxyport_;
+}
+inline int32_t helpRecalPlan::mainproxyport() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.mainproxyport)
+  return _internal_mainproxyport();
+}
+inline void helpRecalPlan::_internal_set_mainproxyport(int32_t value) {
+  
+  _impl_.mainproxyport_ = value;
+}
+inline void helpRecalPlan::set_mainproxyport(int32_t value) {
+  _internal_set_mainproxyport(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.mainproxyport)
+}
+
+// repeated string datanodeip = 5;
+inline int helpRecalPlan::_internal_datanodeip_size() const {
+  return _impl_.datanodeip_.size();
+}
+inline int helpRecalPlan::datanodeip_size() const {
+  return _internal_datanodeip_size();
+}
+inline void helpRecalPlan::clear_datanodeip() {
+  _impl_.datanodeip_.Clear();
+}
+inline std::string* helpRecalPlan::add_datanodeip() {
+  std::string* _s = _internal_add_datanodeip();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.helpRecalPlan.datanodeip)
+  return _s;
+}
+inline const std::string& helpRecalPlan::_internal_datanodeip(int index) const {
+  return _impl_.datanodeip_.Get(index);
+}
+inline const std::string& helpRecalPlan::datanodeip(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.datanodeip)
+  return _internal_datanodeip(index);
+}
+inline std::string* helpRecalPlan::mutable_datanodeip(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.helpRecalPlan.datanodeip)
+  return _impl_.datanodeip_.Mutable(index);
+}
+inline void helpRecalPlan::set_datanodeip(int index, const std::string& value) {
+  _impl_.datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.datanodeip)
+}
+inline void helpRecalPlan::set_datanodeip(int index, std::string&& value) {
+  _impl_.datanodeip_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.datanodeip)
+}
+inline void helpRecalPlan::set_datanodeip(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.helpRecalPlan.datanodeip)
+}
+inline void helpRecalPlan::set_datanodeip(int index, const char* value, size_t size) {
+  _impl_.datanodeip_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.helpRecalPlan.datanodeip)
+}
+inline std::string* helpRecalPlan::_internal_add_datanodeip() {
+  return _impl_.datanodeip_.Add();
+}
+inline void helpRecalPlan::add_datanodeip(const std::string& value) {
+  _impl_.datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.datanodeip)
+}
+inline void helpRecalPlan::add_datanodeip(std::string&& value) {
+  _impl_.datanodeip_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.datanodeip)
+}
+inline void helpRecalPlan::add_datanodeip(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.helpRecalPlan.datanodeip)
+}
+inline void helpRecalPlan::add_datanodeip(const char* value, size_t size) {
+  _impl_.datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.helpRecalPlan.datanodeip)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+helpRecalPlan::datanodeip() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.datanodeip)
+  return _impl_.datanodeip_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+helpRecalPlan::mutable_datanodeip() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.datanodeip)
+  return &_impl_.datanodeip_;
+}
+
+// repeated int32 datanodeport = 6;
+inline int helpRecalPlan::_internal_datanodeport_size() const {
+  return _impl_.datanodeport_.size();
+}
+inline int helpRecalPlan::datanodeport_size() const {
+  return _internal_datanodeport_size();
+}
+inline void helpRecalPlan::clear_datanodeport() {
+  _impl_.datanodeport_.Clear();
+}
+inline int32_t helpRecalPlan::_internal_datanodeport(int index) const {
+  return _impl_.datanodeport_.Get(index);
+}
+inline int32_t helpRecalPlan::datanodeport(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.datanodeport)
+  return _internal_datanodeport(index);
+}
+inline void helpRecalPlan::set_datanodeport(int index, int32_t value) {
+  _impl_.datanodeport_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.datanodeport)
+}
+inline void helpRecalPlan::_internal_add_datanodeport(int32_t value) {
+  _impl_.datanodeport_.Add(value);
+}
+inline void helpRecalPlan::add_datanodeport(int32_t value) {
+  _internal_add_datanodeport(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.datanodeport)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+helpRecalPlan::_internal_datanodeport() const {
+  return _impl_.datanodeport_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+helpRecalPlan::datanodeport() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.datanodeport)
+  return _internal_datanodeport();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+helpRecalPlan::_internal_mutable_datanodeport() {
+  return &_impl_.datanodeport_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+helpRecalPlan::mutable_datanodeport() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.datanodeport)
+  return _internal_mutable_datanodeport();
 }
 
-// repeated string p_datanodeip = 4;
-inline int mainRecalPlan::_internal_p_datanodeip_size() const {
-  return _impl_.p_datanodeip_.size();
+// repeated string blockkeys = 7;
+inline int helpRecalPlan::_internal_blockkeys_size() const {
+  return _impl_.blockkeys_.size();
 }
-inline int mainRecalPlan::p_datanodeip_size() const {
-  return _internal_p_datanodeip_size();
+inline int helpRecalPlan::blockkeys_size() const {
+  return _internal_blockkeys_size();
 }
-inline void mainRecalPlan::clear_p_datanodeip() {
-  _impl_.p_datanodeip_.Clear();
+inline void helpRecalPlan::clear_blockkeys() {
+  _impl_.blockkeys_.Clear();
 }
-inline std::string* mainRecalPlan::add_p_datanodeip() {
-  std::string* _s = _internal_add_p_datanodeip();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.mainRecalPlan.p_datanodeip)
+inline std::string* helpRecalPlan::add_blockkeys() {
+  std::string* _s = _internal_add_blockkeys();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.helpRecalPlan.blockkeys)
   return _s;
 }
-inline const std::string& mainRecalPlan::_internal_p_datanodeip(int index) const {
-  return _impl_.p_datanodeip_.Get(index);
+inline const std::string& helpRecalPlan::_internal_blockkeys(int index) const {
+  return _impl_.blockkeys_.Get(index);
 }
-inline const std::string& mainRecalPlan::p_datanodeip(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.p_datanodeip)
-  return _internal_p_datanodeip(index);
+inline const std::string& helpRecalPlan::blockkeys(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.blockkeys)
+  return _internal_blockkeys(index);
 }
-inline std::string* mainRecalPlan::mutable_p_datanodeip(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.mainRecalPlan.p_datanodeip)
-  return _impl_.p_datanodeip_.Mutable(index);
+inline std::string* helpRecalPlan::mutable_blockkeys(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.helpRecalPlan.blockkeys)
+  return _impl_.blockkeys_.Mutable(index);
 }
-inline void mainRecalPlan::set_p_datanodeip(int index, const std::string& value) {
-  _impl_.p_datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_datanodeip)
+inline void helpRecalPlan::set_blockkeys(int index, const std::string& value) {
+  _impl_.blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.blockkeys)
 }
-inline void mainRecalPlan::set_p_datanodeip(int index, std::string&& value) {
-  _impl_.p_datanodeip_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_datanodeip)
+inline void helpRecalPlan::set_blockkeys(int index, std::string&& value) {
+  _impl_.blockkeys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.blockkeys)
 }
-inline void mainRecalPlan::set_p_datanodeip(int index, const char* value) {
+inline void helpRecalPlan::set_blockkeys(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.p_datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.mainRecalPlan.p_datanodeip)
+  _impl_.blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.helpRecalPlan.blockkeys)
 }
-inline void mainRecalPlan::set_p_datanodeip(int index, const char* value, size_t size) {
-  _impl_.p_datanodeip_.Mutable(index)->assign(
+inline void helpRecalPlan::set_blockkeys(int index, const char* value, size_t size) {
+  _impl_.blockkeys_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.mainRecalPlan.p_datanodeip)
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.helpRecalPlan.blockkeys)
 }
-inline std::string* mainRecalPlan::_internal_add_p_datanodeip() {
-  return _impl_.p_datanodeip_.Add();
+inline std::string* helpRecalPlan::_internal_add_blockkeys() {
+  return _impl_.blockkeys_.Add();
 }
-inline void mainRecalPlan::add_p_datanodeip(const std::string& value) {
-  _impl_.p_datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_datanodeip)
+inline void helpRecalPlan::add_blockkeys(const std::string& value) {
+  _impl_.blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.blockkeys)
 }
-inline void mainRecalPlan::add_p_datanodeip(std::string&& value) {
-  _impl_.p_datanodeip_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_datanodeip)
+inline void helpRecalPlan::add_blockkeys(std::string&& value) {
+  _impl_.blockkeys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.blockkeys)
 }
-inline void mainRecalPlan::add_p_datanodeip(const char* value) {
+inline void helpRecalPlan::add_blockkeys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.p_datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.mainRecalPlan.p_datanodeip)
+  _impl_.blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.helpRecalPlan.blockkeys)
 }
-inline void mainRecalPlan::add_p_datanodeip(const char* value, size_t size) {
-  _impl_.p_datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.mainRecalPlan.p_datanodeip)
+inline void helpRecalPlan::add_blockkeys(const char* value, size_t size) {
+  _impl_.blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.helpRecalPlan.blockkeys)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-mainRecalPlan::p_datanodeip() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.p_datanodeip)
-  return _impl_.p_datanodeip_;
+helpRecalPlan::blockkeys() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.blockkeys)
+  return _impl_.blockkeys_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-mainRecalPlan::mutable_p_datanodeip() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.p_datanodeip)
-  return &_impl_.p_datanodeip_;
+helpRecalPlan::mutable_blockkeys() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.blockkeys)
+  return &_impl_.blockkeys_;
 }
 
-// repeated int32 p_datanodeport = 5;
-inline int mainRecalPlan::_internal_p_datanodeport_size() const {
-  return _impl_.p_datanodeport_.size();
+// int32 block_size = 8;
+inline void helpRecalPlan::clear_block_size() {
+  _impl_.block_size_ = 0;
 }
-inline int mainRecalPlan::p_datanodeport_size() const {
-  return _internal_p_datanodeport_size();
+inline int32_t helpRecalPlan::_internal_block_size() const {
+  return _impl_.block_size_;
 }
-inline void mainRecalPlan::clear_p_datanodeport() {
-  _impl_.p_datanodeport_.Clear();
+inline int32_t helpRecalPlan::block_size() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.block_size)
+  return _internal_block_size();
 }
-inline int32_t mainRecalPlan::_internal_p_datanodeport(int index) const {
-  return _impl_.p_datanodeport_.Get(index);
+inline void helpRecalPlan::_internal_set_block_size(int32_t value) {
+  
+  _impl_.block_size_ = value;
 }
-inline int32_t mainRecalPlan::p_datanodeport(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.p_datanodeport)
-  return _internal_p_datanodeport(index);
+inline void helpRecalPlan::set_block_size(int32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.block_size)
 }
-inline void mainRecalPlan::set_p_datanodeport(int index, int32_t value) {
-  _impl_.p_datanodeport_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_datanodeport)
+
+// repeated int32 blockids = 9;
+inline int helpRecalPlan::_internal_blockids_size() const {
+  return _impl_.blockids_.size();
 }
-inline void mainRecalPlan::_internal_add_p_datanodeport(int32_t value) {
-  _impl_.p_datanodeport_.Add(value);
+inline int helpRecalPlan::blockids_size() const {
+  return _internal_blockids_size();
 }
-inline void mainRecalPlan::add_p_datanodeport(int32_t value) {
-  _internal_add_p_datanodeport(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_datanodeport)
+inline void helpRecalPlan::clear_blockids() {
+  _impl_.blockids_.Clear();
+}
+inline int32_t helpRecalPlan::_internal_blockids(int index) const {
+  return _impl_.blockids_.Get(index);
+}
+inline int32_t helpRecalPlan::blockids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.blockids)
+  return _internal_blockids(index);
+}
+inline void helpRecalPlan::set_blockids(int index, int32_t value) {
+  _impl_.blockids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.blockids)
+}
+inline void helpRecalPlan::_internal_add_blockids(int32_t value) {
+  _impl_.blockids_.Add(value);
+}
+inline void helpRecalPlan::add_blockids(int32_t value) {
+  _internal_add_blockids(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.blockids)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-mainRecalPlan::_internal_p_datanodeport() const {
-  return _impl_.p_datanodeport_;
+helpRecalPlan::_internal_blockids() const {
+  return _impl_.blockids_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-mainRecalPlan::p_datanodeport() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.p_datanodeport)
-  return _internal_p_datanodeport();
+helpRecalPlan::blockids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.blockids)
+  return _internal_blockids();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-mainRecalPlan::_internal_mutable_p_datanodeport() {
-  return &_impl_.p_datanodeport_;
+helpRecalPlan::_internal_mutable_blockids() {
+  return &_impl_.blockids_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-mainRecalPlan::mutable_p_datanodeport() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.p_datanodeport)
-  return _internal_mutable_p_datanodeport();
+helpRecalPlan::mutable_blockids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.blockids)
+  return _internal_mutable_blockids();
 }
 
-// repeated string p_blockkeys = 6;
-inline int mainRecalPlan::_internal_p_blockkeys_size() const {
-  return _impl_.p_blockkeys_.size();
+// int32 parity_num = 10;
+inline void helpRecalPlan::clear_parity_num() {
+  _impl_.parity_num_ = 0;
 }
-inline int mainRecalPlan::p_blockkeys_size() const {
-  return _internal_p_blockkeys_size();
+inline int32_t helpRecalPlan::_internal_parity_num() const {
+  return _impl_.parity_num_;
 }
-inline void mainRecalPlan::clear_p_blockkeys() {
-  _impl_.p_blockkeys_.Clear();
+inline int32_t helpRecalPlan::parity_num() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.parity_num)
+  return _internal_parity_num();
 }
-inline std::string* mainRecalPlan::add_p_blockkeys() {
-  std::string* _s = _internal_add_p_blockkeys();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.mainRecalPlan.p_blockkeys)
-  return _s;
+inline void helpRecalPlan::_internal_set_parity_num(int32_t value) {
+  
+  _impl_.parity_num_ = value;
 }
-inline const std::string& mainRecalPlan::_internal_p_blockkeys(int index) const {
-  return _impl_.p_blockkeys_.Get(index);
+inline void helpRecalPlan::set_parity_num(int32_t value) {
+  _internal_set_parity_num(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.parity_num)
 }
-inline const std::string& mainRecalPlan::p_blockkeys(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.p_blockkeys)
-  return _internal_p_blockkeys(index);
+
+// int32 k = 11;
+inline void helpRecalPlan::clear_k() {
+  _impl_.k_ = 0;
 }
-inline std::string* mainRecalPlan::mutable_p_blockkeys(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.mainRecalPlan.p_blockkeys)
-  return _impl_.p_blockkeys_.Mutable(index);
+inline int32_t helpRecalPlan::_internal_k() const {
+  return _impl_.k_;
+}
+inline int32_t helpRecalPlan::k() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.k)
+  return _internal_k();
+}
+inline void helpRecalPlan::_internal_set_k(int32_t value) {
+  
+  _impl_.k_ = value;
+}
+inline void helpRecalPlan::set_k(int32_t value) {
+  _internal_set_k(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.k)
+}
+
+// int32 encodetype = 12;
+inline void helpRecalPlan::clear_encodetype() {
+  _impl_.encodetype_ = 0;
+}
+inline int32_t helpRecalPlan::_internal_encodetype() const {
+  return _impl_.encodetype_;
+}
+inline int32_t helpRecalPlan::encodetype() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.encodetype)
+  return _internal_encodetype();
+}
+inline void helpRecalPlan::_internal_set_encodetype(int32_t value) {
+  
+  _impl_.encodetype_ = value;
+}
+inline void helpRecalPlan::set_encodetype(int32_t value) {
+  _internal_set_encodetype(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.encodetype)
+}
+
+// bool if_fused = 13;
+inline void helpRecalPlan::clear_if_fused() {
+  _impl_.if_fused_ = false;
 }
-inline void mainRecalPlan::set_p_blockkeys(int index, const std::string& value) {
-  _impl_.p_blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_blockkeys)
+inline bool helpRecalPlan::_internal_if_fused() const {
+  return _impl_.if_fused_;
 }
-inline void mainRecalPlan::set_p_blockkeys(int index, std::string&& value) {
-  _impl_.p_blockkeys_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.p_blockkeys)
+inline bool helpRecalPlan::if_fused() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.if_fused)
+  return _internal_if_fused();
 }
-inline void mainRecalPlan::set_p_blockkeys(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.p_blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.mainRecalPlan.p_blockkeys)
+inline void helpRecalPlan::_internal_set_if_fused(bool value) {
+  
+  _impl_.if_fused_ = value;
 }
-inline void mainRecalPlan::set_p_blockkeys(int index, const char* value, size_t size) {
-  _impl_.p_blockkeys_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.mainRecalPlan.p_blockkeys)
+inline void helpRecalPlan::set_if_fused(bool value) {
+  _internal_set_if_fused(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.if_fused)
 }
-inline std::string* mainRecalPlan::_internal_add_p_blockkeys() {
-  return _impl_.p_blockkeys_.Add();
+
+// repeated int32 groupids = 14;
+inline int helpRecalPlan::_internal_groupids_size() const {
+  return _impl_.groupids_.size();
 }
-inline void mainRecalPlan::add_p_blockkeys(const std::string& value) {
-  _impl_.p_blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_blockkeys)
+inline int helpRecalPlan::groupids_size() const {
+  return _internal_groupids_size();
 }
-inline void mainRecalPlan::add_p_blockkeys(std::string&& value) {
-  _impl_.p_blockkeys_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.mainRecalPlan.p_blockkeys)
+inline void helpRecalPlan::clear_groupids() {
+  _impl_.groupids_.Clear();
 }
-inline void mainRecalPlan::add_p_blockkeys(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.p_blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.mainRecalPlan.p_blockkeys)
+inline int32_t helpRecalPlan::_internal_groupids(int index) const {
+  return _impl_.groupids_.Get(index);
 }
-inline void mainRecalPlan::add_p_blockkeys(const char* value, size_t size) {
-  _impl_.p_blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.mainRecalPlan.p_blockkeys)
+inline int32_t helpRecalPlan::groupids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.groupids)
+  return _internal_groupids(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-mainRecalPlan::p_blockkeys() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.mainRecalPlan.p_blockkeys)
-  return _impl_.p_blockkeys_;
+inline void helpRecalPlan::set_groupids(int index, int32_t value) {
+  _impl_.groupids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.groupids)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-mainRecalPlan::mutable_p_blockkeys() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.mainRecalPlan.p_blockkeys)
-  return &_impl_.p_blockkeys_;
+inline void helpRecalPlan::_internal_add_groupids(int32_t value) {
+  _impl_.groupids_.Add(value);
 }
-
-// int32 k = 7;
-inline void mainRecalPlan::clear_k() {
-  _impl_.k_ = 0;
+inline void helpRecalPlan::add_groupids(int32_t value) {
+  _internal_add_groupids(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.groupids)
 }
-inline int32_t mainRecalPlan::_internal_k() const {
-  return _impl_.k_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+helpRecalPlan::_internal_groupids() const {
+  return _impl_.groupids_;
 }
-inline int32_t mainRecalPlan::k() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.k)
-  return _internal_k();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+helpRecalPlan::groupids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.groupids)
+  return _internal_groupids();
 }
-inline void mainRecalPlan::_internal_set_k(int32_t value) {
-  
-  _impl_.k_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+helpRecalPlan::_internal_mutable_groupids() {
+  return &_impl_.groupids_;
 }
-inline void mainRecalPlan::set_k(int32_t value) {
-  _internal_set_k(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.k)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+helpRecalPlan::mutable_groupids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.groupids)
+  return _internal_mutable_groupids();
 }
 
-// int32 l = 8;
-inline void mainRecalPlan::clear_l() {
+// int32 l = 15;
+inline void helpRecalPlan::clear_l() {
   _impl_.l_ = 0;
 }
-inline int32_t mainRecalPlan::_internal_l() const {
+inline int32_t helpRecalPlan::_internal_l() const {
   return _impl_.l_;
 }
-inline int32_t mainRecalPlan::l() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.l)
+inline int32_t helpRecalPlan::l() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.l)
   return _internal_l();
 }
-inline void mainRecalPlan::_internal_set_l(int32_t value) {
+inline void helpRecalPlan::_internal_set_l(int32_t value) {
   
   _impl_.l_ = value;
 }
-inline void mainRecalPlan::set_l(int32_t value) {
+inline void helpRecalPlan::set_l(int32_t value) {
   _internal_set_l(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.l)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.l)
 }
 
-// int32 g_m = 9;
-inline void mainRecalPlan::clear_g_m() {
+// int32 g_m = 16;
+inline void helpRecalPlan::clear_g_m() {
   _impl_.g_m_ = 0;
 }
-inline int32_t mainRecalPlan::_internal_g_m() const {
+inline int32_t helpRecalPlan::_internal_g_m() const {
   return _impl_.g_m_;
 }
-inline int32_t mainRecalPlan::g_m() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.g_m)
+inline int32_t helpRecalPlan::g_m() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.g_m)
   return _internal_g_m();
 }
-inline void mainRecalPlan::_internal_set_g_m(int32_t value) {
+inline void helpRecalPlan::_internal_set_g_m(int32_t value) {
   
   _impl_.g_m_ = value;
 }
-inline void mainRecalPlan::set_g_m(int32_t value) {
+inline void helpRecalPlan::set_g_m(int32_t value) {
   _internal_set_g_m(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.g_m)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.g_m)
 }
 
-// int32 block_size = 10;
-inline void mainRecalPlan::clear_block_size() {
-  _impl_.block_size_ = 0;
+// repeated .proxy_proto.fusedTarget targets = 17;
+inline int helpRecalPlan::_internal_targets_size() const {
+  return _impl_.targets_.size();
 }
-inline int32_t mainRecalPlan::_internal_block_size() const {
-  return _impl_.block_size_;
+inline int helpRecalPlan::targets_size() const {
+  return _internal_targets_size();
 }
-inline int32_t mainRecalPlan::block_size() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.block_size)
-  return _internal_block_size();
+inline void helpRecalPlan::clear_targets() {
+  _impl_.targets_.Clear();
 }
-inline void mainRecalPlan::_internal_set_block_size(int32_t value) {
+inline ::proxy_proto::fusedTarget* helpRecalPlan::mutable_targets(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.helpRecalPlan.targets)
+  return _impl_.targets_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::fusedTarget >*
+helpRecalPlan::mutable_targets() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.targets)
+  return &_impl_.targets_;
+}
+inline const ::proxy_proto::fusedTarget& helpRecalPlan::_internal_targets(int index) const {
+  return _impl_.targets_.Get(index);
+}
+inline const ::proxy_proto::fusedTarget& helpRecalPlan::targets(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.targets)
+  return _internal_targets(index);
+}
+inline ::proxy_proto::fusedTarget* helpRecalPlan::_internal_add_targets() {
+  return _impl_.targets_.Add();
+}
+inline ::proxy_proto::fusedTarget* helpRecalPlan::add_targets() {
+  ::proxy_proto::fusedTarget* _add = _internal_add_targets();
+  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.targets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::fusedTarget >&
+helpRecalPlan::targets() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.targets)
+  return _impl_.targets_;
+}
+
+// -------------------------------------------------------------------
+
+// fusedTarget
+
+// string mainproxyip = 1;
+inline void fusedTarget::clear_mainproxyip() {
+  _impl_.mainproxyip_.ClearToEmpty();
+}
+inline const std::string& fusedTarget::mainproxyip() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.fusedTarget.mainproxyip)
+  return _internal_mainproxyip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void fusedTarget::set_mainproxyip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mainproxyip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.fusedTarget.mainproxyip)
+}
+inline std::string* fusedTarget::mutable_mainproxyip() {
+  std::string* _s = _internal_mutable_mainproxyip();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.fusedTarget.mainproxyip)
+  return _s;
+}
+inline const std::string& fusedTarget::_internal_mainproxyip() const {
+  return _impl_.mainproxyip_.Get();
+}
+inline void fusedTarget::_internal_set_mainproxyip(const std::string& value) {
   
-  _impl_.block_size_ = value;
+  _impl_.mainproxyip_.Set(value, GetArenaForAllocation());
 }
-inline void mainRecalPlan::set_block_size(int32_t value) {
-  _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.block_size)
+inline std::string* fusedTarget::_internal_mutable_mainproxyip() {
+  
+  return _impl_.mainproxyip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* fusedTarget::release_mainproxyip() {
+  // @@protoc_insertion_point(field_release:proxy_proto.fusedTarget.mainproxyip)
+  return _impl_.mainproxyip_.Release();
+}
+inline void fusedTarget::set_allocated_mainproxyip(std::string* mainproxyip) {
+  if (mainproxyip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.mainproxyip_.SetAllocated(mainproxyip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mainproxyip_.IsDefault()) {
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.fusedTarget.mainproxyip)
 }
 
-// int32 encodetype = 11;
-inline void mainRecalPlan::clear_encodetype() {
-  _impl_.encodetype_ = 0;
+// int32 mainproxyport = 2;
+inline void fusedTarget::clear_mainproxyport() {
+  _impl_.mainproxyport_ = 0;
 }
-inline int32_t mainRecalPlan::_internal_encodetype() const {
-  return _impl_.encodetype_;
+inline int32_t fusedTarget::_internal_mainproxyport() const {
+  return _impl_.mainproxyport_;
 }
-inline int32_t mainRecalPlan::encodetype() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.encodetype)
-  return _internal_encodetype();
+inline int32_t fusedTarget::mainproxyport() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.fusedTarget.mainproxyport)
+  return _internal_mainproxyport();
 }
-inline void mainRecalPlan::_internal_set_encodetype(int32_t value) {
+inline void fusedTarget::_internal_set_mainproxyport(int32_t value) {
   
-  _impl_.encodetype_ = value;
+  _impl_.mainproxyport_ = value;
 }
-inline void mainRecalPlan::set_encodetype(int32_t value) {
-  _internal_set_encodetype(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.encodetype)
+inline void fusedTarget::set_mainproxyport(int32_t value) {
+  _internal_set_mainproxyport(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.fusedTarget.mainproxyport)
 }
 
-// int32 stripe_id = 12;
-inline void mainRecalPlan::clear_stripe_id() {
-  _impl_.stripe_id_ = 0;
+// repeated int32 parityids = 3;
+inline int fusedTarget::_internal_parityids_size() const {
+  return _impl_.parityids_.size();
 }
-inline int32_t mainRecalPlan::_internal_stripe_id() const {
-  return _impl_.stripe_id_;
+inline int fusedTarget::parityids_size() const {
+  return _internal_parityids_size();
 }
-inline int32_t mainRecalPlan::stripe_id() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.stripe_id)
-  return _internal_stripe_id();
+inline void fusedTarget::clear_parityids() {
+  _impl_.parityids_.Clear();
 }
-inline void mainRecalPlan::_internal_set_stripe_id(int32_t value) {
+inline int32_t fusedTarget::_internal_parityids(int index) const {
+  return _impl_.parityids_.Get(index);
+}
+inline int32_t fusedTarget::parityids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.fusedTarget.parityids)
+  return _internal_parityids(index);
+}
+inline void fusedTarget::set_parityids(int index, int32_t value) {
+  _impl_.parityids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.fusedTarget.parityids)
+}
+inline void fusedTarget::_internal_add_parityids(int32_t value) {
+  _impl_.parityids_.Add(value);
+}
+inline void fusedTarget::add_parityids(int32_t value) {
+  _internal_add_parityids(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.fusedTarget.parityids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+fusedTarget::_internal_parityids() const {
+  return _impl_.parityids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+fusedTarget::parityids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.fusedTarget.parityids)
+  return _internal_parityids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+fusedTarget::_internal_mutable_parityids() {
+  return &_impl_.parityids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+fusedTarget::mutable_parityids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.fusedTarget.parityids)
+  return _internal_mutable_parityids();
+}
+
+// int32 cluster_id = 4;
+inline void fusedTarget::clear_cluster_id() {
+  _impl_.cluster_id_ = 0;
+}
+inline int32_t fusedTarget::_internal_cluster_id() const {
+  return _impl_.cluster_id_;
+}
+inline int32_t fusedTarget::cluster_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.fusedTarget.cluster_id)
+  return _internal_cluster_id();
+}
+inline void fusedTarget::_internal_set_cluster_id(int32_t value) {
   
-  _impl_.stripe_id_ = value;
+  _impl_.cluster_id_ = value;
 }
-inline void mainRecalPlan::set_stripe_id(int32_t value) {
-  _internal_set_stripe_id(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.stripe_id)
+inline void fusedTarget::set_cluster_id(int32_t value) {
+  _internal_set_cluster_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.fusedTarget.cluster_id)
 }
 
-// int32 group_id = 13;
-inline void mainRecalPlan::clear_group_id() {
-  _impl_.group_id_ = 0;
+// -------------------------------------------------------------------
+
+// blockRelocPlan
+
+// repeated string blocktomove = 1;
+inline int blockRelocPlan::_internal_blocktomove_size() const {
+  return _impl_.blocktomove_.size();
 }
-inline int32_t mainRecalPlan::_internal_group_id() const {
-  return _impl_.group_id_;
+inline int blockRelocPlan::blocktomove_size() const {
+  return _internal_blocktomove_size();
 }
-inline int32_t mainRecalPlan::group_id() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.mainRecalPlan.group_id)
-  return _internal_group_id();
+inline void blockRelocPlan::clear_blocktomove() {
+  _impl_.blocktomove_.Clear();
+}
+inline std::string* blockRelocPlan::add_blocktomove() {
+  std::string* _s = _internal_add_blocktomove();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.blockRelocPlan.blocktomove)
+  return _s;
+}
+inline const std::string& blockRelocPlan::_internal_blocktomove(int index) const {
+  return _impl_.blocktomove_.Get(index);
+}
+inline const std::string& blockRelocPlan::blocktomove(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.blocktomove)
+  return _internal_blocktomove(index);
+}
+inline std::string* blockRelocPlan::mutable_blocktomove(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.blockRelocPlan.blocktomove)
+  return _impl_.blocktomove_.Mutable(index);
+}
+inline void blockRelocPlan::set_blocktomove(int index, const std::string& value) {
+  _impl_.blocktomove_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.blocktomove)
+}
+inline void blockRelocPlan::set_blocktomove(int index, std::string&& value) {
+  _impl_.blocktomove_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.blocktomove)
+}
+inline void blockRelocPlan::set_blocktomove(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blocktomove_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.blockRelocPlan.blocktomove)
+}
+inline void blockRelocPlan::set_blocktomove(int index, const char* value, size_t size) {
+  _impl_.blocktomove_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.blockRelocPlan.blocktomove)
+}
+inline std::string* blockRelocPlan::_internal_add_blocktomove() {
+  return _impl_.blocktomove_.Add();
+}
+inline void blockRelocPlan::add_blocktomove(const std::string& value) {
+  _impl_.blocktomove_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.blocktomove)
+}
+inline void blockRelocPlan::add_blocktomove(std::string&& value) {
+  _impl_.blocktomove_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.blocktomove)
+}
+inline void blockRelocPlan::add_blocktomove(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blocktomove_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.blockRelocPlan.blocktomove)
+}
+inline void blockRelocPlan::add_blocktomove(const char* value, size_t size) {
+  _impl_.blocktomove_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.blockRelocPlan.blocktomove)
 }
-inline void mainRecalPlan::_internal_set_group_id(int32_t value) {
-  
-  _impl_.group_id_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+blockRelocPlan::blocktomove() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.blocktomove)
+  return _impl_.blocktomove_;
 }
-inline void mainRecalPlan::set_group_id(int32_t value) {
-  _internal_set_group_id(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.mainRecalPlan.group_id)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+blockRelocPlan::mutable_blocktomove() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.blocktomove)
+  return &_impl_.blocktomove_;
 }
 
-// -------------------------------------------------------------------
-
-// RecalReply
-
-// string result = 1;
-inline void RecalReply::clear_result() {
-  _impl_.result_.ClearToEmpty();
+// repeated string fromdatanodeip = 2;
+inline int blockRelocPlan::_internal_fromdatanodeip_size() const {
+  return _impl_.fromdatanodeip_.size();
 }
-inline const std::string& RecalReply::result() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.RecalReply.result)
-  return _internal_result();
+inline int blockRelocPlan::fromdatanodeip_size() const {
+  return _internal_fromdatanodeip_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RecalReply::set_result(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.result_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proxy_proto.RecalReply.result)
+inline void blockRelocPlan::clear_fromdatanodeip() {
+  _impl_.fromdatanodeip_.Clear();
 }
-inline std::string* RecalReply::mutable_result() {
-  std::string* _s = _internal_mutable_result();
-  // @@protoc_insertion_point(field_mutable:proxy_proto.RecalReply.result)
+inline std::string* blockRelocPlan::add_fromdatanodeip() {
+  std::string* _s = _internal_add_fromdatanodeip();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.blockRelocPlan.fromdatanodeip)
   return _s;
 }
-inline const std::string& RecalReply::_internal_result() const {
-  return _impl_.result_.Get();
-}
-inline void RecalReply::_internal_set_result(const std::string& value) {
-  
-  _impl_.result_.Set(value, GetArenaForAllocation());
+inline const std::string& blockRelocPlan::_internal_fromdatanodeip(int index) const {
+  return _impl_.fromdatanodeip_.Get(index);
 }
-inline std::string* RecalReply::_internal_mutable_result() {
-  
-  return _impl_.result_.Mutable(GetArenaForAllocation());
+inline const std::string& blockRelocPlan::fromdatanodeip(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.fromdatanodeip)
+  return _internal_fromdatanodeip(index);
 }
-inline std::string* RecalReply::release_result() {
-  // @@protoc_insertion_point(field_release:proxy_proto.RecalReply.result)
-  return _impl_.result_.Release();
+inline std::string* blockRelocPlan::mutable_fromdatanodeip(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.blockRelocPlan.fromdatanodeip)
+  return _impl_.fromdatanodeip_.Mutable(index);
 }
-inline void RecalReply::set_allocated_result(std::string* result) {
-  if (result != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.result_.IsDefault()) {
-    _impl_.result_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proxy_proto.RecalReply.result)
+inline void blockRelocPlan::set_fromdatanodeip(int index, const std::string& value) {
+  _impl_.fromdatanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.fromdatanodeip)
 }
-
-// -------------------------------------------------------------------
-
-// helpRecalPlan
-
-// bool type = 1;
-inline void helpRecalPlan::clear_type() {
-  _impl_.type_ = false;
+inline void blockRelocPlan::set_fromdatanodeip(int index, std::string&& value) {
+  _impl_.fromdatanodeip_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.fromdatanodeip)
 }
-inline bool helpRecalPlan::_internal_type() const {
-  return _impl_.type_;
+inline void blockRelocPlan::set_fromdatanodeip(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.fromdatanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.blockRelocPlan.fromdatanodeip)
 }
-inline bool helpRecalPlan::type() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.type)
-  return _internal_type();
+inline void blockRelocPlan::set_fromdatanodeip(int index, const char* value, size_t size) {
+  _impl_.fromdatanodeip_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.blockRelocPlan.fromdatanodeip)
 }
-inline void helpRecalPlan::_internal_set_type(bool value) {
-  
-  _impl_.type_ = value;
+inline std::string* blockRelocPlan::_internal_add_fromdatanodeip() {
+  return _impl_.fromdatanodeip_.Add();
 }
-inline void helpRecalPlan::set_type(bool value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.type)
+inline void blockRelocPlan::add_fromdatanodeip(const std::string& value) {
+  _impl_.fromdatanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.fromdatanodeip)
 }
-
-// bool if_partial_decoding = 2;
-inline void helpRecalPlan::clear_if_partial_decoding() {
-  _impl_.if_partial_decoding_ = false;
+inline void blockRelocPlan::add_fromdatanodeip(std::string&& value) {
+  _impl_.fromdatanodeip_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.fromdatanodeip)
 }
-inline bool helpRecalPlan::_internal_if_partial_decoding() const {
-  return _impl_.if_partial_decoding_;
+inline void blockRelocPlan::add_fromdatanodeip(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.fromdatanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.blockRelocPlan.fromdatanodeip)
 }
-inline bool helpRecalPlan::if_partial_decoding() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.if_partial_decoding)
-  return _internal_if_partial_decoding();
+inline void blockRelocPlan::add_fromdatanodeip(const char* value, size_t size) {
+  _impl_.fromdatanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.blockRelocPlan.fromdatanodeip)
 }
-inline void helpRecalPlan::_internal_set_if_partial_decoding(bool value) {
-  
-  _impl_.if_partial_decoding_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+blockRelocPlan::fromdatanodeip() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.fromdatanodeip)
+  return _impl_.fromdatanodeip_;
 }
-inline void helpRecalPlan::set_if_partial_decoding(bool value) {
-  _internal_set_if_partial_decoding(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.if_partial_decoding)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+blockRelocPlan::mutable_fromdatanodeip() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.fromdatanodeip)
+  return &_impl_.fromdatanodeip_;
 }
 
-// string mainproxyip = 3;
-inline void helpRecalPlan::clear_mainproxyip() {
-  _impl_.mainproxyip_.ClearToEmpty();
-}
-inline const std::string& helpRecalPlan::mainproxyip() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.mainproxyip)
-  return _internal_mainproxyip();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void helpRecalPlan::set_mainproxyip(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.mainproxyip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.mainproxyip)
+// repeated int32 fromdatanodeport = 3;
+inline int blockRelocPlan::_internal_fromdatanodeport_size() const {
+  return _impl_.fromdatanodeport_.size();
 }
-inline std::string* helpRecalPlan::mutable_mainproxyip() {
-  std::string* _s = _internal_mutable_mainproxyip();
-  // @@protoc_insertion_point(field_mutable:proxy_proto.helpRecalPlan.mainproxyip)
-  return _s;
+inline int blockRelocPlan::fromdatanodeport_size() const {
+  return _internal_fromdatanodeport_size();
 }
-inline const std::string& helpRecalPlan::_internal_mainproxyip() const {
-  return _impl_.mainproxyip_.Get();
+inline void blockRelocPlan::clear_fromdatanodeport() {
+  _impl_.fromdatanodeport_.Clear();
 }
-inline void helpRecalPlan::_internal_set_mainproxyip(const std::string& value) {
-  
-  _impl_.mainproxyip_.Set(value, GetArenaForAllocation());
+inline int32_t blockRelocPlan::_internal_fromdatanodeport(int index) const {
+  return _impl_.fromdatanodeport_.Get(index);
 }
-inline std::string* helpRecalPlan::_internal_mutable_mainproxyip() {
-  
-  return _impl_.mainproxyip_.Mutable(GetArenaForAllocation());
+inline int32_t blockRelocPlan::fromdatanodeport(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.fromdatanodeport)
+  return _internal_fromdatanodeport(index);
 }
-inline std::string* helpRecalPlan::release_mainproxyip() {
-  // @@protoc_insertion_point(field_release:proxy_proto.helpRecalPlan.mainproxyip)
-  return _impl_.mainproxyip_.Release();
+inline void blockRelocPlan::set_fromdatanodeport(int index, int32_t value) {
+  _impl_.fromdatanodeport_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.fromdatanodeport)
 }
-inline void helpRecalPlan::set_allocated_mainproxyip(std::string* mainproxyip) {
-  if (mainproxyip != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.mainproxyip_.SetAllocated(mainproxyip, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.mainproxyip_.IsDefault()) {
-    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proxy_proto.helpRecalPlan.mainproxyip)
+inline void blockRelocPlan::_internal_add_fromdatanodeport(int32_t value) {
+  _impl_.fromdatanodeport_.Add(value);
 }
-
-// int32 mainproxyport = 4;
-inline void helpRecalPlan::clear_mainproxyport() {
-  _impl_.mainproxyport_ = 0;
+inline void blockRelocPlan::add_fromdatanodeport(int32_t value) {
+  _internal_add_fromdatanodeport(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.fromdatanodeport)
 }
-inline int32_t helpRecalPlan::_internal_mainproxyport() const {
-  return _impl_.mainproxyport_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+blockRelocPlan::_internal_fromdatanodeport() const {
+  return _impl_.fromdatanodeport_;
 }
-inline int32_t helpRecalPlan::mainproxyport() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.mainproxyport)
-  return _internal_mainproxyport();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+blockRelocPlan::fromdatanodeport() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.fromdatanodeport)
+  return _internal_fromdatanodeport();
 }
-inline void helpRecalPlan::_internal_set_mainproxyport(int32_t value) {
-  
-  _impl_.mainproxyport_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+blockRelocPlan::_internal_mutable_fromdatanodeport() {
+  return &_impl_.fromdatanodeport_;
 }
-inline void helpRecalPlan::set_mainproxyport(int32_t value) {
-  _internal_set_mainproxyport(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.mainproxyport)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+blockRelocPlan::mutable_fromdatanodeport() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.fromdatanodeport)
+  return _internal_mutable_fromdatanodeport();
 }
 
-// repeated string datanodeip = 5;
-inline int helpRecalPlan::_internal_datanodeip_size() const {
-  return _impl_.datanodeip_.size();
+// repeated string todatanodeip = 4;
+inline int blockRelocPlan::_internal_todatanodeip_size() const {
+  return _impl_.todatanodeip_.size();
 }
-inline int helpRecalPlan::datanodeip_size() const {
-  return _internal_datanodeip_size();
+inline int blockRelocPlan::todatanodeip_size() const {
+  return _internal_todatanodeip_size();
 }
-inline void helpRecalPlan::clear_datanodeip() {
-  _impl_.datanodeip_.Clear();
+inline void blockRelocPlan::clear_todatanodeip() {
+  _impl_.todatanodeip_.Clear();
 }
-inline std::string* helpRecalPlan::add_datanodeip() {
-  std::string* _s = _internal_add_datanodeip();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.helpRecalPlan.datanodeip)
+inline std::string* blockRelocPlan::add_todatanodeip() {
+  std::string* _s = _internal_add_todatanodeip();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.blockRelocPlan.todatanodeip)
   return _s;
 }
-inline const std::string& helpRecalPlan::_internal_datanodeip(int index) const {
-  return _impl_.datanodeip_.Get(index);
+inline const std::string& blockRelocPlan::_internal_todatanodeip(int index) const {
+  return _impl_.todatanodeip_.Get(index);
 }
-inline const std::string& helpRecalPlan::datanodeip(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.datanodeip)
-  return _internal_datanodeip(index);
+inline const std::string& blockRelocPlan::todatanodeip(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.todatanodeip)
+  return _internal_todatanodeip(index);
 }
-inline std::string* helpRecalPlan::mutable_datanodeip(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.helpRecalPlan.datanodeip)
-  return _impl_.datanodeip_.Mutable(index);
+inline std::string* blockRelocPlan::mutable_todatanodeip(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.blockRelocPlan.todatanodeip)
+  return _impl_.todatanodeip_.Mutable(index);
 }
-inline void helpRecalPlan::set_datanodeip(int index, const std::string& value) {
-  _impl_.datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.datanodeip)
+inline void blockRelocPlan::set_todatanodeip(int index, const std::string& value) {
+  _impl_.todatanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.todatanodeip)
 }
-inline void helpRecalPlan::set_datanodeip(int index, std::string&& value) {
-  _impl_.datanodeip_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.datanodeip)
+inline void blockRelocPlan::set_todatanodeip(int index, std::string&& value) {
+  _impl_.todatanodeip_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.todatanodeip)
 }
-inline void helpRecalPlan::set_datanodeip(int index, const char* value) {
+inline void blockRelocPlan::set_todatanodeip(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.helpRecalPlan.datanodeip)
+  _impl_.todatanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.blockRelocPlan.todatanodeip)
 }
-inline void helpRecalPlan::set_datanodeip(int index, const char* value, size_t size) {
-  _impl_.datanodeip_.Mutable(index)->assign(
+inline void blockRelocPlan::set_todatanodeip(int index, const char* value, size_t size) {
+  _impl_.todatanodeip_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.helpRecalPlan.datanodeip)
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.blockRelocPlan.todatanodeip)
 }
-inline std::string* helpRecalPlan::_internal_add_datanodeip() {
-  return _impl_.datanodeip_.Add();
+inline std::string* blockRelocPlan::_internal_add_todatanodeip() {
+  return _impl_.todatanodeip_.Add();
 }
-inline void helpRecalPlan::add_datanodeip(const std::string& value) {
-  _impl_.datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.datanodeip)
+inline void blockRelocPlan::add_todatanodeip(const std::string& value) {
+  _impl_.todatanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.todatanodeip)
 }
-inline void helpRecalPlan::add_datanodeip(std::string&& value) {
-  _impl_.datanodeip_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.datanodeip)
+inline void blockRelocPlan::add_todatanodeip(std::string&& value) {
+  _impl_.todatanodeip_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.todatanodeip)
 }
-inline void helpRecalPlan::add_datanodeip(const char* value) {
+inline void blockRelocPlan::add_todatanodeip(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.helpRecalPlan.datanodeip)
+  _impl_.todatanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.blockRelocPlan.todatanodeip)
 }
-inline void helpRecalPlan::add_datanodeip(const char* value, size_t size) {
-  _impl_.datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.helpRecalPlan.datanodeip)
+inline void blockRelocPlan::add_todatanodeip(const char* value, size_t size) {
+  _impl_.todatanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.blockRelocPlan.todatanodeip)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-helpRecalPlan::datanodeip() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.datanodeip)
-  return _impl_.datanodeip_;
+blockRelocPlan::todatanodeip() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.todatanodeip)
+  return _impl_.todatanodeip_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-helpRecalPlan::mutable_datanodeip() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.datanodeip)
-  return &_impl_.datanodeip_;
+blockRelocPlan::mutable_todatanodeip() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.todatanodeip)
+  return &_impl_.todatanodeip_;
 }
 
-// repeated int32 datanodeport = 6;
-inline int helpRecalPlan::_internal_datanodeport_size() const {
-  return _impl_.datanodeport_.size();
+// repeated int32 todatanodeport = 5;
+inline int blockRelocPlan::_internal_todatanodeport_size() const {
+  return _impl_.todatanodeport_.size();
 }
-inline int helpRecalPlan::datanodeport_size() const {
-  return _internal_datanodeport_size();
+inline int blockRelocPlan::todatanodeport_size() const {
+  return _internal_todatanodeport_size();
 }
-inline void helpRecalPlan::clear_datanodeport() {
-  _impl_.datanodeport_.Clear();
+inline void blockRelocPlan::clear_todatanodeport() {
+  _impl_.todatanodeport_.Clear();
 }
-inline int32_t helpRecalPlan::_internal_datanodeport(int index) const {
-  return _impl_.datanodeport_.Get(index);
+inline int32_t blockRelocPlan::_internal_todatanodeport(int index) const {
+  return _impl_.todatanodeport_.Get(index);
 }
-inline int32_t helpRecalPlan::datanodeport(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.datanodeport)
-  return _internal_datanodeport(index);
+inline int32_t blockRelocPlan::todatanodeport(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.todatanodeport)
+  return _internal_todatanodeport(index);
 }
-inline void helpRecalPlan::set_datanodeport(int index, int32_t value) {
-  _impl_.datanodeport_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.datanodeport)
+inline void blockRelocPlan::set_todatanodeport(int index, int32_t value) {
+  _impl_.todatanodeport_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.todatanodeport)
 }
-inline void helpRecalPlan::_internal_add_datanodeport(int32_t value) {
-  _impl_.datanodeport_.Add(value);
+inline void blockRelocPlan::_internal_add_todatanodeport(int32_t value) {
+  _impl_.todatanodeport_.Add(value);
 }
-inline void helpRecalPlan::add_datanodeport(int32_t value) {
-  _internal_add_datanodeport(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.datanodeport)
+inline void blockRelocPlan::add_todatanodeport(int32_t value) {
+  _internal_add_todatanodeport(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.todatanodeport)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-helpRecalPlan::_internal_datanodeport() const {
-  return _impl_.datanodeport_;
+blockRelocPlan::_internal_todatanodeport() const {
+  return _impl_.todatanodeport_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-helpRecalPlan::datanodeport() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.datanodeport)
-  return _internal_datanodeport();
+blockRelocPlan::todatanodeport() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.todatanodeport)
+  return _internal_todatanodeport();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-helpRecalPlan::_internal_mutable_datanodeport() {
-  return &_impl_.datanodeport_;
+blockRelocPlan::_internal_mutable_todatanodeport() {
+  return &_impl_.todatanodeport_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-helpRecalPlan::mutable_datanodeport() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.datanodeport)
-  return _internal_mutable_datanodeport();
+blockRelocPlan::mutable_todatanodeport() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.todatanodeport)
+  return _internal_mutable_todatanodeport();
 }
 
-// repeated string blockkeys = 7;
-inline int helpRecalPlan::_internal_blockkeys_size() const {
-  return _impl_.blockkeys_.size();
-}
-inline int helpRecalPlan::blockkeys_size() const {
-  return _internal_blockkeys_size();
-}
-inline void helpRecalPlan::clear_blockkeys() {
-  _impl_.blockkeys_.Clear();
-}
-inline std::string* helpRecalPlan::add_blockkeys() {
-  std::string* _s = _internal_add_blockkeys();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.helpRecalPlan.blockkeys)
-  return _s;
+// int32 block_size = 6;
+inline void blockRelocPlan::clear_block_size() {
+  _impl_.block_size_ = 0;
 }
-inline const std::string& helpRecalPlan::_internal_blockkeys(int index) const {
-  return _impl_.blockkeys_.Get(index);
+inline int32_t blockRelocPlan::_internal_block_size() const {
+  return _impl_.block_size_;
 }
-inline const std::string& helpRecalPlan::blockkeys(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.blockkeys)
-  return _internal_blockkeys(index);
+inline int32_t blockRelocPlan::block_size() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.block_size)
+  return _internal_block_size();
 }
-inline std::string* helpRecalPlan::mutable_blockkeys(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.helpRecalPlan.blockkeys)
-  return _impl_.blockkeys_.Mutable(index);
+inline void blockRelocPlan::_internal_set_block_size(int32_t value) {
+  
+  _impl_.block_size_ = value;
 }
-inline void helpRecalPlan::set_blockkeys(int index, const std::string& value) {
-  _impl_.blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.blockkeys)
+inline void blockRelocPlan::set_block_size(int32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.block_size)
 }
-inline void helpRecalPlan::set_blockkeys(int index, std::string&& value) {
-  _impl_.blockkeys_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.blockkeys)
+
+// int32 task_id = 7;
+inline void blockRelocPlan::clear_task_id() {
+  _impl_.task_id_ = 0;
 }
-inline void helpRecalPlan::set_blockkeys(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.helpRecalPlan.blockkeys)
+inline int32_t blockRelocPlan::_internal_task_id() const {
+  return _impl_.task_id_;
 }
-inline void helpRecalPlan::set_blockkeys(int index, const char* value, size_t size) {
-  _impl_.blockkeys_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.helpRecalPlan.blockkeys)
+inline int32_t blockRelocPlan::task_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.task_id)
+  return _internal_task_id();
 }
-inline std::string* helpRecalPlan::_internal_add_blockkeys() {
-  return _impl_.blockkeys_.Add();
+inline void blockRelocPlan::_internal_set_task_id(int32_t value) {
+  
+  _impl_.task_id_ = value;
 }
-inline void helpRecalPlan::add_blockkeys(const std::string& value) {
-  _impl_.blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.blockkeys)
+inline void blockRelocPlan::set_task_id(int32_t value) {
+  _internal_set_task_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.task_id)
 }
-inline void helpRecalPlan::add_blockkeys(std::string&& value) {
-  _impl_.blockkeys_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.blockkeys)
+
+// int32 max_parallel = 8;
+inline void blockRelocPlan::clear_max_parallel() {
+  _impl_.max_parallel_ = 0;
 }
-inline void helpRecalPlan::add_blockkeys(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.helpRecalPlan.blockkeys)
+inline int32_t blockRelocPlan::_internal_max_parallel() const {
+  return _impl_.max_parallel_;
 }
-inline void helpRecalPlan::add_blockkeys(const char* value, size_t size) {
-  _impl_.blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.helpRecalPlan.blockkeys)
+inline int32_t blockRelocPlan::max_parallel() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.max_parallel)
+  return _internal_max_parallel();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-helpRecalPlan::blockkeys() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.blockkeys)
-  return _impl_.blockkeys_;
+inline void blockRelocPlan::_internal_set_max_parallel(int32_t value) {
+  
+  _impl_.max_parallel_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-helpRecalPlan::mutable_blockkeys() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.blockkeys)
-  return &_impl_.blockkeys_;
+inline void blockRelocPlan::set_max_parallel(int32_t value) {
+  _internal_set_max_parallel(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.max_parallel)
 }
 
-// int32 block_size = 8;
-inline void helpRecalPlan::clear_block_size() {
-  _impl_.block_size_ = 0;
+// int32 max_per_des_node = 9;
+inline void blockRelocPlan::clear_max_per_des_node() {
+  _impl_.max_per_des_node_ = 0;
 }
-inline int32_t helpRecalPlan::_internal_block_size() const {
-  return _impl_.block_size_;
+inline int32_t blockRelocPlan::_internal_max_per_des_node() const {
+  return _impl_.max_per_des_node_;
 }
-inline int32_t helpRecalPlan::block_size() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.block_size)
-  return _internal_block_size();
+inline int32_t blockRelocPlan::max_per_des_node() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.max_per_des_node)
+  return _internal_max_per_des_node();
 }
-inline void helpRecalPlan::_internal_set_block_size(int32_t value) {
+inline void blockRelocPlan::_internal_set_max_per_des_node(int32_t value) {
   
-  _impl_.block_size_ = value;
+  _impl_.max_per_des_node_ = value;
 }
-inline void helpRecalPlan::set_block_size(int32_t value) {
-  _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.block_size)
+inline void blockRelocPlan::set_max_per_des_node(int32_t value) {
+  _internal_set_max_per_des_node(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.max_per_des_node)
 }
 
-// repeated int32 blockids = 9;
-inline int helpRecalPlan::_internal_blockids_size() const {
-  return _impl_.blockids_.size();
+// int64 bandwidth = 10;
+inline void blockRelocPlan::clear_bandwidth() {
+  _impl_.bandwidth_ = int64_t{0};
 }
-inline int helpRecalPlan::blockids_size() const {
-  return _internal_blockids_size();
+inline int64_t blockRelocPlan::_internal_bandwidth() const {
+  return _impl_.bandwidth_;
 }
-inline void helpRecalPlan::clear_blockids() {
-  _impl_.blockids_.Clear();
+inline int64_t blockRelocPlan::bandwidth() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.bandwidth)
+  return _internal_bandwidth();
 }
-inline int32_t helpRecalPlan::_internal_blockids(int index) const {
-  return _impl_.blockids_.Get(index);
+inline void blockRelocPlan::_internal_set_bandwidth(int64_t value) {
+  
+  _impl_.bandwidth_ = value;
 }
-inline int32_t helpRecalPlan::blockids(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.blockids)
-  return _internal_blockids(index);
+inline void blockRelocPlan::set_bandwidth(int64_t value) {
+  _internal_set_bandwidth(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.bandwidth)
+}
+
+// -------------------------------------------------------------------
+
+// blockRelocReply
+
+// string result = 1;
+inline void blockRelocReply::clear_result() {
+  _impl_.result_.ClearToEmpty();
+}
+inline const std::string& blockRelocReply::result() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocReply.result)
+  return _internal_result();
 }
-inline void helpRecalPlan::set_blockids(int index, int32_t value) {
-  _impl_.blockids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.blockids)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void blockRelocReply::set_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocReply.result)
 }
-inline void helpRecalPlan::_internal_add_blockids(int32_t value) {
-  _impl_.blockids_.Add(value);
+inline std::string* blockRelocReply::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.blockRelocReply.result)
+  return _s;
 }
-inline void helpRecalPlan::add_blockids(int32_t value) {
-  _internal_add_blockids(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.helpRecalPlan.blockids)
+inline const std::string& blockRelocReply::_internal_result() const {
+  return _impl_.result_.Get();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-helpRecalPlan::_internal_blockids() const {
-  return _impl_.blockids_;
+inline void blockRelocReply::_internal_set_result(const std::string& value) {
+  
+  _impl_.result_.Set(value, GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-helpRecalPlan::blockids() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.helpRecalPlan.blockids)
-  return _internal_blockids();
+inline std::string* blockRelocReply::_internal_mutable_result() {
+  
+  return _impl_.result_.Mutable(GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-helpRecalPlan::_internal_mutable_blockids() {
-  return &_impl_.blockids_;
+inline std::string* blockRelocReply::release_result() {
+  // @@protoc_insertion_point(field_release:proxy_proto.blockRelocReply.result)
+  return _impl_.result_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-helpRecalPlan::mutable_blockids() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpRecalPlan.blockids)
-  return _internal_mutable_blockids();
+inline void blockRelocReply::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.blockRelocReply.result)
 }
 
-// int32 parity_num = 10;
-inline void helpRecalPlan::clear_parity_num() {
-  _impl_.parity_num_ = 0;
+// -------------------------------------------------------------------
+
+// AskIfSuccess
+
+// int32 step = 1;
+inline void AskIfSuccess::clear_step() {
+  _impl_.step_ = 0;
 }
-inline int32_t helpRecalPlan::_internal_parity_num() const {
-  return _impl_.parity_num_;
+inline int32_t AskIfSuccess::_internal_step() const {
+  return _impl_.step_;
 }
-inline int32_t helpRecalPlan::parity_num() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.parity_num)
-  return _internal_parity_num();
+inline int32_t AskIfSuccess::step() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.AskIfSuccess.step)
+  return _internal_step();
 }
-inline void helpRecalPlan::_internal_set_parity_num(int32_t value) {
+inline void AskIfSuccess::_internal_set_step(int32_t value) {
   
-  _impl_.parity_num_ = value;
+  _impl_.step_ = value;
 }
-inline void helpRecalPlan::set_parity_num(int32_t value) {
-  _internal_set_parity_num(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.parity_num)
+inline void AskIfSuccess::set_step(int32_t value) {
+  _internal_set_step(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.AskIfSuccess.step)
 }
 
-// int32 k = 11;
-inline void helpRecalPlan::clear_k() {
-  _impl_.k_ = 0;
+// int32 task_id = 2;
+inline void AskIfSuccess::clear_task_id() {
+  _impl_.task_id_ = 0;
 }
-inline int32_t helpRecalPlan::_internal_k() const {
-  return _impl_.k_;
+inline int32_t AskIfSuccess::_internal_task_id() const {
+  return _impl_.task_id_;
 }
-inline int32_t helpRecalPlan::k() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.k)
-  return _internal_k();
+inline int32_t AskIfSuccess::task_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.AskIfSuccess.task_id)
+  return _internal_task_id();
 }
-inline void helpRecalPlan::_internal_set_k(int32_t value) {
+inline void AskIfSuccess::_internal_set_task_id(int32_t value) {
   
-  _impl_.k_ = value;
+  _impl_.task_id_ = value;
 }
-inline void helpRecalPlan::set_k(int32_t value) {
-  _internal_set_k(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.k)
+inline void AskIfSuccess::set_task_id(int32_t value) {
+  _internal_set_task_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.AskIfSuccess.task_id)
 }
 
-// int32 encodetype = 12;
-inline void helpRecalPlan::clear_encodetype() {
-  _impl_.encodetype_ = 0;
+// -------------------------------------------------------------------
+
+// RepIfSuccess
+
+// bool ifsuccess = 1;
+inline void RepIfSuccess::clear_ifsuccess() {
+  _impl_.ifsuccess_ = false;
 }
-inline int32_t helpRecalPlan::_internal_encodetype() const {
-  return _impl_.encodetype_;
+inline bool RepIfSuccess::_internal_ifsuccess() const {
+  return _impl_.ifsuccess_;
 }
-inline int32_t helpRecalPlan::encodetype() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.helpRecalPlan.encodetype)
-  return _internal_encodetype();
+inline bool RepIfSuccess::ifsuccess() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.RepIfSuccess.ifsuccess)
+  return _internal_ifsuccess();
 }
-inline void helpRecalPlan::_internal_set_encodetype(int32_t value) {
+inline void RepIfSuccess::_internal_set_ifsuccess(bool value) {
   
-  _impl_.encodetype_ = value;
+  _impl_.ifsuccess_ = value;
 }
-inline void helpRecalPlan::set_encodetype(int32_t value) {
-  _internal_set_encodetype(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.helpRecalPlan.encodetype)
+inline void RepIfSuccess::set_ifsuccess(bool value) {
+  _internal_set_ifsuccess(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.RepIfSuccess.ifsuccess)
 }
 
 // -------------------------------------------------------------------
 
-// blockRelocPlan
+// NodeAndBlock
 
-// repeated string blocktomove = 1;
-inline int blockRelocPlan::_internal_blocktomove_size() const {
-  return _impl_.blocktomove_.size();
+// repeated string blockkeys = 1;
+inline int NodeAndBlock::_internal_blockkeys_size() const {
+  return _impl_.blockkeys_.size();
 }
-inline int blockRelocPlan::blocktomove_size() const {
-  return _internal_blocktomove_size();
+inline int NodeAndBlock::blockkeys_size() const {
+  return _internal_blockkeys_size();
 }
-inline void blockRelocPlan::clear_blocktomove() {
-  _impl_.blocktomove_.Clear();
+inline void NodeAndBlock::clear_blockkeys() {
+  _impl_.blockkeys_.Clear();
 }
-inline std::string* blockRelocPlan::add_blocktomove() {
-  std::string* _s = _internal_add_blocktomove();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.blockRelocPlan.blocktomove)
+inline std::string* NodeAndBlock::add_blockkeys() {
+  std::string* _s = _internal_add_blockkeys();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.NodeAndBlock.blockkeys)
   return _s;
 }
-inline const std::string& blockRelocPlan::_internal_blocktomove(int index) const {
-  return _impl_.blocktomove_.Get(index);
+inline const std::string& NodeAndBlock::_internal_blockkeys(int index) const {
+  return _impl_.blockkeys_.Get(index);
 }
-inline const std::string& blockRelocPlan::blocktomove(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.blocktomove)
-  return _internal_blocktomove(index);
+inline const std::string& NodeAndBlock::blockkeys(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.blockkeys)
+  return _internal_blockkeys(index);
 }
-inline std::string* blockRelocPlan::mutable_blocktomove(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.blockRelocPlan.blocktomove)
-  return _impl_.blocktomove_.Mutable(index);
+inline std::string* NodeAndBlock::mutable_blockkeys(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.NodeAndBlock.blockkeys)
+  return _impl_.blockkeys_.Mutable(index);
 }
-inline void blockRelocPlan::set_blocktomove(int index, const std::string& value) {
-  _impl_.blocktomove_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.blocktomove)
+inline void NodeAndBlock::set_blockkeys(int index, const std::string& value) {
+  _impl_.blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.blockkeys)
 }
-inline void blockRelocPlan::set_blocktomove(int index, std::string&& value) {
-  _impl_.blocktomove_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.blocktomove)
+inline void NodeAndBlock::set_blockkeys(int index, std::string&& value) {
+  _impl_.blockkeys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.blockkeys)
 }
-inline void blockRelocPlan::set_blocktomove(int index, const char* value) {
+inline void NodeAndBlock::set_blockkeys(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.blocktomove_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.blockRelocPlan.blocktomove)
+  _impl_.blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.NodeAndBlock.blockkeys)
 }
-inline void blockRelocPlan::set_blocktomove(int index, const char* value, size_t size) {
-  _impl_.blocktomove_.Mutable(index)->assign(
+inline void NodeAndBlock::set_blockkeys(int index, const char* value, size_t size) {
+  _impl_.blockkeys_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.blockRelocPlan.blocktomove)
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.NodeAndBlock.blockkeys)
 }
-inline std::string* blockRelocPlan::_internal_add_blocktomove() {
-  return _impl_.blocktomove_.Add();
+inline std::string* NodeAndBlock::_internal_add_blockkeys() {
+  return _impl_.blockkeys_.Add();
 }
-inline void blockRelocPlan::add_blocktomove(const std::string& value) {
-  _impl_.blocktomove_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.blocktomove)
+inline void NodeAndBlock::add_blockkeys(const std::string& value) {
+  _impl_.blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.blockkeys)
 }
-inline void blockRelocPlan::add_blocktomove(std::string&& value) {
-  _impl_.blocktomove_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.blocktomove)
+inline void NodeAndBlock::add_blockkeys(std::string&& value) {
+  _impl_.blockkeys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.blockkeys)
 }
-inline void blockRelocPlan::add_blocktomove(const char* value) {
+inline void NodeAndBlock::add_blockkeys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.blocktomove_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.blockRelocPlan.blocktomove)
+  _impl_.blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.NodeAndBlock.blockkeys)
 }
-inline void blockRelocPlan::add_blocktomove(const char* value, size_t size) {
-  _impl_.blocktomove_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.blockRelocPlan.blocktomove)
+inline void NodeAndBlock::add_blockkeys(const char* value, size_t size) {
+  _impl_.blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.NodeAndBlock.blockkeys)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-blockRelocPlan::blocktomove() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.blocktomove)
-  return _impl_.blocktomove_;
+NodeAndBlock::blockkeys() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.NodeAndBlock.blockkeys)
+  return _impl_.blockkeys_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-blockRelocPlan::mutable_blocktomove() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.blocktomove)
-  return &_impl_.blocktomove_;
+NodeAndBlock::mutable_blockkeys() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.NodeAndBlock.blockkeys)
+  return &_impl_.blockkeys_;
 }
 
-// repeated string fromdatanodeip = 2;
-inline int blockRelocPlan::_internal_fromdatanodeip_size() const {
-  return _impl_.fromdatanodeip_.size();
+// repeated string datanodeip = 2;
+inline int NodeAndBlock::_internal_datanodeip_size() const {
+  return _impl_.datanodeip_.size();
 }
-inline int blockRelocPlan::fromdatanodeip_size() const {
-  return _internal_fromdatanodeip_size();
+inline int NodeAndBlock::datanodeip_size() const {
+  return _internal_datanodeip_size();
 }
-inline void blockRelocPlan::clear_fromdatanodeip() {
-  _impl_.fromdatanodeip_.Clear();
+inline void NodeAndBlock::clear_datanodeip() {
+  _impl_.datanodeip_.Clear();
 }
-inline std::string* blockRelocPlan::add_fromdatanodeip() {
-  std::string* _s = _internal_add_fromdatanodeip();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.blockRelocPlan.fromdatanodeip)
+inline std::string* NodeAndBlock::add_datanodeip() {
+  std::string* _s = _internal_add_datanodeip();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.NodeAndBlock.datanodeip)
   return _s;
 }
-inline const std::string& blockRelocPlan::_internal_fromdatanodeip(int index) const {
-  return _impl_.fromdatanodeip_.Get(index);
+inline const std::string& NodeAndBlock::_internal_datanodeip(int index) const {
+  return _impl_.datanodeip_.Get(index);
 }
-inline const std::string& blockRelocPlan::fromdatanodeip(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.fromdatanodeip)
-  return _internal_fromdatanodeip(index);
+inline const std::string& NodeAndBlock::datanodeip(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.datanodeip)
+  return _internal_datanodeip(index);
 }
-inline std::string* blockRelocPlan::mutable_fromdatanodeip(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.blockRelocPlan.fromdatanodeip)
-  return _impl_.fromdatanodeip_.Mutable(index);
+inline std::string* NodeAndBlock::mutable_datanodeip(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.NodeAndBlock.datanodeip)
+  return _impl_.datanodeip_.Mutable(index);
 }
-inline void blockRelocPlan::set_fromdatanodeip(int index, const std::string& value) {
-  _impl_.fromdatanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.fromdatanodeip)
+inline void NodeAndBlock::set_datanodeip(int index, const std::string& value) {
+  _impl_.datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.datanodeip)
 }
-inline void blockRelocPlan::set_fromdatanodeip(int index, std::string&& value) {
-  _impl_.fromdatanodeip_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.fromdatanodeip)
+inline void NodeAndBlock::set_datanodeip(int index, std::string&& value) {
+  _impl_.datanodeip_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.datanodeip)
 }
-inline void blockRelocPlan::set_fromdatanodeip(int index, const char* value) {
+inline void NodeAndBlock::set_datanodeip(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.fromdatanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.blockRelocPlan.fromdatanodeip)
+  _impl_.datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.NodeAndBlock.datanodeip)
 }
-inline void blockRelocPlan::set_fromdatanodeip(int index, const char* value, size_t size) {
-  _impl_.fromdatanodeip_.Mutable(index)->assign(
+inline void NodeAndBlock::set_datanodeip(int index, const char* value, size_t size) {
+  _impl_.datanodeip_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.blockRelocPlan.fromdatanodeip)
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.NodeAndBlock.datanodeip)
 }
-inline std::string* blockRelocPlan::_internal_add_fromdatanodeip() {
-  return _impl_.fromdatanodeip_.Add();
+inline std::string* NodeAndBlock::_internal_add_datanodeip() {
+  return _impl_.datanodeip_.Add();
 }
-inline void blockRelocPlan::add_fromdatanodeip(const std::string& value) {
-  _impl_.fromdatanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.fromdatanodeip)
+inline void NodeAndBlock::add_datanodeip(const std::string& value) {
+  _impl_.datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.datanodeip)
 }
-inline void blockRelocPlan::add_fromdatanodeip(std::string&& value) {
-  _impl_.fromdatanodeip_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.fromdatanodeip)
+inline void NodeAndBlock::add_datanodeip(std::string&& value) {
+  _impl_.datanodeip_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.datanodeip)
 }
-inline void blockRelocPlan::add_fromdatanodeip(const char* value) {
+inline void NodeAndBlock::add_datanodeip(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.fromdatanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.blockRelocPlan.fromdatanodeip)
+  _impl_.datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.NodeAndBlock.datanodeip)
 }
-inline void blockRelocPlan::add_fromdatanodeip(const char* value, size_t size) {
-  _impl_.fromdatanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.blockRelocPlan.fromdatanodeip)
+inline void NodeAndBlock::add_datanodeip(const char* value, size_t size) {
+  _impl_.datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.NodeAndBlock.datanodeip)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-blockRelocPlan::fromdatanodeip() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.fromdatanodeip)
-  return _impl_.fromdatanodeip_;
+NodeAndBlock::datanodeip() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.NodeAndBlock.datanodeip)
+  return _impl_.datanodeip_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-blockRelocPlan::mutable_fromdatanodeip() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.fromdatanodeip)
-  return &_impl_.fromdatanodeip_;
+NodeAndBlock::mutable_datanodeip() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.NodeAndBlock.datanodeip)
+  return &_impl_.datanodeip_;
 }
 
-// repeated int32 fromdatanodeport = 3;
-inline int blockRelocPlan::_internal_fromdatanodeport_size() const {
-  return _impl_.fromdatanodeport_.size();
+// repeated int32 datanodeport = 3;
+inline int NodeAndBlock::_internal_datanodeport_size() const {
+  return _impl_.datanodeport_.size();
 }
-inline int blockRelocPlan::fromdatanodeport_size() const {
-  return _internal_fromdatanodeport_size();
+inline int NodeAndBlock::datanodeport_size() const {
+  return _internal_datanodeport_size();
 }
-inline void blockRelocPlan::clear_fromdatanodeport() {
-  _impl_.fromdatanodeport_.Clear();
+inline void NodeAndBlock::clear_datanodeport() {
+  _impl_.datanodeport_.Clear();
 }
-inline int32_t blockRelocPlan::_internal_fromdatanodeport(int index) const {
-  return _impl_.fromdatanodeport_.Get(index);
+inline int32_t NodeAndBlock::_internal_datanodeport(int index) const {
+  return _impl_.datanodeport_.Get(index);
 }
-inline int32_t blockRelocPlan::fromdatanodeport(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.fromdatanodeport)
-  return _internal_fromdatanodeport(index);
+inline int32_t NodeAndBlock::datanodeport(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.datanodeport)
+  return _internal_datanodeport(index);
 }
-inline void blockRelocPlan::set_fromdatanodeport(int index, int32_t value) {
-  _impl_.fromdatanodeport_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.fromdatanodeport)
+inline void NodeAndBlock::set_datanodeport(int index, int32_t value) {
+  _impl_.datanodeport_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.datanodeport)
 }
-inline void blockRelocPlan::_internal_add_fromdatanodeport(int32_t value) {
-  _impl_.fromdatanodeport_.Add(value);
+inline void NodeAndBlock::_internal_add_datanodeport(int32_t value) {
+  _impl_.datanodeport_.Add(value);
 }
-inline void blockRelocPlan::add_fromdatanodeport(int32_t value) {
-  _internal_add_fromdatanodeport(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.fromdatanodeport)
+inline void NodeAndBlock::add_datanodeport(int32_t value) {
+  _internal_add_datanodeport(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.datanodeport)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-blockRelocPlan::_internal_fromdatanodeport() const {
-  return _impl_.fromdatanodeport_;
+NodeAndBlock::_internal_datanodeport() const {
+  return _impl_.datanodeport_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-blockRelocPlan::fromdatanodeport() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.fromdatanodeport)
-  return _internal_fromdatanodeport();
+NodeAndBlock::datanodeport() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.NodeAndBlock.datanodeport)
+  return _internal_datanodeport();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-blockRelocPlan::_internal_mutable_fromdatanodeport() {
-  return &_impl_.fromdatanodeport_;
+NodeAndBlock::_internal_mutable_datanodeport() {
+  return &_impl_.datanodeport_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-blockRelocPlan::mutable_fromdatanodeport() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.fromdatanodeport)
-  return _internal_mutable_fromdatanodeport();
+NodeAndBlock::mutable_datanodeport() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.NodeAndBlock.datanodeport)
+  return _internal_mutable_datanodeport();
 }
 
-// repeated string todatanodeip = 4;
-inline int blockRelocPlan::_internal_todatanodeip_size() const {
-  return _impl_.todatanodeip_.size();
+// int32 stripe_id = 4;
+inline void NodeAndBlock::clear_stripe_id() {
+  _impl_.stripe_id_ = 0;
 }
-inline int blockRelocPlan::todatanodeip_size() const {
-  return _internal_todatanodeip_size();
+inline int32_t NodeAndBlock::_internal_stripe_id() const {
+  return _impl_.stripe_id_;
 }
-inline void blockRelocPlan::clear_todatanodeip() {
-  _impl_.todatanodeip_.Clear();
+inline int32_t NodeAndBlock::stripe_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.stripe_id)
+  return _internal_stripe_id();
 }
-inline std::string* blockRelocPlan::add_todatanodeip() {
-  std::string* _s = _internal_add_todatanodeip();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.blockRelocPlan.todatanodeip)
-  return _s;
+inline void NodeAndBlock::_internal_set_stripe_id(int32_t value) {
+  
+  _impl_.stripe_id_ = value;
 }
-inline const std::string& blockRelocPlan::_internal_todatanodeip(int index) const {
-  return _impl_.todatanodeip_.Get(index);
+inline void NodeAndBlock::set_stripe_id(int32_t value) {
+  _internal_set_stripe_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.stripe_id)
 }
-inline const std::string& blockRelocPlan::todatanodeip(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.todatanodeip)
-  return _internal_todatanodeip(index);
+
+// string key = 5;
+inline void NodeAndBlock::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline std::string* blockRelocPlan::mutable_todatanodeip(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.blockRelocPlan.todatanodeip)
-  return _impl_.todatanodeip_.Mutable(index);
+inline const std::string& NodeAndBlock::key() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.key)
+  return _internal_key();
 }
-inline void blockRelocPlan::set_todatanodeip(int index, const std::string& value) {
-  _impl_.todatanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.todatanodeip)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeAndBlock::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.key)
 }
-inline void blockRelocPlan::set_todatanodeip(int index, std::string&& value) {
-  _impl_.todatanodeip_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.todatanodeip)
+inline std::string* NodeAndBlock::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.NodeAndBlock.key)
+  return _s;
 }
-inline void blockRelocPlan::set_todatanodeip(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.todatanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.blockRelocPlan.todatanodeip)
+inline const std::string& NodeAndBlock::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline void blockRelocPlan::set_todatanodeip(int index, const char* value, size_t size) {
-  _impl_.todatanodeip_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.blockRelocPlan.todatanodeip)
+inline void NodeAndBlock::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* blockRelocPlan::_internal_add_todatanodeip() {
-  return _impl_.todatanodeip_.Add();
+inline std::string* NodeAndBlock::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline void blockRelocPlan::add_todatanodeip(const std::string& value) {
-  _impl_.todatanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.todatanodeip)
+inline std::string* NodeAndBlock::release_key() {
+  // @@protoc_insertion_point(field_release:proxy_proto.NodeAndBlock.key)
+  return _impl_.key_.Release();
 }
-inline void blockRelocPlan::add_todatanodeip(std::string&& value) {
-  _impl_.todatanodeip_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.todatanodeip)
+inline void NodeAndBlock::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.NodeAndBlock.key)
 }
-inline void blockRelocPlan::add_todatanodeip(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.todatanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.blockRelocPlan.todatanodeip)
+
+// int32 task_id = 6;
+inline void NodeAndBlock::clear_task_id() {
+  _impl_.task_id_ = 0;
 }
-inline void blockRelocPlan::add_todatanodeip(const char* value, size_t size) {
-  _impl_.todatanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.blockRelocPlan.todatanodeip)
+inline int32_t NodeAndBlock::_internal_task_id() const {
+  return _impl_.task_id_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-blockRelocPlan::todatanodeip() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.todatanodeip)
-  return _impl_.todatanodeip_;
+inline int32_t NodeAndBlock::task_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.task_id)
+  return _internal_task_id();
+}
+inline void NodeAndBlock::_internal_set_task_id(int32_t value) {
+  
+  _impl_.task_id_ = value;
+}
+inline void NodeAndBlock::set_task_id(int32_t value) {
+  _internal_set_task_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.task_id)
+}
+
+// -------------------------------------------------------------------
+
+// DelReply
+
+// bool ifcommit = 1;
+inline void DelReply::clear_ifcommit() {
+  _impl_.ifcommit_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-blockRelocPlan::mutable_todatanodeip() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.todatanodeip)
-  return &_impl_.todatanodeip_;
+inline bool DelReply::_internal_ifcommit() const {
+  return _impl_.ifcommit_;
 }
-
-// repeated int32 todatanodeport = 5;
-inline int blockRelocPlan::_internal_todatanodeport_size() const {
-  return _impl_.todatanodeport_.size();
+inline bool DelReply::ifcommit() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.DelReply.ifcommit)
+  return _internal_ifcommit();
 }
-inline int blockRelocPlan::todatanodeport_size() const {
-  return _internal_todatanodeport_size();
+inline void DelReply::_internal_set_ifcommit(bool value) {
+  
+  _impl_.ifcommit_ = value;
 }
-inline void blockRelocPlan::clear_todatanodeport() {
-  _impl_.todatanodeport_.Clear();
+inline void DelReply::set_ifcommit(bool value) {
+  _internal_set_ifcommit(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.DelReply.ifcommit)
 }
-inline int32_t blockRelocPlan::_internal_todatanodeport(int index) const {
-  return _impl_.todatanodeport_.Get(index);
+
+// -------------------------------------------------------------------
+
+// CheckaliveCMD
+
+// string name = 1;
+inline void CheckaliveCMD::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline int32_t blockRelocPlan::todatanodeport(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.todatanodeport)
-  return _internal_todatanodeport(index);
+inline const std::string& CheckaliveCMD::name() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.CheckaliveCMD.name)
+  return _internal_name();
 }
-inline void blockRelocPlan::set_todatanodeport(int index, int32_t value) {
-  _impl_.todatanodeport_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.todatanodeport)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CheckaliveCMD::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.CheckaliveCMD.name)
 }
-inline void blockRelocPlan::_internal_add_todatanodeport(int32_t value) {
-  _impl_.todatanodeport_.Add(value);
+inline std::string* CheckaliveCMD::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.CheckaliveCMD.name)
+  return _s;
 }
-inline void blockRelocPlan::add_todatanodeport(int32_t value) {
-  _internal_add_todatanodeport(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.blockRelocPlan.todatanodeport)
+inline const std::string& CheckaliveCMD::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-blockRelocPlan::_internal_todatanodeport() const {
-  return _impl_.todatanodeport_;
+inline void CheckaliveCMD::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-blockRelocPlan::todatanodeport() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.blockRelocPlan.todatanodeport)
-  return _internal_todatanodeport();
+inline std::string* CheckaliveCMD::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-blockRelocPlan::_internal_mutable_todatanodeport() {
-  return &_impl_.todatanodeport_;
+inline std::string* CheckaliveCMD::release_name() {
+  // @@protoc_insertion_point(field_release:proxy_proto.CheckaliveCMD.name)
+  return _impl_.name_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-blockRelocPlan::mutable_todatanodeport() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.blockRelocPlan.todatanodeport)
-  return _internal_mutable_todatanodeport();
+inline void CheckaliveCMD::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.CheckaliveCMD.name)
 }
 
-// int32 block_size = 6;
-inline void blockRelocPlan::clear_block_size() {
-  _impl_.block_size_ = 0;
+// -------------------------------------------------------------------
+
+// RequestResult
+
+// bool message = 1;
+inline void RequestResult::clear_message() {
+  _impl_.message_ = false;
 }
-inline int32_t blockRelocPlan::_internal_block_size() const {
-  return _impl_.block_size_;
+inline bool RequestResult::_internal_message() const {
+  return _impl_.message_;
 }
-inline int32_t blockRelocPlan::block_size() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocPlan.block_size)
-  return _internal_block_size();
+inline bool RequestResult::message() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.RequestResult.message)
+  return _internal_message();
 }
-inline void blockRelocPlan::_internal_set_block_size(int32_t value) {
+inline void RequestResult::_internal_set_message(bool value) {
   
-  _impl_.block_size_ = value;
+  _impl_.message_ = value;
 }
-inline void blockRelocPlan::set_block_size(int32_t value) {
-  _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocPlan.block_size)
+inline void RequestResult::set_message(bool value) {
+  _internal_set_message(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.RequestResult.message)
 }
 
 // -------------------------------------------------------------------
 
-// blockRelocReply
+// ObjectAndPlacement
 
-// string result = 1;
-inline void blockRelocReply::clear_result() {
-  _impl_.result_.ClearToEmpty();
+// string key = 1;
+inline void ObjectAndPlacement::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline const std::string& blockRelocReply::result() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.blockRelocReply.result)
-  return _internal_result();
+inline const std::string& ObjectAndPlacement::key() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.key)
+  return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void blockRelocReply::set_result(ArgT0&& arg0, ArgT... args) {
+void ObjectAndPlacement::set_key(ArgT0&& arg0, ArgT... args) {
  
- _impl_.result_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proxy_proto.blockRelocReply.result)
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.key)
 }
-inline std::string* blockRelocReply::mutable_result() {
-  std::string* _s = _internal_mutable_result();
-  // @@protoc_insertion_point(field_mutable:proxy_proto.blockRelocReply.result)
+inline std::string* ObjectAndPlacement::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.key)
   return _s;
 }
-inline const std::string& blockRelocReply::_internal_result() const {
-  return _impl_.result_.Get();
+inline const std::string& ObjectAndPlacement::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline void blockRelocReply::_internal_set_result(const std::string& value) {
+inline void ObjectAndPlacement::_internal_set_key(const std::string& value) {
   
-  _impl_.result_.Set(value, GetArenaForAllocation());
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* blockRelocReply::_internal_mutable_result() {
+inline std::string* ObjectAndPlacement::_internal_mutable_key() {
   
-  return _impl_.result_.Mutable(GetArenaForAllocation());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* blockRelocReply::release_result() {
-  // @@protoc_insertion_point(field_release:proxy_proto.blockRelocReply.result)
-  return _impl_.result_.Release();
+inline std::string* ObjectAndPlacement::release_key() {
+  // @@protoc_insertion_point(field_release:proxy_proto.ObjectAndPlacement.key)
+  return _impl_.key_.Release();
 }
-inline void blockRelocReply::set_allocated_result(std::string* result) {
-  if (result != nullptr) {
+inline void ObjectAndPlacement::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
     
   } else {
     
   }
-  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.result_.IsDefault()) {
-    _impl_.result_.Set("", GetArenaForAllocation());
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proxy_proto.blockRelocReply.result)
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.ObjectAndPlacement.key)
 }
 
-// -------------------------------------------------------------------
+// int32 valuesizebyte = 2;
+inline void ObjectAndPlacement::clear_valuesizebyte() {
+  _impl_.valuesizebyte_ = 0;
+}
+inline int32_t ObjectAndPlacement::_internal_valuesizebyte() const {
+  return _impl_.valuesizebyte_;
+}
+inline int32_t ObjectAndPlacement::valuesizebyte() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.valuesizebyte)
+  return _internal_valuesizebyte();
+}
+inline void ObjectAndPlacement::_internal_set_valuesizebyte(int32_t value) {
+  
+  _impl_.valuesizebyte_ = value;
+}
+inline void ObjectAndPlacement::set_valuesizebyte(int32_t value) {
+  _internal_set_valuesizebyte(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.valuesizebyte)
+}
 
-// AskIfSuccess
+// int32 k = 3;
+inline void ObjectAndPlacement::clear_k() {
+  _impl_.k_ = 0;
+}
+inline int32_t ObjectAndPlacement::_internal_k() const {
+  return _impl_.k_;
+}
+inline int32_t ObjectAndPlacement::k() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.k)
+  return _internal_k();
+}
+inline void ObjectAndPlacement::_internal_set_k(int32_t value) {
+  
+  _impl_.k_ = value;
+}
+inline void ObjectAndPlacement::set_k(int32_t value) {
+  _internal_set_k(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.k)
+}
 
-// int32 step = 1;
-inline void AskIfSuccess::clear_step() {
-  _impl_.step_ = 0;
+// int32 l = 4;
+inline void ObjectAndPlacement::clear_l() {
+  _impl_.l_ = 0;
 }
-inline int32_t AskIfSuccess::_internal_step() const {
-  return _impl_.step_;
+inline int32_t ObjectAndPlacement::_internal_l() const {
+  return _impl_.l_;
 }
-inline int32_t AskIfSuccess::step() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.AskIfSuccess.step)
-  return _internal_step();
+inline int32_t ObjectAndPlacement::l() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.l)
+  return _internal_l();
+}
+inline void ObjectAndPlacement::_internal_set_l(int32_t value) {
+  
+  _impl_.l_ = value;
+}
+inline void ObjectAndPlacement::set_l(int32_t value) {
+  _internal_set_l(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.l)
+}
+
+// int32 g_m = 5;
+inline void ObjectAndPlacement::clear_g_m() {
+  _impl_.g_m_ = 0;
+}
+inline int32_t ObjectAndPlacement::_internal_g_m() const {
+  return _impl_.g_m_;
+}
+inline int32_t ObjectAndPlacement::g_m() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.g_m)
+  return _internal_g_m();
 }
-inline void AskIfSuccess::_internal_set_step(int32_t value) {
+inline void ObjectAndPlacement::_internal_set_g_m(int32_t value) {
   
-  _impl_.step_ = value;
+  _impl_.g_m_ = value;
 }
-inline void AskIfSuccess::set_step(int32_t value) {
-  _internal_set_step(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.AskIfSuccess.step)
+inline void ObjectAndPlacement::set_g_m(int32_t value) {
+  _internal_set_g_m(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.g_m)
 }
 
-// -------------------------------------------------------------------
-
-// RepIfSuccess
-
-// bool ifsuccess = 1;
-inline void RepIfSuccess::clear_ifsuccess() {
-  _impl_.ifsuccess_ = false;
+// int32 stripe_id = 6;
+inline void ObjectAndPlacement::clear_stripe_id() {
+  _impl_.stripe_id_ = 0;
 }
-inline bool RepIfSuccess::_internal_ifsuccess() const {
-  return _impl_.ifsuccess_;
+inline int32_t ObjectAndPlacement::_internal_stripe_id() const {
+  return _impl_.stripe_id_;
 }
-inline bool RepIfSuccess::ifsuccess() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.RepIfSuccess.ifsuccess)
-  return _internal_ifsuccess();
+inline int32_t ObjectAndPlacement::stripe_id() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.stripe_id)
+  return _internal_stripe_id();
 }
-inline void RepIfSuccess::_internal_set_ifsuccess(bool value) {
+inline void ObjectAndPlacement::_internal_set_stripe_id(int32_t value) {
   
-  _impl_.ifsuccess_ = value;
+  _impl_.stripe_id_ = value;
 }
-inline void RepIfSuccess::set_ifsuccess(bool value) {
-  _internal_set_ifsuccess(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.RepIfSuccess.ifsuccess)
+inline void ObjectAndPlacement::set_stripe_id(int32_t value) {
+  _internal_set_stripe_id(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.stripe_id)
 }
 
-// -------------------------------------------------------------------
-
-// NodeAndBlock
-
-// repeated string blockkeys = 1;
-inline int NodeAndBlock::_internal_blockkeys_size() const {
-  return _impl_.blockkeys_.size();
+// repeated string datanodeip = 7;
+inline int ObjectAndPlacement::_internal_datanodeip_size() const {
+  return _impl_.datanodeip_.size();
 }
-inline int NodeAndBlock::blockkeys_size() const {
-  return _internal_blockkeys_size();
+inline int ObjectAndPlacement::datanodeip_size() const {
+  return _internal_datanodeip_size();
 }
-inline void NodeAndBlock::clear_blockkeys() {
-  _impl_.blockkeys_.Clear();
+inline void ObjectAndPlacement::clear_datanodeip() {
+  _impl_.datanodeip_.Clear();
 }
-inline std::string* NodeAndBlock::add_blockkeys() {
-  std::string* _s = _internal_add_blockkeys();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.NodeAndBlock.blockkeys)
+inline std::string* ObjectAndPlacement::add_datanodeip() {
+  std::string* _s = _internal_add_datanodeip();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.ObjectAndPlacement.datanodeip)
   return _s;
 }
-inline const std::string& NodeAndBlock::_internal_blockkeys(int index) const {
-  return _impl_.blockkeys_.Get(index);
+inline const std::string& ObjectAndPlacement::_internal_datanodeip(int index) const {
+  return _impl_.datanodeip_.Get(index);
 }
-inline const std::string& NodeAndBlock::blockkeys(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.blockkeys)
-  return _internal_blockkeys(index);
+inline const std::string& ObjectAndPlacement::datanodeip(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.datanodeip)
+  return _internal_datanodeip(index);
 }
-inline std::string* NodeAndBlock::mutable_blockkeys(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.NodeAndBlock.blockkeys)
-  return _impl_.blockkeys_.Mutable(index);
+inline std::string* ObjectAndPlacement::mutable_datanodeip(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.datanodeip)
+  return _impl_.datanodeip_.Mutable(index);
 }
-inline void NodeAndBlock::set_blockkeys(int index, const std::string& value) {
-  _impl_.blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.blockkeys)
+inline void ObjectAndPlacement::set_datanodeip(int index, const std::string& value) {
+  _impl_.datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.datanodeip)
 }
-inline void NodeAndBlock::set_blockkeys(int index, std::string&& value) {
-  _impl_.blockkeys_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.blockkeys)
+inline void ObjectAndPlacement::set_datanodeip(int index, std::string&& value) {
+  _impl_.datanodeip_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.datanodeip)
 }
-inline void NodeAndBlock::set_blockkeys(int index, const char* value) {
+inline void ObjectAndPlacement::set_datanodeip(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.NodeAndBlock.blockkeys)
+  _impl_.datanodeip_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.ObjectAndPlacement.datanodeip)
 }
-inline void NodeAndBlock::set_blockkeys(int index, const char* value, size_t size) {
-  _impl_.blockkeys_.Mutable(index)->assign(
+inline void ObjectAndPlacement::set_datanodeip(int index, const char* value, size_t size) {
+  _impl_.datanodeip_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.NodeAndBlock.blockkeys)
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.ObjectAndPlacement.datanodeip)
 }
-inline std::string* NodeAndBlock::_internal_add_blockkeys() {
-  return _impl_.blockkeys_.Add();
+inline std::string* ObjectAndPlacement::_internal_add_datanodeip() {
+  return _impl_.datanodeip_.Add();
 }
-inline void NodeAndBlock::add_blockkeys(const std::string& value) {
-  _impl_.blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.blockkeys)
+inline void ObjectAndPlacement::add_datanodeip(const std::string& value) {
+  _impl_.datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.datanodeip)
 }
-inline void NodeAndBlock::add_blockkeys(std::string&& value) {
-  _impl_.blockkeys_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.blockkeys)
+inline void ObjectAndPlacement::add_datanodeip(std::string&& value) {
+  _impl_.datanodeip_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.datanodeip)
 }
-inline void NodeAndBlock::add_blockkeys(const char* value) {
+inline void ObjectAndPlacement::add_datanodeip(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.NodeAndBlock.blockkeys)
+  _impl_.datanodeip_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.ObjectAndPlacement.datanodeip)
 }
-inline void NodeAndBlock::add_blockkeys(const char* value, size_t size) {
-  _impl_.blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.NodeAndBlock.blockkeys)
+inline void ObjectAndPlacement::add_datanodeip(const char* value, size_t size) {
+  _impl_.datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.ObjectAndPlacement.datanodeip)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-NodeAndBlock::blockkeys() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.NodeAndBlock.blockkeys)
-  return _impl_.blockkeys_;
+ObjectAndPlacement::datanodeip() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.datanodeip)
+  return _impl_.datanodeip_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-NodeAndBlock::mutable_blockkeys() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.NodeAndBlock.blockkeys)
-  return &_impl_.blockkeys_;
+ObjectAndPlacement::mutable_datanodeip() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.datanodeip)
+  return &_impl_.datanodeip_;
 }
 
-// repeated string datanodeip = 2;
-inline int NodeAndBlock::_internal_datanodeip_size() const {
-  return _impl_.datanodeip_.size();
+// repeated int32 datanodeport = 8;
+inline int ObjectAndPlacement::_internal_datanodeport_size() const {
+  return _impl_.datanodeport_.size();
 }
-inline int NodeAndBlock::datanodeip_size() const {
-  return _internal_datanodeip_size();
+inline int ObjectAndPlacement::datanodeport_size() const {
+  return _internal_datanodeport_size();
 }
-inline void NodeAndBlock::clear_datanodeip() {
-  _impl_.datanodeip_.Clear();
+inline void ObjectAndPlacement::clear_datanodeport() {
+  _impl_.datanodeport_.Clear();
 }
-inline std::string* NodeAndBlock::add_datanodeip() {
-  std::string* _s = _internal_add_datanodeip();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.NodeAndBlock.datanodeip)
+inline int32_t ObjectAndPlacement::_internal_datanodeport(int index) const {
+  return _impl_.datanodeport_.Get(index);
+}
+inline int32_t ObjectAndPlacement::datanodeport(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.datanodeport)
+  return _internal_datanodeport(index);
+}
+inline void ObjectAndPlacement::set_datanodeport(int index, int32_t value) {
+  _impl_.datanodeport_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.datanodeport)
+}
+inline void ObjectAndPlacement::_internal_add_datanodeport(int32_t value) {
+  _impl_.datanodeport_.Add(value);
+}
+inline void ObjectAndPlacement::add_datanodeport(int32_t value) {
+  _internal_add_datanodeport(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.datanodeport)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ObjectAndPlacement::_internal_datanodeport() const {
+  return _impl_.datanodeport_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ObjectAndPlacement::datanodeport() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.datanodeport)
+  return _internal_datanodeport();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ObjectAndPlacement::_internal_mutable_datanodeport() {
+  return &_impl_.datanodeport_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ObjectAndPlacement::mutable_datanodeport() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.datanodeport)
+  return _internal_mutable_datanodeport();
+}
+
+// repeated string blockkeys = 9;
+inline int ObjectAndPlacement::_internal_blockkeys_size() const {
+  return _impl_.blockkeys_.size();
+}
+inline int ObjectAndPlacement::blockkeys_size() const {
+  return _internal_blockkeys_size();
+}
+inline void ObjectAndPlacement::clear_blockkeys() {
+  _impl_.blockkeys_.Clear();
+}
+inline std::string* ObjectAndPlacement::add_blockkeys() {
+  std::string* _s = _internal_add_blockkeys();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.ObjectAndPlacement.blockkeys)
   return _s;
 }
-inline const std::string& NodeAndBlock::_internal_datanodeip(int index) const {
-  return _impl_.datanodeip_.Get(index);
+inline const std::string& ObjectAndPlacement::_internal_blockkeys(int index) const {
+  return _impl_.blockkeys_.Get(index);
 }
-inline const std::string& NodeAndBlock::datanodeip(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.datanodeip)
-  return _internal_datanodeip(index);
+inline const std::string& ObjectAndPlacement::blockkeys(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.blockkeys)
+  return _internal_blockkeys(index);
 }
-inline std::string* NodeAndBlock::mutable_datanodeip(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.NodeAndBlock.datanodeip)
-  return _impl_.datanodeip_.Mutable(index);
+inline std::string* ObjectAndPlacement::mutable_blockkeys(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.blockkeys)
+  return _impl_.blockkeys_.Mutable(index);
 }
-inline void NodeAndBlock::set_datanodeip(int index, const std::string& value) {
-  _impl_.datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.datanodeip)
+inline void ObjectAndPlacement::set_blockkeys(int index, const std::string& value) {
+  _impl_.blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.blockkeys)
 }
-inline void NodeAndBlock::set_datanodeip(int index, std::string&& value) {
-  _impl_.datanodeip_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.datanodeip)
+inline void ObjectAndPlacement::set_blockkeys(int index, std::string&& value) {
+  _impl_.blockkeys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.blockkeys)
 }
-inline void NodeAndBlock::set_datanodeip(int index, const char* value) {
+inline void ObjectAndPlacement::set_blockkeys(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.NodeAndBlock.datanodeip)
+  _impl_.blockkeys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.ObjectAndPlacement.blockkeys)
 }
-inline void NodeAndBlock::set_datanodeip(int index, const char* value, size_t size) {
-  _impl_.datanodeip_.Mutable(index)->assign(
+inline void ObjectAndPlacement::set_blockkeys(int index, const char* value, size_t size) {
+  _impl_.blockkeys_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.NodeAndBlock.datanodeip)
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.ObjectAndPlacement.blockkeys)
 }
-inline std::string* NodeAndBlock::_internal_add_datanodeip() {
-  return _impl_.datanodeip_.Add();
+inline std::string* ObjectAndPlacement::_internal_add_blockkeys() {
+  return _impl_.blockkeys_.Add();
 }
-inline void NodeAndBlock::add_datanodeip(const std::string& value) {
-  _impl_.datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.datanodeip)
+inline void ObjectAndPlacement::add_blockkeys(const std::string& value) {
+  _impl_.blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.blockkeys)
 }
-inline void NodeAndBlock::add_datanodeip(std::string&& value) {
-  _impl_.datanodeip_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.datanodeip)
+inline void ObjectAndPlacement::add_blockkeys(std::string&& value) {
+  _impl_.blockkeys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.blockkeys)
 }
-inline void NodeAndBlock::add_datanodeip(const char* value) {
+inline void ObjectAndPlacement::add_blockkeys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.NodeAndBlock.datanodeip)
+  _impl_.blockkeys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.ObjectAndPlacement.blockkeys)
 }
-inline void NodeAndBlock::add_datanodeip(const char* value, size_t size) {
-  _impl_.datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.NodeAndBlock.datanodeip)
+inline void ObjectAndPlacement::add_blockkeys(const char* value, size_t size) {
+  _impl_.blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.ObjectAndPlacement.blockkeys)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-NodeAndBlock::datanodeip() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.NodeAndBlock.datanodeip)
-  return _impl_.datanodeip_;
+ObjectAndPlacement::blockkeys() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.blockkeys)
+  return _impl_.blockkeys_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-NodeAndBlock::mutable_datanodeip() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.NodeAndBlock.datanodeip)
-  return &_impl_.datanodeip_;
+ObjectAndPlacement::mutable_blockkeys() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.blockkeys)
+  return &_impl_.blockkeys_;
 }
 
-// repeated int32 datanodeport = 3;
-inline int NodeAndBlock::_internal_datanodeport_size() const {
-  return _impl_.datanodeport_.size();
+// repeated int32 blockids = 10;
+inline int ObjectAndPlacement::_internal_blockids_size() const {
+  return _impl_.blockids_.size();
 }
-inline int NodeAndBlock::datanodeport_size() const {
-  return _internal_datanodeport_size();
+inline int ObjectAndPlacement::blockids_size() const {
+  return _internal_blockids_size();
 }
-inline void NodeAndBlock::clear_datanodeport() {
-  _impl_.datanodeport_.Clear();
+inline void ObjectAndPlacement::clear_blockids() {
+  _impl_.blockids_.Clear();
 }
-inline int32_t NodeAndBlock::_internal_datanodeport(int index) const {
-  return _impl_.datanodeport_.Get(index);
+inline int32_t ObjectAndPlacement::_internal_blockids(int index) const {
+  return _impl_.blockids_.Get(index);
 }
-inline int32_t NodeAndBlock::datanodeport(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.datanodeport)
-  return _internal_datanodeport(index);
+inline int32_t ObjectAndPlacement::blockids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.blockids)
+  return _internal_blockids(index);
 }
-inline void NodeAndBlock::set_datanodeport(int index, int32_t value) {
-  _impl_.datanodeport_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.datanodeport)
+inline void ObjectAndPlacement::set_blockids(int index, int32_t value) {
+  _impl_.blockids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.blockids)
 }
-inline void NodeAndBlock::_internal_add_datanodeport(int32_t value) {
-  _impl_.datanodeport_.Add(value);
+inline void ObjectAndPlacement::_internal_add_blockids(int32_t value) {
+  _impl_.blockids_.Add(value);
 }
-inline void NodeAndBlock::add_datanodeport(int32_t value) {
-  _internal_add_datanodeport(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.NodeAndBlock.datanodeport)
+inline void ObjectAndPlacement::add_blockids(int32_t value) {
+  _internal_add_blockids(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.blockids)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-NodeAndBlock::_internal_datanodeport() const {
-  return _impl_.datanodeport_;
+ObjectAndPlacement::_internal_blockids() const {
+  return _impl_.blockids_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-NodeAndBlock::datanodeport() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.NodeAndBlock.datanodeport)
-  return _internal_datanodeport();
+ObjectAndPlacement::blockids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.blockids)
+  return _internal_blockids();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-NodeAndBlock::_internal_mutable_datanodeport() {
-  return &_impl_.datanodeport_;
+ObjectAndPlacement::_internal_mutable_blockids() {
+  return &_impl_.blockids_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-NodeAndBlock::mutable_datanodeport() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.NodeAndBlock.datanodeport)
-  return _internal_mutable_datanodeport();
+ObjectAndPlacement::mutable_blockids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.blockids)
+  return _internal_mutable_blockids();
 }
 
-// int32 stripe_id = 4;
-inline void NodeAndBlock::clear_stripe_id() {
-  _impl_.stripe_id_ = 0;
+// int32 block_size = 11;
+inline void ObjectAndPlacement::clear_block_size() {
+  _impl_.block_size_ = 0;
 }
-inline int32_t NodeAndBlock::_internal_stripe_id() const {
-  return _impl_.stripe_id_;
+inline int32_t ObjectAndPlacement::_internal_block_size() const {
+  return _impl_.block_size_;
 }
-inline int32_t NodeAndBlock::stripe_id() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.stripe_id)
-  return _internal_stripe_id();
+inline int32_t ObjectAndPlacement::block_size() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.block_size)
+  return _internal_block_size();
 }
-inline void NodeAndBlock::_internal_set_stripe_id(int32_t value) {
+inline void ObjectAndPlacement::_internal_set_block_size(int32_t value) {
   
-  _impl_.stripe_id_ = value;
+  _impl_.block_size_ = value;
 }
-inline void NodeAndBlock::set_stripe_id(int32_t value) {
-  _internal_set_stripe_id(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.stripe_id)
+inline void ObjectAndPlacement::set_block_size(int32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.block_size)
 }
 
-// string key = 5;
-inline void NodeAndBlock::clear_key() {
-  _impl_.key_.ClearToEmpty();
+// int32 encode_type = 12;
+inline void ObjectAndPlacement::clear_encode_type() {
+  _impl_.encode_type_ = 0;
 }
-inline const std::string& NodeAndBlock::key() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.NodeAndBlock.key)
-  return _internal_key();
+inline int32_t ObjectAndPlacement::_internal_encode_type() const {
+  return _impl_.encode_type_;
+}
+inline int32_t ObjectAndPlacement::encode_type() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.encode_type)
+  return _internal_encode_type();
+}
+inline void ObjectAndPlacement::_internal_set_encode_type(int32_t value) {
+  
+  _impl_.encode_type_ = value;
+}
+inline void ObjectAndPlacement::set_encode_type(int32_t value) {
+  _internal_set_encode_type(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.encode_type)
+}
+
+// string clientip = 13;
+inline void ObjectAndPlacement::clear_clientip() {
+  _impl_.clientip_.ClearToEmpty();
+}
+inline const std::string& ObjectAndPlacement::clientip() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.clientip)
+  return _internal_clientip();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void NodeAndBlock::set_key(ArgT0&& arg0, ArgT... args) {
+void ObjectAndPlacement::set_clientip(ArgT0&& arg0, ArgT... args) {
  
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proxy_proto.NodeAndBlock.key)
+ _impl_.clientip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.clientip)
 }
-inline std::string* NodeAndBlock::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:proxy_proto.NodeAndBlock.key)
+inline std::string* ObjectAndPlacement::mutable_clientip() {
+  std::string* _s = _internal_mutable_clientip();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.clientip)
   return _s;
 }
-inline const std::string& NodeAndBlock::_internal_key() const {
-  return _impl_.key_.Get();
+inline const std::string& ObjectAndPlacement::_internal_clientip() const {
+  return _impl_.clientip_.Get();
 }
-inline void NodeAndBlock::_internal_set_key(const std::string& value) {
+inline void ObjectAndPlacement::_internal_set_clientip(const std::string& value) {
   
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.clientip_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NodeAndBlock::_internal_mutable_key() {
+inline std::string* ObjectAndPlacement::_internal_mutable_clientip() {
   
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+  return _impl_.clientip_.Mutable(GetArenaForAllocation());
 }
-inline std::string* NodeAndBlock::release_key() {
-  // @@protoc_insertion_point(field_release:proxy_proto.NodeAndBlock.key)
-  return _impl_.key_.Release();
+inline std::string* ObjectAndPlacement::release_clientip() {
+  // @@protoc_insertion_point(field_release:proxy_proto.ObjectAndPlacement.clientip)
+  return _impl_.clientip_.Release();
 }
-inline void NodeAndBlock::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+inline void ObjectAndPlacement::set_allocated_clientip(std::string* clientip) {
+  if (clientip != nullptr) {
     
   } else {
     
   }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+  _impl_.clientip_.SetAllocated(clientip, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.clientip_.IsDefault()) {
+    _impl_.clientip_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proxy_proto.NodeAndBlock.key)
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.ObjectAndPlacement.clientip)
+}
+
+// int32 clientport = 14;
+inline void ObjectAndPlacement::clear_clientport() {
+  _impl_.clientport_ = 0;
+}
+inline int32_t ObjectAndPlacement::_internal_clientport() const {
+  return _impl_.clientport_;
+}
+inline int32_t ObjectAndPlacement::clientport() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.clientport)
+  return _internal_clientport();
+}
+inline void ObjectAndPlacement::_internal_set_clientport(int32_t value) {
+  
+  _impl_.clientport_ = value;
+}
+inline void ObjectAndPlacement::set_clientport(int32_t value) {
+  _internal_set_clientport(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.clientport)
+}
+
+// repeated bool islocal = 15;
+inline int ObjectAndPlacement::_internal_islocal_size() const {
+  return _impl_.islocal_.size();
+}
+inline int ObjectAndPlacement::islocal_size() const {
+  return _internal_islocal_size();
+}
+inline void ObjectAndPlacement::clear_islocal() {
+  _impl_.islocal_.Clear();
+}
+inline bool ObjectAndPlacement::_internal_islocal(int index) const {
+  return _impl_.islocal_.Get(index);
+}
+inline bool ObjectAndPlacement::islocal(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.islocal)
+  return _internal_islocal(index);
+}
+inline void ObjectAndPlacement::set_islocal(int index, bool value) {
+  _impl_.islocal_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.islocal)
+}
+inline void ObjectAndPlacement::_internal_add_islocal(bool value) {
+  _impl_.islocal_.Add(value);
+}
+inline void ObjectAndPlacement::add_islocal(bool value) {
+  _internal_add_islocal(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.islocal)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+ObjectAndPlacement::_internal_islocal() const {
+  return _impl_.islocal_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+ObjectAndPlacement::islocal() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.islocal)
+  return _internal_islocal();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+ObjectAndPlacement::_internal_mutable_islocal() {
+  return &_impl_.islocal_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+ObjectAndPlacement::mutable_islocal() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.islocal)
+  return _internal_mutable_islocal();
+}
+
+// bool if_partial_decoding = 16;
+inline void ObjectAndPlacement::clear_if_partial_decoding() {
+  _impl_.if_partial_decoding_ = false;
+}
+inline bool ObjectAndPlacement::_internal_if_partial_decoding() const {
+  return _impl_.if_partial_decoding_;
+}
+inline bool ObjectAndPlacement::if_partial_decoding() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.if_partial_decoding)
+  return _internal_if_partial_decoding();
+}
+inline void ObjectAndPlacement::_internal_set_if_partial_decoding(bool value) {
+  
+  _impl_.if_partial_decoding_ = value;
+}
+inline void ObjectAndPlacement::set_if_partial_decoding(bool value) {
+  _internal_set_if_partial_decoding(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.if_partial_decoding)
+}
+
+// repeated int32 clusterids = 17;
+inline int ObjectAndPlacement::_internal_clusterids_size() const {
+  return _impl_.clusterids_.size();
+}
+inline int ObjectAndPlacement::clusterids_size() const {
+  return _internal_clusterids_size();
+}
+inline void ObjectAndPlacement::clear_clusterids() {
+  _impl_.clusterids_.Clear();
+}
+inline int32_t ObjectAndPlacement::_internal_clusterids(int index) const {
+  return _impl_.clusterids_.Get(index);
+}
+inline int32_t ObjectAndPlacement::clusterids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.clusterids)
+  return _internal_clusterids(index);
+}
+inline void ObjectAndPlacement::set_clusterids(int index, int32_t value) {
+  _impl_.clusterids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.clusterids)
+}
+inline void ObjectAndPlacement::_internal_add_clusterids(int32_t value) {
+  _impl_.clusterids_.Add(value);
+}
+inline void ObjectAndPlacement::add_clusterids(int32_t value) {
+  _internal_add_clusterids(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.clusterids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ObjectAndPlacement::_internal_clusterids() const {
+  return _impl_.clusterids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ObjectAndPlacement::clusterids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.clusterids)
+  return _internal_clusterids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ObjectAndPlacement::_internal_mutable_clusterids() {
+  return &_impl_.clusterids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ObjectAndPlacement::mutable_clusterids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.clusterids)
+  return _internal_mutable_clusterids();
 }
 
-// -------------------------------------------------------------------
-
-// DelReply
-
-// bool ifcommit = 1;
-inline void DelReply::clear_ifcommit() {
-  _impl_.ifcommit_ = false;
+// bool with_key_size = 18;
+inline void ObjectAndPlacement::clear_with_key_size() {
+  _impl_.with_key_size_ = false;
 }
-inline bool DelReply::_internal_ifcommit() const {
-  return _impl_.ifcommit_;
+inline bool ObjectAndPlacement::_internal_with_key_size() const {
+  return _impl_.with_key_size_;
 }
-inline bool DelReply::ifcommit() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.DelReply.ifcommit)
-  return _internal_ifcommit();
+inline bool ObjectAndPlacement::with_key_size() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.with_key_size)
+  return _internal_with_key_size();
 }
-inline void DelReply::_internal_set_ifcommit(bool value) {
+inline void ObjectAndPlacement::_internal_set_with_key_size(bool value) {
   
-  _impl_.ifcommit_ = value;
+  _impl_.with_key_size_ = value;
 }
-inline void DelReply::set_ifcommit(bool value) {
-  _internal_set_ifcommit(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.DelReply.ifcommit)
+inline void ObjectAndPlacement::set_with_key_size(bool value) {
+  _internal_set_with_key_size(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.with_key_size)
 }
 
-// -------------------------------------------------------------------
+// int32 offset = 19;
+inline void ObjectAndPlacement::clear_offset() {
+  _impl_.offset_ = 0;
+}
+inline int32_t ObjectAndPlacement::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int32_t ObjectAndPlacement::offset() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.offset)
+  return _internal_offset();
+}
+inline void ObjectAndPlacement::_internal_set_offset(int32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void ObjectAndPlacement::set_offset(int32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.offset)
+}
 
-// CheckaliveCMD
+// bool packed = 20;
+inline void ObjectAndPlacement::clear_packed() {
+  _impl_.packed_ = false;
+}
+inline bool ObjectAndPlacement::_internal_packed() const {
+  return _impl_.packed_;
+}
+inline bool ObjectAndPlacement::packed() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.packed)
+  return _internal_packed();
+}
+inline void ObjectAndPlacement::_internal_set_packed(bool value) {
+  
+  _impl_.packed_ = value;
+}
+inline void ObjectAndPlacement::set_packed(bool value) {
+  _internal_set_packed(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.packed)
+}
 
-// string name = 1;
-inline void CheckaliveCMD::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// repeated string packed_keys = 21;
+inline int ObjectAndPlacement::_internal_packed_keys_size() const {
+  return _impl_.packed_keys_.size();
 }
-inline const std::string& CheckaliveCMD::name() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.CheckaliveCMD.name)
-  return _internal_name();
+inline int ObjectAndPlacement::packed_keys_size() const {
+  return _internal_packed_keys_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void CheckaliveCMD::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proxy_proto.CheckaliveCMD.name)
+inline void ObjectAndPlacement::clear_packed_keys() {
+  _impl_.packed_keys_.Clear();
 }
-inline std::string* CheckaliveCMD::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:proxy_proto.CheckaliveCMD.name)
+inline std::string* ObjectAndPlacement::add_packed_keys() {
+  std::string* _s = _internal_add_packed_keys();
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.ObjectAndPlacement.packed_keys)
   return _s;
 }
-inline const std::string& CheckaliveCMD::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& ObjectAndPlacement::_internal_packed_keys(int index) const {
+  return _impl_.packed_keys_.Get(index);
 }
-inline void CheckaliveCMD::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+inline const std::string& ObjectAndPlacement::packed_keys(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.packed_keys)
+  return _internal_packed_keys(index);
 }
-inline std::string* CheckaliveCMD::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline std::string* ObjectAndPlacement::mutable_packed_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.packed_keys)
+  return _impl_.packed_keys_.Mutable(index);
 }
-inline std::string* CheckaliveCMD::release_name() {
-  // @@protoc_insertion_point(field_release:proxy_proto.CheckaliveCMD.name)
-  return _impl_.name_.Release();
+inline void ObjectAndPlacement::set_packed_keys(int index, const std::string& value) {
+  _impl_.packed_keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.packed_keys)
 }
-inline void CheckaliveCMD::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proxy_proto.CheckaliveCMD.name)
+inline void ObjectAndPlacement::set_packed_keys(int index, std::string&& value) {
+  _impl_.packed_keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.packed_keys)
 }
-
-// -------------------------------------------------------------------
-
-// RequestResult
-
-// bool message = 1;
-inline void RequestResult::clear_message() {
-  _impl_.message_ = false;
+inline void ObjectAndPlacement::set_packed_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.packed_keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proxy_proto.ObjectAndPlacement.packed_keys)
 }
-inline bool RequestResult::_internal_message() const {
-  return _impl_.message_;
+inline void ObjectAndPlacement::set_packed_keys(int index, const char* value, size_t size) {
+  _impl_.packed_keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.ObjectAndPlacement.packed_keys)
 }
-inline bool RequestResult::message() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.RequestResult.message)
-  return _internal_message();
+inline std::string* ObjectAndPlacement::_internal_add_packed_keys() {
+  return _impl_.packed_keys_.Add();
 }
-inline void RequestResult::_internal_set_message(bool value) {
-  
-  _impl_.message_ = value;
+inline void ObjectAndPlacement::add_packed_keys(const std::string& value) {
+  _impl_.packed_keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.packed_keys)
 }
-inline void RequestResult::set_message(bool value) {
-  _internal_set_message(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.RequestResult.message)
+inline void ObjectAndPlacement::add_packed_keys(std::string&& value) {
+  _impl_.packed_keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.packed_keys)
+}
+inline void ObjectAndPlacement::add_packed_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.packed_keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proxy_proto.ObjectAndPlacement.packed_keys)
+}
+inline void ObjectAndPlacement::add_packed_keys(const char* value, size_t size) {
+  _impl_.packed_keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.ObjectAndPlacement.packed_keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ObjectAndPlacement::packed_keys() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.packed_keys)
+  return _impl_.packed_keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ObjectAndPlacement::mutable_packed_keys() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.packed_keys)
+  return &_impl_.packed_keys_;
 }
 
 // -------------------------------------------------------------------
 
-// ObjectAndPlacement
+// ObjectBatch
 
-// string key = 1;
-inline void ObjectAndPlacement::clear_key() {
-  _impl_.key_.ClearToEmpty();
+// repeated .proxy_proto.ObjectAndPlacement objects = 1;
+inline int ObjectBatch::_internal_objects_size() const {
+  return _impl_.objects_.size();
 }
-inline const std::string& ObjectAndPlacement::key() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.key)
-  return _internal_key();
+inline int ObjectBatch::objects_size() const {
+  return _internal_objects_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ObjectAndPlacement::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.key)
+inline void ObjectBatch::clear_objects() {
+  _impl_.objects_.Clear();
 }
-inline std::string* ObjectAndPlacement::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.key)
-  return _s;
+inline ::proxy_proto::ObjectAndPlacement* ObjectBatch::mutable_objects(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectBatch.objects)
+  return _impl_.objects_.Mutable(index);
 }
-inline const std::string& ObjectAndPlacement::_internal_key() const {
-  return _impl_.key_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::ObjectAndPlacement >*
+ObjectBatch::mutable_objects() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectBatch.objects)
+  return &_impl_.objects_;
 }
-inline void ObjectAndPlacement::_internal_set_key(const std::string& value) {
-  
-  _impl_.key_.Set(value, GetArenaForAllocation());
+inline const ::proxy_proto::ObjectAndPlacement& ObjectBatch::_internal_objects(int index) const {
+  return _impl_.objects_.Get(index);
 }
-inline std::string* ObjectAndPlacement::_internal_mutable_key() {
-  
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+inline const ::proxy_proto::ObjectAndPlacement& ObjectBatch::objects(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.ObjectBatch.objects)
+  return _internal_objects(index);
 }
-inline std::string* ObjectAndPlacement::release_key() {
-  // @@protoc_insertion_point(field_release:proxy_proto.ObjectAndPlacement.key)
-  return _impl_.key_.Release();
+inline ::proxy_proto::ObjectAndPlacement* ObjectBatch::_internal_add_objects() {
+  return _impl_.objects_.Add();
 }
-inline void ObjectAndPlacement::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proxy_proto.ObjectAndPlacement.key)
+inline ::proxy_proto::ObjectAndPlacement* ObjectBatch::add_objects() {
+  ::proxy_proto::ObjectAndPlacement* _add = _internal_add_objects();
+  // @@protoc_insertion_point(field_add:proxy_proto.ObjectBatch.objects)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proxy_proto::ObjectAndPlacement >&
+ObjectBatch::objects() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.ObjectBatch.objects)
+  return _impl_.objects_;
 }
 
-// int32 valuesizebyte = 2;
-inline void ObjectAndPlacement::clear_valuesizebyte() {
-  _impl_.valuesizebyte_ = 0;
+// -------------------------------------------------------------------
+
+// SetReply
+
+// bool ifcommit = 1;
+inline void SetReply::clear_ifcommit() {
+  _impl_.ifcommit_ = false;
 }
-inline int32_t ObjectAndPlacement::_internal_valuesizebyte() const {
-  return _impl_.valuesizebyte_;
+inline bool SetReply::_internal_ifcommit() const {
+  return _impl_.ifcommit_;
 }
-inline int32_t ObjectAndPlacement::valuesizebyte() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.valuesizebyte)
-  return _internal_valuesizebyte();
+inline bool SetReply::ifcommit() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.SetReply.ifcommit)
+  return _internal_ifcommit();
 }
-inline void ObjectAndPlacement::_internal_set_valuesizebyte(int32_t value) {
+inline void SetReply::_internal_set_ifcommit(bool value) {
   
-  _impl_.valuesizebyte_ = value;
+  _impl_.ifcommit_ = value;
 }
-inline void ObjectAndPlacement::set_valuesizebyte(int32_t value) {
-  _internal_set_valuesizebyte(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.valuesizebyte)
+inline void SetReply::set_ifcommit(bool value) {
+  _internal_set_ifcommit(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.SetReply.ifcommit)
 }
 
-// int32 k = 3;
-inline void ObjectAndPlacement::clear_k() {
-  _impl_.k_ = 0;
+// -------------------------------------------------------------------
+
+// GetReply
+
+// bool getsuccess = 1;
+inline void GetReply::clear_getsuccess() {
+  _impl_.getsuccess_ = false;
 }
-inline int32_t ObjectAndPlacement::_internal_k() const {
-  return _impl_.k_;
+inline bool GetReply::_internal_getsuccess() const {
+  return _impl_.getsuccess_;
 }
-inline int32_t ObjectAndPlacement::k() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.k)
-  return _internal_k();
+inline bool GetReply::getsuccess() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.GetReply.getsuccess)
+  return _internal_getsuccess();
 }
-inline void ObjectAndPlacement::_internal_set_k(int32_t value) {
+inline void GetReply::_internal_set_getsuccess(bool value) {
   
-  _impl_.k_ = value;
+  _impl_.getsuccess_ = value;
 }
-inline void ObjectAndPlacement::set_k(int32_t value) {
-  _internal_set_k(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.k)
+inline void GetReply::set_getsuccess(bool value) {
+  _internal_set_getsuccess(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.GetReply.getsuccess)
 }
 
-// int32 l = 4;
-inline void ObjectAndPlacement::clear_l() {
-  _impl_.l_ = 0;
-}
-inline int32_t ObjectAndPlacement::_internal_l() const {
-  return _impl_.l_;
-}
-inline int32_t ObjectAndPlacement::l() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.l)
-  return _internal_l();
+// -------------------------------------------------------------------
+
+// helpDecodePlan
+
+// string mainproxyip = 1;
+inline void helpDecodePlan::clear_mainproxyip() {
+  _impl_.mainproxyip_.ClearToEmpty();
 }
-inline void ObjectAndPlacement::_internal_set_l(int32_t value) {
-  
-  _impl_.l_ = value;
+inline const std::string& helpDecodePlan::mainproxyip() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.mainproxyip)
+  return _internal_mainproxyip();
 }
-inline void ObjectAndPlacement::set_l(int32_t value) {
-  _internal_set_l(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.l)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void helpDecodePlan::set_mainproxyip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mainproxyip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.mainproxyip)
 }
-
-// int32 g_m = 5;
-inline void ObjectAndPlacement::clear_g_m() {
-  _impl_.g_m_ = 0;
+inline std::string* helpDecodePlan::mutable_mainproxyip() {
+  std::string* _s = _internal_mutable_mainproxyip();
+  // @@protoc_insertion_point(field_mutable:proxy_proto.helpDecodePlan.mainproxyip)
+  return _s;
 }
-inline int32_t ObjectAndPlacement::_internal_g_m() const {
-  return _impl_.g_m_;
+inline const std::string& helpDecodePlan::_internal_mainproxyip() const {
+  return _impl_.mainproxyip_.Get();
 }
-inline int32_t ObjectAndPlacement::g_m() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.g_m)
-  return _internal_g_m();
+inline void helpDecodePlan::_internal_set_mainproxyip(const std::string& value) {
+  
+  _impl_.mainproxyip_.Set(value, GetArenaForAllocation());
 }
-inline void ObjectAndPlacement::_internal_set_g_m(int32_t value) {
+inline std::string* helpDecodePlan::_internal_mutable_mainproxyip() {
   
-  _impl_.g_m_ = value;
+  return _impl_.mainproxyip_.Mutable(GetArenaForAllocation());
 }
-inline void ObjectAndPlacement::set_g_m(int32_t value) {
-  _internal_set_g_m(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.g_m)
+inline std::string* helpDecodePlan::release_mainproxyip() {
+  // @@protoc_insertion_point(field_release:proxy_proto.helpDecodePlan.mainproxyip)
+  return _impl_.mainproxyip_.Release();
+}
+inline void helpDecodePlan::set_allocated_mainproxyip(std::string* mainproxyip) {
+  if (mainproxyip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.mainproxyip_.SetAllocated(mainproxyip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mainproxyip_.IsDefault()) {
+    _impl_.mainproxyip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proxy_proto.helpDecodePlan.mainproxyip)
 }
 
-// int32 stripe_id = 6;
-inline void ObjectAndPlacement::clear_stripe_id() {
-  _impl_.stripe_id_ = 0;
+// int32 mainproxyport = 2;
+inline void helpDecodePlan::clear_mainproxyport() {
+  _impl_.mainproxyport_ = 0;
 }
-inline int32_t ObjectAndPlacement::_internal_stripe_id() const {
-  return _impl_.stripe_id_;
+inline int32_t helpDecodePlan::_internal_mainproxyport() const {
+  return _impl_.mainproxyport_;
 }
-inline int32_t ObjectAndPlacement::stripe_id() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.stripe_id)
-  return _internal_stripe_id();
+inline int32_t helpDecodePlan::mainproxyport() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.mainproxyport)
+  return _internal_mainproxyport();
 }
-inline void ObjectAndPlacement::_internal_set_stripe_id(int32_t value) {
+inline void helpDecodePlan::_internal_set_mainproxyport(int32_t value) {
   
-  _impl_.stripe_id_ = value;
+  _impl_.mainproxyport_ = value;
 }
-inline void ObjectAndPlacement::set_stripe_id(int32_t value) {
-  _internal_set_stripe_id(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.stripe_id)
+inline void helpDecodePlan::set_mainproxyport(int32_t value) {
+  _internal_set_mainproxyport(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.mainproxyport)
 }
 
-// repeated string datanodeip = 7;
-inline int ObjectAndPlacement::_internal_datanodeip_size() const {
+// repeated string datanodeip = 3;
+inline int helpDecodePlan::_internal_datanodeip_size() const {
   return _impl_.datanodeip_.size();
 }
-inline int ObjectAndPlacement::datanodeip_size() const {
+inline int helpDecodePlan::datanodeip_size() const {
   return _internal_datanodeip_size();
 }
-inline void ObjectAndPlacement::clear_datanodeip() {
+inline void helpDecodePlan::clear_datanodeip() {
   _impl_.datanodeip_.Clear();
 }
-inline std::string* ObjectAndPlacement::add_datanodeip() {
+inline std::string* helpDecodePlan::add_datanodeip() {
   std::string* _s = _internal_add_datanodeip();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.helpDecodePlan.datanodeip)
   return _s;
 }
-inline const std::string& ObjectAndPlacement::_internal_datanodeip(int index) const {
+inline const std::string& helpDecodePlan::_internal_datanodeip(int index) const {
   return _impl_.datanodeip_.Get(index);
 }
-inline const std::string& ObjectAndPlacement::datanodeip(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.datanodeip)
+inline const std::string& helpDecodePlan::datanodeip(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.datanodeip)
   return _internal_datanodeip(index);
 }
-inline std::string* ObjectAndPlacement::mutable_datanodeip(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.datanodeip)
+inline std::string* helpDecodePlan::mutable_datanodeip(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.helpDecodePlan.datanodeip)
   return _impl_.datanodeip_.Mutable(index);
 }
-inline void ObjectAndPlacement::set_datanodeip(int index, const std::string& value) {
+inline void helpDecodePlan::set_datanodeip(int index, const std::string& value) {
   _impl_.datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.datanodeip)
 }
-inline void ObjectAndPlacement::set_datanodeip(int index, std::string&& value) {
+inline void helpDecodePlan::set_datanodeip(int index, std::string&& value) {
   _impl_.datanodeip_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.datanodeip)
 }
-inline void ObjectAndPlacement::set_datanodeip(int index, const char* value) {
+inline void helpDecodePlan::set_datanodeip(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.datanodeip_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_set_char:proxy_proto.helpDecodePlan.datanodeip)
 }
-inline void ObjectAndPlacement::set_datanodeip(int index, const char* value, size_t size) {
+inline void helpDecodePlan::set_datanodeip(int index, const char* value, size_t size) {
   _impl_.datanodeip_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.helpDecodePlan.datanodeip)
 }
-inline std::string* ObjectAndPlacement::_internal_add_datanodeip() {
+inline std::string* helpDecodePlan::_internal_add_datanodeip() {
   return _impl_.datanodeip_.Add();
 }
-inline void ObjectAndPlacement::add_datanodeip(const std::string& value) {
+inline void helpDecodePlan::add_datanodeip(const std::string& value) {
   _impl_.datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_add:proxy_proto.helpDecodePlan.datanodeip)
 }
-inline void ObjectAndPlacement::add_datanodeip(std::string&& value) {
+inline void helpDecodePlan::add_datanodeip(std::string&& value) {
   _impl_.datanodeip_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_add:proxy_proto.helpDecodePlan.datanodeip)
 }
-inline void ObjectAndPlacement::add_datanodeip(const char* value) {
+inline void helpDecodePlan::add_datanodeip(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.datanodeip_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_add_char:proxy_proto.helpDecodePlan.datanodeip)
 }
-inline void ObjectAndPlacement::add_datanodeip(const char* value, size_t size) {
+inline void helpDecodePlan::add_datanodeip(const char* value, size_t size) {
   _impl_.datanodeip_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.ObjectAndPlacement.datanodeip)
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.helpDecodePlan.datanodeip)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-ObjectAndPlacement::datanodeip() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.datanodeip)
+helpDecodePlan::datanodeip() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpDecodePlan.datanodeip)
   return _impl_.datanodeip_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-ObjectAndPlacement::mutable_datanodeip() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.datanodeip)
+helpDecodePlan::mutable_datanodeip() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpDecodePlan.datanodeip)
   return &_impl_.datanodeip_;
 }
 
-// repeated int32 datanodeport = 8;
-inline int ObjectAndPlacement::_internal_datanodeport_size() const {
+// repeated int32 datanodeport = 4;
+inline int helpDecodePlan::_internal_datanodeport_size() const {
   return _impl_.datanodeport_.size();
 }
-inline int ObjectAndPlacement::datanodeport_size() const {
+inline int helpDecodePlan::datanodeport_size() const {
   return _internal_datanodeport_size();
 }
-inline void ObjectAndPlacement::clear_datanodeport() {
+inline void helpDecodePlan::clear_datanodeport() {
   _impl_.datanodeport_.Clear();
 }
-inline int32_t ObjectAndPlacement::_internal_datanodeport(int index) const {
+inline int32_t helpDecodePlan::_internal_datanodeport(int index) const {
   return _impl_.datanodeport_.Get(index);
 }
-inline int32_t ObjectAndPlacement::datanodeport(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.datanodeport)
+inline int32_t helpDecodePlan::datanodeport(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.datanodeport)
   return _internal_datanodeport(index);
 }
-inline void ObjectAndPlacement::set_datanodeport(int index, int32_t value) {
+inline void helpDecodePlan::set_datanodeport(int index, int32_t value) {
   _impl_.datanodeport_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.datanodeport)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.datanodeport)
 }
-inline void ObjectAndPlacement::_internal_add_datanodeport(int32_t value) {
+inline void helpDecodePlan::_internal_add_datanodeport(int32_t value) {
   _impl_.datanodeport_.Add(value);
 }
-inline void ObjectAndPlacement::add_datanodeport(int32_t value) {
+inline void helpDecodePlan::add_datanodeport(int32_t value) {
   _internal_add_datanodeport(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.datanodeport)
+  // @@protoc_insertion_point(field_add:proxy_proto.helpDecodePlan.datanodeport)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-ObjectAndPlacement::_internal_datanodeport() const {
+helpDecodePlan::_internal_datanodeport() const {
   return _impl_.datanodeport_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-ObjectAndPlacement::datanodeport() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.datanodeport)
+helpDecodePlan::datanodeport() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpDecodePlan.datanodeport)
   return _internal_datanodeport();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-ObjectAndPlacement::_internal_mutable_datanodeport() {
+helpDecodePlan::_internal_mutable_datanodeport() {
   return &_impl_.datanodeport_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-ObjectAndPlacement::mutable_datanodeport() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.datanodeport)
+helpDecodePlan::mutable_datanodeport() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpDecodePlan.datanodeport)
   return _internal_mutable_datanodeport();
 }
 
-// repeated string blockkeys = 9;
-inline int ObjectAndPlacement::_internal_blockkeys_size() const {
+// repeated string blockkeys = 5;
+inline int helpDecodePlan::_internal_blockkeys_size() const {
   return _impl_.blockkeys_.size();
 }
-inline int ObjectAndPlacement::blockkeys_size() const {
+inline int helpDecodePlan::blockkeys_size() const {
   return _internal_blockkeys_size();
 }
-inline void ObjectAndPlacement::clear_blockkeys() {
+inline void helpDecodePlan::clear_blockkeys() {
   _impl_.blockkeys_.Clear();
 }
-inline std::string* ObjectAndPlacement::add_blockkeys() {
+inline std::string* helpDecodePlan::add_blockkeys() {
   std::string* _s = _internal_add_blockkeys();
-  // @@protoc_insertion_point(field_add_mutable:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_add_mutable:proxy_proto.helpDecodePlan.blockkeys)
   return _s;
 }
-inline const std::string& ObjectAndPlacement::_internal_blockkeys(int index) const {
+inline const std::string& helpDecodePlan::_internal_blockkeys(int index) const {
   return _impl_.blockkeys_.Get(index);
 }
-inline const std::string& ObjectAndPlacement::blockkeys(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.blockkeys)
+inline const std::string& helpDecodePlan::blockkeys(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.blockkeys)
   return _internal_blockkeys(index);
 }
-inline std::string* ObjectAndPlacement::mutable_blockkeys(int index) {
-  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.blockkeys)
+inline std::string* helpDecodePlan::mutable_blockkeys(int index) {
+  // @@protoc_insertion_point(field_mutable:proxy_proto.helpDecodePlan.blockkeys)
   return _impl_.blockkeys_.Mutable(index);
 }
-inline void ObjectAndPlacement::set_blockkeys(int index, const std::string& value) {
+inline void helpDecodePlan::set_blockkeys(int index, const std::string& value) {
   _impl_.blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.blockkeys)
 }
-inline void ObjectAndPlacement::set_blockkeys(int index, std::string&& value) {
+inline void helpDecodePlan::set_blockkeys(int index, std::string&& value) {
   _impl_.blockkeys_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.blockkeys)
 }
-inline void ObjectAndPlacement::set_blockkeys(int index, const char* value) {
+inline void helpDecodePlan::set_blockkeys(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.blockkeys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_set_char:proxy_proto.helpDecodePlan.blockkeys)
 }
-inline void ObjectAndPlacement::set_blockkeys(int index, const char* value, size_t size) {
+inline void helpDecodePlan::set_blockkeys(int index, const char* value, size_t size) {
   _impl_.blockkeys_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_set_pointer:proxy_proto.helpDecodePlan.blockkeys)
 }
-inline std::string* ObjectAndPlacement::_internal_add_blockkeys() {
+inline std::string* helpDecodePlan::_internal_add_blockkeys() {
   return _impl_.blockkeys_.Add();
 }
-inline void ObjectAndPlacement::add_blockkeys(const std::string& value) {
+inline void helpDecodePlan::add_blockkeys(const std::string& value) {
   _impl_.blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_add:proxy_proto.helpDecodePlan.blockkeys)
 }
-inline void ObjectAndPlacement::add_blockkeys(std::string&& value) {
+inline void helpDecodePlan::add_blockkeys(std::string&& value) {
   _impl_.blockkeys_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_add:proxy_proto.helpDecodePlan.blockkeys)
 }
-inline void ObjectAndPlacement::add_blockkeys(const char* value) {
+inline void helpDecodePlan::add_blockkeys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.blockkeys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_add_char:proxy_proto.helpDecodePlan.blockkeys)
 }
-inline void ObjectAndPlacement::add_blockkeys(const char* value, size_t size) {
+inline void helpDecodePlan::add_blockkeys(const char* value, size_t size) {
   _impl_.blockkeys_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:proxy_proto.ObjectAndPlacement.blockkeys)
+  // @@protoc_insertion_point(field_add_pointer:proxy_proto.helpDecodePlan.blockkeys)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-ObjectAndPlacement::blockkeys() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.blockkeys)
+helpDecodePlan::blockkeys() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpDecodePlan.blockkeys)
   return _impl_.blockkeys_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-ObjectAndPlacement::mutable_blockkeys() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.blockkeys)
+helpDecodePlan::mutable_blockkeys() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpDecodePlan.blockkeys)
   return &_impl_.blockkeys_;
 }
 
-// repeated int32 blockids = 10;
-inline int ObjectAndPlacement::_internal_blockids_size() const {
+// repeated int32 blockids = 6;
+inline int helpDecodePlan::_internal_blockids_size() const {
   return _impl_.blockids_.size();
 }
-inline int ObjectAndPlacement::blockids_size() const {
+inline int helpDecodePlan::blockids_size() const {
   return _internal_blockids_size();
 }
-inline void ObjectAndPlacement::clear_blockids() {
+inline void helpDecodePlan::clear_blockids() {
   _impl_.blockids_.Clear();
 }
-inline int32_t ObjectAndPlacement::_internal_blockids(int index) const {
+inline int32_t helpDecodePlan::_internal_blockids(int index) const {
   return _impl_.blockids_.Get(index);
 }
-inline int32_t ObjectAndPlacement::blockids(int index) const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.blockids)
+inline int32_t helpDecodePlan::blockids(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.blockids)
   return _internal_blockids(index);
 }
-inline void ObjectAndPlacement::set_blockids(int index, int32_t value) {
+inline void helpDecodePlan::set_blockids(int index, int32_t value) {
   _impl_.blockids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.blockids)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.blockids)
 }
-inline void ObjectAndPlacement::_internal_add_blockids(int32_t value) {
+inline void helpDecodePlan::_internal_add_blockids(int32_t value) {
   _impl_.blockids_.Add(value);
 }
-inline void ObjectAndPlacement::add_blockids(int32_t value) {
+inline void helpDecodePlan::add_blockids(int32_t value) {
   _internal_add_blockids(value);
-  // @@protoc_insertion_point(field_add:proxy_proto.ObjectAndPlacement.blockids)
+  // @@protoc_insertion_point(field_add:proxy_proto.helpDecodePlan.blockids)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-ObjectAndPlacement::_internal_blockids() const {
+helpDecodePlan::_internal_blockids() const {
   return _impl_.blockids_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-ObjectAndPlacement::blockids() const {
-  // @@protoc_insertion_point(field_list:proxy_proto.ObjectAndPlacement.blockids)
+helpDecodePlan::blockids() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpDecodePlan.blockids)
   return _internal_blockids();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-ObjectAndPlacement::_internal_mutable_blockids() {
+helpDecodePlan::_internal_mutable_blockids() {
   return &_impl_.blockids_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-ObjectAndPlacement::mutable_blockids() {
-  // @@protoc_insertion_point(field_mutable_list:proxy_proto.ObjectAndPlacement.blockids)
+helpDecodePlan::mutable_blockids() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpDecodePlan.blockids)
   return _internal_mutable_blockids();
 }
 
-// int32 block_size = 11;
-inline void ObjectAndPlacement::clear_block_size() {
+// int32 block_size = 7;
+inline void helpDecodePlan::clear_block_size() {
   _impl_.block_size_ = 0;
 }
-inline int32_t ObjectAndPlacement::_internal_block_size() const {
+inline int32_t helpDecodePlan::_internal_block_size() const {
   return _impl_.block_size_;
 }
-inline int32_t ObjectAndPlacement::block_size() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.block_size)
+inline int32_t helpDecodePlan::block_size() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.block_size)
   return _internal_block_size();
 }
-inline void ObjectAndPlacement::_internal_set_block_size(int32_t value) {
+inline void helpDecodePlan::_internal_set_block_size(int32_t value) {
   
   _impl_.block_size_ = value;
 }
-inline void ObjectAndPlacement::set_block_size(int32_t value) {
+inline void helpDecodePlan::set_block_size(int32_t value) {
   _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.block_size)
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.block_size)
 }
 
-// int32 encode_type = 12;
-inline void ObjectAndPlacement::clear_encode_type() {
-  _impl_.encode_type_ = 0;
+// int32 failed_num = 8;
+inline void helpDecodePlan::clear_failed_num() {
+  _impl_.failed_num_ = 0;
 }
-inline int32_t ObjectAndPlacement::_internal_encode_type() const {
-  return _impl_.encode_type_;
+inline int32_t helpDecodePlan::_internal_failed_num() const {
+  return _impl_.failed_num_;
 }
-inline int32_t ObjectAndPlacement::encode_type() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.encode_type)
-  return _internal_encode_type();
+inline int32_t helpDecodePlan::failed_num() const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.failed_num)
+  return _internal_failed_num();
 }
-inline void ObjectAndPlacement::_internal_set_encode_type(int32_t value) {
+inline void helpDecodePlan::_internal_set_failed_num(int32_t value) {
   
-  _impl_.encode_type_ = value;
+  _impl_.failed_num_ = value;
 }
-inline void ObjectAndPlacement::set_encode_type(int32_t value) {
-  _internal_set_encode_type(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.encode_type)
+inline void helpDecodePlan::set_failed_num(int32_t value) {
+  _internal_set_failed_num(value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.failed_num)
 }
 
-// string clientip = 13;
-inline void ObjectAndPlacement::clear_clientip() {
-  _impl_.clientip_.ClearToEmpty();
-}
-inline const std::string& ObjectAndPlacement::clientip() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.clientip)
-  return _internal_clientip();
+// repeated int32 coefficients = 9;
+inline int helpDecodePlan::_internal_coefficients_size() const {
+  return _impl_.coefficients_.size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ObjectAndPlacement::set_clientip(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.clientip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.clientip)
-}
-inline std::string* ObjectAndPlacement::mutable_clientip() {
-  std::string* _s = _internal_mutable_clientip();
-  // @@protoc_insertion_point(field_mutable:proxy_proto.ObjectAndPlacement.clientip)
-  return _s;
+inline int helpDecodePlan::coefficients_size() const {
+  return _internal_coefficients_size();
 }
-inline const std::string& ObjectAndPlacement::_internal_clientip() const {
-  return _impl_.clientip_.Get();
+inline void helpDecodePlan::clear_coefficients() {
+  _impl_.coefficients_.Clear();
 }
-inline void ObjectAndPlacement::_internal_set_clientip(const std::string& value) {
-  
-  _impl_.clientip_.Set(value, GetArenaForAllocation());
+inline int32_t helpDecodePlan::_internal_coefficients(int index) const {
+  return _impl_.coefficients_.Get(index);
 }
-inline std::string* ObjectAndPlacement::_internal_mutable_clientip() {
-  
-  return _impl_.clientip_.Mutable(GetArenaForAllocation());
+inline int32_t helpDecodePlan::coefficients(int index) const {
+  // @@protoc_insertion_point(field_get:proxy_proto.helpDecodePlan.coefficients)
+  return _internal_coefficients(index);
 }
-inline std::string* ObjectAndPlacement::release_clientip() {
-  // @@protoc_insertion_point(field_release:proxy_proto.ObjectAndPlacement.clientip)
-  return _impl_.clientip_.Release();
+inline void helpDecodePlan::set_coefficients(int index, int32_t value) {
+  _impl_.coefficients_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proxy_proto.helpDecodePlan.coefficients)
 }
-inline void ObjectAndPlacement::set_allocated_clientip(std::string* clientip) {
-  if (clientip != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.clientip_.SetAllocated(clientip, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.clientip_.IsDefault()) {
-    _impl_.clientip_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proxy_proto.ObjectAndPlacement.clientip)
+inline void helpDecodePlan::_internal_add_coefficients(int32_t value) {
+  _impl_.coefficients_.Add(value);
 }
-
-// int32 clientport = 14;
-inline void ObjectAndPlacement::clear_clientport() {
-  _impl_.clientport_ = 0;
+inline void helpDecodePlan::add_coefficients(int32_t value) {
+  _internal_add_coefficients(value);
+  // @@protoc_insertion_point(field_add:proxy_proto.helpDecodePlan.coefficients)
 }
-inline int32_t ObjectAndPlacement::_internal_clientport() const {
-  return _impl_.clientport_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+helpDecodePlan::_internal_coefficients() const {
+  return _impl_.coefficients_;
 }
-inline int32_t ObjectAndPlacement::clientport() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.ObjectAndPlacement.clientport)
-  return _internal_clientport();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+helpDecodePlan::coefficients() const {
+  // @@protoc_insertion_point(field_list:proxy_proto.helpDecodePlan.coefficients)
+  return _internal_coefficients();
 }
-inline void ObjectAndPlacement::_internal_set_clientport(int32_t value) {
-  
-  _impl_.clientport_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+helpDecodePlan::_internal_mutable_coefficients() {
+  return &_impl_.coefficients_;
 }
-inline void ObjectAndPlacement::set_clientport(int32_t value) {
-  _internal_set_clientport(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.ObjectAndPlacement.clientport)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+helpDecodePlan::mutable_coefficients() {
+  // @@protoc_insertion_point(field_mutable_list:proxy_proto.helpDecodePlan.coefficients)
+  return _internal_mutable_coefficients();
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
-// SetReply
-
-// bool ifcommit = 1;
-inline void SetReply::clear_ifcommit() {
-  _impl_.ifcommit_ = false;
-}
-inline bool SetReply::_internal_ifcommit() const {
-  return _impl_.ifcommit_;
-}
-inline bool SetReply::ifcommit() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.SetReply.ifcommit)
-  return _internal_ifcommit();
-}
-inline void SetReply::_internal_set_ifcommit(bool value) {
-  
-  _impl_.ifcommit_ = value;
-}
-inline void SetReply::set_ifcommit(bool value) {
-  _internal_set_ifcommit(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.SetReply.ifcommit)
-}
-
 // -------------------------------------------------------------------
 
-// GetReply
+// -------------------------------------------------------------------
 
-// bool getsuccess = 1;
-inline void GetReply::clear_getsuccess() {
-  _impl_.getsuccess_ = false;
-}
-inline bool GetReply::_internal_getsuccess() const {
-  return _impl_.getsuccess_;
-}
-inline bool GetReply::getsuccess() const {
-  // @@protoc_insertion_point(field_get:proxy_proto.GetReply.getsuccess)
-  return _internal_getsuccess();
-}
-inline void GetReply::_internal_set_getsuccess(bool value) {
-  
-  _impl_.getsuccess_ = value;
-}
-inline void GetReply::set_getsuccess(bool value) {
-  _internal_set_getsuccess(value);
-  // @@protoc_insertion_point(field_set:proxy_proto.GetReply.getsuccess)
-}
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -49,6 +49,11 @@ namespace ECProject
       {
         m_self_cluster_id = std::stoi(cluster_id);
       }
+      else
+      {
+        auto _proxy_stub = proxy_proto::proxyService::NewStub(grpc::CreateChannel(proxy, grpc::InsecureChannelCredentials()));
+        m_proxy_ptrs.insert(std::make_pair(std::stoi(cluster_id), std::move(_proxy_stub)));
+      }
       for (tinyxml2::XMLElement *node = cluster->FirstChildElement()->FirstChildElement(); node != nullptr; node = node->NextSiblingElement())
       {
         std::string node_uri(node->Attribute("uri"));
@@ -69,11 +74,56 @@ namespace ECProject
         //   std::cout << "[Datanode Check] failed to connect " << node_uri << std::endl;
         // }
         m_datanode_ptrs.insert(std::make_pair(node_uri, std::move(_stub)));
+        if (proxy == proxy_ip_port)
+        {
+          m_self_datanodes.push_back(node_uri);
+        }
       }
     }
     return true;
   }
 
+  // collect the free space, blocks and io load of the datanodes in the cluster, and report them to the coordinator
+  void ProxyImpl::heartbeat_loop()
+  {
+    while (true)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(HEARTBEAT_INTERVAL_MS));
+      coordinator_proto::NodeStatuses statuses;
+      for (auto &node_uri : m_self_datanodes)
+      {
+        grpc::ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(HEARTBEAT_INTERVAL_MS));
+        datanode_proto::CheckaliveCMD cmd;
+        datanode_proto::NodeStatus node_status;
+        cmd.set_name(proxy_ip_port);
+        grpc::Status status = m_datanode_ptrs[node_uri]->heartbeat(&context, cmd, &node_status);
+        if (!status.ok())
+        {
+          continue;
+        }
+        coordinator_proto::NodeStatus *t_status = statuses.add_nodes();
+        auto pos = node_uri.find(':');
+        t_status->set_node_ip(node_uri.substr(0, pos));
+        t_status->set_node_port(std::stoi(node_uri.substr(pos + 1)));
+        t_status->set_free_bytes(node_status.free_bytes());
+        t_status->set_block_num(node_status.block_num());
+        t_status->set_io_bytes_per_sec(node_status.io_bytes_per_sec());
+      }
+      if (statuses.nodes_size() == 0)
+      {
+        continue;
+      }
+      grpc::ClientContext context;
+      coordinator_proto::ReplyFromCoordinator reply;
+      grpc::Status status = m_coordinator_ptr->reportNodeStatus(&context, statuses, &reply);
+      if (!status.ok() && IF_DEBUG)
+      {
+        std::cout << "[Proxy" << m_self_cluster_id << "][Heartbeat] failed to report to the coordinator" << std::endl;
+      }
+    }
+  }
+
   grpc::Status ProxyImpl::checkalive(grpc::ServerContext *context,
                                      const proxy_proto::CheckaliveCMD *request,
                                      proxy_proto::RequestResult *response)
@@ -130,12 +180,12 @@ namespace ECProject
     return true;
   }
 
-  bool ProxyImpl::GetFromDatanode(const char *key, size_t key_length, char *value, size_t value_length, const char *ip, int port, int offset)
+  bool ProxyImpl::GetFromDatanode(const char *key, size_t key_length, char *value, size_t value_length, const char *ip, int port, int offset, int block_offset)
   {
     try
     {
       // ready to recieve
-      char *buf = new char[value_length];
+      std::vector<char> buf(value_length);
       if (IF_DEBUG)
       {
         std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
@@ -147,10 +197,17 @@ namespace ECProject
       datanode_proto::RequestResult result;
       get_info.set_block_key(std::string(key));
       get_info.set_block_size(value_length);
+      get_info.set_offset(block_offset);
       get_info.set_proxy_ip(m_ip);
       get_info.set_proxy_port(m_port + offset);
       std::string node_ip_port = std::string(ip) + ":" + std::to_string(port);
       grpc::Status stat = m_datanode_ptrs[node_ip_port]->handleGet(&context, get_info, &result);
+      if (!stat.ok())
+      {
+        std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
+                  << " Datanode " << node_ip_port << " failed to handle get " << key << std::endl;
+        return false;
+      }
       if (IF_DEBUG)
       {
         std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
@@ -162,7 +219,7 @@ namespace ECProject
       asio::ip::tcp::socket socket(io_context);
       asio::connect(socket, resolver.resolve({std::string(ip), std::to_string(port + 20)}));
       asio::error_code ec;
-      asio::read(socket, asio::buffer(buf, value_length), ec);
+      asio::read(socket, asio::buffer(buf.data(), value_length), ec);
       asio::error_code ignore_ec;
       socket.shutdown(asio::ip::tcp::socket::shutdown_both, ignore_ec);
       socket.close(ignore_ec);
@@ -171,12 +228,71 @@ namespace ECProject
         std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
                   << " Read data from socket with length of " << value_length << std::endl;
       }
-      memcpy(value, buf, value_length);
-      delete buf;
+      if (ec)
+      {
+        return false;
+      }
+      memcpy(value, buf.data(), value_length);
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << e.what() << '\n';
+      return false;
+    }
+
+    return true;
+  }
+
+  // read the block chunk by chunk, report the length received after each chunk
+  bool ProxyImpl::GetFromDatanodeByChunk(const char *key, size_t key_length, char *value, size_t value_length, const char *ip, int port, int offset, std::function<void(int)> report)
+  {
+    try
+    {
+      grpc::ClientContext context;
+      datanode_proto::GetInfo get_info;
+      datanode_proto::RequestResult result;
+      get_info.set_block_key(std::string(key));
+      get_info.set_block_size(value_length);
+      get_info.set_proxy_ip(m_ip);
+      get_info.set_proxy_port(m_port + offset);
+      std::string node_ip_port = std::string(ip) + ":" + std::to_string(port);
+      grpc::Status stat = m_datanode_ptrs[node_ip_port]->handleGet(&context, get_info, &result);
+      if (!stat.ok())
+      {
+        std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
+                  << " Datanode " << node_ip_port << " failed to handle get " << key << std::endl;
+        return false;
+      }
+
+      asio::io_context io_context;
+      asio::ip::tcp::resolver resolver(io_context);
+      asio::ip::tcp::socket socket(io_context);
+      asio::connect(socket, resolver.resolve({std::string(ip), std::to_string(port + 20)}));
+      asio::error_code ec;
+      int received = 0;
+      while (received < int(value_length))
+      {
+        int len = std::min(RECAL_CHUNK_SIZE, int(value_length) - received);
+        asio::read(socket, asio::buffer(value + received, len), ec);
+        if (ec)
+        {
+          break;
+        }
+        received += len;
+        report(received);
+      }
+      asio::error_code ignore_ec;
+      socket.shutdown(asio::ip::tcp::socket::shutdown_both, ignore_ec);
+      socket.close(ignore_ec);
+      if (received < int(value_length))
+      {
+        return false;
+      }
     }
     catch (const std::exception &e)
     {
       std::cerr << e.what() << '\n';
+      return false;
     }
 
     return true;
@@ -238,7 +354,11 @@ namespace ECProject
         std::cout << "[Proxy" << m_self_cluster_id << "][Relocation]"
                   << " Call datanode" << des_port << " to handle set " << key << std::endl;
       }
-      if (s_stat.ok() && IF_DEBUG)
+      if (!stat.ok() || !s_stat.ok())
+      {
+        return false;
+      }
+      if (IF_DEBUG)
       {
         std::cout << "[Proxy" << m_self_cluster_id << "][Relocation] relocate block " << key << " success!" << std::endl;
       }
@@ -246,6 +366,7 @@ namespace ECProject
     catch (const std::exception &e)
     {
       std::cerr << e.what() << '\n';
+      return false;
     }
     return true;
   }
@@ -268,6 +389,55 @@ namespace ECProject
     {
       keys_nodes.push_back(std::make_pair(object_and_placement->blockkeys(i), std::make_pair(object_and_placement->datanodeip(i), object_and_placement->datanodeport(i))));
     }
+    if (object_and_placement->packed())
+    {
+      // kept in the pack until it is sealed
+      proxy_proto::ObjectAndPlacement object = *object_and_placement;
+      auto append_to_pack = [this, object]()
+      {
+        try
+        {
+          asio::ip::tcp::socket socket_data(io_context);
+          acceptor.accept(socket_data);
+          asio::error_code error;
+          std::vector<char> buf_key(object.key().size());
+          std::vector<char> v_buf(object.valuesizebyte());
+          asio::read(socket_data, asio::buffer(buf_key, buf_key.size()), error);
+          bool flag = !error && std::string(buf_key.data(), buf_key.size()) == object.key();
+          if (flag)
+          {
+            asio::read(socket_data, asio::buffer(v_buf.data(), v_buf.size()), error);
+          }
+          else
+          {
+            std::cout << "[Proxy" << m_self_cluster_id << "][SET] key not matches " << object.key() << std::endl;
+          }
+          asio::error_code ignore_ec;
+          socket_data.shutdown(asio::ip::tcp::socket::shutdown_receive, ignore_ec);
+          socket_data.close(ignore_ec);
+          if (flag)
+          {
+            store_in_pack(object, v_buf.data());
+          }
+        }
+        catch (std::exception &e)
+        {
+          std::cout << "exception in append_to_pack" << std::endl;
+          std::cout << e.what() << std::endl;
+        }
+      };
+      try
+      {
+        std::thread my_thread(append_to_pack);
+        my_thread.detach();
+      }
+      catch (std::exception &e)
+      {
+        std::cout << "exception" << std::endl;
+        std::cout << e.what() << std::endl;
+      }
+      return grpc::Status::OK;
+    }
     auto encode_and_save = [this, key, value_size_bytes, k, g_m, l, block_size, keys_nodes, encode_type]() mutable
     {
       try
@@ -322,70 +492,7 @@ namespace ECProject
         socket_data.close(ignore_ec);
 
         // set the blocks to the datanode
-        char *buf = v_buf.data();
-        auto send_to_datanode = [this](int j, int k, std::string block_key, char **data, char **coding, int block_size, std::pair<std::string, int> ip_and_port)
-        {
-          if (IF_DEBUG)
-          {
-            std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
-                      << "Thread " << j << " send " << block_key << " to Datanode" << ip_and_port.second << std::endl;
-          }
-          if (j < k)
-          {
-            SetToDatanode(block_key.c_str(), block_key.size(), data[j], block_size, ip_and_port.first.c_str(), ip_and_port.second, j + 2);
-          }
-          else
-          {
-            SetToDatanode(block_key.c_str(), block_key.size(), coding[j - k], block_size, ip_and_port.first.c_str(), ip_and_port.second, j + 2);
-          }
-        };
-        // calculate parity blocks
-        std::vector<char *> v_data(k);
-        std::vector<char *> v_coding(g_m + l + 1);
-        char **data = (char **)v_data.data();
-        char **coding = (char **)v_coding.data();
-
-        std::vector<std::vector<char>> v_coding_area(g_m + l + 1, std::vector<char>(block_size));
-        for (int j = 0; j < k; j++)
-        {
-          data[j] = &buf[j * block_size];
-        }
-        for (int j = 0; j < g_m + l + 1; j++)
-        {
-          coding[j] = v_coding_area[j].data();
-        }
-        if (IF_DEBUG)
-        {
-          std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
-                    << "Encode value with size of " << v_buf.size() << std::endl;
-        }
-        int send_num;
-        if (encode_type == Azure_LRC || encode_type == Optimal_Cauchy_LRC)
-        {
-          encode(k, g_m, l, data, coding, block_size, encode_type);
-          send_num = k + g_m + l;
-        }
-        if (IF_DEBUG)
-        {
-          std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
-                    << "Distribute blocks to datanodes" << std::endl;
-        }
-        std::vector<std::thread> senders;
-        for (int j = 0; j < send_num; j++)
-        {
-          std::string block_key = keys_nodes[j].first;
-          std::pair<std::string, int> &ip_and_port = keys_nodes[j].second;
-          senders.push_back(std::thread(send_to_datanode, j, k, block_key, data, coding, block_size, ip_and_port));
-        }
-        for (int j = 0; j < int(senders.size()); j++)
-        {
-          senders[j].join();
-        }
-        if (IF_DEBUG)
-        {
-          std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
-                    << "Finish distributing blocks!" << std::endl;
-        }
+        encode_and_distribute(k, g_m, l, block_size, encode_type, keys_nodes, v_buf.data());
         coordinator_proto::CommitAbortKey commit_abort_key;
         coordinator_proto::ReplyFromCoordinator result;
         grpc::ClientContext context;
@@ -430,165 +537,595 @@ namespace ECProject
     return grpc::Status::OK;
   }
 
-  grpc::Status ProxyImpl::decodeAndGetObject(
-      grpc::ServerContext *context,
-      const proxy_proto::ObjectAndPlacement *object_and_placement,
-      proxy_proto::GetReply *response)
+  // encode the stripe of an object, buf holding its k data blocks, and send the blocks to the datanodes
+  void ProxyImpl::encode_and_distribute(int k, int g_m, int l, int block_size, ECProject::EncodeType encode_type,
+                                        std::vector<std::pair<std::string, std::pair<std::string, int>>> &keys_nodes, char *buf)
   {
-    ECProject::EncodeType encode_type = (ECProject::EncodeType)object_and_placement->encode_type();
-    std::string key = object_and_placement->key();
-    int k = object_and_placement->k();
-    int g_m = object_and_placement->g_m();
-    int l = object_and_placement->l();
-    // int block_size = object_and_placement->block_size();
-    int value_size_bytes = object_and_placement->valuesizebyte();
-    int block_size = ceil(value_size_bytes, k);
-    std::string clientip = object_and_placement->clientip();
-    int clientport = object_and_placement->clientport();
-    int stripe_id = object_and_placement->stripe_id();
+    auto send_to_datanode = [this](int j, int k, std::string block_key, char **data, char **coding, int block_size, std::pair<std::string, int> ip_and_port)
+    {
+      if (IF_DEBUG)
+      {
+        std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
+                  << "Thread " << j << " send " << block_key << " to Datanode" << ip_and_port.second << std::endl;
+      }
+      if (j < k)
+      {
+        SetToDatanode(block_key.c_str(), block_key.size(), data[j], block_size, ip_and_port.first.c_str(), ip_and_port.second, j + 2);
+      }
+      else
+      {
+        SetToDatanode(block_key.c_str(), block_key.size(), coding[j - k], block_size, ip_and_port.first.c_str(), ip_and_port.second, j + 2);
+      }
+    };
+    // calculate parity blocks
+    std::vector<char *> v_data(k);
+    std::vector<char *> v_coding(g_m + l + 1);
+    char **data = (char **)v_data.data();
+    char **coding = (char **)v_coding.data();
 
-    std::vector<std::pair<std::string, std::pair<std::string, int>>> keys_nodes;
-    std::vector<int> block_idxs;
-    for (int i = 0; i < object_and_placement->datanodeip_size(); i++)
+    std::vector<std::vector<char>> v_coding_area(g_m + l + 1, std::vector<char>(block_size));
+    for (int j = 0; j < k; j++)
     {
-      block_idxs.push_back(object_and_placement->blockids(i));
-      keys_nodes.push_back(std::make_pair(object_and_placement->blockkeys(i), std::make_pair(object_and_placement->datanodeip(i), object_and_placement->datanodeport(i))));
+      data[j] = &buf[j * block_size];
     }
-
-    auto decode_and_get = [this, key, k, g_m, l, block_size, value_size_bytes, stripe_id,
-                           clientip, clientport, keys_nodes, block_idxs, encode_type]() mutable
+    for (int j = 0; j < g_m + l + 1; j++)
     {
-      int expect_block_number = (encode_type == Azure_LRC) ? (k + l) : k;
-      int all_expect_blocks = (encode_type == Azure_LRC) ? (k + g_m + l) : (k + g_m);
-
-      auto blocks_ptr = std::make_shared<std::vector<std::vector<char>>>();
-      auto blocks_key_ptr = std::make_shared<std::vector<std::string>>();
-      auto blocks_idx_ptr = std::make_shared<std::vector<int>>();
-      auto myLock_ptr = std::make_shared<std::mutex>();
-      auto cv_ptr = std::make_shared<std::condition_variable>();
-
-      std::vector<char *> v_data(k);
-      std::vector<char *> v_coding(all_expect_blocks - k);
-      char **data = v_data.data();
-      char **coding = v_coding.data();
+      coding[j] = v_coding_area[j].data();
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
+                << "Encode value with size of " << k * block_size << std::endl;
+    }
+    int send_num;
+    if (encode_type == Azure_LRC || encode_type == Optimal_Cauchy_LRC)
+    {
+      encode(k, g_m, l, data, coding, block_size, encode_type);
+      send_num = k + g_m + l;
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
+                << "Distribute blocks to datanodes" << std::endl;
+    }
+    std::vector<std::thread> senders;
+    for (int j = 0; j < send_num; j++)
+    {
+      std::string block_key = keys_nodes[j].first;
+      std::pair<std::string, int> &ip_and_port = keys_nodes[j].second;
+      senders.push_back(std::thread(send_to_datanode, j, k, block_key, data, coding, block_size, ip_and_port));
+    }
+    for (int j = 0; j < int(senders.size()); j++)
+    {
+      senders[j].join();
+    }
+    if (IF_DEBUG)
+    {
+      std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
+                << "Finish distributing blocks!" << std::endl;
+    }
+  }
 
-      auto getFromNode = [this, k, blocks_ptr, blocks_key_ptr, blocks_idx_ptr, myLock_ptr, cv_ptr](int expect_block_number, int block_idx, std::string block_key, int block_size, std::string ip, int port)
+  // the values of a batch come through one connection in the order of the objects,
+  // and their commits are reported to the coordinator together
+  grpc::Status ProxyImpl::encodeAndSetObjects(
+      grpc::ServerContext *context,
+      const proxy_proto::ObjectBatch *object_batch,
+      proxy_proto::SetReply *response)
+  {
+    proxy_proto::ObjectBatch batch = *object_batch;
+    auto encode_and_save = [this, batch]() mutable
+    {
+      try
       {
-        if (IF_DEBUG)
+        asio::ip::tcp::socket socket_data(io_context);
+        acceptor.accept(socket_data);
+        asio::error_code error;
+        coordinator_proto::CommitAbortKeys commit_abort_keys;
+        for (int i = 0; i < batch.objects_size(); i++)
         {
-          std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
-                    << "Block " << block_idx << " with key " << block_key << " from Datanode" << ip << ":" << port << std::endl;
+          const proxy_proto::ObjectAndPlacement &t_object = batch.objects(i);
+          std::string key = t_object.key();
+          int value_size_bytes = t_object.valuesizebyte();
+          int k = t_object.k();
+          int block_size = t_object.block_size();
+          std::vector<char> buf_key(key.size());
+          std::vector<char> v_buf(t_object.packed() ? value_size_bytes : block_size * k, '0');
+          asio::read(socket_data, asio::buffer(buf_key, key.size()), error);
+          if (error)
+          {
+            std::cout << "[Proxy" << m_self_cluster_id << "][SET] batch cut short before " << key << std::endl;
+            break;
+          }
+          if (std::string(buf_key.data(), buf_key.size()) != key)
+          {
+            std::cout << "[Proxy" << m_self_cluster_id << "][SET] key not matches " << key << std::endl;
+            break;
+          }
+          asio::read(socket_data, asio::buffer(v_buf.data(), value_size_bytes), error);
+          if (t_object.packed())
+          {
+            store_in_pack(t_object, v_buf.data());
+            continue;
+          }
+          std::vector<std::pair<std::string, std::pair<std::string, int>>> keys_nodes;
+          for (int j = 0; j < t_object.datanodeip_size(); j++)
+          {
+            keys_nodes.push_back(std::make_pair(t_object.blockkeys(j), std::make_pair(t_object.datanodeip(j), t_object.datanodeport(j))));
+          }
+          encode_and_distribute(k, t_object.g_m(), t_object.l(), block_size, (ECProject::EncodeType)t_object.encode_type(),
+                                keys_nodes, v_buf.data());
+          coordinator_proto::CommitAbortKey *commit_abort_key = commit_abort_keys.add_keys();
+          ECProject::OpperateType opp = SET;
+          commit_abort_key->set_opp(opp);
+          commit_abort_key->set_key(key);
+          commit_abort_key->set_ifcommitmetadata(true);
         }
-
-        std::vector<char> temp(block_size);
-        bool ret = GetFromDatanode(block_key.c_str(), block_key.size(), temp.data(), block_size, ip.c_str(), port, block_idx + 2);
-
-        if (!ret)
+        asio::error_code ignore_ec;
+        socket_data.shutdown(asio::ip::tcp::socket::shutdown_receive, ignore_ec);
+        socket_data.close(ignore_ec);
+        if (commit_abort_keys.keys_size() == 0)
         {
-          std::cout << "getFromNode !ret" << std::endl;
           return;
         }
-        myLock_ptr->lock();
-        // get any k blocks and decode
-        if (!check_received_block(k, expect_block_number, blocks_idx_ptr, blocks_ptr->size()))
+
+        coordinator_proto::ReplyFromCoordinator result;
+        grpc::ClientContext context;
+        grpc::Status status = m_coordinator_ptr->reportCommitAborts(&context, commit_abort_keys, &result);
+        if (!status.ok())
         {
-          blocks_ptr->push_back(temp);
-          blocks_key_ptr->push_back(block_key);
-          blocks_idx_ptr->push_back(block_idx);
-          if (check_received_block(k, expect_block_number, blocks_idx_ptr, blocks_ptr->size()))
-          {
-            cv_ptr->notify_all();
-          }
+          std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
+                    << " report to coordinator fail!" << std::endl;
         }
-        // get all the blocks
-        // blocks_ptr->push_back(temp);
-        // blocks_key_ptr->push_back(block_key);
-        // blocks_idx_ptr->push_back(block_idx);
-        myLock_ptr->unlock();
-      };
-
-      std::vector<std::vector<char>> v_data_area(k, std::vector<char>(block_size));
-      std::vector<std::vector<char>> v_coding_area(all_expect_blocks - k, std::vector<char>(block_size));
-      for (int j = 0; j < k; j++)
-      {
-        data[j] = v_data_area[j].data();
-      }
-      for (int j = 0; j < all_expect_blocks - k; j++)
-      {
-        coding[j] = v_coding_area[j].data();
       }
-      if (IF_DEBUG)
-      {
-        std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
-                  << "ready to get blocks from datanodes!" << std::endl;
-      }
-      std::vector<std::thread> read_treads;
-      // for (int j = 0; j < k; j++)
-      for (int j = 0; j < all_expect_blocks; j++)
-      {
-        int block_idx = block_idxs[j];
-        std::string block_key = keys_nodes[j].first;
-        std::pair<std::string, int> &ip_and_port = keys_nodes[j].second;
-        // std::vector<char> temp(block_size);
-        // GetFromDatanode(block_key.c_str(), block_key.size(), temp.data(), block_size, ip_and_port.first.c_str(), ip_and_port.second, j + 2);
-        // blocks_ptr->push_back(temp);
-        // blocks_key_ptr->push_back(block_key);
-        // blocks_idx_ptr->push_back(j);
-        read_treads.push_back(std::thread(getFromNode, expect_block_number, block_idx, block_key, block_size, ip_and_port.first, ip_and_port.second));
-      }
-      for (int j = 0; j < all_expect_blocks; j++)
-      {
-        read_treads[j].detach();
-        // read_treads[j].join();
-      }
-
-      std::unique_lock<std::mutex> lck(*myLock_ptr);
-      while (!check_received_block(k, expect_block_number, blocks_idx_ptr, blocks_ptr->size()))
+      catch (std::exception &e)
       {
-        cv_ptr->wait(lck);
+        std::cout << "exception in encode_and_save" << std::endl;
+        std::cout << e.what() << std::endl;
       }
-      if (IF_DEBUG)
-      {
+    };
+    try
+    {
+      std::thread my_thread(encode_and_save);
+      my_thread.detach();
+    }
+    catch (std::exception &e)
+    {
+      std::cout << "exception" << std::endl;
+      std::cout << e.what() << std::endl;
+    }
+    return grpc::Status::OK;
+  }
+
+  // copy an object arrived into the data blocks of its pack
+  void ProxyImpl::store_in_pack(const proxy_proto::ObjectAndPlacement &object, const char *value)
+  {
+    std::unique_lock<std::mutex> lck(m_pack_mutex);
+    PackBuffer &t_pack = m_packs[object.stripe_id()];
+    if (t_pack.buf.empty())
+    {
+      t_pack.buf.assign(object.k() * object.block_size(), '0');
+    }
+    if (object.offset() < 0 || object.offset() + object.valuesizebyte() > int(t_pack.buf.size()))
+    {
+      std::cout << "[Proxy" << m_self_cluster_id << "][SET] " << object.key() << " out of pack " << object.stripe_id() << std::endl;
+      return;
+    }
+    memcpy(t_pack.buf.data() + object.offset(), value, object.valuesizebyte());
+    t_pack.keys.push_back(object.key());
+    m_pack_cv.notify_all();
+  }
+
+  // encode the pack once the objects appended to it have arrived, or PACK_ARRIVAL_TIMEOUT_MS has passed,
+  // then commit the pack with the objects arrived and abort the others
+  grpc::Status ProxyImpl::sealPack(
+      grpc::ServerContext *context,
+      const proxy_proto::ObjectAndPlacement *pack_and_placement,
+      proxy_proto::SetReply *response)
+  {
+    proxy_proto::ObjectAndPlacement pack = *pack_and_placement;
+    auto seal = [this, pack]() mutable
+    {
+      try
+      {
+        int stripe_id = pack.stripe_id();
+        int k = pack.k();
+        int block_size = pack.block_size();
+        PackBuffer t_pack;
+        {
+          std::unique_lock<std::mutex> lck(m_pack_mutex);
+          m_pack_cv.wait_for(lck, std::chrono::milliseconds(PACK_ARRIVAL_TIMEOUT_MS), [this, stripe_id, &pack]()
+                             {
+                               auto it = m_packs.find(stripe_id);
+                               return it != m_packs.end() && int(it->second.keys.size()) >= pack.packed_keys_size(); });
+          auto it = m_packs.find(stripe_id);
+          if (it != m_packs.end())
+          {
+            t_pack.buf.swap(it->second.buf);
+            t_pack.keys.swap(it->second.keys);
+            m_packs.erase(it);
+          }
+        }
+        if (t_pack.buf.empty())
+        {
+          t_pack.buf.assign(k * block_size, '0');
+        }
+        std::vector<std::pair<std::string, std::pair<std::string, int>>> keys_nodes;
+        for (int i = 0; i < pack.datanodeip_size(); i++)
+        {
+          keys_nodes.push_back(std::make_pair(pack.blockkeys(i), std::make_pair(pack.datanodeip(i), pack.datanodeport(i))));
+        }
+        if (IF_DEBUG)
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][SET] seal pack " << stripe_id << " with "
+                    << t_pack.keys.size() << " of " << pack.packed_keys_size() << " objects" << std::endl;
+        }
+        encode_and_distribute(k, pack.g_m(), pack.l(), block_size, (ECProject::EncodeType)pack.encode_type(),
+                              keys_nodes, t_pack.buf.data());
+
+        // the pack first, for its objects to be read through it
+        coordinator_proto::CommitAbortKeys commit_abort_keys;
+        ECProject::OpperateType opp = SET;
+        coordinator_proto::CommitAbortKey *commit_abort_key = commit_abort_keys.add_keys();
+        commit_abort_key->set_opp(opp);
+        commit_abort_key->set_key(pack.key());
+        commit_abort_key->set_ifcommitmetadata(true);
+        std::unordered_set<std::string> arrived(t_pack.keys.begin(), t_pack.keys.end());
+        for (int i = 0; i < pack.packed_keys_size(); i++)
+        {
+          commit_abort_key = commit_abort_keys.add_keys();
+          commit_abort_key->set_opp(opp);
+          commit_abort_key->set_key(pack.packed_keys(i));
+          commit_abort_key->set_ifcommitmetadata(arrived.count(pack.packed_keys(i)) > 0);
+        }
+        coordinator_proto::ReplyFromCoordinator result;
+        grpc::ClientContext context;
+        grpc::Status status = m_coordinator_ptr->reportCommitAborts(&context, commit_abort_keys, &result);
+        if (!status.ok())
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][SET]"
+                    << " report to coordinator fail!" << std::endl;
+        }
+      }
+      catch (std::exception &e)
+      {
+        std::cout << "exception in seal" << std::endl;
+        std::cout << e.what() << std::endl;
+      }
+    };
+    try
+    {
+      std::thread my_thread(seal);
+      my_thread.detach();
+    }
+    catch (std::exception &e)
+    {
+      std::cout << "exception" << std::endl;
+      std::cout << e.what() << std::endl;
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status ProxyImpl::decodeAndGetObject(
+      grpc::ServerContext *context,
+      const proxy_proto::ObjectAndPlacement *object_and_placement,
+      proxy_proto::GetReply *response)
+  {
+    ECProject::EncodeType encode_type = (ECProject::EncodeType)object_and_placement->encode_type();
+    std::string key = object_and_placement->key();
+    int k = object_and_placement->k();
+    int g_m = object_and_placement->g_m();
+    int l = object_and_placement->l();
+    int value_size_bytes = object_and_placement->valuesizebyte();
+    int block_size = object_and_placement->block_size() > 0 ? object_and_placement->block_size() : ceil(value_size_bytes, k);
+    // the object is the range from offset in the data blocks, only the blocks covering it are read
+    int offset = object_and_placement->offset();
+    std::string clientip = object_and_placement->clientip();
+    int clientport = object_and_placement->clientport();
+    int stripe_id = object_and_placement->stripe_id();
+    bool with_key_size = object_and_placement->with_key_size();
+
+    std::vector<std::pair<std::string, std::pair<std::string, int>>> keys_nodes;
+    std::vector<int> block_idxs;
+    std::vector<bool> block_islocal;
+    std::vector<int> block_clusterids;
+    bool if_partial_decoding = object_and_placement->if_partial_decoding() && object_and_placement->clusterids_size() == object_and_placement->datanodeip_size();
+    for (int i = 0; i < object_and_placement->datanodeip_size(); i++)
+    {
+      block_idxs.push_back(object_and_placement->blockids(i));
+      keys_nodes.push_back(std::make_pair(object_and_placement->blockkeys(i), std::make_pair(object_and_placement->datanodeip(i), object_and_placement->datanodeport(i))));
+      block_islocal.push_back(i < object_and_placement->islocal_size() && object_and_placement->islocal(i));
+      if (if_partial_decoding)
+      {
+        block_clusterids.push_back(object_and_placement->clusterids(i));
+      }
+    }
+
+    auto decode_and_get = [this, key, k, g_m, l, block_size, value_size_bytes, offset, stripe_id,
+                           clientip, clientport, with_key_size, keys_nodes, block_idxs, block_islocal, block_clusterids, if_partial_decoding, encode_type]() mutable
+    {
+      int expect_block_number = (encode_type == Azure_LRC) ? (k + l) : k;
+      int all_expect_blocks = (encode_type == Azure_LRC) ? (k + g_m + l) : (k + g_m);
+
+      auto blocks_ptr = std::make_shared<std::vector<std::vector<char>>>();
+      auto blocks_key_ptr = std::make_shared<std::vector<std::string>>();
+      auto blocks_idx_ptr = std::make_shared<std::vector<int>>();
+      auto myLock_ptr = std::make_shared<std::mutex>();
+      auto cv_ptr = std::make_shared<std::condition_variable>();
+
+      auto getFromNode = [this, k, blocks_ptr, blocks_key_ptr, blocks_idx_ptr, myLock_ptr, cv_ptr](int expect_block_number, int block_idx, std::string block_key, int block_size, int block_offset, std::string ip, int port)
+      {
+        if (IF_DEBUG)
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
+                    << "Block " << block_idx << " with key " << block_key << " from Datanode" << ip << ":" << port << std::endl;
+        }
+
+        std::vector<char> temp(block_size);
+        bool ret = GetFromDatanode(block_key.c_str(), block_key.size(), temp.data(), block_size, ip.c_str(), port, block_idx + 2, block_offset);
+
+        if (!ret)
+        {
+          std::cout << "getFromNode !ret" << std::endl;
+          return;
+        }
+        myLock_ptr->lock();
+        // get any k blocks and decode
+        if (!check_received_block(k, expect_block_number, blocks_idx_ptr, blocks_ptr->size()))
+        {
+          blocks_ptr->push_back(temp);
+          blocks_key_ptr->push_back(block_key);
+          blocks_idx_ptr->push_back(block_idx);
+          if (check_received_block(k, expect_block_number, blocks_idx_ptr, blocks_ptr->size()))
+          {
+            cv_ptr->notify_all();
+          }
+        }
+        myLock_ptr->unlock();
+      };
+
+      if (IF_DEBUG)
+      {
         std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
-                  << "ready to decode!" << std::endl;
+                  << "ready to get blocks from datanodes!" << std::endl;
       }
-      for (int j = 0; j < int(blocks_idx_ptr->size()); j++)
+      // read the data blocks first, local blocks before remote ones,
+      // the parity blocks are pulled only if some data blocks are unavailable
+      int blocks_num = std::min(all_expect_blocks, int(block_idxs.size()));
+      std::vector<int> read_order;
+      for (int j = 0; j < blocks_num; j++)
       {
-        int idx = (*blocks_idx_ptr)[j];
-        if (idx < k)
+        if (block_idxs[j] < k && block_islocal[j])
         {
-          memcpy(data[idx], (*blocks_ptr)[j].data(), block_size);
+          read_order.push_back(j);
         }
-        else
+      }
+      int local_data_cnt = int(read_order.size());
+      for (int j = 0; j < blocks_num; j++)
+      {
+        if (block_idxs[j] < k && !block_islocal[j])
         {
-          memcpy(coding[idx - k], (*blocks_ptr)[j].data(), block_size);
+          read_order.push_back(j);
         }
       }
+      int data_cnt = int(read_order.size());
+      for (int j = 0; j < blocks_num; j++)
+      {
+        if (block_idxs[j] >= k && block_islocal[j])
+        {
+          read_order.push_back(j);
+        }
+      }
+      for (int j = 0; j < blocks_num; j++)
+      {
+        if (block_idxs[j] >= k && !block_islocal[j])
+        {
+          read_order.push_back(j);
+        }
+      }
+      if (IF_DEBUG)
+      {
+        std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
+                  << local_data_cnt << " local data blocks, " << data_cnt - local_data_cnt << " remote data blocks" << std::endl;
+      }
 
-      auto erasures = std::make_shared<std::vector<int>>();
-      for (int j = 0; j < all_expect_blocks; j++)
+      // the value is the range [offset, offset + value_size_bytes) of the data blocks,
+      // only the window [lo, hi) of each covering block is read
+      int first_block = block_size > 0 ? offset / block_size : 0;
+      int last_block = block_size > 0 ? (offset + std::max(value_size_bytes, 1) - 1) / block_size : 0;
+      auto window = [offset, value_size_bytes, block_size](int idx)
       {
-        if (std::find(blocks_idx_ptr->begin(), blocks_idx_ptr->end(), j) == blocks_idx_ptr->end())
+        int lo = std::max(offset, idx * block_size) - idx * block_size;
+        int hi = std::min(offset + value_size_bytes, (idx + 1) * block_size) - idx * block_size;
+        return std::make_pair(lo, std::max(lo, hi));
+      };
+      std::string value(value_size_bytes, '0');
+
+      std::vector<int> covering_pos;
+      for (int j = 0; j < data_cnt; j++)
+      {
+        int idx = block_idxs[read_order[j]];
+        if (idx >= first_block && idx <= last_block && window(idx).first < window(idx).second)
         {
-          erasures->push_back(j);
+          covering_pos.push_back(read_order[j]);
         }
       }
-      erasures->push_back(-1);
-      if (encode_type == Azure_LRC)
+      std::vector<char> covering_ret(covering_pos.size(), 0);
+      std::vector<std::thread> read_treads;
+      for (int j = 0; j < int(covering_pos.size()); j++)
+      {
+        read_treads.push_back(std::thread([this, j, block_size, offset, &window, &covering_pos, &covering_ret, &keys_nodes, &block_idxs, &value]()
+                                          {
+                                            int t_j = covering_pos[j];
+                                            int idx = block_idxs[t_j];
+                                            std::pair<int, int> win = window(idx);
+                                            covering_ret[j] = GetFromDatanode(keys_nodes[t_j].first.c_str(), keys_nodes[t_j].first.size(), &value[idx * block_size + win.first - offset], win.second - win.first,
+                                                                              keys_nodes[t_j].second.first.c_str(), keys_nodes[t_j].second.second, idx + 2, win.first); }));
+      }
+      for (int j = 0; j < int(read_treads.size()); j++)
+      {
+        read_treads[j].join();
+      }
+
+      // the covering blocks unavailable, decode the union of their windows only
+      std::vector<int> failed_idxs;
+      int lo = block_size, hi = 0;
+      for (int idx = first_block; idx <= last_block && idx < k; idx++)
       {
-        if (!decode(k, g_m, l, data, coding, erasures, block_size, encode_type))
+        std::pair<int, int> win = window(idx);
+        bool if_read = win.first == win.second;
+        for (int j = 0; j < int(covering_pos.size()) && !if_read; j++)
         {
-          std::cout << "[Proxy" << m_self_cluster_id << "][GET] proxy cannot decode!" << std::endl;
+          if_read = block_idxs[covering_pos[j]] == idx && covering_ret[j];
+        }
+        if (!if_read)
+        {
+          failed_idxs.push_back(idx);
+          lo = std::min(lo, win.first);
+          hi = std::max(hi, win.second);
         }
       }
-      else
+      bool if_degraded = !failed_idxs.empty();
+      int window_size = if_degraded ? hi - lo : 0;
+      if (if_degraded)
       {
-        std::cout << "[Proxy" << m_self_cluster_id << "][GET] proxy decode error!" << std::endl;
+        if (IF_DEBUG)
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][GET] " << failed_idxs.size() << " data blocks unavailable, decode the range ["
+                    << lo << ", " << hi << ") of the blocks" << std::endl;
+        }
+        std::vector<std::thread> data_read_treads;
+        for (int j = 0; j < data_cnt; j++)
+        {
+          int t_j = read_order[j];
+          if (std::find(failed_idxs.begin(), failed_idxs.end(), block_idxs[t_j]) == failed_idxs.end())
+          {
+            std::pair<std::string, int> &ip_and_port = keys_nodes[t_j].second;
+            data_read_treads.push_back(std::thread(getFromNode, expect_block_number, block_idxs[t_j], keys_nodes[t_j].first, window_size, lo, ip_and_port.first, ip_and_port.second));
+          }
+        }
+        for (int j = 0; j < int(data_read_treads.size()); j++)
+        {
+          data_read_treads[j].join();
+        }
       }
-      std::string value;
-      for (int j = 0; j < k; j++)
+
+      // partial decoding, the helper proxies send one partial block for each failed block,
+      // only when the whole blocks are needed
+      bool if_partial_decoded = false;
+      std::vector<int> partial_failed_idxs;
+      std::vector<std::vector<char>> decoded_blocks;
+      if (if_degraded && if_partial_decoding && window_size == block_size)
       {
-        value += std::string(data[j]);
+        myLock_ptr->lock();
+        std::vector<int> received_idxs(*blocks_idx_ptr);
+        std::vector<std::vector<char>> received_blocks(*blocks_ptr);
+        myLock_ptr->unlock();
+        if_partial_decoded = PartialDecoding(k, g_m, l, block_size, encode_type, keys_nodes, block_idxs, block_clusterids,
+                                             received_idxs, received_blocks, partial_failed_idxs, decoded_blocks);
+        if (!if_partial_decoded)
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][GET] partial decoding failed, get the parity blocks!" << std::endl;
+        }
+      }
+      if (if_degraded && !if_partial_decoded)
+      {
+        // degraded read, get the same window of the parity blocks
+        std::vector<std::thread> parity_read_treads;
+        for (int j = data_cnt; j < int(read_order.size()); j++)
+        {
+          int t_j = read_order[j];
+          std::pair<std::string, int> &ip_and_port = keys_nodes[t_j].second;
+          parity_read_treads.push_back(std::thread(getFromNode, expect_block_number, block_idxs[t_j], keys_nodes[t_j].first, window_size, lo, ip_and_port.first, ip_and_port.second));
+        }
+        for (int j = 0; j < int(parity_read_treads.size()); j++)
+        {
+          parity_read_treads[j].detach();
+        }
+
+        std::vector<char *> v_data(k);
+        std::vector<char *> v_coding(all_expect_blocks - k);
+        char **data = v_data.data();
+        char **coding = v_coding.data();
+        std::vector<std::vector<char>> v_data_area(k, std::vector<char>(window_size));
+        std::vector<std::vector<char>> v_coding_area(all_expect_blocks - k, std::vector<char>(window_size));
+        for (int j = 0; j < k; j++)
+        {
+          data[j] = v_data_area[j].data();
+        }
+        for (int j = 0; j < all_expect_blocks - k; j++)
+        {
+          coding[j] = v_coding_area[j].data();
+        }
+
+        std::unique_lock<std::mutex> lck(*myLock_ptr);
+        while (!check_received_block(k, expect_block_number, blocks_idx_ptr, blocks_ptr->size()))
+        {
+          cv_ptr->wait(lck);
+        }
+        if (IF_DEBUG)
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][GET]"
+                    << "ready to decode!" << std::endl;
+        }
+        for (int j = 0; j < int(blocks_idx_ptr->size()); j++)
+        {
+          int idx = (*blocks_idx_ptr)[j];
+          if (idx < k)
+          {
+            memcpy(data[idx], (*blocks_ptr)[j].data(), window_size);
+          }
+          else
+          {
+            memcpy(coding[idx - k], (*blocks_ptr)[j].data(), window_size);
+          }
+        }
+        auto erasures = std::make_shared<std::vector<int>>();
+        for (int j = 0; j < all_expect_blocks; j++)
+        {
+          if (std::find(blocks_idx_ptr->begin(), blocks_idx_ptr->end(), j) == blocks_idx_ptr->end())
+          {
+            erasures->push_back(j);
+          }
+        }
+        erasures->push_back(-1);
+        lck.unlock();
+        if (encode_type == Azure_LRC)
+        {
+          if (!decode(k, g_m, l, data, coding, erasures, window_size, encode_type))
+          {
+            std::cout << "[Proxy" << m_self_cluster_id << "][GET] proxy cannot decode!" << std::endl;
+          }
+        }
+        else
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][GET] proxy decode error!" << std::endl;
+        }
+        for (auto &idx : failed_idxs)
+        {
+          std::pair<int, int> win = window(idx);
+          memcpy(&value[idx * block_size + win.first - offset], data[idx] + win.first - lo, win.second - win.first);
+        }
+      }
+      else if (if_partial_decoded)
+      {
+        if (IF_DEBUG)
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][GET] " << partial_failed_idxs.size() << " blocks decoded by partial decoding" << std::endl;
+        }
+        for (auto &idx : failed_idxs)
+        {
+          int pos = int(std::find(partial_failed_idxs.begin(), partial_failed_idxs.end(), idx) - partial_failed_idxs.begin());
+          std::pair<int, int> win = window(idx);
+          if (pos < int(decoded_blocks.size()))
+          {
+            memcpy(&value[idx * block_size + win.first - offset], decoded_blocks[pos].data() + win.first, win.second - win.first);
+          }
+        }
+      }
+      else if (IF_DEBUG)
+      {
+        std::cout << "[Proxy" << m_self_cluster_id << "][GET] read " << covering_pos.size() << " data blocks covering the range" << std::endl;
       }
 
       if (IF_DEBUG)
@@ -604,6 +1141,11 @@ namespace ECProject
       asio::ip::tcp::socket sock_data(io_context);
       asio::connect(sock_data, endpoints);
 
+      if (with_key_size)
+      {
+        int key_size = int(key.size());
+        asio::write(sock_data, asio::buffer((char *)&key_size, sizeof(int)), error);
+      }
       asio::write(sock_data, asio::buffer(key, key.size()), error);
       asio::write(sock_data, asio::buffer(value, value_size_bytes), error);
       asio::error_code ignore_ec;
@@ -630,6 +1172,346 @@ namespace ECProject
     return grpc::Status::OK;
   }
 
+  grpc::Status ProxyImpl::decodeAndGetObjects(
+      grpc::ServerContext *context,
+      const proxy_proto::ObjectBatch *object_batch,
+      proxy_proto::GetReply *response)
+  {
+    for (int i = 0; i < object_batch->objects_size(); i++)
+    {
+      decodeAndGetObject(context, &object_batch->objects(i), response);
+    }
+    return grpc::Status::OK;
+  }
+
+  // partial decoding for degraded read
+  // the data blocks are received, decode the failed ones with the parity blocks,
+  // each helper cluster sends one partial block for each failed block
+  bool ProxyImpl::PartialDecoding(int k, int g_m, int l, int block_size, ECProject::EncodeType encode_type,
+                                  std::vector<std::pair<std::string, std::pair<std::string, int>>> &keys_nodes, std::vector<int> &block_idxs, std::vector<int> &block_clusterids,
+                                  std::vector<int> &received_idxs, std::vector<std::vector<char>> &received_blocks,
+                                  std::vector<int> &failed_idxs, std::vector<std::vector<char>> &decoded_blocks)
+  {
+    try
+    {
+      failed_idxs.clear();
+      for (int i = 0; i < k; i++)
+      {
+        if (std::find(received_idxs.begin(), received_idxs.end(), i) == received_idxs.end())
+        {
+          failed_idxs.push_back(i);
+        }
+      }
+      int failed_num = int(failed_idxs.size());
+      // parity blocks, the ones in local cluster and the local parity blocks are preferred
+      std::vector<int> candidates;
+      for (int i = 0; i < int(block_idxs.size()); i++)
+      {
+        if (block_idxs[i] >= k)
+        {
+          candidates.push_back(i);
+        }
+      }
+      std::stable_sort(candidates.begin(), candidates.end(), [&](int a, int b)
+                       { return std::make_pair(block_clusterids[a] != m_self_cluster_id, block_idxs[a] < k + g_m) <
+                                std::make_pair(block_clusterids[b] != m_self_cluster_id, block_idxs[b] < k + g_m); });
+      std::vector<int> candidate_idxs;
+      std::unordered_map<int, int> idx_to_pos;
+      for (auto &pos : candidates)
+      {
+        candidate_idxs.push_back(block_idxs[pos]);
+        idx_to_pos[block_idxs[pos]] = pos;
+      }
+      std::vector<int> survive_idxs;
+      std::vector<int> coefficients;
+      if (!plan_partial_decoding(k, g_m, l, received_idxs, candidate_idxs, failed_idxs, survive_idxs, coefficients, encode_type))
+      {
+        std::cout << "[Proxy" << m_self_cluster_id << "][GET] undecodable!" << std::endl;
+        return false;
+      }
+
+      // the blocks in local cluster, and the blocks in each helper cluster, with the column of coefficients
+      std::vector<std::pair<int, int>> l_blocks;
+      std::map<int, std::vector<std::pair<int, int>>> h_blocks;
+      for (int i = 0; i < int(survive_idxs.size()); i++)
+      {
+        int idx = survive_idxs[i];
+        if (idx < k)
+        {
+          int j = int(std::find(received_idxs.begin(), received_idxs.end(), idx) - received_idxs.begin());
+          l_blocks.push_back(std::make_pair(-1 - j, i));
+        }
+        else if (block_clusterids[idx_to_pos[idx]] == m_self_cluster_id)
+        {
+          l_blocks.push_back(std::make_pair(idx_to_pos[idx], i));
+        }
+        else
+        {
+          h_blocks[block_clusterids[idx_to_pos[idx]]].push_back(std::make_pair(idx_to_pos[idx], i));
+        }
+      }
+
+      // the helpers send the partial blocks to an acceptor of this decoding only, not the shared one
+      asio::io_context help_io_context;
+      asio::ip::tcp::acceptor help_acceptor(help_io_context, asio::ip::tcp::endpoint(asio::ip::address::from_string(m_ip), 0));
+      int help_port = help_acceptor.local_endpoint().port();
+      std::atomic<int> failed_helpers{0};
+
+      // send the plans to the helper proxies
+      auto send_help_plan = [this, k, block_size, failed_num, help_port, &keys_nodes, &block_idxs, &coefficients, &failed_helpers](int t_cluster_id, std::vector<std::pair<int, int>> t_blocks)
+      {
+        grpc::ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(HELP_DECODE_TIMEOUT_MS));
+        proxy_proto::helpDecodePlan help_plan;
+        proxy_proto::RepIfSuccess reply;
+        help_plan.set_mainproxyip(m_ip);
+        help_plan.set_mainproxyport(help_port);
+        help_plan.set_block_size(block_size);
+        help_plan.set_failed_num(failed_num);
+        for (auto &t_block : t_blocks)
+        {
+          help_plan.add_blockkeys(keys_nodes[t_block.first].first);
+          help_plan.add_datanodeip(keys_nodes[t_block.first].second.first);
+          help_plan.add_datanodeport(keys_nodes[t_block.first].second.second);
+          help_plan.add_blockids(block_idxs[t_block.first]);
+        }
+        for (int i = 0; i < failed_num; i++)
+        {
+          for (auto &t_block : t_blocks)
+          {
+            help_plan.add_coefficients(coefficients[i * k + t_block.second]);
+          }
+        }
+        grpc::Status status = m_proxy_ptrs[t_cluster_id]->helpDecode(&context, help_plan, &reply);
+        if (!status.ok())
+        {
+          failed_helpers++;
+          std::cout << "[Proxy" << m_self_cluster_id << "][GET] helper proxy in cluster " << t_cluster_id << " failed!" << std::endl;
+        }
+      };
+      std::vector<std::thread> help_threads;
+      for (auto &kv : h_blocks)
+      {
+        help_threads.push_back(std::thread(send_help_plan, kv.first, kv.second));
+      }
+
+      // partial blocks, failed_num * (1 + number of helper clusters), the i-th failed block in [i * part_num, (i + 1) * part_num)
+      int part_num = 1 + int(h_blocks.size());
+      std::vector<std::vector<char>> v_part_area(failed_num * part_num, std::vector<char>(block_size, 0));
+      bool if_success = true;
+
+      // local partial decoding
+      int l_block_num = int(l_blocks.size());
+      if (l_block_num > 0)
+      {
+        std::vector<std::vector<char>> l_read_area(l_block_num);
+        std::vector<int> l_read_ret(l_block_num, 1);
+        std::vector<std::thread> read_threads;
+        for (int j = 0; j < l_block_num; j++)
+        {
+          int pos = l_blocks[j].first;
+          if (pos >= 0)
+          {
+            l_read_area[j].resize(block_size);
+            read_threads.push_back(std::thread([this, j, pos, block_size, &keys_nodes, &block_idxs, &l_read_area, &l_read_ret]()
+                                               { l_read_ret[j] = GetFromDatanode(keys_nodes[pos].first.c_str(), keys_nodes[pos].first.size(), l_read_area[j].data(), block_size,
+                                                                                 keys_nodes[pos].second.first.c_str(), keys_nodes[pos].second.second, block_idxs[pos] + 2); }));
+          }
+        }
+        for (int j = 0; j < int(read_threads.size()); j++)
+        {
+          read_threads[j].join();
+        }
+        std::vector<char *> v_data(l_block_num);
+        std::vector<char *> v_coding(failed_num);
+        std::vector<int> l_matrix(failed_num * l_block_num);
+        for (int j = 0; j < l_block_num; j++)
+        {
+          int pos = l_blocks[j].first;
+          if_success = if_success && l_read_ret[j];
+          v_data[j] = (pos >= 0) ? l_read_area[j].data() : received_blocks[-1 - pos].data();
+          for (int i = 0; i < failed_num; i++)
+          {
+            l_matrix[i * l_block_num + j] = coefficients[i * k + l_blocks[j].second];
+          }
+        }
+        for (int i = 0; i < failed_num; i++)
+        {
+          v_coding[i] = v_part_area[i * part_num].data();
+        }
+        jerasure_matrix_encode(l_block_num, failed_num, 8, l_matrix.data(), v_data.data(), v_coding.data(), block_size);
+      }
+
+      // get partial blocks from the helper proxies, give up once a helper failed
+      for (int j = 1; j < part_num && if_success; j++)
+      {
+        asio::ip::tcp::socket socket(help_io_context);
+        if (!accept_before(help_io_context, help_acceptor, socket, HELP_DECODE_TIMEOUT_MS, [&failed_helpers]()
+                           { return failed_helpers > 0; }))
+        {
+          if_success = false;
+          break;
+        }
+        asio::error_code ec;
+        std::vector<unsigned char> int_buf(sizeof(int));
+        asio::read(socket, asio::buffer(int_buf, int_buf.size()), ec);
+        int t_cluster_id = ec ? -1 : ECProject::bytes_to_int(int_buf);
+        if (t_cluster_id < 0)
+        {
+          if_success = false;
+          continue;
+        }
+        for (int i = 0; i < failed_num && !ec; i++)
+        {
+          asio::read(socket, asio::buffer(v_part_area[i * part_num + j].data(), block_size), ec);
+        }
+        if (ec)
+        {
+          if_success = false;
+        }
+        if (IF_DEBUG)
+        {
+          std::cout << "[Proxy" << m_self_cluster_id << "][GET] get partial blocks from the proxy in cluster " << t_cluster_id << std::endl;
+        }
+        asio::error_code ignore_ec;
+        socket.shutdown(asio::ip::tcp::socket::shutdown_both, ignore_ec);
+        socket.close(ignore_ec);
+      }
+      // the helpers not accepted yet fail to connect and return
+      asio::error_code ignore_ec;
+      help_acceptor.close(ignore_ec);
+      for (int j = 0; j < int(help_threads.size()); j++)
+      {
+        help_threads[j].join();
+      }
+      if (!if_success || failed_helpers > 0)
+      {
+        return false;
+      }
+
+      // sum up the partial blocks
+      std::vector<char *> vt_data(failed_num * part_num);
+      std::vector<char *> vt_coding(failed_num);
+      decoded_blocks.assign(failed_num, std::vector<char>(block_size));
+      for (int j = 0; j < failed_num * part_num; j++)
+      {
+        vt_data[j] = v_part_area[j].data();
+      }
+      for (int i = 0; i < failed_num; i++)
+      {
+        vt_coding[i] = decoded_blocks[i].data();
+      }
+      perform_addition(vt_data.data(), vt_coding.data(), block_size, failed_num * part_num, failed_num);
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << e.what() << '\n';
+      return false;
+    }
+    return true;
+  }
+
+  grpc::Status ProxyImpl::helpDecode(
+      grpc::ServerContext *context,
+      const proxy_proto::helpDecodePlan *help_decode_plan,
+      proxy_proto::RepIfSuccess *response)
+  {
+    std::string proxy_ip = help_decode_plan->mainproxyip();
+    int proxy_port = help_decode_plan->mainproxyport();
+    int block_size = help_decode_plan->block_size();
+    int failed_num = help_decode_plan->failed_num();
+    int block_num = help_decode_plan->blockkeys_size();
+    std::vector<int> coefficients;
+    for (int i = 0; i < help_decode_plan->coefficients_size(); i++)
+    {
+      coefficients.push_back(help_decode_plan->coefficients(i));
+    }
+
+    // get data from the datanode
+    std::vector<std::vector<char>> v_data_area(block_num, std::vector<char>(block_size));
+    std::vector<std::vector<char>> v_coding_area(failed_num, std::vector<char>(block_size));
+    std::vector<int> v_ret(block_num, 1);
+    auto getFromNode = [this, help_decode_plan, block_size, &v_data_area, &v_ret](int j)
+    {
+      std::string block_key = help_decode_plan->blockkeys(j);
+      v_ret[j] = GetFromDatanode(block_key.c_str(), block_key.size(), v_data_area[j].data(), block_size,
+                                 help_decode_plan->datanodeip(j).c_str(), help_decode_plan->datanodeport(j), help_decode_plan->blockids(j) + 2);
+    };
+    if (IF_DEBUG)
+    {
+      std::cout << "[Helper Proxy" << m_self_cluster_id << "][GET] Ready to read blocks from data node!" << std::endl;
+    }
+    bool if_success = (int(coefficients.size()) == failed_num * block_num);
+    try
+    {
+      std::vector<std::thread> read_treads;
+      for (int j = 0; j < block_num; j++)
+      {
+        read_treads.push_back(std::thread(getFromNode, j));
+      }
+      for (int j = 0; j < block_num; j++)
+      {
+        read_treads[j].join();
+        if_success = if_success && v_ret[j];
+      }
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << e.what() << '\n';
+      if_success = false;
+    }
+
+    // partial decoding
+    if (if_success)
+    {
+      std::vector<char *> v_data(block_num);
+      std::vector<char *> v_coding(failed_num);
+      for (int j = 0; j < block_num; j++)
+      {
+        v_data[j] = v_data_area[j].data();
+      }
+      for (int j = 0; j < failed_num; j++)
+      {
+        v_coding[j] = v_coding_area[j].data();
+      }
+      jerasure_matrix_encode(block_num, failed_num, 8, coefficients.data(), v_data.data(), v_coding.data(), block_size);
+    }
+    else
+    {
+      std::cout << "[Helper Proxy" << m_self_cluster_id << "][GET] can't get enough blocks!" << std::endl;
+    }
+
+    // send to main proxy, with -1 as cluster id if failed
+    try
+    {
+      asio::error_code error;
+      asio::io_context io_context;
+      asio::ip::tcp::socket socket(io_context);
+      asio::ip::tcp::resolver resolver(io_context);
+      asio::connect(socket, resolver.resolve({proxy_ip, std::to_string(proxy_port)}));
+      std::vector<unsigned char> int_buf_self_cluster_id = ECProject::int_to_bytes(if_success ? m_self_cluster_id : -1);
+      asio::write(socket, asio::buffer(int_buf_self_cluster_id, int_buf_self_cluster_id.size()), error);
+      for (int j = 0; j < failed_num && if_success; j++)
+      {
+        asio::write(socket, asio::buffer(v_coding_area[j].data(), block_size), error);
+      }
+      asio::error_code ignore_ec;
+      socket.shutdown(asio::ip::tcp::socket::shutdown_send, ignore_ec);
+      socket.close(ignore_ec);
+      if (IF_DEBUG)
+      {
+        std::cout << "[Helper Proxy" << m_self_cluster_id << "][GET] Send " << failed_num << " partial blocks to proxy" << proxy_port << std::endl;
+      }
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << e.what() << '\n';
+      if_success = false;
+    }
+    response->set_ifsuccess(if_success);
+    return grpc::Status::OK;
+  }
+
   // delete
   grpc::Status ProxyImpl::deleteBlock(
       grpc::ServerContext *context,
@@ -646,7 +1528,8 @@ namespace ECProject
       std::string ip_port = node_and_block->datanodeip(i) + ":" + std::to_string(node_and_block->datanodeport(i));
       nodes_ip_port.push_back(ip_port);
     }
-    auto delete_blocks = [this, key, blocks_id, stripe_id, nodes_ip_port]() mutable
+    int task_id = node_and_block->task_id();
+    auto delete_blocks = [this, key, blocks_id, stripe_id, nodes_ip_port, task_id]() mutable
     {
       auto request_and_delete = [this](std::string block_key, std::string node_ip_port)
       {
@@ -688,9 +1571,11 @@ namespace ECProject
         std::cout << "exception" << std::endl;
         std::cerr << e.what() << '\n';
       }
+      end_merge_task(task_id);
     };
     try
     {
+      begin_merge_task(task_id);
       std::thread my_thread(delete_blocks);
       my_thread.detach();
     }
@@ -706,11 +1591,46 @@ namespace ECProject
   // lrcwidestripe, merge
   // parity block recalculation
 
+  // the helper proxies of a recalculation connect to a port of its own,
+  // the shared one carries the data of the clients
+  grpc::Status ProxyImpl::openRecal(
+      grpc::ServerContext *context,
+      const proxy_proto::RecalPort *task,
+      proxy_proto::RecalPort *response)
+  {
+    try
+    {
+      auto recal_acceptor = std::make_shared<RecalAcceptor>(m_ip);
+      response->set_task_id(task->task_id());
+      response->set_port(recal_acceptor->acceptor.local_endpoint().port());
+      std::unique_lock<std::mutex> lck(m_mutex);
+      m_recal_acceptors[task->task_id()] = recal_acceptor;
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << e.what() << '\n';
+      return grpc::Status(grpc::StatusCode::UNAVAILABLE, "failed to open a port for the recalculation");
+    }
+    return grpc::Status::OK;
+  }
+
   grpc::Status ProxyImpl::mainRecal(
       grpc::ServerContext *context,
       const proxy_proto::mainRecalPlan *main_recal_plan,
       proxy_proto::RecalReply *response)
   {
+      int task_id = main_recal_plan->task_id();
+      begin_merge_task(task_id);
+      std::shared_ptr<RecalAcceptor> recal_acceptor;
+      {
+        std::unique_lock<std::mutex> lck(m_mutex);
+        auto it = m_recal_acceptors.find(task_id);
+        if (it != m_recal_acceptors.end())
+        {
+          recal_acceptor = it->second;
+          m_recal_acceptors.erase(it);
+        }
+      }
       int g_m, group_id, new_parity_num;
       bool if_partial_decoding;
       bool if_g_recal = main_recal_plan->type();
@@ -730,6 +1650,7 @@ namespace ECProject
       std::vector<int> l_datanode_port;
       std::vector<std::string> l_blockkeys;
       std::vector<int> l_blockids;
+      std::vector<int> l_groupids;
       // get the meta information
       for (int i = 0; i < main_recal_plan->p_blockkeys_size(); i++)
       {
@@ -738,7 +1659,24 @@ namespace ECProject
         p_blockkeys.push_back(main_recal_plan->p_blockkeys(i));
       }
       if_partial_decoding = main_recal_plan->if_partial_decoding();
-      if (!if_g_recal)
+      bool if_fused = main_recal_plan->if_fused();
+      std::vector<int> p_blockids;
+      for (int i = 0; i < main_recal_plan->p_blockids_size(); i++)
+      {
+        p_blockids.push_back(main_recal_plan->p_blockids(i));
+      }
+      if (if_fused)
+      {
+        // the helper proxies always send the partial parities
+        m_mutex.lock();
+        m_merge_step_processing[0] = true;
+        m_mutex.unlock();
+        g_m = main_recal_plan->g_m();
+        new_parity_num = int(p_blockids.size());
+        if_partial_decoding = true;
+        recal_type = "[Fused]";
+      }
+      else if (!if_g_recal)
       {
         m_mutex.lock();
         m_merge_step_processing[1] = true;
@@ -775,6 +1713,10 @@ namespace ECProject
         }
         else
         {
+          for (int j = 0; j < main_recal_plan->clusters(i).groupids_size(); j++)
+          {
+            l_groupids.push_back(main_recal_plan->clusters(i).groupids(j));
+          }
           for (int j = 0; j < main_recal_plan->clusters(i).blockkeys_size(); j++)
           {
             l_blockids.push_back(main_recal_plan->clusters(i).blockids(j));
@@ -785,34 +1727,47 @@ namespace ECProject
         }
       }
       
+      // the new parity blocks are not written if a block or a helper stream is missing
+      std::atomic<bool> recal_failed(false);
       try
       {
-        auto lock_ptr = std::make_shared<std::mutex>();
-        auto blocks_ptr = std::make_shared<std::vector<std::vector<char>>>();
-        auto blocks_key_ptr = std::make_shared<std::vector<std::string>>();
-        auto blocks_idx_ptr = std::make_shared<std::vector<int>>();
-        auto getFromNode = [this, blocks_ptr, blocks_key_ptr, blocks_idx_ptr, lock_ptr](int block_idx, std::string block_key, int block_size, std::string node_ip, int node_port) mutable
+        // the new parity blocks, each arriving chunk is added into them
+        std::vector<std::vector<char>> v_parity_area(new_parity_num, std::vector<char>(block_size, 0));
+        auto p_lock_ptr = std::make_shared<std::mutex>();
+        auto add_to_parity = [p_lock_ptr, &v_parity_area, new_parity_num](char **parity_chunks, int offset, int len)
         {
-          std::vector<char> temp(block_size);
-          bool ret = GetFromDatanode(block_key.c_str(), block_key.size(), temp.data(), block_size, node_ip.c_str(), node_port, block_idx + 2);
-          if (!ret)
+          std::unique_lock<std::mutex> lck(*p_lock_ptr);
+          for (int j = 0; j < new_parity_num; j++)
           {
-            std::cout << "getFromNode !ret" << std::endl;
-            return;
+            galois_region_xor(parity_chunks[j], v_parity_area[j].data() + offset, len);
+          }
+        };
+        // for fused recalculation, the coefficients of the blocks in local cluster
+        std::vector<int> l_coefficients;
+        if (if_fused && !make_recal_coefficients(k, g_m, main_recal_plan->l(), l_blockids, l_groupids, p_blockids, l_coefficients, encode_type))
+        {
+          std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] invalid fused plan!" << std::endl;
+          recal_failed = true;
+        }
+        // recalculate the partial parity chunks of a part of the blocks
+        auto encode_chunks = [k, g_m, if_g_recal, if_fused, &l_coefficients, new_parity_num, encode_type](char **data, char **coding, int len, std::shared_ptr<std::vector<int>> blocks_idx_ptr, int block_num)
+        {
+          if (if_fused)
+          {
+            jerasure_matrix_encode(block_num, new_parity_num, 8, l_coefficients.data(), data, coding, len);
+          }
+          else if (if_g_recal)
+          {
+            encode_partial_blocks_for_gr(k, g_m, data, coding, len, blocks_idx_ptr, block_num, encode_type);
+          }
+          else
+          {
+            std::vector<int> new_matrix(block_num * new_parity_num, 1);
+            jerasure_matrix_encode(block_num, new_parity_num, 8, new_matrix.data(), data, coding, len);
           }
-          lock_ptr->lock();
-          blocks_ptr->push_back(temp);
-          blocks_key_ptr->push_back(block_key);
-          blocks_idx_ptr->push_back(block_idx);
-          lock_ptr->unlock();
         };
 
-        auto p_lock_ptr = std::make_shared<std::mutex>();
-        auto m_blocks_ptr = std::make_shared<std::vector<std::vector<char>>>();
-        auto m_blocks_idx_ptr = std::make_shared<std::vector<int>>();
-        auto h_blocks_ptr = std::make_shared<std::vector<std::vector<char>>>();
-        auto h_blocks_idx_ptr = std::make_shared<std::vector<int>>();
-        auto getFromProxy = [this, recal_type, p_lock_ptr, m_blocks_ptr, m_blocks_idx_ptr, h_blocks_ptr, h_blocks_idx_ptr, block_size, if_partial_decoding, new_parity_num](int block_key_size, std::shared_ptr<asio::ip::tcp::socket> socket_ptr) mutable
+        auto getFromProxy = [this, recal_type, block_size, if_partial_decoding, new_parity_num, add_to_parity, encode_chunks, &recal_failed](std::shared_ptr<asio::ip::tcp::socket> socket_ptr) mutable
         {
           try
           {
@@ -824,36 +1779,54 @@ namespace ECProject
             {
               std::cout << "\033[1;36m" << recal_type << "[Main Proxy " << m_self_cluster_id << "] Try to get data from the proxy in cluster " << t_cluster_id << "\033[0m" << std::endl;
             }
-            if (if_partial_decoding)
+            // the blocks come chunk by chunk, the i-th chunk of all the blocks in a row
+            int block_num = new_parity_num;
+            auto blocks_idx_ptr = std::make_shared<std::vector<int>>();
+            if (!if_partial_decoding)
+            {
+              std::vector<unsigned char> int_buf_num_of_blocks(sizeof(int));
+              asio::read(*socket_ptr, asio::buffer(int_buf_num_of_blocks, int_buf_num_of_blocks.size()), ec);
+              block_num = ECProject::bytes_to_int(int_buf_num_of_blocks);
+              for (int j = 0; j < block_num; j++)
+              {
+                std::vector<unsigned char> byte_block_id(sizeof(int));
+                asio::read(*socket_ptr, asio::buffer(byte_block_id, byte_block_id.size()), ec);
+                blocks_idx_ptr->push_back(ECProject::bytes_to_int(byte_block_id));
+              }
+            }
+            std::vector<std::vector<char>> v_chunk_area(block_num, std::vector<char>(RECAL_CHUNK_SIZE));
+            std::vector<std::vector<char>> v_parity_chunk_area(new_parity_num, std::vector<char>(RECAL_CHUNK_SIZE));
+            std::vector<char *> v_chunks(block_num);
+            std::vector<char *> v_parity_chunks(new_parity_num);
+            for (int j = 0; j < block_num; j++)
+            {
+              v_chunks[j] = v_chunk_area[j].data();
+            }
+            for (int j = 0; j < new_parity_num; j++)
+            {
+              v_parity_chunks[j] = v_parity_chunk_area[j].data();
+            }
+            for (int offset = 0; offset < block_size; offset += RECAL_CHUNK_SIZE)
             {
-              p_lock_ptr->lock();
-              for (int j = 0; j < new_parity_num; j++)
+              int len = std::min(RECAL_CHUNK_SIZE, block_size - offset);
+              for (int j = 0; j < block_num; j++)
+              {
+                asio::read(*socket_ptr, asio::buffer(v_chunks[j], len), ec);
+              }
+              if (ec)
+              {
+                std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] failed to get data from the proxy in cluster " << t_cluster_id << std::endl;
+                recal_failed = true;
+                break;
+              }
+              if (if_partial_decoding)
               {
-                std::vector<char> tmp_val(block_size);
-                asio::read(*socket_ptr, asio::buffer(tmp_val.data(), block_size), ec);
-                m_blocks_ptr->push_back(tmp_val);
+                add_to_parity(v_chunks.data(), offset, len);
               }
-              m_blocks_idx_ptr->push_back(t_cluster_id);
-              p_lock_ptr->unlock();
-            }
-            else
-            {
-              std::vector<unsigned char> int_buf_num_of_blocks(sizeof(int));
-              asio::read(*socket_ptr, asio::buffer(int_buf_num_of_blocks, int_buf_num_of_blocks.size()), ec);
-              int block_num = ECProject::bytes_to_int(int_buf_num_of_blocks);
-              for (int j = 0; j < block_num; j++)
+              else
               {
-                // std::vector<char> tmp_key(block_key_size);
-                std::vector<char> tmp_val(block_size);
-                std::vector<unsigned char> byte_block_id(sizeof(int));
-                asio::read(*socket_ptr, asio::buffer(byte_block_id, byte_block_id.size()), ec);
-                int block_idx = ECProject::bytes_to_int(byte_block_id);
-                // asio::read(*socket_ptr, asio::buffer(tmp_key.data(), block_key_size), ec);
-                asio::read(*socket_ptr, asio::buffer(tmp_val.data(), block_size), ec);
-                p_lock_ptr->lock();
-                h_blocks_ptr->push_back(tmp_val);
-                h_blocks_idx_ptr->push_back(block_idx);
-                p_lock_ptr->unlock();
+                encode_chunks(v_chunks.data(), v_parity_chunks.data(), len, blocks_idx_ptr, block_num);
+                add_to_parity(v_parity_chunks.data(), offset, len);
               }
             }
 
@@ -864,6 +1837,7 @@ namespace ECProject
           }
           catch (const std::exception &e)
           {
+            recal_failed = true;
             std::cerr << e.what() << '\n';
           }
         };
@@ -873,229 +1847,137 @@ namespace ECProject
           SetToDatanode(block_key.c_str(), block_key.size(), data, block_size, s_node_ip.c_str(), s_node_port, j + 2);
         };
 
-        if (IF_DEBUG)
-        {
-          std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] get blocks in local cluster!" << std::endl;
-        }
-        // get data blocks in local cluster
-        int l_block_num = int(l_blockkeys.size());
-        if (l_block_num > 0)
-        {
-          try
-          {
-            std::vector<std::thread> read_threads;
-            for (int j = 0; j < l_block_num; j++)
-            {
-              read_threads.push_back(std::thread(getFromNode, j, l_blockkeys[j], block_size, l_datanode_ip[j], l_datanode_port[j]));
-            }
-            for (int j = 0; j < l_block_num; j++)
-            {
-              read_threads[j].join();
-            }
-          }
-          catch (const std::exception &e)
-          {
-            std::cerr << e.what() << '\n';
-          }
-          if (l_block_num != int(blocks_ptr->size()))
-          {
-            std::cout << "[Help] can't get enough blocks!" << std::endl;
-          }
-          std::vector<char *> v_data(l_block_num);
-          std::vector<char *> v_coding(1);
-          char **data = (char **)v_data.data();
-          char **coding = (char **)v_coding.data();
-          std::vector<std::vector<char>> v_data_area(l_block_num, std::vector<char>(block_size));
-          for (int j = 0; j < l_block_num; j++)
-          {
-            data[j] = v_data_area[j].data();
-          }
-          for (int j = 0; j < l_block_num; j++)
-          {
-            int idx = (*blocks_idx_ptr)[j];
-            if (idx < l_block_num)
-            {
-              memcpy(data[idx], (*blocks_ptr)[j].data(), block_size);
-            }
-          }
-          if (if_partial_decoding) // partial encoding
-          {
-            std::vector<std::vector<char>> v_coding_area(new_parity_num, std::vector<char>(block_size));
-            for (int j = 0; j < new_parity_num; j++)
-            {
-              coding[j] = v_coding_area[j].data();
-            }
-            if(if_g_recal)
-            {
-              encode_partial_blocks_for_gr(k, new_parity_num, data, coding, block_size, blocks_idx_ptr, l_block_num, encode_type);
-            }
-            else
-            {
-              perform_addition(data, coding, block_size, l_block_num, new_parity_num);
-            }
-            
-            p_lock_ptr->lock();
-            for (int j = 0; j < new_parity_num; j++)
-            {
-              m_blocks_ptr->push_back(v_coding_area[j]);
-            }
-            m_blocks_idx_ptr->push_back(m_self_cluster_id);
-            p_lock_ptr->unlock();
-          }
-          else
-          {
-            for (int j = 0; j < l_block_num; j++)
-            {
-              p_lock_ptr->lock();
-              h_blocks_idx_ptr->push_back((*blocks_idx_ptr)[j]);
-              h_blocks_ptr->push_back((*blocks_ptr)[j]);
-              p_lock_ptr->unlock();
-            }
-          }
-        }
-
         // get from proxy
         int m_num = int(help_locations.size());
         if (IF_DEBUG)
         {
           std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] get data blocks from " << m_num << " helper proxy!" << std::endl;
         }
+        std::vector<std::thread> read_p_threads;
         try
         {
-          std::vector<std::thread> read_p_threads;
-          for (int j = 0; j < m_num; j++)
+          if (m_num > 0 && recal_acceptor == nullptr)
           {
-            int t_blocks_num = help_locations[j].blockkeys_size();
-            int block_key_size = help_locations[0].blockkeys(0).size();
-            if (if_partial_decoding)
-            {
-              block_key_size = 0;
-              t_blocks_num = 1;
-            }
-            std::shared_ptr<asio::ip::tcp::socket> socket_ptr = std::make_shared<asio::ip::tcp::socket>(io_context);
-            acceptor.accept(*socket_ptr);
-            read_p_threads.push_back(std::thread(getFromProxy, block_key_size, socket_ptr));
-            if (!if_partial_decoding)
+            std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] no port opened for task " << task_id << std::endl;
+            recal_failed = true;
+          }
+          for (int j = 0; j < m_num && !recal_failed; j++)
+          {
+            std::shared_ptr<asio::ip::tcp::socket> socket_ptr = std::make_shared<asio::ip::tcp::socket>(recal_acceptor->io_context);
+            if (!accept_before(recal_acceptor->io_context, recal_acceptor->acceptor, *socket_ptr, HELP_RECAL_TIMEOUT_MS, []()
+                               { return false; }))
             {
-              l_block_num += t_blocks_num;
+              std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] helper proxies missing for task " << task_id << std::endl;
+              recal_failed = true;
+              break;
             }
+            read_p_threads.push_back(std::thread(getFromProxy, socket_ptr));
             if (IF_DEBUG)
             {
-              std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] cluster" << help_locations[j].cluster_id() << " block_key_size:" << block_key_size << " blocks_num:" << help_locations[j].blockkeys_size() << std::endl;
+              std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] cluster" << help_locations[j].cluster_id() << " blocks_num:" << help_locations[j].blockkeys_size() << std::endl;
             }
           }
-          for (int j = 0; j < m_num; j++)
-          {
-            read_p_threads[j].join();
-          }
         }
         catch (const std::exception &e)
         {
+          recal_failed = true;
           std::cerr << e.what() << '\n';
         }
-        if (l_block_num > 0)
-        {
-          m_num += 1; // add local
-        }
-        if (IF_DEBUG)
-        {
-          std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] recalculating new parity blocks!" << std::endl;
-        }
-        // encode
-        int count = l_block_num;
-        if (if_partial_decoding)
-        {
-          count = m_num * new_parity_num;
-        }
-        std::vector<char *> vt_data(count);
-        std::vector<char *> vt_coding(new_parity_num);
-        char **t_data = (char **)vt_data.data();
-        char **t_coding = (char **)vt_coding.data();
-        std::vector<std::vector<char>> vt_data_area(count, std::vector<char>(block_size));
-        std::vector<std::vector<char>> vt_coding_area(new_parity_num, std::vector<char>(block_size));
+
         if (IF_DEBUG)
         {
-          std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] " << count << " " << m_blocks_ptr->size() << " " << h_blocks_ptr->size() << std::endl;
-        }
-        for (int j = 0; j < count; j++)
-        {
-          t_data[j] = vt_data_area[j].data();
-        }
-        for (int j = 0; j < new_parity_num; j++)
-        {
-          t_coding[j] = vt_coding_area[j].data();
+          std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] get blocks in local cluster!" << std::endl;
         }
-        if (if_partial_decoding)
+        // get data blocks in local cluster, chunk by chunk, along with the helper proxies
+        int l_block_num = int(l_blockkeys.size());
+        if (l_block_num > 0)
         {
-          if(if_g_recal)
+          std::vector<std::vector<char>> v_data_area(l_block_num, std::vector<char>(block_size));
+          std::vector<std::vector<char>> v_parity_chunk_area(new_parity_num, std::vector<char>(RECAL_CHUNK_SIZE));
+          std::vector<char *> v_data(l_block_num);
+          std::vector<char *> v_parity_chunks(new_parity_num);
+          std::vector<int> received(l_block_num, 0);
+          std::mutex l_mutex;
+          std::condition_variable l_cv;
+          auto blocks_idx_ptr = std::make_shared<std::vector<int>>(l_blockids);
+          for (int j = 0; j < new_parity_num; j++)
           {
-            int index = 0;
-            for(int j = 0; j < m_num; j++)
-            {
-              for(int jj = 0; jj < new_parity_num; jj++)
-              {
-                memcpy(t_data[index++], (*m_blocks_ptr)[jj * new_parity_num + j].data(), block_size);
-              }
-            }
+            v_parity_chunks[j] = v_parity_chunk_area[j].data();
           }
-          else
+          std::vector<std::thread> read_threads;
+          for (int j = 0; j < l_block_num; j++)
+          {
+            read_threads.push_back(std::thread([this, j, block_size, &l_blockkeys, &l_blockids, &l_datanode_ip, &l_datanode_port, &v_data_area, &received, &l_mutex, &l_cv, &recal_failed]()
+                                               {
+                                                 bool ret = GetFromDatanodeByChunk(l_blockkeys[j].c_str(), l_blockkeys[j].size(), v_data_area[j].data(), block_size, l_datanode_ip[j].c_str(), l_datanode_port[j], l_blockids[j] + 2,
+                                                                                   [j, &received, &l_mutex, &l_cv](int len)
+                                                                                   {
+                                                                                     std::unique_lock<std::mutex> lck(l_mutex);
+                                                                                     received[j] = len;
+                                                                                     l_cv.notify_all();
+                                                                                   });
+                                                 if (!ret)
+                                                 {
+                                                   std::cout << "[Main Proxy" << m_self_cluster_id << "] getFromNode !ret" << std::endl;
+                                                   recal_failed = true;
+                                                   std::unique_lock<std::mutex> lck(l_mutex);
+                                                   received[j] = block_size;
+                                                   l_cv.notify_all();
+                                                 } }));
+          }
+          for (int offset = 0; offset < block_size; offset += RECAL_CHUNK_SIZE)
           {
-            for(int j = 0; j < count; j++)
+            int len = std::min(RECAL_CHUNK_SIZE, block_size - offset);
+            {
+              std::unique_lock<std::mutex> lck(l_mutex);
+              l_cv.wait(lck, [&received, offset, len]()
+                        { return *std::min_element(received.begin(), received.end()) >= offset + len; });
+            }
+            if (recal_failed)
+            {
+              break;
+            }
+            for (int j = 0; j < l_block_num; j++)
             {
-              memcpy(t_data[j], (*m_blocks_ptr)[j].data(), block_size);
+              v_data[j] = v_data_area[j].data() + offset;
             }
+            encode_chunks(v_data.data(), v_parity_chunks.data(), len, blocks_idx_ptr, l_block_num);
+            add_to_parity(v_parity_chunks.data(), offset, len);
           }
-        }
-        else
-        {
-          for (int j = 0; j < count; j++)
+          for (int j = 0; j < l_block_num; j++)
           {
-            memcpy(t_data[j], (*h_blocks_ptr)[j].data(), block_size);
+            read_threads[j].join();
           }
         }
-        // clear
-        blocks_ptr->clear();
-        blocks_key_ptr->clear();
-        blocks_idx_ptr->clear();
-        m_blocks_ptr->clear();
-        h_blocks_idx_ptr->clear();
-        m_blocks_idx_ptr->clear();
-        h_blocks_ptr->clear();
-        
-        if (IF_DEBUG)
+
+        for (int j = 0; j < int(read_p_threads.size()); j++)
         {
-          std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] encoding!" << std::endl;
+          read_p_threads[j].join();
         }
-        try
+        if (recal_acceptor != nullptr)
         {
-          if(if_partial_decoding || !if_g_recal)
-          {
-            perform_addition(t_data, t_coding, block_size, count, new_parity_num);
-          }
-          else
-          {
-            encode_partial_blocks_for_gr(k, g_m, t_data, t_coding, block_size, h_blocks_idx_ptr, count, encode_type);
-          }
+          asio::error_code ignore_ec;
+          recal_acceptor->acceptor.close(ignore_ec);
         }
 
-        catch (const std::exception &e)
+        // set
+        if (recal_failed)
         {
-          std::cerr << e.what() << '\n';
+          std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] missing blocks, the new parity blocks of Stripe" << stripe_id << " are not set!" << std::endl;
         }
-
-        // set
-        if (IF_DEBUG)
+        else if (IF_DEBUG)
         {
           std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] set new parity blocks!" << std::endl;
         }
-        // int p_block_num = int(p_blockkeys.size());
         try
         {
           std::vector<std::thread> set_threads;
-          for (int i = 0; i < new_parity_num; i++)
+          for (int i = 0; i < new_parity_num && !recal_failed; i++)
           {
             std::string new_id = "";
-            if (if_g_recal){
+            if (if_fused){
+              new_id = p_blockkeys[i];
+            }else if (if_g_recal){
               new_id = "Stripe" + std::to_string(stripe_id) + "_G" + std::to_string(i);
             }else{
               new_id = "Stripe" + std::to_string(stripe_id) + "_L" + std::to_string(group_id);
@@ -1106,9 +1988,9 @@ namespace ECProject
             {
               std::cout << recal_type << "[Main Proxy" << m_self_cluster_id << "] set " << new_id << " to datanode " << s_node_port << std::endl;
             }
-            set_threads.push_back(std::thread(send_to_datanode, i, new_id, t_coding[i], block_size, s_node_ip, s_node_port));
+            set_threads.push_back(std::thread(send_to_datanode, i, new_id, v_parity_area[i].data(), block_size, s_node_ip, s_node_port));
           }
-          for (int i = 0; i < new_parity_num; i++)
+          for (int i = 0; i < int(set_threads.size()); i++)
           {
             set_threads[i].join();
           }
@@ -1117,7 +1999,7 @@ namespace ECProject
         {
           std::cerr << e.what() << '\n';
         }
-        if (if_g_recal){
+        if (if_g_recal || if_fused){
           m_merge_step_processing[0] = false;
           cv.notify_all();
         }else{
@@ -1127,9 +2009,11 @@ namespace ECProject
       }
       catch (const std::exception &e)
       {
+        recal_failed = true;
         std::cout << "[Proxy" << m_self_cluster_id << "] error!" << std::endl;
         std::cerr << e.what() << '\n';
       }
+      end_merge_task(task_id, !recal_failed);
 
       return grpc::Status::OK;
   }
@@ -1158,149 +2042,192 @@ namespace ECProject
       blockkeys.push_back(help_recal_plan->blockkeys(i));
       blockids.push_back(help_recal_plan->blockids(i));
     }
-    
-    // get data from the datanode
-    auto myLock_ptr = std::make_shared<std::mutex>();
-    auto blocks_ptr = std::make_shared<std::vector<std::vector<char>>>();
-    auto blocks_key_ptr = std::make_shared<std::vector<std::string>>();
-    auto blocks_idx_ptr = std::make_shared<std::vector<int>>();
-    auto getFromNode = [this, blocks_ptr, blocks_key_ptr, blocks_idx_ptr, myLock_ptr](int block_idx, std::string block_key, int block_size, std::string node_ip, int node_port) mutable
-    {
-      std::vector<char> temp(block_size);
-      bool ret = GetFromDatanode(block_key.c_str(), block_key.size(), temp.data(), block_size, node_ip.c_str(), node_port, block_idx + 2);
 
+    // get data from the datanode chunk by chunk
+    int block_num = int(blockkeys.size());
+    std::vector<std::vector<char>> v_data_area(block_num, std::vector<char>(block_size));
+    std::vector<int> received(block_num, 0);
+    std::mutex myLock;
+    std::condition_variable myCv;
+    std::atomic<bool> read_failed(false);
+    auto getFromNode = [this, block_size, &blockkeys, &blockids, &datanode_ip, &datanode_port, &v_data_area, &received, &myLock, &myCv, &read_failed](int j)
+    {
+      bool ret = GetFromDatanodeByChunk(blockkeys[j].c_str(), blockkeys[j].size(), v_data_area[j].data(), block_size, datanode_ip[j].c_str(), datanode_port[j], blockids[j] + 2,
+                                        [j, &received, &myLock, &myCv](int len)
+                                        {
+                                          std::unique_lock<std::mutex> lck(myLock);
+                                          received[j] = len;
+                                          myCv.notify_all();
+                                        });
       if (!ret)
       {
         std::cout << "getFromNode !ret" << std::endl;
-        return;
+        read_failed = true;
+        std::unique_lock<std::mutex> lck(myLock);
+        received[j] = block_size;
+        myCv.notify_all();
       }
-      myLock_ptr->lock();
-      blocks_ptr->push_back(temp);
-      blocks_key_ptr->push_back(block_key);
-      blocks_idx_ptr->push_back(block_idx);
-      myLock_ptr->unlock();
     };
     if (IF_DEBUG)
     {
       std::cout << "[Helper Proxy" << m_self_cluster_id << "] Ready to read blocks from data node!" << std::endl;
     }
-    int block_num = int(blockkeys.size());
+    std::vector<std::thread> read_treads;
     try
     {
-      std::vector<std::thread> read_treads;
-      for (int j = 0; j < block_num; j++)
-      {
-        read_treads.push_back(std::thread(getFromNode, blockids[j], blockkeys[j], block_size, datanode_ip[j], datanode_port[j]));
-      }
       for (int j = 0; j < block_num; j++)
       {
-        read_treads[j].join();
+        read_treads.push_back(std::thread(getFromNode, j));
       }
     }
     catch (const std::exception &e)
     {
       std::cerr << e.what() << '\n';
     }
-    if (block_num != int(blocks_ptr->size()))
-    {
-      std::cout << "[Help] can't get enough blocks!" << std::endl;
-    }
-    std::vector<char *> v_data(block_num);
-    std::vector<char *> v_coding(parity_num);
-    char **data = (char **)v_data.data();
-    char **coding = (char **)v_coding.data();
-    std::vector<std::vector<char>> v_data_area(block_num, std::vector<char>(block_size));
-    std::vector<std::vector<char>> v_coding_area(parity_num, std::vector<char>(block_size));
-    for (int j = 0; j < block_num; j++)
-    {
-      data[j] = v_data_area[j].data();
-    }
-    for (int j = 0; j < parity_num; j++)
-    {
-      coding[j] = v_coding_area[j].data();
-    }
-    for (int j = 0; j < block_num; j++)
-    {
-      // int idx = (*blocks_idx_ptr)[j];
-      // if (idx < block_num)
-      // {
-      //   memcpy(data[idx], (*blocks_ptr)[j].data(), block_size);
-      // }
-      memcpy(data[j], (*blocks_ptr)[j].data(), block_size);
-    }
 
-    // encode
-    if (if_partial_decoding) // partial encoding
+    // the main proxies to send to, only one unless fused
+    bool if_fused = help_recal_plan->if_fused();
+    std::vector<std::pair<std::string, int>> main_proxies;
+    std::vector<std::vector<int>> v_coefficients;
+    if (if_fused)
     {
-      if (IF_DEBUG)
-      {
-        std::cout << "[Helper Proxy" << m_self_cluster_id << "] partial encoding!" << std::endl;
-        for(auto it = blocks_idx_ptr->begin(); it != blocks_idx_ptr->end(); it++)
-        {
-            std::cout << (*it) << " ";
-        }
-        std::cout << std::endl;
-      }
-      
-      if(if_g_recal)
+      std::vector<int> groupids;
+      for (int i = 0; i < help_recal_plan->groupids_size(); i++)
       {
-        encode_partial_blocks_for_gr(k, parity_num, data, coding, block_size, blocks_idx_ptr, block_num, encode_type);
+        groupids.push_back(help_recal_plan->groupids(i));
       }
-      else
+      for (int i = 0; i < help_recal_plan->targets_size(); i++)
       {
-        perform_addition(data, coding, block_size, block_num, parity_num);
+        const proxy_proto::fusedTarget &t_target = help_recal_plan->targets(i);
+        std::vector<int> parityids(t_target.parityids().begin(), t_target.parityids().end());
+        std::vector<int> coefficients;
+        if (!make_recal_coefficients(k, help_recal_plan->g_m(), help_recal_plan->l(), blockids, groupids, parityids, coefficients, encode_type))
+        {
+          std::cout << "[Helper Proxy" << m_self_cluster_id << "] invalid fused plan!" << std::endl;
+        }
+        main_proxies.push_back(std::make_pair(t_target.mainproxyip(), t_target.mainproxyport()));
+        v_coefficients.push_back(coefficients);
       }
+      if_partial_decoding = true;
+    }
+    else
+    {
+      main_proxies.push_back(std::make_pair(proxy_ip, proxy_port));
     }
 
-    // send to main proxy
+    // connect to main proxies
     asio::error_code error;
     asio::io_context io_context;
-    asio::ip::tcp::socket socket(io_context);
+    std::vector<std::shared_ptr<asio::ip::tcp::socket>> sockets;
     asio::ip::tcp::resolver resolver(io_context);
-    asio::error_code con_error;
-    if (IF_DEBUG)
+    for (auto &main_proxy : main_proxies)
     {
-      std::cout << "\033[1;36m[Helper Proxy" << m_self_cluster_id << "] Try to connect main proxy port " << proxy_port << "\033[0m" << std::endl;
-    }
-    asio::connect(socket, resolver.resolve({proxy_ip, std::to_string(proxy_port)}), con_error);
-    if (!con_error && IF_DEBUG)
-    {
-      std::cout << "Connect to " << proxy_ip << ":" << proxy_port << " success!" << std::endl;
+      asio::error_code con_error;
+      if (IF_DEBUG)
+      {
+        std::cout << "\033[1;36m[Helper Proxy" << m_self_cluster_id << "] Try to connect main proxy port " << main_proxy.second << "\033[0m" << std::endl;
+      }
+      auto socket_ptr = std::make_shared<asio::ip::tcp::socket>(io_context);
+      asio::connect(*socket_ptr, resolver.resolve({main_proxy.first, std::to_string(main_proxy.second)}), con_error);
+      if (!con_error && IF_DEBUG)
+      {
+        std::cout << "Connect to " << main_proxy.first << ":" << main_proxy.second << " success!" << std::endl;
+      }
+      std::vector<unsigned char> int_buf_self_cluster_id = ECProject::int_to_bytes(m_self_cluster_id);
+      asio::write(*socket_ptr, asio::buffer(int_buf_self_cluster_id, int_buf_self_cluster_id.size()), error);
+      sockets.push_back(socket_ptr);
     }
 
     int value_size = 0;
-    
-    std::vector<unsigned char> int_buf_self_cluster_id = ECProject::int_to_bytes(m_self_cluster_id);
-    asio::write(socket, asio::buffer(int_buf_self_cluster_id, int_buf_self_cluster_id.size()), error);
     if (!if_partial_decoding)
     {
       std::vector<unsigned char> int_buf_num_of_blocks = ECProject::int_to_bytes(block_num);
-      asio::write(socket, asio::buffer(int_buf_num_of_blocks, int_buf_num_of_blocks.size()), error);
-      int j = 0;
-      for(auto it = blocks_idx_ptr->begin(); it != blocks_idx_ptr->end(); it++, j++)
-      { 
-        // send index and value
-        int block_idx = *it;
-        std::vector<unsigned char> byte_block_idx = ECProject::int_to_bytes(block_idx);
-        asio::write(socket, asio::buffer(byte_block_idx, byte_block_idx.size()), error);
-        asio::write(socket, asio::buffer(data[j], block_size), error);
-        value_size += block_size;
+      asio::write(*sockets[0], asio::buffer(int_buf_num_of_blocks, int_buf_num_of_blocks.size()), error);
+      for (int j = 0; j < block_num; j++)
+      {
+        std::vector<unsigned char> byte_block_idx = ECProject::int_to_bytes(blockids[j]);
+        asio::write(*sockets[0], asio::buffer(byte_block_idx, byte_block_idx.size()), error);
       }
     }
-    else
+
+    // encode and send the chunk while reading the next one
+    auto blocks_idx_ptr = std::make_shared<std::vector<int>>(blockids);
+    int max_parity_num = parity_num;
+    for (int t = 0; t < int(v_coefficients.size()); t++)
+    {
+      max_parity_num = std::max(max_parity_num, int(v_coefficients[t].size()) / std::max(block_num, 1));
+    }
+    std::vector<char *> v_data(block_num);
+    std::vector<char *> v_coding(max_parity_num);
+    std::vector<std::vector<char>> v_coding_area(max_parity_num, std::vector<char>(RECAL_CHUNK_SIZE));
+    for (int j = 0; j < max_parity_num; j++)
     {
-      for (int j = 0; j < parity_num; j++)
+      v_coding[j] = v_coding_area[j].data();
+    }
+    for (int offset = 0; offset < block_size; offset += RECAL_CHUNK_SIZE)
+    {
+      int len = std::min(RECAL_CHUNK_SIZE, block_size - offset);
+      {
+        std::unique_lock<std::mutex> lck(myLock);
+        myCv.wait(lck, [&received, offset, len]()
+                  { return *std::min_element(received.begin(), received.end()) >= offset + len; });
+      }
+      // the main proxies see the streams end early and do not write the parities
+      if (read_failed)
+      {
+        std::cout << "[Helper Proxy" << m_self_cluster_id << "] failed to read the blocks, stop sending!" << std::endl;
+        break;
+      }
+      for (int j = 0; j < block_num; j++)
+      {
+        v_data[j] = v_data_area[j].data() + offset;
+      }
+      if (!if_partial_decoding)
+      {
+        for (int j = 0; j < block_num; j++)
+        {
+          asio::write(*sockets[0], asio::buffer(v_data[j], len), error);
+          value_size += len;
+        }
+        continue;
+      }
+      for (int t = 0; t < int(sockets.size()); t++)
       {
-        asio::write(socket, asio::buffer(coding[j], block_size), error);
-        value_size += block_size;
+        // partial encoding
+        int t_parity_num = parity_num;
+        if (if_fused)
+        {
+          t_parity_num = int(v_coefficients[t].size()) / block_num;
+          jerasure_matrix_encode(block_num, t_parity_num, 8, v_coefficients[t].data(), v_data.data(), v_coding.data(), len);
+        }
+        else if (if_g_recal)
+        {
+          encode_partial_blocks_for_gr(k, parity_num, v_data.data(), v_coding.data(), len, blocks_idx_ptr, block_num, encode_type);
+        }
+        else
+        {
+          perform_addition(v_data.data(), v_coding.data(), len, block_num, parity_num);
+        }
+        for (int j = 0; j < t_parity_num; j++)
+        {
+          asio::write(*sockets[t], asio::buffer(v_coding[j], len), error);
+          value_size += len;
+        }
       }
     }
-    asio::error_code ignore_ec;
-    socket.shutdown(asio::ip::tcp::socket::shutdown_send, ignore_ec);
-    socket.close(ignore_ec);
+    for (int j = 0; j < int(read_treads.size()); j++)
+    {
+      read_treads[j].join();
+    }
+    for (auto &socket_ptr : sockets)
+    {
+      asio::error_code ignore_ec;
+      socket_ptr->shutdown(asio::ip::tcp::socket::shutdown_send, ignore_ec);
+      socket_ptr->close(ignore_ec);
+    }
     if (IF_DEBUG)
     {
-      std::cout << "[Helper Proxy" << m_self_cluster_id << "] Send value to proxy" << proxy_port << "! With length of " << value_size << std::endl;
+      std::cout << "[Helper Proxy" << m_self_cluster_id << "] Send value to " << sockets.size() << " main proxies! With length of " << value_size << std::endl;
     }
 
     return grpc::Status::OK;
@@ -1327,35 +2254,118 @@ namespace ECProject
       des_node_ip.push_back(reloc_plan->todatanodeip(i));
       des_node_port.push_back(reloc_plan->todatanodeport(i));
     }
-    auto relocate_blocks = [this, blocks_id, block_size, src_node_ip, src_node_port, des_node_ip, des_node_port]() mutable
+    int task_id = reloc_plan->task_id();
+    int max_parallel = reloc_plan->max_parallel() > 0 ? reloc_plan->max_parallel() : RELOC_MAX_PARALLEL;
+    int max_per_des_node = reloc_plan->max_per_des_node() > 0 ? reloc_plan->max_per_des_node() : RELOC_MAX_PER_DES_NODE;
+    double bandwidth = reloc_plan->bandwidth() > 0 ? double(reloc_plan->bandwidth()) : double(RELOC_BANDWIDTH);
+    auto relocate_blocks = [this, blocks_id, block_size, src_node_ip, src_node_port, des_node_ip, des_node_port, task_id,
+                            max_parallel, max_per_des_node, bandwidth]() mutable
     {
-      auto relocate_single_block = [this](int j, std::string block_key, int block_size, std::string src_node_ip, int src_node_port, std::string des_node_ip, int des_node_port)
+      int num_of_blocks = int(blocks_id.size());
+      std::vector<std::string> src_ip_ports, des_ip_ports;
+      for (int j = 0; j < num_of_blocks; j++)
+      {
+        src_ip_ports.push_back(src_node_ip[j] + ":" + std::to_string(src_node_port[j]));
+        des_ip_ports.push_back(des_node_ip[j] + ":" + std::to_string(des_node_port[j]));
+      }
+      // copies in flight, in total and from or to each datanode
+      int num_of_running = 0;
+      std::unordered_map<std::string, int> src_running, des_running;
+      std::vector<int> copied(num_of_blocks, 0);
+      std::mutex r_mutex;
+      std::condition_variable r_cv;
+      // the bandwidth budget, each copy takes a time slot of block_size / bandwidth
+      auto next_slot = std::chrono::steady_clock::now();
+      auto wait_for_budget = [&r_mutex, &next_slot, bandwidth, block_size]()
       {
-        bool ret = BlockRelocation(block_key.c_str(), block_size, src_node_ip.c_str(), src_node_port, des_node_ip.c_str(), des_node_port);
-        if(!ret)
+        if (bandwidth <= 0)
+        {
+          return;
+        }
+        std::chrono::steady_clock::time_point start;
         {
-          std::cout << "[Block Relocation] Relocate " << block_key << " Failed!" << std::endl;
+          std::unique_lock<std::mutex> lck(r_mutex);
+          start = std::max(next_slot, std::chrono::steady_clock::now());
+          next_slot = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                  std::chrono::duration<double>(double(block_size) / bandwidth));
         }
-        std::string src_ip_port = src_node_ip + ":" + std::to_string(src_node_port);
-        bool ret3 = DelInDatanode(block_key, src_ip_port);
-        if (!ret3)
+        std::this_thread::sleep_until(start);
+      };
+      auto relocate_single_block = [this, &blocks_id, block_size, &src_node_ip, &src_node_port, &des_node_ip, &des_node_port,
+                                    &src_ip_ports, &des_ip_ports, &copied, &num_of_running, &src_running, &des_running,
+                                    &r_mutex, &r_cv, wait_for_budget](int j)
+      {
+        wait_for_budget();
+        bool ret = BlockRelocation(blocks_id[j].c_str(), block_size, src_node_ip[j].c_str(), src_node_port[j], des_node_ip[j].c_str(), des_node_port[j]);
+        if (!ret)
         {
-          std::cout << "[Block Relocation] Delete in the src node failed : " << block_key << std::endl;
+          std::cout << "[Block Relocation] Relocate " << blocks_id[j] << " Failed!" << std::endl;
         }
+        std::unique_lock<std::mutex> lck(r_mutex);
+        copied[j] = ret ? 1 : 0;
+        num_of_running--;
+        src_running[src_ip_ports[j]]--;
+        des_running[des_ip_ports[j]]--;
+        r_cv.notify_all();
       };
       try
       {
-        // std::vector<std::thread> senders;
-        for (int j = 0; j < int(blocks_id.size()); j++)
+        std::vector<std::thread> senders;
+        std::vector<bool> started(num_of_blocks, false);
+        int num_of_started = 0;
+        std::unique_lock<std::mutex> lck(r_mutex);
+        while (num_of_started < num_of_blocks)
+        {
+          // start the blocks whose source and destination datanodes are under their caps
+          bool dispatched = false;
+          for (int j = 0; j < num_of_blocks && num_of_running < max_parallel; j++)
+          {
+            if (started[j] || src_running[src_ip_ports[j]] >= RELOC_MAX_PER_SRC_NODE ||
+                des_running[des_ip_ports[j]] >= max_per_des_node)
+            {
+              continue;
+            }
+            started[j] = true;
+            num_of_started++;
+            num_of_running++;
+            src_running[src_ip_ports[j]]++;
+            des_running[des_ip_ports[j]]++;
+            senders.push_back(std::thread(relocate_single_block, j));
+            dispatched = true;
+          }
+          if (!dispatched)
+          {
+            r_cv.wait(lck);
+          }
+        }
+        lck.unlock();
+        for (int j = 0; j < int(senders.size()); j++)
         {
-          relocate_single_block(j, blocks_id[j], block_size, src_node_ip[j], src_node_port[j], des_node_ip[j], des_node_port[j]);
-          // senders.push_back(std::thread(relocate_single_block, j, blocks_id[j], block_size, src_node_ip[j], src_node_port[j], des_node_ip[j], des_node_port[j]));
+          senders[j].join();
         }
-        // for (int j = 0; j < int(senders.size()); j++)
-        // {
-        //   senders[j].join();
-        // }
-        
+
+        // delete the source blocks in a batch, only for the confirmed copies
+        auto delete_single_block = [this, &blocks_id, &src_ip_ports](int j)
+        {
+          bool ret3 = DelInDatanode(blocks_id[j], src_ip_ports[j]);
+          if (!ret3)
+          {
+            std::cout << "[Block Relocation] Delete in the src node failed : " << blocks_id[j] << std::endl;
+          }
+        };
+        std::vector<std::thread> deleters;
+        for (int j = 0; j < num_of_blocks; j++)
+        {
+          if (copied[j])
+          {
+            deleters.push_back(std::thread(delete_single_block, j));
+          }
+        }
+        for (int j = 0; j < int(deleters.size()); j++)
+        {
+          deleters[j].join();
+        }
+
         m_merge_step_processing[2] = false;
         cv.notify_all();
       }
@@ -1364,12 +2374,14 @@ namespace ECProject
         std::cout << "exception" << std::endl;
         std::cerr << e.what() << '\n';
       }
+      end_merge_task(task_id);
     };
     try
     {
       m_mutex.lock();
       m_merge_step_processing[2] = true;
       m_mutex.unlock();
+      begin_merge_task(task_id);
       std::thread my_thread(relocate_blocks);
       my_thread.detach();
     }
@@ -1389,6 +2401,16 @@ namespace ECProject
   {
     std::unique_lock<std::mutex> lck(m_mutex);
     int idx = step->step();
+    int task_id = step->task_id();
+    if (task_id > 0)
+    {
+      while (m_merge_tasks.find(task_id) != m_merge_tasks.end())
+      {
+        cv.wait(lck);
+      }
+      response->set_ifsuccess(m_failed_merge_tasks.erase(task_id) == 0);
+      return grpc::Status::OK;
+    }
     if (IF_DEBUG)
     {
       std::cout << "\033[1;34m[Main Proxy" << m_self_cluster_id << "] Step" << idx << ":" << m_merge_step_processing[idx] << "\033[0m\n";
@@ -1401,4 +2423,52 @@ namespace ECProject
     return grpc::Status::OK;
   }
 
+  // accept a connection, false once the timeout passed or give_up tells so
+  bool ProxyImpl::accept_before(asio::io_context &t_io_context, asio::ip::tcp::acceptor &t_acceptor, asio::ip::tcp::socket &socket,
+                                int timeout_ms, const std::function<bool()> &give_up)
+  {
+    asio::error_code accept_ec = asio::error::would_block;
+    t_acceptor.async_accept(socket, [&accept_ec](const asio::error_code &ec)
+                            { accept_ec = ec; });
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    t_io_context.restart();
+    while (accept_ec == asio::error::would_block && !give_up() && std::chrono::steady_clock::now() < deadline)
+    {
+      t_io_context.run_for(std::chrono::milliseconds(100));
+    }
+    if (accept_ec == asio::error::would_block)
+    {
+      asio::error_code ignore_ec;
+      t_acceptor.cancel(ignore_ec);
+      t_io_context.run();
+      return false;
+    }
+    return !accept_ec;
+  }
+
+  void ProxyImpl::begin_merge_task(int task_id)
+  {
+    if (task_id <= 0)
+    {
+      return;
+    }
+    std::unique_lock<std::mutex> lck(m_mutex);
+    m_merge_tasks.insert(task_id);
+  }
+
+  void ProxyImpl::end_merge_task(int task_id, bool success)
+  {
+    if (task_id <= 0)
+    {
+      return;
+    }
+    std::unique_lock<std::mutex> lck(m_mutex);
+    m_merge_tasks.erase(task_id);
+    if (!success)
+    {
+      m_failed_merge_tasks.insert(task_id);
+    }
+    cv.notify_all();
+  }
+
 } // namespace ECProject